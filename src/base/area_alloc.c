@@ -37,6 +37,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#if defined (SERVER_MODE) && defined (LINUX)
+#include <sched.h>
+#include <unistd.h>
+#endif /* SERVER_MODE && LINUX */
 
 #include "error_manager.h"
 #include "memory_alloc.h"
@@ -84,6 +88,8 @@ static AREA_BLOCK *area_alloc_block (AREA * area);
 static AREA_BLOCKSET_LIST *area_alloc_blockset (AREA * area);
 static int area_insert_block (AREA * area, AREA_BLOCK * new_block);
 static AREA_BLOCK *area_find_block (AREA * area, const void *ptr);
+static int area_get_num_shards (void);
+STATIC_INLINE int area_get_shard (AREA * area) __attribute__ ((ALWAYS_INLINE));
 
 /*
  * area_init - Initialize the area manager
@@ -186,6 +192,9 @@ area_create (const char *name, size_t element_size, size_t alloc_count)
 
   area->n_allocs = 0;
   area->n_frees = 0;
+  area->n_blocks = 0;
+  area->num_shards = area_get_num_shards ();
+  memset (area->shards, 0, sizeof (area->shards));
 #if defined (SERVER_MODE)
   area->failure_function = NULL;
 #else
@@ -198,13 +207,15 @@ area_create (const char *name, size_t element_size, size_t alloc_count)
       goto error;
     }
 
-  area->hint_block = area_alloc_block (area);
-  if (area->hint_block == NULL)
+  /* the other shards get their own block when they first allocate */
+  area->shards[0].hint_block = area_alloc_block (area);
+  if (area->shards[0].hint_block == NULL)
     {
       goto error;
     }
-  area->blockset_list->items[0] = area->hint_block;
+  area->blockset_list->items[0] = area->shards[0].hint_block;
   area->blockset_list->used_count++;
+  area->n_blocks++;
 
   pthread_mutex_init (&area->area_mutex, NULL);
 
@@ -364,6 +375,7 @@ area_alloc (AREA * area)
 {
   AREA_BLOCKSET_LIST *blockset;
   AREA_BLOCK *block, *hint_block;
+  AREA_SHARD *shard;
   int used_count, i, entry_idx;
   char *entry_ptr;
 #if defined(SERVER_MODE)
@@ -375,13 +387,23 @@ area_alloc (AREA * area)
 
   assert (area != NULL);
 
-  /* Step 1: find a free entry from the hint block */
-  hint_block = VOLATILE_ACCESS (area->hint_block, AREA_BLOCK *);
-  entry_idx = lf_bitmap_get_entry (&hint_block->bitmap);
-  if (entry_idx != -1)
+  shard = &area->shards[area_get_shard (area)];
+
+  /* Step 1: find a free entry from the hint block of this CPU */
+  hint_block = VOLATILE_ACCESS (shard->hint_block, AREA_BLOCK *);
+  if (hint_block != NULL)
     {
-      block = hint_block;
-      goto found;
+      entry_idx = lf_bitmap_get_entry (&hint_block->bitmap);
+      if (entry_idx != -1)
+	{
+	  block = hint_block;
+	  goto found;
+	}
+    }
+  else if (VOLATILE_ACCESS (area->n_blocks, int) < area->num_shards)
+    {
+      /* first allocation on this CPU; take a block of its own rather than share one with other CPUs */
+      goto add_block;
     }
 
   /* Step 2: if not found, find a free entry from the blockset lists */
@@ -396,11 +418,10 @@ area_alloc (AREA * area)
 	  entry_idx = lf_bitmap_get_entry (&block->bitmap);
 	  if (entry_idx != -1)
 	    {
-	      /* change the hint block */
-	      hint_block = VOLATILE_ACCESS (area->hint_block, AREA_BLOCK *);
-	      if (LF_BITMAP_IS_FULL (&hint_block->bitmap) && !LF_BITMAP_IS_FULL (&block->bitmap))
+	      /* change the hint block; only threads of this CPU use it, so a plain store will do */
+	      if (!LF_BITMAP_IS_FULL (&block->bitmap))
 		{
-		  ATOMIC_CAS_ADDR (&area->hint_block, hint_block, block);
+		  shard->hint_block = block;
 		}
 
 	      goto found;
@@ -408,15 +429,16 @@ area_alloc (AREA * area)
 	}
     }
 
+add_block:
   /* Step 3: if not found, add a new block. Then find free entry in this new block. 
    * Only one thread is allowed to add a new block at a moment.
    */
   rv = pthread_mutex_lock (&area->area_mutex);
 
-  if (area->hint_block != hint_block)
+  if (shard->hint_block != hint_block && shard->hint_block != NULL)
     {
-      /* someone may change the hint block */
-      block = area->hint_block;
+      /* another thread of this CPU may have changed the hint block */
+      block = shard->hint_block;
       entry_idx = lf_bitmap_get_entry (&block->bitmap);
       if (entry_idx != -1)
 	{
@@ -447,8 +469,10 @@ area_alloc (AREA * area)
       return NULL;
     }
 
+  area->n_blocks++;
+
   /* always set new block as hint_block */
-  area->hint_block = block;
+  shard->hint_block = block;
 
   pthread_mutex_unlock (&area->area_mutex);
 
@@ -517,6 +541,7 @@ int
 area_free (AREA * area, void *ptr)
 {
   AREA_BLOCK *block, *hint_block;
+  AREA_SHARD *shard;
   char *entry_ptr;
   int error, entry_idx;
   int offset = -1;
@@ -576,11 +601,12 @@ area_free (AREA * area, void *ptr)
       return error;
     }
 
-  /* change hint block if needed */
-  hint_block = VOLATILE_ACCESS (area->hint_block, AREA_BLOCK *);
-  if (LF_BITMAP_IS_FULL (&hint_block->bitmap) && !LF_BITMAP_IS_FULL (&block->bitmap))
+  /* change hint block of this CPU if needed */
+  shard = &area->shards[area_get_shard (area)];
+  hint_block = VOLATILE_ACCESS (shard->hint_block, AREA_BLOCK *);
+  if (hint_block != NULL && LF_BITMAP_IS_FULL (&hint_block->bitmap) && !LF_BITMAP_IS_FULL (&block->bitmap))
     {
-      ATOMIC_CAS_ADDR (&area->hint_block, hint_block, block);
+      shard->hint_block = block;
     }
 
 #if defined(SERVER_MODE)
@@ -780,6 +806,57 @@ area_find_block (AREA * area, const void *ptr)
   return NULL;
 }
 
+/*
+ * area_get_num_shards - get the number of hint blocks of a new area
+ *   return: number of CPUs, at most AREA_MAX_SHARDS
+ */
+static int
+area_get_num_shards (void)
+{
+#if defined (SERVER_MODE) && defined (LINUX)
+  long nprocs;
+
+  nprocs = sysconf (_SC_NPROCESSORS_CONF);
+  if (nprocs > AREA_MAX_SHARDS)
+    {
+      return AREA_MAX_SHARDS;
+    }
+  else if (nprocs > 1)
+    {
+      return (int) nprocs;
+    }
+#endif /* SERVER_MODE && LINUX */
+
+  return 1;
+}
+
+/*
+ * area_get_shard - get the hint block index of the CPU the caller runs on
+ *   return: shard index
+ *   area(in): area descriptor
+ *
+ * Note: The thread may migrate right after; the shard is only a hint and
+ *       any thread may use any shard.
+ */
+STATIC_INLINE int
+area_get_shard (AREA * area)
+{
+#if defined (SERVER_MODE) && defined (LINUX)
+  int cpu;
+
+  if (area->num_shards > 1)
+    {
+      cpu = sched_getcpu ();
+      if (cpu >= 0)
+	{
+	  return cpu % area->num_shards;
+	}
+    }
+#endif /* SERVER_MODE && LINUX */
+
+  return 0;
+}
+
 /*
  * area_info - Display information about an area
  *   return: none
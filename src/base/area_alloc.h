@@ -38,6 +38,9 @@
 
 #define AREA_BLOCKSET_SIZE 256
 
+#define AREA_MAX_SHARDS 64	/* max # of CPUs allocating from their own hint block */
+#define AREA_SHARD_SIZE 64	/* a cache line, so that shards do not share it */
+
 /*
  * AREA_BLOCK - Structure used in the implementation of workspace areas.
  *   Maintains information about a block of allocation in an area.
@@ -64,6 +67,18 @@ struct area_blockset_list
   int used_count;
 };
 
+/*
+ * AREA_SHARD - The hint block of the threads running on one CPU. Threads on
+ *   different CPUs allocate from different blocks, so that they do not
+ *   update the same bitmap.
+ */
+typedef union area_shard AREA_SHARD;
+union area_shard
+{
+  AREA_BLOCK *hint_block;	/* the hint block which may include free slot */
+  char pad[AREA_SHARD_SIZE];
+};
+
 /*
  * AREA - Primary structure for an allocation area.
  */
@@ -78,7 +93,9 @@ struct area
   size_t block_size;
 
   AREA_BLOCKSET_LIST *blockset_list;	/* the blockset list */
-  AREA_BLOCK *hint_block;	/* the hint block which may include free slot */
+  int n_blocks;			/* # of blocks in the blockset list */
+  int num_shards;		/* # of hint blocks, one per CPU */
+  AREA_SHARD shards[AREA_MAX_SHARDS];
   pthread_mutex_t area_mutex;	/* only used for insert new block */
 
   /* for dumping */
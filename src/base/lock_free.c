@@ -114,6 +114,8 @@ static INT64 lf_temps = 0;
 
 static int lf_list_insert_internal (LF_TRAN_ENTRY * tran, void **list_p, void *key, int *behavior_flags,
 				    LF_ENTRY_DESCRIPTOR * edesc, LF_FREELIST * freelist, void **entry, int *inserted);
+static int lf_hash_find_internal (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, int bflags_in,
+				  void **entry);
 static int lf_hash_insert_internal (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, int bflags, void **entry,
 				    int *inserted);
 static int lf_hash_delete_internal (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void *locked_entry,
@@ -1180,6 +1182,9 @@ restart_search:
  *   behavior_flags(in/out): flags that control restart behavior
  *   edesc(in): entry descriptor
  *   entry(out): entry (if found) or NULL
+ *
+ * NOTE: With LF_LIST_BF_FIND_NO_LOCK, a found entry is not locked even if the descriptor uses mutexes; the
+ *	 transaction is kept started instead and must be ended by the caller.
  */
 int
 lf_list_find (LF_TRAN_ENTRY * tran, void **list_p, void *key, int *behavior_flags, LF_ENTRY_DESCRIPTOR * edesc,
@@ -1209,7 +1214,8 @@ restart_search:
       if (edesc->f_key_cmp (key, OF_GET_PTR (curr, edesc->of_key)) == 0)
 	{
 	  /* found! */
-	  if (edesc->using_mutex)
+	  if (edesc->using_mutex
+	      && (behavior_flags == NULL || !LF_LIST_BF_IS_FLAG_SET (behavior_flags, LF_LIST_BF_FIND_NO_LOCK)))
 	    {
 	      /* entry has a mutex protecting it's members; lock it */
 	      entry_mutex = (pthread_mutex_t *) OF_GET_PTR (curr, edesc->of_mutex);
@@ -1970,15 +1976,16 @@ lf_hash_destroy (LF_HASH_TABLE * table)
 }
 
 /*
- * lf_hash_find () - find an entry in the hash table given a key
+ * lf_hash_find_internal () - find an entry in the hash table given a key
  *   returns: error code or NO_ERROR
  *   tran(in): LF transaction entry
  *   table(in): hash table
  *   key(in): key of entry that we seek
+ *   bflags_in(in): behavior flags
  *   entry(out): existing or NULL otherwise
  */
-int
-lf_hash_find (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry)
+static int
+lf_hash_find_internal (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, int bflags_in, void **entry)
 {
   LF_ENTRY_DESCRIPTOR *edesc;
   unsigned int hash_value;
@@ -1997,7 +2004,7 @@ restart:
       return ER_FAILED;
     }
 
-  bflags = LF_LIST_BF_RETURN_ON_RESTART;
+  bflags = bflags_in;
   rc = lf_list_find (tran, &table->buckets[hash_value], key, &bflags, edesc, entry);
   if ((rc == NO_ERROR) && (bflags & LF_LIST_BR_RESTARTED))
     {
@@ -2009,6 +2016,38 @@ restart:
     }
 }
 
+/*
+ * lf_hash_find () - find an entry in the hash table given a key
+ *   returns: error code or NO_ERROR
+ *   tran(in): LF transaction entry
+ *   table(in): hash table
+ *   key(in): key of entry that we seek
+ *   entry(out): existing or NULL otherwise
+ */
+int
+lf_hash_find (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry)
+{
+  return lf_hash_find_internal (tran, table, key, LF_LIST_BF_RETURN_ON_RESTART, entry);
+}
+
+/*
+ * lf_hash_find_no_lock () - find an entry in the hash table given a key, without locking its mutex
+ *   returns: error code or NO_ERROR
+ *   tran(in): LF transaction entry
+ *   table(in): hash table
+ *   key(in): key of entry that we seek
+ *   entry(out): existing or NULL otherwise
+ *
+ * NOTE: If an entry is found, the transaction is left started so the entry cannot be reclaimed while the caller
+ *	 inspects it; the caller must end it with lf_tran_end_with_mb. The entry may be concurrently deleted, so the
+ *	 caller must only rely on members it can validate atomically.
+ */
+int
+lf_hash_find_no_lock (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry)
+{
+  return lf_hash_find_internal (tran, table, key, LF_LIST_BF_RETURN_ON_RESTART | LF_LIST_BF_FIND_NO_LOCK, entry);
+}
+
 /*
  * lf_hash_insert_internal () - hash insert function.
  *   returns: error code or NO_ERROR
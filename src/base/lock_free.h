@@ -321,6 +321,7 @@ extern int lf_io_list_find_or_insert (void **list_p, void *new_entry, LF_ENTRY_D
 #define LF_LIST_BF_INSERT_GIVEN		  ((int) 0x04)
 #define LF_LIST_BF_FIND_OR_INSERT	  ((int) 0x08)
 #define LF_LIST_BF_LOCK_ON_DELETE	  ((int) 0x10)
+#define LF_LIST_BF_FIND_NO_LOCK		  ((int) 0x20)
 #define LF_LIST_BF_IS_FLAG_SET(bf, flag) ((*(bf) & (flag)) != 0)
 #define LF_LIST_BF_SET_FLAG(bf, flag) (*(bf) = *(bf) | (flag))
 
@@ -369,6 +370,7 @@ extern int lf_hash_init (LF_HASH_TABLE * table, LF_FREELIST * freelist, unsigned
 extern void lf_hash_destroy (LF_HASH_TABLE * table);
 
 extern int lf_hash_find (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry);
+extern int lf_hash_find_no_lock (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry);
 extern int lf_hash_find_or_insert (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry, int *inserted);
 extern int lf_hash_insert (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry, int *inserted);
 extern int lf_hash_insert_given (LF_TRAN_ENTRY * tran, LF_HASH_TABLE * table, void *key, void **entry, int *inserted);
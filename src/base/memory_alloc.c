@@ -48,6 +48,62 @@ extern unsigned int db_on_server;
 HL_HEAPID private_heap_id = 0;
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+#define PRIVATE_ARENA_CHUNK_SIZE (64 * 1024)	/* size of the first chunk, kept between requests */
+#define PRIVATE_ARENA_MAX_REQUEST_SIZE (PRIVATE_ARENA_CHUNK_SIZE / 4)	/* larger requests go to the private heap */
+
+#define PRIVATE_ARENA_CHUNK_HEADER_SIZE DB_ALIGN (sizeof (PRIVATE_ARENA_CHUNK), MAX_ALIGNMENT)
+#define PRIVATE_ARENA_HEADER_SIZE DB_ALIGN (sizeof (PRIVATE_ARENA_HEADER), MAX_ALIGNMENT)
+
+#define PRIVATE_ARENA_IS_OPEN(arena, heap_id) \
+  ((arena) != NULL && (arena)->depth > 0 && (arena)->heap_id == (heap_id))
+#define PRIVATE_ARENA_IS_EMPTY(arena) \
+  ((arena)->chunks == NULL \
+   || ((arena)->chunks->next == NULL \
+       && (arena)->chunks->free_ptr == (char *) (arena)->chunks + PRIVATE_ARENA_CHUNK_HEADER_SIZE))
+
+/*
+ * Query execution allocates and frees many small objects on the private heap,
+ * all of which are released by db_clear_private_heap at the end of the
+ * request anyway. While a query runs, these allocations are bump-allocated
+ * from arena chunks; db_private_free of an arena pointer only gives the
+ * space back if it was the latest allocation, and all the chunks are
+ * recycled at once when the private heap is cleared.
+ */
+typedef struct private_arena_chunk PRIVATE_ARENA_CHUNK;
+struct private_arena_chunk
+{
+  PRIVATE_ARENA_CHUNK *next;	/* chunk filled before this one */
+  char *free_ptr;		/* start of unused space */
+  char *end;			/* end of the chunk */
+};
+
+typedef struct private_arena_header PRIVATE_ARENA_HEADER;
+struct private_arena_header
+{
+  size_t size;			/* size of the allocation including this header */
+};
+
+typedef struct db_private_arena DB_PRIVATE_ARENA;
+struct db_private_arena
+{
+  PRIVATE_ARENA_CHUNK *chunks;	/* chunk being filled, followed by the filled ones */
+  HL_HEAPID heap_id;		/* private heap the arena allocates for */
+  int depth;			/* nesting level of queries using the arena */
+  size_t max_size;		/* limit of chunk memory until the heap is cleared */
+  size_t chunk_bytes;		/* chunk memory in use */
+  INT64 num_allocs;		/* allocations served for the outermost query */
+  INT64 alloc_bytes;		/* bytes served for the outermost query */
+};
+
+static void *private_arena_alloc (DB_PRIVATE_ARENA * arena, size_t size);
+static bool private_arena_free (DB_PRIVATE_ARENA * arena, void *ptr);
+static bool private_arena_realloc (THREAD_ENTRY * thread_p, HL_HEAPID heap_id, void *ptr, size_t size,
+				   void **new_ptr);
+static void private_arena_reset (DB_PRIVATE_ARENA * arena);
+static void private_arena_destroy (DB_PRIVATE_ARENA * arena);
+#endif /* SERVER_MODE */
+
 /*
  * ansisql_strcmp - String comparison according to ANSI SQL
  *   return: an integer value which is less than zero
@@ -315,6 +371,19 @@ db_clear_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id)
     {
       hl_clear_lea_heap (heap_id);
     }
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (thread_p->private_arena != NULL && thread_p->private_arena->depth == 0
+      && thread_p->private_arena->heap_id == heap_id)
+    {
+      private_arena_reset (thread_p->private_arena);
+    }
+#endif /* SERVER_MODE */
 }
 
 /*
@@ -389,8 +458,360 @@ db_destroy_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id)
     {
       hl_unregister_lea_heap (heap_id);
     }
+
+#if defined (SERVER_MODE)
+  if (thread_p != NULL && thread_p->private_arena != NULL && thread_p->private_arena->heap_id == heap_id)
+    {
+      private_arena_destroy (thread_p->private_arena);
+      thread_p->private_arena = NULL;
+    }
+#endif /* SERVER_MODE */
+}
+
+/*
+ * db_begin_private_arena () - start serving private heap allocations of the
+ *                             current thread from its arena
+ *   return:
+ *   thread_p(in):
+ *   max_size(in): limit of arena memory; 0 disables the arena
+ *
+ * Note: Calls may nest; allocations are taken from the arena until the
+ *       outermost db_end_private_arena. Memory allocated from the arena stays
+ *       valid until the private heap is cleared.
+ */
+void
+db_begin_private_arena (THREAD_ENTRY * thread_p, size_t max_size)
+{
+#if defined (SERVER_MODE)
+  DB_PRIVATE_ARENA *arena;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  arena = thread_p->private_arena;
+  if (arena != NULL && arena->depth > 0)
+    {
+      arena->depth++;
+      return;
+    }
+
+  if (max_size < PRIVATE_ARENA_CHUNK_SIZE || thread_p->private_heap_id == 0)
+    {
+      return;
+    }
+
+  if (arena == NULL)
+    {
+      arena = (DB_PRIVATE_ARENA *) malloc (sizeof (DB_PRIVATE_ARENA));
+      if (arena == NULL)
+	{
+	  /* not an error; the private heap is used as is */
+	  return;
+	}
+      arena->chunks = NULL;
+      arena->chunk_bytes = 0;
+      thread_p->private_arena = arena;
+    }
+  else if (arena->heap_id != thread_p->private_heap_id && !PRIVATE_ARENA_IS_EMPTY (arena))
+    {
+      /* the arena still holds memory of another private heap, which is valid until that heap is cleared */
+      return;
+    }
+
+  arena->heap_id = thread_p->private_heap_id;
+  arena->max_size = max_size;
+  arena->depth = 1;
+  arena->num_allocs = 0;
+  arena->alloc_bytes = 0;
+#endif /* SERVER_MODE */
+}
+
+/*
+ * db_end_private_arena () - stop serving private heap allocations from the
+ *                           arena
+ *   return:
+ *   thread_p(in):
+ *   num_allocs(out): number of allocations served by the arena
+ *   alloc_bytes(out): bytes served by the arena
+ *
+ * Note: The counters are set only by the outermost call, and to zero if the
+ *       arena was not used.
+ */
+void
+db_end_private_arena (THREAD_ENTRY * thread_p, INT64 * num_allocs, INT64 * alloc_bytes)
+{
+#if defined (SERVER_MODE)
+  DB_PRIVATE_ARENA *arena;
+#endif /* SERVER_MODE */
+
+  *num_allocs = 0;
+  *alloc_bytes = 0;
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  arena = thread_p->private_arena;
+  if (arena == NULL || arena->depth == 0)
+    {
+      return;
+    }
+
+  arena->depth--;
+  if (arena->depth == 0)
+    {
+      *num_allocs = arena->num_allocs;
+      *alloc_bytes = arena->alloc_bytes;
+    }
+#endif /* SERVER_MODE */
+}
+
+#if defined (SERVER_MODE)
+/*
+ * private_arena_alloc () - bump-allocate from the arena
+ *   return: allocated memory pointer, or NULL if the request has to be served
+ *           by the private heap
+ *   arena(in):
+ *   size(in): size to allocate
+ */
+static void *
+private_arena_alloc (DB_PRIVATE_ARENA * arena, size_t size)
+{
+  PRIVATE_ARENA_CHUNK *chunk;
+  PRIVATE_ARENA_HEADER *h;
+  size_t req_size, chunk_size;
+
+  if (size > PRIVATE_ARENA_MAX_REQUEST_SIZE)
+    {
+      return NULL;
+    }
+
+  req_size = PRIVATE_ARENA_HEADER_SIZE + DB_ALIGN (size, MAX_ALIGNMENT);
+
+  chunk = arena->chunks;
+  if (chunk == NULL || chunk->free_ptr + req_size > chunk->end)
+    {
+      /* chunks double in size so that only a few of them are searched when freeing */
+      chunk_size = MAX (PRIVATE_ARENA_CHUNK_SIZE, arena->chunk_bytes);
+      if (arena->chunk_bytes + chunk_size > arena->max_size)
+	{
+	  return NULL;
+	}
+
+      chunk = (PRIVATE_ARENA_CHUNK *) malloc (chunk_size);
+      if (chunk == NULL)
+	{
+	  return NULL;
+	}
+      chunk->free_ptr = (char *) chunk + PRIVATE_ARENA_CHUNK_HEADER_SIZE;
+      chunk->end = (char *) chunk + chunk_size;
+      chunk->next = arena->chunks;
+      arena->chunks = chunk;
+      arena->chunk_bytes += chunk_size;
+    }
+
+  h = (PRIVATE_ARENA_HEADER *) chunk->free_ptr;
+  h->size = req_size;
+  chunk->free_ptr += req_size;
+
+  arena->num_allocs++;
+  arena->alloc_bytes += req_size;
+
+  return (char *) h + PRIVATE_ARENA_HEADER_SIZE;
+}
+
+/*
+ * private_arena_free () - release memory allocated from the arena
+ *   return: true if ptr belongs to the arena, false otherwise
+ *   arena(in):
+ *   ptr(in): memory pointer to free
+ *
+ * Note: Only the latest allocation of the chunk being filled is given back;
+ *       other memory is recycled when the private heap is cleared.
+ */
+static bool
+private_arena_free (DB_PRIVATE_ARENA * arena, void *ptr)
+{
+  PRIVATE_ARENA_CHUNK *chunk;
+  PRIVATE_ARENA_HEADER *h;
+
+  for (chunk = arena->chunks; chunk != NULL; chunk = chunk->next)
+    {
+      if ((char *) ptr > (char *) chunk && (char *) ptr < chunk->end)
+	{
+	  break;
+	}
+    }
+
+  if (chunk == NULL)
+    {
+      return false;
+    }
+
+  h = (PRIVATE_ARENA_HEADER *) ((char *) ptr - PRIVATE_ARENA_HEADER_SIZE);
+  if (chunk == arena->chunks && (char *) h + h->size == chunk->free_ptr)
+    {
+      chunk->free_ptr = (char *) h;
+    }
+
+  return true;
 }
 
+/*
+ * private_arena_realloc () - reallocate memory allocated from the arena, or
+ *                            allocate from the arena if ptr is NULL
+ *   return: true if the request was served, false if it has to be served by
+ *           the private heap
+ *   thread_p(in):
+ *   heap_id(in): current private heap
+ *   ptr(in): memory pointer to reallocate
+ *   size(in): size to allocate
+ *   new_ptr(out): reallocated memory pointer
+ */
+static bool
+private_arena_realloc (THREAD_ENTRY * thread_p, HL_HEAPID heap_id, void *ptr, size_t size, void **new_ptr)
+{
+  DB_PRIVATE_ARENA *arena = thread_p->private_arena;
+  PRIVATE_ARENA_CHUNK *chunk;
+  PRIVATE_ARENA_HEADER *h;
+  size_t old_size, req_size;
+
+  if (arena == NULL || arena->chunks == NULL)
+    {
+      return false;
+    }
+
+  if (ptr == NULL)
+    {
+      if (!PRIVATE_ARENA_IS_OPEN (arena, heap_id))
+	{
+	  return false;
+	}
+      *new_ptr = private_arena_alloc (arena, size);
+      return (*new_ptr != NULL);
+    }
+
+  chunk = arena->chunks;
+  if (!((char *) ptr > (char *) chunk && (char *) ptr < chunk->end))
+    {
+      for (chunk = chunk->next; chunk != NULL; chunk = chunk->next)
+	{
+	  if ((char *) ptr > (char *) chunk && (char *) ptr < chunk->end)
+	    {
+	      break;
+	    }
+	}
+      if (chunk == NULL)
+	{
+	  return false;
+	}
+    }
+
+  h = (PRIVATE_ARENA_HEADER *) ((char *) ptr - PRIVATE_ARENA_HEADER_SIZE);
+  old_size = h->size - PRIVATE_ARENA_HEADER_SIZE;
+
+  /* grow or shrink the latest allocation in place */
+  req_size = PRIVATE_ARENA_HEADER_SIZE + DB_ALIGN (size, MAX_ALIGNMENT);
+  if (chunk == arena->chunks && (char *) h + h->size == chunk->free_ptr && size <= PRIVATE_ARENA_MAX_REQUEST_SIZE
+      && (char *) h + req_size <= chunk->end && PRIVATE_ARENA_IS_OPEN (arena, heap_id))
+    {
+      if (req_size > h->size)
+	{
+	  arena->alloc_bytes += req_size - h->size;
+	}
+      chunk->free_ptr = (char *) h + req_size;
+      h->size = req_size;
+      *new_ptr = ptr;
+      return true;
+    }
+
+  *new_ptr = NULL;
+  if (PRIVATE_ARENA_IS_OPEN (arena, heap_id))
+    {
+      *new_ptr = private_arena_alloc (arena, size);
+    }
+  if (*new_ptr == NULL)
+    {
+      if (heap_id)
+	{
+	  *new_ptr = hl_lea_alloc (heap_id, size);
+	}
+      else
+	{
+	  *new_ptr = malloc (size);
+	  if (*new_ptr == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+	    }
+	}
+      if (*new_ptr == NULL)
+	{
+	  return true;
+	}
+    }
+
+  memcpy (*new_ptr, ptr, MIN (old_size, size));
+  (void) private_arena_free (arena, ptr);
+
+  return true;
+}
+
+/*
+ * private_arena_reset () - recycle all the memory of the arena
+ *   return:
+ *   arena(in):
+ *
+ * Note: The first chunk is kept for the next query.
+ */
+static void
+private_arena_reset (DB_PRIVATE_ARENA * arena)
+{
+  PRIVATE_ARENA_CHUNK *chunk;
+
+  assert (arena->depth == 0);
+
+  chunk = arena->chunks;
+  if (chunk == NULL)
+    {
+      return;
+    }
+
+  while (chunk->next != NULL)
+    {
+      arena->chunks = chunk->next;
+      free (chunk);
+      chunk = arena->chunks;
+    }
+
+  chunk->free_ptr = (char *) chunk + PRIVATE_ARENA_CHUNK_HEADER_SIZE;
+  arena->chunk_bytes = chunk->end - (char *) chunk;
+}
+
+/*
+ * private_arena_destroy () - free the arena and all its memory
+ *   return:
+ *   arena(in):
+ */
+static void
+private_arena_destroy (DB_PRIVATE_ARENA * arena)
+{
+  PRIVATE_ARENA_CHUNK *chunk;
+
+  while (arena->chunks != NULL)
+    {
+      chunk = arena->chunks;
+      arena->chunks = chunk->next;
+      free (chunk);
+    }
+
+  free (arena);
+}
+#endif /* SERVER_MODE */
+
 /*
  * db_private_alloc () - call allocation function for current private heap
  *   return: allocated memory pointer
@@ -427,6 +848,7 @@ db_private_alloc_release (void *thrd, size_t size, bool rc_track)
 {
   void *ptr = NULL;
 #if defined (SERVER_MODE)
+  THREAD_ENTRY *thread_p;
   HL_HEAPID heap_id;
 #endif
 
@@ -440,11 +862,19 @@ db_private_alloc_release (void *thrd, size_t size, bool rc_track)
       return NULL;
     }
 
-  heap_id = (thrd ? ((THREAD_ENTRY *) thrd)->private_heap_id : css_get_private_heap (NULL));
+  thread_p = (thrd ? (THREAD_ENTRY *) thrd : thread_get_thread_entry_info ());
+  heap_id = thread_p->private_heap_id;
 
   if (heap_id)
     {
-      ptr = hl_lea_alloc (heap_id, size);
+      if (PRIVATE_ARENA_IS_OPEN (thread_p->private_arena, heap_id))
+	{
+	  ptr = private_arena_alloc (thread_p->private_arena, size);
+	}
+      if (ptr == NULL)
+	{
+	  ptr = hl_lea_alloc (heap_id, size);
+	}
     }
   else
     {
@@ -545,6 +975,7 @@ db_private_realloc_release (void *thrd, void *ptr, size_t size, bool rc_track)
 {
   void *new_ptr = NULL;
 #if defined (SERVER_MODE)
+  THREAD_ENTRY *thread_p;
   HL_HEAPID heap_id;
 #endif
 
@@ -556,9 +987,14 @@ db_private_realloc_release (void *thrd, void *ptr, size_t size, bool rc_track)
       return NULL;
     }
 
-  heap_id = (thrd ? ((THREAD_ENTRY *) thrd)->private_heap_id : css_get_private_heap (NULL));
+  thread_p = (thrd ? (THREAD_ENTRY *) thrd : thread_get_thread_entry_info ());
+  heap_id = thread_p->private_heap_id;
 
-  if (heap_id)
+  if (private_arena_realloc (thread_p, heap_id, ptr, size, &new_ptr))
+    {
+      ;
+    }
+  else if (heap_id)
     {
       new_ptr = hl_lea_realloc (heap_id, ptr, size);
     }
@@ -709,6 +1145,7 @@ db_private_free_release (void *thrd, void *ptr, bool rc_track)
 #endif				/* NDEBUG */
 {
 #if defined (SERVER_MODE)
+  THREAD_ENTRY *thread_p;
   HL_HEAPID heap_id;
 #endif
 
@@ -720,9 +1157,14 @@ db_private_free_release (void *thrd, void *ptr, bool rc_track)
 #if defined (CS_MODE)
   db_ws_free (ptr);
 #elif defined (SERVER_MODE)
-  heap_id = (thrd ? ((THREAD_ENTRY *) thrd)->private_heap_id : css_get_private_heap (NULL));
+  thread_p = (thrd ? (THREAD_ENTRY *) thrd : thread_get_thread_entry_info ());
+  heap_id = thread_p->private_heap_id;
 
-  if (heap_id)
+  if (thread_p->private_arena != NULL && private_arena_free (thread_p->private_arena, ptr))
+    {
+      /* released with the arena */
+    }
+  else if (heap_id)
     {
       hl_lea_free (heap_id, ptr);
     }
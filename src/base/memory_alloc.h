@@ -218,6 +218,8 @@ extern void db_clear_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
 extern HL_HEAPID db_change_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
 extern HL_HEAPID db_replace_private_heap (THREAD_ENTRY * thread_p);
 extern void db_destroy_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
+extern void db_begin_private_arena (THREAD_ENTRY * thread_p, size_t max_size);
+extern void db_end_private_arena (THREAD_ENTRY * thread_p, INT64 * num_allocs, INT64 * alloc_bytes);
 #if !defined(NDEBUG)
 #define db_private_alloc(thrd, size) \
         db_private_alloc_debug(thrd, size, true, __FILE__, __LINE__)
@@ -70,9 +70,11 @@
 #include "xserver_interface.h"
 #include "heap_file.h"
 #include "xasl_cache.h"
+#include "vacuum.h"
 
 #if defined (SERVER_MODE)
 #include "connection_error.h"
+#include "job_queue.h"
 #endif /* SERVER_MODE */
 
 #if !defined(SERVER_MODE)
@@ -168,6 +170,9 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_FILE_IOSYNC_ALL, "file_iosync_all"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_ALLOCS, "Num_file_page_allocs"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_DEALLOCS, "Num_file_page_deallocs"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_COMPRESSED_PAGE_WRITES, "Num_file_compressed_page_writes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_COMPRESSED_PAGE_READS, "Num_file_compressed_page_reads"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_VECTOR_WRITES, "Num_file_vector_writes"),
 
   /* Page buffer basic module */
   /* Execution statistics for the page buffer manager */
@@ -210,6 +215,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* TODO: Count and timer */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_WAITED_ON_OBJECTS, "Num_object_locks_waits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_WAITED_TIME_ON_OBJECTS, "Num_object_locks_time_waited_usec"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_FASTPATH_ACQUIRED_ON_OBJECTS, "Num_object_locks_fastpath_acquired"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_FASTPATH_TRANSFERRED_ON_OBJECTS, "Num_object_locks_fastpath_transferred"),
 
   /* Execution statistics for transactions */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TRAN_NUM_COMMITS, "Num_tran_commits"),
@@ -230,10 +237,15 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_SPLITS, "Num_btree_splits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_MERGES, "Num_btree_merges"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_GET_STATS, "Num_btree_get_stats"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_PREFETCH_LEAVES, "Num_btree_prefetch_leaves"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_UNTOUCHED_UPDATES, "Num_btree_untouched_updates"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_OPTIMISTIC_DESCENTS, "Num_btree_optimistic_descents"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_OPTIMISTIC_DESCENT_RETRIES, "Num_btree_optimistic_descent_retries"),
 
   /* Execution statistics for the heap manager */
   /* TODO: Move this to heap section. TODO: count and timer. */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_NUM_STATS_SYNC_BESTSPACE, "Num_heap_stats_sync_bestspace"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_NUM_FSM_FOUND_PAGES, "Num_heap_fsm_found_pages"),
 
   /* Execution statistics for the query manager */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_SELECTS, "Num_query_selects"),
@@ -249,6 +261,12 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_MJOINS, "Num_query_mjoins"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_OBJFETCHES, "Num_query_objfetches"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QM_NUM_HOLDABLE_CURSORS, "Num_query_holdable_cursors"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_PARTITION_PREFETCH_PAGES, "Num_query_partition_prefetch_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_JOIN_FILTER_REJECTS, "Num_query_join_filter_rejects"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_ARENA_ALLOCS, "Num_query_arena_allocs"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_ARENA_ALLOC_BYTES, "Num_query_arena_alloc_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_LIST_MEMORY_PAGES, "Num_query_list_memory_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_LIST_SPILLS, "Num_query_list_spills"),
 
   /* Execution statistics for external sort */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_SORT_NUM_IO_PAGES, "Num_sort_io_pages"),
@@ -256,6 +274,10 @@ PSTAT_METADATA pstat_Metadata[] = {
 
   /* Execution statistics for network communication */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_NUM_REQUESTS, "Num_network_requests"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_NET_NUM_QUEUED_JOBS, "Num_network_queued_jobs"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_NUM_STOLEN_JOBS, "Num_network_stolen_jobs"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_NUM_DELAYED_JOBS, "Num_network_delayed_jobs"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_JOB_WAIT_TIME, "Time_network_job_wait_time"),
 
   /* flush control stat */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FC_NUM_PAGES, "Num_adaptive_flush_pages"),
@@ -289,6 +311,11 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES, "Num_vacuum_log_pages_to_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES, "Num_vacuum_prefetch_requests_log_pages"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES, "Num_vacuum_prefetch_hits_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_HELPED_HEAP_PAGES, "Num_vacuum_helped_heap_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_BACKLOG_BLOCKS, "Num_vacuum_backlog_blocks"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_BACKLOG_LOG_PAGES, "Num_vacuum_backlog_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_RETAINED_LOG_PAGES, "Num_vacuum_retained_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_OLDEST_UNVACUUMED_AGE, "Time_vacuum_oldest_unvacuumed_age"),
 
   /* Track heap modify counters. */
   /* Make a complex entry for heap stats */
@@ -418,6 +445,12 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_THREE_SHR_TO_TOP, "Num_unfix_lru3_shared_to_top"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_ONE_PRV_KEEP, "Num_unfix_lru1_private_keep"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_ONE_SHR_KEEP, "Num_unfix_lru1_shared_keep"),
+  /* temporary pages over quota */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_TEMP_TO_BOTTOM, "Num_unfix_void_temp_to_bottom"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_THREE_TEMP_KEEP, "Num_unfix_lru3_temp_keep"),
+  /* pages of large sequential scans */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_RING_TO_BOTTOM, "Num_unfix_void_ring_to_bottom"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_THREE_RING_KEEP, "Num_unfix_lru3_ring_keep"),
   /* vacuum */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_TO_PRIVATE_TOP_VAC, "Num_unfix_void_to_private_mid_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_ONE_KEEP_VAC, "Num_unfix_lru1_any_keep_vacuum"),
@@ -451,6 +484,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PB_ALLOC_BCB_COND_WAIT_LOW_PRIO, "alloc_bcb_cond_wait_low_prio"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_ALLOC_BCB_PRIORITIZE_VACUUM, "Num_alloc_bcb_prioritize_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_VICTIM_USE_INVALID_BCB, "Num_victim_use_invalid_bcb"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_VICTIM_USE_RING_BCB, "Num_victim_use_ring_bcb"),
   /* direct assignments */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_VICTIM_ASSIGN_DIRECT_VACUUM_VOID, "Num_victim_assign_direct_vacuum_void"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_VICTIM_ASSIGN_DIRECT_VACUUM_LRU, "Num_victim_assign_direct_vacuum_lru"),
@@ -2835,6 +2869,8 @@ perfmon_stat_page_type_name (const int page_type)
       return "PAGE_DROPPED";
     case PERF_PAGE_VACUUM_DATA:
       return "PAGE_VACUUM_DATA";
+    case PERF_PAGE_HEAP_FREESPACE:
+      return "PAGE_HEAP_FSM";
     case PERF_PAGE_BTREE_ROOT:
       return "PAGE_BTREE_R";
     case PERF_PAGE_BTREE_OVF:
@@ -4607,6 +4643,13 @@ perfmon_get_peek_stats (UINT64 * stats)
   stats[pstat_Metadata[PSTAT_PC_NUM_CACHE_ENTRIES].start_offset] = xcache_get_entry_count ();
   stats[pstat_Metadata[PSTAT_HF_NUM_STATS_ENTRIES].start_offset] = heap_get_best_space_num_stats_entries ();
   stats[pstat_Metadata[PSTAT_QM_NUM_HOLDABLE_CURSORS].start_offset] = session_get_number_of_holdable_cursors ();
+  stats[pstat_Metadata[PSTAT_VAC_NUM_BACKLOG_BLOCKS].start_offset] = vacuum_get_backlog_blocks ();
+  stats[pstat_Metadata[PSTAT_VAC_NUM_BACKLOG_LOG_PAGES].start_offset] = vacuum_get_backlog_log_pages ();
+  stats[pstat_Metadata[PSTAT_VAC_NUM_RETAINED_LOG_PAGES].start_offset] = vacuum_get_retained_log_pages ();
+  stats[pstat_Metadata[PSTAT_VAC_OLDEST_UNVACUUMED_AGE].start_offset] = vacuum_get_oldest_unvacuumed_age ();
+#if defined (SERVER_MODE)
+  stats[pstat_Metadata[PSTAT_NET_NUM_QUEUED_JOBS].start_offset] = css_get_num_queued_jobs ();
+#endif /* SERVER_MODE */
 }
 
 /*
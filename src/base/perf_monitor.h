@@ -226,6 +226,7 @@ typedef enum
   PERF_PAGE_LOG,		/* NONE - log page (unused) */
   PERF_PAGE_DROPPED_FILES,	/* Dropped files page.  */
   PERF_PAGE_VACUUM_DATA,	/* Vacuum data */
+  PERF_PAGE_HEAP_FREESPACE,	/* heap free space map page */
   PERF_PAGE_BTREE_ROOT,		/* b+tree root index page */
   PERF_PAGE_BTREE_OVF,		/* b+tree overflow index page */
   PERF_PAGE_BTREE_LEAF,		/* b+tree leaf index page */
@@ -282,6 +283,9 @@ typedef enum
   PSTAT_FILE_IOSYNC_ALL,
   PSTAT_FILE_NUM_PAGE_ALLOCS,
   PSTAT_FILE_NUM_PAGE_DEALLOCS,
+  PSTAT_FILE_NUM_COMPRESSED_PAGE_WRITES,
+  PSTAT_FILE_NUM_COMPRESSED_PAGE_READS,
+  PSTAT_FILE_NUM_VECTOR_WRITES,
 
   /* Page buffer basic module */
   /* Execution statistics for the page buffer manager */
@@ -323,6 +327,8 @@ typedef enum
   PSTAT_LK_NUM_WAITED_ON_OBJECTS,
   PSTAT_LK_NUM_WAITED_TIME_ON_OBJECTS,	/* include this to avoid client-server compat issue even if extended stats are
 					 * disabled */
+  PSTAT_LK_NUM_FASTPATH_ACQUIRED_ON_OBJECTS,
+  PSTAT_LK_NUM_FASTPATH_TRANSFERRED_ON_OBJECTS,
 
   /* Execution statistics for transactions */
   PSTAT_TRAN_NUM_COMMITS,
@@ -343,9 +349,14 @@ typedef enum
   PSTAT_BT_NUM_SPLITS,
   PSTAT_BT_NUM_MERGES,
   PSTAT_BT_NUM_GET_STATS,
+  PSTAT_BT_NUM_PREFETCH_LEAVES,
+  PSTAT_BT_NUM_UNTOUCHED_UPDATES,
+  PSTAT_BT_NUM_OPTIMISTIC_DESCENTS,
+  PSTAT_BT_NUM_OPTIMISTIC_DESCENT_RETRIES,
 
   /* Execution statistics for the heap manager */
   PSTAT_HEAP_NUM_STATS_SYNC_BESTSPACE,
+  PSTAT_HEAP_NUM_FSM_FOUND_PAGES,
 
   /* Execution statistics for the query manager */
   PSTAT_QM_NUM_SELECTS,
@@ -361,6 +372,12 @@ typedef enum
   PSTAT_QM_NUM_MJOINS,
   PSTAT_QM_NUM_OBJFETCHES,
   PSTAT_QM_NUM_HOLDABLE_CURSORS,
+  PSTAT_QM_NUM_PARTITION_PREFETCH_PAGES,
+  PSTAT_QM_NUM_JOIN_FILTER_REJECTS,
+  PSTAT_QM_NUM_ARENA_ALLOCS,
+  PSTAT_QM_ARENA_ALLOC_BYTES,
+  PSTAT_QM_NUM_LIST_MEMORY_PAGES,
+  PSTAT_QM_NUM_LIST_SPILLS,
 
   /* Execution statistics for external sort */
   PSTAT_SORT_NUM_IO_PAGES,
@@ -368,6 +385,10 @@ typedef enum
 
   /* Execution statistics for network communication */
   PSTAT_NET_NUM_REQUESTS,
+  PSTAT_NET_NUM_QUEUED_JOBS,
+  PSTAT_NET_NUM_STOLEN_JOBS,
+  PSTAT_NET_NUM_DELAYED_JOBS,
+  PSTAT_NET_JOB_WAIT_TIME,
 
   /* flush control stat */
   PSTAT_FC_NUM_PAGES,
@@ -400,6 +421,11 @@ typedef enum
   PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES,
+  PSTAT_VAC_NUM_HELPED_HEAP_PAGES,
+  PSTAT_VAC_NUM_BACKLOG_BLOCKS,
+  PSTAT_VAC_NUM_BACKLOG_LOG_PAGES,
+  PSTAT_VAC_NUM_RETAINED_LOG_PAGES,
+  PSTAT_VAC_OLDEST_UNVACUUMED_AGE,
 
   /* Track heap modify counters. */
   PSTAT_HEAP_HOME_INSERTS,
@@ -529,6 +555,12 @@ typedef enum
   PSTAT_PB_UNFIX_LRU_THREE_SHR_TO_TOP,
   PSTAT_PB_UNFIX_LRU_ONE_PRV_KEEP,
   PSTAT_PB_UNFIX_LRU_ONE_SHR_KEEP,
+  /* temporary pages over quota */
+  PSTAT_PB_UNFIX_VOID_TEMP_TO_BOTTOM,
+  PSTAT_PB_UNFIX_LRU_THREE_TEMP_KEEP,
+  /* pages of large sequential scans */
+  PSTAT_PB_UNFIX_VOID_RING_TO_BOTTOM,
+  PSTAT_PB_UNFIX_LRU_THREE_RING_KEEP,
   /* vacuum */
   PSTAT_PB_UNFIX_VOID_TO_PRIVATE_TOP_VAC,
   PSTAT_PB_UNFIX_LRU_ONE_KEEP_VAC,
@@ -562,6 +594,7 @@ typedef enum
   PSTAT_PB_ALLOC_BCB_COND_WAIT_LOW_PRIO,
   PSTAT_PB_ALLOC_BCB_PRIORITIZE_VACUUM,
   PSTAT_PB_VICTIM_USE_INVALID_BCB,
+  PSTAT_PB_VICTIM_USE_RING_BCB,
   /* direct assignments */
   PSTAT_PB_VICTIM_ASSIGN_DIRECT_VACUUM_VOID,
   PSTAT_PB_VICTIM_ASSIGN_DIRECT_VACUUM_LRU,
@@ -739,6 +739,7 @@ extern "C"
 	(InterlockedExchangeAdd(ptr, amount) + (amount))
 #define MEMORY_BARRIER() \
 	MemoryBarrier()
+#define ATOMIC_LOAD_32(ptr) (*(ptr))
 
 #if defined (_WIN64)
 #define ATOMIC_TAS_64(ptr, new_val) \
@@ -808,6 +809,7 @@ extern "C"
 #define ATOMIC_CAS_ADDR(ptr, cmp_val, swap_val) \
 	__sync_bool_compare_and_swap(ptr, cmp_val, swap_val)
 
+#define ATOMIC_LOAD_32(ptr) (*(ptr))
 #define ATOMIC_LOAD_64(ptr) (*(ptr))
 #define ATOMIC_STORE_64(ptr, val) (*(ptr) = val)
 
@@ -631,6 +631,19 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_CTE_MAX_RECURSIONS "cte_max_recursions"
 
+#define PRM_NAME_PARTITION_PREFETCH_WORKERS "partition_prefetch_workers"
+#define PRM_NAME_AGG_HASH_SPILL_PARTITIONS "agg_hash_spill_partitions"
+#define PRM_NAME_INDEX_SCAN_PREFETCH_WORKERS "index_scan_prefetch_workers"
+#define PRM_NAME_MAX_JOIN_FILTER_SIZE "max_join_filter_size"
+#define PRM_NAME_CONNECTION_REACTOR_THREADS "connection_reactor_threads"
+#define PRM_NAME_MAX_QUERY_ARENA_SIZE "max_query_arena_size"
+#define PRM_NAME_MAX_QUERY_LIST_MEMORY_SIZE "max_query_list_memory_size"
+#define PRM_NAME_PB_TEMP_PAGES_RATIO "lru_temp_pages_ratio"
+#define PRM_NAME_PB_SCAN_RING_RATIO "lru_scan_ring_ratio"
+#define PRM_NAME_DATA_PAGE_COMPRESSION "data_page_compression"
+#define PRM_NAME_MULTI_INSERT_BATCH_SIZE "multi_insert_batch_size"
+#define PRM_NAME_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE "max_query_list_memory_total_size"
+
 #define PRM_VALUE_DEFAULT "DEFAULT"
 #define PRM_VALUE_MAX "MAX"
 #define PRM_VALUE_MIN "MIN"
@@ -2098,6 +2111,76 @@ static int prm_cte_max_recursions_upper = 1000000;
 static int prm_cte_max_recursions_lower = 2;
 static unsigned int prm_cte_max_recursions_flag = 0;
 
+int PRM_PARTITION_PREFETCH_WORKERS = 0;
+static int prm_partition_prefetch_workers_default = 0;
+static int prm_partition_prefetch_workers_upper = 16;
+static int prm_partition_prefetch_workers_lower = 0;
+static unsigned int prm_partition_prefetch_workers_flag = 0;
+
+int PRM_AGG_HASH_SPILL_PARTITIONS = 8;
+static int prm_agg_hash_spill_partitions_default = 8;
+static int prm_agg_hash_spill_partitions_upper = 64;
+static int prm_agg_hash_spill_partitions_lower = 0;
+static unsigned int prm_agg_hash_spill_partitions_flag = 0;
+
+int PRM_INDEX_SCAN_PREFETCH_WORKERS = 0;
+static int prm_index_scan_prefetch_workers_default = 0;
+static int prm_index_scan_prefetch_workers_upper = 16;
+static int prm_index_scan_prefetch_workers_lower = 0;
+static unsigned int prm_index_scan_prefetch_workers_flag = 0;
+
+UINT64 PRM_MAX_JOIN_FILTER_SIZE = 1024 * 1024;	/* 1 MB */
+static UINT64 prm_max_join_filter_size_default = 1024 * 1024;	/* 1 MB */
+static UINT64 prm_max_join_filter_size_upper = 64 * 1024 * 1024;	/* 64 MB */
+static UINT64 prm_max_join_filter_size_lower = 0;	/* disabled */
+static unsigned int prm_max_join_filter_size_flag = 0;
+
+int PRM_CONNECTION_REACTOR_THREADS = 0;
+static int prm_connection_reactor_threads_default = 0;
+static int prm_connection_reactor_threads_upper = 64;
+static int prm_connection_reactor_threads_lower = 0;
+static unsigned int prm_connection_reactor_threads_flag = 0;
+
+UINT64 PRM_MAX_QUERY_ARENA_SIZE = 1024 * 1024;	/* 1 MB */
+static UINT64 prm_max_query_arena_size_default = 1024 * 1024;
+static UINT64 prm_max_query_arena_size_upper = 64 * 1024 * 1024;	/* 64 MB */
+static UINT64 prm_max_query_arena_size_lower = 0;	/* disabled */
+static unsigned int prm_max_query_arena_size_flag = 0;
+
+UINT64 PRM_MAX_QUERY_LIST_MEMORY_SIZE = 16 * 1024 * 1024;	/* 16 MB */
+static UINT64 prm_max_query_list_memory_size_default = 16 * 1024 * 1024;
+static UINT64 prm_max_query_list_memory_size_upper = 1024 * 1024 * 1024;	/* 1 GB */
+static UINT64 prm_max_query_list_memory_size_lower = 0;	/* disabled */
+static unsigned int prm_max_query_list_memory_size_flag = 0;
+
+float PRM_PB_TEMP_PAGES_RATIO = 0.1f;
+static float prm_pb_temp_pages_ratio_default = 0.1f;
+static float prm_pb_temp_pages_ratio_upper = 1.0f;
+static float prm_pb_temp_pages_ratio_lower = 0.0f;
+static unsigned int prm_pb_temp_pages_ratio_flag = 0;
+
+float PRM_PB_SCAN_RING_RATIO = 0.25f;
+static float prm_pb_scan_ring_ratio_default = 0.25f;
+static float prm_pb_scan_ring_ratio_upper = 1.0f;
+static float prm_pb_scan_ring_ratio_lower = 0.0f;
+static unsigned int prm_pb_scan_ring_ratio_flag = 0;
+
+bool PRM_DATA_PAGE_COMPRESSION = false;
+static bool prm_data_page_compression_default = false;
+static unsigned int prm_data_page_compression_flag = 0;
+
+int PRM_MULTI_INSERT_BATCH_SIZE = 64;
+static int prm_multi_insert_batch_size_default = 64;
+static int prm_multi_insert_batch_size_upper = 1024;
+static int prm_multi_insert_batch_size_lower = 1;
+static unsigned int prm_multi_insert_batch_size_flag = 0;
+
+UINT64 PRM_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE = 256 * 1024 * 1024;	/* 256 MB */
+static UINT64 prm_max_query_list_memory_total_size_default = 256 * 1024 * 1024;
+static UINT64 prm_max_query_list_memory_total_size_upper = 17179869184ULL;	/* 16 GB */
+static UINT64 prm_max_query_list_memory_total_size_lower = 0;	/* disabled */
+static unsigned int prm_max_query_list_memory_total_size_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -5352,6 +5435,150 @@ static SYSPRM_PARAM prm_Def[] = {
    (void *) &prm_cte_max_recursions_lower,
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARTITION_PREFETCH_WORKERS,
+   PRM_NAME_PARTITION_PREFETCH_WORKERS,
+   (PRM_FOR_SERVER | PRM_RELOADABLE),
+   PRM_INTEGER,
+   (void *) &prm_partition_prefetch_workers_flag,
+   (void *) &prm_partition_prefetch_workers_default,
+   (void *) &PRM_PARTITION_PREFETCH_WORKERS,
+   (void *) &prm_partition_prefetch_workers_upper,
+   (void *) &prm_partition_prefetch_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AGG_HASH_SPILL_PARTITIONS,
+   PRM_NAME_AGG_HASH_SPILL_PARTITIONS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_agg_hash_spill_partitions_flag,
+   (void *) &prm_agg_hash_spill_partitions_default,
+   (void *) &PRM_AGG_HASH_SPILL_PARTITIONS,
+   (void *) &prm_agg_hash_spill_partitions_upper,
+   (void *) &prm_agg_hash_spill_partitions_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_SCAN_PREFETCH_WORKERS,
+   PRM_NAME_INDEX_SCAN_PREFETCH_WORKERS,
+   (PRM_FOR_SERVER | PRM_RELOADABLE),
+   PRM_INTEGER,
+   (void *) &prm_index_scan_prefetch_workers_flag,
+   (void *) &prm_index_scan_prefetch_workers_default,
+   (void *) &PRM_INDEX_SCAN_PREFETCH_WORKERS,
+   (void *) &prm_index_scan_prefetch_workers_upper,
+   (void *) &prm_index_scan_prefetch_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_JOIN_FILTER_SIZE,
+   PRM_NAME_MAX_JOIN_FILTER_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   (void *) &prm_max_join_filter_size_flag,
+   (void *) &prm_max_join_filter_size_default,
+   (void *) &PRM_MAX_JOIN_FILTER_SIZE,
+   (void *) &prm_max_join_filter_size_upper,
+   (void *) &prm_max_join_filter_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_CONNECTION_REACTOR_THREADS,
+   PRM_NAME_CONNECTION_REACTOR_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   (void *) &prm_connection_reactor_threads_flag,
+   (void *) &prm_connection_reactor_threads_default,
+   (void *) &PRM_CONNECTION_REACTOR_THREADS,
+   (void *) &prm_connection_reactor_threads_upper,
+   (void *) &prm_connection_reactor_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_QUERY_ARENA_SIZE,
+   PRM_NAME_MAX_QUERY_ARENA_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   (void *) &prm_max_query_arena_size_flag,
+   (void *) &prm_max_query_arena_size_default,
+   (void *) &PRM_MAX_QUERY_ARENA_SIZE,
+   (void *) &prm_max_query_arena_size_upper,
+   (void *) &prm_max_query_arena_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_QUERY_LIST_MEMORY_SIZE,
+   PRM_NAME_MAX_QUERY_LIST_MEMORY_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   (void *) &prm_max_query_list_memory_size_flag,
+   (void *) &prm_max_query_list_memory_size_default,
+   (void *) &PRM_MAX_QUERY_LIST_MEMORY_SIZE,
+   (void *) &prm_max_query_list_memory_size_upper,
+   (void *) &prm_max_query_list_memory_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_TEMP_PAGES_RATIO,
+   PRM_NAME_PB_TEMP_PAGES_RATIO,
+   (PRM_FOR_SERVER),
+   PRM_FLOAT,
+   (void *) &prm_pb_temp_pages_ratio_flag,
+   (void *) &prm_pb_temp_pages_ratio_default,
+   (void *) &PRM_PB_TEMP_PAGES_RATIO,
+   (void *) &prm_pb_temp_pages_ratio_upper,
+   (void *) &prm_pb_temp_pages_ratio_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_SCAN_RING_RATIO,
+   PRM_NAME_PB_SCAN_RING_RATIO,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_FLOAT,
+   (void *) &prm_pb_scan_ring_ratio_flag,
+   (void *) &prm_pb_scan_ring_ratio_default,
+   (void *) &PRM_PB_SCAN_RING_RATIO,
+   (void *) &prm_pb_scan_ring_ratio_upper,
+   (void *) &prm_pb_scan_ring_ratio_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DATA_PAGE_COMPRESSION,
+   PRM_NAME_DATA_PAGE_COMPRESSION,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   (void *) &prm_data_page_compression_flag,
+   (void *) &prm_data_page_compression_default,
+   (void *) &PRM_DATA_PAGE_COMPRESSION,
+   (void *) NULL,
+   (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MULTI_INSERT_BATCH_SIZE,
+   PRM_NAME_MULTI_INSERT_BATCH_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_multi_insert_batch_size_flag,
+   (void *) &prm_multi_insert_batch_size_default,
+   (void *) &PRM_MULTI_INSERT_BATCH_SIZE,
+   (void *) &prm_multi_insert_batch_size_upper,
+   (void *) &prm_multi_insert_batch_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE,
+   PRM_NAME_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   (void *) &prm_max_query_list_memory_total_size_flag,
+   (void *) &prm_max_query_list_memory_total_size_default,
+   (void *) &PRM_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE,
+   (void *) &prm_max_query_list_memory_total_size_upper,
+   (void *) &prm_max_query_list_memory_total_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL}
 };
 
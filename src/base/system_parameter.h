@@ -406,8 +406,32 @@ enum param_id
 
   PRM_ID_CTE_MAX_RECURSIONS,
 
+  PRM_ID_PARTITION_PREFETCH_WORKERS,
+
+  PRM_ID_AGG_HASH_SPILL_PARTITIONS,
+
+  PRM_ID_INDEX_SCAN_PREFETCH_WORKERS,
+
+  PRM_ID_MAX_JOIN_FILTER_SIZE,
+
+  PRM_ID_CONNECTION_REACTOR_THREADS,
+
+  PRM_ID_MAX_QUERY_ARENA_SIZE,
+
+  PRM_ID_MAX_QUERY_LIST_MEMORY_SIZE,
+
+  PRM_ID_PB_TEMP_PAGES_RATIO,
+
+  PRM_ID_PB_SCAN_RING_RATIO,
+
+  PRM_ID_DATA_PAGE_COMPRESSION,
+
+  PRM_ID_MULTI_INSERT_BATCH_SIZE,
+
+  PRM_ID_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE,
+
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_CTE_MAX_RECURSIONS
+  PRM_LAST_ID = PRM_ID_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE
 };
 
 /*
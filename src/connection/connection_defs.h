@@ -457,6 +457,12 @@ struct css_conn_entry
 
   int prefetcher_thread_count;	/* number of active thread */
   int prefetchlogdb_max_thread_count;	/* max number of active thread */
+  int reactor_index;		/* connection reactor watching this connection, -1 if none */
+  char *recv_buffer;		/* data received by the reactor that does not form a whole packet yet */
+  int recv_buffer_size;		/* allocated size of recv_buffer */
+  int recv_length;		/* bytes of data in recv_buffer */
+  int recv_offset;		/* read position of the packet being queued from recv_buffer */
+  int recv_packet_end;		/* end of the packet being queued from recv_buffer, 0 if packets are read from socket */
   CSS_QUEUE_ENTRY *free_queue_list;
   struct css_wait_queue_entry *free_wait_queue_list;
   char *free_net_header_list;
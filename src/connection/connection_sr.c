@@ -114,6 +114,10 @@ typedef struct wait_queue_search_arg
 
 #define RMUTEX_NAME_CONN_ENTRY "CONN_ENTRY"
 
+#if defined(SERVER_MODE)
+#define CSS_RECV_BUFFER_SIZE 16384	/* initial size of the buffer of data received by a connection reactor */
+#endif /* SERVER_MODE */
+
 static const int CSS_MAX_CLIENT_ID = INT_MAX - 1;
 
 static int css_Client_id = 0;
@@ -190,6 +194,15 @@ static void css_queue_packet (CSS_CONN_ENTRY * conn, int type, unsigned short re
 static int css_remove_and_free_queue_entry (void *data, void *arg);
 static int css_remove_and_free_wait_queue_entry (void *data, void *arg);
 
+static int css_recv_conn_data (CSS_CONN_ENTRY * conn, char *buffer, int *maxlen);
+static void css_skip_conn_data (CSS_CONN_ENTRY * conn, int len);
+#if defined(SERVER_MODE)
+static int css_recv_buffered_data (CSS_CONN_ENTRY * conn, char *buffer, int *maxlen);
+#if defined(LINUX)
+static int css_get_buffered_packet_length (const char *buffer, int length, int *needed);
+#endif /* LINUX */
+#endif /* SERVER_MODE */
+
 static int css_increment_num_conn_internal (CSS_CONN_RULE_INFO * conn_rule_info);
 static void css_decrement_num_conn_internal (CSS_CONN_RULE_INFO * conn_rule_info);
 
@@ -286,6 +299,12 @@ css_initialize_conn (CSS_CONN_ENTRY * conn, SOCKET fd)
 #if defined(SERVER_MODE)
   conn->session_p = NULL;
   conn->client_type = BOOT_CLIENT_UNKNOWN;
+  conn->reactor_index = -1;
+  conn->recv_buffer = NULL;
+  conn->recv_buffer_size = 0;
+  conn->recv_length = 0;
+  conn->recv_offset = 0;
+  conn->recv_packet_end = 0;
 #endif
 
   err = css_initialize_list (&conn->request_queue, 0);
@@ -362,6 +381,16 @@ css_shutdown_conn (CSS_CONN_ENTRY * conn)
       css_finalize_list (&conn->error_queue);
     }
 
+#if defined(SERVER_MODE)
+  if (conn->recv_buffer != NULL)
+    {
+      free_and_init (conn->recv_buffer);
+    }
+  conn->recv_buffer_size = 0;
+  conn->recv_length = 0;
+  conn->recv_packet_end = 0;
+#endif /* SERVER_MODE */
+
   if (conn->free_queue_count > 0)
     {
       CSS_QUEUE_ENTRY *p;
@@ -1485,7 +1514,8 @@ css_send_abort_request (CSS_CONN_ENTRY * conn, unsigned short request_id)
  *   conn(in): connection entry
  *   local_header(in):
  *
- * Note: It is a blocking read.
+ * Note: It is a blocking read, unless the packet is queued from the data
+ *       received by a connection reactor.
  */
 int
 css_read_header (CSS_CONN_ENTRY * conn, const NET_HEADER * local_header)
@@ -1501,7 +1531,7 @@ css_read_header (CSS_CONN_ENTRY * conn, const NET_HEADER * local_header)
       return (CONNECTION_CLOSED);
     }
 
-  rc = css_net_read_header (conn->fd, (char *) local_header, &buffer_size, -1);
+  rc = css_recv_conn_data (conn, (char *) local_header, &buffer_size);
   if (rc == NO_ERRORS && ntohl (local_header->type) == CLOSE_TYPE)
     {
       return (CONNECTION_CLOSED);
@@ -1569,6 +1599,308 @@ css_read_and_queue (CSS_CONN_ENTRY * conn, int *type)
   return (rc);
 }
 
+#if defined(SERVER_MODE) && defined(LINUX)
+/*
+ * css_read_and_queue_nonblocking() - read the data available on the socket
+ *                                    without waiting, and queue the packets
+ *                                    that are complete
+ *   return: 0 if success, or error code
+ *   conn(in): connection entry
+ *   num_commands(out): number of command packets queued
+ *
+ * Note: Used by the connection reactors, which serve many connections and
+ *       must not wait for a slow client to send the rest of a packet. The
+ *       incomplete packet is kept in conn->recv_buffer until more data
+ *       arrives. Only the reactor watching the connection may call it.
+ */
+int
+css_read_and_queue_nonblocking (CSS_CONN_ENTRY * conn, int *num_commands)
+{
+  char *new_buffer;
+  int new_size, needed = 0;
+  int offset, packet_length;
+  int n, rc = NO_ERRORS, type;
+
+  *num_commands = 0;
+
+  if (!conn || conn->status != CONN_OPEN)
+    {
+      return (ERROR_ON_READ);
+    }
+
+  if (conn->stop_talk == true)
+    {
+      return (CONNECTION_CLOSED);
+    }
+
+  /* make room for the data to be read */
+  if (conn->recv_length == conn->recv_buffer_size)
+    {
+      (void) css_get_buffered_packet_length (conn->recv_buffer, conn->recv_length, &needed);
+      new_size = MAX (conn->recv_buffer_size * 2, CSS_RECV_BUFFER_SIZE);
+      new_size = MAX (new_size, needed);
+
+      new_buffer = (char *) realloc (conn->recv_buffer, new_size);
+      if (new_buffer == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) new_size);
+	  return (CANT_ALLOC_BUFFER);
+	}
+      conn->recv_buffer = new_buffer;
+      conn->recv_buffer_size = new_size;
+    }
+
+  n = recv (conn->fd, conn->recv_buffer + conn->recv_length, conn->recv_buffer_size - conn->recv_length, MSG_DONTWAIT);
+  if (n == 0)
+    {
+      /* closed by peer */
+      return (CONNECTION_CLOSED);
+    }
+  else if (n < 0)
+    {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+	{
+	  return (NO_ERRORS);
+	}
+      er_log_debug (ARG_FILE_LINE, "css_read_and_queue_nonblocking: recv() error %d\n", errno);
+      return (ERROR_ON_READ);
+    }
+  conn->recv_length += n;
+
+  /* queue the whole packets; css_read_and_queue reads them from the buffer */
+  offset = 0;
+  while (true)
+    {
+      packet_length = css_get_buffered_packet_length (conn->recv_buffer + offset, conn->recv_length - offset, &needed);
+      if (packet_length < 0)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_read_and_queue_nonblocking: invalid packet\n");
+	  rc = ERROR_ON_READ;
+	  break;
+	}
+      else if (packet_length == 0)
+	{
+	  break;
+	}
+
+      conn->recv_offset = offset;
+      conn->recv_packet_end = offset + packet_length;
+      while (rc == NO_ERRORS && conn->recv_offset < conn->recv_packet_end)
+	{
+	  rc = css_read_and_queue (conn, &type);
+	  if (rc == NO_ERRORS && type == COMMAND_TYPE)
+	    {
+	      (*num_commands)++;
+	    }
+	}
+      offset = conn->recv_packet_end;
+      conn->recv_packet_end = 0;
+
+      if (rc != NO_ERRORS)
+	{
+	  break;
+	}
+    }
+
+  if (rc != NO_ERRORS || conn->recv_buffer == NULL)
+    {
+      /* the connection is about to be closed, or was closed by a close packet */
+      return rc;
+    }
+
+  /* keep the incomplete packet */
+  conn->recv_length -= offset;
+  if (conn->recv_length > 0 && offset > 0)
+    {
+      memmove (conn->recv_buffer, conn->recv_buffer + offset, conn->recv_length);
+    }
+  else if (conn->recv_length == 0 && conn->recv_buffer_size > CSS_RECV_BUFFER_SIZE)
+    {
+      /* do not keep the memory of a large request */
+      free_and_init (conn->recv_buffer);
+      conn->recv_buffer_size = 0;
+    }
+
+  return NO_ERRORS;
+}
+
+/*
+ * css_get_buffered_packet_length() - get the length of the first packet in
+ *                                    the data received on a connection
+ *   return: length of the packet, 0 if the packet is not complete yet, or -1
+ *           if the data is not a valid packet
+ *   buffer(in): received data
+ *   length(in): length of received data
+ *   needed(out): length of data needed to know more about the packet
+ *
+ * Note: The packets are sent as records of a length and that many bytes. A
+ *       packet is a header record, followed by a record of data for data and
+ *       error packets, or by a data packet for command packets with an
+ *       argument. This is what css_read_and_queue reads at once.
+ */
+static int
+css_get_buffered_packet_length (const char *buffer, int length, int *needed)
+{
+  NET_HEADER header;
+  int record_length;
+  int pos = 0;
+  bool is_header = true;
+
+  while (true)
+    {
+      if (length - pos < (int) sizeof (int))
+	{
+	  *needed = pos + sizeof (int);
+	  return 0;
+	}
+
+      memcpy (&record_length, buffer + pos, sizeof (int));
+      record_length = ntohl (record_length);
+      if (record_length < 0 || record_length > INT_MAX - pos - (int) sizeof (int)
+	  || (is_header && record_length < (int) sizeof (NET_HEADER)))
+	{
+	  return -1;
+	}
+
+      if (length - pos - (int) sizeof (int) < record_length)
+	{
+	  *needed = pos + sizeof (int) + record_length;
+	  return 0;
+	}
+
+      if (!is_header)
+	{
+	  /* data of a data or error packet */
+	  return pos + sizeof (int) + record_length;
+	}
+
+      memcpy (&header, buffer + pos + sizeof (int), sizeof (NET_HEADER));
+      pos += sizeof (int) + record_length;
+
+      switch (ntohl (header.type))
+	{
+	case DATA_TYPE:
+	case ERROR_TYPE:
+	  is_header = false;
+	  break;
+
+	case COMMAND_TYPE:
+	  if ((int) ntohl (header.buffer_size) <= 0)
+	    {
+	      return pos;
+	    }
+	  /* argument follows as a data packet */
+	  break;
+
+	default:
+	  return pos;
+	}
+    }
+}
+#endif /* SERVER_MODE && LINUX */
+
+/*
+ * css_recv_conn_data() - read a record of data sent on a connection
+ *   return: 0 if success, or error code
+ *   conn(in): connection entry
+ *   buffer(out): buffer for data
+ *   maxlen(in/out): size of buffer, and count of bytes read
+ *
+ * Note: Reads the socket, or the data received by the connection reactor
+ *       while its packets are queued.
+ */
+static int
+css_recv_conn_data (CSS_CONN_ENTRY * conn, char *buffer, int *maxlen)
+{
+#if defined(SERVER_MODE)
+  if (conn->recv_packet_end > 0)
+    {
+      return css_recv_buffered_data (conn, buffer, maxlen);
+    }
+#endif /* SERVER_MODE */
+
+  return css_net_recv (conn->fd, buffer, maxlen, -1);
+}
+
+/*
+ * css_skip_conn_data() - skip a record of data sent on a connection
+ *   return: void
+ *   conn(in): connection entry
+ *   len(in): count of bytes, as given by the packet header
+ *
+ * Note: The data received by the connection reactor is skipped by the length
+ *       of the record itself.
+ */
+static void
+css_skip_conn_data (CSS_CONN_ENTRY * conn, int len)
+{
+#if defined(SERVER_MODE)
+  int record_length;
+
+  if (conn->recv_packet_end > 0)
+    {
+      if (conn->recv_packet_end - conn->recv_offset >= (int) sizeof (int))
+	{
+	  memcpy (&record_length, conn->recv_buffer + conn->recv_offset, sizeof (int));
+	  len = sizeof (int) + ntohl (record_length);
+	}
+      conn->recv_offset = MIN (conn->recv_offset + len, conn->recv_packet_end);
+      return;
+    }
+#endif /* SERVER_MODE */
+
+  css_read_remaining_bytes (conn->fd, len);
+}
+
+#if defined(SERVER_MODE)
+/*
+ * css_recv_buffered_data() - read a record of data from the data received by
+ *                            the connection reactor
+ *   return: 0 if success, or error code
+ *   conn(in): connection entry
+ *   buffer(out): buffer for data
+ *   maxlen(in/out): size of buffer, and count of bytes read
+ *
+ * Note: Returns the same as css_net_recv would for the same data.
+ */
+static int
+css_recv_buffered_data (CSS_CONN_ENTRY * conn, char *buffer, int *maxlen)
+{
+  int record_length, length_to_read;
+  int pos = conn->recv_offset;
+
+  if (conn->recv_packet_end - pos < (int) sizeof (int))
+    {
+      return ERROR_WHEN_READING_SIZE;
+    }
+
+  memcpy (&record_length, conn->recv_buffer + pos, sizeof (int));
+  record_length = ntohl (record_length);
+  pos += sizeof (int);
+  if (record_length < 0 || conn->recv_packet_end - pos < record_length)
+    {
+      return ERROR_ON_READ;
+    }
+
+  length_to_read = MIN (record_length, *maxlen);
+  memcpy (buffer, conn->recv_buffer + pos, length_to_read);
+  conn->recv_offset = pos + record_length;
+
+  if (length_to_read && (record_length > length_to_read))
+    {
+      return RECORD_TRUNCATED;
+    }
+
+  if (length_to_read != record_length)
+    {
+      return READ_LENGTH_MISMATCH;
+    }
+
+  *maxlen = length_to_read;
+  return NO_ERRORS;
+}
+#endif /* SERVER_MODE */
+
 /*
  * css_receive_data() - receive a data for an associated request.
  *   return: 0 if success, or error code
@@ -2131,7 +2463,7 @@ css_queue_data_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const N
   /* receive data into buffer and queue data if there's no waiting thread */
   if (buffer != NULL)
     {
-      rc = css_net_recv (conn->fd, buffer, &size, -1);
+      rc = css_recv_conn_data (conn, buffer, &size);
       if (rc == NO_ERRORS || rc == RECORD_TRUNCATED)
 	{
 	  if (!css_is_request_aborted (conn, request_id))
@@ -2160,7 +2492,7 @@ css_queue_data_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const N
   else
     {
       rc = CANT_ALLOC_BUFFER;
-      css_read_remaining_bytes (conn->fd, sizeof (int) + size);
+      css_skip_conn_data (conn, sizeof (int) + size);
       if (!css_is_request_aborted (conn, request_id))
 	{
 	  if (data_wait == NULL)
@@ -2200,7 +2532,7 @@ css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const
 
   if (buffer != NULL)
     {
-      rc = css_net_recv (conn->fd, buffer, &size, -1);
+      rc = css_recv_conn_data (conn, buffer, &size);
       if (rc == NO_ERRORS || rc == RECORD_TRUNCATED)
 	{
 	  if (!css_is_request_aborted (conn, request_id))
@@ -2215,7 +2547,7 @@ css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const
   else
     {
       rc = CANT_ALLOC_BUFFER;
-      css_read_remaining_bytes (conn->fd, sizeof (int) + size);
+      css_skip_conn_data (conn, sizeof (int) + size);
       if (!css_is_request_aborted (conn, request_id))
 	{
 	  css_add_queue_entry (conn, &conn->error_queue, request_id, NULL, 0, rc, conn->transaction_id,
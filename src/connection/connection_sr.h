@@ -164,6 +164,9 @@ extern int css_send_abort_request (CSS_CONN_ENTRY * conn, unsigned short request
 extern int css_read_header (CSS_CONN_ENTRY * conn, const NET_HEADER * local_header);
 extern int css_receive_request (CSS_CONN_ENTRY * conn, unsigned short *rid, int *request, int *buffer_size);
 extern int css_read_and_queue (CSS_CONN_ENTRY * conn, int *type);
+#if defined(SERVER_MODE) && defined(LINUX)
+extern int css_read_and_queue_nonblocking (CSS_CONN_ENTRY * conn, int *num_commands);
+#endif /* SERVER_MODE && LINUX */
 extern int css_receive_data (CSS_CONN_ENTRY * conn, unsigned short req_id, char **buffer, int *buffer_size,
 			     int timeout);
 
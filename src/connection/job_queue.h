@@ -29,6 +29,7 @@
 
 #include "connection_sr.h"
 #include "connection_defs.h"
+#include "tsc_timer.h"
 
 typedef struct css_job_entry CSS_JOB_ENTRY;
 struct css_job_entry
@@ -37,6 +38,7 @@ struct css_job_entry
   CSS_CONN_ENTRY *conn_entry;	/* conn entry from which we read request */
   CSS_THREAD_FN func;		/* request handling function */
   CSS_THREAD_ARG arg;		/* handling function argument */
+  TSC_TICKS enqueue_tick;	/* when the job was added to the job queue */
   CSS_JOB_ENTRY *next;
 };
 
@@ -48,6 +50,7 @@ extern void css_add_to_job_queue (CSS_JOB_ENTRY * job);
 extern CSS_JOB_ENTRY *css_get_new_job (void);
 extern void css_incr_job_queue_counter (int jobq_index, CSS_THREAD_FN func);
 extern void css_decr_job_queue_counter (int jobq_index, CSS_THREAD_FN func);
+extern int css_get_num_queued_jobs (void);
 
 extern int css_job_queues_start_scan (THREAD_ENTRY * thread_p, int show_type, DB_VALUE ** arg_values, int arg_cnt,
 				      void **ptr);
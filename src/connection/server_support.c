@@ -38,6 +38,10 @@
 #include <sys/socket.h>
 #include <fcntl.h>
 #include <netinet/in.h>
+#if defined(LINUX)
+#include <sys/epoll.h>
+#include <netinet/tcp.h>
+#endif /* LINUX */
 #endif /* !WINDOWS */
 #include <assert.h>
 
@@ -86,6 +90,33 @@
 
 #define RMUTEX_NAME_TEMP_CONN_ENTRY "TEMP_CONN_ENTRY"
 
+#define CSS_JOB_WAIT_HISTOGRAM_SIZE 4	/* < 1 ms, < 10 ms, < 100 ms, >= 100 ms */
+#define CSS_JOB_DELAYED_WAIT_USEC 10000	/* jobs waiting longer are counted as delayed */
+
+#if defined(LINUX)
+#define CSS_REACTOR_MAX_EVENTS 64	/* # of events taken by one epoll_wait() */
+#define CSS_REACTOR_WAIT_MSEC 100	/* so that shutdown is noticed */
+#define CSS_REACTOR_SWEEP_SEC 5	/* interval of checking the connections without traffic */
+#define CSS_REACTOR_KEEPALIVE_SEC 5	/* idle time and interval of the probes of a client host */
+
+#define CSS_IS_CONNECTION_JOB(func) \
+  ((func) == (CSS_THREAD_FN) css_connection_handler_thread || (func) == css_connection_reactor_thread)
+
+/* connection reactor: one epoll set watching the sockets of many client connections */
+typedef struct css_reactor CSS_REACTOR;
+struct css_reactor
+{
+  int index;
+  int epoll_fd;
+};
+
+static CSS_REACTOR *css_Reactors = NULL;
+static int css_Num_reactors = 0;
+static bool css_Reactors_started = false;
+#else /* LINUX */
+#define CSS_IS_CONNECTION_JOB(func) ((func) == (CSS_THREAD_FN) css_connection_handler_thread)
+#endif /* !LINUX */
+
 static struct timeval css_Shutdown_timeout = { 0, 0 };
 
 static char *css_Master_server_name = NULL;	/* database identifier */
@@ -107,11 +138,15 @@ static bool ha_Repl_delay_detected = false;
 
 static int ha_Server_num_of_hosts = 0;
 
+/* upper bounds (exclusive) of the wait time ranges of the job queue wait histogram; the last range is unbounded */
+static const INT64 css_Job_wait_histogram_bounds_usec[CSS_JOB_WAIT_HISTOGRAM_SIZE - 1] = { 1000, 10000, 100000 };
+
 typedef struct job_queue JOB_QUEUE;
 struct job_queue
 {
   pthread_mutex_t job_lock;
-  CSS_LIST job_list;
+  LOCK_FREE_CIRCULAR_QUEUE *job_lfq;	/* jobs waiting for a worker; popped without job_lock */
+  CSS_LIST job_list;		/* overflow of job_lfq, protected by job_lock */
   THREAD_ENTRY *worker_thrd_list;
   pthread_mutex_t free_lock;
   CSS_JOB_ENTRY *free_list;
@@ -121,69 +156,89 @@ struct job_queue
   int num_total_workers;	/* Num of total workers in this job queue */
   int num_busy_workers;		/* Num of busy threads in this job queue */
   int num_conn_workers;		/* Num of connection threads in this job queue */
+
+  /* statistics of jobs; the jobs run by this job queue are the ones picked up by its workers */
+  INT64 num_enqueued_jobs;	/* Num of jobs added to this job queue */
+  INT64 num_stolen_jobs;	/* Num of jobs stolen from other job queues */
+  INT64 num_request_jobs;	/* Num of client request jobs run */
+  INT64 num_connection_jobs;	/* Num of connection handler jobs run */
+  INT64 num_other_jobs;		/* Num of server internal jobs run */
+  INT64 total_wait_usec;	/* Total time jobs waited between enqueue and start */
+  INT64 max_wait_usec;		/* Maximum time a job waited between enqueue and start */
+  INT64 wait_histogram[CSS_JOB_WAIT_HISTOGRAM_SIZE];	/* Num of jobs per wait time range */
 };
 
 static JOB_QUEUE css_Job_queue[CSS_NUM_JOB_QUEUE] = {
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0},
-  {PTHREAD_MUTEX_INITIALIZER, {NULL, NULL, NULL, 0, 0},
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}},
+  {PTHREAD_MUTEX_INITIALIZER, NULL, {NULL, NULL, NULL, 0, 0},
    NULL, PTHREAD_MUTEX_INITIALIZER, NULL,
 #if !defined(HAVE_ATOMIC_BUILTINS)
    PTHREAD_MUTEX_INITIALIZER,
 #endif /* !HAVE_ATOMIC_BUILTINS */
-   0, 0, 0}
+   0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0}}
 };
 
 #define HA_LOG_APPLIER_STATE_TABLE_MAX  5
@@ -222,9 +277,28 @@ static int css_reestablish_connection_to_master (void);
 static void dummy_sigurg_handler (int sig);
 static int css_connection_handler_thread (THREAD_ENTRY * thrd, CSS_CONN_ENTRY * conn);
 static int css_internal_connection_handler (CSS_CONN_ENTRY * conn);
+#if defined(LINUX)
+static void css_start_connection_reactors (void);
+static int css_connection_reactor_thread (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+static int css_attach_conn_to_reactor (CSS_CONN_ENTRY * conn);
+static void css_set_reactor_conn_keepalive (CSS_CONN_ENTRY * conn);
+static void css_detach_conn_from_reactor (CSS_REACTOR * reactor, CSS_CONN_ENTRY * conn);
+static int css_check_reactor_conn_status (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn);
+static void css_process_reactor_event (THREAD_ENTRY * thread_p, CSS_REACTOR * reactor, CSS_CONN_ENTRY * conn,
+				       unsigned int events);
+static void css_sweep_reactor_conns (THREAD_ENTRY * thread_p, CSS_REACTOR * reactor);
+static void css_close_reactor_conn (CSS_REACTOR * reactor, CSS_CONN_ENTRY * conn, int status);
+static int css_connection_error_job (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+#endif /* LINUX */
 static int css_internal_request_handler (THREAD_ENTRY * thrd, CSS_THREAD_ARG arg);
 static int css_test_for_client_errors (CSS_CONN_ENTRY * conn, unsigned int eid);
 static int css_wait_worker_thread_on_jobq (THREAD_ENTRY * thrd, int jobq_index);
+static void css_push_job_on_jobq (int jobq_index, CSS_JOB_ENTRY * job_entry_p);
+static CSS_JOB_ENTRY *css_pop_job_from_jobq (int jobq_index);
+static CSS_JOB_ENTRY *css_steal_job (int jobq_index);
+static bool css_has_queued_jobs (void);
+static void css_add_job_queue_stat (JOB_QUEUE * jobq, INT64 * statp, INT64 amount);
+static void css_record_job_wait (JOB_QUEUE * jobq, CSS_JOB_ENTRY * job_entry_p);
 static bool css_can_occupy_worker_thread_on_jobq (int jobq_index);
 static int css_wakeup_worker_thread_on_jobq (int jobq_index);
 static int css_check_accessibility (SOCKET new_fd);
@@ -368,6 +442,8 @@ css_init_job_queue (void)
       CSS_CHECK_RETURN (r, ER_CSS_PTHREAD_MUTEX_INIT);
 #endif /* !HAVE_ATOMIC_BUILTINS */
 
+      /* if the lock-free queue cannot be created, jobs are kept only in job_list */
+      css_Job_queue[i].job_lfq = lf_circular_queue_create (num_job_list, sizeof (CSS_JOB_ENTRY *));
       css_initialize_list (&css_Job_queue[i].job_list, num_job_list);
       css_Job_queue[i].free_list = NULL;
 
@@ -437,27 +513,37 @@ css_broadcast_shutdown_thread (void)
  * css_add_to_job_queue () -
  *   return:
  *   job_entry_p(in):
+ *
+ * NOTE: The job is queued on its own job queue without waiting. If some
+ *       worker is idle, it is woken up; a worker of another job queue will
+ *       steal the job. Otherwise the first worker that finishes its current
+ *       job takes it.
  */
 void
 css_add_to_job_queue (CSS_JOB_ENTRY * job_entry_p)
 {
   int rv;
-  int i, j, jobq_index;
-  const int MAX_NTRIES = 100;
+  int i, jobq_index;
 
-  jobq_index = job_entry_p->jobq_index;
+  tsc_getticks (&job_entry_p->enqueue_tick);
+  css_add_job_queue_stat (&css_Job_queue[job_entry_p->jobq_index],
+			  &css_Job_queue[job_entry_p->jobq_index].num_enqueued_jobs, 1);
 
-  for (i = 0; i <= MAX_NTRIES; i++)
+  css_push_job_on_jobq (job_entry_p->jobq_index, job_entry_p);
+
+  /* a waiting worker publishes itself in worker_thrd_list before checking the queues for the last time, so either it
+   * sees the job pushed above or we see it here. */
+  MEMORY_BARRIER ();
+
+  jobq_index = job_entry_p->jobq_index;
+  for (i = 0; i < CSS_NUM_JOB_QUEUE; i++)
     {
-      for (j = 0; j < CSS_NUM_JOB_QUEUE; j++)
+      if (css_Job_queue[jobq_index].worker_thrd_list != NULL)
 	{
 	  rv = pthread_mutex_lock (&css_Job_queue[jobq_index].job_lock);
 
-	  if (css_can_occupy_worker_thread_on_jobq (jobq_index) || i == MAX_NTRIES)
+	  if (css_can_occupy_worker_thread_on_jobq (jobq_index))
 	    {
-	      /* If there's no available thread even though it has probed the entire job queues, just add the job to
-	       * the original job queue. */
-	      css_add_list (&css_Job_queue[jobq_index].job_list, job_entry_p);
 	      css_wakeup_worker_thread_on_jobq (jobq_index);
 
 	      pthread_mutex_unlock (&css_Job_queue[jobq_index].job_lock);
@@ -465,13 +551,205 @@ css_add_to_job_queue (CSS_JOB_ENTRY * job_entry_p)
 	    }
 
 	  pthread_mutex_unlock (&css_Job_queue[jobq_index].job_lock);
+	}
+
+      jobq_index++;
+      jobq_index %= CSS_NUM_JOB_QUEUE;
+    }
+}
+
+/*
+ * css_push_job_on_jobq () - add a job to the tail of a job queue
+ *   return:
+ *   jobq_index(in): the index of job queue
+ *   job_entry_p(in):
+ */
+static void
+css_push_job_on_jobq (int jobq_index, CSS_JOB_ENTRY * job_entry_p)
+{
+  JOB_QUEUE *jobq = &css_Job_queue[jobq_index];
+  int rv;
+
+  if (jobq->job_lfq != NULL && lf_circular_queue_produce (jobq->job_lfq, &job_entry_p))
+    {
+      return;
+    }
+
+  /* lock-free queue is full */
+  rv = pthread_mutex_lock (&jobq->job_lock);
+  css_add_list (&jobq->job_list, job_entry_p);
+  pthread_mutex_unlock (&jobq->job_lock);
+}
+
+/*
+ * css_pop_job_from_jobq () - remove a job from the head of a job queue
+ *   return: job entry or NULL if the job queue is empty
+ *   jobq_index(in): the index of job queue
+ */
+static CSS_JOB_ENTRY *
+css_pop_job_from_jobq (int jobq_index)
+{
+  JOB_QUEUE *jobq = &css_Job_queue[jobq_index];
+  CSS_JOB_ENTRY *job_entry_p = NULL;
+  int rv;
+
+  if (jobq->job_lfq != NULL && lf_circular_queue_consume (jobq->job_lfq, &job_entry_p))
+    {
+      return job_entry_p;
+    }
+
+  if (jobq->job_list.count > 0)
+    {
+      rv = pthread_mutex_lock (&jobq->job_lock);
+      job_entry_p = (CSS_JOB_ENTRY *) css_remove_list_from_head (&jobq->job_list);
+      pthread_mutex_unlock (&jobq->job_lock);
+    }
+
+  return job_entry_p;
+}
+
+/*
+ * css_steal_job () - take a job queued on another job queue
+ *   return: job entry or NULL if all job queues are empty
+ *   jobq_index(in): the job queue of the worker looking for a job
+ */
+static CSS_JOB_ENTRY *
+css_steal_job (int jobq_index)
+{
+  CSS_JOB_ENTRY *job_entry_p;
+  int i, victim_index;
+
+  for (i = 1; i < CSS_NUM_JOB_QUEUE; i++)
+    {
+      victim_index = (jobq_index + i) % CSS_NUM_JOB_QUEUE;
+
+      job_entry_p = css_pop_job_from_jobq (victim_index);
+      if (job_entry_p != NULL)
+	{
+	  /* the job now belongs to the job queue of the worker that runs it */
+	  job_entry_p->jobq_index = jobq_index;
+	  css_add_job_queue_stat (&css_Job_queue[jobq_index], &css_Job_queue[jobq_index].num_stolen_jobs, 1);
+	  perfmon_inc_stat_to_global (PSTAT_NET_NUM_STOLEN_JOBS);
+
+	  return job_entry_p;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * css_has_queued_jobs () - check whether any job queue has a job waiting for a worker
+ *   return:
+ */
+static bool
+css_has_queued_jobs (void)
+{
+  int i;
+
+  for (i = 0; i < CSS_NUM_JOB_QUEUE; i++)
+    {
+      if ((css_Job_queue[i].job_lfq != NULL && !lf_circular_queue_is_empty (css_Job_queue[i].job_lfq))
+	  || css_Job_queue[i].job_list.count > 0)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * css_get_num_queued_jobs () - get the number of jobs waiting for a worker
+ *   return:
+ */
+int
+css_get_num_queued_jobs (void)
+{
+  int i, num_jobs = 0;
+
+  for (i = 0; i < CSS_NUM_JOB_QUEUE; i++)
+    {
+      if (css_Job_queue[i].job_lfq != NULL)
+	{
+	  num_jobs += lf_circular_queue_approx_size (css_Job_queue[i].job_lfq);
+	}
+      num_jobs += css_Job_queue[i].job_list.count;
+    }
+
+  return num_jobs;
+}
+
+/*
+ * css_add_job_queue_stat () - add to a statistic counter of a job queue
+ *   return:
+ *   jobq(in): job queue
+ *   statp(in): counter of jobq
+ *   amount(in):
+ */
+static void
+css_add_job_queue_stat (JOB_QUEUE * jobq, INT64 * statp, INT64 amount)
+{
+#if defined(HAVE_ATOMIC_BUILTINS)
+  ATOMIC_INC_64 (statp, amount);
+#else /* HAVE_ATOMIC_BUILTINS */
+  (void) pthread_mutex_lock (&jobq->counter_lock);
+  *statp += amount;
+  (void) pthread_mutex_unlock (&jobq->counter_lock);
+#endif /* HAVE_ATOMIC_BUILTINS */
+}
+
+/*
+ * css_record_job_wait () - account the time a job waited before a worker picked it up
+ *   return:
+ *   jobq(in): job queue of the worker
+ *   job_entry_p(in):
+ */
+static void
+css_record_job_wait (JOB_QUEUE * jobq, CSS_JOB_ENTRY * job_entry_p)
+{
+  TSC_TICKS now;
+  INT64 wait_usec, max_wait_usec;
+  int bucket;
+
+  tsc_getticks (&now);
+  wait_usec = (INT64) tsc_elapsed_utime (now, job_entry_p->enqueue_tick);
+
+  for (bucket = 0; bucket < CSS_JOB_WAIT_HISTOGRAM_SIZE - 1; bucket++)
+    {
+      if (wait_usec < css_Job_wait_histogram_bounds_usec[bucket])
+	{
+	  break;
+	}
+    }
+
+  css_add_job_queue_stat (jobq, &jobq->wait_histogram[bucket], 1);
+  css_add_job_queue_stat (jobq, &jobq->total_wait_usec, wait_usec);
 
-	  /* linear probing */
-	  jobq_index++;
-	  jobq_index %= CSS_NUM_JOB_QUEUE;
+#if defined(HAVE_ATOMIC_BUILTINS)
+  do
+    {
+      max_wait_usec = ATOMIC_LOAD_64 (&jobq->max_wait_usec);
+      if (max_wait_usec >= wait_usec)
+	{
+	  break;
 	}
+    }
+  while (!ATOMIC_CAS_64 (&jobq->max_wait_usec, max_wait_usec, wait_usec));
+#else /* HAVE_ATOMIC_BUILTINS */
+  (void) pthread_mutex_lock (&jobq->counter_lock);
+  max_wait_usec = jobq->max_wait_usec;
+  if (max_wait_usec < wait_usec)
+    {
+      jobq->max_wait_usec = wait_usec;
+    }
+  (void) pthread_mutex_unlock (&jobq->counter_lock);
+#endif /* HAVE_ATOMIC_BUILTINS */
 
-      thread_sleep (10 * ((i / 10) + 1));	/* sleep 10ms upto 100ms */
+  perfmon_add_stat_to_global (PSTAT_NET_JOB_WAIT_TIME, wait_usec);
+  if (wait_usec >= CSS_JOB_DELAYED_WAIT_USEC)
+    {
+      perfmon_inc_stat_to_global (PSTAT_NET_NUM_DELAYED_JOBS);
     }
 }
 
@@ -491,9 +769,10 @@ css_job_queues_start_scan (THREAD_ENTRY * thread_p, int show_type, DB_VALUE ** a
   SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
   DB_VALUE *vals = NULL;
   JOB_QUEUE *jobq = NULL;
-  int idx, jobq_idx;
-  int num_busy_workers, num_conn_workers;
-  const int col_num = 4;
+  int idx, jobq_idx, i;
+  int num_busy_workers, num_conn_workers, num_queued_jobs;
+  INT64 num_started_jobs;
+  const int col_num = 19;
 
   *ptr = NULL;
 
@@ -544,6 +823,52 @@ css_job_queues_start_scan (THREAD_ENTRY * thread_p, int show_type, DB_VALUE ** a
       db_make_int (&vals[idx], num_conn_workers);
       idx++;
 
+      /* num of free workers in this queue */
+      db_make_int (&vals[idx], MAX (jobq->num_total_workers - num_busy_workers, 0));
+      idx++;
+
+      /* num of jobs waiting for a worker in this queue */
+      num_queued_jobs = jobq->job_list.count;
+      if (jobq->job_lfq != NULL)
+	{
+	  num_queued_jobs += lf_circular_queue_approx_size (jobq->job_lfq);
+	}
+      db_make_int (&vals[idx], num_queued_jobs);
+      idx++;
+
+      db_make_bigint (&vals[idx], jobq->num_enqueued_jobs);
+      idx++;
+
+      db_make_bigint (&vals[idx], jobq->num_stolen_jobs);
+      idx++;
+
+      db_make_bigint (&vals[idx], jobq->num_request_jobs);
+      idx++;
+
+      db_make_bigint (&vals[idx], jobq->num_connection_jobs);
+      idx++;
+
+      db_make_bigint (&vals[idx], jobq->num_other_jobs);
+      idx++;
+
+      /* wait time between enqueue and start of the jobs picked up by this queue */
+      num_started_jobs = 0;
+      for (i = 0; i < CSS_JOB_WAIT_HISTOGRAM_SIZE; i++)
+	{
+	  num_started_jobs += jobq->wait_histogram[i];
+	}
+      db_make_bigint (&vals[idx], (num_started_jobs > 0) ? jobq->total_wait_usec / num_started_jobs : 0);
+      idx++;
+
+      db_make_bigint (&vals[idx], jobq->max_wait_usec);
+      idx++;
+
+      for (i = 0; i < CSS_JOB_WAIT_HISTOGRAM_SIZE; i++)
+	{
+	  db_make_bigint (&vals[idx], jobq->wait_histogram[i]);
+	  idx++;
+	}
+
       assert (idx == col_num);
     }
 
@@ -564,6 +889,9 @@ exit_on_error:
 /*
  * css_get_new_job() - fetch a job from the queue
  *   return:
+ *
+ * NOTE: The worker looks at its own job queue first and then steals from the
+ *       other job queues. It sleeps only when all job queues are empty.
  */
 CSS_JOB_ENTRY *
 css_get_new_job (void)
@@ -573,24 +901,33 @@ css_get_new_job (void)
   int jobq_index = thrd->index % CSS_NUM_JOB_QUEUE;
   int r;
 
-  r = pthread_mutex_lock (&css_Job_queue[jobq_index].job_lock);
-
-  if (css_Job_queue[jobq_index].job_list.count == 0)
+  while (true)
     {
+      job_entry_p = css_pop_job_from_jobq (jobq_index);
+      if (job_entry_p == NULL)
+	{
+	  job_entry_p = css_steal_job (jobq_index);
+	}
+      if (job_entry_p != NULL)
+	{
+	  css_record_job_wait (&css_Job_queue[jobq_index], job_entry_p);
+	  break;
+	}
+      if (thrd->shutdown)
+	{
+	  break;
+	}
+
+      r = pthread_mutex_lock (&css_Job_queue[jobq_index].job_lock);
       r = css_wait_worker_thread_on_jobq (thrd, jobq_index);
+      pthread_mutex_unlock (&css_Job_queue[jobq_index].job_lock);
+
       if (r != NO_ERROR)
 	{
-	  pthread_mutex_unlock (&css_Job_queue[jobq_index].job_lock);
-	  r = pthread_mutex_lock (&thrd->tran_index_lock);
-
-	  return NULL;
+	  break;
 	}
     }
 
-  job_entry_p = (CSS_JOB_ENTRY *) css_remove_list_from_head (&css_Job_queue[jobq_index].job_list);
-
-  pthread_mutex_unlock (&css_Job_queue[jobq_index].job_lock);
-
   r = pthread_mutex_lock (&thrd->tran_index_lock);
 
   /* if job_entry_p == NULL, system will be shutdown soon. */
@@ -611,7 +948,7 @@ css_incr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 #if defined(HAVE_ATOMIC_BUILTINS)
   ATOMIC_INC_32 (&jobq->num_busy_workers, 1);
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       ATOMIC_INC_32 (&jobq->num_conn_workers, 1);
     }
@@ -620,13 +957,26 @@ css_incr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 
   jobq->num_busy_workers++;
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       jobq->num_conn_workers++;
     }
 
   (void) pthread_mutex_unlock (&jobq->counter_lock);
 #endif /* HAVE_ATOMIC_BUILTINS */
+
+  if (CSS_IS_CONNECTION_JOB (job_func))
+    {
+      css_add_job_queue_stat (jobq, &jobq->num_connection_jobs, 1);
+    }
+  else if (job_func == css_Request_handler)
+    {
+      css_add_job_queue_stat (jobq, &jobq->num_request_jobs, 1);
+    }
+  else
+    {
+      css_add_job_queue_stat (jobq, &jobq->num_other_jobs, 1);
+    }
 }
 
 /*
@@ -643,7 +993,7 @@ css_decr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 #if defined(HAVE_ATOMIC_BUILTINS)
   ATOMIC_INC_32 (&jobq->num_busy_workers, -1);
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       ATOMIC_INC_32 (&jobq->num_conn_workers, -1);
     }
@@ -652,7 +1002,7 @@ css_decr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 
   jobq->num_busy_workers--;
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       jobq->num_conn_workers--;
     }
@@ -690,6 +1040,7 @@ css_free_job_entry_func (void *data, void *dummy)
 static void
 css_empty_job_queue (void)
 {
+  CSS_JOB_ENTRY *job_entry_p;
   int rv;
   int i;
 
@@ -698,6 +1049,10 @@ css_empty_job_queue (void)
       rv = pthread_mutex_lock (&css_Job_queue[i].job_lock);
 
       css_traverse_list (&css_Job_queue[i].job_list, css_free_job_entry_func, NULL);
+      while (css_Job_queue[i].job_lfq != NULL && lf_circular_queue_consume (css_Job_queue[i].job_lfq, &job_entry_p))
+	{
+	  (void) css_free_job_entry_func (job_entry_p, NULL);
+	}
 
       pthread_mutex_unlock (&css_Job_queue[i].job_lock);
     }
@@ -720,6 +1075,15 @@ css_final_job_queue (void)
 
       css_traverse_list (&css_Job_queue[i].job_list, css_free_job_entry_func, NULL);
       css_finalize_list (&css_Job_queue[i].job_list);
+      if (css_Job_queue[i].job_lfq != NULL)
+	{
+	  while (lf_circular_queue_consume (css_Job_queue[i].job_lfq, &p))
+	    {
+	      free_and_init (p);
+	    }
+	  lf_circular_queue_destroy (css_Job_queue[i].job_lfq);
+	  css_Job_queue[i].job_lfq = NULL;
+	}
       while (css_Job_queue[i].free_list != NULL)
 	{
 	  p = css_Job_queue[i].free_list;
@@ -1614,6 +1978,450 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
   return 0;
 }
 
+#if defined(LINUX)
+/*
+ * css_start_connection_reactors () - start the connection reactors
+ *   return: void
+ *
+ * Note: Called from the master thread when the first client connects. Each
+ *       reactor occupies a worker thread for the lifetime of the server and
+ *       watches the sockets of its share of the client connections. If the
+ *       reactors can not be set up, connections fall back to the dedicated
+ *       connection handler threads.
+ */
+static void
+css_start_connection_reactors (void)
+{
+  CSS_JOB_ENTRY *job;
+  int num_reactors, i;
+
+  css_Reactors_started = true;
+
+  num_reactors = prm_get_integer_value (PRM_ID_CONNECTION_REACTOR_THREADS);
+  if (num_reactors <= 0)
+    {
+      return;
+    }
+
+  css_Reactors = (CSS_REACTOR *) malloc (num_reactors * sizeof (CSS_REACTOR));
+  if (css_Reactors == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, num_reactors * sizeof (CSS_REACTOR));
+      return;
+    }
+
+  for (i = 0; i < num_reactors; i++)
+    {
+      css_Reactors[i].index = i;
+      css_Reactors[i].epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+      if (css_Reactors[i].epoll_fd < 0)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_start_connection_reactors: epoll_create1() error %d\n", errno);
+	  break;
+	}
+
+      job = css_make_job_entry (NULL, css_connection_reactor_thread, (CSS_THREAD_ARG) (&css_Reactors[i]), i);
+      if (job == NULL)
+	{
+	  close (css_Reactors[i].epoll_fd);
+	  break;
+	}
+      css_add_to_job_queue (job);
+    }
+
+  /* the reactors that could be started keep running even if the others failed */
+  css_Num_reactors = i;
+}
+
+/*
+ * css_attach_conn_to_reactor () - let a reactor watch the socket of a new
+ *                                 client connection
+ *   return: NO_ERROR, or ER_FAILED if the connection has to get its own
+ *           connection handler thread
+ *   conn(in): new connection
+ */
+static int
+css_attach_conn_to_reactor (CSS_CONN_ENTRY * conn)
+{
+  struct epoll_event event;
+  int reactor_index;
+
+  if (css_Reactors_started == false)
+    {
+      css_start_connection_reactors ();
+    }
+
+  if (css_Num_reactors <= 0)
+    {
+      return ER_FAILED;
+    }
+
+  reactor_index = conn->idx % css_Num_reactors;
+
+  if (CHECK_CLIENT_IS_ALIVE ())
+    {
+      css_set_reactor_conn_keepalive (conn);
+    }
+
+  /* set before the socket is watched; the reactor owns the field from then on */
+  conn->reactor_index = reactor_index;
+
+  memset (&event, 0, sizeof (event));
+  event.events = EPOLLIN | EPOLLRDHUP;
+  event.data.ptr = conn;
+  if (epoll_ctl (css_Reactors[reactor_index].epoll_fd, EPOLL_CTL_ADD, conn->fd, &event) < 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_attach_conn_to_reactor: epoll_ctl() error %d\n", errno);
+      conn->reactor_index = -1;
+      return ER_FAILED;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * css_set_reactor_conn_keepalive () - have the client host probed when the
+ *                                     connection is idle
+ *   return: void
+ *   conn(in): new connection
+ *
+ * Note: Replaces the css_peer_alive() probe of the idle connection handler
+ *       thread, which would block the reactor. If the client host does not
+ *       answer, the socket gets an error and the reactor closes the
+ *       connection. Errors are ignored; Unix domain sockets do not support
+ *       the TCP options and their peer is always alive.
+ */
+static void
+css_set_reactor_conn_keepalive (CSS_CONN_ENTRY * conn)
+{
+  int value;
+
+  value = 1;
+  if (setsockopt (conn->fd, SOL_SOCKET, SO_KEEPALIVE, (const char *) &value, sizeof (value)) < 0)
+    {
+      return;
+    }
+
+  value = CSS_REACTOR_KEEPALIVE_SEC;
+  (void) setsockopt (conn->fd, IPPROTO_TCP, TCP_KEEPIDLE, (const char *) &value, sizeof (value));
+  (void) setsockopt (conn->fd, IPPROTO_TCP, TCP_KEEPINTVL, (const char *) &value, sizeof (value));
+
+  /* css_peer_alive() gives up after one probe */
+  value = 1;
+  (void) setsockopt (conn->fd, IPPROTO_TCP, TCP_KEEPCNT, (const char *) &value, sizeof (value));
+}
+
+/*
+ * css_detach_conn_from_reactor () - stop watching the socket of a connection
+ *   return: void
+ *   reactor(in): reactor watching the connection
+ *   conn(in): connection
+ *
+ * Note: The socket may already be closed, which removes it from the epoll
+ *       set by itself; the error of epoll_ctl() is ignored then.
+ */
+static void
+css_detach_conn_from_reactor (CSS_REACTOR * reactor, CSS_CONN_ENTRY * conn)
+{
+  struct epoll_event event;
+
+  assert (conn->reactor_index == reactor->index);
+
+  if (!IS_INVALID_SOCKET (conn->fd))
+    {
+      /* non-null event for kernels before 2.6.9 */
+      memset (&event, 0, sizeof (event));
+      (void) epoll_ctl (reactor->epoll_fd, EPOLL_CTL_DEL, conn->fd, &event);
+    }
+  conn->reactor_index = -1;
+}
+
+/*
+ * css_check_reactor_conn_status () - check the status of a connection
+ *                                    watched by a reactor
+ *   return: NO_ERRORS or CONNECTION_CLOSED
+ *   thread_p(in):
+ *   conn(in):
+ */
+static int
+css_check_reactor_conn_status (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
+{
+  volatile int conn_status;
+
+  conn_status = conn->status;
+  if (conn_status == CONN_CLOSING)
+    {
+      /* synchronize with a worker in sboot_notify_unregister_client; see css_connection_handler_thread */
+      rmutex_lock (thread_p, &conn->rmutex);
+
+      conn_status = conn->status;
+
+      rmutex_unlock (thread_p, &conn->rmutex);
+    }
+
+  if (conn_status != CONN_OPEN)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_check_reactor_conn_status: conn->status (%d) is not CONN_OPEN.",
+		    conn_status);
+      return CONNECTION_CLOSED;
+    }
+
+  return NO_ERRORS;
+}
+
+/*
+ * css_process_reactor_event () - handle an event on a connection socket
+ *   return: void
+ *   thread_p(in): reactor thread
+ *   reactor(in): reactor
+ *   conn(in): connection having the event
+ *   events(in): epoll events
+ *
+ * Note: Does the same as one iteration of css_connection_handler_thread once
+ *       poll() has reported the socket, except that it reads only the data
+ *       that is available, so that a slow client does not stall the other
+ *       connections of the reactor.
+ */
+static void
+css_process_reactor_event (THREAD_ENTRY * thread_p, CSS_REACTOR * reactor, CSS_CONN_ENTRY * conn,
+			   unsigned int events)
+{
+  CSS_JOB_ENTRY *job;
+  int status, num_commands;
+
+  if (conn->reactor_index != reactor->index)
+    {
+      /* detached while processing an earlier event of the same epoll_wait() */
+      return;
+    }
+
+  if (conn->stop_talk == true)
+    {
+      css_detach_conn_from_reactor (reactor, conn);
+      return;
+    }
+
+  status = css_check_reactor_conn_status (thread_p, conn);
+  if (status == NO_ERRORS && (events & (EPOLLERR | EPOLLHUP)))
+    {
+      status = ERROR_ON_READ;
+    }
+
+  if (status == NO_ERRORS && conn->client_type == BOOT_CLIENT_LOG_PREFETCHER && conn->recv_length == 0)
+    {
+      /* requests of the log prefetcher are throttled by sleeping in the connection handler, which must not stall
+       * the other connections of the reactor; give the connection its own handler thread. It is done between
+       * packets, since the handler reads the socket only. */
+      css_detach_conn_from_reactor (reactor, conn);
+
+      job = css_make_job_entry (conn, (CSS_THREAD_FN) css_connection_handler_thread, (CSS_THREAD_ARG) conn, -1);
+      if (job != NULL)
+	{
+	  css_add_to_job_queue (job);
+	  return;
+	}
+
+      status = CONNECTION_CLOSED;
+    }
+
+  if (status == NO_ERRORS)
+    {
+      /* read the data available on the socket, and enqueue the whole packets to appr. queue */
+      status = css_read_and_queue_nonblocking (conn, &num_commands);
+
+      /* if new command requests have arrived, make new jobs and add them to job queue */
+      for (; num_commands > 0; num_commands--)
+	{
+	  job = css_make_job_entry (conn, css_Request_handler, (CSS_THREAD_ARG) conn, -1);
+	  if (job)
+	    {
+	      css_add_to_job_queue (job);
+	    }
+	}
+
+      if (status == NO_ERRORS)
+	{
+	  return;
+	}
+
+      er_log_debug (ARG_FILE_LINE, "css_process_reactor_event: css_read_and_queue_nonblocking() error\n");
+      if (conn->stop_talk == true)
+	{
+	  css_detach_conn_from_reactor (reactor, conn);
+	  return;
+	}
+    }
+
+  css_close_reactor_conn (reactor, conn, status);
+}
+
+/*
+ * css_sweep_reactor_conns () - check the connections of a reactor that had
+ *                              no traffic
+ *   return: void
+ *   thread_p(in): reactor thread
+ *   reactor(in): reactor
+ *
+ * Note: Closed connections and the HA state are checked here as the idle
+ *       connection handler thread does every few seconds. A dead peer is
+ *       reported by EPOLLRDHUP/EPOLLHUP, or by an error of the socket once
+ *       the keepalive probes are not answered.
+ */
+static void
+css_sweep_reactor_conns (THREAD_ENTRY * thread_p, CSS_REACTOR * reactor)
+{
+  CSS_CONN_ENTRY *conn;
+  int status;
+  int r;
+
+  START_SHARED_ACCESS_ACTIVE_CONN_ANCHOR (r);
+
+  for (conn = css_Active_conn_anchor; conn != NULL; conn = conn->next)
+    {
+      if (conn->reactor_index != reactor->index)
+	{
+	  continue;
+	}
+
+      if (conn->stop_talk == true)
+	{
+	  css_detach_conn_from_reactor (reactor, conn);
+	  continue;
+	}
+
+      status = css_check_reactor_conn_status (thread_p, conn);
+
+      /* check server's HA state */
+      if (status == NO_ERRORS && ha_Server_state == HA_SERVER_STATE_TO_BE_STANDBY && conn->in_transaction == false
+	  && thread_has_threads (thread_p, conn->transaction_id, conn->client_id) == 0)
+	{
+	  status = REQUEST_REFUSED;
+	}
+
+      if (status != NO_ERRORS)
+	{
+	  css_close_reactor_conn (reactor, conn, status);
+	}
+    }
+
+  END_SHARED_ACCESS_ACTIVE_CONN_ANCHOR (r);
+}
+
+/*
+ * css_close_reactor_conn () - stop watching a broken connection and call the
+ *                             connection error handler for it
+ *   return: void
+ *   reactor(in): reactor
+ *   conn(in): connection
+ *   status(in): why the connection is closed
+ *
+ * Note: The error handler waits for the requests of the client to finish,
+ *       so it is run by a worker instead of the reactor.
+ */
+static void
+css_close_reactor_conn (CSS_REACTOR * reactor, CSS_CONN_ENTRY * conn, int status)
+{
+  CSS_JOB_ENTRY *job;
+
+  css_detach_conn_from_reactor (reactor, conn);
+
+  if (status == NO_ERRORS && css_check_conn (conn) == NO_ERROR)
+    {
+      return;
+    }
+
+  er_log_debug (ARG_FILE_LINE,
+		"css_close_reactor_conn: " "status %d conn { status %d transaction_id %d "
+		"db_error %d stop_talk %d stop_phase %d }\n", status, conn->status, conn->transaction_id,
+		conn->db_error, conn->stop_talk, conn->stop_phase);
+
+  job = css_make_job_entry (conn, css_connection_error_job, (CSS_THREAD_ARG) conn, -1);
+  assert (job != NULL);
+
+  if (job != NULL)
+    {
+      css_add_to_job_queue (job);
+    }
+}
+
+/*
+ * css_connection_error_job () - call the connection error handler
+ *   return: 0
+ *   thread_p(in): worker thread
+ *   arg(in): connection
+ *
+ * Note: The worker still holds tran_index_lock, which the error handler
+ *       releases.
+ */
+static int
+css_connection_error_job (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  (*css_Connection_error_handler) (thread_p, (CSS_CONN_ENTRY *) arg);
+
+  return 0;
+}
+
+/*
+ * css_connection_reactor_thread () - wait for the requests of many client
+ *                                    connections on one epoll set
+ *   return: 0
+ *   thread_p(in): worker thread
+ *   arg(in): reactor
+ *
+ * Note: Replaces one css_connection_handler_thread per client when
+ *       connection_reactor_threads is set.
+ */
+static int
+css_connection_reactor_thread (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  CSS_REACTOR *reactor = (CSS_REACTOR *) arg;
+  struct epoll_event events[CSS_REACTOR_MAX_EVENTS];
+  time_t last_sweep_time, now;
+  int n, i;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  pthread_mutex_unlock (&thread_p->tran_index_lock);
+
+  thread_p->type = TT_SERVER;	/* server thread */
+
+  last_sweep_time = time (NULL);
+
+  while (thread_p->shutdown == false)
+    {
+      n = epoll_wait (reactor->epoll_fd, events, CSS_REACTOR_MAX_EVENTS, CSS_REACTOR_WAIT_MSEC);
+      if (n < 0 && errno != EINTR)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_connection_reactor_thread: epoll_wait() error %d\n", errno);
+	}
+
+      for (i = 0; i < n; i++)
+	{
+	  css_process_reactor_event (thread_p, reactor, (CSS_CONN_ENTRY *) events[i].data.ptr, events[i].events);
+	}
+
+      now = time (NULL);
+      if (now - last_sweep_time >= CSS_REACTOR_SWEEP_SEC)
+	{
+	  css_sweep_reactor_conns (thread_p, reactor);
+	  last_sweep_time = now;
+	}
+    }
+
+  thread_p->type = TT_WORKER;
+
+  return 0;
+}
+#endif /* LINUX */
+
 #if defined(WINDOWS)
 /*
  * ctrl_sig_handler () -
@@ -1750,6 +2558,13 @@ css_internal_connection_handler (CSS_CONN_ENTRY * conn)
 
   css_insert_into_active_conn_list (conn);
 
+#if defined(LINUX)
+  if (prm_get_integer_value (PRM_ID_CONNECTION_REACTOR_THREADS) > 0 && css_attach_conn_to_reactor (conn) == NO_ERROR)
+    {
+      return 1;
+    }
+#endif /* LINUX */
+
   job = css_make_job_entry (conn, (CSS_THREAD_FN) css_connection_handler_thread, (CSS_THREAD_ARG) conn,
 			    -1 /* implicit: DEFAULT */ );
   assert (job != NULL);
@@ -2567,6 +3382,18 @@ css_wait_worker_thread_on_jobq (THREAD_ENTRY * thrd, int jobq_index)
   thrd->worker_thrd_list = css_Job_queue[jobq_index].worker_thrd_list;
   css_Job_queue[jobq_index].worker_thrd_list = thrd;
 
+  /* a job may have been queued after we last looked and before we became visible to css_add_to_job_queue */
+  MEMORY_BARRIER ();
+  if (css_has_queued_jobs ())
+    {
+      /* nobody else can change the list while we hold the job queue mutex */
+      assert (css_Job_queue[jobq_index].worker_thrd_list == thrd);
+      css_Job_queue[jobq_index].worker_thrd_list = thrd->worker_thrd_list;
+      thrd->worker_thrd_list = NULL;
+
+      return NO_ERROR;
+    }
+
   thrd->resume_status = THREAD_JOB_QUEUE_SUSPENDED;
 
   /* sleep on the thrd's condition variable with the mutex of the job queue */
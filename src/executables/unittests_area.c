@@ -45,9 +45,11 @@ struct area_create_info
 void *test_area_proc (void *param);
 void *test_area_proc_1 (void *param);
 void *test_area_proc_2 (void *param);
+void *test_area_proc_3 (void *param);
 
 /* print function */
 static struct timeval start_time;
+static long long int last_elapsed_msec = 0;
 
 static void
 begin (char *test_name)
@@ -79,6 +81,7 @@ success ()
   elapsed_msec += (end_time.tv_sec - start_time.tv_sec) * 1000;
 
   printf (" %s [%9.3f sec]\n", "OK", (float) elapsed_msec / 1000.0f);
+  last_elapsed_msec = elapsed_msec;
   return NO_ERROR;
 }
 
@@ -246,6 +249,43 @@ test_area_proc_2 (void *param)
 #undef NOPS
 }
 
+void *
+test_area_proc_3 (void *param)
+{
+#define NOPS	  1000000	/* 1M */
+#define NBURST    64
+
+  AREA *area_p = (AREA *) param;
+  void *entry[NBURST];
+  int idx, i, error;
+
+  /* allocate a burst of entries and free them, as a query does with its values */
+  for (i = 0; i < NOPS; i += 2 * NBURST)
+    {
+      for (idx = 0; idx < NBURST; idx++)
+	{
+	  entry[idx] = area_alloc (area_p);
+	  if (entry[idx] == NULL)
+	    {
+	      pthread_exit ((void *) ER_FAILED);
+	    }
+	}
+
+      for (idx = 0; idx < NBURST; idx++)
+	{
+	  error = area_free (area_p, entry[idx]);
+	  if (error != NO_ERROR)
+	    {
+	      pthread_exit ((void *) ER_FAILED);
+	    }
+	}
+    }
+
+  pthread_exit ((void *) NO_ERROR);
+
+#undef NBURST
+#undef NOPS
+}
 
 /* test functions */
 static int
@@ -434,6 +474,23 @@ main (int argc, char **argv)
       }
   }
 
+  /* scaling: every thread does the same number of operations */
+  {
+    AREA_CREATE_INFO scaling_info = { "Value containers", sizeof (DB_VALUE), 1024 };
+    double mops;
+
+    printf ("============================================================\n");
+    printf ("Test scaling of get/free entry in bursts of 64 (1M operations per thread):\n");
+    for (i = 1; i <= 64; i *= 2)
+      {
+	if (test_area (&scaling_info, i, test_area_proc_3) != NO_ERROR)
+	  {
+	    goto fail;
+	  }
+	mops = (double) i / (double) (last_elapsed_msec > 0 ? last_elapsed_msec : 1) * 1000.0;
+	printf ("  %2d threads: %9.3f M operations/sec\n", i, mops);
+      }
+  }
 
   /* all ok */
   return 0;
@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ * unittests_lock.c : unit tests and microbenchmark for the lock manager
+ */
+
+#include "porting.h"
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/time.h>
+#include <log_impl.h>
+#include "lock_manager.h"
+#include "lock_free.h"
+#include "thread.h"
+#include "oid.h"
+
+#define NOPS_INTENTION	  200000
+#define NOPS_CONFLICT	  200
+#define MAX_THREADS	  32
+#define MAX_CLASSES	  16
+
+static OID test_Root_oid = { 1, 0, 0 };
+static OID test_Class_oids[MAX_CLASSES];
+static THREAD_ENTRY *test_Thread_entries[MAX_THREADS + 1];
+
+/* parameters of current test */
+static int test_Num_classes;
+static LOCK test_Worker_lock;
+static volatile int test_Stop_workers;
+
+/* intention locks currently held on the first class; checked by the conflicting thread */
+static volatile INT32 test_Intention_holders;
+static volatile INT32 test_Violations;
+static volatile INT64 test_Count_ops;
+
+/* print function */
+static struct timeval start_time;
+
+static void
+begin (char *test_name)
+{
+#define MSG_LEN	  40
+  int i;
+
+  printf ("Testing %s", test_name);
+  for (i = 0; i < MSG_LEN - (int) strlen (test_name); i++)
+    {
+      putchar (' ');
+    }
+  printf ("...\n");
+
+  gettimeofday (&start_time, NULL);
+
+#undef MSG_LEN
+}
+
+static long long int
+elapsed_usec (void)
+{
+  struct timeval end_time;
+
+  gettimeofday (&end_time, NULL);
+  return (end_time.tv_sec - start_time.tv_sec) * 1000000LL + (end_time.tv_usec - start_time.tv_usec);
+}
+
+static int
+success ()
+{
+  printf (" %s [%9.3f sec]\n", "OK", (float) elapsed_usec () / 1000000.0f);
+  return NO_ERROR;
+}
+
+static int
+fail (const char *message)
+{
+  printf (" %s: %s\n", "FAILED", message);
+  return ER_FAILED;
+}
+
+/* fake transaction table and thread entries; the lock manager only needs isolation and wait time. Lock requests
+ * never wait, since suspending needs the page buffer; conflicting requests are retried instead. */
+static int
+lock_initialize_testing (void)
+{
+  LOG_TDES *tdes;
+  int num_trans = MAX_THREADS + 1;
+  int i;
+
+  oid_set_root (&test_Root_oid);
+  for (i = 0; i < MAX_CLASSES; i++)
+    {
+      test_Class_oids[i].volid = 0;
+      test_Class_oids[i].pageid = 100 + i;
+      test_Class_oids[i].slotid = 1;
+    }
+
+  log_Gl.trantable.all_tdes = (LOG_TDES **) malloc (num_trans * sizeof (LOG_TDES *));
+  tdes = (LOG_TDES *) malloc (num_trans * sizeof (LOG_TDES));
+  if (log_Gl.trantable.all_tdes == NULL || tdes == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (tdes, 0, num_trans * sizeof (LOG_TDES));
+  for (i = 0; i < num_trans; i++)
+    {
+      log_Gl.trantable.all_tdes[i] = &tdes[i];
+      tdes[i].tran_index = i;
+      tdes[i].trid = NULL_TRANID;
+      tdes[i].isolation = TRAN_REPEATABLE_READ;
+      tdes[i].wait_msecs = LK_FORCE_ZERO_WAIT;
+      XASL_ID_SET_NULL (&tdes[i].xasl_id);
+    }
+  log_Gl.trantable.num_total_indices = num_trans;
+
+  if (lf_initialize_transaction_systems (thread_num_total_threads ()) != NO_ERROR
+      || thread_initialize_manager () != NO_ERROR || lock_initialize () != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  /* transaction 0 is the system transaction */
+  for (i = 1; i <= MAX_THREADS; i++)
+    {
+      test_Thread_entries[i] = thread_find_entry_by_index (i);
+      if (test_Thread_entries[i] == NULL)
+	{
+	  return ER_FAILED;
+	}
+      test_Thread_entries[i]->tran_index = i;
+    }
+
+  return NO_ERROR;
+}
+
+/* take and release an intention lock on a class (and on the root class) in a loop */
+static THREAD_RET_T THREAD_CALLING_CONVENTION
+test_lock_intention_worker (void *param)
+{
+  THREAD_ENTRY *thread_p = (THREAD_ENTRY *) param;
+  OID *class_oid;
+  INT64 local_count_ops = 0;
+  int granted;
+  int i;
+
+  thread_set_thread_entry_info (thread_p);
+
+  for (i = 0; i < NOPS_INTENTION && !test_Stop_workers; i++)
+    {
+      class_oid = &test_Class_oids[(thread_p->tran_index + i) % test_Num_classes];
+
+      while ((granted = lock_object (thread_p, class_oid, oid_Root_class_oid, test_Worker_lock, LK_UNCOND_LOCK))
+	     != LK_GRANTED)
+	{
+	  if (granted != LK_NOTGRANTED_DUE_TIMEOUT)
+	    {
+	      return (THREAD_RET_T) 1;
+	    }
+	  lock_remove_object_lock (thread_p, oid_Root_class_oid, oid_Root_class_oid, test_Worker_lock);
+	}
+      if (class_oid == &test_Class_oids[0])
+	{
+	  /* count the holder for the whole time the lock is held */
+	  ATOMIC_INC_32 (&test_Intention_holders, 1);
+	  sched_yield ();
+	  ATOMIC_INC_32 (&test_Intention_holders, -1);
+	}
+
+      lock_remove_object_lock (thread_p, class_oid, oid_Root_class_oid, test_Worker_lock);
+      lock_remove_object_lock (thread_p, oid_Root_class_oid, oid_Root_class_oid, test_Worker_lock);
+      local_count_ops++;
+    }
+
+  ATOMIC_INC_64 (&test_Count_ops, local_count_ops);
+  return (THREAD_RET_T) 0;
+}
+
+/* take a shared lock on the first class and check no intention exclusive lock is held meanwhile */
+static THREAD_RET_T THREAD_CALLING_CONVENTION
+test_lock_conflict_worker (void *param)
+{
+  THREAD_ENTRY *thread_p = (THREAD_ENTRY *) param;
+  int granted;
+  int i;
+
+  thread_set_thread_entry_info (thread_p);
+
+  for (i = 0; i < NOPS_CONFLICT; i++)
+    {
+      while ((granted = lock_object (thread_p, &test_Class_oids[0], oid_Root_class_oid, S_LOCK, LK_UNCOND_LOCK))
+	     != LK_GRANTED)
+	{
+	  if (granted != LK_NOTGRANTED_DUE_TIMEOUT)
+	    {
+	      test_Stop_workers = 1;
+	      return (THREAD_RET_T) 1;
+	    }
+	  lock_remove_object_lock (thread_p, oid_Root_class_oid, oid_Root_class_oid, IS_LOCK);
+	}
+      if (test_Intention_holders != 0)
+	{
+	  ATOMIC_INC_32 (&test_Violations, 1);
+	}
+      sched_yield ();
+      if (test_Intention_holders != 0)
+	{
+	  ATOMIC_INC_32 (&test_Violations, 1);
+	}
+      lock_remove_object_lock (thread_p, &test_Class_oids[0], oid_Root_class_oid, S_LOCK);
+      lock_remove_object_lock (thread_p, oid_Root_class_oid, oid_Root_class_oid, IS_LOCK);
+    }
+
+  return (THREAD_RET_T) 0;
+}
+
+static int
+test_lock_intention (int num_workers, int num_classes, LOCK lock, bool with_conflict)
+{
+  pthread_t threads[MAX_THREADS];
+  int numthreads = num_workers + (with_conflict ? 1 : 0);
+  long long int usec;
+  char msg[256];
+  int i;
+
+  sprintf (msg, "%s locks (%d threads, %d classes%s)", lock == IS_LOCK ? "IS" : "IX", num_workers, num_classes,
+	   with_conflict ? ", S lock conflicts" : "");
+  begin (msg);
+
+  if (numthreads > MAX_THREADS || num_classes > MAX_CLASSES)
+    {
+      return fail ("too many threads or classes");
+    }
+
+  test_Num_classes = num_classes;
+  test_Worker_lock = lock;
+  test_Stop_workers = 0;
+  test_Intention_holders = 0;
+  test_Violations = 0;
+  test_Count_ops = 0;
+
+  for (i = 0; i < numthreads; i++)
+    {
+      if (pthread_create (&threads[i], NULL,
+			  (with_conflict && i == num_workers) ? test_lock_conflict_worker : test_lock_intention_worker,
+			  (void *) test_Thread_entries[i + 1]) != NO_ERROR)
+	{
+	  return fail ("thread create error");
+	}
+    }
+
+  for (i = 0; i < numthreads; i++)
+    {
+      void *retval;
+
+      pthread_join (threads[i], &retval);
+      if (retval != NO_ERROR)
+	{
+	  return fail ("lock not granted");
+	}
+    }
+
+  if (test_Violations != 0)
+    {
+      return fail ("shared lock granted while intention exclusive locks were held");
+    }
+  if (test_Count_ops != (INT64) num_workers * NOPS_INTENTION)
+    {
+      return fail ("operation count mismatch");
+    }
+  /* each lock free transaction entry may keep one claimed resource for its next insert */
+  if (lock_get_number_object_locks () > MAX_THREADS)
+    {
+      return fail ("locks left in the lock table");
+    }
+
+  usec = elapsed_usec ();
+  printf (" %.3f usec per lock and unlock per thread\n", (double) usec / NOPS_INTENTION);
+
+  return success ();
+}
+
+/* program entry */
+int
+main (int argc, char **argv)
+{
+  int num_threads;
+
+  if (lock_initialize_testing () != NO_ERROR)
+    {
+      printf ("Unit tests failed to initialize!\n");
+      return ER_FAILED;
+    }
+
+  for (num_threads = 1; num_threads <= 16; num_threads *= 2)
+    {
+      if (test_lock_intention (num_threads, 1, IS_LOCK, false) != NO_ERROR
+	  || test_lock_intention (num_threads, 1, IX_LOCK, false) != NO_ERROR
+	  || test_lock_intention (num_threads, 8, IX_LOCK, false) != NO_ERROR)
+	{
+	  goto fail;
+	}
+    }
+
+  for (num_threads = 1; num_threads <= 16; num_threads *= 2)
+    {
+      if (test_lock_intention (num_threads, 1, IX_LOCK, true) != NO_ERROR)
+	{
+	  goto fail;
+	}
+    }
+
+  lock_finalize ();
+  return 0;
+
+fail:
+  printf ("Unit tests failed!\n");
+  return ER_FAILED;
+}
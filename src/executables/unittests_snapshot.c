@@ -124,6 +124,7 @@ logtb_initialize_mvcctable (void)
   current_trans_status->long_tran_mvccids_length = 0;
   current_trans_status->version = 0;
   current_trans_status->lowest_active_mvccid = MVCCID_FIRST;
+  current_trans_status->highest_completed_mvccid = MVCCID_FIRST - 1;
 
   mvcc_table->transaction_lowest_active_mvccids = (MVCCID *) malloc (size);
   if (mvcc_table->transaction_lowest_active_mvccids == NULL)
@@ -175,6 +176,7 @@ logtb_initialize_mvcctable (void)
       trans_status_history->long_tran_mvccids_length = 0;
       trans_status_history->version = 0;
       trans_status_history->lowest_active_mvccid = MVCCID_FIRST;
+      trans_status_history->highest_completed_mvccid = MVCCID_FIRST - 1;
     }
   mvcc_table->trans_status_history_position = 0;
 
@@ -664,6 +666,33 @@ test_mvcc_operations (int num_snapshot_threads, int num_complete_threads, int nu
   return NO_ERROR;
 }
 
+/* measure snapshot cost when the number of snapshot threads grows, with or without concurrent committers */
+static int
+test_mvcc_snapshot_scaling (int num_complete_threads, THREAD_ENTRY * thread_array)
+{
+#define MAX_SCALING_SNAPSHOT_THREADS 16
+  int num_snapshot_threads;
+  struct timeval begin_time, end_time;
+  long long int elapsed_usec;
+
+  for (num_snapshot_threads = 1; num_snapshot_threads <= MAX_SCALING_SNAPSHOT_THREADS; num_snapshot_threads *= 2)
+    {
+      gettimeofday (&begin_time, NULL);
+      if (test_mvcc_operations (num_snapshot_threads, num_complete_threads, 0, thread_array) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+      gettimeofday (&end_time, NULL);
+
+      elapsed_usec = (end_time.tv_sec - begin_time.tv_sec) * 1000000LL + (end_time.tv_usec - begin_time.tv_usec);
+      printf (" %d snapshot threads, %d complete threads: %.3f usec per snapshot per thread\n", num_snapshot_threads,
+	      num_complete_threads, (double) elapsed_usec / NOPS_SNAPSHOT);
+    }
+
+  return NO_ERROR;
+#undef MAX_SCALING_SNAPSHOT_THREADS
+}
+
 /* program entry */
 int
 main (int argc, char **argv)
@@ -677,6 +706,12 @@ main (int argc, char **argv)
 
   logtb_initialize_mvcc_testing (100, &thread_array);
 
+  if (test_mvcc_snapshot_scaling (0, thread_array) != NO_ERROR
+      || test_mvcc_snapshot_scaling (4, thread_array) != NO_ERROR)
+    {
+      goto fail;
+    }
+
   for (num_oldest_threads = 1; num_oldest_threads <= MAX_OLDEST_THREADS; num_oldest_threads++)
     {
       for (num_complete_threads = 1; num_complete_threads <= MAX_COMPLETE_THREADS; num_complete_threads++)
@@ -185,16 +185,16 @@ typedef unsigned char yybool;
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  6
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   27512
+#define YYLAST   27524
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  579
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  763
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  1913
+#define YYNRULES  1915
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  3281
+#define YYNSTATES  3283
 /* YYMAXRHS -- Maximum number of symbols on right-hand side of rule.  */
 #define YYMAXRHS 17
 /* YYMAXLEFT -- Maximum number of symbols to the left of a handle
@@ -346,151 +346,151 @@ static const unsigned short int yyprhs[] = {
   1409, 1417, 1425, 1428, 1432, 1436, 1439, 1444, 1449, 1454,
   1459, 1464, 1468, 1473, 1478, 1482, 1485, 1488, 1493, 1498,
   1503, 1507, 1512, 1519, 1522, 1526, 1529, 1532, 1535, 1537,
-  1540, 1543, 1546, 1548, 1551, 1553, 1556, 1559, 1561, 1564,
-  1567, 1570, 1572, 1575, 1579, 1582, 1586, 1589, 1593, 1597,
-  1601, 1604, 1608, 1612, 1615, 1618, 1620, 1622, 1624, 1626,
-  1628, 1632, 1636, 1637, 1640, 1644, 1646, 1648, 1650, 1652,
-  1653, 1655, 1657, 1659, 1660, 1663, 1668, 1670, 1672, 1674,
-  1676, 1678, 1680, 1681, 1685, 1686, 1696, 1702, 1703, 1704,
-  1705, 1710, 1715, 1716, 1719, 1721, 1725, 1727, 1731, 1735,
-  1739, 1743, 1747, 1749, 1751, 1755, 1759, 1761, 1765, 1770,
-  1773, 1775, 1776, 1784, 1785, 1796, 1798, 1800, 1803, 1806,
-  1815, 1824, 1825, 1829, 1832, 1836, 1840, 1841, 1842, 1847,
-  1848, 1849, 1854, 1858, 1862, 1863, 1867, 1868, 1869, 1874,
-  1875, 1876, 1881, 1882, 1883, 1888, 1892, 1894, 1896, 1898,
-  1900, 1902, 1907, 1909, 1911, 1913, 1915, 1917, 1919, 1922,
-  1924, 1925, 1926, 1927, 1932, 1933, 1934, 1935, 1940, 1941,
-  1942, 1943, 1948, 1952, 1953, 1957, 1958, 1961, 1962, 1965,
-  1966, 1968, 1969, 1971, 1972, 1974, 1975, 1977, 1979, 1981,
-  1983, 1985, 1986, 1989, 1990, 1994, 1995, 1998, 1999, 2003,
-  2004, 2007, 2008, 2013, 2018, 2022, 2026, 2028, 2032, 2035,
-  2042, 2047, 2051, 2054, 2056, 2058, 2062, 2064, 2066, 2068,
-  2069, 2072, 2077, 2078, 2081, 2082, 2085, 2087, 2089, 2091,
-  2092, 2094, 2098, 2100, 2107, 2112, 2123, 2127, 2129, 2132,
-  2133, 2135, 2137, 2138, 2142, 2143, 2145, 2150, 2156, 2161,
-  2167, 2173, 2178, 2184, 2188, 2193, 2197, 2202, 2207, 2211,
-  2216, 2221, 2224, 2226, 2229, 2232, 2236, 2238, 2244, 2245,
-  2249, 2252, 2256, 2258, 2261, 2262, 2264, 2265, 2268, 2272,
-  2274, 2276, 2277, 2278, 2279, 2287, 2291, 2293, 2294, 2295,
-  2300, 2302, 2306, 2308, 2310, 2313, 2317, 2321, 2325, 2327,
-  2329, 2331, 2333, 2338, 2344, 2345, 2351, 2352, 2354, 2357,
-  2358, 2360, 2363, 2365, 2367, 2369, 2371, 2373, 2375, 2377,
-  2379, 2381, 2386, 2391, 2395, 2400, 2407, 2415, 2417, 2419,
-  2420, 2422, 2424, 2425, 2427, 2428, 2431, 2438, 2440, 2443,
-  2446, 2449, 2453, 2455, 2461, 2465, 2469, 2471, 2474, 2476,
-  2479, 2481, 2484, 2487, 2493, 2499, 2501, 2503, 2506, 2509,
-  2511, 2513, 2515, 2517, 2519, 2521, 2526, 2529, 2535, 2538,
-  2541, 2542, 2544, 2545, 2547, 2548, 2550, 2554, 2559, 2563,
-  2564, 2565, 2566, 2571, 2572, 2574, 2577, 2580, 2581, 2583,
-  2586, 2587, 2590, 2592, 2594, 2596, 2597, 2599, 2601, 2603,
-  2606, 2608, 2611, 2613, 2616, 2618, 2621, 2623, 2625, 2631,
-  2634, 2636, 2638, 2640, 2643, 2646, 2648, 2650, 2652, 2654,
-  2656, 2658, 2660, 2663, 2665, 2667, 2671, 2672, 2674, 2676,
-  2678, 2680, 2682, 2684, 2686, 2688, 2690, 2694, 2698, 2701,
-  2703, 2706, 2708, 2710, 2712, 2715, 2717, 2720, 2723, 2725,
-  2726, 2728, 2729, 2731, 2733, 2734, 2736, 2738, 2739, 2741,
-  2745, 2747, 2752, 2757, 2759, 2762, 2763, 2766, 2767, 2768,
-  2769, 2777, 2778, 2779, 2780, 2788, 2791, 2792, 2793, 2794,
-  2804, 2806, 2807, 2808, 2809, 2819, 2821, 2824, 2827, 2830,
-  2833, 2836, 2838, 2840, 2842, 2844, 2846, 2847, 2851, 2855,
-  2857, 2861, 2862, 2863, 2872, 2873, 2877, 2878, 2880, 2884,
-  2886, 2891, 2895, 2897, 2898, 2899, 2910, 2911, 2914, 2917,
-  2918, 2920, 2923, 2926, 2929, 2931, 2933, 2935, 2936, 2938,
-  2940, 2942, 2944, 2948, 2950, 2951, 2954, 2958, 2960, 2963,
-  2966, 2968, 2972, 2974, 2978, 2980, 2982, 2984, 2986, 2988,
-  2990, 2993, 2995, 2997, 3000, 3002, 3005, 3008, 3009, 3010,
-  3014, 3015, 3018, 3021, 3023, 3024, 3029, 3030, 3036, 3037,
-  3039, 3040, 3044, 3045, 3048, 3052, 3054, 3055, 3059, 3060,
-  3061, 3065, 3066, 3070, 3074, 3080, 3084, 3086, 3090, 3092,
-  3096, 3102, 3104, 3107, 3110, 3112, 3116, 3117, 3122, 3127,
-  3128, 3131, 3136, 3140, 3142, 3144, 3148, 3150, 3152, 3153,
-  3154, 3160, 3161, 3162, 3163, 3171, 3172, 3174, 3178, 3182,
-  3184, 3188, 3192, 3194, 3196, 3198, 3202, 3203, 3206, 3208,
-  3212, 3216, 3217, 3220, 3221, 3224, 3228, 3230, 3234, 3238,
-  3241, 3242, 3245, 3248, 3250, 3252, 3254, 3256, 3260, 3262,
-  3266, 3268, 3272, 3274, 3278, 3282, 3284, 3288, 3292, 3294,
-  3298, 3302, 3306, 3310, 3312, 3316, 3318, 3320, 3323, 3326,
-  3329, 3330, 3334, 3335, 3339, 3342, 3344, 3346, 3348, 3350,
-  3352, 3354, 3356, 3360, 3364, 3366, 3368, 3369, 3373, 3375,
-  3377, 3379, 3381, 3386, 3396, 3402, 3413, 3419, 3430, 3436,
-  3442, 3453, 3464, 3475, 3489, 3499, 3511, 3525, 3534, 3535,
-  3536, 3546, 3554, 3567, 3568, 3569, 3576, 3581, 3588, 3589,
-  3590, 3601, 3602, 3603, 3612, 3613, 3614, 3625, 3626, 3627,
-  3636, 3637, 3638, 3645, 3646, 3647, 3654, 3655, 3656, 3665,
-  3666, 3667, 3678, 3679, 3680, 3689, 3690, 3691, 3702, 3703,
-  3704, 3711, 3712, 3713, 3722, 3723, 3724, 3731, 3732, 3733,
-  3740, 3741, 3742, 3749, 3750, 3751, 3758, 3759, 3760, 3767,
-  3768, 3769, 3776, 3777, 3778, 3784, 3785, 3786, 3792, 3793,
-  3794, 3804, 3805, 3806, 3815, 3816, 3817, 3826, 3827, 3828,
-  3835, 3836, 3837, 3845, 3846, 3847, 3855, 3856, 3857, 3866,
-  3871, 3873, 3875, 3877, 3879, 3881, 3883, 3885, 3887, 3889,
-  3891, 3893, 3894, 3895, 3901, 3902, 3903, 3910, 3912, 3914,
-  3915, 3916, 3925, 3926, 3927, 3934, 3935, 3936, 3943, 3944,
-  3945, 3952, 3953, 3954, 3961, 3962, 3963, 3970, 3971, 3972,
-  3979, 3980, 3981, 3990, 3991, 3992, 4003, 4004, 4005, 4014,
-  4015, 4016, 4023, 4024, 4025, 4034, 4035, 4036, 4045, 4046,
-  4047, 4056, 4057, 4058, 4067, 4068, 4069, 4080, 4081, 4082,
-  4093, 4094, 4095, 4104, 4105, 4106, 4115, 4116, 4117, 4126,
-  4127, 4128, 4135, 4136, 4137, 4144, 4156, 4157, 4158, 4169,
-  4171, 4173, 4175, 4176, 4181, 4183, 4184, 4189, 4191, 4192,
-  4197, 4199, 4200, 4205, 4207, 4208, 4213, 4215, 4216, 4221,
-  4223, 4224, 4229, 4231, 4232, 4237, 4239, 4241, 4243, 4245,
-  4247, 4249, 4251, 4253, 4255, 4257, 4259, 4261, 4263, 4265,
-  4267, 4269, 4271, 4273, 4275, 4277, 4279, 4281, 4283, 4285,
-  4287, 4289, 4291, 4293, 4295, 4297, 4299, 4301, 4303, 4305,
-  4307, 4309, 4311, 4313, 4315, 4317, 4319, 4321, 4323, 4324,
-  4327, 4330, 4331, 4335, 4336, 4339, 4342, 4343, 4346, 4349,
-  4350, 4354, 4355, 4360, 4361, 4365, 4367, 4369, 4371, 4378,
-  4383, 4389, 4394, 4395, 4398, 4401, 4403, 4408, 4411, 4413,
-  4418, 4425, 4427, 4429, 4431, 4433, 4435, 4437, 4439, 4441,
-  4443, 4445, 4447, 4449, 4451, 4453, 4455, 4457, 4459, 4461,
-  4463, 4465, 4467, 4469, 4471, 4473, 4474, 4477, 4483, 4485,
-  4486, 4488, 4491, 4494, 4497, 4500, 4504, 4506, 4510, 4512,
-  4516, 4518, 4521, 4523, 4527, 4529, 4532, 4535, 4537, 4540,
-  4542, 4543, 4547, 4551, 4557, 4561, 4565, 4568, 4572, 4578,
-  4582, 4588, 4591, 4594, 4595, 4597, 4600, 4603, 4606, 4609,
-  4612, 4615, 4619, 4623, 4626, 4627, 4629, 4631, 4633, 4636,
-  4638, 4640, 4643, 4646, 4650, 4652, 4654, 4658, 4661, 4664,
-  4666, 4668, 4671, 4673, 4677, 4679, 4683, 4687, 4691, 4695,
-  4698, 4702, 4706, 4710, 4714, 4716, 4718, 4720, 4722, 4724,
-  4726, 4730, 4734, 4738, 4742, 4746, 4748, 4752, 4754, 4756,
-  4759, 4761, 4763, 4765, 4770, 4772, 4774, 4776, 4780, 4782,
-  4783, 4785, 4787, 4789, 4791, 4794, 4796, 4798, 4806, 4809,
-  4814, 4818, 4821, 4823, 4825, 4828, 4830, 4834, 4836, 4839,
-  4841, 4845, 4848, 4851, 4852, 4854, 4857, 4859, 4861, 4864,
-  4866, 4868, 4870, 4872, 4874, 4879, 4881, 4887, 4889, 4891,
-  4896, 4898, 4904, 4906, 4908, 4910, 4914, 4917, 4920, 4923,
-  4928, 4931, 4934, 4941, 4942, 4944, 4946, 4947, 4949, 4950,
-  4954, 4955, 4959, 4960, 4964, 4970, 4972, 4974, 4975, 4977,
-  4980, 4983, 4986, 4990, 4991, 4993, 4994, 4996, 4997, 5000,
-  5002, 5003, 5005, 5008, 5011, 5014, 5015, 5018, 5021, 5024,
-  5026, 5028, 5030, 5033, 5034, 5036, 5038, 5041, 5044, 5047,
-  5049, 5051, 5053, 5055, 5057, 5059, 5061, 5063, 5065, 5067,
-  5069, 5071, 5073, 5075, 5077, 5079, 5084, 5088, 5089, 5091,
-  5093, 5095, 5097, 5099, 5103, 5105, 5106, 5110, 5114, 5116,
-  5118, 5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136,
-  5138, 5140, 5142, 5144, 5146, 5148, 5150, 5152, 5154, 5156,
-  5158, 5160, 5162, 5164, 5166, 5168, 5170, 5172, 5174, 5176,
-  5178, 5180, 5182, 5184, 5186, 5188, 5190, 5192, 5194, 5196,
-  5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214, 5216,
-  5218, 5220, 5222, 5224, 5226, 5228, 5230, 5232, 5234, 5236,
-  5238, 5240, 5242, 5244, 5246, 5248, 5250, 5252, 5254, 5256,
-  5258, 5260, 5262, 5264, 5266, 5268, 5270, 5272, 5274, 5276,
-  5278, 5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294, 5296,
-  5298, 5300, 5302, 5304, 5306, 5308, 5310, 5312, 5314, 5316,
-  5318, 5320, 5322, 5324, 5326, 5328, 5330, 5332, 5334, 5336,
-  5338, 5340, 5342, 5344, 5346, 5348, 5350, 5352, 5354, 5356,
-  5358, 5360, 5362, 5364, 5366, 5368, 5370, 5372, 5374, 5376,
-  5378, 5380, 5382, 5384, 5386, 5388, 5390, 5392, 5394, 5396,
-  5398, 5400, 5403, 5405, 5407, 5409, 5411, 5413, 5415, 5417,
-  5420, 5422, 5424, 5426, 5428, 5430, 5432, 5435, 5438, 5441,
+  1540, 1543, 1546, 1548, 1551, 1554, 1556, 1559, 1562, 1564,
+  1567, 1570, 1573, 1575, 1578, 1581, 1585, 1588, 1592, 1595,
+  1599, 1603, 1607, 1610, 1614, 1618, 1621, 1624, 1626, 1628,
+  1630, 1632, 1634, 1638, 1642, 1643, 1646, 1650, 1652, 1654,
+  1656, 1658, 1659, 1661, 1663, 1665, 1666, 1669, 1674, 1676,
+  1678, 1680, 1682, 1684, 1686, 1687, 1691, 1692, 1702, 1708,
+  1709, 1710, 1711, 1716, 1721, 1722, 1725, 1727, 1731, 1733,
+  1737, 1741, 1745, 1749, 1753, 1755, 1757, 1761, 1765, 1767,
+  1771, 1776, 1779, 1781, 1782, 1790, 1791, 1802, 1804, 1806,
+  1809, 1812, 1821, 1830, 1831, 1835, 1838, 1842, 1846, 1847,
+  1848, 1853, 1854, 1855, 1860, 1864, 1868, 1869, 1873, 1874,
+  1875, 1880, 1881, 1882, 1887, 1888, 1889, 1894, 1898, 1900,
+  1902, 1904, 1906, 1908, 1913, 1915, 1917, 1919, 1921, 1923,
+  1925, 1928, 1930, 1931, 1932, 1933, 1938, 1939, 1940, 1941,
+  1946, 1947, 1948, 1949, 1954, 1958, 1959, 1963, 1964, 1967,
+  1968, 1971, 1972, 1974, 1975, 1977, 1978, 1980, 1981, 1983,
+  1985, 1987, 1989, 1991, 1992, 1995, 1996, 2000, 2001, 2004,
+  2005, 2009, 2010, 2013, 2014, 2019, 2024, 2028, 2032, 2034,
+  2038, 2041, 2048, 2053, 2057, 2060, 2062, 2064, 2068, 2070,
+  2072, 2074, 2075, 2078, 2083, 2084, 2087, 2088, 2091, 2093,
+  2095, 2097, 2098, 2100, 2104, 2106, 2113, 2118, 2129, 2133,
+  2135, 2138, 2139, 2141, 2143, 2144, 2148, 2149, 2151, 2156,
+  2162, 2167, 2173, 2179, 2184, 2190, 2194, 2199, 2203, 2208,
+  2213, 2217, 2222, 2227, 2230, 2232, 2235, 2238, 2242, 2244,
+  2250, 2251, 2255, 2258, 2262, 2264, 2267, 2268, 2270, 2271,
+  2274, 2278, 2280, 2282, 2283, 2284, 2285, 2293, 2297, 2299,
+  2300, 2301, 2306, 2308, 2312, 2314, 2316, 2319, 2323, 2327,
+  2331, 2333, 2335, 2337, 2339, 2344, 2350, 2351, 2357, 2358,
+  2360, 2363, 2364, 2366, 2369, 2371, 2373, 2375, 2377, 2379,
+  2381, 2383, 2385, 2387, 2392, 2397, 2401, 2406, 2413, 2421,
+  2423, 2425, 2426, 2428, 2430, 2431, 2433, 2434, 2437, 2444,
+  2446, 2449, 2452, 2455, 2459, 2461, 2467, 2471, 2475, 2477,
+  2480, 2482, 2485, 2487, 2490, 2493, 2499, 2505, 2507, 2509,
+  2512, 2515, 2517, 2519, 2521, 2523, 2525, 2527, 2532, 2535,
+  2541, 2544, 2547, 2548, 2550, 2551, 2553, 2554, 2556, 2560,
+  2565, 2569, 2570, 2571, 2572, 2577, 2578, 2580, 2583, 2586,
+  2587, 2589, 2592, 2593, 2596, 2598, 2600, 2602, 2603, 2605,
+  2607, 2609, 2612, 2614, 2617, 2619, 2622, 2624, 2627, 2629,
+  2631, 2637, 2640, 2642, 2644, 2646, 2649, 2652, 2654, 2656,
+  2658, 2660, 2662, 2664, 2666, 2669, 2671, 2673, 2677, 2678,
+  2680, 2682, 2684, 2686, 2688, 2690, 2692, 2694, 2696, 2700,
+  2704, 2707, 2709, 2712, 2714, 2716, 2718, 2721, 2723, 2726,
+  2729, 2731, 2732, 2734, 2735, 2737, 2739, 2740, 2742, 2744,
+  2745, 2747, 2751, 2753, 2758, 2763, 2765, 2768, 2769, 2772,
+  2773, 2774, 2775, 2783, 2784, 2785, 2786, 2794, 2797, 2798,
+  2799, 2800, 2810, 2812, 2813, 2814, 2815, 2825, 2827, 2830,
+  2833, 2836, 2839, 2842, 2844, 2846, 2848, 2850, 2852, 2853,
+  2857, 2861, 2863, 2867, 2868, 2869, 2878, 2879, 2883, 2884,
+  2886, 2890, 2892, 2897, 2901, 2903, 2904, 2905, 2916, 2917,
+  2920, 2923, 2924, 2926, 2929, 2932, 2935, 2937, 2939, 2941,
+  2942, 2944, 2946, 2948, 2950, 2954, 2956, 2957, 2960, 2964,
+  2966, 2969, 2972, 2974, 2978, 2980, 2984, 2986, 2988, 2990,
+  2992, 2994, 2996, 2999, 3001, 3003, 3006, 3008, 3011, 3014,
+  3015, 3016, 3020, 3021, 3024, 3027, 3029, 3030, 3035, 3036,
+  3042, 3043, 3045, 3046, 3050, 3051, 3054, 3058, 3060, 3061,
+  3065, 3066, 3067, 3071, 3072, 3076, 3080, 3086, 3090, 3092,
+  3096, 3098, 3102, 3108, 3110, 3113, 3116, 3118, 3122, 3123,
+  3128, 3133, 3134, 3137, 3142, 3146, 3148, 3150, 3154, 3156,
+  3158, 3159, 3160, 3166, 3167, 3168, 3169, 3177, 3178, 3180,
+  3184, 3188, 3190, 3194, 3198, 3200, 3202, 3204, 3208, 3209,
+  3212, 3214, 3218, 3222, 3223, 3226, 3227, 3230, 3234, 3236,
+  3240, 3244, 3247, 3248, 3251, 3254, 3256, 3258, 3260, 3262,
+  3266, 3268, 3272, 3274, 3278, 3280, 3284, 3288, 3290, 3294,
+  3298, 3300, 3304, 3308, 3312, 3316, 3318, 3322, 3324, 3326,
+  3329, 3332, 3335, 3336, 3340, 3341, 3345, 3348, 3350, 3352,
+  3354, 3356, 3358, 3360, 3362, 3366, 3370, 3372, 3374, 3375,
+  3379, 3381, 3383, 3385, 3387, 3392, 3402, 3408, 3419, 3425,
+  3436, 3442, 3448, 3459, 3470, 3481, 3495, 3505, 3517, 3531,
+  3540, 3541, 3542, 3552, 3560, 3573, 3574, 3575, 3582, 3587,
+  3594, 3595, 3596, 3607, 3608, 3609, 3618, 3619, 3620, 3631,
+  3632, 3633, 3642, 3643, 3644, 3651, 3652, 3653, 3660, 3661,
+  3662, 3671, 3672, 3673, 3684, 3685, 3686, 3695, 3696, 3697,
+  3708, 3709, 3710, 3717, 3718, 3719, 3728, 3729, 3730, 3737,
+  3738, 3739, 3746, 3747, 3748, 3755, 3756, 3757, 3764, 3765,
+  3766, 3773, 3774, 3775, 3782, 3783, 3784, 3790, 3791, 3792,
+  3798, 3799, 3800, 3810, 3811, 3812, 3821, 3822, 3823, 3832,
+  3833, 3834, 3841, 3842, 3843, 3851, 3852, 3853, 3861, 3862,
+  3863, 3872, 3877, 3879, 3881, 3883, 3885, 3887, 3889, 3891,
+  3893, 3895, 3897, 3899, 3900, 3901, 3907, 3908, 3909, 3916,
+  3918, 3920, 3921, 3922, 3931, 3932, 3933, 3940, 3941, 3942,
+  3949, 3950, 3951, 3958, 3959, 3960, 3967, 3968, 3969, 3976,
+  3977, 3978, 3985, 3986, 3987, 3996, 3997, 3998, 4009, 4010,
+  4011, 4020, 4021, 4022, 4029, 4030, 4031, 4040, 4041, 4042,
+  4051, 4052, 4053, 4062, 4063, 4064, 4073, 4074, 4075, 4086,
+  4087, 4088, 4099, 4100, 4101, 4110, 4111, 4112, 4121, 4122,
+  4123, 4132, 4133, 4134, 4141, 4142, 4143, 4150, 4162, 4163,
+  4164, 4175, 4177, 4179, 4181, 4182, 4187, 4189, 4190, 4195,
+  4197, 4198, 4203, 4205, 4206, 4211, 4213, 4214, 4219, 4221,
+  4222, 4227, 4229, 4230, 4235, 4237, 4238, 4243, 4245, 4247,
+  4249, 4251, 4253, 4255, 4257, 4259, 4261, 4263, 4265, 4267,
+  4269, 4271, 4273, 4275, 4277, 4279, 4281, 4283, 4285, 4287,
+  4289, 4291, 4293, 4295, 4297, 4299, 4301, 4303, 4305, 4307,
+  4309, 4311, 4313, 4315, 4317, 4319, 4321, 4323, 4325, 4327,
+  4329, 4330, 4333, 4336, 4337, 4341, 4342, 4345, 4348, 4349,
+  4352, 4355, 4356, 4360, 4361, 4366, 4367, 4371, 4373, 4375,
+  4377, 4384, 4389, 4395, 4400, 4401, 4404, 4407, 4409, 4414,
+  4417, 4419, 4424, 4431, 4433, 4435, 4437, 4439, 4441, 4443,
+  4445, 4447, 4449, 4451, 4453, 4455, 4457, 4459, 4461, 4463,
+  4465, 4467, 4469, 4471, 4473, 4475, 4477, 4479, 4480, 4483,
+  4489, 4491, 4492, 4494, 4497, 4500, 4503, 4506, 4510, 4512,
+  4516, 4518, 4522, 4524, 4527, 4529, 4533, 4535, 4538, 4541,
+  4543, 4546, 4548, 4549, 4553, 4557, 4563, 4567, 4571, 4574,
+  4578, 4584, 4588, 4594, 4597, 4600, 4601, 4603, 4606, 4609,
+  4612, 4615, 4618, 4621, 4625, 4629, 4632, 4633, 4635, 4637,
+  4639, 4642, 4644, 4646, 4649, 4652, 4656, 4658, 4660, 4664,
+  4667, 4670, 4672, 4674, 4677, 4679, 4683, 4685, 4689, 4693,
+  4697, 4701, 4704, 4708, 4712, 4716, 4720, 4722, 4724, 4726,
+  4728, 4730, 4732, 4736, 4740, 4744, 4748, 4752, 4754, 4758,
+  4760, 4762, 4765, 4767, 4769, 4771, 4776, 4778, 4780, 4782,
+  4786, 4788, 4789, 4791, 4793, 4795, 4797, 4800, 4802, 4804,
+  4812, 4815, 4820, 4824, 4827, 4829, 4831, 4834, 4836, 4840,
+  4842, 4845, 4847, 4851, 4854, 4857, 4858, 4860, 4863, 4865,
+  4867, 4870, 4872, 4874, 4876, 4878, 4880, 4885, 4887, 4893,
+  4895, 4897, 4902, 4904, 4910, 4912, 4914, 4916, 4920, 4923,
+  4926, 4929, 4934, 4937, 4940, 4947, 4948, 4950, 4952, 4953,
+  4955, 4956, 4960, 4961, 4965, 4966, 4970, 4976, 4978, 4980,
+  4981, 4983, 4986, 4989, 4992, 4996, 4997, 4999, 5000, 5002,
+  5003, 5006, 5008, 5009, 5011, 5014, 5017, 5020, 5021, 5024,
+  5027, 5030, 5032, 5034, 5036, 5039, 5040, 5042, 5044, 5047,
+  5050, 5053, 5055, 5057, 5059, 5061, 5063, 5065, 5067, 5069,
+  5071, 5073, 5075, 5077, 5079, 5081, 5083, 5085, 5090, 5094,
+  5095, 5097, 5099, 5101, 5103, 5105, 5109, 5111, 5112, 5116,
+  5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136, 5138,
+  5140, 5142, 5144, 5146, 5148, 5150, 5152, 5154, 5156, 5158,
+  5160, 5162, 5164, 5166, 5168, 5170, 5172, 5174, 5176, 5178,
+  5180, 5182, 5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198,
+  5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214, 5216, 5218,
+  5220, 5222, 5224, 5226, 5228, 5230, 5232, 5234, 5236, 5238,
+  5240, 5242, 5244, 5246, 5248, 5250, 5252, 5254, 5256, 5258,
+  5260, 5262, 5264, 5266, 5268, 5270, 5272, 5274, 5276, 5278,
+  5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294, 5296, 5298,
+  5300, 5302, 5304, 5306, 5308, 5310, 5312, 5314, 5316, 5318,
+  5320, 5322, 5324, 5326, 5328, 5330, 5332, 5334, 5336, 5338,
+  5340, 5342, 5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358,
+  5360, 5362, 5364, 5366, 5368, 5370, 5372, 5374, 5376, 5378,
+  5380, 5382, 5384, 5386, 5388, 5390, 5392, 5394, 5396, 5398,
+  5400, 5402, 5404, 5406, 5409, 5411, 5413, 5415, 5417, 5419,
+  5421, 5423, 5426, 5428, 5430, 5432, 5434, 5436, 5438, 5441,
   5444, 5447, 5450, 5453, 5456, 5459, 5462, 5465, 5468, 5471,
   5474, 5477, 5480, 5483, 5486, 5489, 5492, 5495, 5498, 5501,
-  5504, 5506, 5509, 5512, 5515, 5518, 5521, 5527, 5530, 5533,
-  5540, 5543, 5549, 5552, 5555, 5562, 5566, 5575, 5585, 5595,
-  5596, 5598, 5602, 5604, 5612, 5622, 5631, 5633, 5636, 5644,
-  5648, 5652, 5656, 5660, 5661, 5663, 5667, 5671, 5673, 5675,
-  5679, 5681, 5685, 5689
+  5504, 5507, 5510, 5512, 5515, 5518, 5521, 5524, 5527, 5533,
+  5536, 5539, 5546, 5549, 5555, 5558, 5561, 5568, 5572, 5581,
+  5591, 5601, 5602, 5604, 5608, 5610, 5618, 5628, 5637, 5639,
+  5642, 5650, 5654, 5658, 5662, 5666, 5667, 5669, 5673, 5677,
+  5679, 5681, 5685, 5687, 5691, 5695
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
@@ -649,422 +649,422 @@ static const short int yyrhs[] = {
   792, -1, 507, 789, 216, 1317, 392, 1317, -1, 454,
   795, -1, 454, 790, 795, -1, 399, 514, -1, 420,
   504, -1, 456, 491, -1, 538, -1, 132, 538, -1,
-  327, 521, -1, 527, 521, -1, 524, -1, 399, 514,
-  -1, 538, -1, 132, 538, -1, 399, 514, -1, 538,
-  -1, 132, 538, -1, 327, 521, -1, 527, 521, -1,
-  524, -1, 534, 440, -1, 403, 463, 440, -1, 441,
-  440, -1, 8, 441, 440, -1, 441, 409, -1, 8,
-  441, 409, -1, 8, 445, 440, -1, 8, 445, 409,
-  -1, 463, 440, -1, 510, 481, 440, -1, 510, 481,
-  509, -1, 151, 440, -1, 151, 409, -1, 241, -1,
-  327, -1, 216, -1, 358, -1, 793, -1, 792, 11,
-  793, -1, 1317, 558, 796, -1, -1, 216, 796, -1,
-  795, 557, 796, -1, 796, -1, 1320, -1, 1324, -1,
-  1317, -1, -1, 132, -1, 131, -1, 150, -1, -1,
-  127, 71, -1, 127, 71, 560, 561, -1, 95, -1,
-  94, -1, 427, -1, 151, -1, 445, -1, 453, -1,
-  -1, 340, 803, 1017, -1, -1, 802, 805, 692, 282,
-  810, 806, 1048, 1059, 1070, -1, 802, 214, 1029, 282,
-  810, -1, -1, -1, -1, 358, 807, 1249, 808, -1,
-  358, 66, 216, 1317, -1, -1, 14, 1317, -1, 1317,
-  -1, 810, 557, 811, -1, 811, -1, 1274, 558, 1075,
-  -1, 1279, 558, 89, -1, 812, 558, 1087, -1, 560,
-  813, 561, -1, 813, 557, 1274, -1, 1274, -1, 1317,
-  -1, 1317, 392, 562, -1, 815, 557, 814, -1, 814,
-  -1, 815, 131, 692, -1, 131, 815, 345, 692, -1,
-  131, 698, -1, 698, -1, -1, 92, 818, 1017, 816,
-  806, 1048, 1070, -1, -1, 189, 820, 1017, 164, 698,
-  345, 698, 218, 1249, 821, -1, 822, -1, 823, -1,
-  822, 823, -1, 823, 822, -1, 356, 187, 317, 340,
-  282, 810, 1033, 824, -1, 356, 210, 187, 317, 158,
-  770, 772, 1033, -1, -1, 92, 358, 1249, -1, 832,
-  833, -1, 826, 834, 840, -1, 826, 840, 834, -1,
-  -1, -1, 256, 827, 843, 828, -1, -1, -1, 139,
-  830, 843, 831, -1, 829, 834, 837, -1, 829, 837,
-  834, -1, -1, 360, 139, 221, -1, -1, -1, 218,
-  835, 704, 836, -1, -1, -1, 325, 838, 1314, 839,
-  -1, -1, -1, 131, 841, 1314, 842, -1, 843, 557,
-  844, -1, 844, -1, 274, -1, 158, -1, 151, -1,
-  92, -1, 340, 560, 1314, 561, -1, 340, -1, 10,
-  -1, 5, -1, 105, -1, 118, -1, 246, -1, 8,
-  238, -1, 8, -1, -1, -1, -1, 484, 846, 1320,
-  847, -1, -1, -1, -1, 435, 849, 1314, 850, -1,
-  -1, -1, -1, 467, 852, 1314, 853, -1, 36, 1245,
-  776, -1, -1, 560, 903, 561, -1, -1, 190, 891,
-  -1, -1, 124, 898, -1, -1, 871, -1, -1, 873,
-  -1, -1, 1331, -1, -1, 1330, -1, 45, -1, 315,
-  -1, 355, -1, 354, -1, -1, 222, 251, -1, -1,
-  147, 210, 119, -1, -1, 147, 119, -1, -1, 560,
-  907, 561, -1, -1, 14, 870, -1, -1, 360, 180,
-  44, 221, -1, 360, 38, 44, 221, -1, 360, 44,
-  221, -1, 870, 557, 982, -1, 982, -1, 871, 557,
-  872, -1, 153, 872, -1, 724, 1317, 216, 1317, 14,
-  1317, -1, 724, 1317, 216, 1317, -1, 873, 557, 874,
-  -1, 873, 874, -1, 874, -1, 500, -1, 404, 558,
-  543, -1, 1303, -1, 1296, -1, 1297, -1, -1, 334,
-  686, -1, 14, 301, 216, 686, -1, -1, 58, 1317,
-  -1, -1, 58, 725, -1, 881, -1, 882, -1, 889,
-  -1, -1, 880, -1, 880, 557, 890, -1, 890, -1,
-  236, 168, 725, 560, 883, 561, -1, 336, 925, 725,
-  684, -1, 129, 168, 725, 560, 883, 561, 246, 709,
-  886, 887, -1, 883, 557, 884, -1, 884, -1, 1317,
-  885, -1, -1, 15, -1, 94, -1, -1, 560, 1314,
-  561, -1, -1, 888, -1, 888, 218, 92, 37, -1,
-  888, 218, 92, 209, 4, -1, 888, 218, 92, 253,
-  -1, 888, 218, 92, 282, 211, -1, 888, 218, 340,
-  209, 4, -1, 888, 218, 340, 253, -1, 888, 218,
-  340, 282, 211, -1, 218, 92, 37, -1, 218, 92,
-  209, 4, -1, 218, 92, 253, -1, 218, 92, 282,
-  211, -1, 218, 340, 209, 4, -1, 218, 340, 253,
-  -1, 218, 340, 282, 211, -1, 44, 560, 1249, 561,
-  -1, 210, 90, -1, 90, -1, 154, 91, -1, 154,
-  149, -1, 891, 557, 892, -1, 892, -1, 724, 1317,
-  893, 896, 897, -1, -1, 560, 894, 561, -1, 560,
-  561, -1, 894, 557, 895, -1, 895, -1, 1280, 1283,
-  -1, -1, 1283, -1, -1, 133, 1317, -1, 898, 557,
-  899, -1, 899, -1, 1320, -1, -1, -1, -1, 45,
-  20, 901, 560, 910, 561, 902, -1, 903, 557, 904,
-  -1, 904, -1, -1, -1, 45, 905, 911, 906, -1,
-  911, -1, 907, 557, 908, -1, 908, -1, 911, -1,
-  1317, 1300, -1, 909, 557, 911, -1, 911, 557, 911,
-  -1, 910, 557, 911, -1, 911, -1, 912, -1, 913,
-  -1, 914, -1, 877, 878, 879, 1300, -1, 924, 1317,
-  684, 1033, 1300, -1, -1, 1317, 1283, 915, 917, 916,
-  -1, -1, 125, -1, 7, 1317, -1, -1, 918, -1,
-  918, 919, -1, 919, -1, 920, -1, 921, -1, 922,
-  -1, 923, -1, 929, -1, 930, -1, 928, -1, 931,
-  -1, 876, 336, 926, 879, -1, 876, 236, 168, 879,
-  -1, 876, 211, 879, -1, 876, 210, 211, 879, -1,
-  876, 44, 560, 1249, 561, 879, -1, 876, 927, 246,
-  709, 886, 887, 879, -1, 151, -1, 168, -1, -1,
-  151, -1, 168, -1, -1, 168, -1, -1, 129, 168,
-  -1, 404, 560, 971, 557, 971, 561, -1, 404, -1,
-  286, 1075, -1, 89, 1075, -1, 417, 1301, -1, 932,
-  557, 933, -1, 933, -1, 166, 176, 934, 557, 934,
-  -1, 166, 176, 934, -1, 462, 525, 937, -1, 1075,
-  -1, 17, 537, -1, 278, -1, 72, 511, -1, 936,
-  -1, 936, 935, -1, 936, 450, -1, 936, 935, 557,
-  936, 450, -1, 936, 450, 557, 936, 935, -1, 267,
-  -1, 45, -1, 497, 242, -1, 242, 418, -1, 449,
-  -1, 217, -1, 1324, -1, 1326, -1, 1032, -1, 1030,
-  -1, 51, 940, 499, 462, -1, 51, 940, -1, 260,
-  940, 325, 939, 1075, -1, 260, 940, -1, 266, 1075,
-  -1, -1, 266, -1, -1, 362, -1, -1, 325, -1,
-  114, 1075, 776, -1, 234, 1317, 131, 1321, -1, 118,
-  1317, 945, -1, -1, -1, -1, 345, 946, 1337, 947,
-  -1, -1, 949, -1, 514, 400, -1, 514, 443, -1,
-  -1, 951, -1, 489, 1326, -1, -1, 147, 958, -1,
-  22, -1, 7, -1, 91, -1, -1, 7, -1, 91,
-  -1, 956, -1, 956, 957, -1, 158, -1, 513, 158,
-  -1, 92, -1, 513, 92, -1, 340, -1, 513, 340,
-  -1, 51, -1, 260, -1, 218, 1317, 560, 1317, 561,
-  -1, 218, 1317, -1, 1249, -1, 854, -1, 494, -1,
-  451, 327, -1, 488, 1320, -1, 942, -1, 757, -1,
-  804, -1, 817, -1, 854, -1, 819, -1, 1314, -1,
-  8, 528, -1, 949, -1, 951, -1, 480, 325, 1317,
-  -1, -1, 464, -1, 218, -1, 217, -1, 1324, -1,
-  1032, -1, 1030, -1, 1324, -1, 1032, -1, 1030, -1,
-  512, 360, 971, -1, 444, 35, 971, -1, 468, 971,
-  -1, 473, -1, 465, 971, -1, 472, -1, 73, -1,
-  470, -1, 408, 1325, -1, 471, -1, 973, 543, -1,
-  563, 543, -1, 543, -1, -1, 564, -1, -1, 1283,
-  -1, 72, -1, -1, 165, -1, 14, -1, -1, 977,
-  -1, 977, 557, 978, -1, 978, -1, 1317, 979, 1283,
-  1300, -1, 1317, 979, 72, 1300, -1, 1280, -1, 150,
-  224, -1, -1, 981, 982, -1, -1, -1, -1, 983,
-  990, 984, 1061, 985, 1068, 1054, -1, -1, -1, -1,
-  987, 995, 988, 1061, 989, 1068, 1054, -1, 1009, 991,
-  -1, -1, -1, -1, 991, 992, 1061, 993, 1068, 1054,
-  994, 999, 1000, -1, 1000, -1, -1, -1, -1, 995,
-  996, 1061, 997, 1068, 1054, 998, 999, 1001, -1, 1001,
-  -1, 335, 1019, -1, 98, 1019, -1, 115, 1019, -1,
-  162, 1019, -1, 161, 1019, -1, 1006, -1, 1273, -1,
-  1002, -1, 1006, -1, 1273, -1, -1, 773, 1003, 1004,
-  -1, 1004, 557, 1005, -1, 1005, -1, 560, 1021, 561,
-  -1, -1, -1, 274, 1007, 1017, 1019, 1020, 1016, 1008,
-  1014, -1, -1, 360, 1010, 1011, -1, -1, 244, -1,
-  1011, 557, 1012, -1, 1012, -1, 1317, 1315, 14, 1013,
-  -1, 1013, 999, 1000, -1, 1000, -1, -1, -1, 131,
-  692, 1015, 1033, 1035, 1041, 1042, 1046, 1048, 1053, -1,
-  -1, 164, 1027, -1, 325, 1027, -1, -1, 1018, -1,
-  1018, 549, -1, 1018, 551, -1, 1018, 550, -1, 549,
-  -1, 551, -1, 550, -1, -1, 8, -1, 100, -1,
-  336, -1, 562, -1, 562, 557, 1021, -1, 1021, -1,
-  -1, 1022, 1023, -1, 1023, 557, 1024, -1, 1024, -1,
-  1076, 809, -1, 1256, 809, -1, 1026, -1, 1026, 557,
-  1075, -1, 1075, -1, 1027, 557, 1028, -1, 1028, -1,
-  1031, -1, 1032, -1, 1317, -1, 1030, -1, 1032, -1,
-  45, 1317, -1, 1317, -1, 565, -1, 398, 972, -1,
-  565, -1, 398, 972, -1, 566, 1317, -1, -1, -1,
-  1034, 358, 1249, -1, -1, 1036, 1038, -1, 1038, 1036,
-  -1, 1038, -1, -1, 1037, 512, 360, 1249, -1, -1,
-  1039, 53, 35, 1040, 1249, -1, -1, 470, -1, -1,
-  140, 35, 1043, -1, -1, 360, 261, -1, 1043, 557,
-  1044, -1, 1044, -1, -1, 1045, 1075, 885, -1, -1,
-  -1, 1047, 141, 1249, -1, -1, 345, 151, 1049, -1,
-  345, 151, 474, -1, 345, 151, 8, 115, 1050, -1,
-  1049, 557, 1051, -1, 1051, -1, 1050, 557, 1052, -1,
-  1052, -1, 1052, 169, 1065, -1, 1052, 169, 1065, 557,
-  1065, -1, 1052, -1, 709, 1339, -1, 709, 1340, -1,
-  709, -1, 1317, 392, 474, -1, -1, 360, 444, 127,
-  1055, -1, 360, 424, 127, 1057, -1, -1, 127, 340,
-  -1, 127, 340, 216, 710, -1, 1055, 557, 1056, -1,
-  1056, -1, 1274, -1, 1057, 557, 1058, -1, 1058, -1,
-  1274, -1, -1, -1, 223, 35, 1072, 1060, 1071, -1,
-  -1, -1, -1, 223, 1064, 35, 1062, 1072, 1063, 1071,
-  -1, -1, 287, -1, 1065, 564, 1066, -1, 1065, 563,
-  1066, -1, 1066, -1, 1066, 562, 1067, -1, 1066, 567,
-  1067, -1, 1067, -1, 1030, -1, 1324, -1, 560, 1065,
-  561, -1, -1, 178, 1069, -1, 1065, -1, 1065, 557,
-  1065, -1, 1065, 478, 1065, -1, -1, 178, 1065, -1,
-  -1, 127, 1249, -1, 1072, 557, 1073, -1, 1073, -1,
-  1075, 15, 1074, -1, 1075, 94, 1074, -1, 1075, 1074,
-  -1, -1, 477, 125, -1, 477, 171, -1, 1076, -1,
-  1256, -1, 621, -1, 1077, -1, 1077, 394, 1078, -1,
-  1078, -1, 1078, 568, 1079, -1, 1079, -1, 1079, 569,
-  1080, -1, 1080, -1, 1080, 29, 1081, -1, 1080, 30,
-  1081, -1, 1081, -1, 1081, 564, 1082, -1, 1081, 563,
-  1082, -1, 1082, -1, 1082, 562, 1083, -1, 1082, 567,
-  1083, -1, 1082, 101, 1083, -1, 1082, 196, 1083, -1,
-  1083, -1, 1083, 570, 1084, -1, 1084, -1, 1087, -1,
-  563, 1084, -1, 564, 1084, -1, 571, 1088, -1, -1,
-  237, 1085, 1087, -1, -1, 56, 1086, 1087, -1, 1088,
-  1295, -1, 1092, -1, 1093, -1, 1234, -1, 1240, -1,
-  1309, -1, 765, -1, 1274, -1, 560, 1025, 561, -1,
-  560, 1089, 561, -1, 1273, -1, 622, -1, -1, 1091,
-  1090, 1061, -1, 1249, -1, 54, -1, 55, -1, 176,
-  -1, 63, 560, 562, 561, -1, 63, 560, 562, 561,
-  227, 560, 1230, 1232, 561, -1, 63, 560, 1225, 1075,
-  561, -1, 63, 560, 1225, 1075, 561, 227, 560, 1230,
-  1232, 561, -1, 63, 560, 1336, 1075, 561, -1, 63,
+  327, 521, -1, 527, 521, -1, 524, -1, 347, 514,
+  -1, 399, 514, -1, 538, -1, 132, 538, -1, 399,
+  514, -1, 538, -1, 132, 538, -1, 327, 521, -1,
+  527, 521, -1, 524, -1, 347, 514, -1, 534, 440,
+  -1, 403, 463, 440, -1, 441, 440, -1, 8, 441,
+  440, -1, 441, 409, -1, 8, 441, 409, -1, 8,
+  445, 440, -1, 8, 445, 409, -1, 463, 440, -1,
+  510, 481, 440, -1, 510, 481, 509, -1, 151, 440,
+  -1, 151, 409, -1, 241, -1, 327, -1, 216, -1,
+  358, -1, 793, -1, 792, 11, 793, -1, 1317, 558,
+  796, -1, -1, 216, 796, -1, 795, 557, 796, -1,
+  796, -1, 1320, -1, 1324, -1, 1317, -1, -1, 132,
+  -1, 131, -1, 150, -1, -1, 127, 71, -1, 127,
+  71, 560, 561, -1, 95, -1, 94, -1, 427, -1,
+  151, -1, 445, -1, 453, -1, -1, 340, 803, 1017,
+  -1, -1, 802, 805, 692, 282, 810, 806, 1048, 1059,
+  1070, -1, 802, 214, 1029, 282, 810, -1, -1, -1,
+  -1, 358, 807, 1249, 808, -1, 358, 66, 216, 1317,
+  -1, -1, 14, 1317, -1, 1317, -1, 810, 557, 811,
+  -1, 811, -1, 1274, 558, 1075, -1, 1279, 558, 89,
+  -1, 812, 558, 1087, -1, 560, 813, 561, -1, 813,
+  557, 1274, -1, 1274, -1, 1317, -1, 1317, 392, 562,
+  -1, 815, 557, 814, -1, 814, -1, 815, 131, 692,
+  -1, 131, 815, 345, 692, -1, 131, 698, -1, 698,
+  -1, -1, 92, 818, 1017, 816, 806, 1048, 1070, -1,
+  -1, 189, 820, 1017, 164, 698, 345, 698, 218, 1249,
+  821, -1, 822, -1, 823, -1, 822, 823, -1, 823,
+  822, -1, 356, 187, 317, 340, 282, 810, 1033, 824,
+  -1, 356, 210, 187, 317, 158, 770, 772, 1033, -1,
+  -1, 92, 358, 1249, -1, 832, 833, -1, 826, 834,
+  840, -1, 826, 840, 834, -1, -1, -1, 256, 827,
+  843, 828, -1, -1, -1, 139, 830, 843, 831, -1,
+  829, 834, 837, -1, 829, 837, 834, -1, -1, 360,
+  139, 221, -1, -1, -1, 218, 835, 704, 836, -1,
+  -1, -1, 325, 838, 1314, 839, -1, -1, -1, 131,
+  841, 1314, 842, -1, 843, 557, 844, -1, 844, -1,
+  274, -1, 158, -1, 151, -1, 92, -1, 340, 560,
+  1314, 561, -1, 340, -1, 10, -1, 5, -1, 105,
+  -1, 118, -1, 246, -1, 8, 238, -1, 8, -1,
+  -1, -1, -1, 484, 846, 1320, 847, -1, -1, -1,
+  -1, 435, 849, 1314, 850, -1, -1, -1, -1, 467,
+  852, 1314, 853, -1, 36, 1245, 776, -1, -1, 560,
+  903, 561, -1, -1, 190, 891, -1, -1, 124, 898,
+  -1, -1, 871, -1, -1, 873, -1, -1, 1331, -1,
+  -1, 1330, -1, 45, -1, 315, -1, 355, -1, 354,
+  -1, -1, 222, 251, -1, -1, 147, 210, 119, -1,
+  -1, 147, 119, -1, -1, 560, 907, 561, -1, -1,
+  14, 870, -1, -1, 360, 180, 44, 221, -1, 360,
+  38, 44, 221, -1, 360, 44, 221, -1, 870, 557,
+  982, -1, 982, -1, 871, 557, 872, -1, 153, 872,
+  -1, 724, 1317, 216, 1317, 14, 1317, -1, 724, 1317,
+  216, 1317, -1, 873, 557, 874, -1, 873, 874, -1,
+  874, -1, 500, -1, 404, 558, 543, -1, 1303, -1,
+  1296, -1, 1297, -1, -1, 334, 686, -1, 14, 301,
+  216, 686, -1, -1, 58, 1317, -1, -1, 58, 725,
+  -1, 881, -1, 882, -1, 889, -1, -1, 880, -1,
+  880, 557, 890, -1, 890, -1, 236, 168, 725, 560,
+  883, 561, -1, 336, 925, 725, 684, -1, 129, 168,
+  725, 560, 883, 561, 246, 709, 886, 887, -1, 883,
+  557, 884, -1, 884, -1, 1317, 885, -1, -1, 15,
+  -1, 94, -1, -1, 560, 1314, 561, -1, -1, 888,
+  -1, 888, 218, 92, 37, -1, 888, 218, 92, 209,
+  4, -1, 888, 218, 92, 253, -1, 888, 218, 92,
+  282, 211, -1, 888, 218, 340, 209, 4, -1, 888,
+  218, 340, 253, -1, 888, 218, 340, 282, 211, -1,
+  218, 92, 37, -1, 218, 92, 209, 4, -1, 218,
+  92, 253, -1, 218, 92, 282, 211, -1, 218, 340,
+  209, 4, -1, 218, 340, 253, -1, 218, 340, 282,
+  211, -1, 44, 560, 1249, 561, -1, 210, 90, -1,
+  90, -1, 154, 91, -1, 154, 149, -1, 891, 557,
+  892, -1, 892, -1, 724, 1317, 893, 896, 897, -1,
+  -1, 560, 894, 561, -1, 560, 561, -1, 894, 557,
+  895, -1, 895, -1, 1280, 1283, -1, -1, 1283, -1,
+  -1, 133, 1317, -1, 898, 557, 899, -1, 899, -1,
+  1320, -1, -1, -1, -1, 45, 20, 901, 560, 910,
+  561, 902, -1, 903, 557, 904, -1, 904, -1, -1,
+  -1, 45, 905, 911, 906, -1, 911, -1, 907, 557,
+  908, -1, 908, -1, 911, -1, 1317, 1300, -1, 909,
+  557, 911, -1, 911, 557, 911, -1, 910, 557, 911,
+  -1, 911, -1, 912, -1, 913, -1, 914, -1, 877,
+  878, 879, 1300, -1, 924, 1317, 684, 1033, 1300, -1,
+  -1, 1317, 1283, 915, 917, 916, -1, -1, 125, -1,
+  7, 1317, -1, -1, 918, -1, 918, 919, -1, 919,
+  -1, 920, -1, 921, -1, 922, -1, 923, -1, 929,
+  -1, 930, -1, 928, -1, 931, -1, 876, 336, 926,
+  879, -1, 876, 236, 168, 879, -1, 876, 211, 879,
+  -1, 876, 210, 211, 879, -1, 876, 44, 560, 1249,
+  561, 879, -1, 876, 927, 246, 709, 886, 887, 879,
+  -1, 151, -1, 168, -1, -1, 151, -1, 168, -1,
+  -1, 168, -1, -1, 129, 168, -1, 404, 560, 971,
+  557, 971, 561, -1, 404, -1, 286, 1075, -1, 89,
+  1075, -1, 417, 1301, -1, 932, 557, 933, -1, 933,
+  -1, 166, 176, 934, 557, 934, -1, 166, 176, 934,
+  -1, 462, 525, 937, -1, 1075, -1, 17, 537, -1,
+  278, -1, 72, 511, -1, 936, -1, 936, 935, -1,
+  936, 450, -1, 936, 935, 557, 936, 450, -1, 936,
+  450, 557, 936, 935, -1, 267, -1, 45, -1, 497,
+  242, -1, 242, 418, -1, 449, -1, 217, -1, 1324,
+  -1, 1326, -1, 1032, -1, 1030, -1, 51, 940, 499,
+  462, -1, 51, 940, -1, 260, 940, 325, 939, 1075,
+  -1, 260, 940, -1, 266, 1075, -1, -1, 266, -1,
+  -1, 362, -1, -1, 325, -1, 114, 1075, 776, -1,
+  234, 1317, 131, 1321, -1, 118, 1317, 945, -1, -1,
+  -1, -1, 345, 946, 1337, 947, -1, -1, 949, -1,
+  514, 400, -1, 514, 443, -1, -1, 951, -1, 489,
+  1326, -1, -1, 147, 958, -1, 22, -1, 7, -1,
+  91, -1, -1, 7, -1, 91, -1, 956, -1, 956,
+  957, -1, 158, -1, 513, 158, -1, 92, -1, 513,
+  92, -1, 340, -1, 513, 340, -1, 51, -1, 260,
+  -1, 218, 1317, 560, 1317, 561, -1, 218, 1317, -1,
+  1249, -1, 854, -1, 494, -1, 451, 327, -1, 488,
+  1320, -1, 942, -1, 757, -1, 804, -1, 817, -1,
+  854, -1, 819, -1, 1314, -1, 8, 528, -1, 949,
+  -1, 951, -1, 480, 325, 1317, -1, -1, 464, -1,
+  218, -1, 217, -1, 1324, -1, 1032, -1, 1030, -1,
+  1324, -1, 1032, -1, 1030, -1, 512, 360, 971, -1,
+  444, 35, 971, -1, 468, 971, -1, 473, -1, 465,
+  971, -1, 472, -1, 73, -1, 470, -1, 408, 1325,
+  -1, 471, -1, 973, 543, -1, 563, 543, -1, 543,
+  -1, -1, 564, -1, -1, 1283, -1, 72, -1, -1,
+  165, -1, 14, -1, -1, 977, -1, 977, 557, 978,
+  -1, 978, -1, 1317, 979, 1283, 1300, -1, 1317, 979,
+  72, 1300, -1, 1280, -1, 150, 224, -1, -1, 981,
+  982, -1, -1, -1, -1, 983, 990, 984, 1061, 985,
+  1068, 1054, -1, -1, -1, -1, 987, 995, 988, 1061,
+  989, 1068, 1054, -1, 1009, 991, -1, -1, -1, -1,
+  991, 992, 1061, 993, 1068, 1054, 994, 999, 1000, -1,
+  1000, -1, -1, -1, -1, 995, 996, 1061, 997, 1068,
+  1054, 998, 999, 1001, -1, 1001, -1, 335, 1019, -1,
+  98, 1019, -1, 115, 1019, -1, 162, 1019, -1, 161,
+  1019, -1, 1006, -1, 1273, -1, 1002, -1, 1006, -1,
+  1273, -1, -1, 773, 1003, 1004, -1, 1004, 557, 1005,
+  -1, 1005, -1, 560, 1021, 561, -1, -1, -1, 274,
+  1007, 1017, 1019, 1020, 1016, 1008, 1014, -1, -1, 360,
+  1010, 1011, -1, -1, 244, -1, 1011, 557, 1012, -1,
+  1012, -1, 1317, 1315, 14, 1013, -1, 1013, 999, 1000,
+  -1, 1000, -1, -1, -1, 131, 692, 1015, 1033, 1035,
+  1041, 1042, 1046, 1048, 1053, -1, -1, 164, 1027, -1,
+  325, 1027, -1, -1, 1018, -1, 1018, 549, -1, 1018,
+  551, -1, 1018, 550, -1, 549, -1, 551, -1, 550,
+  -1, -1, 8, -1, 100, -1, 336, -1, 562, -1,
+  562, 557, 1021, -1, 1021, -1, -1, 1022, 1023, -1,
+  1023, 557, 1024, -1, 1024, -1, 1076, 809, -1, 1256,
+  809, -1, 1026, -1, 1026, 557, 1075, -1, 1075, -1,
+  1027, 557, 1028, -1, 1028, -1, 1031, -1, 1032, -1,
+  1317, -1, 1030, -1, 1032, -1, 45, 1317, -1, 1317,
+  -1, 565, -1, 398, 972, -1, 565, -1, 398, 972,
+  -1, 566, 1317, -1, -1, -1, 1034, 358, 1249, -1,
+  -1, 1036, 1038, -1, 1038, 1036, -1, 1038, -1, -1,
+  1037, 512, 360, 1249, -1, -1, 1039, 53, 35, 1040,
+  1249, -1, -1, 470, -1, -1, 140, 35, 1043, -1,
+  -1, 360, 261, -1, 1043, 557, 1044, -1, 1044, -1,
+  -1, 1045, 1075, 885, -1, -1, -1, 1047, 141, 1249,
+  -1, -1, 345, 151, 1049, -1, 345, 151, 474, -1,
+  345, 151, 8, 115, 1050, -1, 1049, 557, 1051, -1,
+  1051, -1, 1050, 557, 1052, -1, 1052, -1, 1052, 169,
+  1065, -1, 1052, 169, 1065, 557, 1065, -1, 1052, -1,
+  709, 1339, -1, 709, 1340, -1, 709, -1, 1317, 392,
+  474, -1, -1, 360, 444, 127, 1055, -1, 360, 424,
+  127, 1057, -1, -1, 127, 340, -1, 127, 340, 216,
+  710, -1, 1055, 557, 1056, -1, 1056, -1, 1274, -1,
+  1057, 557, 1058, -1, 1058, -1, 1274, -1, -1, -1,
+  223, 35, 1072, 1060, 1071, -1, -1, -1, -1, 223,
+  1064, 35, 1062, 1072, 1063, 1071, -1, -1, 287, -1,
+  1065, 564, 1066, -1, 1065, 563, 1066, -1, 1066, -1,
+  1066, 562, 1067, -1, 1066, 567, 1067, -1, 1067, -1,
+  1030, -1, 1324, -1, 560, 1065, 561, -1, -1, 178,
+  1069, -1, 1065, -1, 1065, 557, 1065, -1, 1065, 478,
+  1065, -1, -1, 178, 1065, -1, -1, 127, 1249, -1,
+  1072, 557, 1073, -1, 1073, -1, 1075, 15, 1074, -1,
+  1075, 94, 1074, -1, 1075, 1074, -1, -1, 477, 125,
+  -1, 477, 171, -1, 1076, -1, 1256, -1, 621, -1,
+  1077, -1, 1077, 394, 1078, -1, 1078, -1, 1078, 568,
+  1079, -1, 1079, -1, 1079, 569, 1080, -1, 1080, -1,
+  1080, 29, 1081, -1, 1080, 30, 1081, -1, 1081, -1,
+  1081, 564, 1082, -1, 1081, 563, 1082, -1, 1082, -1,
+  1082, 562, 1083, -1, 1082, 567, 1083, -1, 1082, 101,
+  1083, -1, 1082, 196, 1083, -1, 1083, -1, 1083, 570,
+  1084, -1, 1084, -1, 1087, -1, 563, 1084, -1, 564,
+  1084, -1, 571, 1088, -1, -1, 237, 1085, 1087, -1,
+  -1, 56, 1086, 1087, -1, 1088, 1295, -1, 1092, -1,
+  1093, -1, 1234, -1, 1240, -1, 1309, -1, 765, -1,
+  1274, -1, 560, 1025, 561, -1, 560, 1089, 561, -1,
+  1273, -1, 622, -1, -1, 1091, 1090, 1061, -1, 1249,
+  -1, 54, -1, 55, -1, 176, -1, 63, 560, 562,
+  561, -1, 63, 560, 562, 561, 227, 560, 1230, 1232,
+  561, -1, 63, 560, 1225, 1075, 561, -1, 63, 560,
+  1225, 1075, 561, 227, 560, 1230, 1232, 561, -1, 63,
+  560, 1336, 1075, 561, -1, 63, 560, 1336, 1075, 561,
+  227, 560, 1230, 1232, 561, -1, 1218, 560, 1225, 1075,
+  561, -1, 1218, 560, 1336, 1075, 561, -1, 1219, 560,
+  1225, 1075, 561, 227, 560, 1230, 1232, 561, -1, 1219,
   560, 1336, 1075, 561, 227, 560, 1230, 1232, 561, -1,
-  1218, 560, 1225, 1075, 561, -1, 1218, 560, 1336, 1075,
-  561, -1, 1219, 560, 1225, 1075, 561, 227, 560, 1230,
-  1232, 561, -1, 1219, 560, 1336, 1075, 561, 227, 560,
-  1230, 1232, 561, -1, 1220, 560, 1075, 561, 1229, 227,
-  560, 1230, 1232, 561, -1, 1221, 560, 1075, 557, 1075,
-  561, 1228, 1229, 227, 560, 1230, 1232, 561, -1, 1222,
-  560, 1075, 561, 227, 560, 1230, 1232, 561, -1, 1222,
-  560, 1075, 557, 1075, 561, 227, 560, 1230, 1232, 561,
-  -1, 1222, 560, 1075, 557, 1075, 557, 1075, 561, 227,
-  560, 1230, 1232, 561, -1, 1224, 560, 561, 227, 560,
-  1230, 1232, 561, -1, -1, -1, 434, 1094, 560, 1225,
-  1075, 1227, 1226, 561, 1095, -1, 434, 560, 1336, 1247,
-  1227, 1226, 561, -1, 1223, 560, 1075, 561, 536, 140,
-  560, 223, 35, 1073, 561, 1231, -1, -1, -1, 158,
-  1096, 560, 1025, 561, 1097, -1, 426, 560, 1247, 561,
-  -1, 232, 560, 1075, 150, 1075, 561, -1, -1, -1,
-  304, 1098, 560, 1075, 131, 1075, 127, 1075, 561, 1099,
-  -1, -1, -1, 304, 1100, 560, 1075, 131, 1075, 561,
-  1101, -1, -1, -1, 304, 1102, 560, 1075, 557, 1075,
-  557, 1075, 561, 1103, -1, -1, -1, 304, 1104, 560,
-  1075, 557, 1075, 561, 1105, -1, -1, -1, 77, 1106,
-  560, 1075, 561, 1107, -1, -1, -1, 318, 1108, 560,
-  1075, 561, 1109, -1, -1, -1, 401, 1110, 560, 1075,
-  557, 1075, 561, 1111, -1, -1, -1, 1241, 1112, 560,
-  1075, 557, 163, 1075, 1243, 561, 1113, -1, -1, -1,
-  519, 1114, 560, 1075, 557, 1075, 561, 1115, -1, -1,
-  -1, 1242, 1116, 560, 1075, 557, 163, 1075, 1243, 561,
-  1117, -1, -1, -1, 319, 1118, 560, 1075, 561, 1119,
-  -1, -1, -1, 319, 1120, 560, 1075, 557, 1075, 561,
-  1121, -1, -1, -1, 365, 1122, 560, 1075, 561, 1123,
-  -1, -1, -1, 200, 1124, 560, 1075, 561, 1125, -1,
-  -1, -1, 81, 1126, 560, 1075, 561, 1127, -1, -1,
-  -1, 142, 1128, 560, 1075, 561, 1129, -1, -1, -1,
-  193, 1130, 560, 1075, 561, 1131, -1, -1, -1, 271,
-  1132, 560, 1075, 561, 1133, -1, -1, -1, 75, 1134,
-  560, 561, 1135, -1, -1, -1, 267, 1136, 560, 561,
-  1137, -1, -1, -1, 331, 1138, 560, 1233, 1075, 131,
-  1075, 561, 1139, -1, -1, -1, 331, 1140, 560, 1233,
-  131, 1075, 561, 1141, -1, -1, -1, 331, 1142, 560,
-  1075, 131, 1075, 561, 1143, -1, -1, -1, 331, 1144,
-  560, 1075, 561, 1145, -1, -1, -1, 412, 1146, 560,
-  1075, 1304, 561, 1147, -1, -1, -1, 413, 1148, 560,
-  1075, 1304, 561, 1149, -1, -1, -1, 40, 1150, 560,
-  1075, 14, 1282, 561, 1151, -1, 45, 560, 1317, 561,
-  -1, 310, -1, 1203, -1, 312, -1, 1205, -1, 1207,
-  -1, 1209, -1, 313, -1, 1211, -1, 311, -1, 1215,
-  -1, 1217, -1, -1, -1, 1217, 1152, 560, 561, 1153,
-  -1, -1, -1, 89, 560, 1154, 1279, 561, 1155, -1,
-  181, -1, 264, -1, -1, -1, 6, 1156, 560, 1075,
-  557, 1075, 561, 1157, -1, -1, -1, 215, 1158, 560,
-  1075, 561, 1159, -1, -1, -1, 28, 1160, 560, 1075,
-  561, 1161, -1, -1, -1, 185, 1162, 560, 1075, 561,
-  1163, -1, -1, -1, 460, 1164, 560, 1075, 561, 1165,
-  -1, -1, -1, 341, 1166, 560, 1075, 561, 1167, -1,
-  -1, -1, 529, 1168, 560, 1075, 561, 1169, -1, -1,
-  -1, 309, 1170, 560, 1075, 557, 1320, 561, 1171, -1,
-  -1, -1, 147, 1172, 560, 1249, 557, 1075, 557, 1075,
-  561, 1173, -1, -1, -1, 442, 1174, 560, 1075, 557,
-  1075, 561, 1175, -1, -1, -1, 452, 1176, 560, 1075,
-  561, 1177, -1, -1, -1, 174, 1178, 560, 1075, 557,
-  1075, 561, 1179, -1, -1, -1, 257, 1180, 560, 1075,
-  557, 1075, 561, 1181, -1, -1, -1, 196, 1182, 560,
-  1075, 557, 1075, 561, 1183, -1, -1, -1, 333, 1184,
-  560, 1075, 557, 1075, 561, 1185, -1, -1, -1, 328,
-  1186, 560, 1075, 557, 1075, 557, 1075, 561, 1187, -1,
-  -1, -1, 251, 1188, 560, 1075, 557, 1075, 557, 1075,
-  561, 1189, -1, -1, -1, 251, 1190, 560, 1075, 557,
-  1075, 561, 1191, -1, -1, -1, 518, 1192, 560, 1075,
-  557, 1319, 561, 1193, -1, -1, -1, 518, 1194, 560,
-  1075, 557, 211, 561, 1195, -1, -1, -1, 411, 1196,
-  560, 1075, 561, 1197, -1, -1, -1, 415, 1198, 560,
-  1075, 561, 1199, -1, 1202, 560, 1025, 561, 536, 140,
-  560, 223, 35, 1072, 561, -1, -1, -1, 446, 1200,
-  560, 1075, 557, 1075, 557, 1075, 561, 1201, -1, 421,
-  -1, 485, -1, 67, -1, -1, 67, 1204, 560, 561,
-  -1, 69, -1, -1, 69, 1206, 560, 561, -1, 86,
-  -1, -1, 86, 1208, 560, 561, -1, 280, -1, -1,
-  280, 1210, 560, 561, -1, 70, -1, -1, 70, 1212,
-  560, 561, -1, 183, -1, -1, 183, 1213, 560, 561,
-  -1, 182, -1, -1, 182, 1214, 560, 561, -1, 68,
-  -1, -1, 68, 1216, 560, 561, -1, 71, -1, 314,
-  -1, 344, -1, 21, -1, 188, -1, 192, -1, 305,
-  -1, 515, -1, 516, -1, 517, -1, 531, -1, 532,
-  -1, 533, -1, 405, -1, 406, -1, 407, -1, 466,
-  -1, 21, -1, 188, -1, 192, -1, 305, -1, 515,
-  -1, 516, -1, 517, -1, 531, -1, 532, -1, 533,
-  -1, 476, -1, 466, -1, 428, -1, 459, -1, 475,
-  -1, 461, -1, 458, -1, 486, -1, 487, -1, 503,
-  -1, 493, -1, 425, -1, 421, -1, 485, -1, 100,
-  -1, 336, -1, -1, 505, 1321, -1, 505, 1322, -1,
-  -1, 223, 35, 1073, -1, -1, 131, 125, -1, 131,
-  171, -1, -1, 498, 477, -1, 148, 477, -1, -1,
-  231, 35, 1072, -1, -1, 227, 560, 1230, 561, -1,
-  -1, 223, 35, 1072, -1, 172, -1, 326, -1, 33,
-  -1, 212, 560, 1075, 557, 1075, 561, -1, 48, 560,
-  1025, 561, -1, 39, 1075, 1236, 1235, 110, -1, 39,
-  1238, 1235, 110, -1, -1, 108, 1075, -1, 1236, 1237,
-  -1, 1237, -1, 356, 1075, 317, 1075, -1, 1238, 1239,
-  -1, 1239, -1, 356, 1249, 317, 1075, -1, 121, 560,
-  1243, 131, 1075, 561, -1, 422, -1, 401, -1, 423,
-  -1, 519, -1, 365, -1, 200, -1, 81, -1, 142,
-  -1, 193, -1, 271, -1, 191, -1, 535, -1, 490,
-  -1, 272, -1, 194, -1, 195, -1, 143, -1, 144,
-  -1, 145, -1, 82, -1, 83, -1, 84, -1, 85,
-  -1, 366, -1, -1, 218, 1088, -1, 1317, 560, 1247,
-  561, 1244, -1, 1245, -1, -1, 1025, -1, 282, 1273,
-  -1, 276, 1273, -1, 179, 1273, -1, 201, 1273, -1,
-  1249, 222, 1250, -1, 1250, -1, 1250, 364, 1251, -1,
-  1251, -1, 1251, 1252, 1310, -1, 1253, -1, 165, 210,
-  -1, 165, -1, 1253, 11, 1254, -1, 1254, -1, 210,
-  1255, -1, 572, 1255, -1, 1255, -1, 119, 1075, -1,
-  1075, -1, -1, 1258, 1257, 1260, -1, 1259, 1261, 1076,
-  -1, 1259, 1263, 1076, 113, 1318, -1, 1259, 1263, 1076,
-  -1, 1259, 1264, 1076, -1, 1259, 1266, -1, 1259, 1272,
-  1076, -1, 1259, 1267, 1076, 11, 1076, -1, 1259, 1268,
-  1269, -1, 1259, 492, 560, 1270, 561, -1, 1259, 539,
-  -1, 1076, 1260, -1, -1, 1339, -1, 558, 1262, -1,
-  395, 1262, -1, 573, 1262, -1, 396, 1262, -1, 574,
-  1262, -1, 397, 1262, -1, 558, 558, 1262, -1, 572,
-  558, 1262, -1, 52, 1262, -1, -1, 8, -1, 292,
-  -1, 12, -1, 210, 177, -1, 177, -1, 1265, -1,
-  210, 1265, -1, 1265, 26, -1, 210, 1265, 26, -1,
-  258, -1, 248, -1, 165, 210, 211, -1, 165, 211,
-  -1, 210, 24, -1, 24, -1, 150, -1, 210, 150,
-  -1, 1075, -1, 1270, 222, 1271, -1, 1271, -1, 1075,
-  431, 1075, -1, 1075, 432, 1075, -1, 1075, 437, 1075,
-  -1, 1075, 438, 1075, -1, 1075, 558, -1, 1075, 430,
-  188, -1, 1075, 436, 188, -1, 192, 447, 1075, -1,
-  192, 448, 1075, -1, 284, -1, 285, -1, 302, -1,
-  303, -1, 308, -1, 307, -1, 560, 982, 561, -1,
-  1276, 1277, 474, -1, 1276, 1277, 146, -1, 1276, 1277,
-  214, -1, 1276, 392, 562, -1, 1275, -1, 1275, 1277,
-  1278, -1, 1276, -1, 1032, -1, 45, 1278, -1, 1278,
-  -1, 392, -1, 393, -1, 1317, 575, 1317, 576, -1,
-  1317, -1, 1246, -1, 1248, -1, 1317, 392, 1317, -1,
-  1317, -1, -1, 150, -1, 224, -1, 156, -1, 43,
-  -1, 205, 43, -1, 207, -1, 1283, -1, 1281, 560,
-  563, 1324, 561, 1302, 1295, -1, 1284, 1288, -1, 1284,
-  560, 1285, 561, -1, 1284, 560, 561, -1, 1284, 1305,
-  -1, 1305, -1, 1288, -1, 1284, 1305, -1, 1305, -1,
-  1285, 557, 1283, -1, 1283, -1, 43, 1287, -1, 351,
-  -1, 205, 43, 1287, -1, 207, 1287, -1, 27, 1287,
-  -1, -1, 353, -1, 159, 1292, -1, 291, -1, 25,
-  -1, 104, 233, -1, 104, -1, 77, -1, 318, -1,
-  346, -1, 319, -1, 319, 360, 318, 367, -1, 320,
-  -1, 319, 360, 180, 318, 367, -1, 321, -1, 78,
-  -1, 78, 360, 318, 367, -1, 79, -1, 78, 360,
-  180, 318, 367, -1, 80, -1, 199, -1, 214, -1,
-  300, 1302, 1295, -1, 31, 1289, -1, 47, 1289, -1,
-  709, 1290, -1, 1286, 1291, 1302, 1295, -1, 213, 1293,
-  -1, 126, 1291, -1, 111, 560, 690, 561, 1302, 1295,
-  -1, -1, 160, -1, 120, -1, -1, 146, -1, -1,
-  560, 1324, 561, -1, -1, 560, 1324, 561, -1, -1,
-  560, 1324, 561, -1, 560, 1324, 557, 1324, 561, -1,
-  410, -1, 411, -1, -1, 1296, -1, 49, 1320, -1,
-  49, 26, -1, 49, 539, -1, 417, 1299, 1320, -1,
-  -1, 1297, -1, -1, 558, -1, -1, 417, 1301, -1,
-  1320, -1, -1, 1303, -1, 1294, 1320, -1, 1294, 26,
-  -1, 1294, 539, -1, -1, 345, 1320, -1, 345, 539,
-  -1, 345, 26, -1, 283, -1, 202, -1, 277, -1,
-  1313, 1306, -1, -1, 216, -1, 1308, -1, 563, 1324,
-  -1, 563, 1326, -1, 563, 1327, -1, 1309, -1, 1032,
-  -1, 1324, -1, 1326, -1, 1327, -1, 1320, -1, 1322,
-  -1, 1030, -1, 211, -1, 1311, -1, 203, -1, 1329,
-  -1, 1310, -1, 332, -1, 122, -1, 337, -1, 1312,
-  575, 1025, 576, -1, 1312, 575, 576, -1, -1, 1313,
-  -1, 282, -1, 201, -1, 276, -1, 179, -1, 1314,
-  557, 1317, -1, 1317, -1, -1, 560, 1314, 561, -1,
-  1316, 557, 1279, -1, 1279, -1, 539, -1, 540, -1,
-  541, -1, 542, -1, 400, -1, 402, -1, 403, -1,
-  404, -1, 408, -1, 409, -1, 410, -1, 411, -1,
-  412, -1, 413, -1, 414, -1, 415, -1, 416, -1,
-  417, -1, 418, -1, 419, -1, 420, -1, 421, -1,
-  424, -1, 425, -1, 426, -1, 427, -1, 429, -1,
-  430, -1, 431, -1, 432, -1, 433, -1, 434, -1,
-  435, -1, 436, -1, 437, -1, 438, -1, 439, -1,
-  440, -1, 441, -1, 443, -1, 444, -1, 446, -1,
-  445, -1, 449, -1, 447, -1, 448, -1, 450, -1,
-  451, -1, 455, -1, 456, -1, 457, -1, 453, -1,
-  458, -1, 461, -1, 462, -1, 463, -1, 464, -1,
-  465, -1, 467, -1, 468, -1, 469, -1, 471, -1,
-  472, -1, 473, -1, 478, -1, 479, -1, 480, -1,
-  481, -1, 482, -1, 483, -1, 484, -1, 485, -1,
-  488, -1, 489, -1, 491, -1, 492, -1, 493, -1,
-  494, -1, 495, -1, 496, -1, 497, -1, 499, -1,
-  500, -1, 501, -1, 502, -1, 503, -1, 504, -1,
-  505, -1, 506, -1, 507, -1, 509, -1, 510, -1,
-  511, -1, 512, -1, 513, -1, 514, -1, 515, -1,
-  516, -1, 517, -1, 520, -1, 521, -1, 522, -1,
-  523, -1, 524, -1, 525, -1, 526, -1, 527, -1,
-  528, -1, 530, -1, 531, -1, 532, -1, 533, -1,
-  534, -1, 537, -1, 401, -1, 405, -1, 406, -1,
-  407, -1, 422, -1, 423, -1, 442, -1, 452, -1,
-  460, -1, 490, -1, 518, -1, 519, -1, 529, -1,
-  535, -1, 476, -1, 428, -1, 459, -1, 475, -1,
-  498, -1, 477, -1, 466, -1, 486, -1, 487, -1,
-  536, -1, 1319, -1, 211, -1, 1320, -1, 1030, -1,
-  1320, 545, -1, 1321, -1, 545, -1, 546, -1, 552,
-  -1, 553, -1, 554, -1, 555, -1, 1322, 545, -1,
-  1323, -1, 547, -1, 548, -1, 543, -1, 543, -1,
-  544, -1, 368, 1328, -1, 369, 1328, -1, 370, 1328,
-  -1, 371, 1328, -1, 372, 1328, -1, 373, 1328, -1,
-  374, 1328, -1, 375, 1328, -1, 376, 1328, -1, 377,
-  1328, -1, 378, 1328, -1, 379, 1328, -1, 380, 1328,
-  -1, 381, 1328, -1, 382, 1328, -1, 383, 1328, -1,
-  384, 1328, -1, 385, 1328, -1, 386, 1328, -1, 387,
-  1328, -1, 388, 1328, -1, 389, 1328, -1, 390, 1328,
-  -1, 391, 1328, -1, 971, -1, 973, 544, -1, 563,
-  544, -1, 77, 545, -1, 318, 545, -1, 319, 545,
-  -1, 319, 360, 318, 367, 545, -1, 320, 545, -1,
-  321, 545, -1, 319, 360, 180, 318, 367, 545, -1,
-  78, 545, -1, 78, 360, 318, 367, 545, -1, 79,
-  545, -1, 80, 545, -1, 78, 360, 180, 318, 367,
-  545, -1, 659, 14, 982, -1, 231, 1332, 439, 560,
-  1075, 561, 483, 1309, -1, 231, 1332, 492, 560, 1075,
-  561, 560, 1333, 561, -1, 231, 1332, 179, 560, 1075,
-  561, 560, 1333, 561, -1, -1, 35, -1, 1333, 557,
-  1334, -1, 1334, -1, 231, 1317, 349, 175, 523, 465,
-  1300, -1, 231, 1317, 349, 175, 523, 560, 1307, 561,
-  1300, -1, 231, 1317, 349, 150, 560, 1338, 561, 1300,
-  -1, 1331, -1, 495, 482, -1, 496, 231, 1314, 164,
-  560, 1333, 561, -1, 402, 231, 1336, -1, 402, 231,
-  1314, -1, 48, 231, 1309, -1, 240, 231, 1314, -1,
-  -1, 8, -1, 1337, 557, 622, -1, 1337, 557, 1307,
-  -1, 622, -1, 1307, -1, 1338, 557, 1307, -1, 1307,
-  -1, 560, 564, 561, -1, 560, 563, 561, -1, 347,
-  -1
+  1220, 560, 1075, 561, 1229, 227, 560, 1230, 1232, 561,
+  -1, 1221, 560, 1075, 557, 1075, 561, 1228, 1229, 227,
+  560, 1230, 1232, 561, -1, 1222, 560, 1075, 561, 227,
+  560, 1230, 1232, 561, -1, 1222, 560, 1075, 557, 1075,
+  561, 227, 560, 1230, 1232, 561, -1, 1222, 560, 1075,
+  557, 1075, 557, 1075, 561, 227, 560, 1230, 1232, 561,
+  -1, 1224, 560, 561, 227, 560, 1230, 1232, 561, -1,
+  -1, -1, 434, 1094, 560, 1225, 1075, 1227, 1226, 561,
+  1095, -1, 434, 560, 1336, 1247, 1227, 1226, 561, -1,
+  1223, 560, 1075, 561, 536, 140, 560, 223, 35, 1073,
+  561, 1231, -1, -1, -1, 158, 1096, 560, 1025, 561,
+  1097, -1, 426, 560, 1247, 561, -1, 232, 560, 1075,
+  150, 1075, 561, -1, -1, -1, 304, 1098, 560, 1075,
+  131, 1075, 127, 1075, 561, 1099, -1, -1, -1, 304,
+  1100, 560, 1075, 131, 1075, 561, 1101, -1, -1, -1,
+  304, 1102, 560, 1075, 557, 1075, 557, 1075, 561, 1103,
+  -1, -1, -1, 304, 1104, 560, 1075, 557, 1075, 561,
+  1105, -1, -1, -1, 77, 1106, 560, 1075, 561, 1107,
+  -1, -1, -1, 318, 1108, 560, 1075, 561, 1109, -1,
+  -1, -1, 401, 1110, 560, 1075, 557, 1075, 561, 1111,
+  -1, -1, -1, 1241, 1112, 560, 1075, 557, 163, 1075,
+  1243, 561, 1113, -1, -1, -1, 519, 1114, 560, 1075,
+  557, 1075, 561, 1115, -1, -1, -1, 1242, 1116, 560,
+  1075, 557, 163, 1075, 1243, 561, 1117, -1, -1, -1,
+  319, 1118, 560, 1075, 561, 1119, -1, -1, -1, 319,
+  1120, 560, 1075, 557, 1075, 561, 1121, -1, -1, -1,
+  365, 1122, 560, 1075, 561, 1123, -1, -1, -1, 200,
+  1124, 560, 1075, 561, 1125, -1, -1, -1, 81, 1126,
+  560, 1075, 561, 1127, -1, -1, -1, 142, 1128, 560,
+  1075, 561, 1129, -1, -1, -1, 193, 1130, 560, 1075,
+  561, 1131, -1, -1, -1, 271, 1132, 560, 1075, 561,
+  1133, -1, -1, -1, 75, 1134, 560, 561, 1135, -1,
+  -1, -1, 267, 1136, 560, 561, 1137, -1, -1, -1,
+  331, 1138, 560, 1233, 1075, 131, 1075, 561, 1139, -1,
+  -1, -1, 331, 1140, 560, 1233, 131, 1075, 561, 1141,
+  -1, -1, -1, 331, 1142, 560, 1075, 131, 1075, 561,
+  1143, -1, -1, -1, 331, 1144, 560, 1075, 561, 1145,
+  -1, -1, -1, 412, 1146, 560, 1075, 1304, 561, 1147,
+  -1, -1, -1, 413, 1148, 560, 1075, 1304, 561, 1149,
+  -1, -1, -1, 40, 1150, 560, 1075, 14, 1282, 561,
+  1151, -1, 45, 560, 1317, 561, -1, 310, -1, 1203,
+  -1, 312, -1, 1205, -1, 1207, -1, 1209, -1, 313,
+  -1, 1211, -1, 311, -1, 1215, -1, 1217, -1, -1,
+  -1, 1217, 1152, 560, 561, 1153, -1, -1, -1, 89,
+  560, 1154, 1279, 561, 1155, -1, 181, -1, 264, -1,
+  -1, -1, 6, 1156, 560, 1075, 557, 1075, 561, 1157,
+  -1, -1, -1, 215, 1158, 560, 1075, 561, 1159, -1,
+  -1, -1, 28, 1160, 560, 1075, 561, 1161, -1, -1,
+  -1, 185, 1162, 560, 1075, 561, 1163, -1, -1, -1,
+  460, 1164, 560, 1075, 561, 1165, -1, -1, -1, 341,
+  1166, 560, 1075, 561, 1167, -1, -1, -1, 529, 1168,
+  560, 1075, 561, 1169, -1, -1, -1, 309, 1170, 560,
+  1075, 557, 1320, 561, 1171, -1, -1, -1, 147, 1172,
+  560, 1249, 557, 1075, 557, 1075, 561, 1173, -1, -1,
+  -1, 442, 1174, 560, 1075, 557, 1075, 561, 1175, -1,
+  -1, -1, 452, 1176, 560, 1075, 561, 1177, -1, -1,
+  -1, 174, 1178, 560, 1075, 557, 1075, 561, 1179, -1,
+  -1, -1, 257, 1180, 560, 1075, 557, 1075, 561, 1181,
+  -1, -1, -1, 196, 1182, 560, 1075, 557, 1075, 561,
+  1183, -1, -1, -1, 333, 1184, 560, 1075, 557, 1075,
+  561, 1185, -1, -1, -1, 328, 1186, 560, 1075, 557,
+  1075, 557, 1075, 561, 1187, -1, -1, -1, 251, 1188,
+  560, 1075, 557, 1075, 557, 1075, 561, 1189, -1, -1,
+  -1, 251, 1190, 560, 1075, 557, 1075, 561, 1191, -1,
+  -1, -1, 518, 1192, 560, 1075, 557, 1319, 561, 1193,
+  -1, -1, -1, 518, 1194, 560, 1075, 557, 211, 561,
+  1195, -1, -1, -1, 411, 1196, 560, 1075, 561, 1197,
+  -1, -1, -1, 415, 1198, 560, 1075, 561, 1199, -1,
+  1202, 560, 1025, 561, 536, 140, 560, 223, 35, 1072,
+  561, -1, -1, -1, 446, 1200, 560, 1075, 557, 1075,
+  557, 1075, 561, 1201, -1, 421, -1, 485, -1, 67,
+  -1, -1, 67, 1204, 560, 561, -1, 69, -1, -1,
+  69, 1206, 560, 561, -1, 86, -1, -1, 86, 1208,
+  560, 561, -1, 280, -1, -1, 280, 1210, 560, 561,
+  -1, 70, -1, -1, 70, 1212, 560, 561, -1, 183,
+  -1, -1, 183, 1213, 560, 561, -1, 182, -1, -1,
+  182, 1214, 560, 561, -1, 68, -1, -1, 68, 1216,
+  560, 561, -1, 71, -1, 314, -1, 344, -1, 21,
+  -1, 188, -1, 192, -1, 305, -1, 515, -1, 516,
+  -1, 517, -1, 531, -1, 532, -1, 533, -1, 405,
+  -1, 406, -1, 407, -1, 466, -1, 21, -1, 188,
+  -1, 192, -1, 305, -1, 515, -1, 516, -1, 517,
+  -1, 531, -1, 532, -1, 533, -1, 476, -1, 466,
+  -1, 428, -1, 459, -1, 475, -1, 461, -1, 458,
+  -1, 486, -1, 487, -1, 503, -1, 493, -1, 425,
+  -1, 421, -1, 485, -1, 100, -1, 336, -1, -1,
+  505, 1321, -1, 505, 1322, -1, -1, 223, 35, 1073,
+  -1, -1, 131, 125, -1, 131, 171, -1, -1, 498,
+  477, -1, 148, 477, -1, -1, 231, 35, 1072, -1,
+  -1, 227, 560, 1230, 561, -1, -1, 223, 35, 1072,
+  -1, 172, -1, 326, -1, 33, -1, 212, 560, 1075,
+  557, 1075, 561, -1, 48, 560, 1025, 561, -1, 39,
+  1075, 1236, 1235, 110, -1, 39, 1238, 1235, 110, -1,
+  -1, 108, 1075, -1, 1236, 1237, -1, 1237, -1, 356,
+  1075, 317, 1075, -1, 1238, 1239, -1, 1239, -1, 356,
+  1249, 317, 1075, -1, 121, 560, 1243, 131, 1075, 561,
+  -1, 422, -1, 401, -1, 423, -1, 519, -1, 365,
+  -1, 200, -1, 81, -1, 142, -1, 193, -1, 271,
+  -1, 191, -1, 535, -1, 490, -1, 272, -1, 194,
+  -1, 195, -1, 143, -1, 144, -1, 145, -1, 82,
+  -1, 83, -1, 84, -1, 85, -1, 366, -1, -1,
+  218, 1088, -1, 1317, 560, 1247, 561, 1244, -1, 1245,
+  -1, -1, 1025, -1, 282, 1273, -1, 276, 1273, -1,
+  179, 1273, -1, 201, 1273, -1, 1249, 222, 1250, -1,
+  1250, -1, 1250, 364, 1251, -1, 1251, -1, 1251, 1252,
+  1310, -1, 1253, -1, 165, 210, -1, 165, -1, 1253,
+  11, 1254, -1, 1254, -1, 210, 1255, -1, 572, 1255,
+  -1, 1255, -1, 119, 1075, -1, 1075, -1, -1, 1258,
+  1257, 1260, -1, 1259, 1261, 1076, -1, 1259, 1263, 1076,
+  113, 1318, -1, 1259, 1263, 1076, -1, 1259, 1264, 1076,
+  -1, 1259, 1266, -1, 1259, 1272, 1076, -1, 1259, 1267,
+  1076, 11, 1076, -1, 1259, 1268, 1269, -1, 1259, 492,
+  560, 1270, 561, -1, 1259, 539, -1, 1076, 1260, -1,
+  -1, 1339, -1, 558, 1262, -1, 395, 1262, -1, 573,
+  1262, -1, 396, 1262, -1, 574, 1262, -1, 397, 1262,
+  -1, 558, 558, 1262, -1, 572, 558, 1262, -1, 52,
+  1262, -1, -1, 8, -1, 292, -1, 12, -1, 210,
+  177, -1, 177, -1, 1265, -1, 210, 1265, -1, 1265,
+  26, -1, 210, 1265, 26, -1, 258, -1, 248, -1,
+  165, 210, 211, -1, 165, 211, -1, 210, 24, -1,
+  24, -1, 150, -1, 210, 150, -1, 1075, -1, 1270,
+  222, 1271, -1, 1271, -1, 1075, 431, 1075, -1, 1075,
+  432, 1075, -1, 1075, 437, 1075, -1, 1075, 438, 1075,
+  -1, 1075, 558, -1, 1075, 430, 188, -1, 1075, 436,
+  188, -1, 192, 447, 1075, -1, 192, 448, 1075, -1,
+  284, -1, 285, -1, 302, -1, 303, -1, 308, -1,
+  307, -1, 560, 982, 561, -1, 1276, 1277, 474, -1,
+  1276, 1277, 146, -1, 1276, 1277, 214, -1, 1276, 392,
+  562, -1, 1275, -1, 1275, 1277, 1278, -1, 1276, -1,
+  1032, -1, 45, 1278, -1, 1278, -1, 392, -1, 393,
+  -1, 1317, 575, 1317, 576, -1, 1317, -1, 1246, -1,
+  1248, -1, 1317, 392, 1317, -1, 1317, -1, -1, 150,
+  -1, 224, -1, 156, -1, 43, -1, 205, 43, -1,
+  207, -1, 1283, -1, 1281, 560, 563, 1324, 561, 1302,
+  1295, -1, 1284, 1288, -1, 1284, 560, 1285, 561, -1,
+  1284, 560, 561, -1, 1284, 1305, -1, 1305, -1, 1288,
+  -1, 1284, 1305, -1, 1305, -1, 1285, 557, 1283, -1,
+  1283, -1, 43, 1287, -1, 351, -1, 205, 43, 1287,
+  -1, 207, 1287, -1, 27, 1287, -1, -1, 353, -1,
+  159, 1292, -1, 291, -1, 25, -1, 104, 233, -1,
+  104, -1, 77, -1, 318, -1, 346, -1, 319, -1,
+  319, 360, 318, 367, -1, 320, -1, 319, 360, 180,
+  318, 367, -1, 321, -1, 78, -1, 78, 360, 318,
+  367, -1, 79, -1, 78, 360, 180, 318, 367, -1,
+  80, -1, 199, -1, 214, -1, 300, 1302, 1295, -1,
+  31, 1289, -1, 47, 1289, -1, 709, 1290, -1, 1286,
+  1291, 1302, 1295, -1, 213, 1293, -1, 126, 1291, -1,
+  111, 560, 690, 561, 1302, 1295, -1, -1, 160, -1,
+  120, -1, -1, 146, -1, -1, 560, 1324, 561, -1,
+  -1, 560, 1324, 561, -1, -1, 560, 1324, 561, -1,
+  560, 1324, 557, 1324, 561, -1, 410, -1, 411, -1,
+  -1, 1296, -1, 49, 1320, -1, 49, 26, -1, 49,
+  539, -1, 417, 1299, 1320, -1, -1, 1297, -1, -1,
+  558, -1, -1, 417, 1301, -1, 1320, -1, -1, 1303,
+  -1, 1294, 1320, -1, 1294, 26, -1, 1294, 539, -1,
+  -1, 345, 1320, -1, 345, 539, -1, 345, 26, -1,
+  283, -1, 202, -1, 277, -1, 1313, 1306, -1, -1,
+  216, -1, 1308, -1, 563, 1324, -1, 563, 1326, -1,
+  563, 1327, -1, 1309, -1, 1032, -1, 1324, -1, 1326,
+  -1, 1327, -1, 1320, -1, 1322, -1, 1030, -1, 211,
+  -1, 1311, -1, 203, -1, 1329, -1, 1310, -1, 332,
+  -1, 122, -1, 337, -1, 1312, 575, 1025, 576, -1,
+  1312, 575, 576, -1, -1, 1313, -1, 282, -1, 201,
+  -1, 276, -1, 179, -1, 1314, 557, 1317, -1, 1317,
+  -1, -1, 560, 1314, 561, -1, 1316, 557, 1279, -1,
+  1279, -1, 539, -1, 540, -1, 541, -1, 542, -1,
+  400, -1, 402, -1, 403, -1, 404, -1, 408, -1,
+  409, -1, 410, -1, 411, -1, 412, -1, 413, -1,
+  414, -1, 415, -1, 416, -1, 417, -1, 418, -1,
+  419, -1, 420, -1, 421, -1, 424, -1, 425, -1,
+  426, -1, 427, -1, 429, -1, 430, -1, 431, -1,
+  432, -1, 433, -1, 434, -1, 435, -1, 436, -1,
+  437, -1, 438, -1, 439, -1, 440, -1, 441, -1,
+  443, -1, 444, -1, 446, -1, 445, -1, 449, -1,
+  447, -1, 448, -1, 450, -1, 451, -1, 455, -1,
+  456, -1, 457, -1, 453, -1, 458, -1, 461, -1,
+  462, -1, 463, -1, 464, -1, 465, -1, 467, -1,
+  468, -1, 469, -1, 471, -1, 472, -1, 473, -1,
+  478, -1, 479, -1, 480, -1, 481, -1, 482, -1,
+  483, -1, 484, -1, 485, -1, 488, -1, 489, -1,
+  491, -1, 492, -1, 493, -1, 494, -1, 495, -1,
+  496, -1, 497, -1, 499, -1, 500, -1, 501, -1,
+  502, -1, 503, -1, 504, -1, 505, -1, 506, -1,
+  507, -1, 509, -1, 510, -1, 511, -1, 512, -1,
+  513, -1, 514, -1, 515, -1, 516, -1, 517, -1,
+  520, -1, 521, -1, 522, -1, 523, -1, 524, -1,
+  525, -1, 526, -1, 527, -1, 528, -1, 530, -1,
+  531, -1, 532, -1, 533, -1, 534, -1, 537, -1,
+  401, -1, 405, -1, 406, -1, 407, -1, 422, -1,
+  423, -1, 442, -1, 452, -1, 460, -1, 490, -1,
+  518, -1, 519, -1, 529, -1, 535, -1, 476, -1,
+  428, -1, 459, -1, 475, -1, 498, -1, 477, -1,
+  466, -1, 486, -1, 487, -1, 536, -1, 1319, -1,
+  211, -1, 1320, -1, 1030, -1, 1320, 545, -1, 1321,
+  -1, 545, -1, 546, -1, 552, -1, 553, -1, 554,
+  -1, 555, -1, 1322, 545, -1, 1323, -1, 547, -1,
+  548, -1, 543, -1, 543, -1, 544, -1, 368, 1328,
+  -1, 369, 1328, -1, 370, 1328, -1, 371, 1328, -1,
+  372, 1328, -1, 373, 1328, -1, 374, 1328, -1, 375,
+  1328, -1, 376, 1328, -1, 377, 1328, -1, 378, 1328,
+  -1, 379, 1328, -1, 380, 1328, -1, 381, 1328, -1,
+  382, 1328, -1, 383, 1328, -1, 384, 1328, -1, 385,
+  1328, -1, 386, 1328, -1, 387, 1328, -1, 388, 1328,
+  -1, 389, 1328, -1, 390, 1328, -1, 391, 1328, -1,
+  971, -1, 973, 544, -1, 563, 544, -1, 77, 545,
+  -1, 318, 545, -1, 319, 545, -1, 319, 360, 318,
+  367, 545, -1, 320, 545, -1, 321, 545, -1, 319,
+  360, 180, 318, 367, 545, -1, 78, 545, -1, 78,
+  360, 318, 367, 545, -1, 79, 545, -1, 80, 545,
+  -1, 78, 360, 180, 318, 367, 545, -1, 659, 14,
+  982, -1, 231, 1332, 439, 560, 1075, 561, 483, 1309,
+  -1, 231, 1332, 492, 560, 1075, 561, 560, 1333, 561,
+  -1, 231, 1332, 179, 560, 1075, 561, 560, 1333, 561,
+  -1, -1, 35, -1, 1333, 557, 1334, -1, 1334, -1,
+  231, 1317, 349, 175, 523, 465, 1300, -1, 231, 1317,
+  349, 175, 523, 560, 1307, 561, 1300, -1, 231, 1317,
+  349, 150, 560, 1338, 561, 1300, -1, 1331, -1, 495,
+  482, -1, 496, 231, 1314, 164, 560, 1333, 561, -1,
+  402, 231, 1336, -1, 402, 231, 1314, -1, 48, 231,
+  1309, -1, 240, 231, 1314, -1, -1, 8, -1, 1337,
+  557, 622, -1, 1337, 557, 1307, -1, 622, -1, 1307,
+  -1, 1338, 557, 1307, -1, 1307, -1, 560, 564, 561,
+  -1, 560, 563, 561, -1, 347, -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
@@ -1116,151 +1116,151 @@ static const unsigned short int yyrline[] = {
   6450, 6472, 6494, 6508, 6523, 6544, 6556, 6574, 6591, 6604,
   6619, 6637, 6650, 6664, 6674, 6684, 6693, 6702, 6715, 6727,
   6737, 6749, 6761, 6776, 6789, 6807, 6811, 6815, 6819, 6823,
-  6827, 6831, 6835, 6842, 6846, 6850, 6857, 6861, 6865, 6869,
-  6873, 6877, 6884, 6888, 6892, 6896, 6900, 6904, 6908, 6912,
-  6919, 6926, 6930, 6937, 6941, 6948, 6952, 6959, 6963, 6970,
-  6974, 6981, 6992, 6999, 7006, 7013, 7023, 7027, 7031, 7039,
-  7044, 7053, 7054, 7057, 7059, 7060, 7064, 7065, 7066, 7070,
-  7071, 7072, 7077, 7076, 7086, 7085, 7193, 7216, 7224, 7229,
-  7223, 7240, 7270, 7275, 7282, 7292, 7299, 7308, 7315, 7329,
-  7441, 7460, 7467, 7476, 7485, 7497, 7503, 7512, 7521, 7530,
-  7539, 7552, 7551, 7660, 7659, 7689, 7692, 7695, 7699, 7706,
-  7728, 7747, 7752, 7762, 7779, 7795, 7815, 7817, 7814, 7823,
-  7825, 7822, 7830, 7846, 7866, 7871, 7881, 7883, 7880, 7889,
-  7891, 7888, 7897, 7899, 7896, 7904, 7911, 7921, 7931, 7946,
-  7961, 7977, 7995, 8010, 8025, 8040, 8055, 8070, 8085, 8100,
-  8119, 8125, 8127, 8124, 8138, 8144, 8146, 8143, 8157, 8163,
-  8165, 8162, 8175, 8196, 8201, 8212, 8217, 8228, 8233, 8244,
-  8249, 8260, 8265, 8276, 8281, 8292, 8299, 8308, 8314, 8323,
-  8324, 8329, 8334, 8344, 8349, 8359, 8364, 8374, 8379, 8390,
-  8395, 8406, 8411, 8417, 8423, 8432, 8439, 8449, 8456, 8466,
-  8487, 8510, 8517, 8524, 8534, 8541, 8558, 8565, 8572, 8583,
-  8588, 8595, 8606, 8611, 8622, 8627, 8637, 8644, 8651, 8662,
-  8670, 8679, 8700, 8709, 8725, 8797, 8829, 8836, 8846, 8861,
-  8866, 8872, 8882, 8887, 8898, 8906, 8920, 8934, 8948, 8962,
-  8976, 8990, 9004, 9018, 9026, 9034, 9042, 9050, 9058, 9066,
-  9078, 9098, 9109, 9120, 9131, 9145, 9152, 9162, 9191, 9196,
-  9203, 9212, 9219, 9229, 9249, 9256, 9266, 9271, 9281, 9288,
-  9298, 9312, 9319, 9321, 9317, 9331, 9338, 9348, 9348, 9348,
-  9355, 9365, 9372, 9382, 9389, 9409, 9416, 9426, 9433, 9443,
-  9450, 9457, 9467, 9530, 9598, 9596, 9644, 9649, 9668, 9691,
-  9692, 9697, 9731, 9738, 9742, 9746, 9750, 9754, 9758, 9762,
-  9766, 9773, 9815, 9849, 9878, 9918, 9948, 9997, 9998, 10001,
-  10003, 10004, 10007, 10009, 10012, 10014, 10018, 10058, 10078, 10098,
-  10188, 10199, 10206, 10216, 10296, 10322, 10341, 10350, 10359, 10368,
-  10377, 10390, 10407, 10422, 10438, 10456, 10457, 10461, 10467, 10476,
-  10491, 10506, 10513, 10520, 10527, 10538, 10552, 10560, 10574, 10582,
-  10599, 10601, 10604, 10606, 10609, 10611, 10615, 10633, 10651, 10672,
-  10678, 10680, 10677, 10691, 10696, 10705, 10711, 10721, 10726, 10736,
-  10747, 10752, 10762, 10768, 10774, 10784, 10789, 10795, 10804, 10818,
-  10836, 10842, 10848, 10854, 10860, 10866, 10872, 10878, 10887, 10902,
-  10919, 10926, 10936, 10950, 10964, 10979, 10994, 11009, 11024, 11039,
-  11054, 11072, 11086, 11103, 11111, 11119, 11129, 11131, 11135, 11150,
-  11165, 11172, 11179, 11189, 11196, 11203, 11213, 11233, 11254, 11272,
-  11283, 11301, 11312, 11320, 11331, 11339, 11349, 11355, 11364, 11372,
-  11374, 11379, 11384, 11390, 11398, 11400, 11401, 11406, 11411, 11421,
-  11428, 11438, 11459, 11483, 11489, 11498, 11498, 11510, 11526, 11533,
-  11510, 11598, 11614, 11621, 11598, 11685, 11703, 11708, 11751, 11702,
-  11785, 11796, 11801, 11844, 11795, 11877, 11887, 11902, 11918, 11934,
-  11950, 11969, 11976, 11983, 11991, 11998, 12009, 12008, 12075, 12083,
-  12090, 12112, 12136, 12111, 12164, 12169, 12192, 12196, 12204, 12211,
-  12221, 12245, 12263, 12274, 12313, 12311, 12439, 12444, 12451, 12460,
-  12462, 12466, 12474, 12482, 12490, 12498, 12506, 12518, 12523, 12529,
-  12535, 12544, 12555, 12567, 12576, 12576, 12602, 12609, 12624, 12669,
-  12689, 12698, 12711, 12723, 12730, 12740, 12748, 12764, 12783, 12798,
-  12813, 12828, 12847, 12868, 12896, 12912, 12941, 12953, 12958, 12958,
-  12981, 12988, 12996, 13004, 13014, 13014, 13028, 13028, 13047, 13049,
-  13064, 13069, 13080, 13085, 13094, 13101, 13114, 13114, 13170, 13175,
-  13175, 13188, 13193, 13200, 13217, 13256, 13263, 13273, 13280, 13290,
-  13316, 13341, 13351, 13361, 13371, 13381, 13397, 13402, 13409, 13418,
-  13420, 13440, 13484, 13491, 13501, 13526, 13533, 13543, 13569, 13572,
-  13570, 13589, 13593, 13618, 13590, 13785, 13787, 13804, 13810, 13816,
-  13825, 13831, 13837, 13846, 13853, 13861, 13876, 13878, 13948, 13961,
-  13980, 14003, 14004, 14015, 14016, 14038, 14045, 14055, 14070, 14086,
-  14106, 14111, 14117, 14126, 14133, 14144, 14151, 14161, 14168, 14178,
-  14185, 14195, 14202, 14212, 14219, 14226, 14236, 14243, 14250, 14260,
-  14267, 14274, 14281, 14288, 14298, 14305, 14315, 14322, 14329, 14336,
-  14344, 14343, 14373, 14372, 14404, 14425, 14436, 14443, 14450, 14457,
-  14464, 14473, 14480, 14530, 14545, 14551, 14562, 14561, 14579, 14589,
-  14596, 14603, 14614, 14631, 14650, 14667, 14686, 14703, 14722, 14744,
-  14761, 14783, 14802, 14827, 14865, 14898, 14925, 14946, 14976, 14978,
-  14975, 14995, 15020, 15073, 15075, 15072, 15092, 15109, 15117, 15119,
-  15116, 15130, 15132, 15129, 15143, 15145, 15142, 15156, 15158, 15155,
-  15169, 15171, 15168, 15181, 15183, 15180, 15193, 15195, 15192, 15205,
-  15207, 15204, 15226, 15228, 15225, 15238, 15240, 15237, 15259, 15261,
-  15258, 15278, 15280, 15277, 15290, 15292, 15289, 15302, 15304, 15301,
-  15314, 15316, 15313, 15326, 15328, 15325, 15338, 15340, 15337, 15350,
-  15352, 15349, 15362, 15364, 15361, 15374, 15376, 15373, 15386, 15388,
-  15385, 15399, 15401, 15398, 15412, 15414, 15411, 15425, 15427, 15424,
-  15438, 15440, 15437, 15450, 15452, 15449, 15462, 15464, 15461, 15496,
-  15505, 15513, 15521, 15529, 15537, 15545, 15553, 15561, 15569, 15577,
-  15585, 15598, 15600, 15597, 15610, 15612, 15609, 15628, 15641, 15663,
-  15665, 15662, 15673, 15675, 15672, 15683, 15685, 15682, 15693, 15695,
-  15692, 15703, 15705, 15702, 15713, 15715, 15712, 15723, 15725, 15722,
-  15733, 15744, 15732, 15767, 15769, 15766, 15777, 15779, 15776, 15787,
-  15789, 15786, 15797, 15799, 15796, 15809, 15811, 15808, 15821, 15823,
-  15820, 15833, 15835, 15832, 15843, 15845, 15842, 15853, 15855, 15852,
-  15863, 15865, 15862, 15873, 15875, 15872, 15883, 15885, 15882, 15899,
-  15901, 15898, 15911, 15913, 15910, 15922, 15939, 15941, 15938, 15951,
-  15956, 15963, 15965, 15964, 15971, 15973, 15972, 15979, 15981, 15980,
-  15987, 15989, 15988, 15995, 15997, 15996, 16000, 16002, 16001, 16005,
-  16007, 16006, 16013, 16015, 16014, 16020, 16021, 16022, 16026, 16032,
-  16038, 16044, 16050, 16056, 16062, 16068, 16074, 16080, 16086, 16092,
-  16098, 16104, 16113, 16119, 16125, 16131, 16137, 16143, 16149, 16155,
-  16161, 16167, 16173, 16179, 16189, 16195, 16204, 16213, 16219, 16229,
-  16235, 16244, 16250, 16256, 16262, 16267, 16276, 16277, 16282, 16287,
-  16294, 16305, 16310, 16321, 16326, 16332, 16342, 16347, 16353, 16363,
-  16368, 16389, 16395, 16406, 16411, 16430, 16436, 16442, 16451, 16456,
-  16522, 16580, 16629, 16634, 16644, 16651, 16661, 16693, 16700, 16710,
-  16739, 16753, 16754, 16758, 16759, 16763, 16769, 16775, 16781, 16787,
-  16793, 16799, 16805, 16811, 16817, 16823, 16829, 16835, 16841, 16847,
-  16853, 16859, 16865, 16871, 16877, 16887, 16892, 16902, 16929, 16972,
-  16977, 16987, 17001, 17015, 17029, 17046, 17054, 17064, 17072, 17081,
-  17088, 17098, 17104, 17113, 17121, 17131, 17139, 17147, 17157, 17164,
-  17175, 17174, 17269, 17376, 17385, 17400, 17420, 17427, 17434, 17442,
-  17572, 17579, 17588, 17608, 17613, 17622, 17642, 17662, 17682, 17702,
-  17722, 17742, 17749, 17756, 17766, 17771, 17777, 17783, 17792, 17798,
-  17807, 17813, 17819, 17825, 17834, 17835, 17839, 17845, 17855, 17861,
-  17870, 17876, 17885, 17926, 17933, 17943, 17950, 17957, 17964, 17971,
-  17978, 17985, 17992, 17999, 18009, 18015, 18021, 18027, 18033, 18039,
-  18048, 18069, 18081, 18088, 18101, 18121, 18199, 18213, 18223, 18230,
-  18239, 18252, 18253, 18257, 18269, 18276, 18283, 18293, 18307, 18318,
-  18323, 18329, 18335, 18344, 18350, 18356, 18365, 18370, 18448, 18473,
-  18487, 18498, 18517, 18527, 18536, 18542, 18551, 18584, 18620, 18629,
-  18635, 18644, 18653, 18666, 18671, 18680, 18688, 18696, 18704, 18712,
-  18720, 18728, 18736, 18744, 18752, 18760, 18768, 18776, 18784, 18792,
-  18800, 18808, 18816, 18824, 18832, 18840, 18902, 18910, 18918, 18936,
-  19102, 19150, 19196, 19309, 19314, 19320, 19330, 19335, 19345, 19350,
-  19360, 19365, 19375, 19382, 19390, 19401, 19402, 19407, 19412, 19421,
-  19427, 19444, 19464, 19488, 19489, 19493, 19495, 19500, 19501, 19506,
-  19530, 19535, 19544, 19550, 19567, 19588, 19604, 19631, 19670, 19689,
-  19695, 19701, 19707, 19715, 19717, 19721, 19728, 19777, 19817, 19841,
-  19848, 19858, 19865, 19872, 19879, 19890, 19897, 19904, 19914, 19921,
-  19931, 19938, 19948, 19962, 19976, 19989, 20017, 20036, 20041, 20050,
-  20056, 20062, 20068, 20077, 20084, 20095, 20098, 20105, 20112, 20122,
-  20142, 20162, 20182, 20203, 20213, 20223, 20233, 20243, 20253, 20263,
-  20273, 20283, 20293, 20303, 20313, 20323, 20333, 20343, 20353, 20363,
-  20372, 20383, 20393, 20403, 20413, 20423, 20433, 20443, 20453, 20463,
-  20473, 20483, 20493, 20503, 20513, 20523, 20533, 20543, 20553, 20563,
-  20573, 20583, 20593, 20603, 20613, 20623, 20633, 20643, 20653, 20663,
-  20672, 20682, 20692, 20702, 20712, 20722, 20732, 20742, 20752, 20762,
-  20772, 20782, 20792, 20802, 20812, 20822, 20832, 20842, 20852, 20862,
-  20872, 20884, 20894, 20904, 20914, 20924, 20934, 20944, 20954, 20964,
-  20974, 20984, 20994, 21004, 21014, 21024, 21034, 21044, 21054, 21064,
-  21074, 21084, 21094, 21104, 21114, 21124, 21134, 21144, 21154, 21164,
-  21174, 21183, 21193, 21203, 21213, 21223, 21233, 21243, 21253, 21263,
-  21273, 21283, 21293, 21303, 21313, 21323, 21333, 21343, 21353, 21363,
-  21373, 21383, 21393, 21403, 21413, 21423, 21433, 21444, 21457, 21470,
-  21483, 21496, 21509, 21522, 21535, 21548, 21561, 21577, 21585, 21598,
-  21609, 21620, 21637, 21647, 21684, 21721, 21742, 21763, 21784, 21809,
-  21826, 21836, 21854, 21875, 21927, 21954, 22009, 22027, 22045, 22063,
-  22081, 22098, 22115, 22132, 22149, 22166, 22183, 22200, 22217, 22234,
-  22251, 22268, 22285, 22302, 22319, 22336, 22353, 22370, 22387, 22404,
-  22424, 22430, 22436, 22445, 22454, 22463, 22472, 22481, 22490, 22499,
-  22508, 22517, 22526, 22535, 22544, 22556, 22565, 22579, 22595, 22613,
-  22615, 22619, 22626, 22636, 22652, 22668, 22687, 22699, 22708, 22721,
-  22733, 22745, 22757, 22771, 22773, 22777, 22784, 22791, 22798, 22808,
-  22815, 22825, 22829, 22843
+  6827, 6831, 6835, 6839, 6846, 6850, 6854, 6861, 6865, 6869,
+  6873, 6877, 6881, 6885, 6892, 6896, 6900, 6904, 6908, 6912,
+  6916, 6920, 6927, 6934, 6938, 6945, 6949, 6956, 6960, 6967,
+  6971, 6978, 6982, 6989, 7000, 7007, 7014, 7021, 7031, 7035,
+  7039, 7047, 7052, 7061, 7062, 7065, 7067, 7068, 7072, 7073,
+  7074, 7078, 7079, 7080, 7085, 7084, 7094, 7093, 7201, 7224,
+  7232, 7237, 7231, 7248, 7278, 7283, 7290, 7300, 7307, 7316,
+  7323, 7337, 7449, 7468, 7475, 7484, 7493, 7505, 7511, 7520,
+  7529, 7538, 7547, 7560, 7559, 7668, 7667, 7697, 7700, 7703,
+  7707, 7714, 7736, 7755, 7760, 7770, 7787, 7803, 7823, 7825,
+  7822, 7831, 7833, 7830, 7838, 7854, 7874, 7879, 7889, 7891,
+  7888, 7897, 7899, 7896, 7905, 7907, 7904, 7912, 7919, 7929,
+  7939, 7954, 7969, 7985, 8003, 8018, 8033, 8048, 8063, 8078,
+  8093, 8108, 8127, 8133, 8135, 8132, 8146, 8152, 8154, 8151,
+  8165, 8171, 8173, 8170, 8183, 8204, 8209, 8220, 8225, 8236,
+  8241, 8252, 8257, 8268, 8273, 8284, 8289, 8300, 8307, 8316,
+  8322, 8331, 8332, 8337, 8342, 8352, 8357, 8367, 8372, 8382,
+  8387, 8398, 8403, 8414, 8419, 8425, 8431, 8440, 8447, 8457,
+  8464, 8474, 8495, 8518, 8525, 8532, 8542, 8549, 8566, 8573,
+  8580, 8591, 8596, 8603, 8614, 8619, 8630, 8635, 8645, 8652,
+  8659, 8670, 8678, 8687, 8708, 8717, 8733, 8805, 8837, 8844,
+  8854, 8869, 8874, 8880, 8890, 8895, 8906, 8914, 8928, 8942,
+  8956, 8970, 8984, 8998, 9012, 9026, 9034, 9042, 9050, 9058,
+  9066, 9074, 9086, 9106, 9117, 9128, 9139, 9153, 9160, 9170,
+  9199, 9204, 9211, 9220, 9227, 9237, 9257, 9264, 9274, 9279,
+  9289, 9296, 9306, 9320, 9327, 9329, 9325, 9339, 9346, 9356,
+  9356, 9356, 9363, 9373, 9380, 9390, 9397, 9417, 9424, 9434,
+  9441, 9451, 9458, 9465, 9475, 9538, 9606, 9604, 9652, 9657,
+  9676, 9699, 9700, 9705, 9739, 9746, 9750, 9754, 9758, 9762,
+  9766, 9770, 9774, 9781, 9823, 9857, 9886, 9926, 9956, 10005,
+  10006, 10009, 10011, 10012, 10015, 10017, 10020, 10022, 10026, 10066,
+  10086, 10106, 10196, 10207, 10214, 10224, 10304, 10330, 10349, 10358,
+  10367, 10376, 10385, 10398, 10415, 10430, 10446, 10464, 10465, 10469,
+  10475, 10484, 10499, 10514, 10521, 10528, 10535, 10546, 10560, 10568,
+  10582, 10590, 10607, 10609, 10612, 10614, 10617, 10619, 10623, 10641,
+  10659, 10680, 10686, 10688, 10685, 10699, 10704, 10713, 10719, 10729,
+  10734, 10744, 10755, 10760, 10770, 10776, 10782, 10792, 10797, 10803,
+  10812, 10826, 10844, 10850, 10856, 10862, 10868, 10874, 10880, 10886,
+  10895, 10910, 10927, 10934, 10944, 10958, 10972, 10987, 11002, 11017,
+  11032, 11047, 11062, 11080, 11094, 11111, 11119, 11127, 11137, 11139,
+  11143, 11158, 11173, 11180, 11187, 11197, 11204, 11211, 11221, 11241,
+  11262, 11280, 11291, 11309, 11320, 11328, 11339, 11347, 11357, 11363,
+  11372, 11380, 11382, 11387, 11392, 11398, 11406, 11408, 11409, 11414,
+  11419, 11429, 11436, 11446, 11467, 11491, 11497, 11506, 11506, 11518,
+  11534, 11541, 11518, 11606, 11622, 11629, 11606, 11693, 11711, 11716,
+  11759, 11710, 11793, 11804, 11809, 11852, 11803, 11885, 11895, 11910,
+  11926, 11942, 11958, 11977, 11984, 11991, 11999, 12006, 12017, 12016,
+  12083, 12091, 12098, 12120, 12144, 12119, 12172, 12177, 12200, 12204,
+  12212, 12219, 12229, 12253, 12271, 12282, 12321, 12319, 12447, 12452,
+  12459, 12468, 12470, 12474, 12482, 12490, 12498, 12506, 12514, 12526,
+  12531, 12537, 12543, 12552, 12563, 12575, 12584, 12584, 12610, 12617,
+  12632, 12677, 12697, 12706, 12719, 12731, 12738, 12748, 12756, 12772,
+  12791, 12806, 12821, 12836, 12855, 12876, 12904, 12920, 12949, 12961,
+  12966, 12966, 12989, 12996, 13004, 13012, 13022, 13022, 13036, 13036,
+  13055, 13057, 13072, 13077, 13088, 13093, 13102, 13109, 13122, 13122,
+  13178, 13183, 13183, 13196, 13201, 13208, 13225, 13264, 13271, 13281,
+  13288, 13298, 13324, 13349, 13359, 13369, 13379, 13389, 13405, 13410,
+  13417, 13426, 13428, 13448, 13492, 13499, 13509, 13534, 13541, 13551,
+  13577, 13580, 13578, 13597, 13601, 13626, 13598, 13793, 13795, 13812,
+  13818, 13824, 13833, 13839, 13845, 13854, 13861, 13869, 13884, 13886,
+  13956, 13969, 13988, 14011, 14012, 14023, 14024, 14046, 14053, 14063,
+  14078, 14094, 14114, 14119, 14125, 14134, 14141, 14152, 14159, 14169,
+  14176, 14186, 14193, 14203, 14210, 14220, 14227, 14234, 14244, 14251,
+  14258, 14268, 14275, 14282, 14289, 14296, 14306, 14313, 14323, 14330,
+  14337, 14344, 14352, 14351, 14381, 14380, 14412, 14433, 14444, 14451,
+  14458, 14465, 14472, 14481, 14488, 14538, 14553, 14559, 14570, 14569,
+  14587, 14597, 14604, 14611, 14622, 14639, 14658, 14675, 14694, 14711,
+  14730, 14752, 14769, 14791, 14810, 14835, 14873, 14906, 14933, 14954,
+  14984, 14986, 14983, 15003, 15028, 15081, 15083, 15080, 15100, 15117,
+  15125, 15127, 15124, 15138, 15140, 15137, 15151, 15153, 15150, 15164,
+  15166, 15163, 15177, 15179, 15176, 15189, 15191, 15188, 15201, 15203,
+  15200, 15213, 15215, 15212, 15234, 15236, 15233, 15246, 15248, 15245,
+  15267, 15269, 15266, 15286, 15288, 15285, 15298, 15300, 15297, 15310,
+  15312, 15309, 15322, 15324, 15321, 15334, 15336, 15333, 15346, 15348,
+  15345, 15358, 15360, 15357, 15370, 15372, 15369, 15382, 15384, 15381,
+  15394, 15396, 15393, 15407, 15409, 15406, 15420, 15422, 15419, 15433,
+  15435, 15432, 15446, 15448, 15445, 15458, 15460, 15457, 15470, 15472,
+  15469, 15504, 15513, 15521, 15529, 15537, 15545, 15553, 15561, 15569,
+  15577, 15585, 15593, 15606, 15608, 15605, 15618, 15620, 15617, 15636,
+  15649, 15671, 15673, 15670, 15681, 15683, 15680, 15691, 15693, 15690,
+  15701, 15703, 15700, 15711, 15713, 15710, 15721, 15723, 15720, 15731,
+  15733, 15730, 15741, 15752, 15740, 15775, 15777, 15774, 15785, 15787,
+  15784, 15795, 15797, 15794, 15805, 15807, 15804, 15817, 15819, 15816,
+  15829, 15831, 15828, 15841, 15843, 15840, 15851, 15853, 15850, 15861,
+  15863, 15860, 15871, 15873, 15870, 15881, 15883, 15880, 15891, 15893,
+  15890, 15907, 15909, 15906, 15919, 15921, 15918, 15930, 15947, 15949,
+  15946, 15959, 15964, 15971, 15973, 15972, 15979, 15981, 15980, 15987,
+  15989, 15988, 15995, 15997, 15996, 16003, 16005, 16004, 16008, 16010,
+  16009, 16013, 16015, 16014, 16021, 16023, 16022, 16028, 16029, 16030,
+  16034, 16040, 16046, 16052, 16058, 16064, 16070, 16076, 16082, 16088,
+  16094, 16100, 16106, 16112, 16121, 16127, 16133, 16139, 16145, 16151,
+  16157, 16163, 16169, 16175, 16181, 16187, 16197, 16203, 16212, 16221,
+  16227, 16237, 16243, 16252, 16258, 16264, 16270, 16275, 16284, 16285,
+  16290, 16295, 16302, 16313, 16318, 16329, 16334, 16340, 16350, 16355,
+  16361, 16371, 16376, 16397, 16403, 16414, 16419, 16438, 16444, 16450,
+  16459, 16464, 16530, 16588, 16637, 16642, 16652, 16659, 16669, 16701,
+  16708, 16718, 16747, 16761, 16762, 16766, 16767, 16771, 16777, 16783,
+  16789, 16795, 16801, 16807, 16813, 16819, 16825, 16831, 16837, 16843,
+  16849, 16855, 16861, 16867, 16873, 16879, 16885, 16895, 16900, 16910,
+  16937, 16980, 16985, 16995, 17009, 17023, 17037, 17054, 17062, 17072,
+  17080, 17089, 17096, 17106, 17112, 17121, 17129, 17139, 17147, 17155,
+  17165, 17172, 17183, 17182, 17277, 17384, 17393, 17408, 17428, 17435,
+  17442, 17450, 17580, 17587, 17596, 17616, 17621, 17630, 17650, 17670,
+  17690, 17710, 17730, 17750, 17757, 17764, 17774, 17779, 17785, 17791,
+  17800, 17806, 17815, 17821, 17827, 17833, 17842, 17843, 17847, 17853,
+  17863, 17869, 17878, 17884, 17893, 17934, 17941, 17951, 17958, 17965,
+  17972, 17979, 17986, 17993, 18000, 18007, 18017, 18023, 18029, 18035,
+  18041, 18047, 18056, 18077, 18089, 18096, 18109, 18129, 18207, 18221,
+  18231, 18238, 18247, 18260, 18261, 18265, 18277, 18284, 18291, 18301,
+  18315, 18326, 18331, 18337, 18343, 18352, 18358, 18364, 18373, 18378,
+  18456, 18481, 18495, 18506, 18525, 18535, 18544, 18550, 18559, 18592,
+  18628, 18637, 18643, 18652, 18661, 18674, 18679, 18688, 18696, 18704,
+  18712, 18720, 18728, 18736, 18744, 18752, 18760, 18768, 18776, 18784,
+  18792, 18800, 18808, 18816, 18824, 18832, 18840, 18848, 18910, 18918,
+  18926, 18944, 19110, 19158, 19204, 19317, 19322, 19328, 19338, 19343,
+  19353, 19358, 19368, 19373, 19383, 19390, 19398, 19409, 19410, 19415,
+  19420, 19429, 19435, 19452, 19472, 19496, 19497, 19501, 19503, 19508,
+  19509, 19514, 19538, 19543, 19552, 19558, 19575, 19596, 19612, 19639,
+  19678, 19697, 19703, 19709, 19715, 19723, 19725, 19729, 19736, 19785,
+  19825, 19849, 19856, 19866, 19873, 19880, 19887, 19898, 19905, 19912,
+  19922, 19929, 19939, 19946, 19956, 19970, 19984, 19997, 20025, 20044,
+  20049, 20058, 20064, 20070, 20076, 20085, 20092, 20103, 20106, 20113,
+  20120, 20130, 20150, 20170, 20190, 20211, 20221, 20231, 20241, 20251,
+  20261, 20271, 20281, 20291, 20301, 20311, 20321, 20331, 20341, 20351,
+  20361, 20371, 20380, 20391, 20401, 20411, 20421, 20431, 20441, 20451,
+  20461, 20471, 20481, 20491, 20501, 20511, 20521, 20531, 20541, 20551,
+  20561, 20571, 20581, 20591, 20601, 20611, 20621, 20631, 20641, 20651,
+  20661, 20671, 20680, 20690, 20700, 20710, 20720, 20730, 20740, 20750,
+  20760, 20770, 20780, 20790, 20800, 20810, 20820, 20830, 20840, 20850,
+  20860, 20870, 20880, 20892, 20902, 20912, 20922, 20932, 20942, 20952,
+  20962, 20972, 20982, 20992, 21002, 21012, 21022, 21032, 21042, 21052,
+  21062, 21072, 21082, 21092, 21102, 21112, 21122, 21132, 21142, 21152,
+  21162, 21172, 21182, 21191, 21201, 21211, 21221, 21231, 21241, 21251,
+  21261, 21271, 21281, 21291, 21301, 21311, 21321, 21331, 21341, 21351,
+  21361, 21371, 21381, 21391, 21401, 21411, 21421, 21431, 21441, 21452,
+  21465, 21478, 21491, 21504, 21517, 21530, 21543, 21556, 21569, 21585,
+  21593, 21606, 21617, 21628, 21645, 21655, 21692, 21729, 21750, 21771,
+  21792, 21817, 21834, 21844, 21862, 21883, 21935, 21962, 22017, 22035,
+  22053, 22071, 22089, 22106, 22123, 22140, 22157, 22174, 22191, 22208,
+  22225, 22242, 22259, 22276, 22293, 22310, 22327, 22344, 22361, 22378,
+  22395, 22412, 22432, 22438, 22444, 22453, 22462, 22471, 22480, 22489,
+  22498, 22507, 22516, 22525, 22534, 22543, 22552, 22564, 22573, 22587,
+  22603, 22621, 22623, 22627, 22634, 22644, 22660, 22676, 22695, 22707,
+  22716, 22729, 22741, 22753, 22765, 22779, 22781, 22785, 22792, 22799,
+  22806, 22816, 22823, 22833, 22837, 22851
 };
 #endif
 
@@ -1613,129 +1613,129 @@ static const unsigned short int yyr1[] = {
   781, 781, 781, 781, 781, 781, 781, 781, 781, 781,
   781, 781, 781, 781, 781, 781, 781, 781, 781, 781,
   781, 781, 781, 782, 782, 783, 783, 783, 783, 783,
-  783, 783, 783, 784, 784, 784, 785, 785, 785, 785,
-  785, 785, 786, 786, 786, 786, 786, 786, 786, 786,
-  787, 788, 788, 789, 789, 790, 790, 791, 791, 792,
-  792, 793, 794, 794, 795, 795, 796, 796, 796, 797,
-  797, 798, 798, 799, 799, 799, 800, 800, 800, 801,
-  801, 801, 803, 802, 805, 804, 804, 806, 807, 808,
-  806, 806, 809, 809, 809, 810, 810, 811, 811, 811,
-  812, 813, 813, 814, 814, 815, 815, 816, 816, 816,
-  816, 818, 817, 820, 819, 821, 821, 821, 821, 822,
-  823, 824, 824, 825, 825, 825, 827, 828, 826, 830,
-  831, 829, 832, 832, 833, 833, 835, 836, 834, 838,
-  839, 837, 841, 842, 840, 843, 843, 844, 844, 844,
+  783, 783, 783, 783, 784, 784, 784, 785, 785, 785,
+  785, 785, 785, 785, 786, 786, 786, 786, 786, 786,
+  786, 786, 787, 788, 788, 789, 789, 790, 790, 791,
+  791, 792, 792, 793, 794, 794, 795, 795, 796, 796,
+  796, 797, 797, 798, 798, 799, 799, 799, 800, 800,
+  800, 801, 801, 801, 803, 802, 805, 804, 804, 806,
+  807, 808, 806, 806, 809, 809, 809, 810, 810, 811,
+  811, 811, 812, 813, 813, 814, 814, 815, 815, 816,
+  816, 816, 816, 818, 817, 820, 819, 821, 821, 821,
+  821, 822, 823, 824, 824, 825, 825, 825, 827, 828,
+  826, 830, 831, 829, 832, 832, 833, 833, 835, 836,
+  834, 838, 839, 837, 841, 842, 840, 843, 843, 844,
   844, 844, 844, 844, 844, 844, 844, 844, 844, 844,
-  845, 846, 847, 845, 848, 849, 850, 848, 851, 852,
-  853, 851, 854, 855, 855, 856, 856, 857, 857, 858,
-  858, 859, 859, 860, 860, 861, 861, 862, 862, 863,
-  863, 864, 864, 865, 865, 866, 866, 867, 867, 868,
-  868, 869, 869, 869, 869, 870, 870, 871, 871, 872,
-  872, 873, 873, 873, 874, 874, 874, 874, 874, 875,
-  875, 875, 876, 876, 877, 877, 878, 878, 878, 879,
-  879, 880, 880, 881, 881, 882, 883, 883, 884, 885,
-  885, 885, 886, 886, 887, 887, 888, 888, 888, 888,
+  844, 844, 845, 846, 847, 845, 848, 849, 850, 848,
+  851, 852, 853, 851, 854, 855, 855, 856, 856, 857,
+  857, 858, 858, 859, 859, 860, 860, 861, 861, 862,
+  862, 863, 863, 864, 864, 865, 865, 866, 866, 867,
+  867, 868, 868, 869, 869, 869, 869, 870, 870, 871,
+  871, 872, 872, 873, 873, 873, 874, 874, 874, 874,
+  874, 875, 875, 875, 876, 876, 877, 877, 878, 878,
+  878, 879, 879, 880, 880, 881, 881, 882, 883, 883,
+  884, 885, 885, 885, 886, 886, 887, 887, 888, 888,
   888, 888, 888, 888, 888, 888, 888, 888, 888, 888,
-  889, 890, 890, 890, 890, 891, 891, 892, 893, 893,
-  893, 894, 894, 895, 896, 896, 897, 897, 898, 898,
-  899, 900, 901, 902, 900, 903, 903, 905, 906, 904,
-  904, 907, 907, 908, 908, 909, 909, 910, 910, 911,
-  911, 911, 912, 913, 915, 914, 916, 916, 916, 917,
-  917, 918, 918, 919, 919, 919, 919, 919, 919, 919,
-  919, 920, 921, 922, 922, 923, 923, 924, 924, 925,
-  925, 925, 926, 926, 927, 927, 928, 928, 929, 930,
-  931, 932, 932, 933, 933, 933, 934, 934, 934, 934,
-  934, 934, 934, 934, 934, 935, 935, 936, 936, 937,
-  937, 937, 937, 937, 937, 938, 938, 938, 938, 938,
-  939, 939, 940, 940, 941, 941, 942, 943, 944, 945,
-  946, 947, 945, 948, 948, 949, 949, 950, 950, 951,
-  952, 952, 953, 953, 953, 954, 954, 954, 955, 955,
-  956, 956, 956, 956, 956, 956, 956, 956, 957, 957,
-  958, 958, 959, 959, 959, 959, 959, 959, 959, 959,
-  959, 960, 960, 961, 961, 961, 962, 962, 963, 963,
-  963, 963, 963, 964, 964, 964, 965, 966, 967, 967,
-  968, 968, 969, 969, 970, 970, 971, 971, 972, 973,
-  973, 974, 974, 974, 975, 975, 975, 976, 976, 977,
-  977, 978, 978, 979, 979, 981, 980, 983, 984, 985,
-  982, 987, 988, 989, 986, 990, 992, 993, 994, 991,
-  991, 996, 997, 998, 995, 995, 999, 999, 999, 999,
-  999, 1000, 1000, 1000, 1001, 1001, 1003, 1002, 1004, 1004,
-  1005, 1007, 1008, 1006, 1009, 1009, 1010, 1010, 1011, 1011,
-  1012, 1013, 1013, 1014, 1015, 1014, 1016, 1016, 1016, 1017,
-  1017, 1018, 1018, 1018, 1018, 1018, 1018, 1019, 1019, 1019,
-  1019, 1020, 1020, 1020, 1022, 1021, 1023, 1023, 1024, 1024,
-  1025, 1026, 1026, 1027, 1027, 1028, 1028, 1028, 1029, 1029,
-  1029, 1029, 1030, 1030, 1031, 1031, 1032, 1033, 1034, 1033,
-  1035, 1035, 1035, 1035, 1037, 1036, 1039, 1038, 1040, 1040,
-  1041, 1041, 1042, 1042, 1043, 1043, 1045, 1044, 1046, 1047,
-  1046, 1048, 1048, 1048, 1048, 1049, 1049, 1050, 1050, 1051,
-  1051, 1051, 1052, 1052, 1052, 1052, 1053, 1053, 1053, 1054,
-  1054, 1054, 1055, 1055, 1056, 1057, 1057, 1058, 1059, 1060,
-  1059, 1061, 1062, 1063, 1061, 1064, 1064, 1065, 1065, 1065,
-  1066, 1066, 1066, 1067, 1067, 1067, 1068, 1068, 1069, 1069,
-  1069, 1070, 1070, 1071, 1071, 1072, 1072, 1073, 1073, 1073,
-  1074, 1074, 1074, 1075, 1075, 1076, 1076, 1077, 1077, 1078,
-  1078, 1079, 1079, 1080, 1080, 1080, 1081, 1081, 1081, 1082,
-  1082, 1082, 1082, 1082, 1083, 1083, 1084, 1084, 1084, 1084,
-  1085, 1084, 1086, 1084, 1087, 1088, 1088, 1088, 1088, 1088,
-  1088, 1088, 1088, 1088, 1088, 1088, 1090, 1089, 1091, 1092,
-  1092, 1092, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093,
-  1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 1094, 1095,
-  1093, 1093, 1093, 1096, 1097, 1093, 1093, 1093, 1098, 1099,
-  1093, 1100, 1101, 1093, 1102, 1103, 1093, 1104, 1105, 1093,
-  1106, 1107, 1093, 1108, 1109, 1093, 1110, 1111, 1093, 1112,
-  1113, 1093, 1114, 1115, 1093, 1116, 1117, 1093, 1118, 1119,
-  1093, 1120, 1121, 1093, 1122, 1123, 1093, 1124, 1125, 1093,
-  1126, 1127, 1093, 1128, 1129, 1093, 1130, 1131, 1093, 1132,
-  1133, 1093, 1134, 1135, 1093, 1136, 1137, 1093, 1138, 1139,
-  1093, 1140, 1141, 1093, 1142, 1143, 1093, 1144, 1145, 1093,
-  1146, 1147, 1093, 1148, 1149, 1093, 1150, 1151, 1093, 1093,
+  888, 888, 889, 890, 890, 890, 890, 891, 891, 892,
+  893, 893, 893, 894, 894, 895, 896, 896, 897, 897,
+  898, 898, 899, 900, 901, 902, 900, 903, 903, 905,
+  906, 904, 904, 907, 907, 908, 908, 909, 909, 910,
+  910, 911, 911, 911, 912, 913, 915, 914, 916, 916,
+  916, 917, 917, 918, 918, 919, 919, 919, 919, 919,
+  919, 919, 919, 920, 921, 922, 922, 923, 923, 924,
+  924, 925, 925, 925, 926, 926, 927, 927, 928, 928,
+  929, 930, 931, 932, 932, 933, 933, 933, 934, 934,
+  934, 934, 934, 934, 934, 934, 934, 935, 935, 936,
+  936, 937, 937, 937, 937, 937, 937, 938, 938, 938,
+  938, 938, 939, 939, 940, 940, 941, 941, 942, 943,
+  944, 945, 946, 947, 945, 948, 948, 949, 949, 950,
+  950, 951, 952, 952, 953, 953, 953, 954, 954, 954,
+  955, 955, 956, 956, 956, 956, 956, 956, 956, 956,
+  957, 957, 958, 958, 959, 959, 959, 959, 959, 959,
+  959, 959, 959, 960, 960, 961, 961, 961, 962, 962,
+  963, 963, 963, 963, 963, 964, 964, 964, 965, 966,
+  967, 967, 968, 968, 969, 969, 970, 970, 971, 971,
+  972, 973, 973, 974, 974, 974, 975, 975, 975, 976,
+  976, 977, 977, 978, 978, 979, 979, 981, 980, 983,
+  984, 985, 982, 987, 988, 989, 986, 990, 992, 993,
+  994, 991, 991, 996, 997, 998, 995, 995, 999, 999,
+  999, 999, 999, 1000, 1000, 1000, 1001, 1001, 1003, 1002,
+  1004, 1004, 1005, 1007, 1008, 1006, 1009, 1009, 1010, 1010,
+  1011, 1011, 1012, 1013, 1013, 1014, 1015, 1014, 1016, 1016,
+  1016, 1017, 1017, 1018, 1018, 1018, 1018, 1018, 1018, 1019,
+  1019, 1019, 1019, 1020, 1020, 1020, 1022, 1021, 1023, 1023,
+  1024, 1024, 1025, 1026, 1026, 1027, 1027, 1028, 1028, 1028,
+  1029, 1029, 1029, 1029, 1030, 1030, 1031, 1031, 1032, 1033,
+  1034, 1033, 1035, 1035, 1035, 1035, 1037, 1036, 1039, 1038,
+  1040, 1040, 1041, 1041, 1042, 1042, 1043, 1043, 1045, 1044,
+  1046, 1047, 1046, 1048, 1048, 1048, 1048, 1049, 1049, 1050,
+  1050, 1051, 1051, 1051, 1052, 1052, 1052, 1052, 1053, 1053,
+  1053, 1054, 1054, 1054, 1055, 1055, 1056, 1057, 1057, 1058,
+  1059, 1060, 1059, 1061, 1062, 1063, 1061, 1064, 1064, 1065,
+  1065, 1065, 1066, 1066, 1066, 1067, 1067, 1067, 1068, 1068,
+  1069, 1069, 1069, 1070, 1070, 1071, 1071, 1072, 1072, 1073,
+  1073, 1073, 1074, 1074, 1074, 1075, 1075, 1076, 1076, 1077,
+  1077, 1078, 1078, 1079, 1079, 1080, 1080, 1080, 1081, 1081,
+  1081, 1082, 1082, 1082, 1082, 1082, 1083, 1083, 1084, 1084,
+  1084, 1084, 1085, 1084, 1086, 1084, 1087, 1088, 1088, 1088,
+  1088, 1088, 1088, 1088, 1088, 1088, 1088, 1088, 1090, 1089,
+  1091, 1092, 1092, 1092, 1093, 1093, 1093, 1093, 1093, 1093,
   1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093,
-  1093, 1152, 1153, 1093, 1154, 1155, 1093, 1093, 1093, 1156,
-  1157, 1093, 1158, 1159, 1093, 1160, 1161, 1093, 1162, 1163,
-  1093, 1164, 1165, 1093, 1166, 1167, 1093, 1168, 1169, 1093,
-  1170, 1171, 1093, 1172, 1173, 1093, 1174, 1175, 1093, 1176,
-  1177, 1093, 1178, 1179, 1093, 1180, 1181, 1093, 1182, 1183,
-  1093, 1184, 1185, 1093, 1186, 1187, 1093, 1188, 1189, 1093,
-  1190, 1191, 1093, 1192, 1193, 1093, 1194, 1195, 1093, 1196,
-  1197, 1093, 1198, 1199, 1093, 1093, 1200, 1201, 1093, 1202,
-  1202, 1203, 1204, 1203, 1205, 1206, 1205, 1207, 1208, 1207,
-  1209, 1210, 1209, 1211, 1212, 1211, 1211, 1213, 1211, 1211,
-  1214, 1211, 1215, 1216, 1215, 1217, 1217, 1217, 1218, 1218,
+  1094, 1095, 1093, 1093, 1093, 1096, 1097, 1093, 1093, 1093,
+  1098, 1099, 1093, 1100, 1101, 1093, 1102, 1103, 1093, 1104,
+  1105, 1093, 1106, 1107, 1093, 1108, 1109, 1093, 1110, 1111,
+  1093, 1112, 1113, 1093, 1114, 1115, 1093, 1116, 1117, 1093,
+  1118, 1119, 1093, 1120, 1121, 1093, 1122, 1123, 1093, 1124,
+  1125, 1093, 1126, 1127, 1093, 1128, 1129, 1093, 1130, 1131,
+  1093, 1132, 1133, 1093, 1134, 1135, 1093, 1136, 1137, 1093,
+  1138, 1139, 1093, 1140, 1141, 1093, 1142, 1143, 1093, 1144,
+  1145, 1093, 1146, 1147, 1093, 1148, 1149, 1093, 1150, 1151,
+  1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093,
+  1093, 1093, 1093, 1152, 1153, 1093, 1154, 1155, 1093, 1093,
+  1093, 1156, 1157, 1093, 1158, 1159, 1093, 1160, 1161, 1093,
+  1162, 1163, 1093, 1164, 1165, 1093, 1166, 1167, 1093, 1168,
+  1169, 1093, 1170, 1171, 1093, 1172, 1173, 1093, 1174, 1175,
+  1093, 1176, 1177, 1093, 1178, 1179, 1093, 1180, 1181, 1093,
+  1182, 1183, 1093, 1184, 1185, 1093, 1186, 1187, 1093, 1188,
+  1189, 1093, 1190, 1191, 1093, 1192, 1193, 1093, 1194, 1195,
+  1093, 1196, 1197, 1093, 1198, 1199, 1093, 1093, 1200, 1201,
+  1093, 1202, 1202, 1203, 1204, 1203, 1205, 1206, 1205, 1207,
+  1208, 1207, 1209, 1210, 1209, 1211, 1212, 1211, 1211, 1213,
+  1211, 1211, 1214, 1211, 1215, 1216, 1215, 1217, 1217, 1217,
   1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218,
-  1218, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
-  1219, 1219, 1219, 1219, 1220, 1220, 1221, 1222, 1222, 1223,
-  1223, 1224, 1224, 1224, 1224, 1224, 1225, 1225, 1226, 1226,
-  1226, 1227, 1227, 1228, 1228, 1228, 1229, 1229, 1229, 1230,
-  1230, 1231, 1231, 1232, 1232, 1233, 1233, 1233, 1234, 1234,
-  1234, 1234, 1235, 1235, 1236, 1236, 1237, 1238, 1238, 1239,
-  1240, 1241, 1241, 1242, 1242, 1243, 1243, 1243, 1243, 1243,
+  1218, 1218, 1218, 1218, 1219, 1219, 1219, 1219, 1219, 1219,
+  1219, 1219, 1219, 1219, 1219, 1219, 1220, 1220, 1221, 1222,
+  1222, 1223, 1223, 1224, 1224, 1224, 1224, 1224, 1225, 1225,
+  1226, 1226, 1226, 1227, 1227, 1228, 1228, 1228, 1229, 1229,
+  1229, 1230, 1230, 1231, 1231, 1232, 1232, 1233, 1233, 1233,
+  1234, 1234, 1234, 1234, 1235, 1235, 1236, 1236, 1237, 1238,
+  1238, 1239, 1240, 1241, 1241, 1242, 1242, 1243, 1243, 1243,
   1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
-  1243, 1243, 1243, 1243, 1243, 1244, 1244, 1245, 1246, 1247,
-  1247, 1248, 1248, 1248, 1248, 1249, 1249, 1250, 1250, 1251,
-  1251, 1252, 1252, 1253, 1253, 1254, 1254, 1254, 1255, 1255,
-  1257, 1256, 1258, 1258, 1258, 1258, 1258, 1258, 1258, 1258,
-  1258, 1258, 1259, 1260, 1260, 1261, 1261, 1261, 1261, 1261,
-  1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1263, 1263,
-  1264, 1264, 1264, 1264, 1265, 1265, 1266, 1266, 1267, 1267,
-  1268, 1268, 1269, 1270, 1270, 1271, 1271, 1271, 1271, 1271,
-  1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272,
-  1273, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1276, 1276,
-  1276, 1277, 1277, 1278, 1278, 1278, 1278, 1279, 1279, 1280,
-  1280, 1280, 1280, 1281, 1281, 1281, 1282, 1282, 1283, 1283,
-  1283, 1283, 1283, 1283, 1284, 1284, 1285, 1285, 1286, 1286,
-  1286, 1286, 1286, 1287, 1287, 1288, 1288, 1288, 1288, 1288,
+  1243, 1243, 1243, 1243, 1243, 1243, 1243, 1244, 1244, 1245,
+  1246, 1247, 1247, 1248, 1248, 1248, 1248, 1249, 1249, 1250,
+  1250, 1251, 1251, 1252, 1252, 1253, 1253, 1254, 1254, 1254,
+  1255, 1255, 1257, 1256, 1258, 1258, 1258, 1258, 1258, 1258,
+  1258, 1258, 1258, 1258, 1259, 1260, 1260, 1261, 1261, 1261,
+  1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262,
+  1263, 1263, 1264, 1264, 1264, 1264, 1265, 1265, 1266, 1266,
+  1267, 1267, 1268, 1268, 1269, 1270, 1270, 1271, 1271, 1271,
+  1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272,
+  1272, 1272, 1273, 1274, 1274, 1274, 1274, 1274, 1275, 1275,
+  1276, 1276, 1276, 1277, 1277, 1278, 1278, 1278, 1278, 1279,
+  1279, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1282, 1282,
+  1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1285, 1285,
+  1286, 1286, 1286, 1286, 1286, 1287, 1287, 1288, 1288, 1288,
   1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
   1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
-  1288, 1288, 1288, 1289, 1289, 1289, 1290, 1290, 1291, 1291,
-  1292, 1292, 1293, 1293, 1293, 1294, 1294, 1295, 1295, 1296,
-  1296, 1296, 1297, 1298, 1298, 1299, 1299, 1300, 1300, 1301,
-  1302, 1302, 1303, 1303, 1303, 1304, 1304, 1304, 1304, 1305,
-  1305, 1305, 1305, 1306, 1306, 1307, 1307, 1307, 1307, 1308,
-  1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309,
-  1309, 1309, 1310, 1310, 1310, 1311, 1311, 1312, 1312, 1313,
-  1313, 1313, 1313, 1314, 1314, 1315, 1315, 1316, 1316, 1317,
-  1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
+  1288, 1288, 1288, 1288, 1288, 1289, 1289, 1289, 1290, 1290,
+  1291, 1291, 1292, 1292, 1293, 1293, 1293, 1294, 1294, 1295,
+  1295, 1296, 1296, 1296, 1297, 1298, 1298, 1299, 1299, 1300,
+  1300, 1301, 1302, 1302, 1303, 1303, 1303, 1304, 1304, 1304,
+  1304, 1305, 1305, 1305, 1305, 1306, 1306, 1307, 1307, 1307,
+  1307, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309,
+  1309, 1309, 1309, 1309, 1310, 1310, 1310, 1311, 1311, 1312,
+  1312, 1313, 1313, 1313, 1313, 1314, 1314, 1315, 1315, 1316,
+  1316, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
   1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
   1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
   1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
@@ -1748,16 +1748,16 @@ static const unsigned short int yyr1[] = {
   1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
   1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
   1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
-  1317, 1317, 1317, 1317, 1317, 1317, 1317, 1318, 1318, 1319,
-  1319, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1322,
-  1322, 1323, 1323, 1324, 1325, 1326, 1327, 1327, 1327, 1327,
+  1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1318,
+  1318, 1319, 1319, 1320, 1320, 1321, 1321, 1321, 1321, 1321,
+  1321, 1322, 1322, 1323, 1323, 1324, 1325, 1326, 1327, 1327,
   1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
   1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-  1328, 1328, 1328, 1329, 1329, 1329, 1329, 1329, 1329, 1329,
-  1329, 1329, 1329, 1329, 1329, 1330, 1331, 1331, 1331, 1332,
-  1332, 1333, 1333, 1334, 1334, 1334, 1335, 1335, 1335, 1335,
-  1335, 1335, 1335, 1336, 1336, 1337, 1337, 1337, 1337, 1338,
-  1338, 1339, 1340, 1341
+  1327, 1327, 1328, 1328, 1328, 1329, 1329, 1329, 1329, 1329,
+  1329, 1329, 1329, 1329, 1329, 1329, 1329, 1330, 1331, 1331,
+  1331, 1332, 1332, 1333, 1333, 1334, 1334, 1334, 1335, 1335,
+  1335, 1335, 1335, 1335, 1335, 1336, 1336, 1337, 1337, 1337,
+  1337, 1338, 1338, 1339, 1340, 1341
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
@@ -1809,128 +1809,128 @@ static const unsigned char yyr2[] = {
   7, 7, 2, 3, 3, 2, 4, 4, 4, 4,
   4, 3, 4, 4, 3, 2, 2, 4, 4, 4,
   3, 4, 6, 2, 3, 2, 2, 2, 1, 2,
-  2, 2, 1, 2, 1, 2, 2, 1, 2, 2,
-  2, 1, 2, 3, 2, 3, 2, 3, 3, 3,
-  2, 3, 3, 2, 2, 1, 1, 1, 1, 1,
-  3, 3, 0, 2, 3, 1, 1, 1, 1, 0,
-  1, 1, 1, 0, 2, 4, 1, 1, 1, 1,
-  1, 1, 0, 3, 0, 9, 5, 0, 0, 0,
-  4, 4, 0, 2, 1, 3, 1, 3, 3, 3,
-  3, 3, 1, 1, 3, 3, 1, 3, 4, 2,
-  1, 0, 7, 0, 10, 1, 1, 2, 2, 8,
-  8, 0, 3, 2, 3, 3, 0, 0, 4, 0,
-  0, 4, 3, 3, 0, 3, 0, 0, 4, 0,
-  0, 4, 0, 0, 4, 3, 1, 1, 1, 1,
-  1, 4, 1, 1, 1, 1, 1, 1, 2, 1,
-  0, 0, 0, 4, 0, 0, 0, 4, 0, 0,
-  0, 4, 3, 0, 3, 0, 2, 0, 2, 0,
-  1, 0, 1, 0, 1, 0, 1, 1, 1, 1,
-  1, 0, 2, 0, 3, 0, 2, 0, 3, 0,
-  2, 0, 4, 4, 3, 3, 1, 3, 2, 6,
-  4, 3, 2, 1, 1, 3, 1, 1, 1, 0,
-  2, 4, 0, 2, 0, 2, 1, 1, 1, 0,
-  1, 3, 1, 6, 4, 10, 3, 1, 2, 0,
-  1, 1, 0, 3, 0, 1, 4, 5, 4, 5,
-  5, 4, 5, 3, 4, 3, 4, 4, 3, 4,
-  4, 2, 1, 2, 2, 3, 1, 5, 0, 3,
-  2, 3, 1, 2, 0, 1, 0, 2, 3, 1,
-  1, 0, 0, 0, 7, 3, 1, 0, 0, 4,
-  1, 3, 1, 1, 2, 3, 3, 3, 1, 1,
-  1, 1, 4, 5, 0, 5, 0, 1, 2, 0,
-  1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 4, 4, 3, 4, 6, 7, 1, 1, 0,
-  1, 1, 0, 1, 0, 2, 6, 1, 2, 2,
-  2, 3, 1, 5, 3, 3, 1, 2, 1, 2,
-  1, 2, 2, 5, 5, 1, 1, 2, 2, 1,
-  1, 1, 1, 1, 1, 4, 2, 5, 2, 2,
-  0, 1, 0, 1, 0, 1, 3, 4, 3, 0,
-  0, 0, 4, 0, 1, 2, 2, 0, 1, 2,
-  0, 2, 1, 1, 1, 0, 1, 1, 1, 2,
-  1, 2, 1, 2, 1, 2, 1, 1, 5, 2,
-  1, 1, 1, 2, 2, 1, 1, 1, 1, 1,
-  1, 1, 2, 1, 1, 3, 0, 1, 1, 1,
-  1, 1, 1, 1, 1, 1, 3, 3, 2, 1,
-  2, 1, 1, 1, 2, 1, 2, 2, 1, 0,
-  1, 0, 1, 1, 0, 1, 1, 0, 1, 3,
-  1, 4, 4, 1, 2, 0, 2, 0, 0, 0,
-  7, 0, 0, 0, 7, 2, 0, 0, 0, 9,
-  1, 0, 0, 0, 9, 1, 2, 2, 2, 2,
-  2, 1, 1, 1, 1, 1, 0, 3, 3, 1,
-  3, 0, 0, 8, 0, 3, 0, 1, 3, 1,
-  4, 3, 1, 0, 0, 10, 0, 2, 2, 0,
-  1, 2, 2, 2, 1, 1, 1, 0, 1, 1,
-  1, 1, 3, 1, 0, 2, 3, 1, 2, 2,
-  1, 3, 1, 3, 1, 1, 1, 1, 1, 1,
-  2, 1, 1, 2, 1, 2, 2, 0, 0, 3,
-  0, 2, 2, 1, 0, 4, 0, 5, 0, 1,
-  0, 3, 0, 2, 3, 1, 0, 3, 0, 0,
-  3, 0, 3, 3, 5, 3, 1, 3, 1, 3,
-  5, 1, 2, 2, 1, 3, 0, 4, 4, 0,
-  2, 4, 3, 1, 1, 3, 1, 1, 0, 0,
-  5, 0, 0, 0, 7, 0, 1, 3, 3, 1,
-  3, 3, 1, 1, 1, 3, 0, 2, 1, 3,
-  3, 0, 2, 0, 2, 3, 1, 3, 3, 2,
-  0, 2, 2, 1, 1, 1, 1, 3, 1, 3,
-  1, 3, 1, 3, 3, 1, 3, 3, 1, 3,
-  3, 3, 3, 1, 3, 1, 1, 2, 2, 2,
-  0, 3, 0, 3, 2, 1, 1, 1, 1, 1,
-  1, 1, 3, 3, 1, 1, 0, 3, 1, 1,
-  1, 1, 4, 9, 5, 10, 5, 10, 5, 5,
-  10, 10, 10, 13, 9, 11, 13, 8, 0, 0,
-  9, 7, 12, 0, 0, 6, 4, 6, 0, 0,
-  10, 0, 0, 8, 0, 0, 10, 0, 0, 8,
-  0, 0, 6, 0, 0, 6, 0, 0, 8, 0,
-  0, 10, 0, 0, 8, 0, 0, 10, 0, 0,
-  6, 0, 0, 8, 0, 0, 6, 0, 0, 6,
-  0, 0, 6, 0, 0, 6, 0, 0, 6, 0,
-  0, 6, 0, 0, 5, 0, 0, 5, 0, 0,
-  9, 0, 0, 8, 0, 0, 8, 0, 0, 6,
-  0, 0, 7, 0, 0, 7, 0, 0, 8, 4,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 0, 0, 5, 0, 0, 6, 1, 1, 0,
+  2, 2, 1, 2, 2, 1, 2, 2, 1, 2,
+  2, 2, 1, 2, 2, 3, 2, 3, 2, 3,
+  3, 3, 2, 3, 3, 2, 2, 1, 1, 1,
+  1, 1, 3, 3, 0, 2, 3, 1, 1, 1,
+  1, 0, 1, 1, 1, 0, 2, 4, 1, 1,
+  1, 1, 1, 1, 0, 3, 0, 9, 5, 0,
+  0, 0, 4, 4, 0, 2, 1, 3, 1, 3,
+  3, 3, 3, 3, 1, 1, 3, 3, 1, 3,
+  4, 2, 1, 0, 7, 0, 10, 1, 1, 2,
+  2, 8, 8, 0, 3, 2, 3, 3, 0, 0,
+  4, 0, 0, 4, 3, 3, 0, 3, 0, 0,
+  4, 0, 0, 4, 0, 0, 4, 3, 1, 1,
+  1, 1, 1, 4, 1, 1, 1, 1, 1, 1,
+  2, 1, 0, 0, 0, 4, 0, 0, 0, 4,
+  0, 0, 0, 4, 3, 0, 3, 0, 2, 0,
+  2, 0, 1, 0, 1, 0, 1, 0, 1, 1,
+  1, 1, 1, 0, 2, 0, 3, 0, 2, 0,
+  3, 0, 2, 0, 4, 4, 3, 3, 1, 3,
+  2, 6, 4, 3, 2, 1, 1, 3, 1, 1,
+  1, 0, 2, 4, 0, 2, 0, 2, 1, 1,
+  1, 0, 1, 3, 1, 6, 4, 10, 3, 1,
+  2, 0, 1, 1, 0, 3, 0, 1, 4, 5,
+  4, 5, 5, 4, 5, 3, 4, 3, 4, 4,
+  3, 4, 4, 2, 1, 2, 2, 3, 1, 5,
+  0, 3, 2, 3, 1, 2, 0, 1, 0, 2,
+  3, 1, 1, 0, 0, 0, 7, 3, 1, 0,
+  0, 4, 1, 3, 1, 1, 2, 3, 3, 3,
+  1, 1, 1, 1, 4, 5, 0, 5, 0, 1,
+  2, 0, 1, 2, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 4, 4, 3, 4, 6, 7, 1,
+  1, 0, 1, 1, 0, 1, 0, 2, 6, 1,
+  2, 2, 2, 3, 1, 5, 3, 3, 1, 2,
+  1, 2, 1, 2, 2, 5, 5, 1, 1, 2,
+  2, 1, 1, 1, 1, 1, 1, 4, 2, 5,
+  2, 2, 0, 1, 0, 1, 0, 1, 3, 4,
+  3, 0, 0, 0, 4, 0, 1, 2, 2, 0,
+  1, 2, 0, 2, 1, 1, 1, 0, 1, 1,
+  1, 2, 1, 2, 1, 2, 1, 2, 1, 1,
+  5, 2, 1, 1, 1, 2, 2, 1, 1, 1,
+  1, 1, 1, 1, 2, 1, 1, 3, 0, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 3, 3,
+  2, 1, 2, 1, 1, 1, 2, 1, 2, 2,
+  1, 0, 1, 0, 1, 1, 0, 1, 1, 0,
+  1, 3, 1, 4, 4, 1, 2, 0, 2, 0,
+  0, 0, 7, 0, 0, 0, 7, 2, 0, 0,
+  0, 9, 1, 0, 0, 0, 9, 1, 2, 2,
+  2, 2, 2, 1, 1, 1, 1, 1, 0, 3,
+  3, 1, 3, 0, 0, 8, 0, 3, 0, 1,
+  3, 1, 4, 3, 1, 0, 0, 10, 0, 2,
+  2, 0, 1, 2, 2, 2, 1, 1, 1, 0,
+  1, 1, 1, 1, 3, 1, 0, 2, 3, 1,
+  2, 2, 1, 3, 1, 3, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 2, 1, 2, 2, 0,
+  0, 3, 0, 2, 2, 1, 0, 4, 0, 5,
+  0, 1, 0, 3, 0, 2, 3, 1, 0, 3,
+  0, 0, 3, 0, 3, 3, 5, 3, 1, 3,
+  1, 3, 5, 1, 2, 2, 1, 3, 0, 4,
+  4, 0, 2, 4, 3, 1, 1, 3, 1, 1,
+  0, 0, 5, 0, 0, 0, 7, 0, 1, 3,
+  3, 1, 3, 3, 1, 1, 1, 3, 0, 2,
+  1, 3, 3, 0, 2, 0, 2, 3, 1, 3,
+  3, 2, 0, 2, 2, 1, 1, 1, 1, 3,
+  1, 3, 1, 3, 1, 3, 3, 1, 3, 3,
+  1, 3, 3, 3, 3, 1, 3, 1, 1, 2,
+  2, 2, 0, 3, 0, 3, 2, 1, 1, 1,
+  1, 1, 1, 1, 3, 3, 1, 1, 0, 3,
+  1, 1, 1, 1, 4, 9, 5, 10, 5, 10,
+  5, 5, 10, 10, 10, 13, 9, 11, 13, 8,
+  0, 0, 9, 7, 12, 0, 0, 6, 4, 6,
+  0, 0, 10, 0, 0, 8, 0, 0, 10, 0,
   0, 8, 0, 0, 6, 0, 0, 6, 0, 0,
-  6, 0, 0, 6, 0, 0, 6, 0, 0, 6,
-  0, 0, 8, 0, 0, 10, 0, 0, 8, 0,
-  0, 6, 0, 0, 8, 0, 0, 8, 0, 0,
-  8, 0, 0, 8, 0, 0, 10, 0, 0, 10,
-  0, 0, 8, 0, 0, 8, 0, 0, 8, 0,
-  0, 6, 0, 0, 6, 11, 0, 0, 10, 1,
-  1, 1, 0, 4, 1, 0, 4, 1, 0, 4,
-  1, 0, 4, 1, 0, 4, 1, 0, 4, 1,
-  0, 4, 1, 0, 4, 1, 1, 1, 1, 1,
+  8, 0, 0, 10, 0, 0, 8, 0, 0, 10,
+  0, 0, 6, 0, 0, 8, 0, 0, 6, 0,
+  0, 6, 0, 0, 6, 0, 0, 6, 0, 0,
+  6, 0, 0, 6, 0, 0, 5, 0, 0, 5,
+  0, 0, 9, 0, 0, 8, 0, 0, 8, 0,
+  0, 6, 0, 0, 7, 0, 0, 7, 0, 0,
+  8, 4, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 5, 0, 0, 6, 1,
+  1, 0, 0, 8, 0, 0, 6, 0, 0, 6,
+  0, 0, 6, 0, 0, 6, 0, 0, 6, 0,
+  0, 6, 0, 0, 8, 0, 0, 10, 0, 0,
+  8, 0, 0, 6, 0, 0, 8, 0, 0, 8,
+  0, 0, 8, 0, 0, 8, 0, 0, 10, 0,
+  0, 10, 0, 0, 8, 0, 0, 8, 0, 0,
+  8, 0, 0, 6, 0, 0, 6, 11, 0, 0,
+  10, 1, 1, 1, 0, 4, 1, 0, 4, 1,
+  0, 4, 1, 0, 4, 1, 0, 4, 1, 0,
+  4, 1, 0, 4, 1, 0, 4, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 0, 2,
-  2, 0, 3, 0, 2, 2, 0, 2, 2, 0,
-  3, 0, 4, 0, 3, 1, 1, 1, 6, 4,
-  5, 4, 0, 2, 2, 1, 4, 2, 1, 4,
-  6, 1, 1, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 0, 2, 5, 1, 0,
-  1, 2, 2, 2, 2, 3, 1, 3, 1, 3,
-  1, 2, 1, 3, 1, 2, 2, 1, 2, 1,
-  0, 3, 3, 5, 3, 3, 2, 3, 5, 3,
-  5, 2, 2, 0, 1, 2, 2, 2, 2, 2,
-  2, 3, 3, 2, 0, 1, 1, 1, 2, 1,
-  1, 2, 2, 3, 1, 1, 3, 2, 2, 1,
-  1, 2, 1, 3, 1, 3, 3, 3, 3, 2,
-  3, 3, 3, 3, 1, 1, 1, 1, 1, 1,
-  3, 3, 3, 3, 3, 1, 3, 1, 1, 2,
-  1, 1, 1, 4, 1, 1, 1, 3, 1, 0,
-  1, 1, 1, 1, 2, 1, 1, 7, 2, 4,
-  3, 2, 1, 1, 2, 1, 3, 1, 2, 1,
-  3, 2, 2, 0, 1, 2, 1, 1, 2, 1,
-  1, 1, 1, 1, 4, 1, 5, 1, 1, 4,
-  1, 5, 1, 1, 1, 3, 2, 2, 2, 4,
-  2, 2, 6, 0, 1, 1, 0, 1, 0, 3,
-  0, 3, 0, 3, 5, 1, 1, 0, 1, 2,
-  2, 2, 3, 0, 1, 0, 1, 0, 2, 1,
-  0, 1, 2, 2, 2, 0, 2, 2, 2, 1,
-  1, 1, 2, 0, 1, 1, 2, 2, 2, 1,
+  0, 2, 2, 0, 3, 0, 2, 2, 0, 2,
+  2, 0, 3, 0, 4, 0, 3, 1, 1, 1,
+  6, 4, 5, 4, 0, 2, 2, 1, 4, 2,
+  1, 4, 6, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 4, 3, 0, 1, 1,
-  1, 1, 1, 3, 1, 0, 3, 3, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 2, 5,
+  1, 0, 1, 2, 2, 2, 2, 3, 1, 3,
+  1, 3, 1, 2, 1, 3, 1, 2, 2, 1,
+  2, 1, 0, 3, 3, 5, 3, 3, 2, 3,
+  5, 3, 5, 2, 2, 0, 1, 2, 2, 2,
+  2, 2, 2, 3, 3, 2, 0, 1, 1, 1,
+  2, 1, 1, 2, 2, 3, 1, 1, 3, 2,
+  2, 1, 1, 2, 1, 3, 1, 3, 3, 3,
+  3, 2, 3, 3, 3, 3, 1, 1, 1, 1,
+  1, 1, 3, 3, 3, 3, 3, 1, 3, 1,
+  1, 2, 1, 1, 1, 4, 1, 1, 1, 3,
+  1, 0, 1, 1, 1, 1, 2, 1, 1, 7,
+  2, 4, 3, 2, 1, 1, 2, 1, 3, 1,
+  2, 1, 3, 2, 2, 0, 1, 2, 1, 1,
+  2, 1, 1, 1, 1, 1, 4, 1, 5, 1,
+  1, 4, 1, 5, 1, 1, 1, 3, 2, 2,
+  2, 4, 2, 2, 6, 0, 1, 1, 0, 1,
+  0, 3, 0, 3, 0, 3, 5, 1, 1, 0,
+  1, 2, 2, 2, 3, 0, 1, 0, 1, 0,
+  2, 1, 0, 1, 2, 2, 2, 0, 2, 2,
+  2, 1, 1, 1, 2, 0, 1, 1, 2, 2,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 4, 3, 0,
+  1, 1, 1, 1, 1, 3, 1, 0, 3, 3,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
@@ -1945,15 +1945,15 @@ static const unsigned char yyr2[] = {
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
   1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 2, 1, 1, 1, 1, 1, 1, 1, 2,
-  1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+  1, 1, 1, 2, 1, 1, 1, 1, 1, 1,
+  1, 2, 1, 1, 1, 1, 1, 1, 2, 2,
   2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
   2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-  1, 2, 2, 2, 2, 2, 5, 2, 2, 6,
-  2, 5, 2, 2, 6, 3, 8, 9, 9, 0,
-  1, 3, 1, 7, 9, 8, 1, 2, 7, 3,
-  3, 3, 3, 0, 1, 3, 3, 1, 1, 3,
-  1, 3, 3, 1
+  2, 2, 1, 2, 2, 2, 2, 2, 5, 2,
+  2, 6, 2, 5, 2, 2, 6, 3, 8, 9,
+  9, 0, 1, 3, 1, 7, 9, 8, 1, 2,
+  7, 3, 3, 3, 3, 0, 1, 3, 3, 1,
+  1, 3, 1, 3, 3, 1
 };
 
 /* YYDPREC[RULE-NUM] -- Dynamic precedence of rule #RULE-NUM (0 if none).  */
@@ -2036,8 +2036,8 @@ static const unsigned char yydprec[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 2, 1, 2, 0, 0, 0, 0, 0,
-  1, 1, 1, 10, 10, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 2, 1, 2, 0, 0, 0,
+  0, 0, 1, 1, 1, 10, 10, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2055,8 +2055,8 @@ static const unsigned char yydprec[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 2, 1,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2069,8 +2069,8 @@ static const unsigned char yydprec[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 11, 10, 9, 8, 7,
-  6, 5, 4, 2, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 11, 10, 9,
+  8, 7, 6, 5, 4, 2, 1, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2112,7 +2112,7 @@ static const unsigned char yydprec[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 6, 5, 4, 3, 2, 1, 2, 0, 0,
+  0, 0, 0, 6, 5, 4, 3, 2, 1, 2,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2149,7 +2149,7 @@ static const unsigned char yydprec[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0
+  0, 0, 0, 0, 0, 0
 };
 
 /* YYMERGER[RULE-NUM] -- Index of merging function for rule #RULE-NUM.  */
@@ -2345,1406 +2345,1352 @@ static const unsigned char yymerger[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0
+  0, 0, 0, 0, 0, 0
 };
 
 /* YYDEFACT[S] -- default rule to reduce with in state S when YYTABLE
    doesn't specify something else to do.  Zero means the default is an
    error.  */
 static const unsigned short int yydefact[] = {
-  6, 10, 0, 6, 5, 7, 1, 4, 905, 155,
-  34, 0, 812, 117, 0, 203, 551, 517, 516, 1677,
-  280, 1677, 40, 96, 569, 394, 553, 37, 280, 395,
-  566, 812, 1677, 43, 61, 285, 522, 1913, 518, 0,
-  509, 8, 30, 31, 11, 12, 13, 28, 16, 15,
-  0, 14, 21, 423, 423, 959, 959, 911, 911, 24,
-  32, 0, 524, 22, 23, 29, 26, 0, 0, 574,
-  25, 27, 18, 19, 20, 17, 907, 46, 184, 0,
-  183, 0, 0, 171, 170, 0, 959, 959, 959, 0,
-  0, 0, 1693, 1803, 1694, 1695, 1696, 1804, 1805, 1806,
-  1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706,
-  1707, 1708, 1709, 1710, 1807, 1808, 1711, 1712, 1713, 1714,
-  1818, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723,
-  1724, 1725, 1726, 1727, 1809, 1728, 1729, 1731, 1730, 1733,
-  1734, 1732, 1735, 1736, 1810, 1740, 1737, 1738, 1739, 1741,
-  1819, 1811, 1742, 1743, 1744, 1745, 1746, 1823, 1747, 1748,
-  1749, 1750, 1751, 1752, 1820, 1817, 1822, 1753, 1754, 1755,
-  1756, 1757, 1758, 1759, 1760, 1824, 1825, 1761, 1762, 1812,
-  1763, 1764, 1765, 1766, 1767, 1768, 1769, 1821, 1770, 1771,
-  1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781,
-  1782, 1783, 1784, 1785, 1786, 1787, 1813, 1814, 1788, 1789,
-  1790, 1791, 1792, 1793, 1794, 1795, 1796, 1815, 1797, 1798,
-  1799, 1800, 1801, 1816, 1826, 1802, 1689, 1690, 1691, 1692,
-  423, 0, 813, 806, 0, 138, 959, 959, 0, 0,
-  0, 959, 959, 132, 1587, 1583, 1613, 1583, 1613, 1590,
-  1598, 1600, 1602, 1589, 0, 1618, 1620, 1682, 1603, 1680,
-  1650, 0, 1583, 1622, 1604, 1681, 1651, 1679, 1649, 1586,
-  1640, 1591, 1593, 1595, 1597, 1592, 1579, 1616, 33, 0,
-  1618, 1573, 1575, 1653, 275, 959, 1259, 1358, 1265, 1677,
-  1236, 0, 0, 1129, 1130, 1112, 0, 1331, 1352, 1334,
-  1343, 1355, 1212, 1170, 0, 0, 0, 1200, 1337, 0,
-  0, 1673, 1203, 1283, 394, 1292, 1131, 1682, 1257, 1349,
-  1346, 1268, 1359, 1360, 1206, 1298, 1197, 1680, 1669, 1667,
-  0, 1262, 0, 1110, 1307, 1295, 1258, 1215, 1209, 1681,
-  1340, 1679, 1158, 1361, 1280, 1240, 1248, 1242, 1246, 1356,
-  1173, 1188, 0, 0, 1304, 1218, 1672, 1301, 1674, 1274,
-  1357, 1194, 889, 889, 889, 889, 889, 889, 889, 889,
-  889, 889, 889, 889, 889, 889, 889, 889, 889, 889,
-  889, 889, 889, 889, 889, 889, 0, 1803, 1804, 1805,
-  1806, 1700, 1701, 1702, 1704, 1710, 1807, 1808, 1712, 1713,
-  1818, 1720, 1809, 1730, 1810, 1741, 1819, 1811, 1742, 1823,
-  1820, 1817, 1760, 1824, 1825, 1765, 1774, 1785, 1786, 1787,
-  1813, 1814, 1815, 1798, 1799, 1800, 1843, 1845, 1833, 1834,
-  1841, 1842, 1835, 1836, 1837, 1838, 0, 907, 1677, 1677,
-  992, 0, 1677, 1085, 1125, 92, 959, 1120, 0, 1666,
-  1548, 190, 1083, 1086, 1088, 1090, 1092, 1095, 1098, 1103,
-  1105, 1106, 1627, 1115, 1116, 0, 1241, 1243, 1244, 1245,
-  1247, 1249, 1250, 0, 0, 0, 0, 0, 0, 0,
-  1117, 1118, 1179, 1185, 1458, 1555, 1556, 1084, 1480, 0,
-  1124, 1121, 1545, 1547, 1550, 1119, 1671, 1668, 0, 1678,
-  1554, 1664, 1832, 1665, 1840, 1661, 1662, 1663, 1670, 283,
-  0, 0, 0, 284, 0, 0, 0, 281, 282, 635,
-  959, 635, 423, 0, 819, 99, 105, 114, 0, 0,
-  959, 814, 0, 0, 0, 0, 808, 809, 0, 0,
+  6, 10, 0, 6, 5, 7, 1, 4, 907, 155,
+  34, 0, 814, 117, 0, 203, 553, 519, 518, 1679,
+  280, 1679, 40, 96, 571, 394, 555, 37, 280, 395,
+  568, 814, 1679, 43, 61, 285, 524, 1915, 520, 0,
+  511, 8, 30, 31, 11, 12, 13, 28, 16, 15,
+  0, 14, 21, 423, 423, 961, 961, 913, 913, 24,
+  32, 0, 526, 22, 23, 29, 26, 0, 0, 576,
+  25, 27, 18, 19, 20, 17, 909, 46, 184, 0,
+  183, 0, 0, 171, 170, 0, 961, 961, 961, 0,
+  0, 0, 1695, 1805, 1696, 1697, 1698, 1806, 1807, 1808,
+  1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708,
+  1709, 1710, 1711, 1712, 1809, 1810, 1713, 1714, 1715, 1716,
+  1820, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725,
+  1726, 1727, 1728, 1729, 1811, 1730, 1731, 1733, 1732, 1735,
+  1736, 1734, 1737, 1738, 1812, 1742, 1739, 1740, 1741, 1743,
+  1821, 1813, 1744, 1745, 1746, 1747, 1748, 1825, 1749, 1750,
+  1751, 1752, 1753, 1754, 1822, 1819, 1824, 1755, 1756, 1757,
+  1758, 1759, 1760, 1761, 1762, 1826, 1827, 1763, 1764, 1814,
+  1765, 1766, 1767, 1768, 1769, 1770, 1771, 1823, 1772, 1773,
+  1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783,
+  1784, 1785, 1786, 1787, 1788, 1789, 1815, 1816, 1790, 1791,
+  1792, 1793, 1794, 1795, 1796, 1797, 1798, 1817, 1799, 1800,
+  1801, 1802, 1803, 1818, 1828, 1804, 1691, 1692, 1693, 1694,
+  423, 0, 815, 808, 0, 138, 961, 961, 0, 0,
+  0, 961, 961, 132, 1589, 1585, 1615, 1585, 1615, 1592,
+  1600, 1602, 1604, 1591, 0, 1620, 1622, 1684, 1605, 1682,
+  1652, 0, 1585, 1624, 1606, 1683, 1653, 1681, 1651, 1588,
+  1642, 1593, 1595, 1597, 1599, 1594, 1581, 1618, 33, 0,
+  1620, 1575, 1577, 1655, 275, 961, 1261, 1360, 1267, 1679,
+  1238, 0, 0, 1131, 1132, 1114, 0, 1333, 1354, 1336,
+  1345, 1357, 1214, 1172, 0, 0, 0, 1202, 1339, 0,
+  0, 1675, 1205, 1285, 394, 1294, 1133, 1684, 1259, 1351,
+  1348, 1270, 1361, 1362, 1208, 1300, 1199, 1682, 1671, 1669,
+  0, 1264, 0, 1112, 1309, 1297, 1260, 1217, 1211, 1683,
+  1342, 1681, 1160, 1363, 1282, 1242, 1250, 1244, 1248, 1358,
+  1175, 1190, 0, 0, 1306, 1220, 1674, 1303, 1676, 1276,
+  1359, 1196, 891, 891, 891, 891, 891, 891, 891, 891,
+  891, 891, 891, 891, 891, 891, 891, 891, 891, 891,
+  891, 891, 891, 891, 891, 891, 0, 1805, 1806, 1807,
+  1808, 1702, 1703, 1704, 1706, 1712, 1809, 1810, 1714, 1715,
+  1820, 1722, 1811, 1732, 1812, 1743, 1821, 1813, 1744, 1825,
+  1822, 1819, 1762, 1826, 1827, 1767, 1776, 1787, 1788, 1789,
+  1815, 1816, 1817, 1800, 1801, 1802, 1845, 1847, 1835, 1836,
+  1843, 1844, 1837, 1838, 1839, 1840, 0, 909, 1679, 1679,
+  994, 0, 1679, 1087, 1127, 92, 961, 1122, 0, 1668,
+  1550, 190, 1085, 1088, 1090, 1092, 1094, 1097, 1100, 1105,
+  1107, 1108, 1629, 1117, 1118, 0, 1243, 1245, 1246, 1247,
+  1249, 1251, 1252, 0, 0, 0, 0, 0, 0, 0,
+  1119, 1120, 1181, 1187, 1460, 1557, 1558, 1086, 1482, 0,
+  1126, 1123, 1547, 1549, 1552, 1121, 1673, 1670, 0, 1680,
+  1556, 1666, 1834, 1667, 1842, 1663, 1664, 1665, 1672, 283,
+  0, 0, 0, 284, 0, 0, 0, 281, 282, 637,
+  961, 637, 423, 0, 821, 99, 105, 114, 0, 0,
+  961, 816, 0, 0, 0, 0, 810, 811, 0, 0,
   55, 0, 47, 70, 0, 0, 0, 0, 0, 73,
-  88, 90, 0, 286, 287, 0, 0, 959, 495, 496,
-  0, 463, 505, 508, 506, 507, 0, 0, 0, 510,
-  519, 0, 0, 0, 445, 0, 513, 0, 520, 521,
-  0, 0, 0, 472, 455, 0, 0, 468, 456, 0,
-  0, 0, 502, 0, 0, 0, 0, 9, 0, 0,
-  0, 0, 0, 389, 390, 391, 964, 966, 965, 392,
-  404, 421, 960, 393, 405, 419, 417, 418, 423, 413,
-  0, 414, 0, 423, 442, 0, 0, 582, 576, 0,
-  0, 579, 0, 0, 0, 563, 906, 944, 0, 0,
-  1684, 600, 143, 280, 280, 205, 0, 185, 35, 612,
-  1459, 0, 632, 0, 205, 0, 0, 130, 0, 0,
-  630, 629, 0, 0, 0, 1584, 1582, 1615, 1614, 1606,
-  1578, 1607, 0, 1588, 0, 0, 1611, 0, 1585, 1583,
-  1581, 0, 1610, 1625, 1626, 0, 1627, 1641, 0, 1617,
-  1608, 0, 1568, 1574, 1640, 1654, 1652, 0, 0, 0,
-  0, 1677, 0, 1422, 1428, 0, 0, 0, 0, 0,
-  0, 1549, 1677, 1677, 1903, 0, 0, 0, 0, 0,
-  1873, 0, 0, 1880, 1882, 1883, 0, 0, 1254, 0,
-  0, 0, 0, 0, 907, 1463, 0, 0, 0, 0,
-  0, 0, 1464, 1677, 0, 1677, 1677, 0, 0, 0,
-  0, 0, 1462, 0, 1461, 0, 0, 0, 0, 0,
-  1874, 0, 0, 1875, 0, 0, 1877, 1878, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 890, 1870, 0,
-  1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855,
-  1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865,
-  1866, 1867, 1868, 1869, 888, 993, 0, 0, 0, 0,
-  0, 1459, 1903, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 95, 1677, 1677, 1677, 0, 0, 0, 980,
-  1479, 0, 1126, 1128, 1466, 1468, 1470, 1474, 1477, 92,
-  1107, 1108, 996, 1109, 1677, 421, 402, 0, 1492, 1494,
-  1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677,
-  1677, 1677, 0, 1114, 1628, 1677, 0, 1903, 1903, 1677,
-  1677, 1677, 1677, 0, 0, 0, 1493, 1519, 1504, 1520,
-  0, 1509, 0, 1515, 1514, 1534, 1535, 1536, 1537, 1539,
-  1538, 1504, 1504, 1504, 0, 1491, 1504, 0, 1504, 1504,
-  1677, 1677, 1677, 1510, 1486, 1677, 1677, 1677, 1551, 1552,
-  0, 1551, 0, 1677, 0, 1831, 1839, 0, 200, 1684,
-  199, 195, 194, 197, 0, 0, 205, 0, 816, 0,
-  820, 818, 0, 0, 0, 0, 0, 866, 0, 594,
-  599, 593, 590, 595, 596, 589, 588, 597, 587, 592,
-  570, 586, 0, 815, 0, 0, 0, 0, 0, 178,
-  181, 177, 567, 810, 522, 0, 0, 852, 856, 857,
-  858, 860, 859, 855, 53, 74, 0, 0, 50, 0,
-  0, 866, 83, 82, 84, 0, 0, 0, 0, 0,
-  1677, 0, 0, 278, 189, 266, 0, 523, 464, 0,
-  0, 0, 0, 0, 454, 469, 494, 493, 470, 465,
-  0, 1677, 1677, 466, 0, 451, 486, 484, 467, 490,
-  0, 471, 482, 1677, 1677, 0, 0, 460, 497, 498,
-  0, 0, 0, 436, 511, 512, 0, 201, 202, 94,
-  0, 994, 424, 985, 986, 987, 0, 425, 422, 0,
-  961, 963, 962, 420, 416, 386, 387, 419, 1677, 415,
-  427, 941, 912, 925, 934, 935, 388, 443, 444, 0,
-  0, 988, 989, 991, 0, 0, 907, 241, 234, 248,
-  262, 262, 262, 0, 0, 564, 565, 0, 572, 573,
-  0, 946, 908, 0, 0, 0, 0, 0, 0, 863,
-  864, 1637, 0, 601, 1637, 882, 0, 0, 889, 889,
-  883, 885, 881, 879, 0, 1637, 144, 146, 147, 148,
-  149, 150, 151, 152, 0, 0, 206, 207, 907, 1635,
-  168, 0, 1637, 36, 1460, 982, 0, 805, 627, 628,
-  633, 207, 600, 823, 0, 633, 633, 0, 0, 659,
-  0, 0, 0, 228, 0, 0, 1580, 0, 1643, 1644,
-  1642, 1605, 0, 0, 1570, 1577, 0, 1627, 274, 0,
-  907, 550, 546, 0, 527, 275, 1677, 1677, 1479, 0,
-  1677, 1422, 1425, 1677, 0, 1427, 1677, 0, 0, 1113,
-  1904, 1396, 1397, 0, 1677, 1677, 0, 0, 0, 0,
-  0, 1677, 0, 0, 1677, 0, 0, 1437, 1450, 1451,
-  1452, 1453, 1438, 1447, 1448, 1449, 1441, 1439, 1445, 1446,
-  1436, 1440, 1444, 1435, 1454, 1443, 1442, 0, 1677, 1677,
-  1677, 1677, 0, 0, 1677, 1677, 1677, 1677, 0, 1677,
-  0, 1111, 1677, 1677, 1677, 0, 1677, 0, 1677, 1677,
-  1677, 1677, 1677, 1677, 0, 0, 1677, 1677, 1677, 0,
-  0, 1677, 1677, 1677, 1677, 1677, 887, 1872, 886, 1871,
-  1677, 1677, 1677, 1677, 1677, 0, 1459, 0, 1677, 1677,
-  1677, 1677, 1677, 1677, 1677, 1677, 1478, 1475, 1476, 402,
-  1540, 1122, 1677, 1123, 1051, 1677, 1677, 1472, 0, 1677,
-  91, 0, 0, 1087, 1089, 1091, 1093, 1094, 1097, 1096,
-  1101, 1102, 1099, 1100, 1104, 1630, 1631, 1629, 0, 0,
-  1677, 1677, 1677, 1677, 0, 0, 0, 0, 0, 1677,
-  1677, 1481, 1505, 1507, 1506, 1503, 0, 1517, 1518, 1521,
-  1508, 1511, 1496, 1498, 1500, 1677, 1504, 1495, 1504, 1497,
-  1499, 1482, 1484, 1485, 1512, 0, 1522, 1489, 1487, 1546,
-  1544, 1542, 1543, 1541, 1676, 0, 0, 0, 196, 861,
-  636, 198, 207, 288, 265, 0, 1677, 423, 1653, 0,
-  0, 423, 867, 0, 0, 598, 0, 0, 571, 0,
-  0, 817, 0, 176, 187, 188, 0, 0, 568, 811,
-  1677, 853, 854, 0, 44, 219, 1653, 0, 48, 0,
-  0, 0, 81, 0, 0, 0, 65, 782, 1627, 1627,
-  87, 89, 273, 0, 269, 0, 271, 0, 0, 216,
-  217, 504, 487, 485, 489, 488, 448, 449, 453, 483,
-  446, 447, 514, 450, 491, 492, 457, 458, 459, 503,
-  461, 499, 0, 0, 0, 1677, 1677, 452, 0, 995,
-  0, 278, 430, 435, 429, 0, 432, 433, 434, 0,
-  959, 1051, 1051, 990, 0, 270, 1677, 241, 234, 266,
-  0, 245, 245, 241, 245, 0, 0, 232, 0, 263,
-  256, 0, 250, 251, 583, 577, 580, 575, 947, 0,
-  1051, 936, 915, 920, 933, 931, 932, 0, 0, 829,
-  825, 826, 1683, 0, 161, 162, 1639, 0, 160, 1844,
-  884, 889, 0, 880, 0, 878, 889, 163, 145, 156,
-  173, 208, 0, 1633, 1636, 0, 0, 169, 1455, 0,
-  0, 0, 604, 827, 824, 143, 0, 0, 0, 0,
-  0, 0, 721, 0, 1599, 0, 1640, 1619, 1621, 0,
-  1623, 0, 1594, 0, 1569, 1609, 549, 0, 0, 0,
-  0, 528, 1021, 0, 0, 0, 1677, 0, 0, 1424,
-  1423, 1421, 0, 1239, 1419, 1132, 0, 0, 1333, 1354,
-  1336, 1345, 1213, 0, 0, 0, 0, 1339, 0, 1558,
-  1677, 0, 0, 0, 0, 1351, 1348, 0, 0, 0,
-  0, 1677, 0, 1677, 0, 0, 0, 1216, 0, 1342,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1417, 1415, 1416, 1677, 0, 0, 0, 0, 0,
-  0, 0, 0, 1645, 1645, 0, 1156, 1401, 1677, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 981, 1055,
-  1127, 1465, 1467, 1471, 1469, 1473, 278, 1911, 0, 1252,
-  0, 0, 0, 0, 1406, 1677, 1677, 0, 0, 0,
-  0, 0, 1516, 1513, 1360, 0, 0, 1524, 1501, 1502,
-  0, 1677, 1675, 1553, 862, 0, 0, 0, 191, 41,
-  0, 0, 0, 0, 1907, 1660, 1908, 1655, 1659, 821,
-  100, 0, 423, 423, 112, 423, 0, 0, 585, 0,
-  38, 179, 182, 180, 807, 0, 45, 220, 221, 0,
-  0, 51, 49, 869, 868, 68, 872, 871, 870, 0,
-  86, 85, 62, 1677, 0, 0, 66, 76, 79, 0,
-  0, 267, 0, 217, 217, 0, 0, 212, 0, 0,
-  0, 0, 439, 437, 438, 93, 0, 0, 407, 1677,
-  428, 426, 967, 913, 922, 0, 0, 526, 536, 0,
-  0, 0, 1554, 0, 232, 247, 0, 246, 242, 243,
-  0, 244, 527, 231, 0, 0, 0, 0, 258, 249,
-  261, 584, 578, 581, 945, 949, 1685, 909, 0, 1051,
-  0, 865, 1638, 602, 877, 876, 0, 159, 0, 0,
-  1634, 167, 1632, 186, 1677, 1457, 0, 659, 121, 605,
-  608, 0, 828, 1637, 0, 0, 897, 897, 0, 660,
-  0, 637, 1601, 227, 1627, 0, 1596, 1576, 0, 547,
-  545, 543, 0, 1677, 0, 1071, 544, 1677, 1266, 1429,
-  1677, 1420, 0, 0, 1134, 1136, 1214, 1171, 0, 1881,
-  1201, 1255, 0, 0, 1204, 1677, 1154, 1677, 1269, 1207,
-  1677, 1198, 0, 1263, 0, 1677, 1677, 1677, 1217, 1210,
-  1677, 1677, 1677, 1677, 0, 1174, 0, 1876, 1189, 1677,
-  1677, 0, 1677, 1677, 1228, 1677, 1275, 1195, 1677, 1320,
-  0, 0, 0, 1323, 0, 1398, 1401, 1677, 1677, 1290,
-  1272, 0, 0, 1677, 1278, 403, 1056, 0, 0, 1253,
-  1138, 1139, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1409, 0, 0, 1677, 1677, 0, 1677, 1677, 0,
-  1677, 1677, 1529, 1677, 1490, 1828, 1830, 1483, 1827, 1829,
-  1488, 0, 289, 264, 42, 1656, 1657, 1658, 1677, 822,
-  101, 423, 106, 109, 113, 115, 423, 591, 0, 39,
-  54, 230, 223, 222, 56, 226, 225, 224, 219, 52,
-  69, 71, 875, 874, 873, 63, 0, 0, 0, 788,
-  1769, 784, 790, 786, 800, 799, 785, 804, 803, 801,
-  802, 781, 77, 80, 0, 268, 0, 213, 214, 218,
-  215, 515, 500, 501, 462, 1677, 1677, 401, 396, 0,
-  0, 406, 431, 968, 969, 970, 974, 1066, 1066, 0,
-  542, 0, 1677, 1677, 0, 262, 233, 235, 0, 1021,
-  238, 767, 768, 0, 0, 0, 0, 0, 0, 0,
-  0, 1066, 974, 937, 939, 917, 166, 603, 349, 0,
-  319, 323, 0, 157, 310, 175, 349, 349, 349, 0,
-  319, 349, 1889, 0, 319, 0, 0, 0, 0, 0,
-  174, 297, 302, 303, 1627, 1896, 296, 0, 1456, 634,
-  721, 0, 0, 609, 1637, 833, 832, 834, 127, 131,
-  0, 0, 0, 898, 900, 1559, 0, 0, 722, 664,
-  615, 1612, 1624, 548, 0, 0, 529, 0, 0, 552,
-  0, 1267, 1426, 1583, 0, 1583, 0, 0, 1566, 1409,
-  0, 0, 1172, 1884, 1202, 1256, 1557, 1430, 1205, 0,
-  1155, 0, 1270, 1208, 0, 1199, 1418, 1264, 1157, 0,
-  0, 0, 1211, 0, 0, 0, 0, 0, 1175, 1879,
-  1190, 0, 0, 1677, 0, 0, 1229, 0, 1276, 1196,
-  0, 1321, 1648, 1647, 1646, 1231, 1234, 1324, 1677, 0,
-  0, 1398, 0, 0, 1291, 1273, 0, 0, 0, 1279,
-  1052, 0, 0, 0, 1408, 1407, 0, 1403, 1677, 0,
-  1409, 0, 0, 1413, 1677, 1677, 1532, 1533, 1530, 1525,
-  1526, 1531, 1527, 1528, 1523, 0, 1905, 1906, 103, 107,
-  110, 116, 97, 0, 0, 57, 1677, 72, 787, 789,
-  798, 797, 1677, 796, 795, 792, 791, 0, 279, 440,
-  441, 0, 1677, 408, 0, 971, 956, 973, 1677, 0,
-  1039, 1039, 0, 540, 535, 539, 537, 538, 252, 237,
-  1048, 239, 236, 0, 0, 0, 257, 0, 948, 0,
-  0, 1039, 0, 0, 1066, 351, 0, 350, 0, 323,
-  0, 907, 0, 0, 311, 337, 0, 323, 907, 307,
-  320, 321, 0, 0, 322, 0, 364, 0, 323, 0,
-  311, 324, 0, 648, 0, 325, 311, 323, 0, 0,
-  290, 337, 0, 0, 295, 0, 299, 373, 1677, 0,
-  0, 207, 323, 292, 291, 0, 367, 298, 1890, 0,
-  0, 293, 311, 323, 0, 1903, 0, 0, 1897, 0,
-  301, 0, 613, 0, 606, 0, 124, 0, 140, 0,
-  894, 0, 1560, 1562, 1561, 0, 903, 0, 661, 0,
-  325, 0, 0, 732, 733, 739, 740, 741, 0, 1637,
-  323, 617, 531, 530, 0, 1023, 1034, 1022, 1026, 1031,
-  275, 0, 1063, 1072, 1059, 1062, 1064, 1260, 1583, 0,
-  1237, 1413, 1409, 1409, 1677, 1293, 1299, 1677, 1311, 1296,
-  1677, 1162, 1677, 1168, 1281, 1192, 1677, 0, 1222, 1225,
-  1302, 1177, 1232, 1235, 1402, 1080, 1399, 1400, 1151, 0,
-  1287, 1677, 1314, 1317, 1183, 1677, 0, 1409, 1409, 1409,
-  0, 1406, 0, 0, 1413, 0, 1677, 0, 0, 0,
-  0, 0, 104, 98, 1677, 229, 59, 783, 0, 0,
-  272, 0, 400, 399, 409, 974, 0, 0, 942, 975,
-  977, 532, 532, 1068, 1067, 0, 914, 923, 541, 0,
-  1071, 1677, 0, 0, 0, 260, 1686, 952, 950, 910,
-  940, 938, 1039, 331, 340, 719, 720, 0, 341, 706,
-  1677, 0, 327, 1633, 343, 308, 313, 304, 312, 0,
-  664, 348, 0, 0, 0, 376, 1633, 907, 358, 361,
-  359, 363, 382, 362, 0, 360, 357, 309, 305, 0,
-  0, 0, 326, 306, 647, 172, 331, 0, 384, 0,
-  0, 1901, 0, 355, 0, 357, 370, 0, 0, 0,
-  0, 1902, 294, 0, 314, 1900, 1899, 315, 300, 0,
-  209, 664, 621, 0, 607, 610, 125, 846, 842, 840,
-  847, 844, 0, 830, 838, 0, 896, 895, 0, 899,
-  904, 1637, 1637, 891, 664, 665, 0, 0, 0, 769,
-  669, 666, 667, 668, 664, 638, 0, 1706, 744, 734,
-  616, 0, 619, 0, 0, 1032, 1033, 0, 0, 0,
-  0, 0, 0, 0, 0, 1261, 0, 1238, 0, 1413,
-  1413, 0, 1294, 1300, 0, 1312, 1297, 0, 1163, 0,
-  1169, 1282, 1193, 0, 1219, 1223, 1226, 1303, 1178, 1080,
-  1080, 0, 1079, 1149, 1288, 0, 1315, 1318, 1184, 1053,
-  1076, 0, 1413, 1413, 1413, 1404, 1405, 0, 0, 1409,
-  0, 0, 1410, 1677, 1147, 0, 0, 209, 0, 60,
-  0, 0, 0, 1677, 972, 957, 984, 958, 953, 1677,
-  0, 978, 534, 979, 0, 0, 1040, 0, 1677, 525,
-  240, 254, 255, 253, 967, 967, 967, 967, 967, 0,
-  918, 0, 664, 664, 0, 708, 0, 323, 352, 0,
-  0, 1892, 344, 664, 338, 664, 664, 0, 378, 1633,
-  0, 380, 323, 323, 0, 0, 323, 385, 1677, 374,
-  356, 0, 0, 368, 1677, 1677, 1677, 0, 0, 1677,
-  997, 210, 727, 0, 726, 730, 0, 654, 615, 622,
-  653, 657, 658, 656, 0, 611, 843, 841, 845, 1677,
-  0, 0, 839, 142, 0, 902, 901, 893, 894, 892,
-  0, 738, 1677, 325, 325, 770, 771, 325, 702, 0,
-  0, 1637, 670, 672, 731, 997, 749, 618, 639, 620,
-  1024, 1028, 0, 1025, 1029, 1035, 1065, 1058, 1057, 1060,
-  1061, 0, 1133, 0, 0, 1284, 1308, 1159, 1165, 1305,
-  1220, 1077, 1078, 1081, 1082, 1150, 1327, 1677, 1073, 1677,
-  0, 0, 0, 0, 0, 1413, 1144, 1677, 1414, 1180,
-  1186, 193, 0, 554, 555, 556, 794, 793, 398, 397,
-  0, 0, 943, 976, 533, 1070, 1069, 0, 0, 1049,
-  927, 928, 930, 929, 926, 951, 0, 664, 332, 346,
-  718, 1559, 714, 342, 705, 0, 0, 353, 0, 339,
-  735, 736, 379, 377, 381, 365, 366, 650, 318, 0,
-  383, 375, 354, 371, 369, 0, 0, 0, 0, 0,
-  0, 1637, 0, 664, 664, 614, 0, 617, 0, 652,
-  997, 851, 831, 850, 835, 849, 0, 0, 664, 723,
-  0, 0, 0, 0, 703, 704, 701, 742, 0, 1637,
-  0, 1677, 1677, 777, 0, 774, 746, 750, 752, 753,
-  754, 755, 756, 759, 757, 758, 760, 907, 641, 0,
-  1912, 0, 1640, 1135, 1137, 1285, 1309, 1160, 1166, 1306,
-  1328, 1075, 1677, 1054, 0, 1140, 1141, 1142, 1409, 1409,
-  0, 0, 1181, 1187, 0, 0, 0, 557, 0, 558,
-  983, 954, 277, 1041, 924, 1073, 0, 0, 333, 347,
-  1560, 710, 0, 712, 0, 716, 715, 0, 1891, 335,
-  0, 0, 372, 0, 0, 0, 316, 0, 211, 0,
-  1677, 728, 725, 655, 619, 651, 1637, 836, 837, 0,
-  0, 0, 0, 737, 724, 700, 0, 0, 674, 671,
-  743, 663, 779, 778, 889, 780, 0, 0, 0, 669,
-  0, 772, 0, 0, 747, 745, 751, 640, 646, 0,
-  1633, 1027, 1030, 1627, 1074, 1325, 1413, 1413, 1145, 1411,
-  0, 0, 997, 0, 1050, 919, 329, 1559, 709, 713,
-  0, 707, 0, 0, 336, 649, 0, 0, 1677, 0,
-  1898, 165, 999, 729, 623, 122, 1637, 0, 1637, 0,
-  0, 677, 679, 0, 0, 1677, 775, 669, 763, 669,
-  773, 669, 0, 748, 907, 0, 0, 0, 119, 1567,
-  0, 0, 0, 1152, 0, 0, 1000, 276, 330, 711,
-  717, 1677, 0, 317, 0, 1886, 0, 625, 624, 128,
-  848, 133, 0, 0, 0, 680, 681, 678, 673, 889,
-  0, 764, 762, 761, 682, 645, 0, 644, 0, 1143,
-  1146, 1409, 0, 410, 1010, 1006, 0, 1003, 0, 1910,
-  0, 1637, 1677, 1888, 1887, 154, 0, 118, 626, 134,
-  1637, 676, 0, 0, 669, 0, 684, 643, 642, 0,
-  997, 0, 0, 0, 1012, 1001, 0, 1002, 0, 1677,
-  1637, 1893, 0, 907, 136, 682, 776, 765, 0, 0,
-  669, 685, 1412, 561, 411, 1688, 0, 997, 1016, 0,
-  1018, 1677, 1008, 1909, 1895, 1637, 1885, 137, 684, 683,
-  0, 0, 766, 0, 0, 559, 0, 412, 560, 1011,
-  1015, 1677, 1013, 1021, 0, 1005, 1009, 1677, 1894, 675,
-  693, 0, 695, 0, 0, 698, 0, 0, 0, 1677,
-  1687, 1016, 679, 1036, 1677, 1007, 694, 696, 697, 699,
-  686, 0, 688, 0, 0, 691, 0, 562, 1014, 1017,
-  0, 955, 1020, 687, 689, 690, 692, 0, 0, 0,
-  0, 1038, 1046, 1047, 1037, 1043, 1044, 0, 0, 1045,
-  1042
+  88, 90, 0, 286, 287, 0, 0, 961, 497, 498,
+  0, 463, 507, 510, 508, 509, 0, 0, 0, 512,
+  521, 0, 0, 0, 0, 445, 0, 515, 0, 522,
+  523, 0, 0, 0, 472, 455, 0, 0, 468, 456,
+  0, 0, 0, 504, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 389, 390, 391, 966, 968, 967,
+  392, 404, 421, 962, 393, 405, 419, 417, 418, 423,
+  413, 0, 414, 0, 423, 442, 0, 0, 584, 578,
+  0, 0, 581, 0, 0, 0, 565, 908, 946, 0,
+  0, 1686, 602, 143, 280, 280, 205, 0, 185, 35,
+  614, 1461, 0, 634, 0, 205, 0, 0, 130, 0,
+  0, 632, 631, 0, 0, 0, 1586, 1584, 1617, 1616,
+  1608, 1580, 1609, 0, 1590, 0, 0, 1613, 0, 1587,
+  1585, 1583, 0, 1612, 1627, 1628, 0, 1629, 1643, 0,
+  1619, 1610, 0, 1570, 1576, 1642, 1656, 1654, 0, 0,
+  0, 0, 1679, 0, 1424, 1430, 0, 0, 0, 0,
+  0, 0, 1551, 1679, 1679, 1905, 0, 0, 0, 0,
+  0, 1875, 0, 0, 1882, 1884, 1885, 0, 0, 1256,
+  0, 0, 0, 0, 0, 909, 1465, 0, 0, 0,
+  0, 0, 0, 1466, 1679, 0, 1679, 1679, 0, 0,
+  0, 0, 0, 1464, 0, 1463, 0, 0, 0, 0,
+  0, 1876, 0, 0, 1877, 0, 0, 1879, 1880, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 892, 1872,
+  0, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856,
+  1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866,
+  1867, 1868, 1869, 1870, 1871, 890, 995, 0, 0, 0,
+  0, 0, 1461, 1905, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 95, 1679, 1679, 1679, 0, 0, 0,
+  982, 1481, 0, 1128, 1130, 1468, 1470, 1472, 1476, 1479,
+  92, 1109, 1110, 998, 1111, 1679, 421, 402, 0, 1494,
+  1496, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1679,
+  1679, 1679, 1679, 0, 1116, 1630, 1679, 0, 1905, 1905,
+  1679, 1679, 1679, 1679, 0, 0, 0, 1495, 1521, 1506,
+  1522, 0, 1511, 0, 1517, 1516, 1536, 1537, 1538, 1539,
+  1541, 1540, 1506, 1506, 1506, 0, 1493, 1506, 0, 1506,
+  1506, 1679, 1679, 1679, 1512, 1488, 1679, 1679, 1679, 1553,
+  1554, 0, 1553, 0, 1679, 0, 1833, 1841, 0, 200,
+  1686, 199, 195, 194, 197, 0, 0, 205, 0, 818,
+  0, 822, 820, 0, 0, 0, 0, 0, 868, 0,
+  596, 601, 595, 592, 597, 598, 591, 590, 599, 589,
+  594, 572, 588, 0, 817, 0, 0, 0, 0, 0,
+  178, 181, 177, 569, 812, 524, 0, 0, 854, 858,
+  859, 860, 862, 861, 857, 53, 74, 0, 0, 50,
+  0, 0, 868, 83, 82, 84, 0, 0, 0, 0,
+  0, 1679, 0, 0, 278, 189, 266, 0, 525, 464,
+  0, 0, 0, 0, 0, 454, 469, 496, 495, 470,
+  473, 465, 0, 1679, 1679, 466, 0, 451, 488, 486,
+  467, 492, 0, 471, 484, 1679, 1679, 0, 0, 460,
+  499, 500, 0, 0, 0, 436, 513, 514, 0, 201,
+  202, 94, 0, 996, 424, 987, 988, 989, 0, 425,
+  422, 0, 963, 965, 964, 420, 416, 386, 387, 419,
+  1679, 415, 427, 943, 914, 927, 936, 937, 388, 443,
+  444, 0, 0, 990, 991, 993, 0, 0, 909, 241,
+  234, 248, 262, 262, 262, 0, 0, 566, 567, 0,
+  574, 575, 0, 948, 910, 0, 0, 0, 0, 0,
+  0, 865, 866, 1639, 0, 603, 1639, 884, 0, 0,
+  891, 891, 885, 887, 883, 881, 0, 1639, 144, 146,
+  147, 148, 149, 150, 151, 152, 0, 0, 206, 207,
+  909, 1637, 168, 0, 1639, 36, 1462, 984, 0, 807,
+  629, 630, 635, 207, 602, 825, 0, 635, 635, 0,
+  0, 661, 0, 0, 0, 228, 0, 0, 1582, 0,
+  1645, 1646, 1644, 1607, 0, 0, 1572, 1579, 0, 1629,
+  274, 0, 909, 552, 548, 0, 529, 275, 1679, 1679,
+  1481, 0, 1679, 1424, 1427, 1679, 0, 1429, 1679, 0,
+  0, 1115, 1906, 1398, 1399, 0, 1679, 1679, 0, 0,
+  0, 0, 0, 1679, 0, 0, 1679, 0, 0, 1439,
+  1452, 1453, 1454, 1455, 1440, 1449, 1450, 1451, 1443, 1441,
+  1447, 1448, 1438, 1442, 1446, 1437, 1456, 1445, 1444, 0,
+  1679, 1679, 1679, 1679, 0, 0, 1679, 1679, 1679, 1679,
+  0, 1679, 0, 1113, 1679, 1679, 1679, 0, 1679, 0,
+  1679, 1679, 1679, 1679, 1679, 1679, 0, 0, 1679, 1679,
+  1679, 0, 0, 1679, 1679, 1679, 1679, 1679, 889, 1874,
+  888, 1873, 1679, 1679, 1679, 1679, 1679, 0, 1461, 0,
+  1679, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1480, 1477,
+  1478, 402, 1542, 1124, 1679, 1125, 1053, 1679, 1679, 1474,
+  0, 1679, 91, 0, 0, 1089, 1091, 1093, 1095, 1096,
+  1099, 1098, 1103, 1104, 1101, 1102, 1106, 1632, 1633, 1631,
+  0, 0, 1679, 1679, 1679, 1679, 0, 0, 0, 0,
+  0, 1679, 1679, 1483, 1507, 1509, 1508, 1505, 0, 1519,
+  1520, 1523, 1510, 1513, 1498, 1500, 1502, 1679, 1506, 1497,
+  1506, 1499, 1501, 1484, 1486, 1487, 1514, 0, 1524, 1491,
+  1489, 1548, 1546, 1544, 1545, 1543, 1678, 0, 0, 0,
+  196, 863, 638, 198, 207, 288, 265, 0, 1679, 423,
+  1655, 0, 0, 423, 869, 0, 0, 600, 0, 0,
+  573, 0, 0, 819, 0, 176, 187, 188, 0, 0,
+  570, 813, 1679, 855, 856, 0, 44, 219, 1655, 0,
+  48, 0, 0, 0, 81, 0, 0, 0, 65, 784,
+  1629, 1629, 87, 89, 273, 0, 269, 0, 271, 0,
+  0, 216, 217, 506, 489, 487, 491, 490, 448, 449,
+  453, 485, 446, 447, 516, 450, 493, 494, 457, 458,
+  459, 505, 461, 501, 0, 0, 0, 1679, 1679, 452,
+  0, 997, 0, 278, 430, 435, 429, 0, 432, 433,
+  434, 0, 961, 1053, 1053, 992, 0, 270, 1679, 241,
+  234, 266, 0, 245, 245, 241, 245, 0, 0, 232,
+  0, 263, 256, 0, 250, 251, 585, 579, 582, 577,
+  949, 0, 1053, 938, 917, 922, 935, 933, 934, 0,
+  0, 831, 827, 828, 1685, 0, 161, 162, 1641, 0,
+  160, 1846, 886, 891, 0, 882, 0, 880, 891, 163,
+  145, 156, 173, 208, 0, 1635, 1638, 0, 0, 169,
+  1457, 0, 0, 0, 606, 829, 826, 143, 0, 0,
+  0, 0, 0, 0, 723, 0, 1601, 0, 1642, 1621,
+  1623, 0, 1625, 0, 1596, 0, 1571, 1611, 551, 0,
+  0, 0, 0, 530, 1023, 0, 0, 0, 1679, 0,
+  0, 1426, 1425, 1423, 0, 1241, 1421, 1134, 0, 0,
+  1335, 1356, 1338, 1347, 1215, 0, 0, 0, 0, 1341,
+  0, 1560, 1679, 0, 0, 0, 0, 1353, 1350, 0,
+  0, 0, 0, 1679, 0, 1679, 0, 0, 0, 1218,
+  0, 1344, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1419, 1417, 1418, 1679, 0, 0, 0,
+  0, 0, 0, 0, 0, 1647, 1647, 0, 1158, 1403,
+  1679, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  983, 1057, 1129, 1467, 1469, 1473, 1471, 1475, 278, 1913,
+  0, 1254, 0, 0, 0, 0, 1408, 1679, 1679, 0,
+  0, 0, 0, 0, 1518, 1515, 1362, 0, 0, 1526,
+  1503, 1504, 0, 1679, 1677, 1555, 864, 0, 0, 0,
+  191, 41, 0, 0, 0, 0, 1909, 1662, 1910, 1657,
+  1661, 823, 100, 0, 423, 423, 112, 423, 0, 0,
+  587, 0, 38, 179, 182, 180, 809, 0, 45, 220,
+  221, 0, 0, 51, 49, 871, 870, 68, 874, 873,
+  872, 0, 86, 85, 62, 1679, 0, 0, 66, 76,
+  79, 0, 0, 267, 0, 217, 217, 0, 0, 212,
+  0, 0, 0, 0, 439, 437, 438, 93, 0, 0,
+  407, 1679, 428, 426, 969, 915, 924, 0, 0, 528,
+  538, 0, 0, 0, 1556, 0, 232, 247, 0, 246,
+  242, 243, 0, 244, 529, 231, 0, 0, 0, 0,
+  258, 249, 261, 586, 580, 583, 947, 951, 1687, 911,
+  0, 1053, 0, 867, 1640, 604, 879, 878, 0, 159,
+  0, 0, 1636, 167, 1634, 186, 1679, 1459, 0, 661,
+  121, 607, 610, 0, 830, 1639, 0, 0, 899, 899,
+  0, 662, 0, 639, 1603, 227, 1629, 0, 1598, 1578,
+  0, 549, 547, 545, 0, 1679, 0, 1073, 546, 1679,
+  1268, 1431, 1679, 1422, 0, 0, 1136, 1138, 1216, 1173,
+  0, 1883, 1203, 1257, 0, 0, 1206, 1679, 1156, 1679,
+  1271, 1209, 1679, 1200, 0, 1265, 0, 1679, 1679, 1679,
+  1219, 1212, 1679, 1679, 1679, 1679, 0, 1176, 0, 1878,
+  1191, 1679, 1679, 0, 1679, 1679, 1230, 1679, 1277, 1197,
+  1679, 1322, 0, 0, 0, 1325, 0, 1400, 1403, 1679,
+  1679, 1292, 1274, 0, 0, 1679, 1280, 403, 1058, 0,
+  0, 1255, 1140, 1141, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1411, 0, 0, 1679, 1679, 0, 1679,
+  1679, 0, 1679, 1679, 1531, 1679, 1492, 1830, 1832, 1485,
+  1829, 1831, 1490, 0, 289, 264, 42, 1658, 1659, 1660,
+  1679, 824, 101, 423, 106, 109, 113, 115, 423, 593,
+  0, 39, 54, 230, 223, 222, 56, 226, 225, 224,
+  219, 52, 69, 71, 877, 876, 875, 63, 0, 0,
+  0, 790, 1771, 786, 792, 788, 802, 801, 787, 806,
+  805, 803, 804, 783, 77, 80, 0, 268, 0, 213,
+  214, 218, 215, 517, 502, 503, 462, 1679, 1679, 401,
+  396, 0, 0, 406, 431, 970, 971, 972, 976, 1068,
+  1068, 0, 544, 0, 1679, 1679, 0, 262, 233, 235,
+  0, 1023, 238, 769, 770, 0, 0, 0, 0, 0,
+  0, 0, 0, 1068, 976, 939, 941, 919, 166, 605,
+  349, 0, 319, 323, 0, 157, 310, 175, 349, 349,
+  349, 0, 319, 349, 1891, 0, 319, 0, 0, 0,
+  0, 0, 174, 297, 302, 303, 1629, 1898, 296, 0,
+  1458, 636, 723, 0, 0, 611, 1639, 835, 834, 836,
+  127, 131, 0, 0, 0, 900, 902, 1561, 0, 0,
+  724, 666, 617, 1614, 1626, 550, 0, 0, 531, 0,
+  0, 554, 0, 1269, 1428, 1585, 0, 1585, 0, 0,
+  1568, 1411, 0, 0, 1174, 1886, 1204, 1258, 1559, 1432,
+  1207, 0, 1157, 0, 1272, 1210, 0, 1201, 1420, 1266,
+  1159, 0, 0, 0, 1213, 0, 0, 0, 0, 0,
+  1177, 1881, 1192, 0, 0, 1679, 0, 0, 1231, 0,
+  1278, 1198, 0, 1323, 1650, 1649, 1648, 1233, 1236, 1326,
+  1679, 0, 0, 1400, 0, 0, 1293, 1275, 0, 0,
+  0, 1281, 1054, 0, 0, 0, 1410, 1409, 0, 1405,
+  1679, 0, 1411, 0, 0, 1415, 1679, 1679, 1534, 1535,
+  1532, 1527, 1528, 1533, 1529, 1530, 1525, 0, 1907, 1908,
+  103, 107, 110, 116, 97, 0, 0, 57, 1679, 72,
+  789, 791, 800, 799, 1679, 798, 797, 794, 793, 0,
+  279, 440, 441, 0, 1679, 408, 0, 973, 958, 975,
+  1679, 0, 1041, 1041, 0, 542, 537, 541, 539, 540,
+  252, 237, 1050, 239, 236, 0, 0, 0, 257, 0,
+  950, 0, 0, 1041, 0, 0, 1068, 351, 0, 350,
+  0, 323, 0, 909, 0, 0, 311, 337, 0, 323,
+  909, 307, 320, 321, 0, 0, 322, 0, 364, 0,
+  323, 0, 311, 324, 0, 650, 0, 325, 311, 323,
+  0, 0, 290, 337, 0, 0, 295, 0, 299, 373,
+  1679, 0, 0, 207, 323, 292, 291, 0, 367, 298,
+  1892, 0, 0, 293, 311, 323, 0, 1905, 0, 0,
+  1899, 0, 301, 0, 615, 0, 608, 0, 124, 0,
+  140, 0, 896, 0, 1562, 1564, 1563, 0, 905, 0,
+  663, 0, 325, 0, 0, 734, 735, 741, 742, 743,
+  0, 1639, 323, 619, 533, 532, 0, 1025, 1036, 1024,
+  1028, 1033, 275, 0, 1065, 1074, 1061, 1064, 1066, 1262,
+  1585, 0, 1239, 1415, 1411, 1411, 1679, 1295, 1301, 1679,
+  1313, 1298, 1679, 1164, 1679, 1170, 1283, 1194, 1679, 0,
+  1224, 1227, 1304, 1179, 1234, 1237, 1404, 1082, 1401, 1402,
+  1153, 0, 1289, 1679, 1316, 1319, 1185, 1679, 0, 1411,
+  1411, 1411, 0, 1408, 0, 0, 1415, 0, 1679, 0,
+  0, 0, 0, 0, 104, 98, 1679, 229, 59, 785,
+  0, 0, 272, 0, 400, 399, 409, 976, 0, 0,
+  944, 977, 979, 534, 534, 1070, 1069, 0, 916, 925,
+  543, 0, 1073, 1679, 0, 0, 0, 260, 1688, 954,
+  952, 912, 942, 940, 1041, 331, 340, 721, 722, 0,
+  341, 708, 1679, 0, 327, 1635, 343, 308, 313, 304,
+  312, 0, 666, 348, 0, 0, 0, 376, 1635, 909,
+  358, 361, 359, 363, 382, 362, 0, 360, 357, 309,
+  305, 0, 0, 0, 326, 306, 649, 172, 331, 0,
+  384, 0, 0, 1903, 0, 355, 0, 357, 370, 0,
+  0, 0, 0, 1904, 294, 0, 314, 1902, 1901, 315,
+  300, 0, 209, 666, 623, 0, 609, 612, 125, 848,
+  844, 842, 849, 846, 0, 832, 840, 0, 898, 897,
+  0, 901, 906, 1639, 1639, 893, 666, 667, 0, 0,
+  0, 771, 671, 668, 669, 670, 666, 640, 0, 1708,
+  746, 736, 618, 0, 621, 0, 0, 1034, 1035, 0,
+  0, 0, 0, 0, 0, 0, 0, 1263, 0, 1240,
+  0, 1415, 1415, 0, 1296, 1302, 0, 1314, 1299, 0,
+  1165, 0, 1171, 1284, 1195, 0, 1221, 1225, 1228, 1305,
+  1180, 1082, 1082, 0, 1081, 1151, 1290, 0, 1317, 1320,
+  1186, 1055, 1078, 0, 1415, 1415, 1415, 1406, 1407, 0,
+  0, 1411, 0, 0, 1412, 1679, 1149, 0, 0, 209,
+  0, 60, 0, 0, 0, 1679, 974, 959, 986, 960,
+  955, 1679, 0, 980, 536, 981, 0, 0, 1042, 0,
+  1679, 527, 240, 254, 255, 253, 969, 969, 969, 969,
+  969, 0, 920, 0, 666, 666, 0, 710, 0, 323,
+  352, 0, 0, 1894, 344, 666, 338, 666, 666, 0,
+  378, 1635, 0, 380, 323, 323, 0, 0, 323, 385,
+  1679, 374, 356, 0, 0, 368, 1679, 1679, 1679, 0,
+  0, 1679, 999, 210, 729, 0, 728, 732, 0, 656,
+  617, 624, 655, 659, 660, 658, 0, 613, 845, 843,
+  847, 1679, 0, 0, 841, 142, 0, 904, 903, 895,
+  896, 894, 0, 740, 1679, 325, 325, 772, 773, 325,
+  704, 0, 0, 1639, 672, 674, 733, 999, 751, 620,
+  641, 622, 1026, 1030, 0, 1027, 1031, 1037, 1067, 1060,
+  1059, 1062, 1063, 0, 1135, 0, 0, 1286, 1310, 1161,
+  1167, 1307, 1222, 1079, 1080, 1083, 1084, 1152, 1329, 1679,
+  1075, 1679, 0, 0, 0, 0, 0, 1415, 1146, 1679,
+  1416, 1182, 1188, 193, 0, 556, 557, 558, 796, 795,
+  398, 397, 0, 0, 945, 978, 535, 1072, 1071, 0,
+  0, 1051, 929, 930, 932, 931, 928, 953, 0, 666,
+  332, 346, 720, 1561, 716, 342, 707, 0, 0, 353,
+  0, 339, 737, 738, 379, 377, 381, 365, 366, 652,
+  318, 0, 383, 375, 354, 371, 369, 0, 0, 0,
+  0, 0, 0, 1639, 0, 666, 666, 616, 0, 619,
+  0, 654, 999, 853, 833, 852, 837, 851, 0, 0,
+  666, 725, 0, 0, 0, 0, 705, 706, 703, 744,
+  0, 1639, 0, 1679, 1679, 779, 0, 776, 748, 752,
+  754, 755, 756, 757, 758, 761, 759, 760, 762, 909,
+  643, 0, 1914, 0, 1642, 1137, 1139, 1287, 1311, 1162,
+  1168, 1308, 1330, 1077, 1679, 1056, 0, 1142, 1143, 1144,
+  1411, 1411, 0, 0, 1183, 1189, 0, 0, 0, 559,
+  0, 560, 985, 956, 277, 1043, 926, 1075, 0, 0,
+  333, 347, 1562, 712, 0, 714, 0, 718, 717, 0,
+  1893, 335, 0, 0, 372, 0, 0, 0, 316, 0,
+  211, 0, 1679, 730, 727, 657, 621, 653, 1639, 838,
+  839, 0, 0, 0, 0, 739, 726, 702, 0, 0,
+  676, 673, 745, 665, 781, 780, 891, 782, 0, 0,
+  0, 671, 0, 774, 0, 0, 749, 747, 753, 642,
+  648, 0, 1635, 1029, 1032, 1629, 1076, 1327, 1415, 1415,
+  1147, 1413, 0, 0, 999, 0, 1052, 921, 329, 1561,
+  711, 715, 0, 709, 0, 0, 336, 651, 0, 0,
+  1679, 0, 1900, 165, 1001, 731, 625, 122, 1639, 0,
+  1639, 0, 0, 679, 681, 0, 0, 1679, 777, 671,
+  765, 671, 775, 671, 0, 750, 909, 0, 0, 0,
+  119, 1569, 0, 0, 0, 1154, 0, 0, 1002, 276,
+  330, 713, 719, 1679, 0, 317, 0, 1888, 0, 627,
+  626, 128, 850, 133, 0, 0, 0, 682, 683, 680,
+  675, 891, 0, 766, 764, 763, 684, 647, 0, 646,
+  0, 1145, 1148, 1411, 0, 410, 1012, 1008, 0, 1005,
+  0, 1912, 0, 1639, 1679, 1890, 1889, 154, 0, 118,
+  628, 134, 1639, 678, 0, 0, 671, 0, 686, 645,
+  644, 0, 999, 0, 0, 0, 1014, 1003, 0, 1004,
+  0, 1679, 1639, 1895, 0, 909, 136, 684, 778, 767,
+  0, 0, 671, 687, 1414, 563, 411, 1690, 0, 999,
+  1018, 0, 1020, 1679, 1010, 1911, 1897, 1639, 1887, 137,
+  686, 685, 0, 0, 768, 0, 0, 561, 0, 412,
+  562, 1013, 1017, 1679, 1015, 1023, 0, 1007, 1011, 1679,
+  1896, 677, 695, 0, 697, 0, 0, 700, 0, 0,
+  0, 1679, 1689, 1018, 681, 1038, 1679, 1009, 696, 698,
+  699, 701, 688, 0, 690, 0, 0, 693, 0, 564,
+  1016, 1019, 0, 957, 1022, 689, 691, 692, 694, 0,
+  0, 0, 0, 1040, 1048, 1049, 1039, 1045, 1046, 0,
+  0, 1047, 1044
 };
 
 /* YYPDEFGOTO[NTERM-NUM].  */
 static const short int yydefgoto[] = {
-  -1, 2, 3, 4, 5, 8, 597, 41, 91, 1133,
-  531, 1979, 523, 1964, 538, 1726, 979, 1732, 1407, 1989,
-  1404, 42, 976, 2235, 977, 2669, 545, 1995, 546, 1746,
-  980, 1990, 981, 2237, 547, 2012, 548, 2013, 984, 1412,
-  549, 550, 443, 444, 1038, 445, 43, 528, 2453, 932,
-  1970, 933, 2452, 934, 2229, 935, 2230, 936, 1974, 937,
-  2231, 44, 236, 237, 2101, 238, 2566, 239, 2357, 240,
-  1144, 662, 3159, 663, 3207, 241, 242, 1115, 1116, 1117,
-  3156, 45, 86, 1816, 87, 88, 89, 1817, 1818, 2318,
-  993, 46, 959, 960, 90, 1132, 1396, 47, 48, 49,
-  520, 50, 1127, 1532, 2740, 2741, 51, 1430, 1757, 1729,
-  1984, 1152, 1980, 1077, 1487, 2272, 2481, 1488, 1788, 1078,
-  1079, 1798, 1799, 1490, 1491, 1373, 1080, 1423, 1081, 995,
-  961, 2973, 1768, 521, 555, 1698, 2090, 2073, 2507, 2508,
-  2341, 2091, 2342, 2316, 2308, 2497, 2531, 2293, 2701, 3108,
-  2702, 2978, 2509, 3064, 2510, 2869, 2294, 2703, 2979, 2323,
-  2502, 2333, 2309, 2310, 2525, 2337, 2547, 2884, 2732, 2992,
-  2326, 2540, 2881, 2299, 2526, 2521, 2324, 2325, 968, 53,
-  54, 446, 56, 609, 2028, 603, 447, 448, 58, 610,
-  2031, 3172, 618, 619, 620, 1054, 1049, 604, 1059, 1060,
-  1465, 1466, 59, 60, 588, 589, 590, 591, 592, 593,
-  594, 560, 1030, 1450, 1451, 1027, 561, 562, 595, 1036,
-  1015, 61, 596, 62, 557, 969, 626, 1572, 1853, 2383,
-  2681, 1777, 1778, 1779, 2039, 1172, 1173, 1174, 970, 285,
-  971, 530, 2833, 2834, 2835, 3215, 66, 67, 535, 1398,
-  68, 529, 1388, 69, 635, 629, 1084, 1802, 633, 1087,
-  1803, 630, 1083, 1801, 950, 951, 1104, 1517, 2067, 1830,
-  2102, 2564, 2104, 2355, 2755, 972, 2562, 2381, 2602, 2788,
-  2748, 3117, 3157, 1140, 664, 243, 1540, 925, 2120, 2938,
-  3040, 3037, 2506, 2313, 2749, 2750, 1552, 2925, 2371, 2590,
-  2781, 2782, 2591, 2592, 3080, 3081, 3127, 3166, 3190, 3191,
-  2593, 2783, 2498, 2499, 2862, 2982, 2983, 2985, 3061, 2494,
-  2495, 1841, 2369, 3014, 2743, 2744, 2893, 3073, 2372, 2373,
-  2511, 2770, 2771, 2375, 2376, 2377, 2786, 3035, 2926, 2927,
-  2928, 2929, 2930, 2931, 2932, 2378, 2777, 3091, 3032, 2933,
-  2934, 2935, 2936, 1416, 1417, 2001, 2246, 2002, 2006, 71,
-  1400, 233, 954, 973, 73, 74, 931, 1376, 1969, 1543,
-  1099, 1831, 1100, 2760, 2108, 3009, 2573, 2574, 2762, 2902,
-  974, 1368, 1101, 1383, 1735, 1991, 1118, 1119, 1120, 1121,
-  1122, 1123, 778, 805, 779, 2768, 2578, 2112, 2113, 2114,
-  2365, 75, 76, 827, 637, 1500, 2061, 621, 622, 1471,
-  2037, 1092, 1502, 1809, 2284, 2856, 1062, 1472, 2038, 2687,
-  2699, 1503, 1063, 1504, 1808, 2063, 2064, 1505, 1470, 2678,
-  1093, 1499, 1804, 1805, 2488, 2842, 3052, 2468, 611, 612,
-  2036, 2256, 2257, 2258, 2469, 2470, 1134, 829, 2675, 2676,
-  1070, 449, 1043, 450, 2891, 2892, 3144, 3145, 3146, 3147,
-  3148, 3227, 3174, 3200, 3219, 3220, 3221, 3223, 3224, 1855,
-  2387, 2790, 2388, 2389, 3261, 2476, 3274, 3275, 3271, 3272,
-  2480, 2975, 1660, 2435, 2818, 1927, 2393, 2394, 2395, 2260,
-  2474, 2129, 2953, 2649, 2650, 2642, 1178, 452, 453, 454,
-  455, 456, 457, 458, 459, 460, 746, 713, 461, 462,
-  831, 1294, 832, 463, 464, 813, 2815, 732, 2150, 755,
-  2947, 756, 2628, 757, 2948, 758, 2630, 721, 2142, 761,
-  2168, 806, 2638, 874, 2962, 820, 2648, 875, 2963, 764,
-  2170, 765, 2632, 775, 2179, 741, 2155, 726, 2144, 730,
-  2148, 739, 2153, 751, 2162, 719, 1866, 750, 1888, 769,
-  2810, 770, 2635, 771, 2636, 772, 2176, 808, 2422, 809,
-  2423, 705, 2617, 866, 1929, 1206, 2145, 699, 2615, 744,
-  2157, 700, 2131, 738, 2152, 817, 2195, 774, 2178, 821,
-  2199, 759, 2631, 731, 2945, 814, 2644, 816, 2194, 733,
-  2622, 749, 2626, 740, 2623, 773, 2637, 768, 2949, 747,
-  2946, 748, 2625, 818, 2646, 819, 2647, 807, 2181, 810,
-  2187, 815, 2950, 465, 466, 715, 467, 717, 468, 727,
-  469, 753, 470, 718, 737, 736, 471, 716, 472, 473,
-  474, 475, 476, 477, 478, 479, 1194, 2190, 1915, 2441,
-  1936, 2213, 3103, 2448, 1634, 480, 1184, 1181, 1182, 703,
-  704, 481, 482, 483, 1227, 1825, 484, 485, 1136, 486,
-  833, 834, 835, 1298, 836, 837, 838, 487, 876, 488,
-  489, 848, 900, 1335, 901, 902, 903, 904, 905, 906,
-  1357, 1686, 1687, 907, 490, 491, 492, 493, 910, 494,
-  1781, 2984, 2136, 2137, 2598, 279, 1166, 280, 670, 281,
-  669, 690, 676, 678, 682, 685, 863, 864, 1820, 1821,
-  1535, 1514, 1812, 686, 687, 1911, 282, 696, 1706, 1707,
-  495, 496, 497, 498, 499, 1369, 2060, 3196, 500, 1957,
-  1958, 501, 502, 503, 504, 505, 1520, 506, 507, 780,
-  508, 3158, 2095, 2339, 2710, 2711, 2096, 1195, 1709, 3150,
-  849, 2606, 77
+  -1, 2, 3, 4, 5, 8, 598, 41, 91, 1135,
+  531, 1981, 523, 1966, 538, 1728, 980, 1734, 1409, 1991,
+  1406, 42, 977, 2237, 978, 2671, 545, 1997, 546, 1748,
+  981, 1992, 982, 2239, 547, 2014, 548, 2015, 985, 1414,
+  549, 550, 443, 444, 1040, 445, 43, 528, 2455, 933,
+  1972, 934, 2454, 935, 2231, 936, 2232, 937, 1976, 938,
+  2233, 44, 236, 237, 2103, 238, 2568, 239, 2359, 240,
+  1146, 663, 3161, 664, 3209, 241, 242, 1117, 1118, 1119,
+  3158, 45, 86, 1818, 87, 88, 89, 1819, 1820, 2320,
+  994, 46, 960, 961, 90, 1134, 1398, 47, 48, 49,
+  520, 50, 1129, 1534, 2742, 2743, 51, 1432, 1759, 1731,
+  1986, 1154, 1982, 1079, 1489, 2274, 2483, 1490, 1790, 1080,
+  1081, 1800, 1801, 1492, 1493, 1375, 1082, 1425, 1083, 996,
+  962, 2975, 1770, 521, 555, 1700, 2092, 2075, 2509, 2510,
+  2343, 2093, 2344, 2318, 2310, 2499, 2533, 2295, 2703, 3110,
+  2704, 2980, 2511, 3066, 2512, 2871, 2296, 2705, 2981, 2325,
+  2504, 2335, 2311, 2312, 2527, 2339, 2549, 2886, 2734, 2994,
+  2328, 2542, 2883, 2301, 2528, 2523, 2326, 2327, 969, 53,
+  54, 446, 56, 610, 2030, 604, 447, 448, 58, 611,
+  2033, 3174, 619, 620, 621, 1056, 1051, 605, 1061, 1062,
+  1467, 1468, 59, 60, 589, 590, 591, 592, 593, 594,
+  595, 560, 1032, 1452, 1453, 1029, 561, 562, 596, 1038,
+  1017, 61, 597, 62, 557, 970, 627, 1574, 1855, 2385,
+  2683, 1779, 1780, 1781, 2041, 1174, 1175, 1176, 971, 285,
+  972, 530, 2835, 2836, 2837, 3217, 66, 67, 535, 1400,
+  68, 529, 1390, 69, 636, 630, 1086, 1804, 634, 1089,
+  1805, 631, 1085, 1803, 951, 952, 1106, 1519, 2069, 1832,
+  2104, 2566, 2106, 2357, 2757, 973, 2564, 2383, 2604, 2790,
+  2750, 3119, 3159, 1142, 665, 243, 1542, 926, 2122, 2940,
+  3042, 3039, 2508, 2315, 2751, 2752, 1554, 2927, 2373, 2592,
+  2783, 2784, 2593, 2594, 3082, 3083, 3129, 3168, 3192, 3193,
+  2595, 2785, 2500, 2501, 2864, 2984, 2985, 2987, 3063, 2496,
+  2497, 1843, 2371, 3016, 2745, 2746, 2895, 3075, 2374, 2375,
+  2513, 2772, 2773, 2377, 2378, 2379, 2788, 3037, 2928, 2929,
+  2930, 2931, 2932, 2933, 2934, 2380, 2779, 3093, 3034, 2935,
+  2936, 2937, 2938, 1418, 1419, 2003, 2248, 2004, 2008, 71,
+  1402, 233, 955, 974, 73, 74, 932, 1378, 1971, 1545,
+  1101, 1833, 1102, 2762, 2110, 3011, 2575, 2576, 2764, 2904,
+  975, 1370, 1103, 1385, 1737, 1993, 1120, 1121, 1122, 1123,
+  1124, 1125, 779, 806, 780, 2770, 2580, 2114, 2115, 2116,
+  2367, 75, 76, 828, 638, 1502, 2063, 622, 623, 1473,
+  2039, 1094, 1504, 1811, 2286, 2858, 1064, 1474, 2040, 2689,
+  2701, 1505, 1065, 1506, 1810, 2065, 2066, 1507, 1472, 2680,
+  1095, 1501, 1806, 1807, 2490, 2844, 3054, 2470, 612, 613,
+  2038, 2258, 2259, 2260, 2471, 2472, 1136, 830, 2677, 2678,
+  1072, 449, 1045, 450, 2893, 2894, 3146, 3147, 3148, 3149,
+  3150, 3229, 3176, 3202, 3221, 3222, 3223, 3225, 3226, 1857,
+  2389, 2792, 2390, 2391, 3263, 2478, 3276, 3277, 3273, 3274,
+  2482, 2977, 1662, 2437, 2820, 1929, 2395, 2396, 2397, 2262,
+  2476, 2131, 2955, 2651, 2652, 2644, 1180, 452, 453, 454,
+  455, 456, 457, 458, 459, 460, 747, 714, 461, 462,
+  832, 1296, 833, 463, 464, 814, 2817, 733, 2152, 756,
+  2949, 757, 2630, 758, 2950, 759, 2632, 722, 2144, 762,
+  2170, 807, 2640, 875, 2964, 821, 2650, 876, 2965, 765,
+  2172, 766, 2634, 776, 2181, 742, 2157, 727, 2146, 731,
+  2150, 740, 2155, 752, 2164, 720, 1868, 751, 1890, 770,
+  2812, 771, 2637, 772, 2638, 773, 2178, 809, 2424, 810,
+  2425, 706, 2619, 867, 1931, 1208, 2147, 700, 2617, 745,
+  2159, 701, 2133, 739, 2154, 818, 2197, 775, 2180, 822,
+  2201, 760, 2633, 732, 2947, 815, 2646, 817, 2196, 734,
+  2624, 750, 2628, 741, 2625, 774, 2639, 769, 2951, 748,
+  2948, 749, 2627, 819, 2648, 820, 2649, 808, 2183, 811,
+  2189, 816, 2952, 465, 466, 716, 467, 718, 468, 728,
+  469, 754, 470, 719, 738, 737, 471, 717, 472, 473,
+  474, 475, 476, 477, 478, 479, 1196, 2192, 1917, 2443,
+  1938, 2215, 3105, 2450, 1636, 480, 1186, 1183, 1184, 704,
+  705, 481, 482, 483, 1229, 1827, 484, 485, 1138, 486,
+  834, 835, 836, 1300, 837, 838, 839, 487, 877, 488,
+  489, 849, 901, 1337, 902, 903, 904, 905, 906, 907,
+  1359, 1688, 1689, 908, 490, 491, 492, 493, 911, 494,
+  1783, 2986, 2138, 2139, 2600, 279, 1168, 280, 671, 281,
+  670, 691, 677, 679, 683, 686, 864, 865, 1822, 1823,
+  1537, 1516, 1814, 687, 688, 1913, 282, 697, 1708, 1709,
+  495, 496, 497, 498, 499, 1371, 2062, 3198, 500, 1959,
+  1960, 501, 502, 503, 504, 505, 1522, 506, 507, 781,
+  508, 3160, 2097, 2341, 2712, 2713, 2098, 1197, 1711, 3152,
+  850, 2608, 77
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -2655
+#define YYPACT_NINF -2662
 static const short int yypact[] = {
-  106, -2655, 293, 107, -2655, -2655, -2655, -2655, 4046, 23745,
-  -2655, 26970, -47, 1256, 21054, -2655, -2655, -2655, -2655, 10521,
-  908, 10521, 26970, 468, -2655, -2655, -2655, 26970, 355, -2655,
-  -2655, -47, 10521, -2655, 452, 132, 258, -2655, -2655, 25703,
-  1745, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  421, -2655, -2655, 518, 459, 630, 630, 80, 80, -2655,
-  -2655, 26970, 185, -2655, -2655, -2655, -2655, 135, 40, 334,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, 26970,
-  -2655, 26970, 26970, -2655, -2655, 26970, 630, 630, 630, 26970,
-  26970, -193, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  459, 189, -2655, 262, 537, -2655, 630, 630, 464, 466,
-  358, 630, 630, 305, -2655, 603, 136, 603, 136, -2655,
-  516, -2655, -2655, 637, 477, 479, 482, -2655, -2655, -2655,
-  -2655, 981, 603, 494, -2655, -2655, -2655, -2655, -2655, -2655,
-  488, -2655, 708, -2655, -2655, -2655, -2655, 916, -2655, 17107,
-  528, -2655, 13307, 861, 706, 630, -2655, 561, -2655, 8868,
-  -2655, 24967, 566, -2655, -2655, -2655, 580, 583, 586, 594,
-  601, -2655, -2655, 638, -124, 641, 653, -2655, 654, 660,
-  674, -2655, -2655, -2655, 696, -2655, -2655, 704, -2655, 711,
-  714, -2655, 728, 749, -2655, -2655, -2655, 704, -2655, -2655,
-  766, -2655, 775, -2655, 779, -2655, -2655, -2655, -2655, 704,
-  784, 704, 787, 791, -2655, -2655, -2655, -2655, -2655, -2655,
-  662, 130, 679, 741, -2655, 794, -2655, -2655, -2655, -2655,
-  -2655, -2655, 438, 438, 438, 438, 438, 438, 438, 438,
-  438, 438, 438, 438, 438, 438, 438, 438, 438, 438,
-  438, 438, 438, 438, 438, 438, 813, 802, 808, 816,
-  820, 822, 823, 824, 828, 830, 831, 833, 834, 836,
-  837, 841, 842, 843, 844, 848, 850, 852, 853, 855,
-  856, 858, 859, 863, 865, 866, 867, 871, 872, 873,
-  874, 875, 876, 879, 880, 881, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, 26970, 5008, 10521, 10521,
-  -2655, 26970, 13871, -2655, -2655, 1024, 630, -2655, 80, -2655,
-  -2655, -2655, 797, 985, 832, 877, 993, 532, 18, 882,
-  -2655, -2655, 1379, -2655, -2655, 885, -2655, -2655, -2655, -2655,
-  -2655, -2655, 887, 889, 890, 891, 893, 894, 895, 896,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, 1424,
-  -2655, -2655, 715, 771, -2655, -2655, -2655, -2655, 886, -2655,
-  303, 897, -2655, 915, -2655, -2655, -2655, -2655, -2655, -2655,
-  1132, 26970, 26970, -2655, 26970, 26970, 26970, -2655, -2655, 1317,
-  630, 1317, 459, 1374, 1122, 1049, 1007, 944, 1172, 1084,
-  630, 1147, 1342, 26970, 25474, 1084, 1156, -2655, 266, 1457,
-  1065, 1118, -2655, 960, 814, 967, 1162, 1287, 1288, 936,
-  -2655, -2655, -100, -2655, -2655, 16070, 1276, 630, -2655, -2655,
-  26515, 939, -2655, -2655, 897, -2655, 255, 540, 1199, 963,
-  -139, 982, 988, 1042, 43, 1003, 1381, -104, -2655, -2655,
-  1015, 1069, 1029, 1153, -2655, 991, 1073, 102, -2655, 1338,
-  1158, 1301, 1302, 19, 1303, -172, 652, -2655, 26970, 961,
-  25861, 1415, 25861, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, 1358, 742, -2655, -2655, 1174, -2655, -2655, 518, -2655,
-  28, -2655, -99, 459, 26671, 19498, 14962, -2655, -2655, 1393,
-  1309, -2655, 1206, 1309, 1395, -2655, -2655, 1177, 1314, 394,
-  1121, 1055, 465, 292, 292, 1040, 146, 1063, -2655, -2655,
-  5560, 1080, -2655, 144, 1040, 26970, 26970, -2655, 144, 144,
-  -2655, -2655, 1306, 1413, 26970, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, 207, -2655, 481, -193, -2655, -193, -2655, 603,
-  -2655, -193, -2655, -2655, -2655, 83, 1379, -2655, 460, -2655,
-  -2655, 16588, -2655, 13584, 488, -2655, -2655, 26970, 14643, 989,
-  990, 7214, 1192, 85, -2655, 995, 704, 704, 704, 704,
-  26970, -2655, 10521, 13871, 90, 996, 997, 1000, 1005, 1006,
-  -2655, 1008, 489, -2655, -2655, -2655, 1009, 1012, -2655, 1134,
-  1013, 1016, 1019, 1020, -2655, -2655, 1021, 1023, 1025, 1027,
-  1028, 1033, -2655, 10521, 1034, 10521, 13871, 1035, 1036, 1038,
-  1039, 1043, -2655, 1044, -2655, 1045, 1046, 1047, 1048, 1052,
-  -2655, 1053, 498, -2655, 1054, 1056, -2655, -2655, 1057, 1058,
-  1059, 1060, 1061, 1066, 1067, 1068, 702, -2655, -2655, 725,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, 1071, 1072, 1101, 1102,
-  1104, 5560, 1543, 1105, 1106, 1107, 1108, 1110, 1111, 1113,
-  1117, 1119, -2655, 10521, 9419, 9419, 80, 1014, 1041, 1076,
-  415, 1064, -2655, 1400, 1251, 1458, 1618, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, 10521, 1358, -2655, 1116, -2655, -2655,
-  10521, 10521, 10521, 10521, 10521, 10521, 10521, 10521, 10521, 10521,
-  10521, 10521, 166, -2655, -2655, 10521, 1124, 190, 190, 10521,
-  10521, 10521, 10521, 1120, 1125, 1127, 1128, -2655, 174, -2655,
-  1002, -2655, 449, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, 174, 174, 174, 1129, -2655, 100, 1133, 174, 174,
-  10521, 10521, 10521, 1664, -2655, 10521, 10521, 10521, -2655, -2655,
-  25331, 1130, 71, 4457, 26970, -2655, -2655, 17715, 1136, -2655,
-  1136, 1136, -2655, 1136, 1575, 26970, 1040, 16070, -2655, 1365,
-  -2655, -2655, 1520, 1278, 1536, 1241, 1178, 1243, 481, -2655,
-  1472, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, 1151,
-  1155, -2655, 1549, -2655, 1665, 481, 1701, 26970, 154, 1160,
-  -2655, -2655, 1155, 1452, -2655, 1392, 481, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, 1589, -2655, 1545, 1305, -2655, 481,
-  1203, 1243, -2655, -2655, 1499, 1501, 6, 481, 1195, 961,
-  10521, 26970, 17426, 1504, -2655, -2655, 17269, -2655, 939, 26515,
-  501, 502, 26970, 26970, 1728, 195, -2655, -2655, 1380, 219,
-  1297, 10521, 7214, -2655, 15915, -2655, -2655, -2655, -2655, -2655,
-  221, 1382, -2655, 10521, 7214, 26515, 26515, -2655, -2655, -2655,
-  26970, 26970, 652, 448, -2655, -2655, 26970, -2655, 1185, -2655,
-  813, -2655, -2655, -2655, -2655, -2655, 1578, -2655, -2655, 25474,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, 1394, 8317, 1190,
-  -2655, -2655, 735, -2655, -2655, -2655, -2655, -2655, 897, 26970,
-  1469, -2655, -2655, -2655, 25474, 1194, 15197, 51, -2655, -2655,
-  3287, 3849, 12732, 26970, 16070, -2655, -2655, 26970, -2655, -2655,
-  1531, 1514, -2655, -74, 26970, 1434, 1216, -140, 26970, -2655,
-  -2655, 1347, 481, -2655, 1347, -2655, 1222, 1731, 695, 695,
-  -2655, -2655, -2655, -2655, 1407, 1347, 465, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, 25474, 25474, -2655, 1432, -2655, 1211,
-  -2655, 1445, 1347, -2655, -2655, -2655, 1210, -2655, -2655, -2655,
-  1625, 1432, 1055, 1259, 26970, 1625, 1625, 26970, 26970, 143,
-  1456, 1410, 425, 897, 1217, 1218, -2655, 455, -2655, -2655,
-  897, -2655, 1462, 1414, -2655, -2655, 456, 1379, -2655, 15516,
-  15751, -2655, -2655, -5, 1427, -3, 10521, 10521, -2655, 56,
-  10521, 86, -2655, 10521, 1672, -2655, 10521, 1225, 1226, -2655,
-  -2655, -2655, -2655, 1228, 10521, 10521, 1229, 1231, 1232, 1233,
-  1235, 10521, 1479, 1431, 10521, 1239, 26970, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, 1670, 10521, 7214,
-  10521, 10521, 1242, 1252, 10521, 10521, 10521, 10521, 1245, 10521,
-  1662, -2655, 10521, 10521, 10521, 1253, 10521, 1254, 10521, 10521,
-  10521, 10521, 10521, 10521, 1498, 1451, 10521, 10521, 10521, 137,
-  137, 10521, 10521, 10521, 10521, 10521, -2655, -2655, -2655, -2655,
-  10521, 10521, 10521, 10521, 10521, 1261, 6111, 95, 10521, 10521,
-  10521, 10521, 10521, 10521, 10521, 10521, -2655, -2655, -2655, -15,
-  -2655, -2655, 10521, -2655, 1600, 7214, 7214, 1614, 58, 7214,
-  -2655, 25474, 1268, 832, 877, 993, 532, 532, 18, 18,
-  882, 882, 882, 882, -2655, -2655, -2655, 897, 1269, 1270,
-  10521, 10521, 10521, 10521, 1274, 1281, 487, 1279, 1612, 10521,
-  10521, -2655, -2655, -2655, -2655, -2655, 1634, -2655, -2655, -2655,
-  -2655, 1820, -2655, -2655, -2655, 11072, 174, -2655, 174, -2655,
-  -2655, -2655, 1734, -2655, -2655, 1837, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, 1273, 1282, 1324, -2655, 1136,
-  -2655, -2655, 1432, 64, -2655, 17715, 18514, 459, 861, 1678,
-  1330, 459, -2655, 1764, -64, -2655, 26970, 1084, -2655, 15516,
-  -193, -2655, 26970, -2655, -2655, -2655, 25474, 25474, -2655, -2655,
-  10521, -2655, 897, 1646, -2655, -112, 861, 481, 897, 36,
-  1772, -170, -2655, 481, 1691, 1346, 1315, -2655, 66, 1379,
-  -2655, -2655, 1316, 490, -2655, 1318, -2655, 1828, 1829, -2655,
-  235, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, 1400, 1319, -2655, -2655, -2655, -2655, 1400, -2655, -2655,
-  1869, -2655, 1323, 1490, 26970, 10521, 7214, -2655, 961, -2655,
-  1546, 531, -2655, 660, -2655, 492, -2655, -2655, -2655, 28,
-  630, 1600, 1600, -2655, 18922, -2655, 10521, 77, 1322, 495,
-  1718, 1663, 1663, 110, 1663, 18922, 15516, -2655, 1720, -2655,
-  260, 26970, -2655, -2655, 1136, 1332, 1136, -2655, -2655, 26970,
-  1600, -2655, 868, -2655, -2655, -2655, -2655, 1473, 26970, -2655,
-  -2655, -2655, -2655, 481, -2655, -2655, 897, 481, -2655, -2655,
-  -2655, 695, 1348, -2655, 1352, -2655, 695, -2655, -2655, -2655,
-  -2655, -2655, 1746, 1481, -2655, 481, 26970, -2655, 1681, 1690,
-  26970, 1751, 1468, 1416, -2655, 465, 26970, 26970, 1344, 1350,
-  1605, 25474, 1863, 1544, -2655, 481, 488, -2655, -2655, -193,
-  -2655, 1547, -2655, 21054, -2655, -2655, -2655, -143, 1322, 14962,
-  26970, 1846, 1568, 26028, 1360, 1354, 10521, 1601, 1809, -2655,
-  -2655, -2655, 1906, -2655, -2655, 1694, 1362, 1363, -2655, -2655,
-  -2655, -2655, -2655, 1364, 1559, 1383, 1366, -2655, 1368, 1539,
-  10521, 1371, -55, 1372, 1377, -2655, -2655, 1375, 1376, 1378,
-  1384, 10521, 1391, 10521, 1385, 1387, 1396, -2655, 1397, -2655,
-  1807, 1808, 1398, 1399, 1402, 1403, 1573, 1409, 1404, 1411,
-  1412, -2655, -2655, -2655, 10521, 1810, 1830, 1405, 1417, 1418,
-  1420, 1426, 1423, 1626, 1626, 1425, -2655, 1747, 10521, 1428,
-  1430, 1429, 1433, 1435, 1436, 1438, 1439, 1440, -2655, 1685,
-  -2655, 1251, 1458, -2655, -2655, -2655, 1504, -2655, 1437, -2655,
-  1441, 1443, 1446, 1448, 13, 10521, 10521, 1750, 1453, 1450,
-  1442, 1449, -2655, -2655, 277, 737, -81, -2655, -2655, -2655,
-  212, 10521, -2655, -2655, -2655, 1840, 1956, 16070, -2655, -2655,
-  638, 662, -96, 1267, -2655, -2655, -2655, -2655, -2655, 1459,
-  -2655, 481, 459, 459, -2655, 459, 26970, 510, -2655, 1673,
-  -2655, -2655, -2655, -2655, -2655, 15516, -2655, -2655, -2655, 54,
-  481, 897, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -159,
-  -2655, -2655, 1460, 7766, 279, 6, -2655, -2655, -2655, 1907,
-  17426, -2655, 26970, 1661, 1667, 1595, 25474, -2655, 1464, 26970,
-  26515, 26970, 473, -2655, 1400, -2655, 18922, 26970, 1471, 9970,
-  -2655, -2655, 199, -2655, -2655, 25331, 19331, 1475, -2655, 1470,
-  1476, 1477, 282, 1478, 1480, -2655, 15516, -2655, -2655, -2655,
-  1862, -2655, -82, -2655, 15516, 525, 525, 525, -2655, 1483,
-  1482, -2655, -2655, -2655, 1486, -2655, 1484, -2655, 1489, 1600,
-  481, -2655, -2655, 897, -2655, -2655, 622, 1493, 1180, 26970,
-  -2655, -2655, 897, -2655, 13871, -2655, 1914, 150, -2655, -2655,
-  1571, 275, -2655, 1347, 1875, 1494, 26970, 26970, 1841, 1502,
-  2036, 1503, -2655, 897, 1379, 1500, -2655, -2655, 14962, 55,
-  -2655, 1675, 1848, 7214, 1911, 1887, -2655, 10521, -2655, -2655,
-  10521, -2655, 21572, 1508, 1842, 1843, -2655, -2655, 1526, -2655,
-  -2655, -2655, 26970, 1512, -2655, 10521, -2655, 10521, -2655, -2655,
-  10521, -2655, 1513, -2655, 1515, 10521, 10521, 10521, -2655, -2655,
-  10521, 10521, 10521, 10521, 481, -2655, 1532, -2655, -2655, 10521,
-  10521, 1947, 10521, 10521, -2655, 10521, -2655, -2655, 10521, -2655,
-  198, 1519, 1521, -2655, 2046, 1581, 1747, 10521, 10521, -2655,
-  -2655, 557, 1872, 10521, -2655, -2655, -2655, 2052, 1948, -2655,
-  -2655, -2655, 1865, 1866, 1617, 1619, 1868, 1528, 517, 1537,
-  1958, 1870, 1937, 1939, 10521, 10521, 1915, 10521, 10521, 1916,
-  10521, 10521, -2655, 11072, -2655, -2655, -2655, -2655, -2655, 897,
-  -2655, 26970, -2655, -2655, -2655, -2655, -2655, -2655, 18514, -2655,
-  -2655, -18, -2655, -2655, -2655, -2655, 459, -2655, 15516, -2655,
-  1548, -2655, -2655, -2655, -2655, -2655, -2655, -2655, 38, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, 1570, 1602, 1693, -2655,
-  1873, 1555, 89, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, 16070, -2655, 1557, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, 10521, 7214, 1475, 1562, 1563,
-  26191, -2655, -2655, -2655, -2655, -2655, 1558, 1944, 1944, 523,
-  -2655, 18922, 13871, 10521, 2034, 12999, -2655, -2655, 15516, 1568,
-  1908, -2655, -2655, 1564, 1567, 1569, 260, 26970, 26970, 26970,
-  2114, 1944, -2655, 1574, -2655, -2655, -2655, -2655, 663, 145,
-  819, 2085, 826, -2655, 1579, -2655, 623, 840, 840, 1901,
-  138, 925, 2100, 1909, 18513, 1910, 1580, 1812, 1657, 1912,
-  -2655, -2655, -2655, -2655, 1379, -2655, -2655, 1927, -2655, -2655,
-  1863, 26970, 26970, -2655, 1347, -2655, -2655, -2655, -2655, -2655,
-  26970, 1969, 1586, 1592, -2655, 161, 1590, 25474, -2655, 24608,
-  1960, -2655, -2655, 55, 1591, 26970, 1400, 17569, 226, -2655,
-  1593, -2655, -2655, -98, 2109, -10, 1596, 1594, -2655, 1870,
-  1597, 1598, -2655, -2655, -2655, -2655, -2655, -2655, -2655, 1604,
-  -2655, 1603, -2655, -2655, 1606, -2655, -2655, -2655, -2655, 1609,
-  1607, 1608, -2655, 2032, 1610, 1613, 1615, 387, -2655, -2655,
-  -2655, 1616, 1622, 10521, 1620, 1621, -2655, 1623, -2655, -2655,
-  1624, -2655, -2655, -2655, 897, -2655, -2655, -2655, 10521, 758,
-  1627, 1581, 1628, 1635, -2655, -2655, 1630, 1632, 1636, -2655,
-  -2655, 1639, 1640, 1642, -2655, -2655, 1643, 2042, 10521, 1936,
-  1870, 1644, 2139, 1952, 10521, 10521, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, 1962, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, 1965, 15516, -2655, 24363, -2655, -2655, -2655,
-  -2655, -2655, 7766, -2655, -2655, 1648, 1649, 536, -2655, -2655,
-  1400, 26970, 11623, -2655, 567, 1650, 485, -2655, 10521, 226,
-  2083, 2083, 19331, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  1988, -2655, -2655, 26970, 26970, 26970, -2655, 570, -2655, 584,
-  -74, 2083, 1651, 1489, 1944, -2655, 2193, -2655, 481, 2085,
-  -179, -2655, 25474, 2061, 2061, 23102, 481, 2085, -193, -2655,
-  -2655, -2655, 26970, 481, -2655, 26970, -193, 25474, 2085, 2061,
-  2061, -2655, 26970, -2655, 481, 26970, 2061, 2085, 1180, 2195,
-  -2655, 1656, 2198, 26970, -2655, 1938, -2655, -2655, 24437, 2051,
-  2053, 1432, 2085, -2655, -2655, 2202, -2655, -2655, -2655, 94,
-  26970, -2655, 2061, 2085, 25474, 17872, 1684, 26970, -2655, 26970,
-  -2655, 25474, 1668, 2011, 1136, 26970, -2655, 79, -2655, 26970,
-  213, 26970, 2006, -2655, -2655, 20018, -2655, 1978, 1502, 1674,
-  26970, 134, 591, -2655, -2655, -2655, -2655, -2655, 26970, 22090,
-  2085, 2111, -2655, -2655, 2118, -2655, 1677, 1682, -2655, 2069,
-  1850, 226, -2655, 733, 417, -2655, -2655, -2655, 11, 1680,
-  -2655, 1952, 1870, 1870, 10521, -2655, -2655, 10521, -2655, -2655,
-  10521, -2655, 10521, -2655, -2655, -2655, 10521, 1683, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, 117, -2655, 915, -2655, 1686,
-  -2655, 10521, -2655, -2655, -2655, 10521, 2022, 1870, 1870, 1870,
-  716, 13, 1687, 1689, 1952, 2023, 10521, 2215, 1692, 1134,
-  1134, 25474, -2655, -2655, 7214, -2655, -2655, -2655, -57, -57,
-  -2655, 1696, 1697, -2655, -2655, -2655, 25861, 25861, -2655, 1699,
-  -2655, 14408, 18025, 261, -2655, 1933, -2655, -2655, -2655, 2216,
-  1887, 7214, 596, 627, 639, -2655, -2655, -2655, 469, -2655,
-  -2655, -2655, 2083, 23320, 1711, -2655, 897, 26970, 1, -2655,
-  24437, 2043, -2655, 1481, 1502, -2655, 1721, -2655, -2655, 1715,
-  24608, 1723, 1725, 21054, 2263, 1729, 1481, -2655, -2655, 1711,
-  1730, 1732, -2655, 1502, 26970, 1733, 1735, -2655, -2655, 2072,
-  2271, 2077, -2655, -2655, -2655, -2655, 1737, 26970, -2655, 2206,
-  26970, -2655, 26970, -2655, 525, -2655, -2655, 26970, 1738, 1739,
-  1740, 1748, -2655, 26970, -2655, 1749, -2655, -2655, -2655, -29,
-  1742, 23897, 72, 25474, -2655, 1136, -2655, -2655, -2655, -2655,
-  -2655, -2655, 87, 2156, 2090, 1752, -2655, -2655, 2140, -2655,
-  -2655, 1347, 1347, 20536, 24608, -2655, 1754, 2141, 2143, 608,
-  602, -2655, -2655, -2655, 24608, -2655, 1742, 481, -2655, -2655,
-  1729, 481, 2061, 26970, 736, -2655, -2655, 26970, 226, 26827,
-  571, 226, 226, 226, 226, -2655, -193, -2655, 1755, 1952,
-  1952, 1756, -2655, -2655, 1757, -2655, -2655, 1758, -2655, 1759,
-  -2655, -2655, -2655, 1760, -2655, -2655, -2655, -2655, -2655, 1838,
-  1838, 731, -2655, -2655, -2655, 1761, -2655, -2655, -2655, 1766,
-  -2655, 2289, 1952, 1952, 1952, -2655, -2655, 2098, 2099, 1870,
-  1767, 2292, 1773, 10521, -2655, 1770, 1771, 1775, 12, -2655,
-  1873, 142, 1889, 12174, -2655, 1780, -2655, 1785, 2212, 10521,
-  26970, -2655, -2655, -2655, 226, 226, 2129, 469, 10521, -2655,
-  1400, -2655, -2655, -2655, 199, 199, 199, 199, 199, -74,
-  -2655, 1786, 24608, 24608, 481, 1787, 481, 2085, -2655, 26970,
-  640, -2655, -2655, 24608, -2655, 24608, 24608, 481, -2655, 1481,
-  -193, -2655, 2085, 2085, 26970, 481, 2085, -2655, 10521, -2655,
-  -2655, 26970, 26970, -2655, 10521, 10521, 10521, 154, 1789, 10521,
-  1993, -2655, -2655, 647, -2655, -2655, 1794, -2655, 1960, 61,
-  -2655, -2655, -2655, -2655, 1742, -2655, -2655, -2655, -2655, 6662,
-  2235, 26970, -2655, -2655, 1900, -2655, -2655, -2655, 213, -2655,
-  648, -2655, 7214, 26970, 26970, -2655, -2655, 26970, -2655, 689,
-  2266, 1347, 1800, -2655, -2655, 1993, 1062, 1711, 2344, 1579,
-  1803, -2655, 1801, -2655, 397, -2655, -2655, 417, 417, -2655,
-  -2655, 1813, -2655, 1814, 1815, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, 10521, 2234, 10521,
-  1817, 1818, 1819, 1804, 1821, 1952, -2655, 10521, 1773, -2655,
-  -2655, -2655, 747, -2655, 2014, 2017, -2655, -2655, 1822, -2655,
-  25861, 14962, -2655, -2655, -2655, 733, 733, 26970, -99, 1773,
-  -2655, -2655, -2655, -2655, -2655, -2655, 469, 24608, -2655, 1723,
-  -2655, -27, 22608, 1711, -2655, 2035, 2043, -2655, 649, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, 2371, -2655, 26970,
-  -2655, -2655, -2655, -2655, -2655, 1826, 1827, 1832, 26970, 2043,
-  664, 1347, 2031, 24608, 23897, -2655, 1847, 2111, 72, -2655,
-  1993, -2655, -2655, 1400, 288, 1831, 1925, 2249, 24608, -2655,
-  -49, 1860, 1861, 1742, -2655, -2655, -2655, -2655, 602, 1347,
-  26970, 10521, 10521, 1864, 481, 512, 285, 1062, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, 2063, 26970,
-  -2655, 226, 488, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, 7214, -2655, 669, -2655, -2655, -2655, 1870, 1870,
-  1867, 1871, -2655, -2655, 2108, 2239, 2217, -2655, 2242, -2655,
-  -2655, 75, -2655, 1874, -2655, 2306, -74, 670, -2655, -2655,
-  -2655, -2655, 675, -2655, 21054, 2301, -2655, 141, -2655, -2655,
-  26970, 2421, -2655, 1876, 1954, 1878, -2655, 680, -2655, 2196,
-  7214, -2655, -2655, -2655, 2061, -2655, 1347, -2655, -2655, 266,
-  26970, 481, 1986, -2655, -2655, -2655, 26970, 26970, -2655, -2655,
-  -2655, -2655, -2655, -2655, 695, -2655, 1882, 2275, 2233, 636,
-  2277, 2278, 2201, 26970, -2655, -2655, -2655, 1891, -2655, 313,
-  1481, -2655, 733, 1379, 1400, -2655, 1952, 1952, -2655, 2222,
-  2112, 2134, 1993, 26970, -2655, -2655, -2655, 644, -2655, -2655,
-  26970, -2655, 1893, 1931, -2655, -2655, 26970, 2043, 24437, 2043,
-  -2655, -2655, 1400, -2655, 2226, -2655, 1347, 1897, -169, 1990,
-  682, -2655, 244, 693, 1905, 7214, -2655, 681, -2655, 707,
-  -2655, 730, 26970, -2655, -2655, 2419, 2243, 2422, -2655, -2655,
-  1904, 1913, 1917, -2655, 2185, 2310, 69, -2655, -2655, -2655,
-  -2655, 14409, -167, -2655, 694, -2655, 700, 167, -2655, -2655,
-  -2655, -2655, 481, 26970, 2223, -2655, -2655, -2655, -2655, 695,
-  -46, -2655, -2655, -2655, 1918, -2655, 2250, -2655, 2251, -2655,
-  -2655, 1870, 18922, 1919, 2330, -2655, 1961, 1963, 2423, -2655,
-  709, 1347, 14409, -2655, -2655, -2655, 2466, -2655, -2655, -2655,
-  -169, -2655, 26970, 1920, 761, 26970, 2264, -2655, -2655, 1922,
-  -37, 26353, 80, 2449, 2125, -2655, 2127, -2655, 2453, 14409,
-  1347, -2655, 1929, -2655, -2655, 1932, -2655, -2655, 723, 99,
-  777, 2273, -2655, 2397, -2655, -2655, 726, 1993, -2655, 2232,
-  2353, 7214, 2025, -2655, -2655, 1347, -2655, -2655, 2264, -2655,
-  162, 576, -2655, 129, 2138, -2655, 26970, -2655, -2655, 1940,
-  -2655, 10521, -2655, 1568, 2357, 1400, -2655, 7214, -2655, -2655,
-  -2655, 2496, -2655, 2290, 2499, -2655, 2293, 203, 691, 7214,
-  -2655, -2655, 651, 2145, 7214, 1400, -2655, -2655, -2655, -2655,
-  -2655, 2502, -2655, 2296, 2505, -2655, 2299, 1400, -2655, -2655,
-  -144, -2655, 1400, -2655, -2655, -2655, -2655, 2385, 2387, 19331,
-  19331, 1959, -2655, -2655, 1964, -2655, -2655, 19331, 19331, -2655,
-  -2655
+  102, -2662, 292, 103, -2662, -2662, -2662, -2662, 4058, 23757,
+  -2662, 26982, 26, 1061, 21066, -2662, -2662, -2662, -2662, 10533,
+  893, 10533, 26982, 664, -2662, -2662, -2662, 26982, 280, -2662,
+  -2662, 26, 10533, -2662, -45, 125, 36, -2662, -2662, 25715,
+  186, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  390, -2662, -2662, 479, 46, 593, 593, 94, 94, -2662,
+  -2662, 26982, 188, -2662, -2662, -2662, -2662, 118, 327, 326,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, 26982,
+  -2662, 26982, 26982, -2662, -2662, 26982, 593, 593, 593, 26982,
+  26982, -112, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  46, 144, -2662, 208, 474, -2662, 593, 593, 384, 462,
+  306, 593, 593, 55, -2662, 490, 697, 490, 697, -2662,
+  525, -2662, -2662, 689, 401, 430, 448, -2662, -2662, -2662,
+  -2662, 868, 490, 463, -2662, -2662, -2662, -2662, -2662, -2662,
+  541, -2662, 584, -2662, -2662, -2662, -2662, 916, -2662, 17119,
+  530, -2662, 13319, 877, 717, 593, -2662, 536, -2662, 8880,
+  -2662, 24979, 573, -2662, -2662, -2662, 589, 599, 605, 614,
+  638, -2662, -2662, 656, 223, 680, 682, -2662, 654, 675,
+  684, -2662, -2662, -2662, 706, -2662, -2662, 728, -2662, 733,
+  773, -2662, 779, 787, -2662, -2662, -2662, 728, -2662, -2662,
+  797, -2662, 811, -2662, 815, -2662, -2662, -2662, -2662, 728,
+  824, 728, 830, 838, -2662, -2662, -2662, -2662, -2662, -2662,
+  760, -164, 774, 804, -2662, 844, -2662, -2662, -2662, -2662,
+  -2662, -2662, 556, 556, 556, 556, 556, 556, 556, 556,
+  556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+  556, 556, 556, 556, 556, 556, 624, 846, 847, 850,
+  853, 854, 857, 861, 862, 864, 865, 869, 870, 873,
+  875, 881, 886, 887, 888, 890, 891, 894, 895, 896,
+  897, 898, 899, 900, 901, 902, 903, 904, 906, 907,
+  910, 911, 912, 913, 914, 915, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, 26982, 5020, 10533, 10533,
+  -2662, 26982, 13883, -2662, -2662, 931, 593, -2662, 94, -2662,
+  -2662, -2662, 2330, 848, 681, 641, 1096, 626, 29, 726,
+  -2662, -2662, 1316, -2662, -2662, 918, -2662, -2662, -2662, -2662,
+  -2662, -2662, 919, 920, 921, 923, 926, 927, 928, 929,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, 1124,
+  -2662, -2662, 934, 943, -2662, -2662, -2662, -2662, 837, -2662,
+  437, 889, -2662, 908, -2662, -2662, -2662, -2662, -2662, -2662,
+  1088, 26982, 26982, -2662, 26982, 26982, 26982, -2662, -2662, 1289,
+  593, 1289, 46, 1346, 1093, 1033, 1007, 967, 1195, 950,
+  593, 1170, 1365, 26982, 25486, 950, 1172, -2662, 106, 1472,
+  1081, 1134, -2662, 976, 1068, 983, 1178, 1304, 1305, 953,
+  -2662, -2662, -141, -2662, -2662, 16082, 1293, 593, -2662, -2662,
+  26527, 955, -2662, -2662, 889, -2662, 596, 586, 1214, 977,
+  -133, 993, 1002, 1003, 1055, 206, 1019, 1397, -131, -2662,
+  -2662, 1034, 1086, 1047, 1171, -2662, 1011, 1094, 443, -2662,
+  1356, 1177, 1320, 1323, 435, 1324, -106, 665, -2662, 26982,
+  982, 25873, 1437, 25873, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, 1380, 709, -2662, -2662, 1196, -2662, -2662, 479,
+  -2662, 19, -2662, -96, 46, 26683, 19510, 14974, -2662, -2662,
+  1416, 1330, -2662, 1224, 1330, 1411, -2662, -2662, 1191, 1334,
+  545, 1136, 1071, 351, 325, 325, 1057, 107, 1083, -2662,
+  -2662, 5572, 1106, -2662, 140, 1057, 26982, 26982, -2662, 140,
+  140, -2662, -2662, 1332, 1436, 26982, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, 512, -2662, 618, -112, -2662, -112, -2662,
+  490, -2662, -112, -2662, -2662, -2662, 123, 1316, -2662, 531,
+  -2662, -2662, 16600, -2662, 13596, 541, -2662, -2662, 26982, 14655,
+  1012, 1014, 7226, 1219, 95, -2662, 1016, 728, 728, 728,
+  728, 26982, -2662, 10533, 13883, 108, 1017, 1018, 1020, 1021,
+  1023, -2662, 1024, 537, -2662, -2662, -2662, 1025, 1026, -2662,
+  1629, 1027, 1028, 1030, 1032, -2662, -2662, 1036, 1037, 1038,
+  1039, 1041, 1042, -2662, 10533, 1043, 10533, 13883, 1044, 1045,
+  1048, 1049, 1054, -2662, 1058, -2662, 1059, 1060, 1062, 1063,
+  1064, -2662, 1065, 601, -2662, 1066, 1067, -2662, -2662, 1069,
+  1070, 1072, 1074, 1075, 1076, 1077, 1078, 794, -2662, -2662,
+  798, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, 1079, 1080, 1082,
+  1084, 1085, 5572, 1571, 1087, 1089, 1090, 1091, 1092, 1095,
+  1097, 1098, 1099, -2662, 10533, 9431, 9431, 94, 1046, 1056,
+  1103, 557, 1101, -2662, 1371, 1230, 1463, 1620, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, 10533, 1380, -2662, 1100, -2662,
+  -2662, 10533, 10533, 10533, 10533, 10533, 10533, 10533, 10533, 10533,
+  10533, 10533, 10533, 195, -2662, -2662, 10533, 1105, 174, 174,
+  10533, 10533, 10533, 10533, 1107, 1109, 1110, 1111, -2662, 169,
+  -2662, 1133, -2662, 613, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, 169, 169, 169, 1112, -2662, 97, 1108, 169,
+  169, 10533, 10533, 10533, 1615, -2662, 10533, 10533, 10533, -2662,
+  -2662, 25343, 1113, 61, 4469, 26982, -2662, -2662, 17727, 1116,
+  -2662, 1116, 1116, -2662, 1116, 1524, 26982, 1057, 16082, -2662,
+  1318, -2662, -2662, 1470, 1234, 1490, 1205, 1148, 1213, 618,
+  -2662, 1440, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  1119, 1123, -2662, 1517, -2662, 1632, 618, 1671, 26982, 129,
+  1129, -2662, -2662, 1123, 1421, -2662, 1362, 618, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, 1559, -2662, 1516, 1274, -2662,
+  618, 1168, 1213, -2662, -2662, 1469, 1471, 23, 618, 1160,
+  982, 10533, 26982, 17438, 1473, -2662, -2662, 17281, -2662, 955,
+  26527, -119, -107, 26982, 26982, 1693, 444, -2662, -2662, 1344,
+  1345, 456, 1265, 10533, 7226, -2662, 15927, -2662, -2662, -2662,
+  -2662, -2662, -183, 1350, -2662, 10533, 7226, 26527, 26527, -2662,
+  -2662, -2662, 26982, 26982, 665, 488, -2662, -2662, 26982, -2662,
+  1152, -2662, 624, -2662, -2662, -2662, -2662, -2662, 1547, -2662,
+  -2662, 25486, -2662, -2662, -2662, -2662, -2662, -2662, -2662, 1368,
+  8329, 1161, -2662, -2662, 805, -2662, -2662, -2662, -2662, -2662,
+  889, 26982, 1442, -2662, -2662, -2662, 25486, 1159, 15209, 87,
+  -2662, -2662, 3299, 3861, 12744, 26982, 16082, -2662, -2662, 26982,
+  -2662, -2662, 1501, 1481, -2662, 139, 26982, 1401, 1183, -145,
+  26982, -2662, -2662, 1311, 618, -2662, 1311, -2662, 1186, 1696,
+  782, 782, -2662, -2662, -2662, -2662, 1372, 1311, 351, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, 25486, 25486, -2662, 1398,
+  -2662, 1175, -2662, 1412, 1311, -2662, -2662, -2662, 1179, -2662,
+  -2662, -2662, 1589, 1398, 1071, 1228, 26982, 1589, 1589, 26982,
+  26982, 155, 1420, 1377, 620, 889, 1184, 1187, -2662, 622,
+  -2662, -2662, 889, -2662, 1431, 1387, -2662, -2662, 631, 1316,
+  -2662, 15528, 15763, -2662, -2662, -3, 1402, 8, 10533, 10533,
+  -2662, 41, 10533, 164, -2662, 10533, 1645, -2662, 10533, 1198,
+  1200, -2662, -2662, -2662, -2662, 1201, 10533, 10533, 1202, 1203,
+  1204, 1206, 1208, 10533, 1438, 1399, 10533, 1209, 26982, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, 1644,
+  10533, 7226, 10533, 10533, 1217, 1218, 10533, 10533, 10533, 10533,
+  1223, 10533, 1631, -2662, 10533, 10533, 10533, 1221, 10533, 1222,
+  10533, 10533, 10533, 10533, 10533, 10533, 1466, 1419, 10533, 10533,
+  10533, 143, 143, 10533, 10533, 10533, 10533, 10533, -2662, -2662,
+  -2662, -2662, 10533, 10533, 10533, 10533, 10533, 1226, 6123, 84,
+  10533, 10533, 10533, 10533, 10533, 10533, 10533, 10533, -2662, -2662,
+  -2662, 2, -2662, -2662, 10533, -2662, 1565, 7226, 7226, 1581,
+  115, 7226, -2662, 25486, 1231, 681, 641, 1096, 626, 626,
+  29, 29, 726, 726, 726, 726, -2662, -2662, -2662, 889,
+  1233, 1236, 10533, 10533, 10533, 10533, 1238, 1243, 642, 1240,
+  1568, 10533, 10533, -2662, -2662, -2662, -2662, -2662, 1591, -2662,
+  -2662, -2662, -2662, 1778, -2662, -2662, -2662, 11084, 169, -2662,
+  169, -2662, -2662, -2662, 1694, -2662, -2662, 1798, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, 1235, 1237, 1284,
+  -2662, 1116, -2662, -2662, 1398, 75, -2662, 17727, 18526, 46,
+  877, 1638, 1290, 46, -2662, 1724, -71, -2662, 26982, 950,
+  -2662, 15528, -112, -2662, 26982, -2662, -2662, -2662, 25486, 25486,
+  -2662, -2662, 10533, -2662, 889, 1600, -2662, -120, 877, 618,
+  889, 180, 1726, 261, -2662, 618, 1649, 1296, 1269, -2662,
+  58, 1316, -2662, -2662, 1270, 643, -2662, 1271, -2662, 1786,
+  1787, -2662, -173, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, 1371, 1275, -2662, -2662, -2662, -2662, 1371,
+  -2662, -2662, 1823, -2662, 1278, 1448, 26982, 10533, 7226, -2662,
+  982, -2662, 1503, 4, -2662, 675, -2662, 650, -2662, -2662,
+  -2662, 19, 593, 1565, 1565, -2662, 18934, -2662, 10533, 93,
+  1280, 652, 1678, 1621, 1621, 540, 1621, 18934, 15528, -2662,
+  1681, -2662, 152, 26982, -2662, -2662, 1116, 1294, 1116, -2662,
+  -2662, 26982, 1565, -2662, 858, -2662, -2662, -2662, -2662, 1433,
+  26982, -2662, -2662, -2662, -2662, 618, -2662, -2662, 889, 618,
+  -2662, -2662, -2662, 782, 1309, -2662, 1319, -2662, 782, -2662,
+  -2662, -2662, -2662, -2662, 1703, 1444, -2662, 618, 26982, -2662,
+  1641, 1657, 26982, 1717, 1434, 1381, -2662, 351, 26982, 26982,
+  1312, 1313, 1570, 25486, 1829, 1508, -2662, 618, 541, -2662,
+  -2662, -112, -2662, 1509, -2662, 21066, -2662, -2662, -2662, -150,
+  1280, 14974, 26982, 1811, 1533, 26040, 1322, 1321, 10533, 1563,
+  1776, -2662, -2662, -2662, 1873, -2662, -2662, 1662, 1329, 1331,
+  -2662, -2662, -2662, -2662, -2662, 1333, 1526, 1351, 1336, -2662,
+  1338, 1499, 10533, 1341, -49, 1342, 1347, -2662, -2662, 1349,
+  1353, 1348, 1354, 10533, 1355, 10533, 1360, 1361, 1363, -2662,
+  1364, -2662, 1764, 1775, 1366, 1369, 1370, 1367, 1540, 1376,
+  1373, 1379, 1382, -2662, -2662, -2662, 10533, 1777, 1780, 1383,
+  1384, 1385, 1386, 1388, 1390, 1567, 1567, 1393, -2662, 1699,
+  10533, 1391, 1403, 1394, 1395, 1405, 1407, 1408, 1406, 1410,
+  -2662, 1642, -2662, 1230, 1463, -2662, -2662, -2662, 1473, -2662,
+  1422, -2662, 1413, 1414, 1415, 1424, 20, 10533, 10533, 1706,
+  1430, 1378, 1426, 1429, -2662, -2662, -204, 692, -91, -2662,
+  -2662, -2662, 328, 10533, -2662, -2662, -2662, 1779, 1878, 16082,
+  -2662, -2662, 656, 760, 253, 1833, -2662, -2662, -2662, -2662,
+  -2662, 1435, -2662, 618, 46, 46, -2662, 46, 26982, 658,
+  -2662, 1597, -2662, -2662, -2662, -2662, -2662, 15528, -2662, -2662,
+  -2662, 211, 618, 889, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, 362, -2662, -2662, 1439, 7778, -94, 23, -2662, -2662,
+  -2662, 1828, 17438, -2662, 26982, 1608, 1613, 1548, 25486, -2662,
+  1432, 26982, 26527, 26982, 495, -2662, 1371, -2662, 18934, 26982,
+  1427, 9982, -2662, -2662, 222, -2662, -2662, 25343, 19343, 1441,
+  -2662, 1423, 1446, 1449, 373, 1445, 1447, -2662, 15528, -2662,
+  -2662, -2662, 1824, -2662, -167, -2662, 15528, 657, 657, 657,
+  -2662, 1443, 1451, -2662, -2662, -2662, 1452, -2662, 1457, -2662,
+  1458, 1565, 618, -2662, -2662, 889, -2662, -2662, 724, 1455,
+  860, 26982, -2662, -2662, 889, -2662, 13883, -2662, 1871, 165,
+  -2662, -2662, 1530, 981, -2662, 1311, 1825, 1459, 26982, 26982,
+  1804, 1465, 2003, 1467, -2662, 889, 1316, 1468, -2662, -2662,
+  14974, 60, -2662, 1634, 1812, 7226, 1879, 1853, -2662, 10533,
+  -2662, -2662, 10533, -2662, 21584, 1475, 1806, 1809, -2662, -2662,
+  1492, -2662, -2662, -2662, 26982, 1477, -2662, 10533, -2662, 10533,
+  -2662, -2662, 10533, -2662, 1479, -2662, 1480, 10533, 10533, 10533,
+  -2662, -2662, 10533, 10533, 10533, 10533, 618, -2662, 1497, -2662,
+  -2662, 10533, 10533, 1912, 10533, 10533, -2662, 10533, -2662, -2662,
+  10533, -2662, 234, 1483, 1484, -2662, 2011, 1542, 1699, 10533,
+  10533, -2662, -2662, 493, 1840, 10533, -2662, -2662, -2662, 2017,
+  1913, -2662, -2662, -2662, 1827, 1830, 1578, 1579, 1831, 1498,
+  659, 1500, 1922, 1832, 1901, 1902, 10533, 10533, 1881, 10533,
+  10533, 1882, 10533, 10533, -2662, 11084, -2662, -2662, -2662, -2662,
+  -2662, 889, -2662, 26982, -2662, -2662, -2662, -2662, -2662, -2662,
+  18526, -2662, -2662, -24, -2662, -2662, -2662, -2662, 46, -2662,
+  15528, -2662, 1510, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  54, -2662, -2662, -2662, -2662, -2662, -2662, -2662, 1534, 1561,
+  1655, -2662, 1835, 1518, 96, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, 16082, -2662, 1513, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, 10533, 7226, 1441,
+  1521, 1522, 26203, -2662, -2662, -2662, -2662, -2662, 1520, 1905,
+  1905, 660, -2662, 18934, 13883, 10533, 1990, 13011, -2662, -2662,
+  15528, 1533, 1866, -2662, -2662, 1528, 1529, 1531, 152, 26982,
+  26982, 26982, 2076, 1905, -2662, 1538, -2662, -2662, -2662, -2662,
+  880, 565, 876, 2051, 816, -2662, 1541, -2662, 685, 892,
+  892, 1868, 231, 909, 2062, 1869, 18525, 1872, 1544, 1781,
+  1622, 1876, -2662, -2662, -2662, -2662, 1316, -2662, -2662, 1891,
+  -2662, -2662, 1829, 26982, 26982, -2662, 1311, -2662, -2662, -2662,
+  -2662, -2662, 26982, 1934, 1551, 1556, -2662, 807, 1553, 25486,
+  -2662, 24620, 1925, -2662, -2662, 60, 1555, 26982, 1371, 17581,
+  304, -2662, 1560, -2662, -2662, 33, 2077, 38, 1564, 1562,
+  -2662, 1832, 1566, 1572, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, 1574, -2662, 1573, -2662, -2662, 1575, -2662, -2662, -2662,
+  -2662, 1576, 1577, 1580, -2662, 1998, 1582, 1583, 1584, 331,
+  -2662, -2662, -2662, 1586, 1585, 10533, 1587, 1588, -2662, 1590,
+  -2662, -2662, 1592, -2662, -2662, -2662, 889, -2662, -2662, -2662,
+  10533, 686, 1593, 1542, 1594, 1595, -2662, -2662, 1596, 1598,
+  1599, -2662, -2662, 1601, 1602, 1603, -2662, -2662, 1605, 1996,
+  10533, 1908, 1832, 1606, 2093, 1914, 10533, 10533, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, 1921, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, 1926, 15528, -2662, 24375, -2662,
+  -2662, -2662, -2662, -2662, 7778, -2662, -2662, 1610, 1611, 661,
+  -2662, -2662, 1371, 26982, 11635, -2662, 669, 1612, 67, -2662,
+  10533, 304, 2023, 2023, 19343, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, 1933, -2662, -2662, 26982, 26982, 26982, -2662, 694,
+  -2662, 695, 139, 2023, 1609, 1458, 1905, -2662, 2138, -2662,
+  618, 2051, -236, -2662, 25486, 2018, 2018, 23114, 618, 2051,
+  -112, -2662, -2662, -2662, 26982, 618, -2662, 26982, -112, 25486,
+  2051, 2018, 2018, -2662, 26982, -2662, 618, 26982, 2018, 2051,
+  860, 2152, -2662, 1614, 2153, 26982, -2662, 1893, -2662, -2662,
+  24449, 2009, 2010, 1398, 2051, -2662, -2662, 2159, -2662, -2662,
+  -2662, 14, 26982, -2662, 2018, 2051, 25486, 17884, 1637, 26982,
+  -2662, 26982, -2662, 25486, 1623, 1963, 1116, 26982, -2662, 68,
+  -2662, 26982, 397, 26982, 1958, -2662, -2662, 20030, -2662, 1930,
+  1465, 1625, 26982, 142, 696, -2662, -2662, -2662, -2662, -2662,
+  26982, 22102, 2051, 2063, -2662, -2662, 2071, -2662, 1628, 1633,
+  -2662, 2020, 1799, 304, -2662, 788, 532, -2662, -2662, -2662,
+  215, 1630, -2662, 1914, 1832, 1832, 10533, -2662, -2662, 10533,
+  -2662, -2662, 10533, -2662, 10533, -2662, -2662, -2662, 10533, 1639,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, 105, -2662, 908,
+  -2662, 1668, -2662, 10533, -2662, -2662, -2662, 10533, 1969, 1832,
+  1832, 1832, 255, 20, 1669, 1635, 1914, 1971, 10533, 2164,
+  1670, 1629, 1629, 25486, -2662, -2662, 7226, -2662, -2662, -2662,
+  -52, -52, -2662, 1674, 1675, -2662, -2662, -2662, 25873, 25873,
+  -2662, 1677, -2662, 14420, 18037, 520, -2662, 1896, -2662, -2662,
+  -2662, 2202, 1853, 7226, 704, 711, 712, -2662, -2662, -2662,
+  190, -2662, -2662, -2662, 2023, 23332, 1682, -2662, 889, 26982,
+  -14, -2662, 24449, 2007, -2662, 1444, 1465, -2662, 1683, -2662,
+  -2662, 1684, 24620, 1686, 1688, 21066, 2227, 1689, 1444, -2662,
+  -2662, 1682, 1691, 1692, -2662, 1465, 26982, 1695, 1697, -2662,
+  -2662, 2034, 2237, 2037, -2662, -2662, -2662, -2662, 1700, 26982,
+  -2662, 2166, 26982, -2662, 26982, -2662, 657, -2662, -2662, 26982,
+  1702, 1707, 1709, 1713, -2662, 26982, -2662, 1718, -2662, -2662,
+  -2662, -27, 1716, 23909, 73, 25486, -2662, 1116, -2662, -2662,
+  -2662, -2662, -2662, -2662, 136, 2109, 2039, 1698, -2662, -2662,
+  2107, -2662, -2662, 1311, 1311, 20548, 24620, -2662, 1719, 2112,
+  2113, 785, 162, -2662, -2662, -2662, 24620, -2662, 1716, 618,
+  -2662, -2662, 1689, 618, 2018, 26982, 790, -2662, -2662, 26982,
+  304, 26839, 408, 304, 304, 304, 304, -2662, -112, -2662,
+  1721, 1914, 1914, 1723, -2662, -2662, 1727, -2662, -2662, 1728,
+  -2662, 1729, -2662, -2662, -2662, 1730, -2662, -2662, -2662, -2662,
+  -2662, 1808, 1808, 522, -2662, -2662, -2662, 1731, -2662, -2662,
+  -2662, 1737, -2662, 2252, 1914, 1914, 1914, -2662, -2662, 2068,
+  2070, 1832, 1738, 2265, 1744, 10533, -2662, 1741, 1743, 1745,
+  -16, -2662, 1835, 147, 1857, 12186, -2662, 1752, -2662, 1753,
+  2180, 10533, 26982, -2662, -2662, -2662, 304, 304, 2096, 190,
+  10533, -2662, 1371, -2662, -2662, -2662, 222, 222, 222, 222,
+  222, 139, -2662, 1755, 24620, 24620, 618, 1756, 618, 2051,
+  -2662, 26982, 718, -2662, -2662, 24620, -2662, 24620, 24620, 618,
+  -2662, 1444, -112, -2662, 2051, 2051, 26982, 618, 2051, -2662,
+  10533, -2662, -2662, 26982, 26982, -2662, 10533, 10533, 10533, 129,
+  1757, 10533, 1955, -2662, -2662, 719, -2662, -2662, 1760, -2662,
+  1925, 69, -2662, -2662, -2662, -2662, 1716, -2662, -2662, -2662,
+  -2662, 6674, 2201, 26982, -2662, -2662, 1865, -2662, -2662, -2662,
+  397, -2662, 721, -2662, 7226, 26982, 26982, -2662, -2662, 26982,
+  -2662, 615, 2231, 1311, 1766, -2662, -2662, 1955, 678, 1682,
+  2310, 1541, 1768, -2662, 1765, -2662, 438, -2662, -2662, 532,
+  532, -2662, -2662, 1767, -2662, 1769, 1771, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, 10533,
+  2200, 10533, 1772, 1773, 1783, 1785, 1788, 1914, -2662, 10533,
+  1744, -2662, -2662, -2662, 104, -2662, 1973, 1981, -2662, -2662,
+  1789, -2662, 25873, 14974, -2662, -2662, -2662, 788, 788, 26982,
+  -96, 1744, -2662, -2662, -2662, -2662, -2662, -2662, 190, 24620,
+  -2662, 1686, -2662, 5, 22620, 1682, -2662, 1992, 2007, -2662,
+  730, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, 2325,
+  -2662, 26982, -2662, -2662, -2662, -2662, -2662, 1790, 1792, 1794,
+  26982, 2007, 737, 1311, 1989, 24620, 23909, -2662, 1814, 2063,
+  73, -2662, 1955, -2662, -2662, 1371, 238, 1800, 1894, 2192,
+  24620, -2662, -65, 1805, 1807, 1716, -2662, -2662, -2662, -2662,
+  162, 1311, 26982, 10533, 10533, 1813, 618, 574, 216, 678,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  2004, 26982, -2662, 304, 541, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, 7226, -2662, 738, -2662, -2662, -2662,
+  1832, 1832, 1810, 1818, -2662, -2662, 2066, 2193, 2175, -2662,
+  2199, -2662, -2662, 91, -2662, 1834, -2662, 2260, 139, 745,
+  -2662, -2662, -2662, -2662, 746, -2662, 21066, 2255, -2662, 607,
+  -2662, -2662, 26982, 2375, -2662, 1836, 1907, 1839, -2662, 751,
+  -2662, 2150, 7226, -2662, -2662, -2662, 2018, -2662, 1311, -2662,
+  -2662, 106, 26982, 618, 1939, -2662, -2662, -2662, 26982, 26982,
+  -2662, -2662, -2662, -2662, -2662, -2662, 782, -2662, 1841, 2232,
+  2184, 736, 2234, 2235, 2158, 26982, -2662, -2662, -2662, 1848,
+  -2662, 765, 1444, -2662, 788, 1316, 1371, -2662, 1914, 1914,
+  -2662, 2179, 2091, 2115, 1955, 26982, -2662, -2662, -2662, 874,
+  -2662, -2662, 26982, -2662, 1874, 1910, -2662, -2662, 26982, 2007,
+  24449, 2007, -2662, -2662, 1371, -2662, 2204, -2662, 1311, 1875,
+  -177, 1968, 753, -2662, 217, 754, 1883, 7226, -2662, 769,
+  -2662, 789, -2662, 808, 26982, -2662, -2662, 2394, 2220, 2399,
+  -2662, -2662, 1884, 1885, 1887, -2662, 2162, 2290, 74, -2662,
+  -2662, -2662, -2662, 14421, -211, -2662, 756, -2662, 759, 183,
+  -2662, -2662, -2662, -2662, 618, 26982, 2203, -2662, -2662, -2662,
+  -2662, 782, -59, -2662, -2662, -2662, 1890, -2662, 2230, -2662,
+  2233, -2662, -2662, 1832, 18934, 1895, 2313, -2662, 1944, 1947,
+  2407, -2662, 761, 1311, 14421, -2662, -2662, -2662, 2447, -2662,
+  -2662, -2662, -177, -2662, 26982, 1903, 823, 26982, 2247, -2662,
+  -2662, 1906, -156, 26365, 94, 2431, 2108, -2662, 2110, -2662,
+  2434, 14421, 1311, -2662, 1911, -2662, -2662, 1915, -2662, -2662,
+  764, 119, 878, 2253, -2662, 2381, -2662, -2662, 767, 1955,
+  -2662, 2213, 2335, 7226, 2012, -2662, -2662, 1311, -2662, -2662,
+  2247, -2662, 375, 455, -2662, 187, 2119, -2662, 26982, -2662,
+  -2662, 1924, -2662, 10533, -2662, 1533, 2338, 1371, -2662, 7226,
+  -2662, -2662, -2662, 2479, -2662, 2273, 2481, -2662, 2276, 653,
+  852, 7226, -2662, -2662, 218, 2129, 7226, 1371, -2662, -2662,
+  -2662, -2662, -2662, 2486, -2662, 2280, 2488, -2662, 2282, 1371,
+  -2662, -2662, 247, -2662, 1371, -2662, -2662, -2662, -2662, 2367,
+  2369, 19343, 19343, 1940, -2662, -2662, 1941, -2662, -2662, 19343,
+  19343, -2662, -2662
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const short int yypgoto[] = {
-  -2655, -2655, -2655, 2514, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, 1529, 29, -1287, -2655, 68, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, 974, -2655, 1406,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -508, -2655, -2655, 1126, -2655, -2655, -213, -2655, -2655, -2655,
-  -2655, -2655, -603, -1084, -142, -2395, -2655, -1475, -434, 539,
-  -2655, 1115, -2655, -1037, 1070, -2655, -2655, 1050, -488, -656,
-  -2655, 474, -2655, -1017, -2655, -1024, -510, -2655, -2655, -923,
-  7, -2655, 1542, 60, -2655, -2655, 214, -2655, -1430, -1341,
-  -2655, -2655, -2655, -2655, -1005, -1988, -2204, 463, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -1071,
-  -2655, -2655, 461, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2193, -2655, -2655, 462, 2535, -2655,
-  -2655, -7, -2655, 2489, -2655, 1930, -2655, -1, -2655, 2493,
-  -2655, -2655, 2495, -443, -1069, 1497, 1710, -14, -2655, 1087,
-  -2655, 788, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, 799, -2655, 1999, -932, -2655, 1530,
-  -2655, -2655, -2655, -2655, -2655, 2552, -2655, 769, -2655, -2655,
-  91, -1442, 524, -2655, -2655, 994, 1401, -2655, 2558, -2655,
-  2559, -2655, -2655, -267, -265, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, 24, -2655, -2655, 1942, -2655,
-  -2655, 1946, -2655, -2655, 2041, 1184, 1444, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -4, -2655, -171, -317, -422,
-  -2655, -2655, -2655, 665, -2655, -2655, 186, 2064, -2655, -2655,
-  -2655, -2655, -1755, 267, -2655, -2516, 762, -2655, -2655, -2655,
-  -2124, -2655, -2655, -2655, -429, -532, -649, -591, -613, -2655,
-  -2655, -321, -2035, -108, -2655, -2655, -457, -2655, -2655, -2144,
-  -2149, 505, -2655, -2655, -2655, -293, -2655, -2655, -2655, 8,
-  -95, -2482, -2001, -2655, -2655, -2321, -2655, -2655, -2655, -2655,
-  -323, -2655, -2655, -2655, -2655, -1692, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, 862, 367, -59, -1121, -2655, -2655,
-  -2655, 2582, 533, 2607, -2655, -2655, -2655, -2655, -2655, -2655,
-  1485, -2655, 1077, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -393, 1244, -2655, 1641, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -1078, 1583, -1076, -2655, -147, 789, -2655, 263,
-  -2655, -2655, -2655, -67, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2459, -2208, -223, -2655, -2655, -2655, 344, -607, -2655, -2655,
-  -2655, -2655, -2655, 572, -2655, -2655, -2655, -2655, -33, -2655,
-  -1579, -2655, -1900, -2655, -2655, -48, -371, -2655, 165, -580,
-  -2655, -600, -2655, -573, -2654, -2655, -2655, -514, -2655, -511,
-  -2655, -2655, -2655, -2655, -2655, -606, -2655, -2655, -2655, -1990,
-  -2655, -2655, 30, -2447, -2655, -2038, -2655, -642, -2655, -639,
-  -2655, -2655, -1288, -2655, -2655, -2655, -2186, -1269, -1268, -1820,
-  -2655, 159, -334, -2272, -2111, -1290, 1928, -820, -2655, 1792,
-  1793, 1791, 499, 504, 458, -302, -2655, -2655, -655, -395,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655, -2655,
-  -2655, -2655, -2655, -2655, -2655, -2655, -713, 454, 732, -2655,
-  205, -2077, -2655, -2306, 1389, -2655, 1466, -2655, 1474, -2655,
-  1949, -2655, -2655, -2655, -1077, -2655, 2639, -2655, -698, -2655,
-  -693, 1356, 1357, -2655, -2655, 1355, 541, -2131, -2655, -2655,
-  -2655, 1781, -2655, -748, -2655, -2655, 1774, -2655, -2655, -2655,
-  -2655, -2655, 705, -2655, -304, -1436, -2655, -2655, 2166, -245,
-  -1196, 545, -2655, -2655, 4, -2655, -2655, -2655, -226, 2382,
-  2414, -2655, 2383, -2655, -2655, -2655, -672, -1743, -640, -2392,
-  -2655, -1018, -1068, -677, -1728, 1022, 2386, -727, -1912, 428,
-  -1335, 1369, -2655, -2655, -2, -79, -2655, -2655, -11, -2655,
-  753, 315, -907, 486, -2655, 124, -2655, -1012, 965, 2033,
-  -2655, -2655, -404, -2655, -2338, -190, -2655, -768, -2655, -2655,
-  291, -2655, -2655
+  -2662, -2662, -2662, 2496, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, 1512, 21, -1285, -2662, -20, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, 956, -2662, 1392,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -504, -2662, -2662, 1114, -2662, -2662, -239, -2662, -2662, -2662,
+  -2662, -2662, -614, -1090, -161, -2424, -2662, -1481, -396, 515,
+  -2662, 1102, -2662, -1045, 1035, -2662, -2662, 1031, -413, -630,
+  -2662, 451, -2662, -995, -2662, -1020, -512, -2662, -2662, -934,
+  17, -2662, 1525, 71, -2662, -2662, 191, -2662, -1232, -1260,
+  -2662, -2662, -2662, -2662, -1032, -1972, -2168, 434, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -933,
+  -2662, -2662, 436, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2154, -2662, -2662, 440, 2513, -2662,
+  -2662, -7, -2662, 2466, -2662, 1916, -2662, -1, -2662, 2468,
+  -2662, -2662, 2467, -440, -1080, 1478, 1680, 6, -2662, 1115,
+  -2662, 763, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, 766, -2662, 1970, -914, -2662, 1502,
+  -2662, -2662, -2662, -2662, -2662, 2533, -2662, 748, -2662, -2662,
+  77, -1460, 500, -2662, -2662, 973, 1389, -2662, 2539, -2662,
+  2540, -2662, -2662, -287, -283, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, 32, -2662, -2662, 1923, -2662,
+  -2662, 1927, -2662, -2662, 2024, 1166, 1418, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -4, -2662, -192, -336, -442,
+  -2662, -2662, -2662, 702, -2662, -2662, 220, 2044, -2662, -2662,
+  -2662, -2662, -1760, 248, -2662, -2539, 739, -2662, -2662, -2662,
+  -2113, -2662, -2662, -2662, -450, -553, -671, -608, -628, -2662,
+  -2662, -340, -2043, -128, -2662, -2662, -476, -2662, -2662, -2176,
+  -2166, 482, -2662, -2662, -2662, -309, -2662, -2662, -2662, -6,
+  -114, -2514, -2044, -2662, -2662, -2067, -2662, -2662, -2662, -2662,
+  -337, -2662, -2662, -2662, -2662, -1701, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, 849, 349, -78, -1097, -2662, -2662,
+  -2662, 2568, 517, 2593, -2662, -2662, -2662, -2662, -2662, -2662,
+  1460, -2662, 1073, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -407, 1229, -2662, 1626, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -1065, 1569, -1063, -2662, -163, 770, -2662, 249,
+  -2662, -2662, -2662, -67, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2473, -2207, -240, -2662, -2662, -2662, 332, -603, -2662, -2662,
+  -2662, -2662, -2662, 553, -2662, -2662, -2662, -2662, -23, -2662,
+  -1545, -2662, -1931, -2662, -2662, -62, -354, -2662, 151, -569,
+  -2662, -600, -2662, -584, -2661, -2662, -2662, -533, -2662, -526,
+  -2662, -2662, -2662, -2662, -2662, -620, -2662, -2662, -2662, -1997,
+  -2662, -2662, 15, -2443, -2662, -1889, -2662, -655, -2662, -652,
+  -2662, -2662, -1302, -2662, -2662, -2662, -2171, -1244, -1242, -1757,
+  -2662, 146, -348, -2224, -2098, -1263, 1938, -821, -2662, 1784,
+  1782, 1791, 538, 539, 471, -303, -2662, -2662, -663, -398,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662,
+  -2662, -2662, -2662, -2662, -2662, -2662, -704, 446, 713, -2662,
+  193, -2074, -2662, -2279, 1396, -2662, 1462, -2662, 1464, -2662,
+  1936, -2662, -2662, -2662, -1051, -2662, 2619, -2662, -701, -2662,
+  -680, 1352, 1343, -2662, -2662, 1358, 577, -2126, -2662, -2662,
+  -2662, 1793, -2662, -746, -2662, -2662, 1759, -2662, -2662, -2662,
+  -2662, -2662, 688, -2662, -304, -1414, -2662, -2662, 2155, -255,
+  -1184, 529, -2662, -2662, -8, -2662, -2662, -2662, -224, 2371,
+  2404, -2662, 2373, -2662, -2662, -2662, -677, -1764, -629, -2401,
+  -2662, -1077, -1079, -683, -1744, 1008, 2376, -1121, -1918, 418,
+  -1317, 1357, -2662, -2662, -9, -79, -2662, -2662, -11, -2662,
+  740, 76, -907, 469, -2662, 178, -2662, -1007, 957, 2045,
+  -2662, -2662, -415, -2662, -2172, -203, -2662, -774, -2662, -2662,
+  276, -2662, -2662
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
    positive, shift that token.  If negative, reduce the rule which
    number is the opposite.  If zero, do what YYDEFACT says.
    If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1678
+#define YYTABLE_NINF -1680
 static const short int yytable[] = {
-  231, 55, 639, 284, 70, 846, 1130, 57, 1179, 636,
-  1598, 524, 283, 735, 1161, 1064, 532, 1167, 278, 666,
-  1042, 277, 1047, 742, 1501, 1071, 958, 1044, 563, 1044,
-  1523, 1525, 1524, 1524, 1515, 752, 680, 754, 1780, 1477,
-  605, 1708, 1171, 1792, 1276, 994, 711, 843, 1391, 1780,
-  624, 1141, 1072, 643, 644, 645, 2227, 1541, 1189, 2270,
-  1495, 2074, 2401, 551, 1492, 1493, 828, 1431, 638, 1424,
-  640, 641, 2487, 2473, 642, 2092, 1839, 2424, 284, 647,
-  1351, 1352, 1353, 2312, 1509, 1355, 1518, 1358, 534, 1704,
-  2094, 1241, 632, 1448, 1449, 2618, 646, 1527, 1190, 1321,
-  1323, 1696, 552, 2053, 2054, 2055, -3, -2, 1332, 1158,
-  862, 2712, 1333, 1275, 1537, 862, 1480, 1057, 2374, 857,
-  1480, 862, -1006, 2980, 2718, 2706, 1569, 2472, -275, 2363,
-  2567, 2919, 2639, 2444, 2243, 2738, 840, 841, 2660, 2545,
-  1480, 1953, 1480, 1342, 1343, 1344, 600, 2514, 1347, 600,
-  1349, 1350, 1716, 1479, 1320, 1322, 2791, 1550, 2300, 2519,
-  1128, 1934, 2282, 565, 1550, 2530, 2585, 1295, 1394, 615,
-  1631, 2568, 1414, 1295, 2662, 1061, 1295, 553, 2586, 2756,
-  311, -153, 1332, 1773, 1774, 1998, 1333, 2243, 2301, 1138,
-  1191, 3210, 1315, 1183, 1183, 1191, 2302, 2364, 1190, 3230,
-  1061, 2785, 1848, 653, 654, 2610, 1481, 2033, 658, 659,
-  1481, 2640, 1807, 1727, 858, 648, 649, 1361, 2261, 2729,
-  1011, 3237, -241, 2477, 2182, 1482, 2733, 2576, 2848, 1482,
-  1481, 2868, 1481, 2899, 1295, 1028, 722, 2569, 1468, 386,
-  3250, 2281, -241, 2489, 1032, 2757, 3006, 1479, 1513, 1482,
-  844, 1482, 698, 1733, 1734, 665, 667, 1483, 628, 3125,
-  1510, 1483, 2515, 2587, 762, 1481, 627, 2329, 284, 2296,
-  1006, 1982, 1983, 2548, 616, 617, 1571, 283, 1295, -474,
-  3267, 1483, 2105, 1483, 1482, 1362, 277, 1740, 1695, -205,
-  1191, 3062, 3033, 6, 2512, 3007, 668, 2106, 3151, 2034,
-  3268, 1007, 11, 1511, 2500, 1016, -205, 602, 1484, 1632,
-  602, 2362, 1484, 2803, 2804, 232, 3063, 2363, 1065, 1441,
-  2524, -998, 1082, 1372, 2027, 2619, 2620, 2873, 2304, 2312,
-  1780, 1447, 1484, 1485, 1484, 2297, 1017, 509, 3126, 2570,
-  2040, 1188, -275, 665, 2524, 2600, 2820, 2821, 2822, 1033,
-  426, 3095, 1741, 628, 564, 2553, 2244, 3096, 16, 2900,
-  2652, 2653, 2654, 1727, 665, 631, 2107, 1484, 2832, 2305,
-  2588, 3231, -475, 1576, 2330, 2977, 915, 1029, 2577, 3008,
-  21, 2501, 3005, 1289, 426, 2364, 2298, 1150, 1795, 1573,
-  356, 2828, 1334, 3152, 1082, 358, -473, 2976, 3106, 625,
-  509, 1012, 735, 742, 752, 754, 440, 441, 1796, 2244,
-  3034, 2883, 3251, 845, 1570, 3232, 2849, 1374, 3155, 2571,
-  1478, 723, 2794, 1955, 25, 822, 1192, 2758, 616, 617,
-  842, 1192, 918, 920, 386, 921, 826, 923, -135, 3211,
-  2670, 701, 1180, 1814, 3233, 1524, 1728, 554, 1815, 763,
-  1524, 1467, 386, 1156, 2700, 26, 3252, 2787, 990, 1139,
-  -477, 734, -1563, 1633, 2492, 2746, 1334, 2890, 1415, 3238,
-  2589, 683, 684, 1338, -205, 2041, 2746, 1551, 1129, 1395,
-  1954, 915, 683, 684, 1551, 3253, 734, 926, 1429, 1129,
-  762, 2855, 3041, 3097, 1318, 1565, 2004, 952, 2845, 2846,
-  919, 919, 1875, 919, 922, 919, 839, 839, 928, 2714,
-  839, 1935, 3015, 1566, 1568, 3164, 3193, 29, 3018, 2960,
-  2041, 2065, 284, 284, 997, 1151, 1192, 915, 1098, 2875,
-  2876, 55, 1849, 2549, 2981, 2035, 1602, 57, 1105, 2245,
-  956, 1461, 1365, 3218, 284, 1363, -402, 2954, 2472, 563,
-  -1565, 2997, 1570, -478, -275, 2860, 3026, 556, 2707, 1314,
-  2745, 2747, 2863, 1129, 1648, 2674, 1475, 2694, 2872, 2911,
-  2912, -1564, 2747, 2913, 1374, 2092, 2878, -476, 1647, 426,
-  859, -1004, 2825, 915, 2695, 860, 2550, 1037, 1058, 1045,
-  2094, 1045, 2572, 2374, 2641, 1755, 1728, 426, 1688, 1339,
-  1689, 440, 441, 1797, 1056, 1780, 964, 513, 1486, 1066,
-  386, 915, 1486, 1067, 1073, 284, 1529, 1530, 2898, 440,
-  441, 1697, 1159, 600, 386, 1455, 1340, 2068, 428, 429,
-  2696, 2697, 1486, 1708, 1486, 432, 433, 434, 435, 1126,
-  1162, 3027, 2368, 2285, 1142, 1143, 517, 518, 3098, 2466,
-  2025, 1711, 1193, 284, 1086, 598, 539, 1089, 1346, 660,
-  661, 1444, 1, 1, 2069, 1359, 3125, 1039, 2319, 1202,
-  513, 1149, 540, 2287, 1872, 763, 2051, 386, 1254, 1730,
-  284, 2226, 600, 2285, 565, 533, 1168, 1175, 525, 283,
-  -1188, 1966, 2778, 2052, 634, 1165, 1000, 883, 277, 1187,
-  1001, 2858, 2512, 1124, 1125, 1316, 2951, 884, 2286, 517,
-  518, 428, 429, 2287, 2870, 2871, 2961, 965, 432, 433,
-  434, 435, 3028, 3029, 1944, 1945, 2778, 2070, 2005, 3114,
-  1445, 3116, 2010, 1719, 2524, 2524, 601, 2183, 2879, 2684,
-  3100, 3101, 2066, 428, 429, 3126, 1747, 1748, 3030, 650,
-  432, 433, 434, 435, 966, 3042, 2779, 428, 429, 2775,
-  967, 651, 1425, 1764, 432, 433, 434, 435, 3055, 426,
-  541, 2778, 1082, 599, 542, 2071, 2776, 440, 1163, -64,
-  2914, 839, 543, 1034, 602, 3234, 2391, 2288, 652, 1506,
-  2779, 440, 1756, 1666, 2980, 526, 656, 2778, 527, 1154,
-  2363, 1155, 1035, 1705, 2698, 1157, 1456, 1203, 655, 1736,
-  2467, 2123, 2780, 1767, 839, 2109, 1255, 2504, 2685, 2751,
-  2778, -1083, 426, 427, 2611, 2612, 2478, 2015, 2023, 3235,
-  1793, 2026, 2523, -921, 2753, 2779, 1737, -1360, 2915, 2300,
-  -1554, 2655, 650, 602, 440, 441, 2780, 2789, 3031, -1083,
-  -921, 2778, 2731, 2289, 2290, 1002, 2813, 914, 3236, 1603,
-  2285, 2779, -912, 650, 657, 1082, 1082, 2778, 2364, 2301,
-  673, 1960, 2072, 1106, 1095, 564, 672, 2302, 914, 1844,
-  2528, 3046, 3047, 1096, 2779, 2322, 2533, 2656, 1722, 958,
-  2287, 2780, 3001, 2745, 2290, 1003, -921, -921, 683, 684,
-  3254, 1708, 2814, 1366, 2291, 3088, 919, 3013, 1097, 1107,
-  1432, 1434, 2552, -912, 1371, 2779, 284, 2780, 839, 839,
-  839, 839, 839, 839, 839, 839, 839, 839, 839, 839,
-  1108, 2779, 915, 1109, 2964, 1110, 1111, 1112, 1113, 1068,
-  2780, 1433, 1435, 2303, 3255, 2285, 284, -1083, 2414, 1468,
-  2314, 1098, 2505, 509, 2941, 386, 665, 2965, -912, 2315,
-  2611, 2612, -1083, 3131, 1393, 3132, -916, 3133, 2527, 2292,
-  2335, 2780, -982, 3256, -1083, 2287, -982, 1114, 544, 2613,
-  284, 284, 1555, -916, 2614, 284, 1556, 2780, 563, 1153,
-  2247, 1436, 1437, 2541, 1789, -915, 1791, 2295, 1422, 510,
-  1160, 776, 777, 1443, 1494, 2321, 2751, -1083, 1496, 2304,
-  2336, 436, 1559, 1563, 563, 563, 1560, 1564, 551, 1452,
-  1453, 2753, 853, 854, 679, 1457, 428, 429, 2268, -916,
-  -916, 982, 983, 432, 433, 434, 435, 674, 284, 675,
-  3187, 511, 677, 1429, 1676, -1083, -915, 1750, 1677, 1769,
-  2305, 1751, -266, 1770, 681, -1083, -266, 552, 1473, -192,
-  2306, 1533, 689, 284, 3169, 284, 3212, 1098, 688, 1981,
-  -921, 1977, 919, 284, 2208, 2332, 919, 695, 2209, 2343,
-  2262, -1083, -1083, 284, 2263, 1082, 2356, 1512, 675, 939,
-  1956, -915, 940, 1697, 941, 855, 856, 2460, 697, -1083,
-  -1083, 1507, 428, 429, -1083, -1083, -662, 908, 909, 432,
-  433, 434, 435, 284, 284, 2850, 2851, 2852, 2853, 2854,
-  2920, -1358, 440, 565, 1098, 2307, 712, 1098, 2464, 1985,
-  2047, 2485, 2796, 1545, 2611, 2612, 1548, 1549, 2050, 1992,
-  714, 1098, -204, -1331, 2007, 2486, -1352, 512, 2594, 565,
-  565, 2921, 2595, 1098, -1334, 2751, 1986, 2691, 1175, 284,
-  2126, -1343, 1467, 911, 909, 2708, 1993, 1946, 1947, 1948,
-  2753, 2008, 2121, 1949, 1950, 1951, 942, 1317, 2093, 606,
-  607, 608, 1082, 720, 1098, 2076, 724, 1963, 2692, 943,
-  2077, -662, -1083, -1083, -1083, 1599, 1098, 2866, 725, 3149,
-  2693, 2867, 944, -916, 2894, 2908, 2908, 760, 2895, 2909,
-  2989, 1501, 1336, 1337, -1337, 1207, 1208, 1209, 1210, 1211,
-  728, 2817, 2078, 513, 766, 2998, 2817, 2908, 2079, 862,
-  3045, 3056, 3057, 3243, 729, 945, 3058, 2866, 514, 3123,
-  3182, 3070, 946, 3124, -192, 1266, 1267, 2544, 2020, 2789,
-  3123, 2866, 515, 1384, 3128, 3153, -1153, 2866, 1522, 777,
-  516, 3154, 517, 518, 734, 1082, 3179, 3203, 1268, 1269,
-  3180, -1349, -662, -662, -1346, 1657, 1212, 1213, 1214, 1215,
-  1098, 1402, 2426, 3216, 3209, 2080, 767, 3217, -1359, -1083,
-  284, 1050, 1051, 1052, 1408, 1952, 2611, 2612, -662, 2792,
-  1302, -117, 1418, 428, 429, 430, 431, 1717, -662, -1360,
-  432, 433, 434, 435, 564, 1310, 1311, 1312, 1313, 2017,
-  2018, 1956, 2233, 1145, 1146, 1216, 743, 1217, 1218, 1219,
-  947, 1546, 1547, 2250, 1220, 745, -1083, 2671, 2672, -1307,
-  564, 564, 2797, 2798, -1340, 2799, 2800, -1158, 2922, 2811,
-  2812, -1361, 1306, 1307, -1218, -1083, 804, 847, 948, 1308,
-  1309, 2599, -1176, 1710, 919, 1287, 1288, 1714, -1368, -1083,
-  -1083, -1083, 2665, 2666, 844, 919, -1369, 2081, 284, 850,
-  -1370, 284, -1319, -1230, -1233, 284, 284, 2265, -1322, -631,
-  -1329, -1431, 2269, -1433, -1393, 1705, 811, -1384, -662, 1721,
-  851, 812, -1286, -1326, -1289, 1221, 1222, -120, -1388, -192,
-  -1385, 2082, -1271, -1387, 519, -1371, -1386, 1516, -1382, -1330,
-  2083, 1082, 2350, -1389, 949, -1390, -1392, -1391, 862, 2098,
-  2084, -1362, -1363, -1364, -1313, -1182, -1277, 1772, 2471, -1365,
-  -1366, -1367, 915, 1762, 839, 865, 852, -1250, 877, 867,
-  868, 869, 861, 870, 871, 872, 873, -192, -192, -192,
-  916, 913, 917, 1782, 924, 929, 2923, 930, -102, -108,
-  -111, 938, 953, 955, 1782, 284, 878, 2331, 234, 2924,
-  1800, 963, 1082, 975, -58, 978, -67, 985, 1806, 986,
-  1082, 987, 988, 989, 996, -631, 999, 1811, 1004, 1223,
-  1224, 1005, 1009, 1008, 1374, 1010, 1018, 1013, 1014, 1019,
-  1020, -481, 1021, 1022, 1720, 1023, 1024, 1025, 1026, 1031,
-  436, 1046, 1048, 1053, 627, 1823, 1765, 628, 2392, 284,
-  711, 631, 1094, 1738, 1090, 284, 284, 1091, 1102, 1103,
-  284, 1126, 1137, 1131, 1082, 1147, 1148, 1827, 1180, 1176,
-  1177, 1190, 284, 1834, 1835, 1186, 1196, 1197, 284, 1851,
-  1198, 283, 1168, 2765, 2766, 1199, 1200, 1847, 1201, 1204,
-  277, -117, 1205, 1228, 879, 1290, 1229, 2556, 2455, 1230,
-  1231, 1232, 2085, 1233, 2086, 1234, -126, 1235, 1236, 880,
-  683, 684, -120, 1237, 1239, 1242, 1243, 1129, 1244, 1245,
-  -123, 881, 1291, 1246, 1247, 1248, 1249, 1250, 1251, 1429,
-  -631, -631, 1252, 1253, 1256, 1296, 1257, 1258, 1259, 1260,
-  1261, 1262, 1295, 1297, 1225, 1293, 1263, 1264, 1265, 1299,
-  1501, 1270, 1271, 1292, 882, 362, 363, 364, 365, 366,
-  367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
-  377, 378, 379, 380, 381, 382, 383, 384, 385, 2392,
-  2087, 1272, 1273, 1705, 1274, 1277, 1278, 1279, 1280, 1226,
-  1281, 1282, 883, 1283, 1082, 2088, 2089, 1284, 2093, 1285,
-  1302, 1328, 884, 1845, 1319, 1329, 284, 1330, 847, 1345,
-  1354, 1348, 1360, 1098, 1370, 1375, 1377, 1378, 1972, 1973,
-  3170, 1975, 1379, 1380, 1381, 284, 1780, 1382, 885, 886,
-  1385, 1386, 1387, 1389, 284, 1392, 1390, 1397, 1399, 1401,
-  1403, 1405, 1731, 1976, 1406, 1411, 887, 888, 1153, 1409,
-  1413, 889, 890, 3115, 1419, 1425, 1438, 1439, -479, 284,
-  -480, 2016, 1458, 1053, 1082, 284, 1460, 1469, 1452, 563,
-  2024, 1474, 1497, 566, 1476, 1782, 2029, -120, 1498, 1508,
-  427, 2668, -129, 2917, 1513, 1519, 1521, 1526, 1531, 1534,
-  1536, 1538, 1539, 1097, 1553, 284, 1708, 1554, 1557, 1558,
-  1561, 1562, 1581, 284, 1429, 1571, 1583, 1584, 2690, 1585,
-  1588, 2392, 1589, 1590, 1591, 235, 1592, 1594, 1595, 1429,
-  1597, 1600, 1611, 1605, 2971, -117, -117, -117, 2097, 567,
-  426, 427, 1613, 1606, 1617, 1619, 1626, 1708, 1627, 891,
-  892, 893, 1646, 1659, 1663, 2115, 2115, 1965, 1516, 1667,
-  1668, 1669, 1813, 3273, 3276, 1674, 2554, 284, 1675, 1679,
-  1678, 3273, 3276, 2560, 1708, 1682, 1683, 1690, 1691, 1692,
-  1822, 284, 1694, 1987, 1712, 1713, 3025, 1715, 1693, 2471,
-  283, 2146, 568, 1994, 1725, 1739, 2138, 1743, 2009, 277,
-  1843, 1744, 1745, 2999, 1753, 1754, 1749, 569, 1752, 1758,
-  1759, 1760, 1761, 1785, 565, 1786, 1766, 1794, 1787, 1697,
-  1810, 1266, 839, 1044, 1044, 1268, 570, 1819, 1129, 1824,
-  1826, 3020, 1828, 1829, 1836, 1096, 1838, 1501, 1840, 680,
-  1837, 1842, 1852, 1854, 1846, 1858, 894, 1857, 1860, 1861,
-  1862, 1863, 2752, 1864, 1865, 1867, 1868, 1870, 1869, 1871,
-  1082, 1872, 1874, 1876, 1877, 1880, 1878, 1879, 1890, 1891,
-  1896, 1902, 1885, 2667, 1886, 1881, 3084, 451, 1524, 522,
-  2225, 2254, 1883, 1887, 1897, 1892, 1893, 2228, 1889, 1894,
-  537, 1903, 2232, 895, 1895, 1898, 1904, 284, 1899, 1900,
-  1914, 1910, 1926, 1928, 1905, 3195, 1506, 1939, 2277, 1906,
-  2279, 1907, 896, 1908, 1909, 1917, 1913, 1918, 3075, 1940,
-  1919, 1961, 1921, 1922, 1920, 1923, 897, 898, 899, 1942,
-  1924, 1925, 1930, 284, 1931, 1959, 1943, 1932, 2392, 1933,
-  1941, 2392, 2392, 2392, 2392, 1962, 1968, 1555, 1978, 919,
-  3240, 1755, 2014, 2354, 2019, 2021, 1971, 1755, 2042, 2048,
-  1782, 2030, 2041, 2099, 2043, 2044, 839, 284, 2103, 2045,
-  2056, 2046, 2057, 2058, 2059, 1988, 919, 1806, 919, 2062,
-  2075, 3163, 2110, 1524, 2111, 2754, 2118, 2117, 3119, 1756,
-  3121, 2122, 2127, 2119, 2125, 2128, 2903, 2124, 2139, 2140,
-  2141, 2143, 571, 2147, 2156, 564, 2158, 2169, 2173, 2910,
-  2185, 2188, 2186, 2197, 2392, 2392, 2189, 2200, 2201, 2207,
-  2353, 919, 2202, 2203, 2204, 2206, 2205, 2210, 2211, 284,
-  2214, 2212, 2215, 2218, 2221, 2234, 284, 2238, 2379, 2752,
-  839, 2240, 2242, 2239, 2382, 2241, 2390, 2358, 2248, 2251,
-  2255, 2252, 2259, 2267, 2273, 1516, 2271, 2274, 2280, 2275,
-  2311, 2283, 2328, 3181, 2386, 2338, 2317, 2347, 2346, 2348,
-  2340, 2345, 3184, 2349, 572, 2351, 2359, 2360, 573, 2361,
-  2380, 2367, 2398, 1856, 2397, 2400, 2399, 2402, 2403, 2410,
-  574, 2404, 3204, 2443, 2405, 575, 2407, 2406, 2408, 2409,
-  2412, 2411, 1156, 2440, 2446, 2447, 2413, 2415, 576, 2416,
-  2451, 2418, 2419, 2454, 2420, 2421, 577, 3228, 2428, 2430,
-  578, 2432, 2431, 2433, 2482, 2483, 2484, 2434, 579, 2436,
-  2437, 580, 2438, 2439, 2445, 2458, 2459, 2465, 581, 2167,
-  2475, 2479, 2490, 2493, 2071, 2536, -334, 702, 2537, 2542,
-  2539, 2543, 2546, 284, 2503, 2184, 2520, 2557, 2561, 2563,
-  2580, 2516, 2583, 2603, 2584, 2601, 1959, 2604, 2608, 2607,
-  2461, 1064, 2609, 2616, 2634, 2651, 2661, 2643, 2658, 2659,
-  2663, 2688, 2396, 2664, 2673, 582, 2679, 728, 2752, 3044,
-  2970, 2551, 919, 919, 919, 3043, 2555, 1044, 2704, 583,
-  2559, 584, 585, 2686, 2709, 2713, 2565, 2717, 2317, 586,
-  2715, 284, 2716, 587, 2513, 2725, 2707, 1098, 2724, 2720,
-  2722, 2518, 2723, 2726, 919, 2728, 284, -328, 2734, 2735,
-  2736, 2529, 2739, 2759, 2532, 1098, 1098, 3072, 2761, 2773,
-  2764, 2774, 2538, 2763, 2772, 2641, 2802, 2805, 2806, 2807,
-  2808, 2809, 2816, 2817, 2819, 2823, 2824, 2827, 2826, 919,
-  2817, 2829, 2830, 284, 919, 2739, 2558, 2840, 919, 2837,
-  284, 2392, 2840, 2841, 919, 2847, 2857, 2861, 284, 2889,
-  2115, -998, 2896, 2904, 284, 2906, 2916, 2918, 2937, 2532,
-  2939, 2952, 2940, 283, 2958, 830, 2575, 2596, 284, 2582,
-  2966, 3099, 277, 2968, 2942, 2943, 2944, 283, 2955, 2956,
-  2957, 2959, 728, 2396, 2987, 2990, 277, 2993, 2994, 3000,
-  3003, 3010, 3130, 2995, 3011, 1506, 781, 782, 783, 784,
-  785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-  795, 796, 797, 798, 799, 800, 801, 802, 803, 3012,
-  3016, 3017, 2517, 3039, 3024, 3050, 3051, 2965, 3048, 2964,
-  2522, 3053, 3049, 2952, 3060, 3066, 3067, 3068, 3069, 3071,
-  284, 3079, 3085, 3086, 3087, 3089, 3090, 3092, 3094, 3102,
-  2719, 3105, 3104, 3111, 3112, 1045, 1045, 2082, 3120, 3122,
-  2682, 2682, 3129, 3136, 3137, 3139, 3138, 3142, 3143, 3162,
-  3173, 3167, 3168, 3176, 3140, -1004, 3178, 3141, 3165, 3171,
-  3183, 3186, 3189, 3192, 3198, 3199, 2705, 3201, 3202, 3214,
-  3205, 3213, 3165, 3222, -1019, 3226, 3239, 3241, 3244, 2513,
-  3246, 3247, 284, 3248, 3249, 3260, 3263, 3264, 3225, 3265,
-  3266, 283, 3269, 2721, 3270, 2396, 3277, 7, 1420, 1833,
-  277, 3278, 1528, 1723, 2888, 2831, 2727, 2236, 1742, 2513,
-  2276, 2730, 2535, 1790, 3245, 1426, 2513, 1082, 1705, 2320,
-  2327, 2334, 2737, 52, 1065, 613, 3257, 1784, 1055, 614,
-  2513, 3262, 284, 623, 1462, 1301, 1771, 2032, 2022, 998,
-  63, 2049, 1454, 2683, 1850, 2264, 64, 65, 2969, 2967,
-  1567, 1718, 284, 2513, 1088, 1085, 962, 2897, 1135, 1705,
-  3004, 283, 3074, 2379, 2534, 927, 1542, 2769, 3083, 2100,
-  277, 3161, 2390, 3259, 3208, 3229, 2390, 3019, 1168, 2864,
-  3109, 3002, 2784, 2496, 3036, 2352, 1705, 2011, 2859, 2457,
-  2386, 2496, 2836, 536, 2386, 72, 3076, 2344, 2496, 1699,
-  1832, 2907, 1410, 1459, 2579, 2974, 2116, 2491, 1544, 2496,
-  2278, 2843, 2677, 3177, 3175, 3258, 3280, 2793, 3279, 2689,
-  1135, 3054, 1303, 1305, 1304, 2429, 2657, 1578, 2191, 1635,
-  230, 1661, 1185, 1662, 1665, 1579, 1341, 1331, 2224, 912,
-  2366, 692, 671, 694, 2456, 693, 1912, 1664, 1967, 2844,
-  3118, 1238, 1506, 1240, 2196, 2427, 2988, 2605, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 2513, 2513, 0, 0, 0, 0, 0, 2865, 0,
-  0, 0, 2513, 0, 2513, 2513, 0, 0, 0, 0,
-  0, 0, 0, 2877, 0, 0, 0, 0, 0, 0,
-  2882, 2513, 0, 0, 0, 0, 0, 0, 0, 3197,
-  0, 0, 2396, 0, 0, 2396, 2396, 2396, 2396, 1135,
-  2801, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  2905, 1286, 0, 0, 0, 2901, 0, 0, 0, 0,
-  0, 0, 2532, 2532, 0, 0, 2532, 0, 0, 0,
-  0, 0, 1300, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1135, 0, 0, 0, 1324, 1325, 1326,
-  1327, 0, 0, 0, 0, 0, 0, 0, 2396, 2396,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1045,
-  284, 0, 0, 0, 1356, 0, 284, 0, 0, 0,
-  0, 1135, 0, 0, 2874, 0, 2513, 0, 0, 0,
-  0, 284, 0, 0, 2972, 0, 0, 0, 0, 0,
-  283, 0, 0, 0, 0, 0, 2986, 0, 2991, 277,
-  3038, 0, 0, 0, 0, 0, 0, 2996, 0, 0,
-  0, 0, 2513, 2513, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 2513, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 3021,
-  0, 0, 1516, 0, 0, 0, 2496, 0, 1421, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 2390, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1440,
-  0, 0, 0, 0, 0, 0, 2386, 0, 0, 0,
-  0, 1446, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 284, 0, 0, 0, 0, 0, 3065,
-  0, 0, 283, 0, 0, 0, 0, 0, 3059, 0,
-  0, 277, 0, 0, 0, 0, 0, 0, 0, 3077,
-  0, 0, 55, 0, 0, 3082, 3082, 0, 57, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 2496,
-  0, 2496, 3093, 0, 0, 0, 0, 3135, 0, 0,
-  0, 0, 2496, 0, 0, 0, 0, 0, 0, 0,
-  2496, 0, 284, 0, 0, 0, 0, 0, 0, 3110,
-  0, 0, 0, 0, 0, 3113, 0, 0, 0, 0,
-  3107, 0, 0, 0, 0, 2396, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 284, 0, 0, 0, 0, 3188, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 3134,
-  0, 0, 0, 0, 1574, 1575, 0, 0, 1577, 0,
-  0, 1580, 3082, 0, 1582, 0, 3206, 0, 0, 0,
-  0, 0, 1586, 1587, 0, 0, 0, 0, 0, 1593,
-  0, 1782, 1596, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 284, 0, 0, 919, 0, 1601, 0, 1135, 1604,
-  1599, 0, 1607, 1608, 1609, 1610, 0, 1612, 0, 3185,
-  1614, 1615, 1616, 0, 1618, 0, 1620, 1621, 1622, 1623,
-  1624, 1625, 0, 0, 1628, 1629, 1630, 0, 0, 1636,
-  1637, 1638, 1639, 1640, 0, 0, 0, 0, 1641, 1642,
-  1643, 1644, 1645, 0, 1135, 1599, 1649, 1650, 1651, 1652,
-  1653, 1654, 1655, 1656, 0, 0, 0, 0, 0, 0,
-  1658, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1516,
-  0, 0, 0, 0, 0, 0, 0, 0, 1670, 1671,
-  1672, 1673, 0, 0, 0, 0, 0, 1680, 1681, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1685, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -259, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -259, 0, 0,
-  0, 1489, 0, 0, 0, 0, -259, 0, 0, 0,
+  231, 55, 640, 284, 70, 283, 278, 57, 847, 637,
+  1163, 524, 1169, 736, 552, 1503, 532, 1046, 1132, 1046,
+  1066, 667, 1181, 743, 1600, 1517, 1073, 1794, 563, 1520,
+  959, 277, 1044, 1479, 1049, 753, 712, 755, 681, 1278,
+  1529, 1143, 1074, 995, 844, 1525, 1527, 1526, 1526, 1393,
+  625, 1191, 2229, 1543, 2272, 551, 2094, 1539, 2076, 1426,
+  606, 1710, 1782, 644, 645, 646, 1497, 2403, 639, 1173,
+  641, 642, 1841, 1782, 643, 2489, 2096, 2376, 284, 648,
+  1353, 1354, 1355, 829, 1243, 1357, 1433, 1360, 1494, 1495,
+  2475, 1511, 2426, 1706, 1323, 1325, 2055, 2056, 2057, 534,
+  633, 2314, -3, -2, 2714, 1334, 647, 863, 1059, 1335,
+  2708, 1277, 1698, 1450, 1451, 564, 1192, 2720, 863, 2569,
+  2641, 1130, 863, 2006, 2620, 1482, 2921, -1008, 1571, 2521,
+  858, 1955, 2516, 2284, 2474, 841, 842, 2740, 2446, -275,
+  601, 2245, 11, 1396, 1481, 1718, 1344, 1345, 1346, 1160,
+  2532, 1349, 1482, 1351, 1352, 2982, 1482, 1297, 1482, 539,
+  2570, 2365, 2793, 1297, 1322, 1324, 601, 2662, 1936, 1552,
+  553, 1775, 1776, 1297, 2787, 540, 1633, 1334, 1063, 1552,
+  2547, 1335, 1192, 616, 1193, 1140, 2588, 1757, -135, 1416,
+  2000, 1573, 2245, 2550, 566, 1850, 763, -153, 16, 2642,
+  1809, 2870, -1000, 1185, 2587, 1729, 1297, 1363, 1193, 845,
+  601, 3212, 2901, 654, 655, 1483, 2850, 565, 659, 660,
+  21, 1317, 2612, 3035, 2664, 859, 2571, -241, 2758, 2366,
+  2035, 2468, 3127, 3127, 1484, 1427, 650, 311, 1481, 1470,
+  1515, 3008, 1483, 1946, 1947, 3009, 1483, 2502, 1483, 628,
+  567, 2302, 2780, 2514, 3153, 1512, 2517, 1446, -241, 1713,
+  2184, 1484, 699, 1297, 25, 1484, 1485, 1484, 284, 649,
+  283, 2589, 1185, 541, 1193, 1364, 1007, 542, 1018, 3239,
+  1797, 2303, -64, 2263, 1697, 543, 1769, 1732, 2696, 2304,
+  1434, 2966, 6, 1485, 2759, 26, 277, 1485, 1513, 1485,
+  1798, 603, 1436, 568, 386, 2697, 2283, 1008, 2029, 1019,
+  1034, 3128, 3128, 1374, 2967, 1634, 2781, 1486, 569, 1067,
+  2875, 1435, 2036, 1084, 2503, 509, 1447, 603, 2572, 3010,
+  2621, 2622, 2902, 1437, 1443, 556, 629, 570, 2526, 2602,
+  2834, 3036, 2805, 2806, 1486, 2979, 1449, 2314, 1486, 3154,
+  1486, 2698, 2699, -275, 1782, 2007, -1362, 29, 1578, 1190,
+  2331, 3007, 2526, 2246, 2042, 2654, 2655, 2656, 916, 1487,
+  509, 603, 2782, 2555, 2479, 2822, 2823, 2824, 2590, 1729,
+  2657, 764, -205, 1013, 1758, 2978, 666, 1291, 232, 1336,
+  2043, 666, 2469, 3108, 2491, 1084, -1190, 1735, 1736, -205,
+  1575, 2043, 626, 736, 743, 753, 755, 1572, 2573, 661,
+  662, 2578, 3232, 1063, 2246, 1035, 1376, 991, 840, 840,
+  1194, 2306, 840, 846, 1107, 823, 2658, 2789, 1984, 1985,
+  843, 426, 919, 921, 3157, 922, 827, 924, 1730, 2796,
+  554, 2830, 617, 618, 1194, 2672, 965, 356, 1480, 426,
+  427, 702, 358, 2551, 1397, 1141, 1158, 1469, 1816, 3213,
+  1526, 1336, 2307, 1817, 735, 1526, 2851, 2332, 2716, 1635,
+  1956, 440, 441, 2748, 916, 2731, 2760, 2748, 2591, 684,
+  685, 544, 2735, 684, 685, 1417, 1131, 617, 618, 1553,
+  1131, 3020, 1567, 1431, 2857, 1799, 3017, 927, 3043, 1553,
+  920, 920, 3166, 920, 923, 920, 2552, 953, 1877, 2067,
+  1194, 3195, 1320, 571, 436, 2847, 2848, 2892, 1937, 2747,
+  1182, 916, 284, 284, 1131, 2700, 1851, 3240, 929, 2494,
+  1100, 55, 2865, 572, 998, 1365, 2676, 57, 3220, 1957,
+  2862, 1568, 1570, 2709, 284, 629, 2247, 1463, 2962, 563,
+  957, 1604, 2376, 2874, 1572, 2474, 2094, 966, 2037, 1316,
+  1367, 2880, 2579, -402, 1014, -275, 2983, -205, 666, 2749,
+  2877, 2878, 1477, 2749, 1376, 1650, 2096, 1649, 386, 1060,
+  1041, 2574, 2643, 723, 3233, 573, -1006, 2827, 1039, 574,
+  1047, 860, 1047, -1565, 967, 513, 861, 2956, -1567, 916,
+  968, 575, 1690, 916, 1691, 2702, 576, 2913, 2914, 386,
+  533, 2915, 1730, 763, 1069, 1075, 284, 1488, 3028, 577,
+  -475, -476, 1531, 1532, 599, 1058, 2900, 578, 3234, 1782,
+  1068, 579, 1699, -474, 517, 518, 564, 1340, 2370, 580,
+  513, 3100, 581, 601, 1488, 1144, 1145, 2815, 1488, 582,
+  1488, 1030, 632, 1710, 284, 1348, 1361, 3235, 1, 1,
+  2860, 2514, 1161, 1088, 3236, 1457, 1091, 2885, 428, 429,
+  1195, 3269, 2027, 2872, 2873, 432, 433, 434, 435, 517,
+  518, 284, 1151, 283, 1167, 2228, 635, 1170, 1177, 2298,
+  3252, 3270, 1152, 2816, 840, 1483, 583, 602, 1968, 735,
+  1189, 1070, 386, 3029, 651, 2287, 2916, 652, 3237, 277,
+  584, 1164, 585, 586, 1484, 1126, 1127, 1204, 1742, 2999,
+  587, 2953, -664, 426, 588, 653, 386, 840, 656, 2070,
+  2321, 2963, 1128, 2068, 1318, 2289, 2922, 3238, 565, 2012,
+  428, 429, 600, 1749, 1750, 440, 441, 432, 433, 434,
+  435, 1155, 2526, 2526, 426, 2299, 2881, 3064, 2111, 1108,
+  386, 1721, 1162, 1341, 2917, 1874, 2071, 2923, 724, 3102,
+  3103, 3057, 3044, 2185, 1084, -1566, 440, 441, 1766, 428,
+  429, 1256, 3065, 1743, 3030, 3031, 432, 433, 434, 435,
+  1342, 1508, 657, 1031, 1707, 1109, 1036, 1486, 764, 1668,
+  2753, -478, -479, 3097, 603, 2125, 2300, -664, 2053, 3098,
+  3032, 1738, 658, 2506, -477, 1037, 1110, 668, 2017, 1111,
+  2755, 1112, 1113, 1114, 1115, 2054, 2780, 1739, 2525, 2072,
+  1153, 840, 840, 840, 840, 840, 840, 840, 840, 840,
+  840, 840, 840, 666, 2791, 2733, 1458, 426, 2025, 1165,
+  2480, 3003, 2747, 2028, 1156, 1205, 1157, 669, 1795, 2780,
+  1159, 884, 3253, 1116, 2393, 2078, 3015, 1084, 1084, 440,
+  2079, 885, 1962, 428, 429, 1846, 916, 2073, 1605, 2780,
+  432, 433, 434, 435, 525, 673, 3048, 3049, -664, -664,
+  2781, 386, 2416, 440, 1724, 959, 2302, 3116, 2780, 3118,
+  2287, 1003, 2080, -923, 1368, 426, 3254, 920, 2081, 863,
+  3033, 680, 2287, 2780, -664, 1373, 2292, 284, 3090, 1257,
+  -923, 1710, 674, 2781, -664, 2288, 2303, 440, 441, 2287,
+  2289, -1556, -914, 651, 2304, 3255, 2777, 2324, 509, 1319,
+  2316, 1004, 2289, 2781, 689, 3099, 2782, 284, 915, 2317,
+  1470, 684, 685, 2778, 2337, 940, -918, 2364, 941, 2289,
+  942, 675, 2781, 2365, 2924, 2082, -923, -923, 2780, 2798,
+  552, 2613, 2614, -918, 2074, 1395, 3133, 2781, 3134, 2782,
+  3135, 284, 284, -914, 510, -917, 284, 2753, 2107, 563,
+  676, 526, 1438, 1439, 527, 2943, 2249, 651, 2686, 2782,
+  2305, 2613, 2614, 2108, 2290, 1445, 1496, 2755, 678, 1424,
+  1498, 551, 915, 2543, -664, 1386, 563, 563, 2782, -918,
+  -918, 1454, 1455, 682, 2982, 1097, 511, 1459, -914, 2358,
+  2365, 2366, 2781, 2782, 1098, 2507, -917, 1001, 428, 429,
+  284, 1002, 943, 1404, -192, 432, 433, 434, 435, 1431,
+  2334, 2529, 2270, 3189, 2345, 944, 1410, 2083, 440, 1099,
+  1475, 3256, 690, 1535, 1420, 284, 2306, 284, 945, 3171,
+  2291, 1791, 2109, 1793, 920, 284, 564, 2687, 920, 3214,
+  2530, -917, 2925, 2613, 2614, 284, 2535, 1084, 2782, 1514,
+  676, 2084, 1958, 696, 2615, 2926, -1360, 1983, 2366, 2616,
+  2085, 946, 1100, 564, 564, 3257, -117, 2307, 947, 698,
+  2086, 2292, 2554, 1509, -984, 284, 284, 2308, -984, 777,
+  778, 2293, 1948, 1949, 1950, 854, 855, -204, 1951, 1952,
+  1953, 1987, 512, 713, 3258, 1547, 2753, 2297, 1550, 1551,
+  -923, 1994, 607, 608, 609, 2323, 2009, 1988, 878, 715,
+  2338, 2852, 2853, 2854, 2855, 2856, 2755, 1995, 2049, -1333,
+  1177, 284, 2010, 428, 429, -1354, 2052, 805, 1469, 2123,
+  432, 433, 434, 435, -1336, 2128, 879, 1557, 565, 1561,
+  1518, 1558, 2309, 1562, 1084, 2710, 2294, 1965, 1565, 856,
+  857, 2095, 1566, -918, -633, 3151, 948, 1601, -1345, 1678,
+  1752, 721, 1503, 1679, 1753, 565, 565, 1771, 513, -266,
+  853, 1772, -120, -266, -1339, 1100, 2210, 2264, 1699, 1979,
+  2211, 2265, 2462, 514, 949, 725, 1100, 726, 3245, -192,
+  2466, 428, 429, 430, 431, 729, 3184, 515, 432, 433,
+  434, 435, 851, 2546, 730, 516, 2791, 517, 518, 852,
+  1954, 1100, 1100, 2596, 2022, 2487, 2488, 2597, 1052, 1053,
+  1054, 1100, 2087, 3205, 2088, 2693, -1155, 1084, 1100, 1100,
+  684, 685, 2694, 2695, 880, 2868, 2896, 1131, 2910, 2869,
+  2897, 845, 2911, 234, 2428, 983, 984, 2910, 735, 881,
+  950, 2991, 284, -1351, 2819, 2819, 862, 1659, 3000, 3047,
+  -633, 882, 2910, 3059, 2601, 761, 3058, 3060, 2868, 1719,
+  3125, 3125, 3072, 2868, 3126, 3130, 2868, 3155, 3181, 767,
+  3156, 1100, 3182, 1958, 3218, 3211, 909, 910, 3219, 1312,
+  1313, 1314, 1315, -1348, 883, 912, 910, 1268, 1269, -1361,
+  2089, 1270, 1271, 1338, 1339, 1524, 778, -1362, 2252, 768,
+  2235, 2613, 2614, 2794, 1304, 2090, 2091, 744, 840, 2019,
+  2020, 1147, 1148, 2673, 2674, 863, 920, 1548, 1549, 2799,
+  2800, 746, 884, 2801, 2802, -1309, -117, 920, 2813, 2814,
+  284, 2267, 885, 284, -1342, 1712, 1707, 284, 284, 1716,
+  -1160, -126, 1308, 1309, -192, 1310, 1311, -120, -1363, 519,
+  2667, 2668, 1289, 1290, -1220, -123, -1178, -1370, 886, 887,
+  -1371, 1723, 914, -1372, -1321, -633, -633, -1232, 918, 2352,
+  2271, -1235, -1324, 1084, -1331, -1433, 888, 889, 2100, -1435,
+  -1395, 890, 891, 812, 916, -1386, 925, 930, 931, 2473,
+  1767, 813, -192, -192, -192, 1764, -1288, -1328, -1291, 1774,
+  -1390, -1387, -102, 917, -1273, -1389, -1373, -1388, -1384, -1332,
+  -1391, -1392, -1394, -1393, -1364, 1784, -1365, -1366, 2333, -108,
+  -1315, -1184, -1279, -1367, -1368, -1369, 1784, 284, 866, -1252,
+  868, 869, 1802, 870, 1084, 1733, 871, 872, 873, 874,
+  1808, 1155, 1084, -111, 939, 954, 956, 964, 976, 1813,
+  -58, 979, -67, 986, 1376, 987, 2767, 2768, 988, 989,
+  990, 997, 1000, 1005, 1009, 1006, 1010, 1011, 1012, 892,
+  893, 894, 712, 1015, 1016, 1020, 1021, 1825, 1022, -482,
+  2394, 284, 1023, 1025, 1024, 1026, 1027, 284, 284, 1028,
+  1033, 436, 284, 1048, 1050, 1055, 1084, 628, 629, 632,
+  1092, 1093, 1096, 1104, 284, 1105, 283, 1849, 1128, 1829,
+  284, 1853, -120, 1133, 1170, 1836, 1837, -129, 1139, 1150,
+  1722, 1149, 1178, 2558, 1179, 1182, 1188, 1198, 1199, 1192,
+  1200, 1201, 277, 1202, 1203, 1206, 1207, 1230, 1231, 1740,
+  1232, 1518, 1233, 1297, 1298, 1815, 1234, 1235, 1236, 1237,
+  235, 1238, 1239, 1241, 1244, 1245, 2457, 1292, 1246, 1247,
+  -117, -117, -117, 1824, 1248, 1431, 895, 1293, 1249, 1250,
+  1251, 1503, 1252, 1253, 1254, 1255, 1258, 1259, 1299, 1260,
+  1261, 1301, 1262, 1845, 1263, 1264, 1265, 1266, 1267, 1272,
+  1273, 1356, 1274, 1372, 1275, 1276, 1379, 1279, 1377, 1280,
+  1281, 1282, 1283, 1380, 1707, 1284, 1381, 1285, 1286, 1287,
+  1294, 2394, 1295, 896, 1304, 1321, 1350, 1382, 1330, 1331,
+  1332, 848, 1347, 1100, 1383, 1362, 1084, 1384, 1387, 1388,
+  1389, 1391, 897, 1392, 3172, 1394, 1399, 1401, 284, 1403,
+  1405, 2095, 1407, 1408, 1411, 1413, 898, 899, 900, 1421,
+  1415, 1440, -480, -483, 1427, 1441, 2919, 284, -481, 1460,
+  1209, 1210, 1211, 1212, 1213, 1462, 284, 1055, 1471, 1478,
+  1974, 1975, 1499, 1977, 1476, 1500, 1510, 427, 1515, 1521,
+  1782, 1523, 1528, 1536, 1533, 1978, 1541, 1538, 1555, 1847,
+  1540, 284, 1099, 2018, 1556, 1559, 1084, 284, 1560, 1563,
+  1454, 563, 2026, 3117, 1564, 1583, 1596, 1784, 2031, 1585,
+  1573, 1586, 1587, 1590, 1591, 1592, 1597, 1593, 1961, 1594,
+  1599, 1214, 1215, 1216, 1217, 1602, 2670, 284, 1607, 1608,
+  1613, 1615, 1619, 1621, 1628, 284, 1629, 1648, 1661, 1973,
+  1431, 1665, 1669, 2394, 1670, 1681, 1710, 1671, 2973, 1676,
+  1677, 1680, 1684, 2692, 1685, 1431, 840, 1692, 1990, 1693,
+  2099, 1694, 1696, 1695, 1714, 1715, 3001, 1717, 1727, 1741,
+  1218, 1746, 1219, 1220, 1221, 1745, 1747, 2117, 2117, 1222,
+  1751, 1754, 1755, 1756, 1761, 1760, 1762, 1710, 564, 284,
+  1763, 1787, 2556, 1768, 3022, 1788, 1789, 3027, 1796, 2562,
+  1812, 1699, 1268, 284, 1821, 283, 2140, 3275, 3278, 1826,
+  2473, 1131, 1270, 2148, 1710, 3275, 3278, 1828, 1830, 1831,
+  1098, 1840, 1838, 1839, 1842, 1844, 1848, 1854, 1856, 1859,
+  1862, 277, 1860, 1967, 1046, 1046, 1863, 1864, 1518, 1865,
+  1866, 1874, 1867, 1870, 1869, 1892, 1871, 1872, 1503, 1873,
+  1223, 1224, 1876, 1878, 1879, 1882, 1893, 1898, 1904, 1989,
+  1880, 1905, 1912, 681, 1881, 1883, 1885, 1887, 1888, 1996,
+  1889, 1899, 1916, 1894, 2011, 1891, 1895, 1896, 1897, 1928,
+  1963, 3077, 1084, 1941, 1900, 2754, 1901, 1964, 1943, 1902,
+  565, 1907, 1980, 2016, 1906, 1910, 1908, 1909, 1919, 2669,
+  840, 1911, 2227, 2256, 1915, 1921, 1922, 451, 1930, 522,
+  1920, 3086, 1923, 1526, 1924, 1925, 1942, 1926, 1757, 284,
+  537, 1927, 2169, 1757, 1932, 1933, 1934, 2021, 1508, 2230,
+  2279, 2044, 2281, 1944, 2234, 1935, 1945, 2032, 2186, 3197,
+  2101, 2050, 1970, 2023, 1225, 1226, 1557, 2105, 2043, 1961,
+  2058, 3121, 2112, 3123, 2045, 284, 2047, 2046, 2048, 2060,
+  2394, 2059, 2077, 2394, 2394, 2394, 2394, 2061, 2064, 2113,
+  2119, 920, 1758, 2120, 840, 2356, 2126, 2121, 2127, 2124,
+  2129, 2130, 1784, 2142, 3242, 2141, 2143, 2145, 2149, 284,
+  2158, 2160, 2171, 2175, 2187, 2188, 2190, 2191, 920, 1808,
+  920, 2199, 2202, 2203, 2204, 2206, 2207, 2205, 2208, 2209,
+  2212, 2756, 2213, 2214, 2216, 2217, 3165, 2236, 1526, 2220,
+  2223, 2240, 2241, 2242, 2250, 2244, 3183, 2243, 2253, 2269,
+  2254, 2905, 2257, 2261, 2273, 3186, 2394, 2394, 2275, 2276,
+  2282, 2277, 2355, 920, 2912, 2285, 2313, 2340, 2319, 2330,
+  2342, 284, 2348, 2347, 2350, 3206, 2349, 2351, 284, 2353,
+  2381, 2361, 2362, 2363, 2369, 2382, 2384, 1858, 2392, 1227,
+  2400, 2399, 2754, 2402, 2401, 2412, 2404, 2442, 2448, 2360,
+  3230, 2406, 2405, 2409, 2407, 2445, 2408, 2449, 2410, 2453,
+  2414, 2411, 2418, 2413, 2456, 2415, 2388, 2417, 2420, 2421,
+  2477, 2422, 2433, 2423, 2430, 2432, 2481, 2434, 2495, 2435,
+  2436, 2438, 2439, 2440, 1228, 2441, 2447, 2460, 2461, 2467,
+  2492, 2073, 2538, 2539, -334, 2541, 1158, 2544, 2545, 2548,
+  2559, 2565, 2582, 2563, 2585, 2586, 2605, 2603, 2606, 2610,
+  2609, 2611, 2653, 2618, 2663, 2661, 2484, 2485, 2486, 2665,
+  2636, 362, 363, 364, 365, 366, 367, 368, 369, 370,
+  371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+  381, 382, 383, 384, 385, 284, 2505, 703, 2522, 2645,
+  2660, 2666, 2675, 2518, 2681, 729, 2688, 2690, 2711, 2706,
+  2319, 2719, 2463, 2717, 2715, 2718, 2709, 1066, 1100, 2722,
+  2726, 2727, 2724, 2728, 2725, 2730, 2761, 2763, 1046, 2765,
+  -328, 3045, 2736, 2553, 920, 920, 920, 2737, 2557, 2738,
+  1100, 2754, 2561, 2972, 3046, 1100, 2741, 2766, 2567, 2774,
+  2775, 2776, 2804, 284, 2807, 2643, 2515, 2821, 2808, 2809,
+  2810, 2811, 2818, 2520, 2819, 2825, 920, 2826, 284, 2828,
+  2829, 2819, 2831, 2531, 2832, 2741, 2534, 2839, 2398, 2842,
+  2842, 2843, 2849, -1000, 2540, 2859, 2863, 2891, 2898, 2906,
+  2908, 2918, 3074, 2920, 2939, 2941, 2942, 2954, 2944, 2968,
+  2945, 920, 2946, 2957, 2958, 284, 920, 2970, 2560, 2992,
+  920, 2989, 284, 2394, 2959, 2960, 920, 3002, 2961, 729,
+  284, 2995, 2117, 2996, -1085, 2997, 284, 3005, 283, 2584,
+  3012, 2534, 3014, 3013, 3041, 3018, 2498, 3019, 3101, 2598,
+  284, 3050, 283, 3026, 2498, 831, 426, 427, 2577, 3051,
+  3053, 2498, -1085, 3052, 277, 2967, 2966, 2954, 3062, 3068,
+  3070, 3055, 2498, 3073, 3081, 3089, 3069, 1508, 277, 3071,
+  3088, 3087, 3091, 3092, 3094, 3096, 3104, 3132, 782, 783,
+  784, 785, 786, 787, 788, 789, 790, 791, 792, 793,
+  794, 795, 796, 797, 798, 799, 800, 801, 802, 803,
+  804, 3106, 3107, 3114, 3113, 2084, 3122, 3124, 3138, 2398,
+  3131, 3139, 284, 3140, 3144, 3141, 3142, 3143, 3145, 3164,
+  3167, 3169, 2721, 3175, 3170, 3173, 3178, 1047, 1047, -1006,
+  3180, 3185, 2684, 2684, 3188, 3191, 3200, 3194, 3201, 3204,
+  3203, 3215, 3207, 3216, 3224, 3167, -1021, 3241, 2519, 3246,
+  -1085, 3243, 3228, 3248, 3249, 3250, 2524, 3251, 2707, 3262,
+  3265, 3266, 3267, 3268, 3271, -1085, 3272, 3279, 3280, 7,
+  2890, 2515, 1422, 1835, 284, 2238, 283, -1085, 2833, 2278,
+  1530, 2537, 2322, 1725, 1786, 2723, 1792, 1744, 2336, 1428,
+  2329, 52, 614, 3227, 615, 624, 1303, 2024, 2729, 1707,
+  999, 2515, 277, 2732, 2034, 1057, 1456, 1464, 2515, 1084,
+  -1085, 63, 2051, 2266, 2739, 1852, 1067, 64, 65, 3247,
+  2971, 2685, 2515, 2969, 284, 1720, 1090, 1087, 2899, 963,
+  1569, 3259, 1544, 3006, 3076, 928, 3264, 2536, 2102, 3085,
+  1707, 2398, 3163, 3261, 284, 2515, 283, 2771, -1085, 3210,
+  3021, 2866, 3231, 3111, 2354, 2381, 1773, 3004, -1085, 1137,
+  2786, 2861, 3038, 2459, 2392, 2838, 2013, 1707, 2392, 536,
+  1170, 72, 277, 2346, 3078, 1546, 1701, 2909, 1412, 2118,
+  2976, 1461, 2581, 2280, -1085, -1085, 3179, 2493, 1834, 2845,
+  2679, 3177, 2388, 3260, 2795, 3282, 2388, 3281, 2691, 3056,
+  230, 2193, -1085, -1085, 1306, 1305, 2659, -1085, -1085, 2431,
+  1187, 1664, 1343, 2226, 1307, 1580, 2368, 1581, 913, 1663,
+  693, 1137, 672, 695, 1914, 694, 2458, 1666, 1637, 1667,
+  2429, 3120, 1969, 2198, 2607, 2990, 0, 0, 0, 0,
+  1333, 2846, 0, 0, 1508, 1518, 0, 0, 0, 2498,
+  0, 0, 1240, 0, 1242, 0, 0, 0, 0, 0,
+  0, 0, 0, 2515, 2515, 0, 0, 0, 0, 0,
+  2867, 0, 0, 0, 2515, 0, 2515, 2515, 0, 0,
+  0, 0, 0, 0, 0, 2879, 0, 0, 0, 0,
+  0, 0, 2884, 2515, 0, -1085, -1085, -1085, 0, 0,
+  0, 0, 0, 0, 3199, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1137, 0, 2907, 0, 0, 0, 0, 2903, 0, 0,
+  0, 0, 1288, 0, 2534, 2534, 0, 0, 2534, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2498, 1302, 2498, 0, 0, 0, 2398, 0,
+  0, 2398, 2398, 2398, 2398, 2498, 2803, 0, 0, 0,
+  0, 0, 0, 2498, 1137, 0, 0, 0, 1326, 1327,
+  1328, 1329, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -1085, 0, 0, 0, 0, 0, 0, 0,
+  0, 1047, 284, 0, 0, 0, 0, 0, 284, 0,
+  0, 0, 0, 0, 0, 1358, 0, 0, 2515, 0,
+  0, 0, 1137, 284, 0, 283, 2988, 0, 0, 0,
+  0, 0, 0, 0, 2398, 2398, 2974, 0, 0, -1085,
+  2993, 0, 3040, 0, 0, 0, 0, 0, 0, 2998,
+  0, 277, 0, 0, 2515, 2515, 0, 0, -1085, 0,
+  848, 0, 0, 0, 0, 0, 0, 0, 0, 2515,
+  2876, 0, -1085, -1085, -1085, 0, 0, 0, 0, 0,
+  0, 3023, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1423,
+  2392, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1442, 0, 0, 0, 0, 0, 0, 2388, 0,
+  0, 0, 0, 1448, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 284, 0, 283, 3061, 0,
+  0, 3067, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 3079, 1518, 277, 55, 0, 0, 3084, 3084, 0,
+  57, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3095, 0, 0, 0, 0, 3137,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 284, 0, 0, 0, 0, 0,
+  0, 3112, 0, 0, 0, 0, 0, 3115, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3109, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 284, 0, 0, 0, 0, 3190, 3080,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 3136, 0, 0, 3084, 0, 1576, 1577, 3208, 0,
+  1579, 2398, 0, 1582, 0, 0, 1584, 0, 0, 0,
+  0, 0, 0, 1784, 1588, 1589, 0, 0, 0, 0,
+  0, 1595, 0, 0, 1598, 0, 0, 0, 0, 0,
+  0, 0, 0, 284, 0, 0, 920, 0, 0, 0,
+  0, 0, 1601, 0, 0, 0, 0, 0, 1603, 0,
+  1137, 1606, 0, 0, 1609, 1610, 1611, 1612, 0, 1614,
+  0, 3187, 1616, 1617, 1618, 0, 1620, 0, 1622, 1623,
+  1624, 1625, 1626, 1627, 0, 0, 1630, 1631, 1632, 0,
+  3162, 1638, 1639, 1640, 1641, 1642, 0, 1601, 0, 0,
+  1643, 1644, 1645, 1646, 1647, 0, 1137, 0, 1651, 1652,
+  1653, 1654, 1655, 1656, 1657, 1658, 0, 0, 0, 0,
+  0, 0, 1660, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1672, 1673, 1674, 1675, 0, 0, 0, 0, 0, 1682,
+  1683, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1687, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, -259,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, -259,
+  0, 0, 0, 1491, 0, 0, 0, 0, -259, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -259, 0, 0, 3078, 0, 1724, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
-  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -259, -259, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -259, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -259, 0, 0, 0, 0, -259,
-  0, -259, -259, 1763, 0, -259, 0, 0, 0, -259,
-  0, 0, -259, 0, 0, 0, 0, 0, 0, 0,
-  0, -259, -259, 0, 1783, -259, 0, 0, 0, 0,
-  0, 0, 0, 0, -259, -259, 0, 0, -259, 0,
-  0, 0, -259, 0, 0, 0, -259, -259, -259, 0,
-  0, 0, 0, 0, 0, -259, 0, 3160, 0, 0,
-  -259, 0, -259, 0, 0, -259, 0, 0, -259, -259,
-  0, -259, 0, 0, -259, 0, 0, 0, 0, 0,
-  0, -259, 0, 0, 0, -259, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
+  1726, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -259, 0, -259, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, -259, -259, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
+  0, -259, 0, -259, -259, 1765, 0, -259, 0, 0,
+  0, -259, 0, 0, -259, 0, 0, 0, 0, 0,
+  0, 0, 0, -259, -259, 0, 1785, -259, 0, 0,
+  0, 0, 0, 0, 0, 0, -259, -259, 0, 0,
+  -259, 0, 0, 0, -259, 0, 0, 0, -259, -259,
+  -259, 0, 0, 0, 0, 0, 0, -259, 0, 0,
+  0, 0, -259, 0, -259, 0, 0, -259, 0, 0,
+  -259, -259, 0, -259, 0, 0, -259, 0, 0, 0,
+  0, 0, 0, -259, 0, 0, 0, -259, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1861, -259, 0, 0,
+  0, 0, -259, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, -259, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1859, -259, 0, 0, 0, 0,
-  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -259, 0, 0, 0, 0, 0, 0, 1873, 0,
-  0, 0, 0, 0, 0, 0, 0, -259, -259, 1882,
-  0, 1884, 0, -259, -259, 0, 0, -259, 0, 0,
-  0, 0, 0, -259, 0, -259, 0, 0, 0, 0,
-  0, -259, 1901, 0, 0, 0, 0, 0, 0, -259,
-  0, 0, 0, 0, 0, 0, 1916, 0, 0, 0,
+  1875, 0, 0, 0, 0, 0, 0, 0, 0, -259,
+  -259, 1884, 0, 1886, 0, -259, -259, 0, 0, -259,
+  0, 0, 0, 0, 0, -259, 0, -259, 0, 0,
+  0, 0, 0, -259, 1903, 0, 0, 0, 0, 0,
+  0, -259, 0, 0, 0, 0, 0, 0, 1918, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1937, 1938, 0, 0, 0, 0, 0,
-  0, 0, -259, 0, 0, 0, 0, 0, 0, 0,
-  -259, 0, -259, 0, 0, 0, 0, -259, 0, 0,
-  -259, 0, -259, 0, -259, -259, -259, 0, 0, 0,
-  0, 0, 0, 0, 0, -259, 0, -259, 0, 0,
+  0, 0, 0, 0, 0, 1939, 1940, 0, 0, 0,
+  0, 0, 0, 0, -259, 0, 0, 0, 0, 0,
+  0, 0, -259, 0, -259, 0, 0, 0, 0, -259,
+  0, 0, -259, 0, -259, 0, -259, -259, -259, 0,
+  0, 0, 0, 0, 0, 0, 0, -259, 0, -259,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 2003, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2005, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -259, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -259, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -259, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, -259, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 2130, 0, 0, 2132, 0,
-  0, 0, 0, 0, -259, 0, 0, 0, 0, -259,
-  0, 0, 0, 2149, 0, 2151, 0, 0, 2154, 0,
-  0, 0, 0, 2159, 2160, 2161, 0, 0, 2163, 2164,
-  2165, 2166, 0, 0, 0, 0, 0, 2171, 2172, 0,
-  2174, 2175, 0, 2177, 0, 0, 2180, 0, 0, 0,
-  0, 0, 0, -259, -259, 2192, 2193, -259, -259, -259,
-  0, 2198, 0, 0, 0, 0, 0, 0, 0, -259,
-  0, 0, 0, 1489, 0, 0, 0, 0, -259, 0,
-  0, 0, 2216, 2217, 0, 2219, 2220, 0, 2222, 2223,
-  0, 1685, 0, 0, 0, -259, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2132, 0, 0,
+  2134, 0, 0, 0, 0, 0, -259, 0, 0, 0,
+  0, -259, 0, 0, 0, 2151, 0, 2153, 0, 0,
+  2156, 0, 0, 0, 0, 2161, 2162, 2163, 0, 0,
+  2165, 2166, 2167, 2168, 0, 0, 0, 0, 0, 2173,
+  2174, 0, 2176, 2177, 0, 2179, 0, 0, 2182, 0,
+  0, 0, 0, 0, 0, -259, -259, 2194, 2195, -259,
+  -259, -259, 0, 2200, 0, 0, 0, 0, 0, 0,
+  0, -259, 0, 0, 0, 1491, 0, 0, 0, 0,
+  -259, 0, 0, 0, 2218, 2219, 0, 2221, 2222, 0,
+  2224, 2225, 0, 1687, 0, 0, 0, -259, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -259, 0, -259, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -259, -259, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
-  0, -259, 0, -259, -259, 0, 0, -259, 0, 0,
-  0, -259, 0, 2249, -259, 0, 0, 0, 0, 0,
-  0, 0, 0, -259, -259, 0, 0, -259, 0, 0,
-  0, 2266, 0, 0, 0, 0, -259, 0, 0, 0,
-  -259, 0, 0, 0, -259, 0, 0, 0, -259, -259,
-  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -259, 0, -259, 0, 0, -259, 0, 0,
-  -259, -259, 0, -259, 0, 0, -259, 0, 0, 0,
-  0, 0, 0, -259, 0, 0, 0, -259, 0, 0,
+  0, 0, -259, 0, -259, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, -259, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -259, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 0, 0, -259, 0, -259, -259, 0, 0, -259,
+  0, 0, 0, -259, 0, 2251, -259, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, -259, 0, 0, -259,
+  0, 0, 0, 2268, 0, 0, 0, 0, -259, 0,
+  0, 0, -259, 0, 0, 0, -259, 0, 0, 0,
+  -259, -259, -259, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, -259, 0, -259, 0, 0, -259,
+  0, 0, -259, -259, 0, -259, 0, 0, -259, 0,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, -259,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -259, 9, 0, 0, 0,
-  0, 0, 0, 0, 0, 10, 0, -259, 0, 0,
-  0, 0, -259, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 11, -259, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 12, 0, -259,
-  -259, 2417, 0, 0, 0, -259, -259, 0, 0, -259,
-  13, 0, 0, 0, 0, -259, 2425, -259, 0, 0,
-  0, 0, 14, -259, 0, 0, 0, 0, 0, 0,
-  0, -259, 0, 15, 0, 0, 2442, 0, 16, 0,
-  17, 18, 2449, 2450, 0, 0, 0, 0, 19, 0,
-  0, 20, 0, 0, 0, 0, 0, 0, 0, 0,
-  21, 0, 0, 0, 22, 0, 0, 0, 0, 0,
-  2003, 0, 0, 0, -259, 0, 0, 0, 0, 0,
-  2463, 23, -259, 0, -259, 24, 0, 0, 0, -259,
-  0, 0, 0, 0, -259, 0, -259, -259, -259, 0,
-  0, 0, 0, 0, 25, 0, 0, -259, 0, -259,
+  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -259, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 10, 0, -259,
+  0, 0, 0, 0, -259, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 11, -259, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+  0, -259, -259, 2419, 0, 0, 0, -259, -259, 0,
+  0, -259, 13, 0, 0, 0, 0, -259, 2427, -259,
+  0, 0, 0, 0, 14, -259, 0, 0, 0, 0,
+  0, 0, 0, -259, 0, 15, 0, 0, 2444, 0,
+  16, 0, 17, 18, 2451, 2452, 0, 0, 0, 0,
+  19, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+  0, 0, 21, 0, 0, 0, 22, 0, 0, 0,
+  0, 0, 2005, 0, 0, 0, -259, 0, 0, 0,
+  0, 0, 2465, 23, -259, 0, -259, 24, 0, 0,
+  0, -259, 0, 0, 0, 0, -259, 0, -259, -259,
+  -259, 0, 0, 0, 0, 0, 25, 0, 0, -259,
+  0, -259, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 26, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 26, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 0, 27, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 28, 29,
+  0, 0, 0, 0, 30, -259, 0, 0, 31, 0,
+  0, 0, 0, 0, 32, 0, 33, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
-  27, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 28, 29, 0, 0,
-  0, 0, 30, -259, 0, 0, 31, 0, 0, 0,
-  0, 0, 32, 0, 33, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 34, 0,
-  0, 0, 2621, 0, 0, 2624, 0, 0, 2627, 0,
-  2629, 0, 0, 0, 2633, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 2645,
-  0, -259, 0, 2425, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 2425, 0, 0, 0, 0, 35,
-  0, 0, 0, 0, 0, 0, 36, 0, 0, 0,
-  0, 0, 0, 37, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -259, -259, 0, 0, -259,
-  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  34, 0, 0, 0, 2623, 0, 0, 2626, 0, 0,
+  2629, 0, 2631, 0, 0, 0, 2635, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 2647, 0, -259, 0, 2427, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2427, 0, 0, 0,
+  0, 35, 0, 0, 0, 0, 0, 0, 36, 0,
+  0, 0, 0, 0, 0, 37, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -259, -259, 0,
+  0, -259, -259, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 286, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 38, 0, 0, 0, 0, 287, 0,
-  0, 0, 0, 0, 0, 288, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 289, 290, 0, 0,
-  39, 0, 291, 0, 0, 292, 0, 0, 0, 0,
-  0, 293, 294, 295, 0, 0, 0, 0, 0, 0,
-  296, 0, 0, 0, 297, 298, 299, 300, 301, 0,
-  0, 0, 302, 0, 303, 304, 305, 306, 307, 0,
-  0, 0, 0, 308, 0, 0, 309, 0, 0, 0,
-  0, 0, 0, 40, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 310, 311,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 2425, 0, 0, 0, 0, 0, 0, 0, 312,
-  0, 2839, 0, 0, 313, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 314, 2425, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 315, 0, 316, 0, 0, 317, 0, 318, 319,
-  320, 0, 321, 0, 0, 322, 0, 0, 0, 323,
-  324, 0, 0, 325, 0, 0, 2880, 326, 327, 0,
-  328, 0, 2885, 2886, 2887, 0, 0, 2425, 329, 330,
-  0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 332,
-  0, 0, 0, 0, 333, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 334, 0,
-  0, 0, 0, 0, 335, 0, 0, 0, 0, 0,
-  0, 336, 0, 0, 337, 0, 0, 0, 338, 0,
-  0, 0, 0, 339, 0, 0, 0, 340, 0, 341,
-  0, 0, 0, 0, 0, 2425, 0, 2425, 0, 0,
-  0, 0, 0, 0, 0, 2425, 0, 0, 0, 0,
-  0, 342, 343, 0, 0, 0, 344, 345, 346, 347,
-  348, 349, 0, 0, 0, 350, 351, 352, 353, 0,
-  0, 0, 0, 0, 0, 354, 0, 0, 355, 356,
-  357, 0, 0, 0, 358, 0, 0, 0, 359, 0,
-  0, 360, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 361, 0, 0, 362, 363, 364, 365, 366,
-  367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
-  377, 378, 379, 380, 381, 382, 383, 384, 385, 3022,
-  3023, 0, 0, 0, 0, 386, 0, 92, 387, 94,
-  95, 96, 388, 389, 390, 100, 101, 102, 391, 392,
-  393, 106, 394, 108, 109, 110, 111, 112, 395, 396,
-  397, 116, 398, 399, 119, 400, 121, 122, 123, 124,
-  125, 401, 127, 128, 129, 130, 131, 132, 133, 402,
-  135, 136, 137, 403, 139, 140, 141, 142, 143, 404,
-  145, 0, 146, 147, 148, 405, 406, 407, 408, 153,
-  154, 155, 156, 409, 158, 159, 160, 0, 161, 162,
-  163, 0, 410, 411, 166, 167, 168, 169, 170, 171,
-  172, 173, 412, 413, 414, 177, 178, 179, 180, 181,
-  415, 183, 184, 185, 186, 187, 188, 189, 190, 191,
-  416, 193, 194, 195, 196, 0, 197, 198, 199, 200,
-  201, 202, 417, 418, 419, 420, 421, 208, 209, 210,
-  211, 212, 213, 214, 215, 216, 422, 218, 423, 424,
-  425, 222, 223, 224, 225, 0, 226, 227, 228, 229,
-  426, 427, 428, 429, 430, 431, 0, 0, 0, 432,
-  433, 434, 435, 0, 286, 0, 436, 437, 0, 0,
-  438, 439, 440, 441, 0, 0, 0, 0, 442, 287,
-  0, 0, 0, 1364, 0, 0, 288, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 289, 290, 0,
-  0, 0, 0, 291, 0, 0, 292, 0, 0, 0,
-  0, 0, 293, 294, 295, 0, 0, 0, 0, 0,
-  0, 296, 0, 0, 0, 297, 298, 299, 300, 301,
-  0, 0, 0, 302, 0, 303, 304, 305, 306, 307,
-  0, 0, 0, 0, 308, 0, 0, 309, 0, 0,
+  0, 0, 0, 0, 0, 286, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 38, 0, 0, 0, 0,
+  287, 0, 0, 0, 0, 0, 0, 288, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 289, 290,
+  0, 0, 39, 0, 291, 0, 0, 292, 0, 0,
+  0, 0, 0, 293, 294, 295, 0, 0, 0, 0,
+  0, 0, 296, 0, 0, 0, 297, 298, 299, 300,
+  301, 0, 0, 0, 302, 0, 303, 304, 305, 306,
+  307, 0, 0, 0, 0, 308, 0, 0, 309, 0,
+  0, 0, 0, 0, 0, 40, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 823, 0, 310,
-  311, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 3242,
-  312, 0, 0, 0, 0, 313, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 314, 0, 0, 0,
+  310, 311, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2427, 0, 0, 0, 0, 0, 0,
+  0, 312, 0, 2841, 0, 0, 313, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 314, 2427, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 315, 0, 316, 0, 0, 317, 0, 318,
-  319, 320, 0, 321, 0, 0, 322, 0, 0, 0,
-  323, 324, 0, 0, 325, 0, 0, 0, 326, 327,
-  0, 328, 0, 0, 0, 0, 0, 0, 824, 329,
-  330, 0, 0, 331, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 315, 0, 316, 0, 0, 317, 0,
+  318, 319, 320, 0, 321, 0, 0, 322, 0, 0,
+  0, 323, 324, 0, 0, 325, 0, 0, 2882, 326,
+  327, 0, 328, 0, 2887, 2888, 2889, 0, 0, 2427,
+  329, 330, 0, 0, 331, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  332, 0, 0, 0, 0, 333, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 334,
-  0, 0, 0, 0, 0, 335, 0, 0, 0, 0,
-  0, 0, 336, 0, 0, 337, 0, 0, 0, 338,
-  0, 0, 0, 0, 339, 0, 0, 0, 340, 0,
-  341, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 332, 0, 0, 0, 0, 333, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 342, 343, 0, 0, 0, 344, 345, 346,
-  347, 348, 349, 0, 0, 0, 350, 351, 352, 353,
-  0, 0, 0, 0, 0, 0, 354, 0, 0, 355,
-  356, 357, 0, 0, 0, 358, 0, 0, 0, 359,
-  0, 0, 360, 0, 0, 0, 0, 0, 0, 0,
+  334, 0, 0, 0, 0, 0, 335, 0, 0, 0,
+  0, 0, 0, 336, 0, 0, 337, 0, 0, 0,
+  338, 0, 0, 0, 0, 339, 0, 0, 0, 340,
+  0, 341, 0, 0, 0, 0, 0, 2427, 0, 2427,
+  0, 0, 0, 0, 0, 0, 0, 2427, 0, 0,
+  0, 0, 0, 342, 343, 0, 0, 0, 344, 345,
+  346, 347, 348, 349, 0, 0, 0, 350, 351, 352,
+  353, 0, 0, 0, 0, 0, 0, 354, 0, 0,
+  355, 356, 357, 0, 0, 0, 358, 0, 0, 0,
+  359, 0, 0, 360, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 361, 0, 0, 362, 363, 364, 365,
-  366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
-  376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
-  0, 0, 0, 0, 0, 0, 386, 0, 92, 387,
-  94, 95, 96, 388, 389, 390, 100, 101, 102, 391,
-  392, 393, 106, 394, 108, 109, 110, 111, 112, 395,
-  396, 397, 116, 398, 399, 119, 400, 121, 122, 123,
-  124, 125, 401, 127, 128, 129, 130, 131, 132, 133,
-  402, 135, 136, 137, 403, 139, 140, 141, 142, 143,
-  404, 145, 0, 146, 147, 148, 405, 406, 407, 408,
-  153, 154, 155, 156, 409, 158, 159, 160, 0, 161,
-  162, 163, 0, 410, 411, 166, 167, 168, 169, 170,
-  171, 172, 173, 412, 413, 414, 177, 178, 179, 180,
-  181, 415, 183, 184, 185, 186, 187, 188, 189, 190,
-  191, 416, 193, 194, 195, 196, 0, 197, 198, 199,
-  200, 201, 202, 417, 418, 419, 420, 421, 208, 209,
-  210, 211, 212, 213, 214, 215, 216, 422, 218, 423,
-  424, 425, 222, 223, 224, 225, 0, 226, 227, 228,
-  229, 426, 427, 428, 429, 430, 431, 0, 0, 0,
-  432, 433, 434, 435, 0, 0, 286, 436, 437, 0,
-  0, 438, 439, 440, 441, 0, 0, 0, 0, 442,
-  825, 287, 0, -1677, 0, 0, 0, 0, 288, 0,
+  0, 0, 0, 0, 361, 0, 0, 362, 363, 364,
+  365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+  375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
+  385, 3024, 3025, 0, 0, 0, 0, 386, 0, 92,
+  387, 94, 95, 96, 388, 389, 390, 100, 101, 102,
+  391, 392, 393, 106, 394, 108, 109, 110, 111, 112,
+  395, 396, 397, 116, 398, 399, 119, 400, 121, 122,
+  123, 124, 125, 401, 127, 128, 129, 130, 131, 132,
+  133, 402, 135, 136, 137, 403, 139, 140, 141, 142,
+  143, 404, 145, 0, 146, 147, 148, 405, 406, 407,
+  408, 153, 154, 155, 156, 409, 158, 159, 160, 0,
+  161, 162, 163, 0, 410, 411, 166, 167, 168, 169,
+  170, 171, 172, 173, 412, 413, 414, 177, 178, 179,
+  180, 181, 415, 183, 184, 185, 186, 187, 188, 189,
+  190, 191, 416, 193, 194, 195, 196, 0, 197, 198,
+  199, 200, 201, 202, 417, 418, 419, 420, 421, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, 422, 218,
+  423, 424, 425, 222, 223, 224, 225, 0, 226, 227,
+  228, 229, 426, 427, 428, 429, 430, 431, 0, 0,
+  0, 432, 433, 434, 435, 0, 286, 0, 436, 437,
+  0, 0, 438, 439, 440, 441, 0, 0, 0, 0,
+  442, 287, 0, 0, 0, 1366, 0, 0, 288, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 289,
   290, 0, 0, 0, 0, 291, 0, 0, 292, 0,
   0, 0, 0, 0, 293, 294, 295, 0, 0, 0,
@@ -3753,17 +3699,17 @@ static const short int yytable[] = {
   306, 307, 0, 0, 0, 0, 308, 0, 0, 309,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 824,
   0, 310, 311, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 312, 0, 0, 0, 0, 313, 0, 0,
+  0, 3244, 312, 0, 0, 0, 0, 313, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 314, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 315, 0, 316, 0, 0, 317,
   0, 318, 319, 320, 0, 321, 0, 0, 322, 0,
   0, 0, 323, 324, 0, 0, 325, 0, 0, 0,
   326, 327, 0, 328, 0, 0, 0, 0, 0, 0,
-  0, 329, 330, 0, 0, 331, 0, 0, 0, 0,
+  825, 329, 330, 0, 0, 331, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 332, 0, 0, 0, 0, 333, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3797,65 +3743,10 @@ static const short int yytable[] = {
   208, 209, 210, 211, 212, 213, 214, 215, 216, 422,
   218, 423, 424, 425, 222, 223, 224, 225, 0, 226,
   227, 228, 229, 426, 427, 428, 429, 430, 431, 0,
-  0, 0, 432, 433, 434, 435, 0, 286, 0, 436,
+  0, 0, 432, 433, 434, 435, 0, 0, 286, 436,
   437, 0, 0, 438, 439, 440, 441, 0, 0, 0,
-  0, 442, 287, 0, 0, -1677, 0, 0, 0, 288,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  289, 290, 0, 0, 0, 0, 291, 0, 0, 292,
-  0, 0, 0, 0, 0, 293, 294, 295, 0, 0,
-  0, 0, 0, 0, 296, 0, 0, 0, 297, 298,
-  299, 300, 301, 0, 0, 0, 302, 0, 303, 304,
-  305, 306, 307, 0, 0, 0, 0, 308, 0, 0,
-  309, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 310, 311, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 312, 0, 0, 0, 0, 313, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 314,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 315, 0, 316, 0, 0,
-  317, 0, 318, 319, 320, 0, 321, 0, 0, 322,
-  0, 0, 0, 323, 324, 0, 0, 325, 0, 0,
-  0, 326, 327, 0, 328, 0, 0, 0, 0, 0,
-  0, 0, 329, 330, 0, 0, 331, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 332, 0, 0, 0, 0, 333, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 334, 0, 0, 0, 0, 0, 335, 0,
-  0, 0, 0, 0, 0, 336, 0, 0, 337, 0,
-  0, 0, 338, 0, 0, 0, 0, 339, 0, 0,
-  0, 340, 0, 341, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 342, 343, 0, 0, 0,
-  344, 345, 346, 347, 348, 349, 0, 0, 0, 350,
-  351, 352, 353, 0, 0, 0, 0, 0, 0, 354,
-  0, 0, 355, 356, 357, 0, 0, 0, 358, 0,
-  0, 0, 359, 0, 0, 360, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 361, 0, 0, 362,
-  363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
-  373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
-  383, 384, 385, 0, 0, 0, 0, 0, 0, 386,
-  0, 92, 387, 94, 95, 96, 388, 389, 390, 100,
-  101, 102, 391, 392, 393, 106, 394, 108, 109, 110,
-  111, 112, 395, 396, 397, 116, 398, 399, 119, 400,
-  121, 122, 123, 124, 125, 401, 127, 128, 129, 130,
-  131, 132, 133, 402, 135, 136, 137, 403, 139, 140,
-  141, 142, 143, 404, 145, 0, 146, 147, 148, 405,
-  406, 407, 408, 153, 154, 155, 156, 409, 158, 159,
-  160, 0, 161, 162, 163, 0, 410, 411, 166, 167,
-  168, 169, 170, 171, 172, 173, 412, 413, 414, 177,
-  178, 179, 180, 181, 415, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 416, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 417, 418, 419, 420,
-  421, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  422, 218, 423, 424, 425, 222, 223, 224, 225, 0,
-  226, 227, 228, 229, 426, 427, 428, 429, 430, 431,
-  0, 0, 0, 432, 433, 434, 435, 0, 286, 0,
-  436, 437, 0, 0, 438, 439, 440, 441, 0, 0,
-  0, 0, 442, 287, 0, 0, -1677, 0, 0, 0,
-  288, 0, 0, 0, 0, 0, 0, 0, 11, 0,
+  0, 442, 826, 287, 0, -1679, 0, 0, 0, 0,
+  288, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 289, 290, 0, 0, 0, 0, 291, 0, 0,
   292, 0, 0, 0, 0, 0, 293, 294, 295, 0,
   0, 0, 0, 0, 0, 296, 0, 0, 0, 297,
@@ -3864,7 +3755,7 @@ static const short int yytable[] = {
   0, 309, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 823, 0, 310, 311, 0, 0, 0, 0, 0,
+  0, 0, 0, 310, 311, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 312, 0, 0, 0, 0, 313,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3873,7 +3764,7 @@ static const short int yytable[] = {
   0, 317, 0, 318, 319, 320, 0, 321, 0, 0,
   322, 0, 0, 0, 323, 324, 0, 0, 325, 0,
   0, 0, 326, 327, 0, 328, 0, 0, 0, 0,
-  0, 0, 824, 329, 330, 0, 0, 331, 0, 0,
+  0, 0, 0, 329, 330, 0, 0, 331, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 332, 0, 0, 0, 0, 333,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3907,11 +3798,66 @@ static const short int yytable[] = {
   420, 421, 208, 209, 210, 211, 212, 213, 214, 215,
   216, 422, 218, 423, 424, 425, 222, 223, 224, 225,
   0, 226, 227, 228, 229, 426, 427, 428, 429, 430,
-  431, 0, 0, 0, 432, 433, 434, 435, 0, 0,
-  286, 436, 437, 0, 0, 438, 439, 440, 441, 0,
-  0, 0, 0, 442, 825, 287, 0, 0, 0, 0,
+  431, 0, 0, 0, 432, 433, 434, 435, 0, 286,
+  0, 436, 437, 0, 0, 438, 439, 440, 441, 0,
+  0, 0, 0, 442, 287, 0, 0, -1679, 0, 0,
+  0, 288, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 289, 290, 0, 0, 0, 0, 291, 0,
+  0, 292, 0, 0, 0, 0, 0, 293, 294, 295,
+  0, 0, 0, 0, 0, 0, 296, 0, 0, 0,
+  297, 298, 299, 300, 301, 0, 0, 0, 302, 0,
+  303, 304, 305, 306, 307, 0, 0, 0, 0, 308,
+  0, 0, 309, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 310, 311, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 312, 0, 0, 0, 0,
+  313, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 314, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 315, 0, 316,
+  0, 0, 317, 0, 318, 319, 320, 0, 321, 0,
+  0, 322, 0, 0, 0, 323, 324, 0, 0, 325,
+  0, 0, 0, 326, 327, 0, 328, 0, 0, 0,
+  0, 0, 0, 0, 329, 330, 0, 0, 331, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 332, 0, 0, 0, 0,
+  333, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 334, 0, 0, 0, 0, 0,
+  335, 0, 0, 0, 0, 0, 0, 336, 0, 0,
+  337, 0, 0, 0, 338, 0, 0, 0, 0, 339,
+  0, 0, 0, 340, 0, 341, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 342, 343, 0,
+  0, 0, 344, 345, 346, 347, 348, 349, 0, 0,
+  0, 350, 351, 352, 353, 0, 0, 0, 0, 0,
+  0, 354, 0, 0, 355, 356, 357, 0, 0, 0,
+  358, 0, 0, 0, 359, 0, 0, 360, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 361, 0,
+  0, 362, 363, 364, 365, 366, 367, 368, 369, 370,
+  371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+  381, 382, 383, 384, 385, 0, 0, 0, 0, 0,
+  0, 386, 0, 92, 387, 94, 95, 96, 388, 389,
+  390, 100, 101, 102, 391, 392, 393, 106, 394, 108,
+  109, 110, 111, 112, 395, 396, 397, 116, 398, 399,
+  119, 400, 121, 122, 123, 124, 125, 401, 127, 128,
+  129, 130, 131, 132, 133, 402, 135, 136, 137, 403,
+  139, 140, 141, 142, 143, 404, 145, 0, 146, 147,
+  148, 405, 406, 407, 408, 153, 154, 155, 156, 409,
+  158, 159, 160, 0, 161, 162, 163, 0, 410, 411,
+  166, 167, 168, 169, 170, 171, 172, 173, 412, 413,
+  414, 177, 178, 179, 180, 181, 415, 183, 184, 185,
+  186, 187, 188, 189, 190, 191, 416, 193, 194, 195,
+  196, 0, 197, 198, 199, 200, 201, 202, 417, 418,
+  419, 420, 421, 208, 209, 210, 211, 212, 213, 214,
+  215, 216, 422, 218, 423, 424, 425, 222, 223, 224,
+  225, 0, 226, 227, 228, 229, 426, 427, 428, 429,
+  430, 431, 0, 0, 0, 432, 433, 434, 435, 0,
+  286, 0, 436, 437, 0, 0, 438, 439, 440, 441,
+  0, 0, 0, 0, 442, 287, 0, 0, -1679, 0,
   0, 0, 288, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 289, 290, 0, 0, 0, 0, 291,
+  11, 0, 0, 289, 290, 0, 0, 0, 0, 291,
   0, 0, 292, 0, 0, 0, 0, 0, 293, 294,
   295, 0, 0, 0, 0, 0, 0, 296, 0, 0,
   0, 297, 298, 299, 300, 301, 0, 0, 0, 302,
@@ -3919,7 +3865,7 @@ static const short int yytable[] = {
   308, 0, 0, 309, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 823, 0, 310, 311, 0, 0, 0,
+  0, 0, 0, 824, 0, 310, 311, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 312, 0, 0, 0,
   0, 313, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3928,7 +3874,7 @@ static const short int yytable[] = {
   316, 0, 0, 317, 0, 318, 319, 320, 0, 321,
   0, 0, 322, 0, 0, 0, 323, 324, 0, 0,
   325, 0, 0, 0, 326, 327, 0, 328, 0, 0,
-  0, 0, 0, 0, 824, 329, 330, 0, 0, 331,
+  0, 0, 0, 0, 825, 329, 330, 0, 0, 331,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 332, 0, 0, 0,
   0, 333, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3964,17 +3910,17 @@ static const short int yytable[] = {
   224, 225, 0, 226, 227, 228, 229, 426, 427, 428,
   429, 430, 431, 0, 0, 0, 432, 433, 434, 435,
   0, 0, 286, 436, 437, 0, 0, 438, 439, 440,
-  441, 0, 0, 1996, 0, 442, 825, 287, 0, 0,
+  441, 0, 0, 0, 0, 442, 826, 287, 0, 0,
   0, 0, 0, 0, 288, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 289, 290, 0, 0, 0,
   0, 291, 0, 0, 292, 0, 0, 0, 0, 0,
   293, 294, 295, 0, 0, 0, 0, 0, 0, 296,
-  0, 0, 0, 297, 298, 299, 300, 301, 1997, 0,
+  0, 0, 0, 297, 298, 299, 300, 301, 0, 0,
   0, 302, 0, 303, 304, 305, 306, 307, 0, 0,
   0, 0, 308, 0, 0, 309, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 310, 311, 0,
+  0, 0, 0, 0, 0, 824, 0, 310, 311, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 312, 0,
   0, 0, 0, 313, 0, 0, 0, 0, 0, 0,
@@ -3983,14 +3929,14 @@ static const short int yytable[] = {
   315, 0, 316, 0, 0, 317, 0, 318, 319, 320,
   0, 321, 0, 0, 322, 0, 0, 0, 323, 324,
   0, 0, 325, 0, 0, 0, 326, 327, 0, 328,
-  0, 0, 0, 0, 0, 0, 0, 329, 330, 0,
+  0, 0, 0, 0, 0, 0, 825, 329, 330, 0,
   0, 331, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 332, 0,
-  0, 0, 0, 333, 0, 0, 0, 0, 1998, 0,
+  0, 0, 0, 333, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 334, 0, 0,
   0, 0, 0, 335, 0, 0, 0, 0, 0, 0,
   336, 0, 0, 337, 0, 0, 0, 338, 0, 0,
-  0, 0, 339, 0, 1999, 0, 340, 0, 341, 0,
+  0, 0, 339, 0, 0, 0, 340, 0, 341, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   342, 343, 0, 0, 0, 344, 345, 346, 347, 348,
@@ -4012,75 +3958,20 @@ static const short int yytable[] = {
   155, 156, 409, 158, 159, 160, 0, 161, 162, 163,
   0, 410, 411, 166, 167, 168, 169, 170, 171, 172,
   173, 412, 413, 414, 177, 178, 179, 180, 181, 415,
-  183, 184, 185, 2000, 187, 188, 189, 190, 191, 416,
+  183, 184, 185, 186, 187, 188, 189, 190, 191, 416,
   193, 194, 195, 196, 0, 197, 198, 199, 200, 201,
   202, 417, 418, 419, 420, 421, 208, 209, 210, 211,
   212, 213, 214, 215, 216, 422, 218, 423, 424, 425,
   222, 223, 224, 225, 0, 226, 227, 228, 229, 426,
   427, 428, 429, 430, 431, 0, 0, 0, 432, 433,
-  434, 435, 0, 286, 0, 436, 437, 0, 0, 438,
-  439, 440, 441, 0, 0, 0, 0, 442, 287, 0,
-  0, 0, 0, 0, 0, 288, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 289, 290, 0, 0,
-  0, 0, 291, 0, 0, 292, 0, 0, 0, 0,
-  0, 293, 294, 295, 0, 0, 0, 0, 0, 0,
-  296, 0, 0, 0, 297, 298, 299, 300, 301, 0,
-  0, 0, 302, 0, 303, 304, 305, 306, 307, 0,
-  0, 0, 0, 308, 0, 0, 1463, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 310, 311,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 312,
-  0, 0, 0, 0, 313, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 314, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 315, 0, 316, 0, 0, 317, 0, 318, 319,
-  320, 0, 321, 0, 0, 322, 0, 0, 0, 323,
-  324, 0, 0, 325, 0, 0, 0, 326, 327, 0,
-  328, 0, 0, 0, 0, 0, 0, 0, 329, 330,
-  0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 332,
-  0, 0, 0, 0, 333, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 334, 0,
-  0, 0, 0, 0, 335, 0, 0, 0, 0, 0,
-  0, 336, 0, 0, 337, 0, 0, 0, 338, 0,
-  0, 1061, 0, 339, 0, 0, 0, 340, 0, 341,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 342, 343, 0, 0, 0, 344, 345, 346, 347,
-  348, 349, 0, 0, 0, 350, 351, 352, 353, 0,
-  0, 0, 0, 0, 0, 354, 0, 0, 355, 356,
-  357, 0, 0, 0, 358, 0, 0, 0, 359, 0,
-  0, 360, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 361, 0, 0, 362, 363, 364, 365, 366,
-  367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
-  377, 378, 379, 380, 381, 382, 383, 384, 385, 0,
-  0, 0, 0, 0, 0, 386, 0, 92, 387, 94,
-  95, 96, 388, 389, 390, 100, 101, 102, 391, 392,
-  393, 106, 394, 108, 109, 110, 111, 112, 395, 396,
-  397, 116, 398, 399, 119, 400, 121, 122, 123, 124,
-  125, 401, 127, 128, 129, 130, 131, 132, 133, 402,
-  135, 136, 137, 403, 139, 140, 141, 142, 143, 404,
-  145, 0, 146, 147, 148, 405, 406, 407, 408, 153,
-  154, 155, 156, 409, 158, 159, 160, 0, 161, 162,
-  163, 0, 410, 411, 166, 167, 168, 169, 170, 171,
-  172, 173, 412, 413, 414, 177, 178, 179, 180, 181,
-  415, 183, 184, 185, 186, 187, 188, 189, 190, 191,
-  416, 193, 194, 195, 196, 0, 197, 198, 199, 200,
-  201, 202, 417, 418, 419, 420, 421, 208, 209, 210,
-  211, 212, 213, 214, 215, 216, 422, 218, 423, 424,
-  425, 222, 223, 224, 225, 0, 226, 227, 228, 229,
-  426, 427, 428, 429, 430, 431, 0, 0, 0, 432,
-  433, 434, 435, 0, 286, 0, 436, 437, 1464, 0,
-  438, 439, 440, 441, 0, 0, 0, 0, 442, 287,
+  434, 435, 0, 0, 286, 436, 437, 0, 0, 438,
+  439, 440, 441, 0, 0, 1998, 0, 442, 826, 287,
   0, 0, 0, 0, 0, 0, 288, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 289, 290, 0,
   0, 0, 0, 291, 0, 0, 292, 0, 0, 0,
   0, 0, 293, 294, 295, 0, 0, 0, 0, 0,
   0, 296, 0, 0, 0, 297, 298, 299, 300, 301,
-  0, 0, 0, 302, 0, 303, 304, 305, 306, 307,
+  1999, 0, 0, 302, 0, 303, 304, 305, 306, 307,
   0, 0, 0, 0, 308, 0, 0, 309, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -4097,10 +3988,10 @@ static const short int yytable[] = {
   330, 0, 0, 331, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   332, 0, 0, 0, 0, 333, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 334,
+  2000, 0, 0, 0, 0, 0, 0, 0, 0, 334,
   0, 0, 0, 0, 0, 335, 0, 0, 0, 0,
   0, 0, 336, 0, 0, 337, 0, 0, 0, 338,
-  0, 0, 0, 0, 339, 0, 0, 0, 340, 0,
+  0, 0, 0, 0, 339, 0, 2001, 0, 340, 0,
   341, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 342, 343, 0, 0, 0, 344, 345, 346,
@@ -4108,7 +3999,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 354, 0, 0, 355,
   356, 357, 0, 0, 0, 358, 0, 0, 0, 359,
   0, 0, 360, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 701, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 361, 0, 0, 362, 363, 364, 365,
   366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
   376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
@@ -4122,7 +4013,7 @@ static const short int yytable[] = {
   153, 154, 155, 156, 409, 158, 159, 160, 0, 161,
   162, 163, 0, 410, 411, 166, 167, 168, 169, 170,
   171, 172, 173, 412, 413, 414, 177, 178, 179, 180,
-  181, 415, 183, 184, 185, 186, 187, 188, 189, 190,
+  181, 415, 183, 184, 185, 2002, 187, 188, 189, 190,
   191, 416, 193, 194, 195, 196, 0, 197, 198, 199,
   200, 201, 202, 417, 418, 419, 420, 421, 208, 209,
   210, 211, 212, 213, 214, 215, 216, 422, 218, 423,
@@ -4136,10 +4027,10 @@ static const short int yytable[] = {
   0, 0, 0, 293, 294, 295, 0, 0, 0, 0,
   0, 0, 296, 0, 0, 0, 297, 298, 299, 300,
   301, 0, 0, 0, 302, 0, 303, 304, 305, 306,
-  307, 0, 0, 0, 0, 308, 0, 0, 309, 0,
+  307, 0, 0, 0, 0, 308, 0, 0, 1465, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 823, 0,
   310, 311, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 312, 0, 0, 0, 0, 313, 0, 0, 0,
@@ -4155,7 +4046,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   334, 0, 0, 0, 0, 0, 335, 0, 0, 0,
   0, 0, 0, 336, 0, 0, 337, 0, 0, 0,
-  338, 0, 0, 0, 0, 339, 0, 0, 0, 340,
+  338, 0, 0, 1063, 0, 339, 0, 0, 0, 340,
   0, 341, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 342, 343, 0, 0, 0, 344, 345,
@@ -4184,14 +4075,14 @@ static const short int yytable[] = {
   423, 424, 425, 222, 223, 224, 225, 0, 226, 227,
   228, 229, 426, 427, 428, 429, 430, 431, 0, 0,
   0, 432, 433, 434, 435, 0, 286, 0, 436, 437,
-  0, 0, 438, 439, 440, 441, 0, 0, 0, 0,
+  1466, 0, 438, 439, 440, 441, 0, 0, 0, 0,
   442, 287, 0, 0, 0, 0, 0, 0, 288, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 289,
   290, 0, 0, 0, 0, 291, 0, 0, 292, 0,
   0, 0, 0, 0, 293, 294, 295, 0, 0, 0,
   0, 0, 0, 296, 0, 0, 0, 297, 298, 299,
   300, 301, 0, 0, 0, 302, 0, 303, 304, 305,
-  306, 307, 0, 0, 0, 0, 308, 0, 0, 1463,
+  306, 307, 0, 0, 0, 0, 308, 0, 0, 309,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -4210,7 +4101,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 334, 0, 0, 0, 0, 0, 335, 0, 0,
   0, 0, 0, 0, 336, 0, 0, 337, 0, 0,
-  0, 338, 0, 0, 1061, 0, 339, 0, 0, 0,
+  0, 338, 0, 0, 0, 0, 339, 0, 0, 0,
   340, 0, 341, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 342, 343, 0, 0, 0, 344,
@@ -4218,7 +4109,7 @@ static const short int yytable[] = {
   352, 353, 0, 0, 0, 0, 0, 0, 354, 0,
   0, 355, 356, 357, 0, 0, 0, 358, 0, 0,
   0, 359, 0, 0, 360, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 702, 0, 0, 0,
   0, 0, 0, 0, 0, 361, 0, 0, 362, 363,
   364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
   374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
@@ -4250,7 +4141,7 @@ static const short int yytable[] = {
   309, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 310, 311, 0, 0, 0, 0, 0, 0,
+  824, 0, 310, 311, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 312, 0, 0, 0, 0, 313, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 314,
@@ -4302,7 +4193,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 296, 0, 0, 0, 297,
   298, 299, 300, 301, 0, 0, 0, 302, 0, 303,
   304, 305, 306, 307, 0, 0, 0, 0, 308, 0,
-  0, 309, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1465, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 310, 311, 0, 0, 0, 0, 0,
@@ -4312,7 +4203,7 @@ static const short int yytable[] = {
   314, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 315, 0, 316, 0,
   0, 317, 0, 318, 319, 320, 0, 321, 0, 0,
-  322, 0, 0, 0, 1684, 324, 0, 0, 325, 0,
+  322, 0, 0, 0, 323, 324, 0, 0, 325, 0,
   0, 0, 326, 327, 0, 328, 0, 0, 0, 0,
   0, 0, 0, 329, 330, 0, 0, 331, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -4320,7 +4211,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 334, 0, 0, 0, 0, 0, 335,
   0, 0, 0, 0, 0, 0, 336, 0, 0, 337,
-  0, 0, 0, 338, 0, 0, 0, 0, 339, 0,
+  0, 0, 0, 338, 0, 0, 1063, 0, 339, 0,
   0, 0, 340, 0, 341, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 342, 343, 0, 0,
@@ -4357,7 +4248,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 296, 0, 0, 0,
   297, 298, 299, 300, 301, 0, 0, 0, 302, 0,
   303, 304, 305, 306, 307, 0, 0, 0, 0, 308,
-  0, 0, 2462, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 309, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 310, 311, 0, 0, 0, 0,
@@ -4412,7 +4303,7 @@ static const short int yytable[] = {
   295, 0, 0, 0, 0, 0, 0, 296, 0, 0,
   0, 297, 298, 299, 300, 301, 0, 0, 0, 302,
   0, 303, 304, 305, 306, 307, 0, 0, 0, 0,
-  308, 0, 0, 2838, 0, 0, 0, 0, 0, 0,
+  308, 0, 0, 309, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 310, 311, 0, 0, 0,
@@ -4422,7 +4313,7 @@ static const short int yytable[] = {
   0, 0, 314, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 315, 0,
   316, 0, 0, 317, 0, 318, 319, 320, 0, 321,
-  0, 0, 322, 0, 0, 0, 323, 324, 0, 0,
+  0, 0, 322, 0, 0, 0, 1686, 324, 0, 0,
   325, 0, 0, 0, 326, 327, 0, 328, 0, 0,
   0, 0, 0, 0, 0, 329, 330, 0, 0, 331,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -4459,221 +4350,442 @@ static const short int yytable[] = {
   214, 215, 216, 422, 218, 423, 424, 425, 222, 223,
   224, 225, 0, 226, 227, 228, 229, 426, 427, 428,
   429, 430, 431, 0, 0, 0, 432, 433, 434, 435,
-  0, 0, -259, 436, 437, 0, 0, 438, 439, 440,
-  441, 0, -259, 0, 0, 442, 1489, 0, 0, 0,
-  0, -259, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 286, 0, 436, 437, 0, 0, 438, 439, 440,
+  441, 0, 0, 0, 0, 442, 287, 0, 0, 0,
+  0, 0, 0, 288, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 289, 290, 0, 0, 0, 0,
+  291, 0, 0, 292, 0, 0, 0, 0, 0, 293,
+  294, 295, 0, 0, 0, 0, 0, 0, 296, 0,
+  0, 0, 297, 298, 299, 300, 301, 0, 0, 0,
+  302, 0, 303, 304, 305, 306, 307, 0, 0, 0,
+  0, 308, 0, 0, 2464, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 310, 311, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 312, 0, 0,
+  0, 0, 313, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 314, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 315,
+  0, 316, 0, 0, 317, 0, 318, 319, 320, 0,
+  321, 0, 0, 322, 0, 0, 0, 323, 324, 0,
+  0, 325, 0, 0, 0, 326, 327, 0, 328, 0,
+  0, 0, 0, 0, 0, 0, 329, 330, 0, 0,
+  331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 332, 0, 0,
+  0, 0, 333, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 334, 0, 0, 0,
+  0, 0, 335, 0, 0, 0, 0, 0, 0, 336,
+  0, 0, 337, 0, 0, 0, 338, 0, 0, 0,
+  0, 339, 0, 0, 0, 340, 0, 341, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 342,
+  343, 0, 0, 0, 344, 345, 346, 347, 348, 349,
+  0, 0, 0, 350, 351, 352, 353, 0, 0, 0,
+  0, 0, 0, 354, 0, 0, 355, 356, 357, 0,
+  0, 0, 358, 0, 0, 0, 359, 0, 0, 360,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  361, 0, 0, 362, 363, 364, 365, 366, 367, 368,
+  369, 370, 371, 372, 373, 374, 375, 376, 377, 378,
+  379, 380, 381, 382, 383, 384, 385, 0, 0, 0,
+  0, 0, 0, 386, 0, 92, 387, 94, 95, 96,
+  388, 389, 390, 100, 101, 102, 391, 392, 393, 106,
+  394, 108, 109, 110, 111, 112, 395, 396, 397, 116,
+  398, 399, 119, 400, 121, 122, 123, 124, 125, 401,
+  127, 128, 129, 130, 131, 132, 133, 402, 135, 136,
+  137, 403, 139, 140, 141, 142, 143, 404, 145, 0,
+  146, 147, 148, 405, 406, 407, 408, 153, 154, 155,
+  156, 409, 158, 159, 160, 0, 161, 162, 163, 0,
+  410, 411, 166, 167, 168, 169, 170, 171, 172, 173,
+  412, 413, 414, 177, 178, 179, 180, 181, 415, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 416, 193,
+  194, 195, 196, 0, 197, 198, 199, 200, 201, 202,
+  417, 418, 419, 420, 421, 208, 209, 210, 211, 212,
+  213, 214, 215, 216, 422, 218, 423, 424, 425, 222,
+  223, 224, 225, 0, 226, 227, 228, 229, 426, 427,
+  428, 429, 430, 431, 0, 0, 0, 432, 433, 434,
+  435, 0, 286, 0, 436, 437, 0, 0, 438, 439,
+  440, 441, 0, 0, 0, 0, 442, 287, 0, 0,
+  0, 0, 0, 0, 288, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 289, 290, 0, 0, 0,
+  0, 291, 0, 0, 292, 0, 0, 0, 0, 0,
+  293, 294, 295, 0, 0, 0, 0, 0, 0, 296,
+  0, 0, 0, 297, 298, 299, 300, 301, 0, 0,
+  0, 302, 0, 303, 304, 305, 306, 307, 0, 0,
+  0, 0, 308, 0, 0, 2840, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -259, 0, -259, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, -259, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -259,
-  0, 0, 0, 0, -259, 0, -259, -259, 0, 0,
-  -259, 0, 0, 0, -259, 0, 0, -259, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, -259, 0, 0,
-  -259, 0, 0, 0, 0, 0, 0, 0, 0, -259,
-  0, 0, 0, -259, 0, 0, 0, -259, 0, 0,
-  0, -259, -259, -259, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -259, 0, -259, 0, 0,
-  -259, 0, 0, -259, -259, 0, -259, 0, 0, -259,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
-  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -259, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -259, 0, 0, 0, 0, -259, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 310, 311, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -259, -259, 0, 0, 0, 0, -259, -259,
-  0, 0, -259, 0, 0, 0, 0, 0, -259, -259,
-  -259, 0, 0, 0, 0, 0, -259, 0, 0, -259,
-  0, 0, 0, 1489, -259, 0, 0, 0, -259, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 312, 0,
+  0, 0, 0, 313, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 314, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
+  315, 0, 316, 0, 0, 317, 0, 318, 319, 320,
+  0, 321, 0, 0, 322, 0, 0, 0, 323, 324,
+  0, 0, 325, 0, 0, 0, 326, 327, 0, 328,
+  0, 0, 0, 0, 0, 0, 0, 329, 330, 0,
+  0, 331, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 332, 0,
+  0, 0, 0, 333, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 334, 0, 0,
+  0, 0, 0, 335, 0, 0, 0, 0, 0, 0,
+  336, 0, 0, 337, 0, 0, 0, 338, 0, 0,
+  0, 0, 339, 0, 0, 0, 340, 0, 341, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -259, 0, -259, 0, 0, 0, 0, -259, 0, 0,
-  0, 0, 0, -259, -259, -259, 0, -259, 0, 0,
-  0, 0, -259, 0, 0, -259, 0, -259, 0, -259,
-  -259, -259, 0, 0, 0, 0, -259, 0, 0, 0,
-  -259, -259, -259, -259, -259, 0, 0, -259, 0, 0,
-  0, -259, 0, 0, -259, 0, 0, 0, 0, 0,
-  0, 0, 0, -259, -259, 0, 0, -259, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
-  -259, 0, 0, 0, -259, 0, 0, 0, -259, -259,
-  -259, 0, 0, 0, 0, 0, 0, 0, 0, -259,
-  0, 0, -259, 0, -259, 0, 0, -259, 0, -259,
-  -259, -259, 0, -259, 0, 0, -259, 0, 0, 0,
-  0, 0, 0, -259, 0, 0, 0, -259, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, -259, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -259, 0, 0,
-  0, 0, -259, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -259, 0, 0, 0, 0, 0, -259,
-  0, 0, 0, 0, -259, 0, 0, 0, 0, -259,
-  -259, 0, 0, 0, 0, -259, -259, 0, 0, -259,
+  342, 343, 0, 0, 0, 344, 345, 346, 347, 348,
+  349, 0, 0, 0, 350, 351, 352, 353, 0, 0,
+  0, 0, 0, 0, 354, 0, 0, 355, 356, 357,
+  0, 0, 0, 358, 0, 0, 0, 359, 0, 0,
+  360, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 361, 0, 0, 362, 363, 364, 365, 366, 367,
+  368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+  378, 379, 380, 381, 382, 383, 384, 385, 0, 0,
+  0, 0, 0, 0, 386, 0, 92, 387, 94, 95,
+  96, 388, 389, 390, 100, 101, 102, 391, 392, 393,
+  106, 394, 108, 109, 110, 111, 112, 395, 396, 397,
+  116, 398, 399, 119, 400, 121, 122, 123, 124, 125,
+  401, 127, 128, 129, 130, 131, 132, 133, 402, 135,
+  136, 137, 403, 139, 140, 141, 142, 143, 404, 145,
+  0, 146, 147, 148, 405, 406, 407, 408, 153, 154,
+  155, 156, 409, 158, 159, 160, 0, 161, 162, 163,
+  0, 410, 411, 166, 167, 168, 169, 170, 171, 172,
+  173, 412, 413, 414, 177, 178, 179, 180, 181, 415,
+  183, 184, 185, 186, 187, 188, 189, 190, 191, 416,
+  193, 194, 195, 196, 0, 197, 198, 199, 200, 201,
+  202, 417, 418, 419, 420, 421, 208, 209, 210, 211,
+  212, 213, 214, 215, 216, 422, 218, 423, 424, 425,
+  222, 223, 224, 225, 0, 226, 227, 228, 229, 426,
+  427, 428, 429, 430, 431, 0, 0, 0, 432, 433,
+  434, 435, 0, 0, -259, 436, 437, 0, 0, 438,
+  439, 440, 441, 0, -259, 0, 0, 442, 1491, 0,
+  0, 0, 0, -259, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, -259, 0, -259, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, -259,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, -259, 0, 0, 0, 0, -259, 0, -259, -259,
+  0, 0, -259, 0, 0, 0, -259, 0, 0, -259,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, -259,
+  0, 0, -259, 0, 0, 0, 0, 0, 0, 0,
+  0, -259, 0, 0, 0, -259, 0, 0, 0, -259,
+  0, 0, 0, -259, -259, -259, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -259, 0, -259,
+  0, 0, -259, 0, 0, -259, -259, 0, -259, 0,
+  0, -259, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 0, -259, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, -259, 0, 0, 0, 0, 0, 0,
-  0, -259, 0, 0, 0, 0, 0, 0, -259, -259,
-  0, 0, -259, -259, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1572, 0, 0,
-  0, 0, 0, 0, -1572, 0, 0, -1572, 0, 0,
-  0, -1572, 0, 0, -259, 0, -1572, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -259, 0, 0, 0, 0, -259, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, -259, -259, 0, 0, 0, 0,
+  -259, -259, 0, 0, -259, 0, 0, 0, 0, 0,
+  -259, -259, -259, 0, 0, 0, 0, 0, -259, 0,
+  0, -259, 0, 0, 0, 1491, -259, 0, 0, 0,
+  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -259, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, -259, 0, -259, 0, 0, 0, 0, -259,
-  0, 0, 0, -1572, -259, 0, -259, -259, -259, 0,
-  0, -1572, 0, 0, 0, 0, 0, -259, -1572, -259,
-  0, 0, 0, 0, 0, -1572, 0, 0, 0, 0,
-  0, -1572, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1572, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1572, 0, -1572, 0, 0, -1572,
-  0, -1572, -1572, 0, 0, 0, 0, 0, 0, -1572,
-  0, 0, -1572, 0, 0, 0, -259, 0, 0, 0,
-  0, -1572, 0, 0, 0, -1572, -259, 0, 0, 0,
-  0, -1572, -1572, 0, 0, 0, -1572, 0, 0, 0,
-  -1572, 0, -1572, 0, 0, 0, -1572, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, -259, -259, 0, -259,
+  0, 0, 0, 0, -259, 0, 0, -259, 0, -259,
+  0, -259, -259, -259, 0, 0, 0, 0, -259, 0,
+  0, 0, -259, -259, -259, -259, -259, 0, 0, -259,
+  0, 0, 0, -259, 0, 0, -259, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, -259, 0, 0, -259,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 0, -259, 0, 0, 0, -259, 0, 0, 0,
+  -259, -259, -259, 0, 0, 0, 0, 0, 0, 0,
+  0, -259, 0, 0, -259, 0, -259, 0, 0, -259,
+  0, -259, -259, -259, 0, -259, 0, 0, -259, 0,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, -259,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  -259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -259, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, -259,
+  0, 0, 0, 0, -259, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
+  0, -259, 0, 0, 0, 0, -259, 0, 0, 0,
+  0, -259, -259, 0, 0, 0, 0, -259, -259, 0,
+  0, -259, 0, 0, 0, 0, 0, -259, 0, -259,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
   0, 0, 0, -259, 0, 0, 0, 0, 0, 0,
-  -1572, 0, 0, 0, 0, -1572, 0, 0, 0, 0,
-  0, 0, -1572, 0, 0, 0, 0, -1572, 0, 0,
+  -259, -259, 0, 0, -259, -259, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, -1574,
+  0, 0, 0, 0, 0, 0, -1574, 0, 0, -1574,
+  0, 0, 0, -1574, 0, 0, -259, 0, -1574, 0,
+  0, 0, 0, 0, -259, 0, -259, 0, 0, 0,
+  0, -259, 0, 0, 0, -1574, -259, 0, -259, -259,
+  -259, 0, 0, -1574, 0, 0, 0, 0, 0, -259,
+  -1574, -259, 0, 0, 0, 0, 0, -1574, 0, 0,
+  0, 0, 0, -1574, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -1574, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, -1574, 0, -1574, 0,
+  0, -1574, 0, -1574, -1574, 0, 0, 0, 0, 0,
+  0, -1574, 0, 0, -1574, 0, 0, 0, -259, 0,
+  0, 0, 0, -1574, 0, 0, 0, -1574, -259, 0,
+  0, 0, 0, -1574, -1574, 0, 0, 0, -1574, 0,
+  0, 0, -1574, 0, -1574, 0, 0, 0, -1574, 0,
+  0, 0, 0, 0, 0, -259, 0, 0, 0, 0,
+  0, 0, -1574, 0, 0, 0, 0, -1574, 0, 0,
+  0, 0, 0, 0, -1574, 0, 0, 0, 0, -1574,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1572, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -259, 0, 0, 0,
-  0, -259, 0, 0, 0, 0, 0, -1572, -1572, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1572, 0,
-  0, -1572, 0, -1572, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1572, 0, -259, -259, -1572, -1572, -259,
-  -259, 0, 0, -1572, 0, 0, 0, -1572, 0, 0,
-  0, 0, 0, -1572, 0, -1572, 0, 0, 0, 0,
-  0, -1572, 0, 0, -1571, 0, 0, 0, 0, -1572,
-  0, -1571, 0, -1572, -1571, 0, 0, 0, -1571, 0,
-  0, 0, 0, -1571, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1571, 0, 0, 0, 0, 0, 0, 0, -1571, 0,
-  0, 0, 0, 0, 0, -1571, 0, 0, 0, 0,
-  -1572, 0, -1571, -1572, 0, 0, 0, -1572, -1571, 0,
-  0, 0, 0, 0, -1572, -1572, -1572, 0, 0, 0,
-  -1571, 0, 0, 0, 0, 0, 0, -1572, 0, 0,
-  0, -1571, 0, -1571, 0, 0, -1571, 0, -1571, -1571,
-  0, 0, 0, 0, 0, 0, -1571, 0, 0, -1571,
-  0, 0, 0, 0, 0, 0, 0, 0, -1571, 0,
-  0, 0, -1571, 0, 0, 0, 0, 0, -1571, -1571,
-  0, -1572, 0, -1571, 0, 0, 0, -1571, 0, -1571,
-  0, 0, 0, -1571, -1572, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1572, 0, 0, -1571, 0, 0,
-  0, 0, -1571, 0, 0, 0, 0, 0, 0, -1571,
-  0, 0, 0, 0, -1571, 0, 0, 0, 0, 0,
-  0, -1572, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1571, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1571, -1571, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1572, -1571, 0, 0, -1571, 0,
-  -1571, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1571, 0, 0, 0, -1571, -1571, 0, 0, 0, 0,
-  -1571, 0, 0, 0, -1571, 0, 0, 0, 0, 0,
-  -1571, 0, -1571, 0, 0, 0, 0, 0, -1571, 0,
-  0, 0, 0, -1572, -1572, 0, -1571, -1572, -1572, 0,
-  -1571, 0, 0, 0, 0, 0, 0, 286, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 287, 0, 0, 0, 0, 0, 0, 288,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  289, 290, 0, 0, 0, 0, 291, -1571, 0, 292,
-  -1571, 0, 0, 0, -1571, 293, 294, 0, 0, 0,
-  0, -1571, -1571, -1571, 296, 0, 0, 0, 297, 298,
-  299, 300, 301, 0, -1571, 0, 302, 0, 303, 304,
-  305, 306, 307, 0, 0, 0, 0, 308, 0, 0,
-  309, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -1574, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -259, 0,
+  0, 0, 0, -259, 0, 0, 0, 0, 0, -1574,
+  -1574, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1574, 0, 0, -1574, 0, -1574, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -1574, 0, -259, -259, -1574,
+  -1574, -259, -259, 0, 0, -1574, 0, 0, 0, -1574,
+  0, 0, 0, 0, 0, -1574, 0, -1574, 0, 0,
+  0, 0, 0, -1574, 0, 0, -1573, 0, 0, 0,
+  0, -1574, 0, -1573, 0, -1574, -1573, 0, 0, 0,
+  -1573, 0, 0, 0, 0, -1573, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -1573, 0, 0, 0, 0, 0, 0, 0,
+  -1573, 0, 0, 0, 0, 0, 0, -1573, 0, 0,
+  0, 0, -1574, 0, -1573, -1574, 0, 0, 0, -1574,
+  -1573, 0, 0, 0, 0, 0, -1574, -1574, -1574, 0,
+  0, 0, -1573, 0, 0, 0, 0, 0, 0, -1574,
+  0, 0, 0, -1573, 0, -1573, 0, 0, -1573, 0,
+  -1573, -1573, 0, 0, 0, 0, 0, 0, -1573, 0,
+  0, -1573, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1573, 0, 0, 0, -1573, 0, 0, 0, 0, 0,
+  -1573, -1573, 0, -1574, 0, -1573, 0, 0, 0, -1573,
+  0, -1573, 0, 0, 0, -1573, -1574, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, -1574, 0, 0, -1573,
+  0, 0, 0, 0, -1573, 0, 0, 0, 0, 0,
+  0, -1573, 0, 0, 0, 0, -1573, 0, 0, 0,
+  0, 0, 0, -1574, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -1573, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, -1573, -1573, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, -1574, -1573, 0, 0,
+  -1573, 0, -1573, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -1573, 0, 0, 0, -1573, -1573, 0, 0,
+  0, 0, -1573, 0, 0, 0, -1573, 0, 0, 0,
+  0, 0, -1573, 0, -1573, 0, 0, 0, 0, 0,
+  -1573, 0, 0, 0, 0, -1574, -1574, 0, -1573, -1574,
+  -1574, 0, -1573, 0, 0, 0, 0, 0, 0, 286,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 287, 0, 0, 0, 0, 0,
+  0, 288, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 289, 290, 0, 0, 0, 0, 291, -1573,
+  0, 292, -1573, 0, 0, 0, -1573, 293, 294, 0,
+  0, 0, 0, -1573, -1573, -1573, 296, 0, 0, 0,
+  297, 298, 299, 300, 301, 0, -1573, 0, 302, 0,
+  303, 304, 305, 306, 307, 0, 0, 0, 0, 308,
+  0, 0, 309, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1571, 0,
-  0, 0, 310, 311, 0, 0, 0, 0, 0, 0,
-  0, -1571, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1571, 0, 312, 0, 0, 0, 0, 313, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 314,
-  0, 0, 0, 0, 0, 0, 0, 0, -1571, 0,
-  0, 0, 0, 0, 0, 315, 0, 316, 0, 0,
-  317, 0, 318, 319, 320, 0, 321, 0, 0, 322,
-  0, 0, 0, 323, 324, 0, 0, 325, 0, 0,
-  0, 326, 327, 0, 328, 0, 0, 0, 0, 0,
-  0, 0, 329, 330, 0, 0, 331, 0, 0, 0,
-  0, -1571, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 332, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 334, 0, 0, 0, 0, 0, 335, 0,
-  0, 0, 0, 0, 0, 336, 0, 0, 337, 0,
-  -1571, -1571, 338, 0, -1571, -1571, 0, 339, 0, 0,
-  0, 340, 0, 341, 0, 0, 0, 0, 0, 0,
+  -1573, 0, 0, 0, 310, 311, 0, 0, 0, 0,
+  0, 0, 0, -1573, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, -1573, 0, 312, 0, 0, 0, 0,
+  313, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 314, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1573, 0, 0, 0, 0, 0, 0, 315, 0, 316,
+  0, 0, 317, 0, 318, 319, 320, 0, 321, 0,
+  0, 322, 0, 0, 0, 323, 324, 0, 0, 325,
+  0, 0, 0, 326, 327, 0, 328, 0, 0, 0,
+  0, 0, 0, 0, 329, 330, 0, 0, 331, 0,
+  0, 0, 0, -1573, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 332, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 342, 343, 0, 0, 0,
-  344, 345, 346, 347, 348, 349, 0, 0, 0, 350,
-  351, 352, 353, 0, 0, 0, 0, 0, 0, 354,
-  0, 0, 355, 356, 357, 0, 0, 0, 358, 0,
-  0, 0, 359, 0, 0, 360, 0, 0, 0, 0,
+  0, 0, 0, 0, 334, 0, 0, 0, 0, 0,
+  335, 0, 0, 0, 0, 0, 0, 336, 0, 0,
+  337, 0, -1573, -1573, 338, 0, -1573, -1573, 0, 339,
+  0, 0, 0, 340, 0, 341, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 361, 0, 0, 362,
+  0, 0, 0, 0, 0, 0, 0, 342, 343, 0,
+  0, 0, 344, 345, 346, 347, 348, 349, 0, 0,
+  0, 350, 351, 352, 353, 0, 0, 0, 0, 0,
+  0, 354, 0, 0, 355, 356, 357, 0, 0, 0,
+  358, 0, 0, 0, 359, 0, 0, 360, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 361, 0,
+  0, 362, 363, 364, 365, 366, 367, 368, 369, 370,
+  371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+  381, 382, 383, 384, 385, 0, 0, 0, 0, 0,
+  0, 386, 0, 92, 387, 94, 95, 96, 388, 389,
+  390, 100, 101, 102, 391, 392, 393, 106, 394, 108,
+  109, 110, 111, 112, 395, 396, 397, 116, 398, 399,
+  119, 400, 121, 122, 123, 124, 125, 401, 127, 128,
+  129, 130, 131, 132, 133, 402, 135, 136, 137, 403,
+  139, 140, 141, 142, 143, 404, 145, 0, 146, 147,
+  148, 405, 406, 407, 408, 153, 154, 155, 156, 409,
+  158, 159, 160, 0, 161, 162, 163, 0, 410, 411,
+  166, 167, 168, 169, 170, 171, 172, 173, 412, 413,
+  414, 177, 178, 179, 180, 181, 415, 183, 184, 185,
+  186, 187, 188, 189, 190, 191, 416, 193, 194, 195,
+  196, 0, 197, 198, 199, 200, 201, 202, 417, 418,
+  419, 420, 421, 208, 209, 210, 211, 212, 213, 214,
+  215, 216, 422, 218, 423, 424, 425, 222, 223, 224,
+  225, 0, 226, 227, 228, 229, 426, 427, 428, 429,
+  430, 431, 0, 0, 2682, 432, 433, 434, 435, 0,
+  0, 0, 436, 437, -1495, 0, 0, 0, 440, 441,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -1495, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1702, 304,
+  305, 306, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 311, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1495, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -1495, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -1495, 0, 0,
+  257, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 259, 0, 328, 0, 0, 0, 0, 0,
+  -1495, 0, 329, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 992, 0, 0, 0, 0, -1495, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -1495, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 265, 0, 0,
+  1076, 0, 0, 267, -1495, -1495, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -1495, -1495, 0, 0, 0, -1495, -1495, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1703,
+  1704, 352, 353, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 356, 0, 0, 0, 0, 358, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1171, 0, 0, 362,
   363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
   373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
-  383, 384, 385, 0, 0, 0, 0, 0, 0, 386,
-  0, 92, 387, 94, 95, 96, 388, 389, 390, 100,
-  101, 102, 391, 392, 393, 106, 394, 108, 109, 110,
-  111, 112, 395, 396, 397, 116, 398, 399, 119, 400,
-  121, 122, 123, 124, 125, 401, 127, 128, 129, 130,
-  131, 132, 133, 402, 135, 136, 137, 403, 139, 140,
-  141, 142, 143, 404, 145, 0, 146, 147, 148, 405,
-  406, 407, 408, 153, 154, 155, 156, 409, 158, 159,
-  160, 0, 161, 162, 163, 0, 410, 411, 166, 167,
-  168, 169, 170, 171, 172, 173, 412, 413, 414, 177,
-  178, 179, 180, 181, 415, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 416, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 417, 418, 419, 420,
-  421, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  422, 218, 423, 424, 425, 222, 223, 224, 225, 0,
-  226, 227, 228, 229, 426, 427, 428, 429, 430, 431,
-  0, 0, 2680, 432, 433, 434, 435, 0, 0, 0,
-  436, 437, -1493, 0, 0, 0, 440, 441, 0, 0,
+  383, 384, 385, 0, 0, -1495, -1495, -1495, 0, 386,
+  92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+  102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+  122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+  132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+  142, 143, 144, 145, 958, 146, 147, 148, 149, 150,
+  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+  0, 161, 162, 163, 0, 164, 165, 166, 167, 168,
+  169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+  179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+  189, 190, 191, 192, 193, 194, 195, 196, 0, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+  218, 219, 220, 221, 222, 223, 224, 225, 0, 226,
+  227, 228, 229, 0, 426, 427, 428, 429, 430, 431,
+  1077, 0, 0, 432, 433, 434, 435, 0, -1495, 0,
+  848, 0, 992, 0, 1705, 0, 440, 441, 0, 0,
+  0, 0, -1495, -1495, -1495, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1076,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1493, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1700, 304, 305, 306,
+  0, 0, 0, 0, 0, 92, 93, 94, 95, 96,
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+  107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+  117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+  127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+  137, 138, 139, 140, 141, 142, 143, 144, 145, 0,
+  146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+  156, 157, 158, 159, 160, 0, 161, 162, 163, 0,
+  164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+  174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+  194, 195, 196, 0, 197, 198, 199, 200, 201, 202,
+  203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+  213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+  223, 224, 225, 958, 226, 227, 228, 229, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1172, 0, 992, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 311, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1076, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1493, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1493, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1493, 0, 0, 257, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1077,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  259, 0, 328, 0, 0, 0, 0, 0, -1493, 0,
-  329, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 991, 0, 0, 0, 0, -1493, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1493, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 265, 0, 0, 1074, 0,
-  0, 267, -1493, -1493, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1493, -1493, 0, 0, 0, -1493, -1493, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1701, 1702, 352,
-  353, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 356, 0, 0, 0, 0, 358, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1169, 0, 0, 362, 363, 364,
-  365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
-  375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
-  385, 0, 0, -1493, -1493, -1493, 0, 386, 92, 93,
+  0, 0, 0, 0, 92, 93, 94, 95, 96, 97,
+  98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+  108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+  118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+  138, 139, 140, 141, 142, 143, 144, 145, 958, 146,
+  147, 148, 149, 150, 151, 152, 153, 154, 155, 156,
+  157, 158, 159, 160, 0, 161, 162, 163, 0, 164,
+  165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+  175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+  185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+  195, 196, 0, 197, 198, 199, 200, 201, 202, 203,
+  204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
+  214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+  224, 225, 0, 226, 227, 228, 229, 0, 0, 0,
+  0, 0, 0, 0, 1077, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1078, 0, 992, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1076, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 92,
+  93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+  103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+  123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+  133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 145, 0, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 0,
+  161, 162, 163, 0, 164, 165, 166, 167, 168, 169,
+  170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+  180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+  190, 191, 192, 193, 194, 195, 196, 0, 197, 198,
+  199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+  219, 220, 221, 222, 223, 224, 225, 958, 226, 227,
+  228, 229, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1078,
+  0, 992, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1076, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1077, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 92, 93,
   94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
   104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
   114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
   124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
   134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
-  144, 145, 957, 146, 147, 148, 149, 150, 151, 152,
-  153, 154, 155, 156, 157, 158, 159, 160, 0, 161,
+  144, 145, 958, 146, 147, 148, 149, 150, 151, 152,
+  153, 154, 155, 156, 157, 158, 159, 160, 1444, 161,
   162, 163, 0, 164, 165, 166, 167, 168, 169, 170,
   171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
   181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
@@ -4681,12 +4793,12 @@ static const short int yytable[] = {
   200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
   210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
   220, 221, 222, 223, 224, 225, 0, 226, 227, 228,
-  229, 0, 426, 427, 428, 429, 430, 431, 1075, 0,
-  0, 432, 433, 434, 435, 0, -1493, 0, 847, 0,
-  991, 0, 1703, 0, 440, 441, 0, 0, 0, 0,
-  -1493, -1493, -1493, 0, 0, 0, 0, 0, 0, 0,
+  229, 0, 0, 0, 0, 0, 0, 0, 1077, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1172, 0,
+  992, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1074, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -4704,48 +4816,9 @@ static const short int yytable[] = {
   196, 0, 197, 198, 199, 200, 201, 202, 203, 204,
   205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
   215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
-  225, 957, 226, 227, 228, 229, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1170, 0, 991, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1074, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1075, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 92, 93, 94, 95, 96, 97, 98, 99,
-  100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
-  110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
-  120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
-  130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
-  140, 141, 142, 143, 144, 145, 957, 146, 147, 148,
-  149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
-  159, 160, 0, 161, 162, 163, 0, 164, 165, 166,
-  167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
-  177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
-  187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
-  0, 197, 198, 199, 200, 201, 202, 203, 204, 205,
-  206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
-  216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
-  0, 226, 227, 228, 229, 0, 0, 0, 0, 0,
-  0, 0, 1075, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1076, 0, 991, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  225, 958, 226, 227, 228, 229, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1074, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 92, 93, 94,
+  0, 0, 0, 1172, 0, 0, 0, 92, 93, 94,
   95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
   105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
   115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
@@ -4759,79 +4832,59 @@ static const short int yytable[] = {
   192, 193, 194, 195, 196, 0, 197, 198, 199, 200,
   201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
   211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
-  221, 222, 223, 224, 225, 957, 226, 227, 228, 229,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1076, 0, 991,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1074, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  221, 222, 223, 224, 225, 0, 226, 227, 228, 229,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 92, 93, 94, 95, 96, 97, 98, 99,
+  100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+  110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+  130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+  140, 141, 142, 143, 144, 145, 0, 146, 147, 148,
+  149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+  159, 160, 0, 161, 162, 163, 0, 164, 165, 166,
+  167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+  177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
+  187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+  0, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+  206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+  216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+  0, 226, 227, 228, 229, 244, 0, 245, 0, 0,
+  0, 246, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 993, 247, 0, 0, 0, 248, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1075, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 249, 250, 251,
+  252, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 253, 0, 0, 0, 0, 0,
+  0, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 255, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 256,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 257,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 258,
+  0, 259, 260, 0, 0, 261, 0, 262, 0, 0,
+  0, 0, 0, 263, 264, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 92, 93, 94, 95,
-  96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
-  106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
-  116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
-  126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
-  136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
-  957, 146, 147, 148, 149, 150, 151, 152, 153, 154,
-  155, 156, 157, 158, 159, 160, 1442, 161, 162, 163,
-  0, 164, 165, 166, 167, 168, 169, 170, 171, 172,
-  173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
-  183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
-  193, 194, 195, 196, 0, 197, 198, 199, 200, 201,
-  202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
-  212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
-  222, 223, 224, 225, 0, 226, 227, 228, 229, 0,
-  0, 0, 0, 0, 0, 0, 1075, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1170, 0, 991, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 265, 266, 0, 0,
+  0, 0, 267, 268, 0, 0, 0, 0, 0, 0,
+  0, 269, 0, 0, 0, 0, 0, 0, 0, 0,
+  270, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 271, 272,
+  273, 274, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 275, 0, 0, 0,
+  0, 276, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 92, 93, 94, 95, 96, 97, 98, 99, 100,
-  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
-  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
-  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
-  141, 142, 143, 144, 145, 0, 146, 147, 148, 149,
-  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-  160, 0, 161, 162, 163, 0, 164, 165, 166, 167,
-  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
-  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
-  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  217, 218, 219, 220, 221, 222, 223, 224, 225, 957,
-  226, 227, 228, 229, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1170, 0, 0, 0, 92, 93, 94, 95, 96,
-  97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
-  107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
-  117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
-  127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
-  137, 138, 139, 140, 141, 142, 143, 144, 145, 0,
-  146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
-  156, 157, 158, 159, 160, 0, 161, 162, 163, 0,
-  164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
-  174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
-  184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
-  194, 195, 196, 0, 197, 198, 199, 200, 201, 202,
-  203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
-  213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
-  223, 224, 225, 0, 226, 227, 228, 229, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
   102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
@@ -4847,50 +4900,82 @@ static const short int yytable[] = {
   198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
   208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
   218, 219, 220, 221, 222, 223, 224, 225, 0, 226,
-  227, 228, 229, 244, 0, 245, 0, 0, 0, 246,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  992, 247, 0, 0, 0, 248, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 249, 250, 251, 252, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 253, 0, 0, 0, 0, 0, 0, 254,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 255, 0, 0, 0, 0, 0,
+  227, 228, 229, 0, 244, 0, 245, 0, 0, 0,
+  246, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1166, 247, 0, 0, 0, 248, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+  0, 0, 0, 0, 0, 0, 249, 250, 251, 252,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 257, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 258, 0, 259,
-  260, 0, 0, 261, 0, 262, 0, 0, 0, 0,
-  0, 263, 264, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 253, 0, 0, 0, 0, 0, 0,
+  254, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 255, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 256, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1429,
+  0, 0, 0, 0, 0, 0, 0, 0, 257, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 258, 0,
+  259, 260, 1430, 0, 261, 0, 262, 0, 0, 0,
+  0, 0, 263, 264, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 265, 266, 0, 0, 0, 0,
-  267, 268, 0, 0, 0, 0, 0, 0, 0, 269,
-  0, 0, 0, 0, 0, 0, 0, 0, 270, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 271, 272, 273, 274,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 275, 0, 0, 0, 0, 276,
+  0, 0, 0, 0, 0, 265, 266, 0, 0, 0,
+  0, 267, 268, 0, 0, 0, 0, 0, 0, 0,
+  269, 0, 0, 0, 0, 0, 0, 0, 0, 270,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 271, 272, 273,
+  274, 0, 0, 0, 0, 0, 992, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 275, 0, 0, 0, 0,
+  276, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  958, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 92,
+  93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+  103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+  123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+  133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 145, 0, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 2386,
+  161, 162, 163, 0, 164, 165, 166, 167, 168, 169,
+  170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+  180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+  190, 191, 192, 193, 194, 195, 196, 0, 197, 198,
+  199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+  219, 220, 221, 222, 223, 224, 225, 958, 226, 227,
+  228, 229, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 692,
+  0, 92, 93, 94, 95, 96, 97, 98, 99, 100,
+  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
+  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
+  141, 142, 143, 144, 145, 1369, 146, 147, 148, 149,
+  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 0, 161, 162, 163, 0, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
+  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
+  217, 218, 219, 220, 221, 222, 223, 224, 225, 0,
+  226, 227, 228, 229, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 92, 93,
   94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
   104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
   114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
   124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
   134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
-  144, 145, 0, 146, 147, 148, 149, 150, 151, 152,
+  144, 145, 1192, 146, 147, 148, 149, 150, 151, 152,
   153, 154, 155, 156, 157, 158, 159, 160, 0, 161,
   162, 163, 0, 164, 165, 166, 167, 168, 169, 170,
   171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
@@ -4899,217 +4984,171 @@ static const short int yytable[] = {
   200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
   210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
   220, 221, 222, 223, 224, 225, 0, 226, 227, 228,
-  229, 0, 244, 0, 245, 0, 0, 0, 246, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1164,
-  247, 0, 0, 0, 248, 0, 0, 0, 0, 0,
+  229, 92, 93, 94, 95, 96, 97, 98, 99, 100,
+  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
+  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
+  141, 142, 143, 144, 145, 0, 146, 147, 148, 149,
+  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 2682, 161, 162, 163, 2387, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
+  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
+  217, 218, 219, 220, 221, 222, 223, 224, 225, 0,
+  226, 227, 228, 229, 0, 0, 0, 92, 93, 94,
+  95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+  105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+  115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
+  125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+  135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+  145, 0, 146, 147, 148, 149, 150, 151, 152, 153,
+  154, 155, 156, 157, 158, 159, 160, 0, 161, 162,
+  163, 0, 164, 165, 166, 167, 168, 169, 170, 171,
+  172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+  182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 0, 197, 198, 199, 200,
+  201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
+  211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+  221, 222, 223, 224, 225, 0, 226, 227, 228, 229,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 92, 93, 94, 95, 96, 97,
+  98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+  108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+  118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+  138, 139, 140, 141, 142, 143, 144, 145, 0, 146,
+  147, 148, 149, 150, 151, 152, 153, 154, 155, 156,
+  157, 158, 159, 160, 0, 161, 162, 163, 0, 164,
+  165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+  175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+  185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+  195, 196, 0, 197, 198, 199, 200, 201, 202, 203,
+  204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
+  214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+  224, 225, 0, 226, 227, 228, 229, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 92, 93, 94,
+  95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+  105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+  115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
+  125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+  135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+  145, 0, 146, 147, 148, 149, 150, 151, 152, 153,
+  154, 155, 156, 157, 158, 159, 160, 0, 161, 162,
+  163, 0, 164, 165, 166, 167, 168, 169, 170, 171,
+  172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+  182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 2302, 197, 198, 199, 200,
+  201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
+  211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+  221, 222, 223, 224, 225, 2303, 226, 227, 228, 229,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 249, 250, 251, 252, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1702, 304, 305, 306, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 253, 0, 0, 0, 0, 0, 0, 254, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 255, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 311, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 256, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1427, 0, 0,
-  0, 0, 0, 0, 0, 0, 257, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 258, 0, 259, 260,
-  1428, 0, 261, 0, 262, 0, 0, 0, 0, 0,
-  263, 264, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 257, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2306, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 259, 0, 328,
+  0, 0, 0, 0, 0, 0, 0, 329, 0, 0,
+  0, 0, 0, 0, -816, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 265, 266, 0, 0, 0, 0, 267,
-  268, 0, 0, 0, 0, 0, 0, 0, 269, 0,
-  0, 0, 0, 0, 0, 0, 0, 270, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 271, 272, 273, 274, 0,
-  0, 0, 0, 0, 991, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 275, 0, 0, 0, 0, 276, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 265, 0, 0, 0, 0, 0, 267, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 957, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 92, 93, 94,
-  95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
-  105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
-  115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
-  125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
-  135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
-  145, 0, 146, 147, 148, 149, 150, 151, 152, 153,
-  154, 155, 156, 157, 158, 159, 160, 2384, 161, 162,
-  163, 0, 164, 165, 166, 167, 168, 169, 170, 171,
-  172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
-  182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
-  192, 193, 194, 195, 196, 0, 197, 198, 199, 200,
-  201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
-  211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
-  221, 222, 223, 224, 225, 957, 226, 227, 228, 229,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 691, 0, 92,
-  93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
-  103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
-  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
-  123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
-  133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
-  143, 144, 145, 1367, 146, 147, 148, 149, 150, 151,
-  152, 153, 154, 155, 156, 157, 158, 159, 160, 0,
-  161, 162, 163, 0, 164, 165, 166, 167, 168, 169,
-  170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
-  180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
-  190, 191, 192, 193, 194, 195, 196, 0, 197, 198,
-  199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
-  209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
-  219, 220, 221, 222, 223, 224, 225, 0, 226, 227,
-  228, 229, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 92, 93, 94, 95,
-  96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
-  106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
-  116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
-  126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
-  136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
-  1190, 146, 147, 148, 149, 150, 151, 152, 153, 154,
-  155, 156, 157, 158, 159, 160, 0, 161, 162, 163,
-  0, 164, 165, 166, 167, 168, 169, 170, 171, 172,
-  173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
-  183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
-  193, 194, 195, 196, 0, 197, 198, 199, 200, 201,
-  202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
-  212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
-  222, 223, 224, 225, 0, 226, 227, 228, 229, 92,
-  93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
-  103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
-  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
-  123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
-  133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
-  143, 144, 145, 0, 146, 147, 148, 149, 150, 151,
-  152, 153, 154, 155, 156, 157, 158, 159, 160, 2680,
-  161, 162, 163, 2385, 164, 165, 166, 167, 168, 169,
-  170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
-  180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
-  190, 191, 192, 193, 194, 195, 196, 0, 197, 198,
-  199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
-  209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
-  219, 220, 221, 222, 223, 224, 225, 0, 226, 227,
-  228, 229, 0, 0, 0, 92, 93, 94, 95, 96,
-  97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
-  107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
-  117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
-  127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
-  137, 138, 139, 140, 141, 142, 143, 144, 145, 0,
-  146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
-  156, 157, 158, 159, 160, 0, 161, 162, 163, 0,
-  164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
-  174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
-  184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
-  194, 195, 196, 0, 197, 198, 199, 200, 201, 202,
-  203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
-  213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
-  223, 224, 225, 0, 226, 227, 228, 229, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 92, 93, 94, 95, 96, 97, 98, 99,
-  100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
-  110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
-  120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
-  130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
-  140, 141, 142, 143, 144, 145, 0, 146, 147, 148,
-  149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
-  159, 160, 0, 161, 162, 163, 0, 164, 165, 166,
-  167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
-  177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
-  187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
-  0, 197, 198, 199, 200, 201, 202, 203, 204, 205,
-  206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
-  216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
-  0, 226, 227, 228, 229, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 92, 93, 94, 95, 96,
-  97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
-  107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
-  117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
-  127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
-  137, 138, 139, 140, 141, 142, 143, 144, 145, 0,
-  146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
-  156, 157, 158, 159, 160, 0, 161, 162, 163, 0,
-  164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
-  174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
-  184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
-  194, 195, 196, 2300, 197, 198, 199, 200, 201, 202,
-  203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
-  213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
-  223, 224, 225, 2301, 226, 227, 228, 229, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1703, 1704, 352, 353, 0, 0,
+  954, 0, 0, 0, 0, 0, 0, 0, 356, 0,
+  0, 0, 0, 358, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1700, 304, 305, 306, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 362, 363, 364, 365, 366, 367,
+  368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+  378, 379, 380, 381, 382, 383, 384, 385, 0, 0,
+  0, 0, 0, 0, 386, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, 1777,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, 0, -319, -319, -319, 0,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, 0, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
+  -319, -319, -319, 0, -319, -319, -319, -319, 0, 426,
+  427, 428, 429, 430, 431, 0, 0, 0, 432, 433,
+  434, 435, 0, 0, 0, 436, 0, 0, 0, 1705,
+  0, 440, 441, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 707, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 311, 0, 0, 0,
+  0, 0, 0, 0, 0, 708, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 257, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 2304, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 259, 0, 328, 0, 0,
-  0, 0, 0, 0, 0, 329, 0, 0, 0, 0,
-  0, 0, -814, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  709, 0, 0, 0, 0, 0, 710, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  265, 0, 0, 0, 0, 0, 267, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1701, 1702, 352, 353, 0, 0, 953, 0,
-  0, 0, 0, 0, 0, 0, 356, 0, 0, 0,
-  0, 358, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 362, 363, 364, 365, 366, 367, 368, 369,
-  370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
-  380, 381, 382, 383, 384, 385, 0, 0, 0, 0,
-  0, 0, 386, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, 1775, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, 0, -319, -319, -319, 0, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, 0, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, -319, -319, -319, -319, -319, -319, -319, -319, -319,
-  -319, 0, -319, -319, -319, -319, 0, 426, 427, 428,
-  429, 430, 431, 0, 0, 0, 432, 433, 434, 435,
-  0, 0, 0, 436, 0, 0, 0, 1703, 0, 440,
-  441, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 706, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 707, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 92, 93, 94, 95, 96, 97,
+  98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+  108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+  118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+  138, 139, 140, 141, 142, 143, 144, 145, 1777, 146,
+  147, 148, 149, 150, 151, 152, 153, 154, 155, 156,
+  157, 158, 159, 160, 0, 161, 162, 163, 0, 164,
+  165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+  175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+  185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+  195, 196, 0, 197, 198, 199, 200, 201, 202, 203,
+  204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
+  214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+  224, 225, 0, 226, 227, 228, 229, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1778, 0, 0, 0, 0, 0,
+  441, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 707, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 708, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1071, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 708, 0,
-  0, 0, 0, 0, 709, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 709,
+  0, 0, 0, 0, 0, 710, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -5118,84 +5157,98 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 92, 93, 94, 95, 96, 97, 98, 99,
-  100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
-  110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
-  120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
-  130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
-  140, 141, 142, 143, 144, 145, 1775, 146, 147, 148,
-  149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
-  159, 160, 0, 161, 162, 163, 0, 164, 165, 166,
-  167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
-  177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
-  187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
-  0, 197, 198, 199, 200, 201, 202, 203, 204, 205,
-  206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
-  216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
-  0, 226, 227, 228, 229, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1776, 0, 0, 0, 0, 0, 441, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  706, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 92, 93, 94, 95, 96, 97, 98,
+  99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+  109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+  119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+  129, 130, 131, 132, 133, 134, 135, 136, 137, 138,
+  139, 140, 141, 142, 143, 144, 145, 0, 146, 147,
+  148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+  158, 159, 160, 0, 161, 162, 163, 0, 164, 165,
+  166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+  186, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+  196, 0, 197, 198, 199, 200, 201, 202, 203, 204,
+  205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+  215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+  225, 0, 226, 227, 228, 229, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 707, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1069, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 386, 441,
+  92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+  102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+  122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+  132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+  142, 143, 144, 145, 0, 146, 147, 148, 149, 150,
+  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+  0, 161, 162, 163, 0, 164, 165, 166, 167, 168,
+  169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+  179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+  189, 190, 191, 192, 193, 194, 195, 196, 0, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+  218, 219, 220, 221, 222, 223, 224, 225, 0, 226,
+  227, 228, 229, 0, 0, 244, 0, 245, 0, 0,
+  0, 246, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 247, 0, 440, 441, 248, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2583, 0, 0, 0, 0, 249, 250, 251,
+  252, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 253, 0, 0, 0, 0, 0,
+  0, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 255, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 708, 0, 0,
-  0, 0, 0, 709, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 256,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 257,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 258,
+  0, 259, 260, 0, 0, 261, 0, 262, 0, 0,
+  0, 0, 0, 263, 264, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 265, 266, 0, 0,
+  0, 0, 267, 268, 0, 0, 0, 0, 0, 0,
+  0, 269, 0, 0, 0, 0, 0, 0, 0, 0,
+  270, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 271, 272,
+  273, 274, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 275, 0, 0, 0,
+  0, 276, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 92, 93, 94, 95, 96, 97, 98, 99, 100,
-  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
-  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
-  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
-  141, 142, 143, 144, 145, 0, 146, 147, 148, 149,
-  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-  160, 0, 161, 162, 163, 0, 164, 165, 166, 167,
-  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
-  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
-  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  217, 218, 219, 220, 221, 222, 223, 224, 225, 0,
-  226, 227, 228, 229, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 386, 441, 92, 93,
-  94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
-  104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
-  114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
-  124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
-  134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
-  144, 145, 0, 146, 147, 148, 149, 150, 151, 152,
-  153, 154, 155, 156, 157, 158, 159, 160, 0, 161,
-  162, 163, 0, 164, 165, 166, 167, 168, 169, 170,
-  171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
-  181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
-  191, 192, 193, 194, 195, 196, 0, 197, 198, 199,
-  200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
-  210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
-  220, 221, 222, 223, 224, 225, 0, 226, 227, 228,
-  229, 0, 0, 244, 0, 245, 0, 0, 0, 246,
+  92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+  102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+  122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+  132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+  142, 143, 144, 145, 0, 146, 147, 148, 149, 150,
+  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+  0, 161, 162, 163, 0, 164, 165, 166, 167, 168,
+  169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+  179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+  189, 190, 191, 192, 193, 194, 195, 196, 0, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+  218, 219, 220, 221, 222, 223, 224, 225, 0, 226,
+  227, 228, 229, 244, 0, 245, 0, 0, 0, 246,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 247, 0, 440, 441, 248, 0, 0, 0, 0,
+  0, 247, 0, 0, 0, 248, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  2581, 0, 0, 0, 0, 249, 250, 251, 252, 0,
+  2769, 0, 0, 0, 0, 249, 250, 251, 252, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 253, 0, 0, 0, 0, 0, 0, 254,
@@ -5246,7 +5299,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 247,
   0, 0, 0, 248, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 2767, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 249, 250, 251, 252, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -5295,7 +5348,7 @@ static const short int yytable[] = {
   212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
   222, 223, 224, 225, 0, 226, 227, 228, 229, 244,
   0, 245, 0, 0, 0, 246, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 247, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2135, 0, 0,
   0, 248, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -5311,8 +5364,8 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 257, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 258, 0, 259, 260, 0, 0, 261,
-  0, 262, 0, 0, 0, 0, 0, 263, 264, 0,
+  0, 0, 0, 258, 0, 259, 260, 0, 0, 2136,
+  0, 2137, 0, 0, 0, 0, 0, 263, 264, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -5347,7 +5400,7 @@ static const short int yytable[] = {
   214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
   224, 225, 0, 226, 227, 228, 229, 244, 0, 245,
   0, 0, 0, 246, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 2133, 0, 0, 0, 248,
+  0, 0, 0, 0, 0, 247, 0, 0, 0, 248,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 249,
@@ -5363,7 +5416,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 257, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 258, 0, 259, 260, 0, 0, 2134, 0, 2135,
+  0, 258, 0, 259, 260, 0, 0, 261, 0, 262,
   0, 0, 0, 0, 0, 263, 264, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -5384,7 +5437,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 92, 93, 94, 95, 96, 97, 98, 99,
-  100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+  100, 101, 102, 103, 104, 105, 106, 107, 108, 2599,
   110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
   120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
   130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
@@ -5436,7 +5489,7 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
-  102, 103, 104, 105, 106, 107, 108, 2597, 110, 111,
+  102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
   112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
   122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
   132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
@@ -5448,270 +5501,218 @@ static const short int yytable[] = {
   189, 190, 191, 192, 193, 194, 195, 196, 0, 197,
   198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
   208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
-  218, 219, 220, 221, 222, 223, 224, 225, 0, 226,
-  227, 228, 229, 244, 0, 245, 0, 0, 0, 246,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 247, 0, 0, 0, 248, 0, 0, 0, 0,
+  218, 219, 220, 221, 222, 223, 224, 225, -337, 226,
+  227, 228, 229, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2372, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 249, 250, 251, 252, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 253, 0, 0, 0, 0, 0, 0, 254,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 255, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, -337, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+  0, 0, 0, 0, 0, 2053, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 257, 0, 0,
+  0, 0, 2054, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 258, 0, 259,
-  260, 0, 0, 261, 0, 262, 0, 0, 0, 0,
-  0, 263, 264, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 265, 266, 0, 0, 0, 0,
-  267, 268, 0, 0, 0, 0, 0, 0, 0, 269,
-  0, 0, 0, 0, 0, 0, 0, 0, 270, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 271, 272, 273, 274,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 275, 0, 0, 0, 0, 276,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 92, 93,
-  94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
-  104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
-  114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
-  124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
-  134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
-  144, 145, 0, 146, 147, 148, 149, 150, 151, 152,
-  153, 154, 155, 156, 157, 158, 159, 160, 0, 161,
-  162, 163, 0, 164, 165, 166, 167, 168, 169, 170,
-  171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
-  181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
-  191, 192, 193, 194, 195, 196, 0, 197, 198, 199,
-  200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
-  210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
-  220, 221, 222, 223, 224, 225, -337, 226, 227, 228,
-  229, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  2370, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -337, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -337, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 2051, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, -331, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  2052, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -337, 0,
+  -337, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, -331, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, -331, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -331, 0, 0, 0, 0, 0,
+  -331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 92, 93, 94, 95, 96, 97,
+  98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+  108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+  118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+  138, 139, 140, 141, 142, 143, 144, 145, -331, 146,
+  147, 148, 149, 150, 151, 152, 153, 154, 155, 156,
+  157, 158, 159, 160, 0, 161, 162, 163, 0, 164,
+  165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+  175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+  185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+  195, 196, 0, 197, 198, 199, 200, 201, 202, 203,
+  204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
+  214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+  224, 225, 0, 226, 227, 228, 229, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, -331, 0,
+  0, 0, 0, 0, -334, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -337, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -331,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -331, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -331, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 92, 93, 94, 95, 96, 97, 98, 99,
-  100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
-  110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
-  120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
-  130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
-  140, 141, 142, 143, 144, 145, -331, 146, 147, 148,
-  149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
-  159, 160, 0, 161, 162, 163, 0, 164, 165, 166,
-  167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
-  177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
-  187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
-  0, 197, 198, 199, 200, 201, 202, 203, 204, 205,
-  206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
-  216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
-  0, 226, 227, 228, 229, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -331, 0, 0, 0,
-  0, 0, -334, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -331, -331, -331, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
+  -331, -331, -331, -331, -331, -331, 0, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
-  -331, -331, -331, -331, 0, -331, -331, -331, -331, -331,
+  -331, -331, -155, -331, -331, -331, 0, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
-  -155, -331, -331, -331, 0, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
-  -331, -331, -331, -331, -331, -331, -331, -331, 0, -331,
+  0, -331, -331, -331, -331, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
   -331, -331, -331, -331, -331, -331, -331, -331, -331, -331,
-  -331, -331, -331, -331, -331, -331, -331, -331, 0, -331,
-  -331, -331, -331, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 78, 0,
-  -328, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 79, 0, 0, 0,
+  0, -331, -331, -331, -331, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  78, 0, -328, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 79, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 2742, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 2370, 0, 0, 0, 0,
-  0, 0, 0, 0, -155, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 80, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2744, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2372, 0, 0,
+  0, 0, 0, 0, 0, 0, -155, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 80, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 2051, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -155, 0, 0, 0, 0, 2052, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 81, 0, 0, 0, 0,
-  0, -164, 0, 0, 0, 0, 0, 0, 0, 82,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 83,
-  84, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2053, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, -155, 0, 0, 0, 0, 2054, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+  0, 0, 0, -164, 0, 0, 0, 0, 0, 0,
+  0, 82, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 83, 84, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -155, -155, -155, -155, -155,
-  -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -155, -155, -155,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
-  -155, -155, -155, -155, -155, -155, -155, -155, -155, 0,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
-  -155, -155, -155, -155, -155, 0, -155, -155, -155, 0,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
+  -155, 0, -155, -155, -155, -155, -155, -155, -155, -155,
+  -155, -155, -155, -155, -155, -155, -155, 0, -155, -155,
+  -155, 0, -155, -155, -155, -155, -155, -155, -155, -155,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
-  -155, 85, -155, 0, -155, -155, -155, -155, -155, -155,
+  -155, -155, -155, 85, -155, 0, -155, -155, -155, -155,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
   -155, -155, -155, -155, -155, -155, -155, -155, -155, -155,
-  -155, -155, -155, 0, -155, -155, -155, -155, 0, 0,
-  0, 0, 0, 0, -155, -155, -155, 92, 93, 94,
-  95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
-  105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
-  115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
-  125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
-  135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
-  145, 0, 146, 147, 148, 149, 150, 151, 152, 153,
-  154, 155, 156, 157, 158, 159, 160, 0, 161, 162,
-  163, 0, 164, 165, 166, 167, 168, 169, 170, 171,
-  172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
-  182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
-  192, 193, 194, 195, 196, 0, 197, 198, 199, 200,
-  201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
-  211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
-  221, 222, 223, 224, 225, 0, 226, 227, 228, 229,
-  1700, 304, 305, 306, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 311, 0, 0, 0, 0,
+  -155, -155, -155, -155, -155, 0, -155, -155, -155, -155,
+  0, 0, 0, 0, 0, 0, -155, -155, -155, 92,
+  93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+  103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+  123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+  133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 145, 0, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 0,
+  161, 162, 163, 0, 164, 165, 166, 167, 168, 169,
+  170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+  180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+  190, 191, 192, 193, 194, 195, 196, 0, 197, 198,
+  199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+  219, 220, 221, 222, 223, 224, 225, 0, 226, 227,
+  228, 229, 1702, 304, 305, 306, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1700, 304, 305, 306, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 311, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 257, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 311,
-  0, 0, 0, 0, 259, 0, 328, 0, 0, 0,
-  0, 0, 0, 0, 329, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1702, 304, 305, 306,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 257, 0, 0, 0,
+  0, 0, 0, 0, 257, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 259, 265,
-  328, 0, 0, 0, 0, 267, 0, 0, 329, 0,
+  0, 311, 0, 0, 0, 0, 259, 0, 328, 0,
+  0, 0, 0, 0, 0, 0, 329, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 2370, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1701, 1702, 352, 353, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 356, 0, 0, 0, 0,
-  358, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 265, 0, 0, 0, 0, 0, 267,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 362, 363, 364, 365, 366, 367, 368, 369, 370,
-  371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
-  381, 382, 383, 384, 385, 1701, 1702, 352, 353, 2051,
-  0, 386, 0, 0, 0, 0, 0, 0, 0, 356,
-  0, 0, 0, 0, 358, 0, 2052, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 257, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 362, 363, 364, 365, 366,
-  367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
-  377, 378, 379, 380, 381, 382, 383, 384, 385, 0,
-  0, 0, 0, 0, 0, 386, 0, 0, 0, 0,
+  259, 265, 328, 0, 0, 0, 0, 267, 0, 0,
+  329, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2372, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1703, 1704, 352, 353, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 356, 0, 0,
+  0, 0, 358, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 265, 0, 0, 0, 0,
+  0, 267, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 362, 363, 364, 365, 366, 367, 368,
+  369, 370, 371, 372, 373, 374, 375, 376, 377, 378,
+  379, 380, 381, 382, 383, 384, 385, 1703, 1704, 352,
+  353, 2053, 0, 386, 0, 0, 0, 0, 0, 0,
+  0, 356, 0, 0, 0, 0, 358, 0, 2054, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 362, 363, 364,
+  365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+  375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
+  385, 0, 0, 0, 0, 0, 0, 386, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 426, 427, 428, 429,
-  430, 431, 0, 0, 0, 432, 433, 434, 435, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 440, 441,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 426, 427,
+  428, 429, 430, 431, 0, 0, 0, 432, 433, 434,
+  435, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  440, 441, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  426, 427, 428, 429, 430, 431, 0, 0, 0, 432,
-  433, 434, 435, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 440, 0, 0, 0, 0, 0, 92, 93,
-  94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
-  104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
-  114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
-  124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
-  134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
-  144, 145, 0, 146, 147, 148, 149, 150, 151, 152,
-  153, 154, 155, 156, 157, 158, 159, 160, 0, 161,
-  162, 163, 0, 164, 165, 166, 167, 168, 169, 170,
-  171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
-  181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
-  191, 192, 193, 194, 195, 196, 0, 197, 198, 199,
-  200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
-  210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
-  220, 221, 222, 223, 224, 225, 706, 226, 227, 228,
-  229, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 707, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 426, 427, 428, 429, 430, 431, 0, 0,
+  0, 432, 433, 434, 435, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 440, 0, 0, 0, 0, 0,
+  92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+  102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+  122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+  132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+  142, 143, 144, 145, 0, 146, 147, 148, 149, 150,
+  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+  0, 161, 162, 163, 0, 164, 165, 166, 167, 168,
+  169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+  179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+  189, 190, 191, 192, 193, 194, 195, 196, 0, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+  218, 219, 220, 221, 222, 223, 224, 225, 707, 226,
+  227, 228, 229, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  708, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 708, 0, 0, 0, 0, 0, 709,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 709, 0, 0, 0, 0,
+  0, 710, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -5722,32 +5723,32 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 92, 93, 94,
-  95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
-  105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
-  115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
-  125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
-  135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
-  145, 0, 146, 147, 148, 149, 150, 151, 152, 153,
-  154, 155, 156, 157, 158, 159, 160, 0, 161, 162,
-  163, 0, 164, 165, 166, 167, 168, 169, 170, 171,
-  172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
-  182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
-  192, 193, 194, 195, 196, 0, 197, 198, 199, 200,
-  201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
-  211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
-  221, 222, 223, 224, 225, 0, 226, 227, 228, 229,
-  706, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 710, 0, 0,
-  0, 0, 707, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 92,
+  93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+  103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+  123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+  133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 145, 0, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 0,
+  161, 162, 163, 0, 164, 165, 166, 167, 168, 169,
+  170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+  180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+  190, 191, 192, 193, 194, 195, 196, 0, 197, 198,
+  199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+  219, 220, 221, 222, 223, 224, 225, 0, 226, 227,
+  228, 229, 707, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 711,
+  0, 0, 0, 0, 708, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 708, 0, 0,
-  0, 0, 0, 709, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 709,
+  0, 0, 0, 0, 0, 710, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -5755,48 +5756,64 @@ static const short int yytable[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 957, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 958, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 92, 93, 94, 95, 96, 97, 98, 99, 100,
-  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
-  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
-  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
-  141, 142, 143, 144, 145, 0, 146, 147, 148, 149,
-  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-  160, 0, 161, 162, 163, 0, 164, 165, 166, 167,
-  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
-  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
-  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  217, 218, 219, 220, 221, 222, 223, 224, 225, 0,
-  226, 227, 228, 229, 92, 93, 94, 95, 96, 97,
-  98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
-  108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
-  118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
-  128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
-  138, 139, 140, 141, 142, 143, 144, 145, 0, 146,
-  147, 148, 149, 150, 151, 152, 153, 154, 155, 156,
-  157, 158, 159, 160, 558, 161, 162, 163, 0, 164,
-  165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
-  175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
-  185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
-  195, 196, 0, 197, 198, 199, 200, 201, 202, 203,
-  204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
-  214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
-  224, 225, 0, 226, 227, 228, 229, 0, 0, 0,
+  0, 0, 0, 92, 93, 94, 95, 96, 97, 98,
+  99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+  109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+  119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+  129, 130, 131, 132, 133, 134, 135, 136, 137, 138,
+  139, 140, 141, 142, 143, 144, 145, 0, 146, 147,
+  148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+  158, 159, 160, 0, 161, 162, 163, 0, 164, 165,
+  166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+  186, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+  196, 0, 197, 198, 199, 200, 201, 202, 203, 204,
+  205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+  215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+  225, 0, 226, 227, 228, 229, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+  106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+  116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+  126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+  0, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+  155, 156, 157, 158, 159, 160, 558, 161, 162, 163,
+  0, 164, 165, 166, 167, 168, 169, 170, 171, 172,
+  173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+  183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+  193, 194, 195, 196, 0, 197, 198, 199, 200, 201,
+  202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+  212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+  222, 223, 224, 225, 0, 226, 227, 228, 229, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  559, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 559, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 92, 93, 94, 95, 96, 97, 98,
+  0, 0, 0, 0, 0, 92, 93, 94, 95, 96,
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+  107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+  117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+  127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+  137, 138, 139, 140, 141, 142, 143, 144, 145, 0,
+  146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+  156, 157, 158, 159, 160, 0, 161, 162, 163, 0,
+  164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+  174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+  194, 195, 196, 0, 197, 198, 199, 200, 201, 202,
+  203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+  213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+  223, 224, 225, 0, 226, 227, 228, 229, 426, 0,
+  428, 429, 0, 0, 0, 0, 0, 432, 433, 434,
+  435, 1042, 0, 92, 93, 94, 95, 96, 97, 98,
   99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
   109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
   119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
@@ -5810,58 +5827,26 @@ static const short int yytable[] = {
   196, 0, 197, 198, 199, 200, 201, 202, 203, 204,
   205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
   215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
-  225, 0, 226, 227, 228, 229, 426, 0, 428, 429,
-  0, 0, 0, 0, 0, 432, 433, 434, 435, 1040,
-  0, 92, 93, 94, 95, 96, 97, 98, 99, 100,
-  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
-  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
-  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
-  141, 142, 143, 144, 145, 0, 146, 147, 148, 149,
-  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-  160, 0, 161, 162, 163, 0, 164, 165, 166, 167,
-  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
-  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
-  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  217, 218, 219, 220, 221, 222, 223, 224, 225, 0,
-  226, 227, 228, 229, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1041, 441, 92, 93,
-  94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
-  104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
-  114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
-  124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
-  134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
-  144, 145, 0, 146, 147, 148, 149, 150, 151, 152,
-  153, 154, 155, 156, 157, 158, 159, 160, 0, 161,
-  162, 163, 0, 164, 165, 166, 167, 168, 169, 170,
-  171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
-  181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
-  191, 192, 193, 194, 195, 196, 0, 197, 198, 199,
-  200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
-  210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
-  220, 221, 222, 223, 224, 225, 0, 226, 227, 228,
-  229, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  225, 0, 226, 227, 228, 229, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1856, 92, 93, 94, 95, 96, 97, 98, 99, 100,
-  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
-  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
-  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
-  141, 142, 143, 144, 145, 0, 146, 147, 148, 149,
-  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-  160, 0, 161, 162, 163, 0, 164, 165, 166, 167,
-  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
-  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
-  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  217, 218, 219, 220, 221, 222, 223, 224, 225, 0,
-  226, 227, 228, 229, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1043, 441,
+  92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+  102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+  122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+  132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+  142, 143, 144, 145, 0, 146, 147, 148, 149, 150,
+  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+  0, 161, 162, 163, 0, 164, 165, 166, 167, 168,
+  169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+  179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+  189, 190, 191, 192, 193, 194, 195, 196, 0, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+  218, 219, 220, 221, 222, 223, 224, 225, 0, 226,
+  227, 228, 229, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 2253, 92, 93, 94, 95, 96, 97, 98,
+  0, 0, 1858, 92, 93, 94, 95, 96, 97, 98,
   99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
   109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
   119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
@@ -5877,7 +5862,7 @@ static const short int yytable[] = {
   215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
   225, 0, 226, 227, 228, 229, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 3194, 92, 93, 94, 95, 96,
+  0, 0, 0, 0, 2255, 92, 93, 94, 95, 96,
   97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
   107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
   117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
@@ -5891,24 +5876,9 @@ static const short int yytable[] = {
   194, 195, 196, 0, 197, 198, 199, 200, 201, 202,
   203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
   213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
-  223, 224, 225, 0, 226, 227, 228, 229, 426, 0,
-  428, 429, 0, 0, 0, 0, 0, 432, 433, 434,
-  435, 92, 93, 94, 95, 96, 97, 98, 99, 100,
-  101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
-  111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
-  121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-  131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
-  141, 142, 143, 144, 145, 0, 146, 147, 148, 149,
-  150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-  160, 0, 161, 162, 163, 0, 164, 165, 166, 167,
-  168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
-  178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
-  188, 189, 190, 191, 192, 193, 194, 195, 196, 0,
-  197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
-  207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
-  217, 218, 219, 220, 221, 222, 223, 224, 225, 0,
-  226, 227, 228, 229, 0, 0, 428, 429, 0, 0,
-  0, 0, 0, 432, 433, 434, 435, 92, 93, 94,
+  223, 224, 225, 0, 226, 227, 228, 229, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3196, 92, 93, 94,
   95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
   105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
   115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
@@ -5916,28 +5886,59 @@ static const short int yytable[] = {
   135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
   145, 0, 146, 147, 148, 149, 150, 151, 152, 153,
   154, 155, 156, 157, 158, 159, 160, 0, 161, 162,
-  163, 2795, 164, 165, 166, 167, 168, 169, 170, 171,
+  163, 0, 164, 165, 166, 167, 168, 169, 170, 171,
   172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
   182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
   192, 193, 194, 195, 196, 0, 197, 198, 199, 200,
   201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
   211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
   221, 222, 223, 224, 225, 0, 226, 227, 228, 229,
-  92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
-  102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
-  112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
-  122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
-  132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
-  142, 143, 144, 145, 0, 146, 147, 148, 149, 150,
-  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
-  0, 161, 162, 163, 0, 164, 165, 166, 167, 168,
-  169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
-  179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
-  189, 190, 191, 192, 193, 194, 195, 196, 0, 197,
-  198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
-  208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
-  218, 219, 220, 221, 222, 223, 224, 225, 0, 226,
-  227, 228, 229
+  426, 0, 428, 429, 0, 0, 0, 0, 0, 432,
+  433, 434, 435, 92, 93, 94, 95, 96, 97, 98,
+  99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+  109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+  119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+  129, 130, 131, 132, 133, 134, 135, 136, 137, 138,
+  139, 140, 141, 142, 143, 144, 145, 0, 146, 147,
+  148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+  158, 159, 160, 0, 161, 162, 163, 0, 164, 165,
+  166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+  186, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+  196, 0, 197, 198, 199, 200, 201, 202, 203, 204,
+  205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+  215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+  225, 0, 226, 227, 228, 229, 0, 0, 428, 429,
+  0, 0, 0, 0, 0, 432, 433, 434, 435, 92,
+  93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+  103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+  123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+  133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 145, 0, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 0,
+  161, 162, 163, 2797, 164, 165, 166, 167, 168, 169,
+  170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+  180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+  190, 191, 192, 193, 194, 195, 196, 0, 197, 198,
+  199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+  219, 220, 221, 222, 223, 224, 225, 0, 226, 227,
+  228, 229, 92, 93, 94, 95, 96, 97, 98, 99,
+  100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+  110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+  130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+  140, 141, 142, 143, 144, 145, 0, 146, 147, 148,
+  149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+  159, 160, 0, 161, 162, 163, 0, 164, 165, 166,
+  167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+  177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
+  187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+  0, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+  206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+  216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+  0, 226, 227, 228, 229
 };
 
 /* YYCONFLP[YYPACT[STATE-NUM]] -- Pointer into YYCONFL of start of
@@ -5957,188 +5958,180 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 606, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 606,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 602, 0, 0,
-  0, 0, 0, 0, 652, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 326,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 602,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 652,
+  0, 0, 0, 0, 0, 0, 0, 620, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1266,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 960, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1266, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1654, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 608, 0, 0, 636, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 608, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 962, 0, 0, 0, 385, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1638, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1638, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 950, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 614, 0, 610, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 614, 0, 0, 0,
-  952, 0, 0, 0, 610, 0, 0, 0, 0, 0,
+  0, 0, 0, 950, 0, 0, 0, 0, 952, 656,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1264, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 656, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 620, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1626, 0, 0, 0, 0, 0, 0, 672,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 960,
-  0, 0, 0, 0, 0, 0, 326, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1626, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 644, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  385, 0, 0, 0, 329, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 329, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1654, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 672, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 644, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1264, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  962, 0, 0, 0, 0, 0, 0, 0, 1290, 0,
-  0, 484, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 636, 0, 0,
-  646, 0, 0, 0, 0, 0, 1630, 0, 0, 486,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 570, 542, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 331, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1632, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 572, 0, 0, 0, 1634, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1636, 0, 0, 0, 0, 0, 0, 488, 0, 0,
-  0, 0, 0, 0, 1606, 0, 0, 0, 574, 0,
-  0, 0, 490, 0, 0, 0, 0, 0, 0, 0,
-  0, 1642, 0, 0, 492, 0, 562, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1648, 0, 0,
-  0, 0, 0, 0, 0, 628, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 494, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 333,
-  0, 0, 335, 0, 0, 496, 630, 0, 0, 0,
-  0, 0, 624, 0, 337, 498, 626, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 339, 0,
+  0, 0, 0, 0, 0, 331, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 500, 502, 0, 0, 0, 0, 0, 341, 0,
-  0, 632, 0, 0, 0, 0, 0, 0, 0, 504,
-  506, 0, 0, 0, 508, 510, 0, 534, 536, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 355, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 357, 0, 0, 359, 0, 0, 0,
-  0, 0, 0, 0, 361, 0, 0, 0, 0, 0,
-  0, 363, 0, 538, 540, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 646, 570, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 339, 0, 1630, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 512, 514, 516, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 365, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1632,
+  0, 0, 0, 572, 0, 628, 0, 0, 0, 0,
+  333, 0, 0, 0, 0, 1606, 0, 542, 0, 1634,
+  0, 0, 0, 0, 0, 0, 0, 0, 335, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1636, 0,
+  0, 0, 0, 337, 0, 0, 0, 0, 574, 0,
+  0, 0, 0, 1642, 0, 0, 630, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1290, 0, 0,
+  0, 632, 0, 0, 0, 0, 0, 0, 1648, 0,
+  341, 0, 0, 0, 0, 0, 355, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 302, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 562, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  320, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 367, 0, 0, 369, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 371, 518,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 302, 0, 0, 0, 0, 0, 0, 0, 373,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 357,
+  0, 0, 0, 0, 0, 359, 0, 0, 0, 0,
+  0, 0, 0, 0, 361, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 520, 0, 0, 375,
-  0, 0, 0, 0, 377, 0, 0, 379, 0, 0,
-  0, 383, 0, 0, 387, 522, 0, 524, 0, 0,
-  0, 0, 391, 0, 0, 0, 0, 0, 394, 526,
-  528, 530, 0, 0, 0, 0, 396, 0, 0, 0,
-  398, 0, 400, 402, 404, 0, 0, 0, 406, 0,
-  408, 411, 0, 413, 415, 0, 417, 419, 0, 0,
-  0, 421, 424, 426, 428, 0, 0, 0, 430, 322,
-  432, 0, 434, 436, 324, 438, 441, 0, 443, 445,
-  0, 0, 0, 448, 0, 450, 452, 454, 0, 0,
-  0, 456, 459, 462, 465, 468, 471, 0, 0, 473,
-  476, 479, 0, 0, 0, 0, 0, 532, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 363, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 624,
+  0, 0, 0, 626, 365, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 320, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 367, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 544, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 534, 536, 0, 0,
+  0, 0, 0, 369, 0, 538, 540, 0, 0, 371,
+  0, 0, 0, 0, 0, 0, 0, 373, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 375, 305, 0, 0, 0,
+  0, 0, 0, 0, 377, 0, 0, 0, 0, 0,
+  379, 0, 0, 0, 322, 0, 0, 0, 383, 324,
+  0, 0, 0, 0, 387, 0, 391, 394, 0, 0,
+  396, 0, 0, 398, 400, 0, 0, 402, 0, 0,
+  0, 404, 406, 0, 408, 411, 0, 0, 0, 413,
+  415, 0, 0, 417, 0, 419, 0, 0, 0, 0,
+  0, 421, 0, 0, 0, 0, 424, 426, 428, 0,
+  430, 432, 0, 0, 434, 436, 438, 441, 443, 445,
+  448, 450, 452, 454, 456, 0, 459, 462, 0, 0,
+  465, 468, 471, 473, 476, 479, 0, 0, 0, 532,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 305, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 544, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 564, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  308, 312, 316, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 566, 0, 0, 0, 568, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 564, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 566, 568, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 308, 312, 316, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 616, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 618, 0, 0, 622,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 634,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 616, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  618, 0, 0, 0, 0, 622, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 634,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -6147,68 +6140,76 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 638, 0, 0, 0, 0, 0, 640, 0, 0,
-  0, 642, 0, 0, 0, 0, 0, 0, 0, 0,
-  648, 0, 650, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 654, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 638, 0,
+  0, 0, 0, 640, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 642, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  648, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 650, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 654, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 658, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 668, 0, 0, 0,
-  0, 670, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 658, 0, 0, 0, 0,
+  0, 0, 0, 0, 668, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 670, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 954, 956, 958, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1258, 0,
-  0, 0, 0, 0, 0, 0, 0, 1260, 0, 1262,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1270, 1268, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 954, 956, 958,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1582, 0,
-  0, 0, 0, 0, 0, 0, 0, 1584, 0, 0,
+  0, 0, 0, 1258, 0, 0, 0, 0, 1260, 0,
+  1262, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1586, 1588, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1590, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1592, 0, 1594, 0, 0,
-  0, 0, 1596, 1598, 0, 0, 0, 1600, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1602, 0, 0,
-  1604, 1608, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1610, 0, 0, 1620, 0, 0, 0, 0,
+  0, 0, 0, 0, 1270, 1268, 0, 0, 0, 0,
+  1582, 0, 0, 0, 0, 0, 0, 0, 1584, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1586, 0, 0, 0, 0, 1588, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1624, 1622, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1590, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1592, 0, 0, 0, 1594,
+  1596, 1598, 0, 0, 0, 0, 1600, 0, 0, 0,
+  0, 0, 0, 1602, 0, 1604, 0, 1608, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1620,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1610,
+  0, 0, 0, 0, 484, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1624, 0, 0, 0, 0, 0,
+  0, 0, 0, 1622, 0, 0, 0, 0, 0, 0,
+  0, 0, 486, 0, 0, 0, 0, 0, 0, 0,
   0, 1628, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1640, 0,
-  0, 0, 0, 0, 0, 1644, 0, 0, 0, 1650,
-  0, 0, 1646, 0, 0, 0, 0, 1652, 0, 0,
-  0, 0, 0, 0, 0, 1656, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1658, 0, 0, 0,
-  0, 1660, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1640, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1644, 0,
+  0, 0, 0, 1650, 0, 1646, 0, 0, 0, 0,
+  488, 1652, 0, 0, 0, 0, 0, 0, 0, 1656,
+  0, 0, 0, 0, 0, 490, 0, 1658, 1660, 0,
+  0, 0, 0, 0, 0, 0, 0, 492, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  494, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 496, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 498, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 500, 502, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 504, 506, 0, 0, 0, 508, 510, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -6217,6 +6218,7 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 512, 514, 516, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -6226,10 +6228,15 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 518, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 520,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 522, 0,
+  524, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 526, 528, 530, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -6310,21 +6317,22 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 578, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 580, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 578, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 580, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 582, 0, 0, 0,
+  0, 584, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 582, 0, 0, 0, 0, 584,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -6365,23 +6373,23 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 586, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 588, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 586, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 588, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 590, 0,
+  0, 0, 0, 592, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 590, 0, 0, 0,
-  0, 592, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -6496,12 +6504,12 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  482, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 482, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -6600,13 +6608,13 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 612, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 612, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7254,22 +7262,21 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 594, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 596, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 594,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 596,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 598, 0, 0, 0, 0, 600, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 598,
-  0, 0, 0, 0, 600, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7281,29 +7288,29 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 660, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 662, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 660, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 662, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 664, 0,
+  0, 0, 0, 666, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 664, 0, 0, 0,
-  0, 666, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 343, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 343,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7311,27 +7318,27 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 345, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 347, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 349, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 345, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 347, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 349, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 351, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 550, 353,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 351, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 550, 353, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7339,27 +7346,27 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  552, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 554, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 556, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 552, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 554, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 556, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 558, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 560, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 558, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 560, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7422,26 +7429,26 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1272, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1274, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1272, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1274, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1276, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1278, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1280,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1282, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1276, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1278, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1280, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1282, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7515,12 +7522,12 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 576,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 576, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7571,12 +7578,12 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 604, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 604, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7770,35 +7777,35 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1254, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1254,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1256, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1256,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1284, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1286, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1284, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1286, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1288, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1288, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -7831,26 +7838,26 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 674, 676, 678, 680, 682,
+  684, 686, 688, 690, 692, 694, 696, 698, 700, 702,
+  704, 706, 708, 710, 712, 714, 716, 718, 720, 722,
+  724, 726, 728, 730, 732, 734, 736, 738, 740, 742,
+  744, 746, 748, 750, 752, 754, 756, 758, 760, 762,
+  764, 766, 768, 770, 772, 774, 776, 778, 780, 0,
+  782, 784, 786, 788, 790, 792, 794, 796, 798, 800,
+  802, 804, 806, 808, 810, 0, 812, 814, 816, 0,
+  818, 820, 822, 824, 826, 828, 830, 832, 834, 836,
+  838, 840, 842, 844, 846, 848, 850, 852, 854, 856,
+  858, 860, 862, 864, 866, 868, 870, 872, 874, 876,
+  878, 880, 882, 0, 884, 886, 888, 890, 892, 894,
+  896, 898, 900, 902, 904, 906, 908, 910, 912, 914,
+  916, 918, 920, 922, 924, 926, 928, 930, 932, 934,
+  936, 938, 940, 0, 942, 944, 946, 948, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 674, 676, 678, 680, 682, 684, 686,
-  688, 690, 692, 694, 696, 698, 700, 702, 704, 706,
-  708, 710, 712, 714, 716, 718, 720, 722, 724, 726,
-  728, 730, 732, 734, 736, 738, 740, 742, 744, 746,
-  748, 750, 752, 754, 756, 758, 760, 762, 764, 766,
-  768, 770, 772, 774, 776, 778, 780, 0, 782, 784,
-  786, 788, 790, 792, 794, 796, 798, 800, 802, 804,
-  806, 808, 810, 0, 812, 814, 816, 0, 818, 820,
-  822, 824, 826, 828, 830, 832, 834, 836, 838, 840,
-  842, 844, 846, 848, 850, 852, 854, 856, 858, 860,
-  862, 864, 866, 868, 870, 872, 874, 876, 878, 880,
-  882, 0, 884, 886, 888, 890, 892, 894, 896, 898,
-  900, 902, 904, 906, 908, 910, 912, 914, 916, 918,
-  920, 922, 924, 926, 928, 930, 932, 934, 936, 938,
-  940, 0, 942, 944, 946, 948, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -8229,12 +8236,12 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1612, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1612, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -8242,139 +8249,138 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1614, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1616, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1614, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1616, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1618, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 964, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 966, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1618, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 964, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  966, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 968, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 970, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 972, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 968, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 970, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  972, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  974, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1292, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1294, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 974, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1292, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1294, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  976, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1296, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1298, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1300, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 978, 980, 982, 984, 986, 988,
+  990, 992, 994, 996, 998, 1000, 1002, 1004, 1006, 1008,
+  1010, 1012, 1014, 1016, 1018, 1020, 1022, 1024, 1026, 1028,
+  1030, 1032, 1034, 1036, 1038, 1040, 1042, 1044, 1046, 1048,
+  1050, 1052, 1054, 1056, 1058, 1060, 1062, 1064, 1066, 1068,
+  1070, 1072, 1074, 1076, 1078, 1080, 1082, 1084, 1302, 1086,
+  1088, 1090, 1092, 1094, 1096, 1098, 1100, 1102, 1104, 1106,
+  1108, 1110, 1112, 1114, 0, 1116, 1118, 1120, 0, 1122,
+  1124, 1126, 1128, 1130, 1132, 1134, 1136, 1138, 1140, 1142,
+  1144, 1146, 1148, 1150, 1152, 1154, 1156, 1158, 1160, 1162,
+  1164, 1166, 1168, 1170, 1172, 1174, 1176, 1178, 1180, 1182,
+  1184, 1186, 0, 1188, 1190, 1192, 1194, 1196, 1198, 1200,
+  1202, 1204, 1206, 1208, 1210, 1212, 1214, 1216, 1218, 1220,
+  1222, 1224, 1226, 1228, 1230, 1232, 1234, 1236, 1238, 1240,
+  1242, 1244, 0, 1246, 1248, 1250, 1252, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1304, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 976, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1296,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1298, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1300, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 978, 980, 982, 984, 986, 988, 990, 992,
-  994, 996, 998, 1000, 1002, 1004, 1006, 1008, 1010, 1012,
-  1014, 1016, 1018, 1020, 1022, 1024, 1026, 1028, 1030, 1032,
-  1034, 1036, 1038, 1040, 1042, 1044, 1046, 1048, 1050, 1052,
-  1054, 1056, 1058, 1060, 1062, 1064, 1066, 1068, 1070, 1072,
-  1074, 1076, 1078, 1080, 1082, 1084, 1302, 1086, 1088, 1090,
-  1092, 1094, 1096, 1098, 1100, 1102, 1104, 1106, 1108, 1110,
-  1112, 1114, 0, 1116, 1118, 1120, 0, 1122, 1124, 1126,
-  1128, 1130, 1132, 1134, 1136, 1138, 1140, 1142, 1144, 1146,
-  1148, 1150, 1152, 1154, 1156, 1158, 1160, 1162, 1164, 1166,
-  1168, 1170, 1172, 1174, 1176, 1178, 1180, 1182, 1184, 1186,
-  0, 1188, 1190, 1192, 1194, 1196, 1198, 1200, 1202, 1204,
-  1206, 1208, 1210, 1212, 1214, 1216, 1218, 1220, 1222, 1224,
-  1226, 1228, 1230, 1232, 1234, 1236, 1238, 1240, 1242, 1244,
-  0, 1246, 1248, 1250, 1252, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1304, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1306, 1308, 1310, 1312, 1314, 1316, 1318, 1320,
+  1322, 1324, 1326, 1328, 1330, 1332, 1334, 1336, 1338, 1340,
+  1342, 1344, 1346, 1348, 1350, 1352, 1354, 1356, 1358, 1360,
+  1362, 1364, 1366, 1368, 1370, 1372, 1374, 1376, 1378, 1380,
+  1382, 1384, 1386, 1388, 1390, 1392, 1394, 1396, 1398, 1400,
+  1402, 1404, 1406, 1408, 1410, 1412, 0, 1414, 1416, 1418,
+  1420, 1422, 1424, 1426, 1428, 1430, 1432, 1434, 1436, 1438,
+  1440, 1442, 1, 1444, 1446, 1448, 0, 1450, 1452, 1454,
+  1456, 1458, 1460, 1462, 1464, 1466, 1468, 1470, 1472, 1474,
+  1476, 1478, 1480, 1482, 1484, 1486, 1488, 1490, 1492, 1494,
+  1496, 1498, 1500, 1502, 1504, 1506, 1508, 1510, 1512, 1514,
+  0, 1516, 1518, 1520, 1522, 1524, 1526, 1528, 1530, 1532,
+  1534, 1536, 1538, 1540, 1542, 1544, 1546, 1548, 1550, 1552,
+  1554, 1556, 1558, 1560, 1562, 1564, 1566, 1568, 1570, 1572,
+  0, 1574, 1576, 1578, 1580, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1306, 1308, 1310, 1312, 1314, 1316, 1318, 1320, 1322, 1324,
-  1326, 1328, 1330, 1332, 1334, 1336, 1338, 1340, 1342, 1344,
-  1346, 1348, 1350, 1352, 1354, 1356, 1358, 1360, 1362, 1364,
-  1366, 1368, 1370, 1372, 1374, 1376, 1378, 1380, 1382, 1384,
-  1386, 1388, 1390, 1392, 1394, 1396, 1398, 1400, 1402, 1404,
-  1406, 1408, 1410, 1412, 0, 1414, 1416, 1418, 1420, 1422,
-  1424, 1426, 1428, 1430, 1432, 1434, 1436, 1438, 1440, 1442,
-  1, 1444, 1446, 1448, 0, 1450, 1452, 1454, 1456, 1458,
-  1460, 1462, 1464, 1466, 1468, 1470, 1472, 1474, 1476, 1478,
-  1480, 1482, 1484, 1486, 1488, 1490, 1492, 1494, 1496, 1498,
-  1500, 1502, 1504, 1506, 1508, 1510, 1512, 1514, 0, 1516,
-  1518, 1520, 1522, 1524, 1526, 1528, 1530, 1532, 1534, 1536,
-  1538, 1540, 1542, 1544, 1546, 1548, 1550, 1552, 1554, 1556,
-  1558, 1560, 1562, 1564, 1566, 1568, 1570, 1572, 0, 1574,
-  1576, 1578, 1580, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 7, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 9, 12, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 17, 19,
+  21, 23, 25, 27, 29, 31, 33, 35, 37, 39,
+  41, 43, 45, 47, 49, 51, 53, 55, 57, 59,
+  61, 63, 65, 67, 69, 71, 73, 75, 77, 79,
+  81, 83, 85, 87, 89, 91, 93, 95, 97, 99,
+  101, 103, 105, 107, 109, 111, 113, 115, 117, 119,
+  121, 0, 123, 125, 127, 129, 131, 133, 135, 137,
+  139, 141, 143, 145, 147, 149, 151, 0, 153, 155,
+  157, 0, 159, 161, 163, 165, 167, 169, 171, 173,
+  175, 177, 179, 181, 183, 185, 187, 189, 191, 193,
+  195, 197, 199, 201, 203, 205, 207, 209, 211, 214,
+  216, 218, 220, 222, 225, 0, 227, 229, 231, 233,
+  235, 237, 239, 241, 243, 245, 247, 249, 251, 253,
+  255, 257, 259, 261, 263, 265, 267, 269, 271, 273,
+  275, 277, 279, 281, 283, 0, 285, 287, 289, 291,
+  0, 0, 0, 0, 0, 0, 293, 296, 299, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
-  12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 15, 17, 19, 21, 23,
-  25, 27, 29, 31, 33, 35, 37, 39, 41, 43,
-  45, 47, 49, 51, 53, 55, 57, 59, 61, 63,
-  65, 67, 69, 71, 73, 75, 77, 79, 81, 83,
-  85, 87, 89, 91, 93, 95, 97, 99, 101, 103,
-  105, 107, 109, 111, 113, 115, 117, 119, 121, 0,
-  123, 125, 127, 129, 131, 133, 135, 137, 139, 141,
-  143, 145, 147, 149, 151, 0, 153, 155, 157, 0,
-  159, 161, 163, 165, 167, 169, 171, 173, 175, 177,
-  179, 181, 183, 185, 187, 189, 191, 193, 195, 197,
-  199, 201, 203, 205, 207, 209, 211, 214, 216, 218,
-  220, 222, 225, 0, 227, 229, 231, 233, 235, 237,
-  239, 241, 243, 245, 247, 249, 251, 253, 255, 257,
-  259, 261, 263, 265, 267, 269, 271, 273, 275, 277,
-  279, 281, 283, 0, 285, 287, 289, 291, 0, 0,
-  0, 0, 0, 0, 293, 296, 299, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -8651,18 +8657,18 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  546, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 546, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  548, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 548, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -8692,11 +8698,7 @@ static const unsigned short int yyconflp[] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0
+  0, 0, 0, 0, 0
 };
 
 /* YYCONFL[I] -- lists of conflicting rule numbers, each terminated by
@@ -8734,72 +8736,72 @@ static const short int yyconfl[] = {
   0, 158, 0, 158, 164, 0, 158, 164, 0, 158,
   164, 0, 139, 141, 0, 139, 141, 0, 120, 139,
   141, 0, 120, 139, 141, 0, 120, 139, 141, 0,
-  204, 0, 280, 0, 280, 0, 75, 78, 0, 574,
-  0, 1598, 0, 1618, 0, 1620, 0, 1622, 0, 1593,
-  0, 1618, 0, 1575, 0, 1575, 0, 1575, 0, 1575,
-  0, 1575, 0, 1575, 0, 1372, 0, 1332, 0, 1353,
-  0, 1335, 0, 1344, 0, 1338, 0, 1350, 0, 1347,
-  0, 1373, 0, 1374, 0, 1310, 0, 1341, 0, 1161,
-  1164, 1167, 0, 1375, 0, 1191, 0, 1221, 1224, 1227,
-  0, 1432, 1803, 0, 1804, 0, 1805, 0, 1806, 0,
-  1700, 0, 1701, 0, 1702, 0, 1704, 0, 1394, 1710,
-  0, 1807, 0, 1808, 0, 1712, 0, 1713, 0, 1818,
-  0, 1148, 1720, 0, 1809, 0, 1730, 0, 1810, 0,
-  1741, 0, 1819, 0, 1811, 0, 1742, 0, 1383, 1823,
-  0, 1820, 0, 1817, 0, 1395, 1760, 0, 1824, 0,
-  1825, 0, 1765, 0, 1774, 0, 1376, 1785, 0, 1377,
-  1786, 0, 1378, 1787, 0, 1316, 1813, 0, 1434, 1814,
-  0, 1815, 0, 1379, 1798, 0, 1380, 1799, 0, 1381,
-  1800, 0, 907, 0, 1493, 0, 1493, 0, 1493, 0,
-  1493, 0, 1493, 0, 1493, 0, 1493, 0, 1493, 0,
-  1493, 0, 1493, 0, 1493, 0, 1493, 0, 1493, 0,
-  1493, 0, 1493, 0, 1493, 0, 1493, 0, 1493, 0,
-  1493, 0, 1493, 0, 1083, 0, 1493, 0, 1493, 0,
-  1493, 0, 1251, 0, 1545, 0, 1545, 0, 1547, 0,
-  1547, 0, 1554, 0, 419, 0, 442, 0, 442, 0,
-  1574, 0, 1574, 0, 1574, 0, 1574, 0, 1574, 0,
-  1574, 0, 1479, 0, 1493, 0, 419, 0, 415, 0,
-  921, 0, 921, 0, 921, 0, 907, 0, 262, 0,
+  204, 0, 280, 0, 280, 0, 75, 78, 0, 576,
+  0, 1600, 0, 1620, 0, 1622, 0, 1624, 0, 1595,
+  0, 1620, 0, 1577, 0, 1577, 0, 1577, 0, 1577,
+  0, 1577, 0, 1577, 0, 1374, 0, 1334, 0, 1355,
+  0, 1337, 0, 1346, 0, 1340, 0, 1352, 0, 1349,
+  0, 1375, 0, 1376, 0, 1312, 0, 1343, 0, 1163,
+  1166, 1169, 0, 1377, 0, 1193, 0, 1223, 1226, 1229,
+  0, 1434, 1805, 0, 1806, 0, 1807, 0, 1808, 0,
+  1702, 0, 1703, 0, 1704, 0, 1706, 0, 1396, 1712,
+  0, 1809, 0, 1810, 0, 1714, 0, 1715, 0, 1820,
+  0, 1150, 1722, 0, 1811, 0, 1732, 0, 1812, 0,
+  1743, 0, 1821, 0, 1813, 0, 1744, 0, 1385, 1825,
+  0, 1822, 0, 1819, 0, 1397, 1762, 0, 1826, 0,
+  1827, 0, 1767, 0, 1776, 0, 1378, 1787, 0, 1379,
+  1788, 0, 1380, 1789, 0, 1318, 1815, 0, 1436, 1816,
+  0, 1817, 0, 1381, 1800, 0, 1382, 1801, 0, 1383,
+  1802, 0, 909, 0, 1495, 0, 1495, 0, 1495, 0,
+  1495, 0, 1495, 0, 1495, 0, 1495, 0, 1495, 0,
+  1495, 0, 1495, 0, 1495, 0, 1495, 0, 1495, 0,
+  1495, 0, 1495, 0, 1495, 0, 1495, 0, 1495, 0,
+  1495, 0, 1495, 0, 1085, 0, 1495, 0, 1495, 0,
+  1495, 0, 1253, 0, 1547, 0, 1547, 0, 1549, 0,
+  1549, 0, 1556, 0, 419, 0, 442, 0, 442, 0,
+  1576, 0, 1576, 0, 1576, 0, 1576, 0, 1576, 0,
+  1576, 0, 1481, 0, 1495, 0, 419, 0, 415, 0,
+  923, 0, 923, 0, 923, 0, 909, 0, 262, 0,
   262, 0, 262, 0, 262, 0, 262, 0, 262, 0,
   262, 0, 262, 0, 262, 0, 262, 0, 262, 0,
-  262, 0, 659, 0, 907, 0, 543, 0, 543, 0,
-  543, 0, 1459, 0, 423, 0, 1484, 0, 273, 0,
-  217, 0, 514, 0, 269, 0, 269, 0, 916, 0,
-  916, 0, 916, 0, 1455, 0, 1374, 0, 217, 0,
-  217, 0, 407, 0, 1554, 0, 1558, 0, 249, 0,
-  261, 0, 659, 0, 637, 0, 219, 0, 784, 0,
+  262, 0, 661, 0, 909, 0, 545, 0, 545, 0,
+  545, 0, 1461, 0, 423, 0, 1486, 0, 273, 0,
+  217, 0, 516, 0, 269, 0, 269, 0, 918, 0,
+  918, 0, 918, 0, 1457, 0, 1376, 0, 217, 0,
+  217, 0, 407, 0, 1556, 0, 1560, 0, 249, 0,
+  261, 0, 661, 0, 639, 0, 219, 0, 786, 0,
   262, 0, 262, 0, 262, 0, 262, 0, 238, 0,
-  937, 0, 319, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  814, 0, 814, 0, 814, 0, 814, 0, 814, 0,
-  1583, 0, 1583, 0, 792, 0, 791, 0, 971, 0,
-  956, 0, 956, 0, 664, 0, 337, 0, 664, 0,
-  337, 0, 337, 0, 664, 0, 664, 0, 337, 0,
+  939, 0, 319, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  816, 0, 816, 0, 816, 0, 816, 0, 816, 0,
+  1585, 0, 1585, 0, 794, 0, 793, 0, 973, 0,
+  958, 0, 958, 0, 666, 0, 337, 0, 666, 0,
+  337, 0, 337, 0, 666, 0, 666, 0, 337, 0,
   337, 0, 337, 0, 337, 0, 337, 0, 337, 0,
   337, 0, 337, 0, 337, 0, 337, 0, 337, 0,
   337, 0, 337, 0, 337, 0, 337, 0, 337, 0,
@@ -8827,11 +8829,11 @@ static const short int yyconfl[] = {
   337, 0, 337, 0, 337, 0, 337, 0, 337, 0,
   337, 0, 337, 0, 337, 0, 337, 0, 337, 0,
   337, 0, 337, 0, 337, 0, 337, 0, 337, 0,
-  337, 0, 337, 0, 1903, 0, 1903, 0, 613, 0,
-  1034, 0, 1022, 0, 1583, 0, 1080, 0, 400, 0,
-  975, 0, 532, 0, 532, 0, 1493, 0, 532, 0,
-  1493, 0, 532, 0, 532, 0, 532, 0, 532, 0,
-  1068, 0, 345, 0, 345, 0, 345, 0, 345, 0,
+  337, 0, 337, 0, 1905, 0, 1905, 0, 615, 0,
+  1036, 0, 1024, 0, 1585, 0, 1082, 0, 400, 0,
+  977, 0, 534, 0, 534, 0, 1495, 0, 534, 0,
+  1495, 0, 534, 0, 534, 0, 534, 0, 534, 0,
+  1070, 0, 345, 0, 345, 0, 345, 0, 345, 0,
   345, 0, 345, 0, 345, 0, 345, 0, 345, 0,
   345, 0, 345, 0, 345, 0, 345, 0, 345, 0,
   345, 0, 345, 0, 345, 0, 345, 0, 345, 0,
@@ -8860,577 +8862,523 @@ static const short int yyconfl[] = {
   345, 0, 345, 0, 345, 0, 345, 0, 345, 0,
   345, 0, 345, 0, 345, 0, 345, 0, 345, 0,
   345, 0, 345, 0, 345, 0, 345, 0, 345, 0,
-  345, 0, 313, 0, 359, 0, 1902, 0, 1900, 0,
-  1053, 0, 209, 0, 957, 0, 958, 0, 953, 0,
-  708, 0, 670, 0, 1024, 0, 1029, 0, 1073, 0,
-  398, 0, 714, 0, 714, 0, 714, 0, 714, 0,
-  650, 0, 777, 0, 641, 0, 954, 0, 1041, 0,
-  669, 0, 669, 0, 669, 0, 669, 0, 625, 0,
-  682, 0, 669, 0, 1012, 0, 682, 0, 669, 0,
-  561, 0, 1011, 0, 679, 0, 1036, 0, 1038, 0,
-  1037, 0
+  345, 0, 313, 0, 359, 0, 1904, 0, 1902, 0,
+  1055, 0, 209, 0, 959, 0, 960, 0, 955, 0,
+  710, 0, 672, 0, 1026, 0, 1031, 0, 1075, 0,
+  398, 0, 716, 0, 716, 0, 716, 0, 716, 0,
+  652, 0, 779, 0, 643, 0, 956, 0, 1043, 0,
+  671, 0, 671, 0, 671, 0, 671, 0, 627, 0,
+  684, 0, 671, 0, 1014, 0, 684, 0, 671, 0,
+  563, 0, 1013, 0, 681, 0, 1038, 0, 1040, 0,
+  1039, 0
 };
 
 static const short int yycheck[] = {
-  11, 8, 81, 14, 8, 448, 646, 8, 701, 76,
-  1206, 22, 14, 317, 686, 622, 27, 694, 14, 245,
-  600, 14, 602, 327, 1093, 625, 534, 600, 39, 602,
-  1108, 1109, 1108, 1109, 1102, 339, 262, 341, 1474, 1076,
-  54, 1376, 698, 1485, 812, 555, 291, 442, 955, 1485,
-  61, 654, 625, 86, 87, 88, 1968, 1141, 713, 2049,
-  1084, 1816, 2139, 34, 1081, 1082, 437, 999, 79, 992,
-  81, 82, 2280, 2259, 85, 1818, 1551, 2188, 89, 90,
-  900, 901, 902, 2071, 1096, 905, 1104, 907, 28, 1376,
-  1818, 746, 68, 1025, 1026, 2401, 89, 1115, 8, 867,
-  868, 37, 34, 1795, 1796, 1797, 0, 0, 8, 26,
-  49, 2503, 12, 811, 1132, 49, 65, 89, 2119, 101,
-  65, 49, 53, 150, 2516, 124, 131, 2258, 131, 156,
-  51, 2785, 15, 2210, 45, 164, 438, 439, 2444, 2332,
-  65, 222, 65, 891, 892, 893, 164, 2296, 896, 164,
-  898, 899, 216, 1076, 867, 868, 2603, 14, 20, 2303,
-  14, 148, 2062, 39, 14, 2314, 2370, 222, 14, 89,
-  33, 92, 166, 222, 2446, 274, 222, 45, 44, 92,
-  122, 14, 8, 1471, 1472, 242, 12, 45, 50, 45,
-  100, 92, 26, 108, 108, 100, 58, 224, 8, 37,
-  274, 2596, 345, 236, 237, 2391, 155, 8, 241, 242,
-  155, 94, 1500, 325, 196, 91, 230, 146, 2038, 2540,
-  177, 92, 167, 2261, 26, 174, 2547, 14, 2687, 174,
-  155, 2713, 155, 2749, 222, 216, 360, 158, 1058, 398,
-  37, 2061, 167, 2281, 416, 158, 2900, 1170, 417, 174,
-  350, 174, 285, 217, 218, 353, 120, 206, 218, 15,
-  400, 206, 2297, 129, 360, 155, 131, 129, 279, 124,
-  409, 217, 218, 179, 348, 349, 358, 279, 222, 177,
-  424, 206, 7, 206, 174, 214, 279, 457, 1372, 151,
-  100, 150, 7, 0, 2295, 7, 160, 22, 465, 100,
-  444, 440, 36, 443, 483, 409, 168, 325, 257, 172,
-  325, 150, 257, 2619, 2620, 362, 175, 156, 622, 1012,
-  2308, 358, 626, 926, 1766, 2402, 2403, 2719, 190, 2317,
-  1766, 1024, 257, 282, 257, 190, 440, 45, 94, 260,
-  1776, 712, 345, 353, 2332, 2380, 2652, 2653, 2654, 521,
-  543, 38, 522, 218, 39, 2343, 267, 44, 92, 2754,
-  2437, 2438, 2439, 325, 353, 325, 91, 257, 356, 231,
-  236, 209, 177, 317, 236, 2857, 545, 358, 165, 91,
-  114, 560, 2898, 826, 543, 224, 241, 180, 128, 392,
-  332, 2663, 292, 560, 698, 337, 177, 2856, 3052, 214,
-  45, 358, 706, 707, 708, 709, 565, 566, 148, 267,
-  125, 2732, 209, 446, 557, 253, 2688, 927, 251, 340,
-  1076, 545, 2608, 211, 158, 436, 336, 340, 348, 349,
-  441, 336, 511, 512, 398, 514, 437, 516, 133, 340,
-  497, 356, 356, 1521, 282, 1521, 558, 315, 1526, 545,
-  1526, 1058, 398, 679, 2492, 189, 253, 2601, 558, 315,
-  358, 560, 560, 326, 2284, 404, 292, 2739, 462, 340,
-  336, 410, 411, 24, 336, 557, 404, 334, 417, 325,
-  561, 545, 410, 411, 334, 282, 560, 520, 996, 417,
-  360, 2699, 2939, 180, 865, 1167, 217, 530, 2684, 2685,
-  511, 512, 557, 514, 515, 516, 438, 439, 522, 2510,
-  442, 498, 561, 1169, 1170, 561, 3170, 251, 2913, 2825,
-  557, 1809, 533, 534, 557, 318, 336, 545, 557, 2722,
-  2723, 538, 1569, 439, 561, 336, 1229, 538, 73, 450,
-  533, 1049, 913, 3197, 555, 474, 561, 2819, 2679, 560,
-  560, 2889, 557, 358, 557, 2704, 44, 299, 557, 861,
-  2561, 500, 2706, 417, 1277, 2465, 1074, 98, 2717, 2773,
-  2774, 560, 500, 2777, 1084, 2318, 2725, 358, 1276, 543,
-  562, 512, 2659, 545, 115, 567, 492, 598, 560, 600,
-  2318, 602, 513, 2594, 477, 360, 558, 543, 1346, 150,
-  1348, 565, 566, 343, 618, 2041, 340, 315, 557, 623,
-  398, 545, 557, 624, 625, 626, 1124, 1125, 557, 565,
-  566, 557, 539, 164, 398, 177, 177, 5, 545, 546,
-  161, 162, 557, 1968, 557, 552, 553, 554, 555, 501,
-  180, 129, 2117, 20, 655, 656, 354, 355, 3040, 164,
-  177, 1378, 562, 664, 630, 234, 204, 633, 558, 354,
-  355, 440, 556, 556, 42, 910, 15, 599, 45, 180,
-  315, 664, 220, 50, 392, 545, 151, 398, 180, 1406,
-  691, 1968, 164, 20, 560, 330, 697, 698, 220, 691,
-  560, 1703, 90, 168, 360, 691, 441, 248, 691, 710,
-  445, 2702, 2703, 643, 644, 539, 2817, 258, 45, 354,
-  355, 545, 546, 50, 2715, 2716, 2827, 451, 552, 553,
-  554, 555, 210, 211, 447, 448, 90, 105, 449, 3067,
-  509, 3069, 1744, 1389, 2722, 2723, 218, 539, 2726, 478,
-  3046, 3047, 1810, 545, 546, 94, 1418, 1419, 236, 560,
-  552, 553, 554, 555, 488, 2941, 154, 545, 546, 151,
-  494, 499, 231, 1456, 552, 553, 554, 555, 2976, 543,
-  318, 90, 1076, 352, 322, 153, 168, 565, 318, 327,
-  91, 713, 330, 131, 325, 209, 560, 124, 251, 1093,
-  154, 565, 557, 1301, 150, 327, 330, 90, 330, 675,
-  156, 677, 150, 1376, 335, 681, 358, 318, 344, 1409,
-  325, 1848, 210, 282, 746, 1833, 318, 2292, 557, 2562,
-  90, 24, 543, 544, 563, 564, 2262, 1750, 1760, 253,
-  1486, 358, 2307, 98, 2562, 154, 1409, 560, 149, 20,
-  558, 125, 560, 325, 565, 566, 210, 2602, 336, 52,
-  115, 90, 2544, 190, 231, 315, 125, 575, 282, 1230,
-  20, 154, 127, 560, 506, 1169, 1170, 90, 224, 50,
-  233, 1691, 250, 408, 480, 560, 360, 58, 575, 1556,
-  2310, 2958, 2959, 489, 154, 45, 2316, 171, 1396, 1397,
-  50, 210, 2893, 2894, 231, 355, 161, 162, 410, 411,
-  209, 2236, 171, 914, 241, 3029, 917, 2908, 514, 444,
-  409, 409, 2342, 178, 925, 154, 927, 210, 850, 851,
-  852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
-  465, 154, 545, 468, 187, 470, 471, 472, 473, 624,
-  210, 440, 440, 124, 253, 20, 957, 150, 561, 1769,
-  124, 557, 2293, 45, 557, 398, 353, 210, 223, 133,
-  563, 564, 165, 3087, 957, 3089, 98, 3091, 2309, 306,
-  45, 210, 557, 282, 177, 50, 561, 512, 526, 562,
-  991, 992, 557, 115, 567, 996, 561, 210, 999, 674,
-  2014, 1002, 1003, 2328, 1482, 127, 1484, 2068, 991, 91,
-  685, 563, 564, 1014, 1083, 2076, 2749, 210, 1087, 190,
-  2081, 559, 557, 557, 1025, 1026, 561, 561, 989, 1030,
-  1031, 2749, 29, 30, 43, 1036, 545, 546, 2045, 161,
-  162, 217, 218, 552, 553, 554, 555, 560, 1049, 560,
-  3164, 133, 560, 1551, 557, 248, 178, 557, 561, 557,
-  231, 561, 557, 561, 560, 258, 561, 989, 1069, 151,
-  241, 1128, 146, 1074, 3141, 1076, 3190, 557, 360, 1725,
-  335, 561, 1083, 1084, 557, 2080, 1087, 216, 561, 2084,
-  557, 284, 285, 1094, 561, 1389, 2104, 1098, 560, 5,
-  1690, 223, 8, 557, 10, 563, 564, 561, 392, 302,
-  303, 1094, 545, 546, 307, 308, 44, 392, 393, 552,
-  553, 554, 555, 1124, 1125, 2694, 2695, 2696, 2697, 2698,
-  58, 560, 565, 999, 557, 306, 560, 557, 561, 1729,
-  1786, 561, 561, 1144, 563, 564, 1147, 1148, 1794, 1739,
-  560, 557, 234, 560, 1744, 561, 560, 239, 557, 1025,
-  1026, 89, 561, 557, 560, 2898, 1729, 561, 1169, 1170,
-  1853, 560, 1769, 392, 393, 2500, 1739, 430, 431, 432,
-  2898, 1744, 1844, 436, 437, 438, 92, 862, 1818, 549,
-  550, 551, 1486, 545, 557, 5, 545, 1697, 561, 105,
-  10, 129, 395, 396, 397, 1206, 557, 557, 545, 3111,
-  561, 561, 118, 335, 557, 557, 557, 545, 561, 561,
-  561, 2280, 210, 211, 560, 81, 82, 83, 84, 85,
-  560, 557, 42, 315, 545, 561, 557, 557, 48, 49,
-  561, 561, 557, 3223, 560, 151, 561, 557, 330, 557,
-  3152, 561, 158, 561, 336, 543, 544, 2331, 1756, 3004,
-  557, 557, 344, 938, 561, 561, 560, 557, 563, 564,
-  352, 561, 354, 355, 560, 1569, 557, 3179, 543, 544,
-  561, 560, 210, 211, 560, 1289, 142, 143, 144, 145,
-  557, 966, 2189, 557, 561, 105, 545, 561, 560, 492,
-  1301, 549, 550, 551, 979, 558, 563, 564, 236, 563,
-  564, 45, 987, 545, 546, 547, 548, 1386, 246, 560,
-  552, 553, 554, 555, 999, 857, 858, 859, 860, 1753,
-  1754, 1921, 1978, 658, 659, 191, 560, 193, 194, 195,
-  246, 1145, 1146, 2026, 200, 560, 539, 2458, 2459, 560,
-  1025, 1026, 2611, 2612, 560, 2613, 2614, 560, 286, 2639,
-  2640, 560, 853, 854, 560, 558, 543, 560, 274, 855,
-  856, 2379, 560, 1377, 1375, 824, 825, 1381, 560, 572,
-  573, 574, 2449, 2450, 350, 1386, 560, 197, 1389, 394,
-  560, 1392, 560, 560, 560, 1396, 1397, 2042, 560, 133,
-  560, 560, 2048, 560, 560, 1968, 560, 560, 336, 1392,
-  568, 560, 560, 560, 560, 271, 272, 151, 560, 501,
-  560, 231, 560, 560, 506, 560, 560, 1102, 560, 560,
-  240, 1725, 2094, 560, 340, 560, 560, 560, 49, 1824,
-  250, 560, 560, 560, 560, 560, 560, 1470, 2258, 560,
-  560, 560, 545, 1454, 1376, 560, 569, 560, 24, 560,
-  560, 560, 570, 560, 560, 560, 560, 549, 550, 551,
-  545, 575, 330, 1474, 147, 91, 404, 345, 419, 462,
-  526, 299, 325, 131, 1485, 1486, 52, 2080, 222, 417,
-  1491, 325, 1786, 26, 419, 367, 526, 520, 1499, 327,
-  1794, 204, 204, 557, 218, 239, 557, 1508, 299, 365,
-  366, 538, 514, 521, 2014, 463, 491, 504, 127, 440,
-  481, 358, 521, 440, 1390, 177, 358, 216, 216, 216,
-  559, 106, 164, 349, 131, 1536, 1458, 218, 2128, 1540,
-  1775, 325, 218, 1409, 139, 1546, 1547, 360, 417, 484,
-  1551, 501, 462, 480, 1848, 239, 133, 1540, 356, 560,
-  560, 8, 1563, 1546, 1547, 560, 560, 560, 1569, 1570,
-  560, 1563, 1573, 2581, 2582, 560, 560, 1563, 560, 560,
-  1563, 315, 560, 560, 150, 561, 560, 2345, 2234, 560,
-  560, 560, 402, 560, 404, 560, 330, 560, 560, 165,
-  410, 411, 336, 560, 560, 560, 560, 417, 560, 560,
-  344, 177, 561, 560, 560, 560, 560, 560, 560, 2117,
-  354, 355, 560, 560, 560, 364, 560, 560, 560, 560,
-  560, 560, 222, 165, 490, 561, 560, 560, 560, 11,
-  2699, 560, 560, 557, 210, 368, 369, 370, 371, 372,
-  373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
-  383, 384, 385, 386, 387, 388, 389, 390, 391, 2259,
-  480, 560, 560, 2236, 560, 560, 560, 560, 560, 535,
-  560, 560, 248, 560, 1978, 495, 496, 560, 2318, 560,
-  564, 561, 258, 1559, 560, 560, 1697, 560, 560, 560,
-  26, 558, 562, 557, 119, 330, 176, 419, 1712, 1713,
-  3142, 1715, 166, 462, 526, 1716, 3142, 464, 284, 285,
-  238, 560, 557, 164, 1725, 14, 51, 557, 266, 327,
-  131, 176, 1407, 1716, 419, 226, 302, 303, 1413, 526,
-  229, 307, 308, 3068, 539, 231, 8, 440, 358, 1750,
-  358, 1752, 557, 349, 2048, 1756, 168, 557, 1759, 1760,
-  1761, 282, 221, 8, 560, 1766, 1767, 501, 244, 325,
-  544, 2454, 506, 2781, 417, 543, 35, 360, 336, 558,
-  325, 561, 147, 514, 318, 1786, 3111, 367, 561, 561,
-  318, 367, 110, 1794, 2292, 358, 561, 561, 2481, 561,
-  561, 2391, 561, 561, 561, 539, 561, 318, 367, 2307,
-  561, 131, 557, 561, 2841, 549, 550, 551, 1819, 64,
-  543, 544, 150, 561, 561, 561, 318, 3152, 367, 395,
-  396, 397, 561, 223, 210, 1836, 1837, 1703, 1513, 561,
-  561, 561, 1517, 3269, 3270, 561, 2344, 1848, 557, 227,
-  561, 3277, 3278, 2351, 3179, 211, 26, 113, 11, 576,
-  1535, 1862, 528, 1729, 176, 525, 2924, 93, 576, 2679,
-  1862, 1872, 117, 1739, 218, 93, 1862, 176, 1744, 1862,
-  1555, 525, 557, 2891, 46, 46, 560, 132, 560, 560,
-  11, 558, 392, 561, 1760, 167, 340, 167, 225, 557,
-  417, 543, 1824, 2466, 2467, 543, 151, 151, 417, 218,
-  210, 2919, 151, 435, 560, 489, 301, 2976, 45, 2135,
-  560, 367, 66, 345, 367, 561, 492, 557, 317, 110,
-  14, 227, 2562, 561, 561, 561, 367, 561, 545, 561,
-  2234, 392, 561, 561, 557, 557, 561, 561, 131, 131,
-  367, 131, 557, 2451, 557, 561, 3024, 19, 3024, 21,
-  1961, 2030, 561, 557, 545, 557, 557, 1971, 561, 557,
-  32, 131, 1976, 539, 561, 561, 561, 1978, 557, 557,
-  223, 345, 287, 536, 557, 3171, 2280, 227, 2057, 561,
-  2059, 561, 558, 557, 561, 557, 561, 557, 3006, 536,
-  561, 151, 557, 557, 561, 557, 572, 573, 574, 557,
-  561, 561, 561, 2014, 561, 1690, 557, 561, 2608, 561,
-  560, 2611, 2612, 2613, 2614, 59, 557, 557, 345, 2030,
-  3216, 360, 115, 2102, 429, 561, 1711, 360, 558, 167,
-  2041, 560, 557, 119, 558, 558, 1968, 2048, 467, 561,
-  557, 561, 560, 557, 560, 1730, 2057, 2058, 2059, 560,
-  557, 3129, 177, 3129, 560, 2563, 20, 216, 3076, 557,
-  3078, 561, 151, 560, 216, 178, 2759, 392, 560, 227,
-  227, 545, 327, 561, 561, 1760, 561, 545, 131, 2772,
-  561, 35, 561, 211, 2684, 2685, 505, 35, 140, 561,
-  2101, 2102, 227, 227, 477, 227, 477, 560, 140, 2110,
-  163, 231, 163, 188, 188, 557, 2117, 537, 2119, 2749,
-  2042, 418, 557, 511, 2125, 242, 2127, 2110, 561, 557,
-  562, 558, 178, 89, 560, 1810, 218, 560, 14, 560,
-  45, 557, 231, 3151, 2127, 35, 557, 325, 558, 482,
-  231, 231, 3160, 231, 399, 218, 177, 561, 403, 557,
-  190, 561, 43, 562, 561, 561, 560, 560, 560, 127,
-  415, 557, 3180, 227, 561, 420, 557, 561, 561, 561,
-  557, 561, 2398, 131, 35, 223, 561, 561, 433, 557,
-  218, 561, 561, 218, 561, 561, 441, 3205, 561, 561,
-  445, 561, 557, 561, 2273, 2274, 2275, 561, 453, 560,
-  560, 456, 560, 560, 560, 557, 557, 557, 463, 1894,
-  127, 223, 561, 20, 153, 20, 560, 289, 20, 168,
-  282, 168, 20, 2234, 2291, 1910, 2305, 543, 560, 218,
-  224, 2298, 254, 115, 560, 124, 1921, 560, 169, 557,
-  2251, 2848, 392, 563, 561, 223, 223, 561, 561, 560,
-  35, 35, 2128, 561, 558, 510, 557, 560, 2898, 2952,
-  2840, 2340, 2273, 2274, 2275, 2942, 2345, 2840, 557, 524,
-  2349, 526, 527, 340, 231, 560, 2355, 14, 557, 534,
-  557, 2292, 557, 538, 2295, 14, 557, 557, 216, 557,
-  557, 2302, 557, 216, 2305, 89, 2307, 560, 560, 560,
-  560, 2312, 560, 147, 2315, 557, 557, 3000, 218, 168,
-  170, 168, 2323, 561, 560, 477, 561, 561, 561, 561,
-  561, 561, 561, 557, 35, 227, 227, 35, 561, 2340,
-  557, 561, 561, 2344, 2345, 560, 2347, 557, 2349, 450,
-  2351, 2941, 557, 131, 2355, 216, 560, 560, 2359, 560,
-  2361, 358, 558, 118, 2365, 455, 90, 557, 14, 2370,
-  557, 127, 561, 2365, 560, 437, 2359, 2378, 2379, 2365,
-  356, 3043, 2365, 356, 561, 561, 561, 2379, 561, 561,
-  561, 560, 560, 2259, 349, 14, 2379, 561, 561, 358,
-  543, 560, 3085, 561, 469, 2699, 363, 364, 365, 366,
-  367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
-  377, 378, 379, 380, 381, 382, 383, 384, 385, 170,
-  560, 560, 2298, 360, 560, 317, 187, 210, 561, 187,
-  2306, 557, 561, 127, 133, 14, 560, 483, 560, 243,
-  2451, 455, 560, 168, 211, 168, 168, 246, 557, 227,
-  2517, 317, 340, 560, 523, 2466, 2467, 231, 561, 469,
-  2471, 2472, 557, 44, 221, 561, 44, 282, 158, 246,
-  140, 221, 221, 512, 561, 512, 53, 560, 560, 560,
-  14, 561, 218, 561, 35, 360, 2497, 360, 35, 92,
-  561, 218, 560, 261, 141, 470, 358, 557, 141, 2510,
-  4, 211, 2513, 4, 211, 360, 4, 211, 3201, 4,
-  211, 2513, 127, 2524, 127, 2391, 557, 3, 989, 1545,
-  2513, 557, 1116, 1397, 2737, 2667, 2537, 1988, 1413, 2540,
-  2056, 2542, 2318, 1483, 3227, 993, 2547, 2841, 3111, 2076,
-  2078, 2080, 2553, 8, 2848, 56, 3239, 1477, 618, 56,
-  2561, 3244, 2563, 58, 1057, 845, 1469, 1769, 1759, 560,
-  8, 1792, 1032, 2472, 1570, 2041, 8, 8, 2835, 2834,
-  1169, 1387, 2583, 2584, 632, 629, 535, 2748, 650, 3152,
-  2897, 2583, 3004, 2594, 2317, 521, 1142, 2583, 3017, 1827,
-  2583, 3123, 2603, 3242, 3185, 3208, 2607, 2918, 2609, 2707,
-  3057, 2894, 2594, 2288, 2927, 2100, 3179, 1745, 2703, 2242,
-  2603, 2296, 2671, 31, 2607, 8, 3009, 2084, 2303, 1375,
-  1543, 2768, 981, 1040, 2361, 2848, 1837, 2283, 1143, 2314,
-  2058, 2679, 2467, 3147, 3145, 3241, 3278, 2607, 3277, 2480,
-  712, 2975, 850, 852, 851, 2191, 2441, 1181, 1916, 1260,
-  11, 1295, 703, 1296, 1299, 1181, 882, 876, 1953, 493,
-  2115, 279, 248, 280, 2236, 279, 1644, 1298, 1703, 2680,
-  3074, 743, 2976, 745, 1921, 2189, 2866, 2386, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 2702, 2703, -1, -1, -1, -1, -1, 2709, -1,
-  -1, -1, 2713, -1, 2715, 2716, -1, -1, -1, -1,
-  -1, -1, -1, 2724, -1, -1, -1, -1, -1, -1,
-  2731, 2732, -1, -1, -1, -1, -1, -1, -1, 3172,
-  -1, -1, 2608, -1, -1, 2611, 2612, 2613, 2614, 811,
-  2616, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  2761, 823, -1, -1, -1, 2759, -1, -1, -1, -1,
-  -1, -1, 2773, 2774, -1, -1, 2777, -1, -1, -1,
-  -1, -1, 844, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 865, -1, -1, -1, 869, 870, 871,
-  872, -1, -1, -1, -1, -1, -1, -1, 2684, 2685,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 2840,
-  2841, -1, -1, -1, 906, -1, 2847, -1, -1, -1,
-  -1, 913, -1, -1, 2720, -1, 2857, -1, -1, -1,
-  -1, 2862, -1, -1, 2847, -1, -1, -1, -1, -1,
-  2862, -1, -1, -1, -1, -1, 2862, -1, 2879, 2862,
-  2937, -1, -1, -1, -1, -1, -1, 2888, -1, -1,
-  -1, -1, 2893, 2894, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 2908, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 2920,
-  -1, -1, 2597, -1, -1, -1, 2601, -1, 990, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 2939, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 1011,
-  -1, -1, -1, -1, -1, -1, 2939, -1, -1, -1,
-  -1, 1023, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 2984, -1, -1, -1, -1, -1, 2990,
-  -1, -1, 2984, -1, -1, -1, -1, -1, 2984, -1,
-  -1, 2984, -1, -1, -1, -1, -1, -1, -1, 3010,
-  -1, -1, 3009, -1, -1, 3016, 3017, -1, 3009, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 2704,
-  -1, 2706, 3033, -1, -1, -1, -1, 3094, -1, -1,
-  -1, -1, 2717, -1, -1, -1, -1, -1, -1, -1,
-  2725, -1, 3053, -1, -1, -1, -1, -1, -1, 3060,
-  -1, -1, -1, -1, -1, 3066, -1, -1, -1, -1,
-  3053, -1, -1, -1, -1, 2941, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 3092, -1, -1, -1, -1, 3165, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 3092,
-  -1, -1, -1, -1, 1176, 1177, -1, -1, 1180, -1,
-  -1, 1183, 3123, -1, 1186, -1, 3183, -1, -1, -1,
-  -1, -1, 1194, 1195, -1, -1, -1, -1, -1, 1201,
-  -1, 3142, 1204, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 3162, -1, -1, 3165, -1, 1228, -1, 1230, 1231,
-  3171, -1, 1234, 1235, 1236, 1237, -1, 1239, -1, 3162,
-  1242, 1243, 1244, -1, 1246, -1, 1248, 1249, 1250, 1251,
-  1252, 1253, -1, -1, 1256, 1257, 1258, -1, -1, 1261,
-  1262, 1263, 1264, 1265, -1, -1, -1, -1, 1270, 1271,
-  1272, 1273, 1274, -1, 1276, 3216, 1278, 1279, 1280, 1281,
-  1282, 1283, 1284, 1285, -1, -1, -1, -1, -1, -1,
-  1292, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 2924,
-  -1, -1, -1, -1, -1, -1, -1, -1, 1320, 1321,
-  1322, 1323, -1, -1, -1, -1, -1, 1329, 1330, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 1345, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 10, -1, -1,
-  -1, 14, -1, -1, -1, -1, 19, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 36, -1, -1, 3011, -1, 1400, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 51, -1,
-  53, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 64, 65, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 76, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 87, -1, -1, -1, -1, 92,
-  -1, 94, 95, 1455, -1, 98, -1, -1, -1, 102,
-  -1, -1, 105, -1, -1, -1, -1, -1, -1, -1,
-  -1, 114, 115, -1, 1476, 118, -1, -1, -1, -1,
-  -1, -1, -1, -1, 127, 128, -1, -1, 131, -1,
-  -1, -1, 135, -1, -1, -1, 139, 140, 141, -1,
-  -1, -1, -1, -1, -1, 148, -1, 3122, -1, -1,
-  153, -1, 155, -1, -1, 158, -1, -1, 161, 162,
-  -1, 164, -1, -1, 167, -1, -1, -1, -1, -1,
-  -1, 174, -1, -1, -1, 178, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 189, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 206, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 1576, 218, -1, -1, -1, -1,
-  223, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 234, -1, -1, -1, -1, -1, -1, 1600, -1,
-  -1, -1, -1, -1, -1, -1, -1, 250, 251, 1611,
-  -1, 1613, -1, 256, 257, -1, -1, 260, -1, -1,
-  -1, -1, -1, 266, -1, 268, -1, -1, -1, -1,
-  -1, 274, 1634, -1, -1, -1, -1, -1, -1, 282,
-  -1, -1, -1, -1, -1, -1, 1648, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 1675, 1676, -1, -1, -1, -1, -1,
-  -1, -1, 325, -1, -1, -1, -1, -1, -1, -1,
-  333, -1, 335, -1, -1, -1, -1, 340, -1, -1,
-  343, -1, 345, -1, 347, 348, 349, -1, -1, -1,
-  -1, -1, -1, -1, -1, 358, -1, 360, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 1743, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 417, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 427, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 454, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 1857, -1, -1, 1860, -1,
-  -1, -1, -1, -1, 507, -1, -1, -1, -1, 512,
-  -1, -1, -1, 1875, -1, 1877, -1, -1, 1880, -1,
-  -1, -1, -1, 1885, 1886, 1887, -1, -1, 1890, 1891,
-  1892, 1893, -1, -1, -1, -1, -1, 1899, 1900, -1,
-  1902, 1903, -1, 1905, -1, -1, 1908, -1, -1, -1,
-  -1, -1, -1, 556, 557, 1917, 1918, 560, 561, 0,
-  -1, 1923, -1, -1, -1, -1, -1, -1, -1, 10,
+  11, 8, 81, 14, 8, 14, 14, 8, 448, 76,
+  687, 22, 695, 317, 34, 1095, 27, 601, 647, 603,
+  623, 245, 702, 327, 1208, 1104, 626, 1487, 39, 1106,
+  534, 14, 601, 1078, 603, 339, 291, 341, 262, 813,
+  1117, 655, 626, 555, 442, 1110, 1111, 1110, 1111, 956,
+  61, 714, 1970, 1143, 2051, 34, 1820, 1134, 1818, 993,
+  54, 1378, 1476, 86, 87, 88, 1086, 2141, 79, 699,
+  81, 82, 1553, 1487, 85, 2282, 1820, 2121, 89, 90,
+  901, 902, 903, 437, 747, 906, 1000, 908, 1083, 1084,
+  2261, 1098, 2190, 1378, 868, 869, 1797, 1798, 1799, 28,
+  68, 2073, 0, 0, 2505, 8, 89, 49, 89, 12,
+  124, 812, 37, 1027, 1028, 39, 8, 2518, 49, 51,
+  15, 14, 49, 217, 2403, 65, 2787, 53, 131, 2305,
+  101, 222, 2298, 2064, 2260, 438, 439, 164, 2212, 131,
+  164, 45, 36, 14, 1078, 216, 892, 893, 894, 26,
+  2316, 897, 65, 899, 900, 150, 65, 222, 65, 204,
+  92, 156, 2605, 222, 868, 869, 164, 2446, 148, 14,
+  45, 1473, 1474, 222, 2598, 220, 33, 8, 274, 14,
+  2334, 12, 8, 89, 100, 45, 44, 360, 133, 166,
+  242, 358, 45, 179, 8, 345, 360, 14, 92, 94,
+  1502, 2715, 358, 108, 2372, 325, 222, 146, 100, 350,
+  164, 92, 2751, 236, 237, 155, 2689, 39, 241, 242,
+  114, 26, 2393, 7, 2448, 196, 158, 167, 92, 224,
+  8, 164, 15, 15, 174, 231, 230, 122, 1172, 1060,
+  417, 2902, 155, 447, 448, 7, 155, 483, 155, 131,
+  64, 20, 90, 2297, 465, 400, 2299, 440, 167, 1380,
+  26, 174, 285, 222, 158, 174, 206, 174, 279, 91,
+  279, 129, 108, 318, 100, 214, 409, 322, 409, 92,
+  128, 50, 327, 2040, 1374, 330, 282, 1408, 98, 58,
+  409, 187, 0, 206, 158, 189, 279, 206, 443, 206,
+  148, 325, 409, 117, 398, 115, 2063, 440, 1768, 440,
+  416, 94, 94, 927, 210, 172, 154, 257, 132, 623,
+  2721, 440, 100, 627, 560, 45, 509, 325, 260, 91,
+  2404, 2405, 2756, 440, 1014, 299, 218, 151, 2310, 2382,
+  356, 125, 2621, 2622, 257, 2859, 1026, 2319, 257, 560,
+  257, 161, 162, 345, 1768, 449, 560, 251, 317, 713,
+  129, 2900, 2334, 267, 1778, 2439, 2440, 2441, 545, 282,
+  45, 325, 210, 2345, 2263, 2654, 2655, 2656, 236, 325,
+  125, 545, 151, 177, 557, 2858, 353, 827, 362, 292,
+  557, 353, 325, 3054, 2283, 699, 560, 217, 218, 168,
+  392, 557, 214, 707, 708, 709, 710, 557, 340, 354,
+  355, 14, 37, 274, 267, 521, 928, 558, 438, 439,
+  336, 190, 442, 446, 73, 436, 171, 2603, 217, 218,
+  441, 543, 511, 512, 251, 514, 437, 516, 558, 2610,
+  315, 2665, 348, 349, 336, 497, 340, 332, 1078, 543,
+  544, 356, 337, 439, 325, 315, 680, 1060, 1523, 340,
+  1523, 292, 231, 1528, 560, 1528, 2690, 236, 2512, 326,
+  561, 565, 566, 404, 545, 2542, 340, 404, 336, 410,
+  411, 526, 2549, 410, 411, 462, 417, 348, 349, 334,
+  417, 2915, 1169, 997, 2701, 343, 561, 520, 2941, 334,
+  511, 512, 561, 514, 515, 516, 492, 530, 557, 1811,
+  336, 3172, 866, 327, 559, 2686, 2687, 2741, 498, 2563,
+  356, 545, 533, 534, 417, 335, 1571, 340, 522, 2286,
+  557, 538, 2708, 347, 557, 474, 2467, 538, 3199, 211,
+  2706, 1171, 1172, 557, 555, 218, 450, 1051, 2827, 560,
+  533, 1231, 2596, 2719, 557, 2681, 2320, 451, 336, 862,
+  914, 2727, 165, 561, 358, 557, 561, 336, 353, 500,
+  2724, 2725, 1076, 500, 1086, 1279, 2320, 1278, 398, 560,
+  600, 513, 477, 360, 209, 399, 512, 2661, 599, 403,
+  601, 562, 603, 560, 488, 315, 567, 2821, 560, 545,
+  494, 415, 1348, 545, 1350, 2494, 420, 2775, 2776, 398,
+  330, 2779, 558, 360, 625, 626, 627, 557, 44, 433,
+  177, 177, 1126, 1127, 234, 619, 557, 441, 253, 2043,
+  624, 445, 557, 177, 354, 355, 560, 24, 2119, 453,
+  315, 3042, 456, 164, 557, 656, 657, 125, 557, 463,
+  557, 216, 325, 1970, 665, 558, 911, 282, 556, 556,
+  2704, 2705, 539, 631, 209, 177, 634, 2734, 545, 546,
+  562, 424, 177, 2717, 2718, 552, 553, 554, 555, 354,
+  355, 692, 665, 692, 692, 1970, 360, 698, 699, 124,
+  37, 444, 180, 171, 714, 155, 510, 218, 1705, 560,
+  711, 625, 398, 129, 560, 20, 91, 499, 253, 692,
+  524, 180, 526, 527, 174, 644, 645, 180, 457, 2891,
+  534, 2819, 44, 543, 538, 251, 398, 747, 344, 5,
+  45, 2829, 501, 1812, 539, 50, 58, 282, 560, 1746,
+  545, 546, 352, 1420, 1421, 565, 566, 552, 553, 554,
+  555, 675, 2724, 2725, 543, 190, 2728, 150, 1835, 408,
+  398, 1391, 686, 150, 149, 392, 42, 89, 545, 3048,
+  3049, 2978, 2943, 539, 1078, 560, 565, 566, 1458, 545,
+  546, 180, 175, 522, 210, 211, 552, 553, 554, 555,
+  177, 1095, 330, 358, 1378, 444, 131, 257, 545, 1303,
+  2564, 358, 358, 38, 325, 1850, 241, 129, 151, 44,
+  236, 1411, 506, 2294, 358, 150, 465, 120, 1752, 468,
+  2564, 470, 471, 472, 473, 168, 90, 1411, 2309, 105,
+  318, 851, 852, 853, 854, 855, 856, 857, 858, 859,
+  860, 861, 862, 353, 2604, 2546, 358, 543, 1762, 318,
+  2264, 2895, 2896, 358, 676, 318, 678, 160, 1488, 90,
+  682, 248, 209, 512, 560, 5, 2910, 1171, 1172, 565,
+  10, 258, 1693, 545, 546, 1558, 545, 153, 1232, 90,
+  552, 553, 554, 555, 220, 360, 2960, 2961, 210, 211,
+  154, 398, 561, 565, 1398, 1399, 20, 3069, 90, 3071,
+  20, 315, 42, 98, 915, 543, 253, 918, 48, 49,
+  336, 43, 20, 90, 236, 926, 231, 928, 3031, 318,
+  115, 2238, 233, 154, 246, 45, 50, 565, 566, 20,
+  50, 558, 127, 560, 58, 282, 151, 45, 45, 863,
+  124, 355, 50, 154, 360, 180, 210, 958, 575, 133,
+  1771, 410, 411, 168, 45, 5, 98, 150, 8, 50,
+  10, 560, 154, 156, 286, 105, 161, 162, 90, 561,
+  990, 563, 564, 115, 250, 958, 3089, 154, 3091, 210,
+  3093, 992, 993, 178, 91, 127, 997, 2751, 7, 1000,
+  560, 327, 1003, 1004, 330, 557, 2016, 560, 478, 210,
+  124, 563, 564, 22, 124, 1016, 1085, 2751, 560, 992,
+  1089, 990, 575, 2330, 336, 939, 1027, 1028, 210, 161,
+  162, 1032, 1033, 560, 150, 480, 133, 1038, 223, 2106,
+  156, 224, 154, 210, 489, 2295, 178, 441, 545, 546,
+  1051, 445, 92, 967, 151, 552, 553, 554, 555, 1553,
+  2082, 2311, 2047, 3166, 2086, 105, 980, 197, 565, 514,
+  1071, 209, 146, 1130, 988, 1076, 190, 1078, 118, 3143,
+  190, 1484, 91, 1486, 1085, 1086, 1000, 557, 1089, 3192,
+  2312, 223, 404, 563, 564, 1096, 2318, 1391, 210, 1100,
+  560, 231, 1692, 216, 562, 417, 560, 1727, 224, 567,
+  240, 151, 557, 1027, 1028, 253, 45, 231, 158, 392,
+  250, 231, 2344, 1096, 557, 1126, 1127, 241, 561, 563,
+  564, 241, 430, 431, 432, 29, 30, 234, 436, 437,
+  438, 1731, 239, 560, 282, 1146, 2900, 2070, 1149, 1150,
+  335, 1741, 549, 550, 551, 2078, 1746, 1731, 24, 560,
+  2083, 2696, 2697, 2698, 2699, 2700, 2900, 1741, 1788, 560,
+  1171, 1172, 1746, 545, 546, 560, 1796, 543, 1771, 1846,
+  552, 553, 554, 555, 560, 1855, 52, 557, 1000, 557,
+  1104, 561, 306, 561, 1488, 2502, 306, 1699, 557, 563,
+  564, 1820, 561, 335, 133, 3113, 246, 1208, 560, 557,
+  557, 545, 2282, 561, 561, 1027, 1028, 557, 315, 557,
+  569, 561, 151, 561, 560, 557, 557, 557, 557, 561,
+  561, 561, 561, 330, 274, 545, 557, 545, 3225, 336,
+  561, 545, 546, 547, 548, 560, 3154, 344, 552, 553,
+  554, 555, 394, 2333, 560, 352, 3006, 354, 355, 568,
+  558, 557, 557, 557, 1758, 561, 561, 561, 549, 550,
+  551, 557, 402, 3181, 404, 561, 560, 1571, 557, 557,
+  410, 411, 561, 561, 150, 557, 557, 417, 557, 561,
+  561, 350, 561, 222, 2191, 217, 218, 557, 560, 165,
+  340, 561, 1303, 560, 557, 557, 570, 1291, 561, 561,
+  239, 177, 557, 557, 2381, 545, 561, 561, 557, 1388,
+  557, 557, 561, 557, 561, 561, 557, 561, 557, 545,
+  561, 557, 561, 1923, 557, 561, 392, 393, 561, 858,
+  859, 860, 861, 560, 210, 392, 393, 543, 544, 560,
+  480, 543, 544, 210, 211, 563, 564, 560, 2028, 545,
+  1980, 563, 564, 563, 564, 495, 496, 560, 1378, 1755,
+  1756, 659, 660, 2460, 2461, 49, 1377, 1147, 1148, 2613,
+  2614, 560, 248, 2615, 2616, 560, 315, 1388, 2641, 2642,
+  1391, 2044, 258, 1394, 560, 1379, 1970, 1398, 1399, 1383,
+  560, 330, 854, 855, 501, 856, 857, 336, 560, 506,
+  2451, 2452, 825, 826, 560, 344, 560, 560, 284, 285,
+  560, 1394, 575, 560, 560, 354, 355, 560, 330, 2096,
+  2050, 560, 560, 1727, 560, 560, 302, 303, 1826, 560,
+  560, 307, 308, 560, 545, 560, 147, 91, 345, 2260,
+  1460, 560, 549, 550, 551, 1456, 560, 560, 560, 1472,
+  560, 560, 419, 545, 560, 560, 560, 560, 560, 560,
+  560, 560, 560, 560, 560, 1476, 560, 560, 2082, 462,
+  560, 560, 560, 560, 560, 560, 1487, 1488, 560, 560,
+  560, 560, 1493, 560, 1788, 1409, 560, 560, 560, 560,
+  1501, 1415, 1796, 526, 299, 325, 131, 325, 26, 1510,
+  419, 367, 526, 520, 2016, 327, 2583, 2584, 204, 204,
+  557, 218, 557, 299, 521, 538, 514, 514, 463, 395,
+  396, 397, 1777, 504, 127, 491, 440, 1538, 481, 358,
+  2130, 1542, 521, 177, 440, 358, 216, 1548, 1549, 216,
+  216, 559, 1553, 106, 164, 349, 1850, 131, 218, 325,
+  139, 360, 218, 417, 1565, 484, 1565, 1565, 501, 1542,
+  1571, 1572, 501, 480, 1575, 1548, 1549, 506, 462, 133,
+  1392, 239, 560, 2347, 560, 356, 560, 560, 560, 8,
+  560, 560, 1565, 560, 560, 560, 560, 560, 560, 1411,
+  560, 1515, 560, 222, 364, 1519, 560, 560, 560, 560,
+  539, 560, 560, 560, 560, 560, 2236, 561, 560, 560,
+  549, 550, 551, 1537, 560, 2119, 492, 561, 560, 560,
+  560, 2701, 560, 560, 560, 560, 560, 560, 165, 560,
+  560, 11, 560, 1557, 560, 560, 560, 560, 560, 560,
+  560, 26, 560, 119, 560, 560, 176, 560, 330, 560,
+  560, 560, 560, 419, 2238, 560, 166, 560, 560, 560,
+  557, 2261, 561, 539, 564, 560, 558, 462, 561, 560,
+  560, 560, 560, 557, 526, 562, 1980, 464, 238, 560,
+  557, 164, 558, 51, 3144, 14, 557, 266, 1699, 327,
+  131, 2320, 176, 419, 526, 226, 572, 573, 574, 539,
+  229, 8, 358, 358, 231, 440, 2783, 1718, 358, 557,
+  81, 82, 83, 84, 85, 168, 1727, 349, 557, 560,
+  1714, 1715, 221, 1717, 282, 244, 325, 544, 417, 543,
+  3144, 35, 360, 558, 336, 1718, 147, 325, 318, 1561,
+  561, 1752, 514, 1754, 367, 561, 2050, 1758, 561, 318,
+  1761, 1762, 1763, 3070, 367, 110, 318, 1768, 1769, 561,
+  358, 561, 561, 561, 561, 561, 367, 561, 1692, 561,
+  561, 142, 143, 144, 145, 131, 2456, 1788, 561, 561,
+  557, 150, 561, 561, 318, 1796, 367, 561, 223, 1713,
+  2294, 210, 561, 2393, 561, 227, 3113, 561, 2843, 561,
+  557, 561, 211, 2483, 26, 2309, 1826, 113, 1732, 11,
+  1821, 576, 528, 576, 176, 525, 2893, 93, 218, 93,
+  191, 525, 193, 194, 195, 176, 557, 1838, 1839, 200,
+  560, 560, 46, 46, 11, 560, 558, 3154, 1762, 1850,
+  392, 561, 2346, 340, 2921, 167, 225, 2926, 167, 2353,
+  417, 557, 543, 1864, 151, 1864, 1864, 3271, 3272, 218,
+  2681, 417, 543, 1874, 3181, 3279, 3280, 210, 151, 435,
+  489, 301, 560, 560, 45, 367, 367, 66, 345, 557,
+  317, 1864, 561, 1705, 2468, 2469, 110, 14, 1812, 227,
+  561, 392, 561, 367, 561, 131, 545, 561, 2978, 561,
+  271, 272, 561, 561, 557, 557, 131, 367, 131, 1731,
+  561, 131, 345, 2137, 561, 561, 561, 557, 557, 1741,
+  557, 545, 223, 557, 1746, 561, 557, 557, 561, 287,
+  151, 3008, 2236, 227, 561, 2564, 557, 59, 560, 557,
+  1762, 557, 345, 115, 561, 557, 561, 561, 557, 2453,
+  1970, 561, 1963, 2032, 561, 561, 561, 19, 536, 21,
+  557, 3026, 557, 3026, 557, 557, 536, 561, 360, 1980,
+  32, 561, 1896, 360, 561, 561, 561, 429, 2282, 1973,
+  2059, 558, 2061, 557, 1978, 561, 557, 560, 1912, 3173,
+  119, 167, 557, 561, 365, 366, 557, 467, 557, 1923,
+  557, 3078, 177, 3080, 558, 2016, 561, 558, 561, 557,
+  2610, 560, 557, 2613, 2614, 2615, 2616, 560, 560, 560,
+  216, 2032, 557, 20, 2044, 2104, 392, 560, 216, 561,
+  151, 178, 2043, 227, 3218, 560, 227, 545, 561, 2050,
+  561, 561, 545, 131, 561, 561, 35, 505, 2059, 2060,
+  2061, 211, 35, 140, 227, 477, 477, 227, 227, 561,
+  560, 2565, 140, 231, 163, 163, 3131, 557, 3131, 188,
+  188, 537, 511, 418, 561, 557, 3153, 242, 557, 89,
+  558, 2761, 562, 178, 218, 3162, 2686, 2687, 560, 560,
+  14, 560, 2103, 2104, 2774, 557, 45, 35, 557, 231,
+  231, 2112, 558, 231, 482, 3182, 325, 231, 2119, 218,
+  2121, 177, 561, 557, 561, 190, 2127, 562, 2129, 490,
+  43, 561, 2751, 561, 560, 127, 560, 131, 35, 2112,
+  3207, 557, 560, 557, 561, 227, 561, 223, 561, 218,
+  557, 561, 557, 561, 218, 561, 2129, 561, 561, 561,
+  127, 561, 557, 561, 561, 561, 223, 561, 20, 561,
+  561, 560, 560, 560, 535, 560, 560, 557, 557, 557,
+  561, 153, 20, 20, 560, 282, 2400, 168, 168, 20,
+  543, 218, 224, 560, 254, 560, 115, 124, 560, 169,
+  557, 392, 223, 563, 223, 560, 2275, 2276, 2277, 35,
+  561, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+  377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
+  387, 388, 389, 390, 391, 2236, 2293, 289, 2307, 561,
+  561, 561, 558, 2300, 557, 560, 340, 35, 231, 557,
+  557, 14, 2253, 557, 560, 557, 557, 2850, 557, 557,
+  216, 14, 557, 216, 557, 89, 147, 218, 2842, 561,
+  560, 2944, 560, 2342, 2275, 2276, 2277, 560, 2347, 560,
+  557, 2900, 2351, 2842, 2954, 557, 560, 170, 2357, 560,
+  168, 168, 561, 2294, 561, 477, 2297, 35, 561, 561,
+  561, 561, 561, 2304, 557, 227, 2307, 227, 2309, 561,
+  35, 557, 561, 2314, 561, 560, 2317, 450, 2130, 557,
+  557, 131, 216, 358, 2325, 560, 560, 560, 558, 118,
+  455, 90, 3002, 557, 14, 557, 561, 127, 561, 356,
+  561, 2342, 561, 561, 561, 2346, 2347, 356, 2349, 14,
+  2351, 349, 2353, 2943, 561, 560, 2357, 358, 560, 560,
+  2361, 561, 2363, 561, 24, 561, 2367, 543, 2367, 2367,
+  560, 2372, 170, 469, 360, 560, 2290, 560, 3045, 2380,
+  2381, 561, 2381, 560, 2298, 437, 543, 544, 2361, 561,
+  187, 2305, 52, 317, 2367, 210, 187, 127, 133, 14,
+  483, 557, 2316, 243, 455, 211, 560, 2701, 2381, 560,
+  168, 560, 168, 168, 246, 557, 227, 3087, 363, 364,
+  365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+  375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
+  385, 340, 317, 523, 560, 231, 561, 469, 44, 2261,
+  557, 221, 2453, 44, 282, 561, 561, 560, 158, 246,
+  560, 221, 2519, 140, 221, 560, 512, 2468, 2469, 512,
+  53, 14, 2473, 2474, 561, 218, 35, 561, 360, 35,
+  360, 218, 561, 92, 261, 560, 141, 358, 2300, 141,
+  150, 557, 470, 4, 211, 4, 2308, 211, 2499, 360,
+  4, 211, 4, 211, 127, 165, 127, 557, 557, 3,
+  2739, 2512, 990, 1547, 2515, 1990, 2515, 177, 2669, 2058,
+  1118, 2320, 2078, 1399, 1479, 2526, 1485, 1415, 2082, 994,
+  2080, 8, 56, 3203, 56, 58, 846, 1761, 2539, 3113,
+  560, 2542, 2515, 2544, 1771, 619, 1034, 1059, 2549, 2843,
+  210, 8, 1794, 2043, 2555, 1572, 2850, 8, 8, 3229,
+  2837, 2474, 2563, 2836, 2565, 1389, 633, 630, 2750, 535,
+  1171, 3241, 1144, 2899, 3006, 521, 3246, 2319, 1829, 3019,
+  3154, 2393, 3125, 3244, 2585, 2586, 2585, 2585, 248, 3187,
+  2920, 2709, 3210, 3059, 2102, 2596, 1471, 2896, 258, 651,
+  2596, 2705, 2929, 2244, 2605, 2673, 1747, 3181, 2609, 31,
+  2611, 8, 2585, 2086, 3011, 1145, 1377, 2770, 982, 1839,
+  2850, 1042, 2363, 2060, 284, 285, 3149, 2285, 1545, 2681,
+  2469, 3147, 2605, 3243, 2609, 3280, 2609, 3279, 2482, 2977,
+  11, 1918, 302, 303, 852, 851, 2443, 307, 308, 2193,
+  704, 1298, 883, 1955, 853, 1183, 2117, 1183, 493, 1297,
+  279, 713, 248, 280, 1646, 279, 2238, 1300, 1262, 1301,
+  2191, 3076, 1705, 1923, 2388, 2868, -1, -1, -1, -1,
+  877, 2682, -1, -1, 2978, 2599, -1, -1, -1, 2603,
+  -1, -1, 744, -1, 746, -1, -1, -1, -1, -1,
+  -1, -1, -1, 2704, 2705, -1, -1, -1, -1, -1,
+  2711, -1, -1, -1, 2715, -1, 2717, 2718, -1, -1,
+  -1, -1, -1, -1, -1, 2726, -1, -1, -1, -1,
+  -1, -1, 2733, 2734, -1, 395, 396, 397, -1, -1,
+  -1, -1, -1, -1, 3174, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  812, -1, 2763, -1, -1, -1, -1, 2761, -1, -1,
+  -1, -1, 824, -1, 2775, 2776, -1, -1, 2779, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 2706, 845, 2708, -1, -1, -1, 2610, -1,
+  -1, 2613, 2614, 2615, 2616, 2719, 2618, -1, -1, -1,
+  -1, -1, -1, 2727, 866, -1, -1, -1, 870, 871,
+  872, 873, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 492, -1, -1, -1, -1, -1, -1, -1,
+  -1, 2842, 2843, -1, -1, -1, -1, -1, 2849, -1,
+  -1, -1, -1, -1, -1, 907, -1, -1, 2859, -1,
+  -1, -1, 914, 2864, -1, 2864, 2864, -1, -1, -1,
+  -1, -1, -1, -1, 2686, 2687, 2849, -1, -1, 539,
+  2881, -1, 2939, -1, -1, -1, -1, -1, -1, 2890,
+  -1, 2864, -1, -1, 2895, 2896, -1, -1, 558, -1,
+  560, -1, -1, -1, -1, -1, -1, -1, -1, 2910,
+  2722, -1, 572, 573, 574, -1, -1, -1, -1, -1,
+  -1, 2922, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 991,
+  2941, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 1013, -1, -1, -1, -1, -1, -1, 2941, -1,
+  -1, -1, -1, 1025, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 2986, -1, 2986, 2986, -1,
+  -1, 2992, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 3012, 2926, 2986, 3011, -1, -1, 3018, 3019, -1,
+  3011, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 3035, -1, -1, -1, -1, 3096,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 3055, -1, -1, -1, -1, -1,
+  -1, 3062, -1, -1, -1, -1, -1, 3068, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 3055, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 3094, -1, -1, -1, -1, 3167, 3013,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 3094, -1, -1, 3125, -1, 1178, 1179, 3185, -1,
+  1182, 2943, -1, 1185, -1, -1, 1188, -1, -1, -1,
+  -1, -1, -1, 3144, 1196, 1197, -1, -1, -1, -1,
+  -1, 1203, -1, -1, 1206, -1, -1, -1, -1, -1,
+  -1, -1, -1, 3164, -1, -1, 3167, -1, -1, -1,
+  -1, -1, 3173, -1, -1, -1, -1, -1, 1230, -1,
+  1232, 1233, -1, -1, 1236, 1237, 1238, 1239, -1, 1241,
+  -1, 3164, 1244, 1245, 1246, -1, 1248, -1, 1250, 1251,
+  1252, 1253, 1254, 1255, -1, -1, 1258, 1259, 1260, -1,
+  3124, 1263, 1264, 1265, 1266, 1267, -1, 3218, -1, -1,
+  1272, 1273, 1274, 1275, 1276, -1, 1278, -1, 1280, 1281,
+  1282, 1283, 1284, 1285, 1286, 1287, -1, -1, -1, -1,
+  -1, -1, 1294, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  1322, 1323, 1324, 1325, -1, -1, -1, -1, -1, 1331,
+  1332, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 1347, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 10,
   -1, -1, -1, 14, -1, -1, -1, -1, 19, -1,
-  -1, -1, 1944, 1945, -1, 1947, 1948, -1, 1950, 1951,
-  -1, 1953, -1, -1, -1, 36, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 36, -1, -1, -1, -1,
+  1402, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   51, -1, 53, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 64, 65, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, 76, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, 87, -1, -1, -1,
-  -1, 92, -1, 94, 95, -1, -1, 98, -1, -1,
-  -1, 102, -1, 2025, 105, -1, -1, -1, -1, -1,
-  -1, -1, -1, 114, 115, -1, -1, 118, -1, -1,
-  -1, 2043, -1, -1, -1, -1, 127, -1, -1, -1,
+  -1, 92, -1, 94, 95, 1457, -1, 98, -1, -1,
+  -1, 102, -1, -1, 105, -1, -1, -1, -1, -1,
+  -1, -1, -1, 114, 115, -1, 1478, 118, -1, -1,
+  -1, -1, -1, -1, -1, -1, 127, 128, -1, -1,
   131, -1, -1, -1, 135, -1, -1, -1, 139, 140,
-  141, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  141, -1, -1, -1, -1, -1, -1, 148, -1, -1,
   -1, -1, 153, -1, 155, -1, -1, 158, -1, -1,
   161, 162, -1, 164, -1, -1, 167, -1, -1, -1,
   -1, -1, -1, 174, -1, -1, -1, 178, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, 189, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 206, 10, -1, -1, -1,
-  -1, -1, -1, -1, -1, 19, -1, 218, -1, -1,
+  -1, -1, -1, -1, -1, 206, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 1578, 218, -1, -1,
   -1, -1, 223, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 36, 234, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 51, -1, 250,
-  251, 2173, -1, -1, -1, 256, 257, -1, -1, 260,
-  64, -1, -1, -1, -1, 266, 2188, 268, -1, -1,
-  -1, -1, 76, 274, -1, -1, -1, -1, -1, -1,
-  -1, 282, -1, 87, -1, -1, 2208, -1, 92, -1,
-  94, 95, 2214, 2215, -1, -1, -1, -1, 102, -1,
-  -1, 105, -1, -1, -1, -1, -1, -1, -1, -1,
-  114, -1, -1, -1, 118, -1, -1, -1, -1, -1,
-  2242, -1, -1, -1, 325, -1, -1, -1, -1, -1,
-  2252, 135, 333, -1, 335, 139, -1, -1, -1, 340,
-  -1, -1, -1, -1, 345, -1, 347, 348, 349, -1,
-  -1, -1, -1, -1, 158, -1, -1, 358, -1, 360,
+  -1, -1, -1, 234, -1, -1, -1, -1, -1, -1,
+  1602, -1, -1, -1, -1, -1, -1, -1, -1, 250,
+  251, 1613, -1, 1615, -1, 256, 257, -1, -1, 260,
+  -1, -1, -1, -1, -1, 266, -1, 268, -1, -1,
+  -1, -1, -1, 274, 1636, -1, -1, -1, -1, -1,
+  -1, 282, -1, -1, -1, -1, -1, -1, 1650, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 189, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 1677, 1678, -1, -1, -1,
+  -1, -1, -1, -1, 325, -1, -1, -1, -1, -1,
+  -1, -1, 333, -1, 335, -1, -1, -1, -1, 340,
+  -1, -1, 343, -1, 345, -1, 347, 348, 349, -1,
+  -1, -1, -1, -1, -1, -1, -1, 358, -1, 360,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 1745, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, 417, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, 427, -1, -1, -1,
-  234, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 250, 251, -1, -1,
-  -1, -1, 256, 454, -1, -1, 260, -1, -1, -1,
-  -1, -1, 266, -1, 268, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 282, -1,
-  -1, -1, 2404, -1, -1, 2407, -1, -1, 2410, -1,
-  2412, -1, -1, -1, 2416, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 507, -1, -1, 2431,
-  -1, 512, -1, 2435, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 2446, -1, -1, -1, -1, 333,
-  -1, -1, -1, -1, -1, -1, 340, -1, -1, -1,
-  -1, -1, -1, 347, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 556, 557, -1, -1, 560,
-  561, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 6, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 427, -1, -1, -1, -1, 21, -1,
-  -1, -1, -1, -1, -1, 28, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 39, 40, -1, -1,
-  454, -1, 45, -1, -1, 48, -1, -1, -1, -1,
-  -1, 54, 55, 56, -1, -1, -1, -1, -1, -1,
-  63, -1, -1, -1, 67, 68, 69, 70, 71, -1,
-  -1, -1, 75, -1, 77, 78, 79, 80, 81, -1,
-  -1, -1, -1, 86, -1, -1, 89, -1, -1, -1,
-  -1, -1, -1, 507, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 121, 122,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 2663, -1, -1, -1, -1, -1, -1, -1, 142,
-  -1, 2673, -1, -1, 147, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 158, 2688, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 174, -1, 176, -1, -1, 179, -1, 181, 182,
-  183, -1, 185, -1, -1, 188, -1, -1, -1, 192,
-  193, -1, -1, 196, -1, -1, 2728, 200, 201, -1,
-  203, -1, 2734, 2735, 2736, -1, -1, 2739, 211, 212,
-  -1, -1, 215, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 232,
-  -1, -1, -1, -1, 237, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 251, -1,
-  -1, -1, -1, -1, 257, -1, -1, -1, -1, -1,
-  -1, 264, -1, -1, 267, -1, -1, -1, 271, -1,
-  -1, -1, -1, 276, -1, -1, -1, 280, -1, 282,
-  -1, -1, -1, -1, -1, 2817, -1, 2819, -1, -1,
-  -1, -1, -1, -1, -1, 2827, -1, -1, -1, -1,
-  -1, 304, 305, -1, -1, -1, 309, 310, 311, 312,
-  313, 314, -1, -1, -1, 318, 319, 320, 321, -1,
-  -1, -1, -1, -1, -1, 328, -1, -1, 331, 332,
-  333, -1, -1, -1, 337, -1, -1, -1, 341, -1,
-  -1, 344, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 365, -1, -1, 368, 369, 370, 371, 372,
-  373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
-  383, 384, 385, 386, 387, 388, 389, 390, 391, 2921,
-  2922, -1, -1, -1, -1, 398, -1, 400, 401, 402,
-  403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
-  413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
-  423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
-  433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
-  443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
-  453, -1, 455, 456, 457, 458, 459, 460, 461, 462,
-  463, 464, 465, 466, 467, 468, 469, -1, 471, 472,
-  473, -1, 475, 476, 477, 478, 479, 480, 481, 482,
-  483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
-  493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
-  503, 504, 505, 506, 507, -1, 509, 510, 511, 512,
-  513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
-  523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
-  533, 534, 535, 536, 537, -1, 539, 540, 541, 542,
-  543, 544, 545, 546, 547, 548, -1, -1, -1, 552,
-  553, 554, 555, -1, 6, -1, 559, 560, -1, -1,
-  563, 564, 565, 566, -1, -1, -1, -1, 571, 21,
-  -1, -1, -1, 576, -1, -1, 28, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 39, 40, -1,
-  -1, -1, -1, 45, -1, -1, 48, -1, -1, -1,
-  -1, -1, 54, 55, 56, -1, -1, -1, -1, -1,
-  -1, 63, -1, -1, -1, 67, 68, 69, 70, 71,
-  -1, -1, -1, 75, -1, 77, 78, 79, 80, 81,
-  -1, -1, -1, -1, 86, -1, -1, 89, -1, -1,
+  -1, -1, -1, 454, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 119, -1, 121,
-  122, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 3221,
-  142, -1, -1, -1, -1, 147, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 158, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 174, -1, 176, -1, -1, 179, -1, 181,
-  182, 183, -1, 185, -1, -1, 188, -1, -1, -1,
-  192, 193, -1, -1, 196, -1, -1, -1, 200, 201,
-  -1, 203, -1, -1, -1, -1, -1, -1, 210, 211,
-  212, -1, -1, 215, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 1859, -1, -1,
+  1862, -1, -1, -1, -1, -1, 507, -1, -1, -1,
+  -1, 512, -1, -1, -1, 1877, -1, 1879, -1, -1,
+  1882, -1, -1, -1, -1, 1887, 1888, 1889, -1, -1,
+  1892, 1893, 1894, 1895, -1, -1, -1, -1, -1, 1901,
+  1902, -1, 1904, 1905, -1, 1907, -1, -1, 1910, -1,
+  -1, -1, -1, -1, -1, 556, 557, 1919, 1920, 560,
+  561, 0, -1, 1925, -1, -1, -1, -1, -1, -1,
+  -1, 10, -1, -1, -1, 14, -1, -1, -1, -1,
+  19, -1, -1, -1, 1946, 1947, -1, 1949, 1950, -1,
+  1952, 1953, -1, 1955, -1, -1, -1, 36, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 51, -1, 53, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 64, 65, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 76, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 87, -1,
+  -1, -1, -1, 92, -1, 94, 95, -1, -1, 98,
+  -1, -1, -1, 102, -1, 2027, 105, -1, -1, -1,
+  -1, -1, -1, -1, -1, 114, 115, -1, -1, 118,
+  -1, -1, -1, 2045, -1, -1, -1, -1, 127, -1,
+  -1, -1, 131, -1, -1, -1, 135, -1, -1, -1,
+  139, 140, 141, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 153, -1, 155, -1, -1, 158,
+  -1, -1, 161, 162, -1, 164, -1, -1, 167, -1,
+  -1, -1, -1, -1, -1, 174, -1, -1, -1, 178,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  189, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 206, 10, -1,
+  -1, -1, -1, -1, -1, -1, -1, 19, -1, 218,
+  -1, -1, -1, -1, 223, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 36, 234, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 51,
+  -1, 250, 251, 2175, -1, -1, -1, 256, 257, -1,
+  -1, 260, 64, -1, -1, -1, -1, 266, 2190, 268,
+  -1, -1, -1, -1, 76, 274, -1, -1, -1, -1,
+  -1, -1, -1, 282, -1, 87, -1, -1, 2210, -1,
+  92, -1, 94, 95, 2216, 2217, -1, -1, -1, -1,
+  102, -1, -1, 105, -1, -1, -1, -1, -1, -1,
+  -1, -1, 114, -1, -1, -1, 118, -1, -1, -1,
+  -1, -1, 2244, -1, -1, -1, 325, -1, -1, -1,
+  -1, -1, 2254, 135, 333, -1, 335, 139, -1, -1,
+  -1, 340, -1, -1, -1, -1, 345, -1, 347, 348,
+  349, -1, -1, -1, -1, -1, 158, -1, -1, 358,
+  -1, 360, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 189, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 417, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 427, -1,
+  -1, -1, 234, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 250, 251,
+  -1, -1, -1, -1, 256, 454, -1, -1, 260, -1,
+  -1, -1, -1, -1, 266, -1, 268, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  282, -1, -1, -1, 2406, -1, -1, 2409, -1, -1,
+  2412, -1, 2414, -1, -1, -1, 2418, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 507, -1,
+  -1, 2433, -1, 512, -1, 2437, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 2448, -1, -1, -1,
+  -1, 333, -1, -1, -1, -1, -1, -1, 340, -1,
+  -1, -1, -1, -1, -1, 347, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 556, 557, -1,
+  -1, 560, 561, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 6, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 427, -1, -1, -1, -1,
+  21, -1, -1, -1, -1, -1, -1, 28, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 39, 40,
+  -1, -1, 454, -1, 45, -1, -1, 48, -1, -1,
+  -1, -1, -1, 54, 55, 56, -1, -1, -1, -1,
+  -1, -1, 63, -1, -1, -1, 67, 68, 69, 70,
+  71, -1, -1, -1, 75, -1, 77, 78, 79, 80,
+  81, -1, -1, -1, -1, 86, -1, -1, 89, -1,
+  -1, -1, -1, -1, -1, 507, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  232, -1, -1, -1, -1, 237, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 251,
-  -1, -1, -1, -1, -1, 257, -1, -1, -1, -1,
-  -1, -1, 264, -1, -1, 267, -1, -1, -1, 271,
-  -1, -1, -1, -1, 276, -1, -1, -1, 280, -1,
-  282, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 304, 305, -1, -1, -1, 309, 310, 311,
-  312, 313, 314, -1, -1, -1, 318, 319, 320, 321,
-  -1, -1, -1, -1, -1, -1, 328, -1, -1, 331,
-  332, 333, -1, -1, -1, 337, -1, -1, -1, 341,
-  -1, -1, 344, -1, -1, -1, -1, -1, -1, -1,
+  121, 122, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 2665, -1, -1, -1, -1, -1, -1,
+  -1, 142, -1, 2675, -1, -1, 147, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 158, 2690, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 365, -1, -1, 368, 369, 370, 371,
-  372, 373, 374, 375, 376, 377, 378, 379, 380, 381,
-  382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
-  -1, -1, -1, -1, -1, -1, 398, -1, 400, 401,
-  402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
-  412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
-  422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
-  432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
-  442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
-  452, 453, -1, 455, 456, 457, 458, 459, 460, 461,
-  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
-  472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
-  482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
-  492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
-  502, 503, 504, 505, 506, 507, -1, 509, 510, 511,
-  512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
-  522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
-  532, 533, 534, 535, 536, 537, -1, 539, 540, 541,
-  542, 543, 544, 545, 546, 547, 548, -1, -1, -1,
-  552, 553, 554, 555, -1, -1, 6, 559, 560, -1,
-  -1, 563, 564, 565, 566, -1, -1, -1, -1, 571,
-  572, 21, -1, 575, -1, -1, -1, -1, 28, -1,
+  -1, -1, -1, 174, -1, 176, -1, -1, 179, -1,
+  181, 182, 183, -1, 185, -1, -1, 188, -1, -1,
+  -1, 192, 193, -1, -1, 196, -1, -1, 2730, 200,
+  201, -1, 203, -1, 2736, 2737, 2738, -1, -1, 2741,
+  211, 212, -1, -1, 215, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 232, -1, -1, -1, -1, 237, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  251, -1, -1, -1, -1, -1, 257, -1, -1, -1,
+  -1, -1, -1, 264, -1, -1, 267, -1, -1, -1,
+  271, -1, -1, -1, -1, 276, -1, -1, -1, 280,
+  -1, 282, -1, -1, -1, -1, -1, 2819, -1, 2821,
+  -1, -1, -1, -1, -1, -1, -1, 2829, -1, -1,
+  -1, -1, -1, 304, 305, -1, -1, -1, 309, 310,
+  311, 312, 313, 314, -1, -1, -1, 318, 319, 320,
+  321, -1, -1, -1, -1, -1, -1, 328, -1, -1,
+  331, 332, 333, -1, -1, -1, 337, -1, -1, -1,
+  341, -1, -1, 344, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 365, -1, -1, 368, 369, 370,
+  371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+  381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+  391, 2923, 2924, -1, -1, -1, -1, 398, -1, 400,
+  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+  451, 452, 453, -1, 455, 456, 457, 458, 459, 460,
+  461, 462, 463, 464, 465, 466, 467, 468, 469, -1,
+  471, 472, 473, -1, 475, 476, 477, 478, 479, 480,
+  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
+  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, -1, 539, 540,
+  541, 542, 543, 544, 545, 546, 547, 548, -1, -1,
+  -1, 552, 553, 554, 555, -1, 6, -1, 559, 560,
+  -1, -1, 563, 564, 565, 566, -1, -1, -1, -1,
+  571, 21, -1, -1, -1, 576, -1, -1, 28, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, 39,
   40, -1, -1, -1, -1, 45, -1, -1, 48, -1,
   -1, -1, -1, -1, 54, 55, 56, -1, -1, -1,
@@ -9439,17 +9387,17 @@ static const short int yycheck[] = {
   80, 81, -1, -1, -1, -1, 86, -1, -1, 89,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 119,
   -1, 121, 122, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 142, -1, -1, -1, -1, 147, -1, -1,
+  -1, 3223, 142, -1, -1, -1, -1, 147, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, 158, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, 174, -1, 176, -1, -1, 179,
   -1, 181, 182, 183, -1, 185, -1, -1, 188, -1,
   -1, -1, 192, 193, -1, -1, 196, -1, -1, -1,
   200, 201, -1, 203, -1, -1, -1, -1, -1, -1,
-  -1, 211, 212, -1, -1, 215, -1, -1, -1, -1,
+  210, 211, 212, -1, -1, 215, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, 232, -1, -1, -1, -1, 237, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -9483,65 +9431,10 @@ static const short int yycheck[] = {
   520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
   530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
   540, 541, 542, 543, 544, 545, 546, 547, 548, -1,
-  -1, -1, 552, 553, 554, 555, -1, 6, -1, 559,
+  -1, -1, 552, 553, 554, 555, -1, -1, 6, 559,
   560, -1, -1, 563, 564, 565, 566, -1, -1, -1,
-  -1, 571, 21, -1, -1, 575, -1, -1, -1, 28,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  39, 40, -1, -1, -1, -1, 45, -1, -1, 48,
-  -1, -1, -1, -1, -1, 54, 55, 56, -1, -1,
-  -1, -1, -1, -1, 63, -1, -1, -1, 67, 68,
-  69, 70, 71, -1, -1, -1, 75, -1, 77, 78,
-  79, 80, 81, -1, -1, -1, -1, 86, -1, -1,
-  89, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 121, 122, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 142, -1, -1, -1, -1, 147, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 158,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 174, -1, 176, -1, -1,
-  179, -1, 181, 182, 183, -1, 185, -1, -1, 188,
-  -1, -1, -1, 192, 193, -1, -1, 196, -1, -1,
-  -1, 200, 201, -1, 203, -1, -1, -1, -1, -1,
-  -1, -1, 211, 212, -1, -1, 215, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 232, -1, -1, -1, -1, 237, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 251, -1, -1, -1, -1, -1, 257, -1,
-  -1, -1, -1, -1, -1, 264, -1, -1, 267, -1,
-  -1, -1, 271, -1, -1, -1, -1, 276, -1, -1,
-  -1, 280, -1, 282, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 304, 305, -1, -1, -1,
-  309, 310, 311, 312, 313, 314, -1, -1, -1, 318,
-  319, 320, 321, -1, -1, -1, -1, -1, -1, 328,
-  -1, -1, 331, 332, 333, -1, -1, -1, 337, -1,
-  -1, -1, 341, -1, -1, 344, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 365, -1, -1, 368,
-  369, 370, 371, 372, 373, 374, 375, 376, 377, 378,
-  379, 380, 381, 382, 383, 384, 385, 386, 387, 388,
-  389, 390, 391, -1, -1, -1, -1, -1, -1, 398,
-  -1, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
-  539, 540, 541, 542, 543, 544, 545, 546, 547, 548,
-  -1, -1, -1, 552, 553, 554, 555, -1, 6, -1,
-  559, 560, -1, -1, 563, 564, 565, 566, -1, -1,
-  -1, -1, 571, 21, -1, -1, 575, -1, -1, -1,
-  28, -1, -1, -1, -1, -1, -1, -1, 36, -1,
+  -1, 571, 572, 21, -1, 575, -1, -1, -1, -1,
+  28, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, 39, 40, -1, -1, -1, -1, 45, -1, -1,
   48, -1, -1, -1, -1, -1, 54, 55, 56, -1,
   -1, -1, -1, -1, -1, 63, -1, -1, -1, 67,
@@ -9550,7 +9443,7 @@ static const short int yycheck[] = {
   -1, 89, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 119, -1, 121, 122, -1, -1, -1, -1, -1,
+  -1, -1, -1, 121, 122, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, 142, -1, -1, -1, -1, 147,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -9559,7 +9452,7 @@ static const short int yycheck[] = {
   -1, 179, -1, 181, 182, 183, -1, 185, -1, -1,
   188, -1, -1, -1, 192, 193, -1, -1, 196, -1,
   -1, -1, 200, 201, -1, 203, -1, -1, -1, -1,
-  -1, -1, 210, 211, 212, -1, -1, 215, -1, -1,
+  -1, -1, -1, 211, 212, -1, -1, 215, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, 232, -1, -1, -1, -1, 237,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -9593,11 +9486,66 @@ static const short int yycheck[] = {
   518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
   528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
   -1, 539, 540, 541, 542, 543, 544, 545, 546, 547,
-  548, -1, -1, -1, 552, 553, 554, 555, -1, -1,
-  6, 559, 560, -1, -1, 563, 564, 565, 566, -1,
-  -1, -1, -1, 571, 572, 21, -1, -1, -1, -1,
+  548, -1, -1, -1, 552, 553, 554, 555, -1, 6,
+  -1, 559, 560, -1, -1, 563, 564, 565, 566, -1,
+  -1, -1, -1, 571, 21, -1, -1, 575, -1, -1,
+  -1, 28, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 39, 40, -1, -1, -1, -1, 45, -1,
+  -1, 48, -1, -1, -1, -1, -1, 54, 55, 56,
+  -1, -1, -1, -1, -1, -1, 63, -1, -1, -1,
+  67, 68, 69, 70, 71, -1, -1, -1, 75, -1,
+  77, 78, 79, 80, 81, -1, -1, -1, -1, 86,
+  -1, -1, 89, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 121, 122, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 142, -1, -1, -1, -1,
+  147, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 158, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 174, -1, 176,
+  -1, -1, 179, -1, 181, 182, 183, -1, 185, -1,
+  -1, 188, -1, -1, -1, 192, 193, -1, -1, 196,
+  -1, -1, -1, 200, 201, -1, 203, -1, -1, -1,
+  -1, -1, -1, -1, 211, 212, -1, -1, 215, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 232, -1, -1, -1, -1,
+  237, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 251, -1, -1, -1, -1, -1,
+  257, -1, -1, -1, -1, -1, -1, 264, -1, -1,
+  267, -1, -1, -1, 271, -1, -1, -1, -1, 276,
+  -1, -1, -1, 280, -1, 282, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 304, 305, -1,
+  -1, -1, 309, 310, 311, 312, 313, 314, -1, -1,
+  -1, 318, 319, 320, 321, -1, -1, -1, -1, -1,
+  -1, 328, -1, -1, 331, 332, 333, -1, -1, -1,
+  337, -1, -1, -1, 341, -1, -1, 344, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 365, -1,
+  -1, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+  377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
+  387, 388, 389, 390, 391, -1, -1, -1, -1, -1,
+  -1, 398, -1, 400, 401, 402, 403, 404, 405, 406,
+  407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+  417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+  427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
+  437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+  447, 448, 449, 450, 451, 452, 453, -1, 455, 456,
+  457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+  467, 468, 469, -1, 471, 472, 473, -1, 475, 476,
+  477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+  487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+  497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+  507, -1, 509, 510, 511, 512, 513, 514, 515, 516,
+  517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
+  527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+  537, -1, 539, 540, 541, 542, 543, 544, 545, 546,
+  547, 548, -1, -1, -1, 552, 553, 554, 555, -1,
+  6, -1, 559, 560, -1, -1, 563, 564, 565, 566,
+  -1, -1, -1, -1, 571, 21, -1, -1, 575, -1,
   -1, -1, 28, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 39, 40, -1, -1, -1, -1, 45,
+  36, -1, -1, 39, 40, -1, -1, -1, -1, 45,
   -1, -1, 48, -1, -1, -1, -1, -1, 54, 55,
   56, -1, -1, -1, -1, -1, -1, 63, -1, -1,
   -1, 67, 68, 69, 70, 71, -1, -1, -1, 75,
@@ -9650,17 +9598,17 @@ static const short int yycheck[] = {
   536, 537, -1, 539, 540, 541, 542, 543, 544, 545,
   546, 547, 548, -1, -1, -1, 552, 553, 554, 555,
   -1, -1, 6, 559, 560, -1, -1, 563, 564, 565,
-  566, -1, -1, 17, -1, 571, 572, 21, -1, -1,
+  566, -1, -1, -1, -1, 571, 572, 21, -1, -1,
   -1, -1, -1, -1, 28, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, 39, 40, -1, -1, -1,
   -1, 45, -1, -1, 48, -1, -1, -1, -1, -1,
   54, 55, 56, -1, -1, -1, -1, -1, -1, 63,
-  -1, -1, -1, 67, 68, 69, 70, 71, 72, -1,
+  -1, -1, -1, 67, 68, 69, 70, 71, -1, -1,
   -1, 75, -1, 77, 78, 79, 80, 81, -1, -1,
   -1, -1, 86, -1, -1, 89, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 121, 122, -1,
+  -1, -1, -1, -1, -1, 119, -1, 121, 122, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, 142, -1,
   -1, -1, -1, 147, -1, -1, -1, -1, -1, -1,
@@ -9669,14 +9617,14 @@ static const short int yycheck[] = {
   174, -1, 176, -1, -1, 179, -1, 181, 182, 183,
   -1, 185, -1, -1, 188, -1, -1, -1, 192, 193,
   -1, -1, 196, -1, -1, -1, 200, 201, -1, 203,
-  -1, -1, -1, -1, -1, -1, -1, 211, 212, -1,
+  -1, -1, -1, -1, -1, -1, 210, 211, 212, -1,
   -1, 215, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, 232, -1,
-  -1, -1, -1, 237, -1, -1, -1, -1, 242, -1,
+  -1, -1, -1, 237, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, 251, -1, -1,
   -1, -1, -1, 257, -1, -1, -1, -1, -1, -1,
   264, -1, -1, 267, -1, -1, -1, 271, -1, -1,
-  -1, -1, 276, -1, 278, -1, 280, -1, 282, -1,
+  -1, -1, 276, -1, -1, -1, 280, -1, 282, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   304, 305, -1, -1, -1, 309, 310, 311, 312, 313,
@@ -9704,69 +9652,14 @@ static const short int yycheck[] = {
   524, 525, 526, 527, 528, 529, 530, 531, 532, 533,
   534, 535, 536, 537, -1, 539, 540, 541, 542, 543,
   544, 545, 546, 547, 548, -1, -1, -1, 552, 553,
-  554, 555, -1, 6, -1, 559, 560, -1, -1, 563,
-  564, 565, 566, -1, -1, -1, -1, 571, 21, -1,
-  -1, -1, -1, -1, -1, 28, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 39, 40, -1, -1,
-  -1, -1, 45, -1, -1, 48, -1, -1, -1, -1,
-  -1, 54, 55, 56, -1, -1, -1, -1, -1, -1,
-  63, -1, -1, -1, 67, 68, 69, 70, 71, -1,
-  -1, -1, 75, -1, 77, 78, 79, 80, 81, -1,
-  -1, -1, -1, 86, -1, -1, 89, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 121, 122,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 142,
-  -1, -1, -1, -1, 147, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 158, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 174, -1, 176, -1, -1, 179, -1, 181, 182,
-  183, -1, 185, -1, -1, 188, -1, -1, -1, 192,
-  193, -1, -1, 196, -1, -1, -1, 200, 201, -1,
-  203, -1, -1, -1, -1, -1, -1, -1, 211, 212,
-  -1, -1, 215, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 232,
-  -1, -1, -1, -1, 237, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 251, -1,
-  -1, -1, -1, -1, 257, -1, -1, -1, -1, -1,
-  -1, 264, -1, -1, 267, -1, -1, -1, 271, -1,
-  -1, 274, -1, 276, -1, -1, -1, 280, -1, 282,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 304, 305, -1, -1, -1, 309, 310, 311, 312,
-  313, 314, -1, -1, -1, 318, 319, 320, 321, -1,
-  -1, -1, -1, -1, -1, 328, -1, -1, 331, 332,
-  333, -1, -1, -1, 337, -1, -1, -1, 341, -1,
-  -1, 344, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 365, -1, -1, 368, 369, 370, 371, 372,
-  373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
-  383, 384, 385, 386, 387, 388, 389, 390, 391, -1,
-  -1, -1, -1, -1, -1, 398, -1, 400, 401, 402,
-  403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
-  413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
-  423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
-  433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
-  443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
-  453, -1, 455, 456, 457, 458, 459, 460, 461, 462,
-  463, 464, 465, 466, 467, 468, 469, -1, 471, 472,
-  473, -1, 475, 476, 477, 478, 479, 480, 481, 482,
-  483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
-  493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
-  503, 504, 505, 506, 507, -1, 509, 510, 511, 512,
-  513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
-  523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
-  533, 534, 535, 536, 537, -1, 539, 540, 541, 542,
-  543, 544, 545, 546, 547, 548, -1, -1, -1, 552,
-  553, 554, 555, -1, 6, -1, 559, 560, 561, -1,
-  563, 564, 565, 566, -1, -1, -1, -1, 571, 21,
+  554, 555, -1, -1, 6, 559, 560, -1, -1, 563,
+  564, 565, 566, -1, -1, 17, -1, 571, 572, 21,
   -1, -1, -1, -1, -1, -1, 28, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, 39, 40, -1,
   -1, -1, -1, 45, -1, -1, 48, -1, -1, -1,
   -1, -1, 54, 55, 56, -1, -1, -1, -1, -1,
   -1, 63, -1, -1, -1, 67, 68, 69, 70, 71,
-  -1, -1, -1, 75, -1, 77, 78, 79, 80, 81,
+  72, -1, -1, 75, -1, 77, 78, 79, 80, 81,
   -1, -1, -1, -1, 86, -1, -1, 89, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -9783,10 +9676,10 @@ static const short int yycheck[] = {
   212, -1, -1, 215, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   232, -1, -1, -1, -1, 237, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 251,
+  242, -1, -1, -1, -1, -1, -1, -1, -1, 251,
   -1, -1, -1, -1, -1, 257, -1, -1, -1, -1,
   -1, -1, 264, -1, -1, 267, -1, -1, -1, 271,
-  -1, -1, -1, -1, 276, -1, -1, -1, 280, -1,
+  -1, -1, -1, -1, 276, -1, 278, -1, 280, -1,
   282, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, 304, 305, -1, -1, -1, 309, 310, 311,
@@ -9794,7 +9687,7 @@ static const short int yycheck[] = {
   -1, -1, -1, -1, -1, -1, 328, -1, -1, 331,
   332, 333, -1, -1, -1, 337, -1, -1, -1, 341,
   -1, -1, 344, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 356, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 365, -1, -1, 368, 369, 370, 371,
   372, 373, 374, 375, 376, 377, 378, 379, 380, 381,
   382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
@@ -9825,7 +9718,7 @@ static const short int yycheck[] = {
   81, -1, -1, -1, -1, 86, -1, -1, 89, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 119, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   121, 122, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, 142, -1, -1, -1, -1, 147, -1, -1, -1,
@@ -9841,7 +9734,7 @@ static const short int yycheck[] = {
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   251, -1, -1, -1, -1, -1, 257, -1, -1, -1,
   -1, -1, -1, 264, -1, -1, 267, -1, -1, -1,
-  271, -1, -1, -1, -1, 276, -1, -1, -1, 280,
+  271, -1, -1, 274, -1, 276, -1, -1, -1, 280,
   -1, 282, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 304, 305, -1, -1, -1, 309, 310,
@@ -9870,7 +9763,7 @@ static const short int yycheck[] = {
   531, 532, 533, 534, 535, 536, 537, -1, 539, 540,
   541, 542, 543, 544, 545, 546, 547, 548, -1, -1,
   -1, 552, 553, 554, 555, -1, 6, -1, 559, 560,
-  -1, -1, 563, 564, 565, 566, -1, -1, -1, -1,
+  561, -1, 563, 564, 565, 566, -1, -1, -1, -1,
   571, 21, -1, -1, -1, -1, -1, -1, 28, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, 39,
   40, -1, -1, -1, -1, 45, -1, -1, 48, -1,
@@ -9896,7 +9789,7 @@ static const short int yycheck[] = {
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, 251, -1, -1, -1, -1, -1, 257, -1, -1,
   -1, -1, -1, -1, 264, -1, -1, 267, -1, -1,
-  -1, 271, -1, -1, 274, -1, 276, -1, -1, -1,
+  -1, 271, -1, -1, -1, -1, 276, -1, -1, -1,
   280, -1, 282, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, 304, 305, -1, -1, -1, 309,
@@ -9904,7 +9797,7 @@ static const short int yycheck[] = {
   320, 321, -1, -1, -1, -1, -1, -1, 328, -1,
   -1, 331, 332, 333, -1, -1, -1, 337, -1, -1,
   -1, 341, -1, -1, 344, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 356, -1, -1, -1,
   -1, -1, -1, -1, -1, 365, -1, -1, 368, 369,
   370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
   380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
@@ -9936,7 +9829,7 @@ static const short int yycheck[] = {
   89, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 121, 122, -1, -1, -1, -1, -1, -1,
+  119, -1, 121, 122, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 142, -1, -1, -1, -1, 147, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, 158,
@@ -10006,7 +9899,7 @@ static const short int yycheck[] = {
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 251, -1, -1, -1, -1, -1, 257,
   -1, -1, -1, -1, -1, -1, 264, -1, -1, 267,
-  -1, -1, -1, 271, -1, -1, -1, -1, 276, -1,
+  -1, -1, -1, 271, -1, -1, 274, -1, 276, -1,
   -1, -1, 280, -1, 282, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, 304, 305, -1, -1,
@@ -10145,221 +10038,442 @@ static const short int yycheck[] = {
   526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
   536, 537, -1, 539, 540, 541, 542, 543, 544, 545,
   546, 547, 548, -1, -1, -1, 552, 553, 554, 555,
-  -1, -1, 0, 559, 560, -1, -1, 563, 564, 565,
-  566, -1, 10, -1, -1, 571, 14, -1, -1, -1,
-  -1, 19, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 36, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 51, -1, 53, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 64, 65, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 76, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 87,
-  -1, -1, -1, -1, 92, -1, 94, 95, -1, -1,
-  98, -1, -1, -1, 102, -1, -1, 105, -1, -1,
-  -1, -1, -1, -1, -1, -1, 114, 115, -1, -1,
-  118, -1, -1, -1, -1, -1, -1, -1, -1, 127,
-  -1, -1, -1, 131, -1, -1, -1, 135, -1, -1,
-  -1, 139, 140, 141, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 153, -1, 155, -1, -1,
-  158, -1, -1, 161, 162, -1, 164, -1, -1, 167,
-  -1, -1, -1, -1, -1, -1, 174, -1, -1, -1,
-  178, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 189, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 206, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  218, -1, -1, -1, -1, 223, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 234, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 250, 251, -1, -1, -1, -1, 256, 257,
-  -1, -1, 260, -1, -1, -1, -1, -1, 266, 0,
-  268, -1, -1, -1, -1, -1, 274, -1, -1, 10,
-  -1, -1, -1, 14, 282, -1, -1, -1, 19, -1,
+  -1, 6, -1, 559, 560, -1, -1, 563, 564, 565,
+  566, -1, -1, -1, -1, 571, 21, -1, -1, -1,
+  -1, -1, -1, 28, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 39, 40, -1, -1, -1, -1,
+  45, -1, -1, 48, -1, -1, -1, -1, -1, 54,
+  55, 56, -1, -1, -1, -1, -1, -1, 63, -1,
+  -1, -1, 67, 68, 69, 70, 71, -1, -1, -1,
+  75, -1, 77, 78, 79, 80, 81, -1, -1, -1,
+  -1, 86, -1, -1, 89, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 121, 122, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 142, -1, -1,
+  -1, -1, 147, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 158, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 174,
+  -1, 176, -1, -1, 179, -1, 181, 182, 183, -1,
+  185, -1, -1, 188, -1, -1, -1, 192, 193, -1,
+  -1, 196, -1, -1, -1, 200, 201, -1, 203, -1,
+  -1, -1, -1, -1, -1, -1, 211, 212, -1, -1,
+  215, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 232, -1, -1,
+  -1, -1, 237, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 251, -1, -1, -1,
+  -1, -1, 257, -1, -1, -1, -1, -1, -1, 264,
+  -1, -1, 267, -1, -1, -1, 271, -1, -1, -1,
+  -1, 276, -1, -1, -1, 280, -1, 282, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 304,
+  305, -1, -1, -1, 309, 310, 311, 312, 313, 314,
+  -1, -1, -1, 318, 319, 320, 321, -1, -1, -1,
+  -1, -1, -1, 328, -1, -1, 331, 332, 333, -1,
+  -1, -1, 337, -1, -1, -1, 341, -1, -1, 344,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  365, -1, -1, 368, 369, 370, 371, 372, 373, 374,
+  375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
+  385, 386, 387, 388, 389, 390, 391, -1, -1, -1,
+  -1, -1, -1, 398, -1, 400, 401, 402, 403, 404,
+  405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+  415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
+  425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
+  435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+  445, 446, 447, 448, 449, 450, 451, 452, 453, -1,
+  455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
+  465, 466, 467, 468, 469, -1, 471, 472, 473, -1,
+  475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+  485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+  495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
+  505, 506, 507, -1, 509, 510, 511, 512, 513, 514,
+  515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
+  525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+  535, 536, 537, -1, 539, 540, 541, 542, 543, 544,
+  545, 546, 547, 548, -1, -1, -1, 552, 553, 554,
+  555, -1, 6, -1, 559, 560, -1, -1, 563, 564,
+  565, 566, -1, -1, -1, -1, 571, 21, -1, -1,
+  -1, -1, -1, -1, 28, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 39, 40, -1, -1, -1,
+  -1, 45, -1, -1, 48, -1, -1, -1, -1, -1,
+  54, 55, 56, -1, -1, -1, -1, -1, -1, 63,
+  -1, -1, -1, 67, 68, 69, 70, 71, -1, -1,
+  -1, 75, -1, 77, 78, 79, 80, 81, -1, -1,
+  -1, -1, 86, -1, -1, 89, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 36, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  51, -1, 53, -1, -1, -1, -1, 325, -1, -1,
-  -1, -1, -1, 64, 65, 333, -1, 335, -1, -1,
-  -1, -1, 340, -1, -1, 76, -1, 345, -1, 347,
-  348, 349, -1, -1, -1, -1, 87, -1, -1, -1,
-  358, 92, 360, 94, 95, -1, -1, 98, -1, -1,
-  -1, 102, -1, -1, 105, -1, -1, -1, -1, -1,
-  -1, -1, -1, 114, 115, -1, -1, 118, -1, -1,
-  -1, -1, -1, -1, -1, -1, 127, -1, -1, -1,
-  131, -1, -1, -1, 135, -1, -1, -1, 139, 140,
-  141, -1, -1, -1, -1, -1, -1, -1, -1, 417,
-  -1, -1, 153, -1, 155, -1, -1, 158, -1, 427,
-  161, 162, -1, 164, -1, -1, 167, -1, -1, -1,
-  -1, -1, -1, 174, -1, -1, -1, 178, -1, -1,
-  -1, -1, -1, -1, -1, -1, 454, -1, 189, -1,
+  -1, -1, -1, -1, -1, -1, -1, 121, 122, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 206, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 218, -1, -1,
-  -1, -1, 223, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 234, -1, -1, -1, -1, -1, 507,
-  -1, -1, -1, -1, 512, -1, -1, -1, -1, 250,
-  251, -1, -1, -1, -1, 256, 257, -1, -1, 260,
-  -1, -1, -1, -1, -1, 266, -1, 268, -1, -1,
-  -1, -1, -1, 274, -1, -1, -1, -1, -1, -1,
-  -1, 282, -1, -1, -1, -1, -1, -1, 556, 557,
-  -1, -1, 560, 561, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, -1, -1,
-  -1, -1, -1, -1, 7, -1, -1, 10, -1, -1,
-  -1, 14, -1, -1, 325, -1, 19, -1, -1, -1,
-  -1, -1, 333, -1, 335, -1, -1, -1, -1, 340,
-  -1, -1, -1, 36, 345, -1, 347, 348, 349, -1,
-  -1, 44, -1, -1, -1, -1, -1, 358, 51, 360,
-  -1, -1, -1, -1, -1, 58, -1, -1, -1, -1,
-  -1, 64, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 76, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 87, -1, 89, -1, -1, 92,
-  -1, 94, 95, -1, -1, -1, -1, -1, -1, 102,
-  -1, -1, 105, -1, -1, -1, 417, -1, -1, -1,
-  -1, 114, -1, -1, -1, 118, 427, -1, -1, -1,
-  -1, 124, 125, -1, -1, -1, 129, -1, -1, -1,
-  133, -1, 135, -1, -1, -1, 139, -1, -1, -1,
-  -1, -1, -1, 454, -1, -1, -1, -1, -1, -1,
-  153, -1, -1, -1, -1, 158, -1, -1, -1, -1,
-  -1, -1, 165, -1, -1, -1, -1, 170, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 189, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 507, -1, -1, -1,
-  -1, 512, -1, -1, -1, -1, -1, 210, 211, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 231, -1,
-  -1, 234, -1, 236, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 246, -1, 556, 557, 250, 251, 560,
-  561, -1, -1, 256, -1, -1, -1, 260, -1, -1,
-  -1, -1, -1, 266, -1, 268, -1, -1, -1, -1,
-  -1, 274, -1, -1, 0, -1, -1, -1, -1, 282,
-  -1, 7, -1, 286, 10, -1, -1, -1, 14, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 142, -1,
+  -1, -1, -1, 147, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 158, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  174, -1, 176, -1, -1, 179, -1, 181, 182, 183,
+  -1, 185, -1, -1, 188, -1, -1, -1, 192, 193,
+  -1, -1, 196, -1, -1, -1, 200, 201, -1, 203,
+  -1, -1, -1, -1, -1, -1, -1, 211, 212, -1,
+  -1, 215, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 232, -1,
+  -1, -1, -1, 237, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 251, -1, -1,
+  -1, -1, -1, 257, -1, -1, -1, -1, -1, -1,
+  264, -1, -1, 267, -1, -1, -1, 271, -1, -1,
+  -1, -1, 276, -1, -1, -1, 280, -1, 282, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  304, 305, -1, -1, -1, 309, 310, 311, 312, 313,
+  314, -1, -1, -1, 318, 319, 320, 321, -1, -1,
+  -1, -1, -1, -1, 328, -1, -1, 331, 332, 333,
+  -1, -1, -1, 337, -1, -1, -1, 341, -1, -1,
+  344, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 365, -1, -1, 368, 369, 370, 371, 372, 373,
+  374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+  384, 385, 386, 387, 388, 389, 390, 391, -1, -1,
+  -1, -1, -1, -1, 398, -1, 400, 401, 402, 403,
+  404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
+  414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
+  424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+  434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+  444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+  -1, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+  464, 465, 466, 467, 468, 469, -1, 471, 472, 473,
+  -1, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+  484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
+  494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
+  504, 505, 506, 507, -1, 509, 510, 511, 512, 513,
+  514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+  524, 525, 526, 527, 528, 529, 530, 531, 532, 533,
+  534, 535, 536, 537, -1, 539, 540, 541, 542, 543,
+  544, 545, 546, 547, 548, -1, -1, -1, 552, 553,
+  554, 555, -1, -1, 0, 559, 560, -1, -1, 563,
+  564, 565, 566, -1, 10, -1, -1, 571, 14, -1,
   -1, -1, -1, 19, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  36, -1, -1, -1, -1, -1, -1, -1, 44, -1,
-  -1, -1, -1, -1, -1, 51, -1, -1, -1, -1,
-  333, -1, 58, 336, -1, -1, -1, 340, 64, -1,
-  -1, -1, -1, -1, 347, 348, 349, -1, -1, -1,
-  76, -1, -1, -1, -1, -1, -1, 360, -1, -1,
-  -1, 87, -1, 89, -1, -1, 92, -1, 94, 95,
-  -1, -1, -1, -1, -1, -1, 102, -1, -1, 105,
-  -1, -1, -1, -1, -1, -1, -1, -1, 114, -1,
-  -1, -1, 118, -1, -1, -1, -1, -1, 124, 125,
-  -1, 404, -1, 129, -1, -1, -1, 133, -1, 135,
-  -1, -1, -1, 139, 417, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 427, -1, -1, 153, -1, -1,
-  -1, -1, 158, -1, -1, -1, -1, -1, -1, 165,
-  -1, -1, -1, -1, 170, -1, -1, -1, -1, -1,
-  -1, 454, -1, -1, -1, -1, -1, -1, -1, -1,
+  36, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 51, -1, 53, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 64, 65,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  76, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 87, -1, -1, -1, -1, 92, -1, 94, 95,
+  -1, -1, 98, -1, -1, -1, 102, -1, -1, 105,
+  -1, -1, -1, -1, -1, -1, -1, -1, 114, 115,
+  -1, -1, 118, -1, -1, -1, -1, -1, -1, -1,
+  -1, 127, -1, -1, -1, 131, -1, -1, -1, 135,
+  -1, -1, -1, 139, 140, 141, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 153, -1, 155,
+  -1, -1, 158, -1, -1, 161, 162, -1, 164, -1,
+  -1, 167, -1, -1, -1, -1, -1, -1, 174, -1,
+  -1, -1, 178, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 189, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 210, 211, -1, -1, -1, -1,
+  206, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 218, -1, -1, -1, -1, 223, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 234, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 250, 251, -1, -1, -1, -1,
+  256, 257, -1, -1, 260, -1, -1, -1, -1, -1,
+  266, 0, 268, -1, -1, -1, -1, -1, 274, -1,
+  -1, 10, -1, -1, -1, 14, 282, -1, -1, -1,
+  19, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 36, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 51, -1, 53, -1, -1, -1, -1, 325,
+  -1, -1, -1, -1, -1, 64, 65, 333, -1, 335,
+  -1, -1, -1, -1, 340, -1, -1, 76, -1, 345,
+  -1, 347, 348, 349, -1, -1, -1, -1, 87, -1,
+  -1, -1, 358, 92, 360, 94, 95, -1, -1, 98,
+  -1, -1, -1, 102, -1, -1, 105, -1, -1, -1,
+  -1, -1, -1, -1, -1, 114, 115, -1, -1, 118,
+  -1, -1, -1, -1, -1, -1, -1, -1, 127, -1,
+  -1, -1, 131, -1, -1, -1, 135, -1, -1, -1,
+  139, 140, 141, -1, -1, -1, -1, -1, -1, -1,
+  -1, 417, -1, -1, 153, -1, 155, -1, -1, 158,
+  -1, 427, 161, 162, -1, 164, -1, -1, 167, -1,
+  -1, -1, -1, -1, -1, 174, -1, -1, -1, 178,
+  -1, -1, -1, -1, -1, -1, -1, -1, 454, -1,
+  189, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 206, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 218,
+  -1, -1, -1, -1, 223, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 234, -1, -1, -1, -1,
+  -1, 507, -1, -1, -1, -1, 512, -1, -1, -1,
+  -1, 250, 251, -1, -1, -1, -1, 256, 257, -1,
+  -1, 260, -1, -1, -1, -1, -1, 266, -1, 268,
+  -1, -1, -1, -1, -1, 274, -1, -1, -1, -1,
+  -1, -1, -1, 282, -1, -1, -1, -1, -1, -1,
+  556, 557, -1, -1, 560, 561, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
+  -1, -1, -1, -1, -1, -1, 7, -1, -1, 10,
+  -1, -1, -1, 14, -1, -1, 325, -1, 19, -1,
+  -1, -1, -1, -1, 333, -1, 335, -1, -1, -1,
+  -1, 340, -1, -1, -1, 36, 345, -1, 347, 348,
+  349, -1, -1, 44, -1, -1, -1, -1, -1, 358,
+  51, 360, -1, -1, -1, -1, -1, 58, -1, -1,
+  -1, -1, -1, 64, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 76, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 87, -1, 89, -1,
+  -1, 92, -1, 94, 95, -1, -1, -1, -1, -1,
+  -1, 102, -1, -1, 105, -1, -1, -1, 417, -1,
+  -1, -1, -1, 114, -1, -1, -1, 118, 427, -1,
+  -1, -1, -1, 124, 125, -1, -1, -1, 129, -1,
+  -1, -1, 133, -1, 135, -1, -1, -1, 139, -1,
+  -1, -1, -1, -1, -1, 454, -1, -1, -1, -1,
+  -1, -1, 153, -1, -1, -1, -1, 158, -1, -1,
+  -1, -1, -1, -1, 165, -1, -1, -1, -1, 170,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 507, 231, -1, -1, 234, -1,
-  236, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  246, -1, -1, -1, 250, 251, -1, -1, -1, -1,
-  256, -1, -1, -1, 260, -1, -1, -1, -1, -1,
-  266, -1, 268, -1, -1, -1, -1, -1, 274, -1,
-  -1, -1, -1, 556, 557, -1, 282, 560, 561, -1,
-  286, -1, -1, -1, -1, -1, -1, 6, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 21, -1, -1, -1, -1, -1, -1, 28,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  39, 40, -1, -1, -1, -1, 45, 333, -1, 48,
-  336, -1, -1, -1, 340, 54, 55, -1, -1, -1,
-  -1, 347, 348, 349, 63, -1, -1, -1, 67, 68,
-  69, 70, 71, -1, 360, -1, 75, -1, 77, 78,
-  79, 80, 81, -1, -1, -1, -1, 86, -1, -1,
-  89, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 189, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 507, -1,
+  -1, -1, -1, 512, -1, -1, -1, -1, -1, 210,
+  211, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 404, -1,
-  -1, -1, 121, 122, -1, -1, -1, -1, -1, -1,
-  -1, 417, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 427, -1, 142, -1, -1, -1, -1, 147, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 158,
-  -1, -1, -1, -1, -1, -1, -1, -1, 454, -1,
-  -1, -1, -1, -1, -1, 174, -1, 176, -1, -1,
-  179, -1, 181, 182, 183, -1, 185, -1, -1, 188,
-  -1, -1, -1, 192, 193, -1, -1, 196, -1, -1,
-  -1, 200, 201, -1, 203, -1, -1, -1, -1, -1,
-  -1, -1, 211, 212, -1, -1, 215, -1, -1, -1,
-  -1, 507, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 232, -1, -1, -1, -1, -1, -1,
+  231, -1, -1, 234, -1, 236, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 246, -1, 556, 557, 250,
+  251, 560, 561, -1, -1, 256, -1, -1, -1, 260,
+  -1, -1, -1, -1, -1, 266, -1, 268, -1, -1,
+  -1, -1, -1, 274, -1, -1, 0, -1, -1, -1,
+  -1, 282, -1, 7, -1, 286, 10, -1, -1, -1,
+  14, -1, -1, -1, -1, 19, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 36, -1, -1, -1, -1, -1, -1, -1,
+  44, -1, -1, -1, -1, -1, -1, 51, -1, -1,
+  -1, -1, 333, -1, 58, 336, -1, -1, -1, 340,
+  64, -1, -1, -1, -1, -1, 347, 348, 349, -1,
+  -1, -1, 76, -1, -1, -1, -1, -1, -1, 360,
+  -1, -1, -1, 87, -1, 89, -1, -1, 92, -1,
+  94, 95, -1, -1, -1, -1, -1, -1, 102, -1,
+  -1, 105, -1, -1, -1, -1, -1, -1, -1, -1,
+  114, -1, -1, -1, 118, -1, -1, -1, -1, -1,
+  124, 125, -1, 404, -1, 129, -1, -1, -1, 133,
+  -1, 135, -1, -1, -1, 139, 417, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 427, -1, -1, 153,
+  -1, -1, -1, -1, 158, -1, -1, -1, -1, -1,
+  -1, 165, -1, -1, -1, -1, 170, -1, -1, -1,
+  -1, -1, -1, 454, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 189, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 251, -1, -1, -1, -1, -1, 257, -1,
-  -1, -1, -1, -1, -1, 264, -1, -1, 267, -1,
-  556, 557, 271, -1, 560, 561, -1, 276, -1, -1,
-  -1, 280, -1, 282, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 210, 211, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 304, 305, -1, -1, -1,
-  309, 310, 311, 312, 313, 314, -1, -1, -1, 318,
-  319, 320, 321, -1, -1, -1, -1, -1, -1, 328,
-  -1, -1, 331, 332, 333, -1, -1, -1, 337, -1,
-  -1, -1, 341, -1, -1, 344, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 507, 231, -1, -1,
+  234, -1, 236, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 246, -1, -1, -1, 250, 251, -1, -1,
+  -1, -1, 256, -1, -1, -1, 260, -1, -1, -1,
+  -1, -1, 266, -1, 268, -1, -1, -1, -1, -1,
+  274, -1, -1, -1, -1, 556, 557, -1, 282, 560,
+  561, -1, 286, -1, -1, -1, -1, -1, -1, 6,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 365, -1, -1, 368,
+  -1, -1, -1, -1, 21, -1, -1, -1, -1, -1,
+  -1, 28, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 39, 40, -1, -1, -1, -1, 45, 333,
+  -1, 48, 336, -1, -1, -1, 340, 54, 55, -1,
+  -1, -1, -1, 347, 348, 349, 63, -1, -1, -1,
+  67, 68, 69, 70, 71, -1, 360, -1, 75, -1,
+  77, 78, 79, 80, 81, -1, -1, -1, -1, 86,
+  -1, -1, 89, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  404, -1, -1, -1, 121, 122, -1, -1, -1, -1,
+  -1, -1, -1, 417, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 427, -1, 142, -1, -1, -1, -1,
+  147, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 158, -1, -1, -1, -1, -1, -1, -1, -1,
+  454, -1, -1, -1, -1, -1, -1, 174, -1, 176,
+  -1, -1, 179, -1, 181, 182, 183, -1, 185, -1,
+  -1, 188, -1, -1, -1, 192, 193, -1, -1, 196,
+  -1, -1, -1, 200, 201, -1, 203, -1, -1, -1,
+  -1, -1, -1, -1, 211, 212, -1, -1, 215, -1,
+  -1, -1, -1, 507, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 232, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 251, -1, -1, -1, -1, -1,
+  257, -1, -1, -1, -1, -1, -1, 264, -1, -1,
+  267, -1, 556, 557, 271, -1, 560, 561, -1, 276,
+  -1, -1, -1, 280, -1, 282, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 304, 305, -1,
+  -1, -1, 309, 310, 311, 312, 313, 314, -1, -1,
+  -1, 318, 319, 320, 321, -1, -1, -1, -1, -1,
+  -1, 328, -1, -1, 331, 332, 333, -1, -1, -1,
+  337, -1, -1, -1, 341, -1, -1, 344, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 365, -1,
+  -1, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+  377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
+  387, 388, 389, 390, 391, -1, -1, -1, -1, -1,
+  -1, 398, -1, 400, 401, 402, 403, 404, 405, 406,
+  407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+  417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+  427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
+  437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+  447, 448, 449, 450, 451, 452, 453, -1, 455, 456,
+  457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+  467, 468, 469, -1, 471, 472, 473, -1, 475, 476,
+  477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+  487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+  497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+  507, -1, 509, 510, 511, 512, 513, 514, 515, 516,
+  517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
+  527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+  537, -1, 539, 540, 541, 542, 543, 544, 545, 546,
+  547, 548, -1, -1, 14, 552, 553, 554, 555, -1,
+  -1, -1, 559, 560, 24, -1, -1, -1, 565, 566,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 52, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 77, 78,
+  79, 80, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 122, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  150, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 165, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 177, -1, -1,
+  179, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 201, -1, 203, -1, -1, -1, -1, -1,
+  210, -1, 211, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 8, -1, -1, -1, -1, 248, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 258, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 276, -1, -1,
+  45, -1, -1, 282, 284, 285, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 302, 303, -1, -1, -1, 307, 308, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 318,
+  319, 320, 321, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 332, -1, -1, -1, -1, 337, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 131, -1, -1, 368,
   369, 370, 371, 372, 373, 374, 375, 376, 377, 378,
   379, 380, 381, 382, 383, 384, 385, 386, 387, 388,
-  389, 390, 391, -1, -1, -1, -1, -1, -1, 398,
-  -1, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
-  539, 540, 541, 542, 543, 544, 545, 546, 547, 548,
-  -1, -1, 14, 552, 553, 554, 555, -1, -1, -1,
-  559, 560, 24, -1, -1, -1, 565, 566, -1, -1,
+  389, 390, 391, -1, -1, 395, 396, 397, -1, 398,
+  400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+  410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+  420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+  430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+  440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+  450, 451, 452, 453, 219, 455, 456, 457, 458, 459,
+  460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+  -1, 471, 472, 473, -1, 475, 476, 477, 478, 479,
+  480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+  490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+  500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
+  510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+  520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+  530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
+  540, 541, 542, -1, 543, 544, 545, 546, 547, 548,
+  315, -1, -1, 552, 553, 554, 555, -1, 558, -1,
+  560, -1, 8, -1, 563, -1, 565, 566, -1, -1,
+  -1, -1, 572, 573, 574, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 45,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  52, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 77, 78, 79, 80,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 400, 401, 402, 403, 404,
+  405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+  415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
+  425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
+  435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+  445, 446, 447, 448, 449, 450, 451, 452, 453, -1,
+  455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
+  465, 466, 467, 468, 469, -1, 471, 472, 473, -1,
+  475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+  485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+  495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
+  505, 506, 507, -1, 509, 510, 511, 512, 513, 514,
+  515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
+  525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+  535, 536, 537, 219, 539, 540, 541, 542, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 560, -1, 8, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 122, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 150, -1,
+  -1, -1, -1, -1, 45, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 165, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 177, -1, -1, 179, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 315,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  201, -1, 203, -1, -1, -1, -1, -1, 210, -1,
-  211, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 8, -1, -1, -1, -1, 248, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 258, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 276, -1, -1, 45, -1,
-  -1, 282, 284, 285, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  302, 303, -1, -1, -1, 307, 308, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 318, 319, 320,
-  321, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 332, -1, -1, -1, -1, 337, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 131, -1, -1, 368, 369, 370,
-  371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
-  381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
-  391, -1, -1, 395, 396, 397, -1, 398, 400, 401,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 400, 401, 402, 403, 404, 405,
+  406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+  416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+  426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+  436, 437, 438, 439, 440, 441, 442, 443, 444, 445,
+  446, 447, 448, 449, 450, 451, 452, 453, 219, 455,
+  456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+  466, 467, 468, 469, -1, 471, 472, 473, -1, 475,
+  476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
+  486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+  496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+  506, 507, -1, 509, 510, 511, 512, 513, 514, 515,
+  516, 517, 518, 519, 520, 521, 522, 523, 524, 525,
+  526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+  536, 537, -1, 539, 540, 541, 542, -1, -1, -1,
+  -1, -1, -1, -1, 315, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 560, -1, 8, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 45, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 400,
+  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+  451, 452, 453, -1, 455, 456, 457, 458, 459, 460,
+  461, 462, 463, 464, 465, 466, 467, 468, 469, -1,
+  471, 472, 473, -1, 475, 476, 477, 478, 479, 480,
+  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
+  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, 219, 539, 540,
+  541, 542, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 560,
+  -1, 8, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 45, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 315, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 400, 401,
   402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
   412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
   422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
   432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
   442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
   452, 453, 219, 455, 456, 457, 458, 459, 460, 461,
-  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
+  462, 463, 464, 465, 466, 467, 468, 469, 71, 471,
   472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
   482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
   492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
@@ -10367,12 +10481,12 @@ static const short int yycheck[] = {
   512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
   522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
   532, 533, 534, 535, 536, 537, -1, 539, 540, 541,
-  542, -1, 543, 544, 545, 546, 547, 548, 315, -1,
-  -1, 552, 553, 554, 555, -1, 558, -1, 560, -1,
-  8, -1, 563, -1, 565, 566, -1, -1, -1, -1,
-  572, 573, 574, -1, -1, -1, -1, -1, -1, -1,
+  542, -1, -1, -1, -1, -1, -1, -1, 315, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 560, -1,
+  8, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 45, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -10392,46 +10506,7 @@ static const short int yycheck[] = {
   527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
   537, 219, 539, 540, 541, 542, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 560, -1, 8, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 45, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 315, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 400, 401, 402, 403, 404, 405, 406, 407,
-  408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
-  418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
-  428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
-  438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
-  448, 449, 450, 451, 452, 453, 219, 455, 456, 457,
-  458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
-  468, 469, -1, 471, 472, 473, -1, 475, 476, 477,
-  478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
-  488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
-  498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
-  -1, 509, 510, 511, 512, 513, 514, 515, 516, 517,
-  518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
-  528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
-  -1, 539, 540, 541, 542, -1, -1, -1, -1, -1,
-  -1, -1, 315, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 560, -1, 8, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 45, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 400, 401, 402,
+  -1, -1, -1, 560, -1, -1, -1, 400, 401, 402,
   403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
   413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
   423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
@@ -10445,79 +10520,59 @@ static const short int yycheck[] = {
   503, 504, 505, 506, 507, -1, 509, 510, 511, 512,
   513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
   523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
-  533, 534, 535, 536, 537, 219, 539, 540, 541, 542,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 560, -1, 8,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 45, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  533, 534, 535, 536, 537, -1, 539, 540, 541, 542,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 400, 401, 402, 403, 404, 405, 406, 407,
+  408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+  418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+  428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+  438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+  448, 449, 450, 451, 452, 453, -1, 455, 456, 457,
+  458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+  468, 469, -1, 471, 472, 473, -1, 475, 476, 477,
+  478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
+  488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+  498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+  -1, 509, 510, 511, 512, 513, 514, 515, 516, 517,
+  518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+  528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
+  -1, 539, 540, 541, 542, 25, -1, 27, -1, -1,
+  -1, 31, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 560, 43, -1, -1, -1, 47, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 315, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 77, 78, 79,
+  80, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+  -1, 111, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 126, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 159,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 179,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 199,
+  -1, 201, 202, -1, -1, 205, -1, 207, -1, -1,
+  -1, -1, -1, 213, 214, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 400, 401, 402, 403,
-  404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
-  414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
-  424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
-  434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
-  444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
-  219, 455, 456, 457, 458, 459, 460, 461, 462, 463,
-  464, 465, 466, 467, 468, 469, 71, 471, 472, 473,
-  -1, 475, 476, 477, 478, 479, 480, 481, 482, 483,
-  484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
-  494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
-  504, 505, 506, 507, -1, 509, 510, 511, 512, 513,
-  514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
-  524, 525, 526, 527, 528, 529, 530, 531, 532, 533,
-  534, 535, 536, 537, -1, 539, 540, 541, 542, -1,
-  -1, -1, -1, -1, -1, -1, 315, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 560, -1, 8, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 276, 277, -1, -1,
+  -1, -1, 282, 283, -1, -1, -1, -1, -1, -1,
+  -1, 291, -1, -1, -1, -1, -1, -1, -1, -1,
+  300, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 318, 319,
+  320, 321, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 346, -1, -1, -1,
+  -1, 351, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, 219,
-  539, 540, 541, 542, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 560, -1, -1, -1, 400, 401, 402, 403, 404,
-  405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
-  415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
-  425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-  435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
-  445, 446, 447, 448, 449, 450, 451, 452, 453, -1,
-  455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-  465, 466, 467, 468, 469, -1, 471, 472, 473, -1,
-  475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
-  485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-  495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
-  505, 506, 507, -1, 509, 510, 511, 512, 513, 514,
-  515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-  525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
-  535, 536, 537, -1, 539, 540, 541, 542, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
   410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
@@ -10533,162 +10588,190 @@ static const short int yycheck[] = {
   510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
   520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
   530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
-  540, 541, 542, 25, -1, 27, -1, -1, -1, 31,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  560, 43, -1, -1, -1, 47, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 77, 78, 79, 80, -1,
+  540, 541, 542, -1, 25, -1, 27, -1, -1, -1,
+  31, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 561, 43, -1, -1, -1, 47, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 104, -1, -1, -1, -1, -1, -1, 111,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 126, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 77, 78, 79, 80,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 159, -1, -1,
+  -1, -1, -1, 104, -1, -1, -1, -1, -1, -1,
+  111, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 126, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 179, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 199, -1, 201,
-  202, -1, -1, 205, -1, 207, -1, -1, -1, -1,
-  -1, 213, 214, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 159, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 8,
+  -1, -1, -1, -1, -1, -1, -1, -1, 179, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 199, -1,
+  201, 202, 41, -1, 205, -1, 207, -1, -1, -1,
+  -1, -1, 213, 214, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 276, 277, -1, -1, -1, -1,
-  282, 283, -1, -1, -1, -1, -1, -1, -1, 291,
-  -1, -1, -1, -1, -1, -1, -1, -1, 300, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 318, 319, 320, 321,
+  -1, -1, -1, -1, -1, 276, 277, -1, -1, -1,
+  -1, 282, 283, -1, -1, -1, -1, -1, -1, -1,
+  291, -1, -1, -1, -1, -1, -1, -1, -1, 300,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 318, 319, 320,
+  321, -1, -1, -1, -1, -1, 8, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 346, -1, -1, -1, -1, 351,
+  -1, -1, -1, -1, -1, 346, -1, -1, -1, -1,
+  351, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  219, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 400,
+  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+  451, 452, 453, -1, 455, 456, 457, 458, 459, 460,
+  461, 462, 463, 464, 465, 466, 467, 468, 469, 8,
+  471, 472, 473, -1, 475, 476, 477, 478, 479, 480,
+  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
+  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, 219, 539, 540,
+  541, 542, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 560,
+  -1, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
+  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
+  449, 450, 451, 452, 453, 8, 455, 456, 457, 458,
+  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
+  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
+  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
+  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
+  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
+  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
+  539, 540, 541, 542, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 400, 401,
+  402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
+  412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+  422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+  432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
+  442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
+  452, 453, 8, 455, 456, 457, 458, 459, 460, 461,
+  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
+  472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
+  482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
+  492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+  502, 503, 504, 505, 506, 507, -1, 509, 510, 511,
+  512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
+  522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+  532, 533, 534, 535, 536, 537, -1, 539, 540, 541,
+  542, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
+  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
+  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
+  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+  469, 14, 471, 472, 473, 474, 475, 476, 477, 478,
+  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
+  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
+  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
+  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
+  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
+  539, 540, 541, 542, -1, -1, -1, 400, 401, 402,
+  403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+  413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+  423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
+  433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+  443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
+  453, -1, 455, 456, 457, 458, 459, 460, 461, 462,
+  463, 464, 465, 466, 467, 468, 469, -1, 471, 472,
+  473, -1, 475, 476, 477, 478, 479, 480, 481, 482,
+  483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+  493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+  503, 504, 505, 506, 507, -1, 509, 510, 511, 512,
+  513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
+  523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
+  533, 534, 535, 536, 537, -1, 539, 540, 541, 542,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 400, 401, 402, 403, 404, 405,
+  406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+  416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+  426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+  436, 437, 438, 439, 440, 441, 442, 443, 444, 445,
+  446, 447, 448, 449, 450, 451, 452, 453, -1, 455,
+  456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+  466, 467, 468, 469, -1, 471, 472, 473, -1, 475,
+  476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
+  486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+  496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+  506, 507, -1, 509, 510, 511, 512, 513, 514, 515,
+  516, 517, 518, 519, 520, 521, 522, 523, 524, 525,
+  526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+  536, 537, -1, 539, 540, 541, 542, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 400, 401, 402,
+  403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+  413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+  423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
+  433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+  443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
+  453, -1, 455, 456, 457, 458, 459, 460, 461, 462,
+  463, 464, 465, 466, 467, 468, 469, -1, 471, 472,
+  473, -1, 475, 476, 477, 478, 479, 480, 481, 482,
+  483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+  493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+  503, 504, 505, 506, 507, 20, 509, 510, 511, 512,
+  513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
+  523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
+  533, 534, 535, 536, 537, 50, 539, 540, 541, 542,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 400, 401,
-  402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
-  412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
-  422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
-  432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
-  442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
-  452, 453, -1, 455, 456, 457, 458, 459, 460, 461,
-  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
-  472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
-  482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
-  492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
-  502, 503, 504, 505, 506, 507, -1, 509, 510, 511,
-  512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
-  522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
-  532, 533, 534, 535, 536, 537, -1, 539, 540, 541,
-  542, -1, 25, -1, 27, -1, -1, -1, 31, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 561,
-  43, -1, -1, -1, 47, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 77, 78, 79, 80, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 77, 78, 79, 80, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 104, -1, -1, -1, -1, -1, -1, 111, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 122, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 126, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 159, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 8, -1, -1,
-  -1, -1, -1, -1, -1, -1, 179, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 199, -1, 201, 202,
-  41, -1, 205, -1, 207, -1, -1, -1, -1, -1,
-  213, 214, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 179, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 190, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 201, -1, 203,
+  -1, -1, -1, -1, -1, -1, -1, 211, -1, -1,
+  -1, -1, -1, -1, 219, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 276, 277, -1, -1, -1, -1, 282,
-  283, -1, -1, -1, -1, -1, -1, -1, 291, -1,
-  -1, -1, -1, -1, -1, -1, -1, 300, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 318, 319, 320, 321, -1,
-  -1, -1, -1, -1, 8, -1, -1, -1, -1, -1,
+  -1, -1, 276, -1, -1, -1, -1, -1, 282, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 346, -1, -1, -1, -1, 351, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 219, -1,
+  -1, -1, -1, -1, 318, 319, 320, 321, -1, -1,
+  325, -1, -1, -1, -1, -1, -1, -1, 332, -1,
+  -1, -1, -1, 337, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 400, 401, 402,
-  403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
-  413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
-  423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
-  433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
-  443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
-  453, -1, 455, 456, 457, 458, 459, 460, 461, 462,
-  463, 464, 465, 466, 467, 468, 469, 8, 471, 472,
-  473, -1, 475, 476, 477, 478, 479, 480, 481, 482,
-  483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
-  493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
-  503, 504, 505, 506, 507, -1, 509, 510, 511, 512,
-  513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
-  523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
-  533, 534, 535, 536, 537, 219, 539, 540, 541, 542,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 560, -1, 400,
-  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
-  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
-  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
-  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
-  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
-  451, 452, 453, 8, 455, 456, 457, 458, 459, 460,
-  461, 462, 463, 464, 465, 466, 467, 468, 469, -1,
-  471, 472, 473, -1, 475, 476, 477, 478, 479, 480,
-  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
-  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
-  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
-  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
-  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
-  531, 532, 533, 534, 535, 536, 537, -1, 539, 540,
-  541, 542, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 400, 401, 402, 403,
-  404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
-  414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
-  424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
-  434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
-  444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
-  8, 455, 456, 457, 458, 459, 460, 461, 462, 463,
-  464, 465, 466, 467, 468, 469, -1, 471, 472, 473,
-  -1, 475, 476, 477, 478, 479, 480, 481, 482, 483,
-  484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
-  494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
-  504, 505, 506, 507, -1, 509, 510, 511, 512, 513,
-  514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
-  524, 525, 526, 527, 528, 529, 530, 531, 532, 533,
-  534, 535, 536, 537, -1, 539, 540, 541, 542, 400,
-  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
-  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
-  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
-  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
-  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
-  451, 452, 453, -1, 455, 456, 457, 458, 459, 460,
-  461, 462, 463, 464, 465, 466, 467, 468, 469, 14,
-  471, 472, 473, 474, 475, 476, 477, 478, 479, 480,
-  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
-  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
-  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
-  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
-  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
-  531, 532, 533, 534, 535, 536, 537, -1, 539, 540,
-  541, 542, -1, -1, -1, 400, 401, 402, 403, 404,
+  -1, -1, -1, -1, 368, 369, 370, 371, 372, 373,
+  374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+  384, 385, 386, 387, 388, 389, 390, 391, -1, -1,
+  -1, -1, -1, -1, 398, 400, 401, 402, 403, 404,
   405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
   415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
   425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
   435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
-  445, 446, 447, 448, 449, 450, 451, 452, 453, -1,
+  445, 446, 447, 448, 449, 450, 451, 452, 453, 45,
   455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
   465, 466, 467, 468, 469, -1, 471, 472, 473, -1,
   475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
@@ -10697,105 +10780,63 @@ static const short int yycheck[] = {
   505, 506, 507, -1, 509, 510, 511, 512, 513, 514,
   515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
   525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
-  535, 536, 537, -1, 539, 540, 541, 542, -1, -1,
+  535, 536, 537, -1, 539, 540, 541, 542, -1, 543,
+  544, 545, 546, 547, 548, -1, -1, -1, 552, 553,
+  554, 555, -1, -1, -1, 559, -1, -1, -1, 563,
+  -1, 565, 566, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 400, 401, 402, 403, 404, 405, 406, 407,
-  408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
-  418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
-  428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
-  438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
-  448, 449, 450, 451, 452, 453, -1, 455, 456, 457,
-  458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
-  468, 469, -1, 471, 472, 473, -1, 475, 476, 477,
-  478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
-  488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
-  498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
-  -1, 509, 510, 511, 512, 513, 514, 515, 516, 517,
-  518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
-  528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
-  -1, 539, 540, 541, 542, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 400, 401, 402, 403, 404,
-  405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
-  415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
-  425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-  435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
-  445, 446, 447, 448, 449, 450, 451, 452, 453, -1,
-  455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-  465, 466, 467, 468, 469, -1, 471, 472, 473, -1,
-  475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
-  485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-  495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
-  505, 506, 507, 20, 509, 510, 511, 512, 513, 514,
-  515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-  525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
-  535, 536, 537, 50, 539, 540, 541, 542, -1, -1,
+  -1, -1, -1, 179, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 201, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 77, 78, 79, 80, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 122, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  276, -1, -1, -1, -1, -1, 282, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 179, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 190, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 201, -1, 203, -1, -1,
-  -1, -1, -1, -1, -1, 211, -1, -1, -1, -1,
-  -1, -1, 219, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  276, -1, -1, -1, -1, -1, 282, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 318, 319, 320, 321, -1, -1, 325, -1,
-  -1, -1, -1, -1, -1, -1, 332, -1, -1, -1,
-  -1, 337, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 400, 401, 402, 403, 404, 405,
+  406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+  416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+  426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+  436, 437, 438, 439, 440, 441, 442, 443, 444, 445,
+  446, 447, 448, 449, 450, 451, 452, 453, 45, 455,
+  456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+  466, 467, 468, 469, -1, 471, 472, 473, -1, 475,
+  476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
+  486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+  496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+  506, 507, -1, 509, 510, 511, 512, 513, 514, 515,
+  516, 517, 518, 519, 520, 521, 522, 523, 524, 525,
+  526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+  536, 537, -1, 539, 540, 541, 542, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 368, 369, 370, 371, 372, 373, 374, 375,
-  376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
-  386, 387, 388, 389, 390, 391, -1, -1, -1, -1,
-  -1, -1, 398, 400, 401, 402, 403, 404, 405, 406,
-  407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
-  417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
-  427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
-  437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
-  447, 448, 449, 450, 451, 452, 453, 45, 455, 456,
-  457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
-  467, 468, 469, -1, 471, 472, 473, -1, 475, 476,
-  477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
-  487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
-  497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
-  507, -1, 509, 510, 511, 512, 513, 514, 515, 516,
-  517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
-  527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
-  537, -1, 539, 540, 541, 542, -1, 543, 544, 545,
-  546, 547, 548, -1, -1, -1, 552, 553, 554, 555,
-  -1, -1, -1, 559, -1, -1, -1, 563, -1, 565,
+  -1, -1, -1, -1, 560, -1, -1, -1, -1, -1,
   566, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 179, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 201, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 179, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 201, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 45, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 276, -1,
-  -1, -1, -1, -1, 282, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 276,
+  -1, -1, -1, -1, -1, 282, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -10804,81 +10845,95 @@ static const short int yycheck[] = {
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 400, 401, 402, 403, 404, 405, 406, 407,
-  408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
-  418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
-  428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
-  438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
-  448, 449, 450, 451, 452, 453, 45, 455, 456, 457,
-  458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
-  468, 469, -1, 471, 472, 473, -1, 475, 476, 477,
-  478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
-  488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
-  498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
-  -1, 509, 510, 511, 512, 513, 514, 515, 516, 517,
-  518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
-  528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
-  -1, 539, 540, 541, 542, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 560, -1, -1, -1, -1, -1, 566, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  179, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 400, 401, 402, 403, 404, 405, 406,
+  407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+  417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+  427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
+  437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+  447, 448, 449, 450, 451, 452, 453, -1, 455, 456,
+  457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+  467, 468, 469, -1, 471, 472, 473, -1, 475, 476,
+  477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+  487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+  497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+  507, -1, 509, 510, 511, 512, 513, 514, 515, 516,
+  517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
+  527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+  537, -1, 539, 540, 541, 542, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 201, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 45, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 398, 566,
+  400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+  410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+  420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+  430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+  440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+  450, 451, 452, 453, -1, 455, 456, 457, 458, 459,
+  460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+  -1, 471, 472, 473, -1, 475, 476, 477, 478, 479,
+  480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+  490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+  500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
+  510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+  520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+  530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
+  540, 541, 542, -1, -1, 25, -1, 27, -1, -1,
+  -1, 31, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 43, -1, 565, 566, 47, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 72, -1, -1, -1, -1, 77, 78, 79,
+  80, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+  -1, 111, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 126, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 276, -1, -1,
-  -1, -1, -1, 282, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 159,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 179,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 199,
+  -1, 201, 202, -1, -1, 205, -1, 207, -1, -1,
+  -1, -1, -1, 213, 214, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 276, 277, -1, -1,
+  -1, -1, 282, 283, -1, -1, -1, -1, -1, -1,
+  -1, 291, -1, -1, -1, -1, -1, -1, -1, -1,
+  300, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 318, 319,
+  320, 321, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 346, -1, -1, -1,
+  -1, 351, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
-  539, 540, 541, 542, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 398, 566, 400, 401,
-  402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
-  412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
-  422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
-  432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
-  442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
-  452, 453, -1, 455, 456, 457, 458, 459, 460, 461,
-  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
-  472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
-  482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
-  492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
-  502, 503, 504, 505, 506, 507, -1, 509, 510, 511,
-  512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
-  522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
-  532, 533, 534, 535, 536, 537, -1, 539, 540, 541,
-  542, -1, -1, 25, -1, 27, -1, -1, -1, 31,
+  400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+  410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+  420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+  430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+  440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+  450, 451, 452, 453, -1, 455, 456, 457, 458, 459,
+  460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+  -1, 471, 472, 473, -1, 475, 476, 477, 478, 479,
+  480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+  490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+  500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
+  510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+  520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+  530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
+  540, 541, 542, 25, -1, 27, -1, -1, -1, 31,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 43, -1, 565, 566, 47, -1, -1, -1, -1,
+  -1, 43, -1, -1, -1, 47, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   72, -1, -1, -1, -1, 77, 78, 79, 80, -1,
@@ -10932,7 +10987,7 @@ static const short int yycheck[] = {
   -1, -1, -1, -1, -1, -1, -1, -1, -1, 43,
   -1, -1, -1, 47, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 72, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 77, 78, 79, 80, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -11134,102 +11189,72 @@ static const short int yycheck[] = {
   500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
   510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
   520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
-  530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
-  540, 541, 542, 25, -1, 27, -1, -1, -1, 31,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 43, -1, -1, -1, 47, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 77, 78, 79, 80, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 104, -1, -1, -1, -1, -1, -1, 111,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 126, -1, -1, -1, -1, -1,
+  530, 531, 532, 533, 534, 535, 536, 537, 44, 539,
+  540, 541, 542, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 58, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 159, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 179, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 199, -1, 201,
-  202, -1, -1, 205, -1, 207, -1, -1, -1, -1,
-  -1, 213, 214, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 129, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 151, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 168, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 276, 277, -1, -1, -1, -1,
-  282, 283, -1, -1, -1, -1, -1, -1, -1, 291,
-  -1, -1, -1, -1, -1, -1, -1, -1, 300, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 318, 319, 320, 321,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 346, -1, -1, -1, -1, 351,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  236, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 44, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 400, 401,
-  402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
-  412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
-  422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
-  432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
-  442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
-  452, 453, -1, 455, 456, 457, 458, 459, 460, 461,
-  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
-  472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
-  482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
-  492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
-  502, 503, 504, 505, 506, 507, -1, 509, 510, 511,
-  512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
-  522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
-  532, 533, 534, 535, 536, 537, 44, 539, 540, 541,
-  542, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   58, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  336, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, 129, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, 151, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   168, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 400, 401, 402, 403, 404, 405,
+  406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+  416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+  426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+  436, 437, 438, 439, 440, 441, 442, 443, 444, 445,
+  446, 447, 448, 449, 450, 451, 452, 453, 236, 455,
+  456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+  466, 467, 468, 469, -1, 471, 472, 473, -1, 475,
+  476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
+  486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+  496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+  506, 507, -1, 509, 510, 511, 512, 513, 514, 515,
+  516, 517, 518, 519, 520, 521, 522, 523, 524, 525,
+  526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+  536, 537, -1, 539, 540, 541, 542, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 336, -1,
+  -1, -1, -1, -1, 560, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 236, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 44, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 58, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 336, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 129,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 151, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 168, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, 400, 401, 402, 403, 404, 405, 406, 407,
   408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
   418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
   428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
   438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
-  448, 449, 450, 451, 452, 453, 236, 455, 456, 457,
+  448, 449, 450, 451, 452, 453, -1, 455, 456, 457,
   458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
-  468, 469, -1, 471, 472, 473, -1, 475, 476, 477,
+  468, 469, 45, 471, 472, 473, -1, 475, 476, 477,
   478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
   488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
   498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
@@ -11237,71 +11262,34 @@ static const short int yycheck[] = {
   518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
   528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
   -1, 539, 540, 541, 542, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 336, -1, -1, -1,
-  -1, -1, 560, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
-  410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-  420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
-  430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
-  440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-  450, 451, 452, 453, -1, 455, 456, 457, 458, 459,
-  460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
-  45, 471, 472, 473, -1, 475, 476, 477, 478, 479,
-  480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
-  490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
-  500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
-  510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
-  520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
-  530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
-  540, 541, 542, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 133, -1,
-  560, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 151, -1, -1, -1,
+  133, -1, 560, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 151, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 45, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 58, -1, -1, -1, -1,
-  -1, -1, -1, -1, 219, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 45, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 58, -1, -1,
+  -1, -1, -1, -1, -1, -1, 219, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 239, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 239, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 151, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  315, -1, -1, -1, -1, 168, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 330, -1, -1, -1, -1,
-  -1, 336, -1, -1, -1, -1, -1, -1, -1, 344,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 354,
-  355, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  151, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 315, -1, -1, -1, -1, 168, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 330, -1, -1,
+  -1, -1, -1, 336, -1, -1, -1, -1, -1, -1,
+  -1, 344, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 354, 355, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 400, 401, 402, 403, 404,
-  405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
-  415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
-  425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-  435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
-  445, 446, 447, 448, 449, 450, 451, 452, 453, -1,
-  455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-  465, 466, 467, 468, 469, -1, 471, 472, 473, -1,
-  475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
-  485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-  495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
-  505, 506, 507, -1, 509, 510, 511, 512, 513, 514,
-  515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-  525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
-  535, 536, 537, -1, 539, 540, 541, 542, -1, -1,
-  -1, -1, -1, -1, 549, 550, 551, 400, 401, 402,
+  -1, -1, -1, -1, -1, -1, -1, 400, 401, 402,
   403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
   413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
   423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
@@ -11316,169 +11304,147 @@ static const short int yycheck[] = {
   513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
   523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
   533, 534, 535, 536, 537, -1, 539, 540, 541, 542,
-  77, 78, 79, 80, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 122, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 77, 78, 79, 80, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 179, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 122,
-  -1, -1, -1, -1, 201, -1, 203, -1, -1, -1,
-  -1, -1, -1, -1, 211, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 549, 550, 551, 400,
+  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+  451, 452, 453, -1, 455, 456, 457, 458, 459, 460,
+  461, 462, 463, 464, 465, 466, 467, 468, 469, -1,
+  471, 472, 473, -1, 475, 476, 477, 478, 479, 480,
+  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
+  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, -1, 539, 540,
+  541, 542, 77, 78, 79, 80, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 179, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 201, 276,
-  203, -1, -1, -1, -1, 282, -1, -1, 211, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 58, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 122, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 318, 319, 320, 321, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 332, -1, -1, -1, -1,
-  337, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 276, -1, -1, -1, -1, -1, 282,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 368, 369, 370, 371, 372, 373, 374, 375, 376,
-  377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
-  387, 388, 389, 390, 391, 318, 319, 320, 321, 151,
-  -1, 398, -1, -1, -1, -1, -1, -1, -1, 332,
-  -1, -1, -1, -1, 337, -1, 168, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 77, 78, 79, 80,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 368, 369, 370, 371, 372,
-  373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
-  383, 384, 385, 386, 387, 388, 389, 390, 391, -1,
-  -1, -1, -1, -1, -1, 398, -1, -1, -1, -1,
+  -1, -1, -1, -1, 179, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 122, -1, -1, -1, -1, 201, -1, 203, -1,
+  -1, -1, -1, -1, -1, -1, 211, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 179, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 543, 544, 545, 546,
-  547, 548, -1, -1, -1, 552, 553, 554, 555, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 565, 566,
+  201, 276, 203, -1, -1, -1, -1, 282, -1, -1,
+  211, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 58, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 318, 319, 320, 321, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 332, -1, -1,
+  -1, -1, 337, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 276, -1, -1, -1, -1,
+  -1, 282, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 368, 369, 370, 371, 372, 373, 374,
+  375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
+  385, 386, 387, 388, 389, 390, 391, 318, 319, 320,
+  321, 151, -1, 398, -1, -1, -1, -1, -1, -1,
+  -1, 332, -1, -1, -1, -1, 337, -1, 168, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 368, 369, 370,
+  371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+  381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+  391, -1, -1, -1, -1, -1, -1, 398, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  543, 544, 545, 546, 547, 548, -1, -1, -1, 552,
-  553, 554, 555, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 565, -1, -1, -1, -1, -1, 400, 401,
-  402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
-  412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
-  422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
-  432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
-  442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
-  452, 453, -1, 455, 456, 457, 458, 459, 460, 461,
-  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
-  472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
-  482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
-  492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
-  502, 503, 504, 505, 506, 507, -1, 509, 510, 511,
-  512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
-  522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
-  532, 533, 534, 535, 536, 537, 179, 539, 540, 541,
-  542, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 201, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 543, 544,
+  545, 546, 547, 548, -1, -1, -1, 552, 553, 554,
+  555, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  565, 566, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 276, -1, -1, -1, -1, -1, 282,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 543, 544, 545, 546, 547, 548, -1, -1,
+  -1, 552, 553, 554, 555, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 565, -1, -1, -1, -1, -1,
+  400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+  410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+  420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+  430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+  440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+  450, 451, 452, 453, -1, 455, 456, 457, 458, 459,
+  460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+  -1, 471, 472, 473, -1, 475, 476, 477, 478, 479,
+  480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+  490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+  500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
+  510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+  520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+  530, 531, 532, 533, 534, 535, 536, 537, 179, 539,
+  540, 541, 542, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  201, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 276, -1, -1, -1, -1,
+  -1, 282, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 400, 401, 402,
-  403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
-  413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
-  423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
-  433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
-  443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
-  453, -1, 455, 456, 457, 458, 459, 460, 461, 462,
-  463, 464, 465, 466, 467, 468, 469, -1, 471, 472,
-  473, -1, 475, 476, 477, 478, 479, 480, 481, 482,
-  483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
-  493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
-  503, 504, 505, 506, 507, -1, 509, 510, 511, 512,
-  513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
-  523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
-  533, 534, 535, 536, 537, -1, 539, 540, 541, 542,
-  179, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 560, -1, -1,
-  -1, -1, 201, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 276, -1, -1,
-  -1, -1, -1, 282, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 400,
+  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+  451, 452, 453, -1, 455, 456, 457, 458, 459, 460,
+  461, 462, 463, 464, 465, 466, 467, 468, 469, -1,
+  471, 472, 473, -1, 475, 476, 477, 478, 479, 480,
+  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
+  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, -1, 539, 540,
+  541, 542, 179, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 560,
+  -1, -1, -1, -1, 201, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 219, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 276,
+  -1, -1, -1, -1, -1, 282, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
-  539, 540, 541, 542, 400, 401, 402, 403, 404, 405,
-  406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
-  416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
-  426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
-  436, 437, 438, 439, 440, 441, 442, 443, 444, 445,
-  446, 447, 448, 449, 450, 451, 452, 453, -1, 455,
-  456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
-  466, 467, 468, 469, 241, 471, 472, 473, -1, 475,
-  476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
-  486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
-  496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
-  506, 507, -1, 509, 510, 511, 512, 513, 514, 515,
-  516, 517, 518, 519, 520, 521, 522, 523, 524, 525,
-  526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
-  536, 537, -1, 539, 540, 541, 542, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  327, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 219, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -11496,58 +11462,79 @@ static const short int yycheck[] = {
   507, -1, 509, 510, 511, 512, 513, 514, 515, 516,
   517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
   527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
-  537, -1, 539, 540, 541, 542, 543, -1, 545, 546,
-  -1, -1, -1, -1, -1, 552, 553, 554, 555, 398,
-  -1, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
-  539, 540, 541, 542, -1, -1, -1, -1, -1, -1,
+  537, -1, 539, 540, 541, 542, 400, 401, 402, 403,
+  404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
+  414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
+  424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+  434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+  444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+  -1, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+  464, 465, 466, 467, 468, 469, 241, 471, 472, 473,
+  -1, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+  484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
+  494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
+  504, 505, 506, 507, -1, 509, 510, 511, 512, 513,
+  514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+  524, 525, 526, 527, 528, 529, 530, 531, 532, 533,
+  534, 535, 536, 537, -1, 539, 540, 541, 542, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 565, 566, 400, 401,
-  402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
-  412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
-  422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
-  432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
-  442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
-  452, 453, -1, 455, 456, 457, 458, 459, 460, 461,
-  462, 463, 464, 465, 466, 467, 468, 469, -1, 471,
-  472, 473, -1, 475, 476, 477, 478, 479, 480, 481,
-  482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
-  492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
-  502, 503, 504, 505, 506, 507, -1, 509, 510, 511,
-  512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
-  522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
-  532, 533, 534, 535, 536, 537, -1, 539, 540, 541,
-  542, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 327, -1, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  562, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
-  539, 540, 541, 542, -1, -1, -1, -1, -1, -1,
   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 561, 400, 401, 402, 403, 404, 405, 406,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 400, 401, 402, 403, 404,
+  405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+  415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
+  425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
+  435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+  445, 446, 447, 448, 449, 450, 451, 452, 453, -1,
+  455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
+  465, 466, 467, 468, 469, -1, 471, 472, 473, -1,
+  475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+  485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+  495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
+  505, 506, 507, -1, 509, 510, 511, 512, 513, 514,
+  515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
+  525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+  535, 536, 537, -1, 539, 540, 541, 542, 543, -1,
+  545, 546, -1, -1, -1, -1, -1, 552, 553, 554,
+  555, 398, -1, 400, 401, 402, 403, 404, 405, 406,
+  407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+  417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+  427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
+  437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+  447, 448, 449, 450, 451, 452, 453, -1, 455, 456,
+  457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+  467, 468, 469, -1, 471, 472, 473, -1, 475, 476,
+  477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+  487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+  497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+  507, -1, 509, 510, 511, 512, 513, 514, 515, 516,
+  517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
+  527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+  537, -1, 539, 540, 541, 542, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 565, 566,
+  400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+  410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+  420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+  430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+  440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+  450, 451, 452, 453, -1, 455, 456, 457, 458, 459,
+  460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+  -1, 471, 472, 473, -1, 475, 476, 477, 478, 479,
+  480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+  490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+  500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
+  510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+  520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+  530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
+  540, 541, 542, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 562, 400, 401, 402, 403, 404, 405, 406,
   407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
   417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
   427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
@@ -11577,24 +11564,9 @@ static const short int yycheck[] = {
   505, 506, 507, -1, 509, 510, 511, 512, 513, 514,
   515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
   525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
-  535, 536, 537, -1, 539, 540, 541, 542, 543, -1,
-  545, 546, -1, -1, -1, -1, -1, 552, 553, 554,
-  555, 400, 401, 402, 403, 404, 405, 406, 407, 408,
-  409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
-  419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
-  429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
-  439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
-  449, 450, 451, 452, 453, -1, 455, 456, 457, 458,
-  459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
-  469, -1, 471, 472, 473, -1, 475, 476, 477, 478,
-  479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
-  489, 490, 491, 492, 493, 494, 495, 496, 497, 498,
-  499, 500, 501, 502, 503, 504, 505, 506, 507, -1,
-  509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
-  519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
-  529, 530, 531, 532, 533, 534, 535, 536, 537, -1,
-  539, 540, 541, 542, -1, -1, 545, 546, -1, -1,
-  -1, -1, -1, 552, 553, 554, 555, 400, 401, 402,
+  535, 536, 537, -1, 539, 540, 541, 542, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 561, 400, 401, 402,
   403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
   413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
   423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
@@ -11602,28 +11574,59 @@ static const short int yycheck[] = {
   443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
   453, -1, 455, 456, 457, 458, 459, 460, 461, 462,
   463, 464, 465, 466, 467, 468, 469, -1, 471, 472,
-  473, 474, 475, 476, 477, 478, 479, 480, 481, 482,
+  473, -1, 475, 476, 477, 478, 479, 480, 481, 482,
   483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
   493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
   503, 504, 505, 506, 507, -1, 509, 510, 511, 512,
   513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
   523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
   533, 534, 535, 536, 537, -1, 539, 540, 541, 542,
-  400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
-  410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-  420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
-  430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
-  440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-  450, 451, 452, 453, -1, 455, 456, 457, 458, 459,
-  460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
-  -1, 471, 472, 473, -1, 475, 476, 477, 478, 479,
-  480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
-  490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
-  500, 501, 502, 503, 504, 505, 506, 507, -1, 509,
-  510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
-  520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
-  530, 531, 532, 533, 534, 535, 536, 537, -1, 539,
-  540, 541, 542
+  543, -1, 545, 546, -1, -1, -1, -1, -1, 552,
+  553, 554, 555, 400, 401, 402, 403, 404, 405, 406,
+  407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+  417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+  427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
+  437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+  447, 448, 449, 450, 451, 452, 453, -1, 455, 456,
+  457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+  467, 468, 469, -1, 471, 472, 473, -1, 475, 476,
+  477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+  487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+  497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+  507, -1, 509, 510, 511, 512, 513, 514, 515, 516,
+  517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
+  527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+  537, -1, 539, 540, 541, 542, -1, -1, 545, 546,
+  -1, -1, -1, -1, -1, 552, 553, 554, 555, 400,
+  401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+  411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+  421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+  441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+  451, 452, 453, -1, 455, 456, 457, 458, 459, 460,
+  461, 462, 463, 464, 465, 466, 467, 468, 469, -1,
+  471, 472, 473, 474, 475, 476, 477, 478, 479, 480,
+  481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+  491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+  501, 502, 503, 504, 505, 506, 507, -1, 509, 510,
+  511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+  521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, -1, 539, 540,
+  541, 542, 400, 401, 402, 403, 404, 405, 406, 407,
+  408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+  418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+  428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+  438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+  448, 449, 450, 451, 452, 453, -1, 455, 456, 457,
+  458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+  468, 469, -1, 471, 472, 473, -1, 475, 476, 477,
+  478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
+  488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+  498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+  -1, 509, 510, 511, 512, 513, 514, 515, 516, 517,
+  518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+  528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
+  -1, 539, 540, 541, 542
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -11686,278 +11689,278 @@ static const unsigned short int yystos[] = {
   220, 318, 322, 330, 526, 605, 607, 613, 615, 619,
   620, 621, 624, 45, 315, 713, 299, 803, 241, 327,
   790, 795, 796, 1317, 1320, 1324, 8, 64, 117, 132,
-  151, 327, 399, 403, 415, 420, 433, 441, 445, 453,
-  456, 463, 510, 524, 526, 527, 534, 538, 783, 784,
-  785, 786, 787, 788, 789, 797, 801, 585, 234, 352,
-  164, 218, 325, 764, 776, 776, 549, 550, 551, 762,
-  768, 1017, 1018, 762, 768, 89, 348, 349, 771, 772,
-  773, 986, 987, 771, 1317, 214, 805, 131, 218, 834,
-  840, 325, 834, 837, 360, 833, 982, 983, 1317, 1314,
-  1317, 1317, 1317, 1017, 1017, 1017, 709, 1317, 1324, 776,
-  560, 499, 251, 1017, 1017, 344, 330, 506, 1017, 1017,
-  354, 355, 650, 652, 863, 353, 1287, 120, 160, 1289,
-  1287, 1289, 360, 233, 560, 560, 1291, 560, 1292, 43,
-  1287, 560, 1293, 410, 411, 1294, 1302, 1303, 360, 146,
-  1290, 560, 1288, 1305, 1291, 216, 1306, 392, 1017, 1156,
-  1160, 356, 1075, 1238, 1239, 1150, 179, 201, 276, 282,
-  560, 1278, 560, 1086, 560, 1204, 1216, 1206, 1212, 1134,
-  545, 1106, 360, 545, 545, 545, 1126, 1208, 560, 560,
-  1128, 1172, 1096, 1178, 560, 1273, 1214, 1213, 1162, 1130,
-  1182, 1124, 1273, 560, 1158, 560, 1085, 1188, 1190, 1180,
-  1136, 1132, 1273, 1210, 1273, 1098, 1100, 1102, 1104, 1170,
-  545, 1108, 360, 545, 1118, 1120, 545, 545, 1186, 1138,
-  1140, 1142, 1144, 1184, 1166, 1122, 563, 564, 971, 973,
-  1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328,
+  151, 327, 347, 399, 403, 415, 420, 433, 441, 445,
+  453, 456, 463, 510, 524, 526, 527, 534, 538, 783,
+  784, 785, 786, 787, 788, 789, 797, 801, 585, 234,
+  352, 164, 218, 325, 764, 776, 776, 549, 550, 551,
+  762, 768, 1017, 1018, 762, 768, 89, 348, 349, 771,
+  772, 773, 986, 987, 771, 1317, 214, 805, 131, 218,
+  834, 840, 325, 834, 837, 360, 833, 982, 983, 1317,
+  1314, 1317, 1317, 1317, 1017, 1017, 1017, 709, 1317, 1324,
+  776, 560, 499, 251, 1017, 1017, 344, 330, 506, 1017,
+  1017, 354, 355, 650, 652, 863, 353, 1287, 120, 160,
+  1289, 1287, 1289, 360, 233, 560, 560, 1291, 560, 1292,
+  43, 1287, 560, 1293, 410, 411, 1294, 1302, 1303, 360,
+  146, 1290, 560, 1288, 1305, 1291, 216, 1306, 392, 1017,
+  1156, 1160, 356, 1075, 1238, 1239, 1150, 179, 201, 276,
+  282, 560, 1278, 560, 1086, 560, 1204, 1216, 1206, 1212,
+  1134, 545, 1106, 360, 545, 545, 545, 1126, 1208, 560,
+  560, 1128, 1172, 1096, 1178, 560, 1273, 1214, 1213, 1162,
+  1130, 1182, 1124, 1273, 560, 1158, 560, 1085, 1188, 1190,
+  1180, 1136, 1132, 1273, 1210, 1273, 1098, 1100, 1102, 1104,
+  1170, 545, 1108, 360, 545, 1118, 1120, 545, 545, 1186,
+  1138, 1140, 1142, 1144, 1184, 1166, 1122, 563, 564, 971,
+  973, 1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328,
   1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328,
-  1328, 1328, 1328, 1328, 543, 972, 1110, 1196, 1146, 1148,
-  1198, 560, 560, 1094, 1174, 1200, 1176, 1164, 1192, 1194,
-  1114, 1168, 1317, 119, 210, 572, 766, 982, 1025, 1026,
-  1075, 1089, 1091, 1249, 1250, 1251, 1253, 1254, 1255, 624,
-  1084, 1084, 1317, 1088, 350, 1017, 772, 560, 1260, 1339,
-  394, 568, 569, 29, 30, 563, 564, 101, 196, 562,
-  567, 570, 49, 1295, 1296, 560, 1152, 560, 560, 560,
-  560, 560, 560, 560, 1112, 1116, 1257, 24, 52, 150,
-  165, 177, 210, 248, 258, 284, 285, 302, 303, 307,
-  308, 395, 396, 397, 492, 539, 558, 572, 573, 574,
-  1261, 1263, 1264, 1265, 1266, 1267, 1268, 1272, 392, 393,
-  1277, 392, 1277, 575, 575, 545, 545, 330, 1314, 1317,
-  1314, 1314, 1317, 1314, 147, 866, 1017, 866, 776, 91,
-  345, 945, 628, 630, 632, 634, 636, 638, 299, 5,
-  8, 10, 92, 105, 118, 151, 158, 246, 274, 340,
-  843, 844, 1017, 325, 941, 131, 709, 219, 669, 671,
-  672, 709, 843, 325, 340, 451, 488, 494, 757, 804,
-  817, 819, 854, 942, 959, 26, 601, 603, 367, 595,
-  609, 611, 217, 218, 617, 520, 327, 204, 204, 557,
-  558, 8, 560, 669, 705, 708, 218, 1017, 795, 557,
-  441, 445, 315, 355, 299, 538, 409, 440, 521, 514,
-  463, 177, 358, 504, 127, 799, 409, 440, 491, 440,
-  481, 521, 440, 177, 358, 216, 216, 794, 216, 358,
-  791, 216, 416, 521, 131, 150, 798, 1317, 623, 624,
-  398, 565, 1028, 1031, 1032, 1317, 106, 1028, 164, 775,
-  549, 550, 551, 349, 774, 764, 776, 89, 560, 777,
-  778, 274, 995, 1001, 1006, 1273, 776, 1317, 1320, 45,
-  1029, 1030, 1032, 1317, 45, 315, 560, 692, 698, 699,
-  705, 707, 1273, 841, 835, 840, 834, 838, 837, 834,
-  139, 360, 990, 1009, 218, 480, 489, 514, 557, 949,
-  951, 961, 417, 484, 845, 73, 408, 444, 465, 468,
-  470, 471, 472, 473, 512, 656, 657, 658, 965, 966,
-  967, 968, 969, 970, 712, 712, 501, 681, 14, 417,
-  1297, 480, 674, 588, 1025, 1075, 1247, 462, 45, 315,
-  862, 681, 1317, 1317, 649, 862, 862, 239, 133, 709,
-  180, 318, 690, 1320, 1324, 1324, 1287, 1324, 26, 539,
-  1320, 1295, 180, 318, 561, 1283, 1285, 1302, 1317, 131,
-  560, 698, 814, 815, 816, 1317, 560, 560, 1075, 1249,
-  356, 1236, 1237, 108, 1235, 1239, 560, 1317, 1025, 1087,
-  8, 100, 336, 562, 1225, 1336, 560, 560, 560, 560,
-  560, 560, 180, 318, 560, 560, 1154, 81, 82, 83,
-  84, 85, 142, 143, 144, 145, 191, 193, 194, 195,
-  200, 271, 272, 365, 366, 490, 535, 1243, 560, 560,
-  560, 560, 560, 560, 560, 560, 560, 560, 1075, 560,
-  1075, 1087, 560, 560, 560, 560, 560, 560, 560, 560,
-  560, 560, 560, 560, 180, 318, 560, 560, 560, 560,
-  560, 560, 560, 560, 560, 560, 543, 544, 543, 544,
-  560, 560, 560, 560, 560, 1247, 1336, 560, 560, 560,
-  560, 560, 560, 560, 560, 560, 1075, 1255, 1255, 772,
-  561, 561, 557, 561, 1090, 222, 364, 165, 1252, 11,
-  1075, 775, 564, 1078, 1079, 1080, 1081, 1081, 1082, 1082,
-  1083, 1083, 1083, 1083, 1084, 26, 539, 1320, 1025, 560,
-  1225, 1336, 1225, 1336, 1075, 1075, 1075, 1075, 561, 560,
-  560, 1260, 8, 12, 292, 1262, 210, 211, 24, 150,
-  177, 1265, 1262, 1262, 1262, 560, 558, 1262, 558, 1262,
-  1262, 1076, 1076, 1076, 26, 1076, 1075, 1269, 1076, 1278,
-  562, 146, 214, 474, 576, 1025, 1317, 8, 960, 1314,
-  119, 1317, 681, 704, 705, 330, 946, 176, 419, 166,
-  462, 526, 464, 962, 1320, 238, 560, 557, 831, 164,
-  51, 1321, 14, 709, 14, 325, 675, 557, 828, 266,
-  939, 327, 1320, 131, 599, 176, 419, 597, 1320, 526,
-  962, 226, 618, 229, 166, 462, 932, 933, 1320, 539,
-  620, 1075, 709, 706, 708, 231, 711, 8, 41, 669,
-  686, 796, 409, 440, 409, 440, 1317, 1317, 8, 440,
-  1075, 1249, 71, 1317, 440, 509, 1075, 1249, 796, 796,
-  792, 793, 1317, 1317, 798, 177, 358, 1317, 557, 972,
-  168, 669, 774, 89, 561, 779, 780, 1006, 1076, 557,
-  1007, 988, 996, 1317, 282, 669, 560, 692, 698, 708,
-  65, 155, 174, 206, 257, 282, 557, 693, 696, 14,
-  702, 703, 702, 702, 1314, 704, 1314, 221, 244, 1010,
-  984, 773, 991, 1000, 1002, 1006, 1273, 709, 325, 1326,
-  400, 443, 1317, 417, 1300, 1301, 1320, 846, 1300, 543,
-  1325, 35, 563, 971, 973, 971, 360, 1300, 658, 669,
-  669, 336, 682, 982, 558, 1299, 325, 1300, 561, 147,
-  865, 682, 845, 948, 949, 1317, 865, 865, 1317, 1317,
-  14, 334, 875, 318, 367, 557, 561, 561, 561, 557,
-  561, 318, 367, 557, 561, 1295, 698, 815, 698, 131,
-  557, 358, 806, 392, 1075, 1075, 317, 1075, 1235, 1237,
-  1075, 110, 1075, 561, 561, 561, 1075, 1075, 561, 561,
-  561, 561, 561, 1075, 318, 367, 1075, 561, 1279, 1317,
-  131, 1075, 1249, 1025, 1075, 561, 561, 1075, 1075, 1075,
-  1075, 557, 1075, 150, 1075, 1075, 1075, 561, 1075, 561,
-  1075, 1075, 1075, 1075, 1075, 1075, 318, 367, 1075, 1075,
-  1075, 33, 172, 326, 1233, 1233, 1075, 1075, 1075, 1075,
-  1075, 1075, 1075, 1075, 1075, 1075, 561, 1247, 1225, 1075,
-  1075, 1075, 1075, 1075, 1075, 1075, 1075, 776, 1075, 223,
-  1061, 1250, 1251, 210, 1310, 1254, 669, 561, 561, 561,
-  1075, 1075, 1075, 1075, 561, 557, 557, 561, 561, 227,
-  1075, 1075, 211, 26, 192, 1075, 1270, 1271, 1262, 1262,
-  113, 11, 576, 576, 528, 682, 37, 557, 714, 960,
-  77, 318, 319, 563, 622, 1032, 1307, 1308, 1309, 1337,
-  776, 1306, 176, 525, 776, 93, 216, 1314, 844, 698,
-  1324, 709, 669, 672, 1075, 218, 594, 325, 558, 688,
-  1306, 1320, 596, 217, 218, 963, 1030, 1032, 1324, 93,
-  457, 522, 690, 176, 525, 557, 608, 1295, 1295, 560,
-  557, 561, 560, 46, 46, 360, 557, 687, 560, 11,
-  558, 392, 1317, 1075, 1249, 624, 340, 282, 711, 557,
-  561, 778, 1017, 1061, 1061, 45, 560, 810, 811, 812,
-  1274, 1279, 1317, 1075, 693, 561, 167, 225, 697, 697,
-  696, 697, 810, 698, 167, 128, 148, 343, 700, 701,
-  1317, 842, 836, 839, 1011, 1012, 1317, 1061, 1003, 992,
-  417, 1317, 1301, 1320, 971, 971, 662, 666, 667, 151,
-  1297, 1298, 1320, 1317, 218, 1244, 210, 709, 151, 435,
-  848, 950, 951, 656, 709, 709, 560, 560, 301, 686,
-  45, 900, 367, 1320, 1302, 1324, 367, 1283, 345, 692,
-  814, 1317, 66, 807, 345, 1048, 562, 557, 561, 1075,
-  317, 110, 14, 227, 561, 561, 1135, 561, 367, 545,
-  561, 561, 392, 1075, 561, 557, 561, 557, 561, 561,
-  557, 561, 1075, 561, 1075, 557, 557, 557, 1137, 561,
-  131, 131, 557, 557, 557, 561, 367, 545, 561, 557,
-  557, 1075, 131, 131, 561, 557, 561, 561, 557, 561,
-  345, 1304, 1304, 561, 223, 1227, 1075, 557, 557, 561,
-  561, 557, 557, 557, 561, 561, 287, 1064, 536, 1153,
-  561, 561, 561, 561, 148, 498, 1229, 1075, 1075, 227,
-  536, 560, 557, 557, 447, 448, 430, 431, 432, 436,
-  437, 438, 558, 222, 561, 211, 1030, 1318, 1319, 1320,
-  1076, 151, 59, 705, 592, 1324, 1326, 1327, 557, 947,
-  629, 1320, 776, 776, 637, 776, 709, 561, 345, 590,
-  691, 698, 217, 218, 689, 1030, 1032, 1324, 1320, 598,
-  610, 964, 1030, 1032, 1324, 606, 17, 72, 242, 278,
-  497, 934, 936, 1075, 217, 449, 937, 1030, 1032, 1324,
-  1326, 933, 614, 616, 115, 708, 1317, 687, 687, 429,
-  669, 561, 793, 796, 1317, 177, 358, 810, 763, 1317,
-  560, 769, 780, 8, 100, 336, 1019, 989, 997, 813,
-  1274, 557, 558, 558, 558, 561, 561, 698, 167, 806,
-  698, 151, 168, 924, 924, 924, 557, 560, 557, 560,
-  1315, 985, 560, 1004, 1005, 1061, 1301, 847, 5, 42,
-  105, 153, 250, 716, 871, 557, 5, 10, 42, 48,
-  105, 197, 231, 240, 250, 402, 404, 480, 495, 496,
-  715, 720, 1296, 1297, 1303, 1331, 1335, 1317, 1088, 119,
-  875, 643, 849, 467, 851, 7, 22, 91, 953, 1300,
-  177, 560, 976, 977, 978, 1317, 976, 216, 20, 560,
-  867, 1295, 561, 692, 392, 216, 1249, 151, 178, 1070,
-  1075, 1161, 1075, 43, 205, 207, 1281, 1282, 1283, 560,
-  227, 227, 1107, 545, 1127, 1155, 1317, 561, 1129, 1075,
-  1097, 1075, 1163, 1131, 1075, 1125, 561, 1159, 561, 1075,
-  1075, 1075, 1133, 1075, 1075, 1075, 1075, 1320, 1109, 545,
-  1119, 1075, 1075, 131, 1075, 1075, 1145, 1075, 1167, 1123,
-  1075, 1197, 26, 539, 1320, 561, 561, 1199, 35, 505,
-  1226, 1227, 1075, 1075, 1177, 1165, 1319, 211, 1075, 1169,
-  35, 140, 227, 227, 477, 477, 227, 561, 557, 561,
-  560, 140, 231, 1230, 163, 163, 1075, 1075, 188, 1075,
-  1075, 188, 1075, 1075, 1271, 1317, 622, 1307, 776, 633,
-  635, 639, 776, 698, 557, 602, 688, 612, 537, 511,
-  418, 242, 557, 45, 267, 450, 935, 704, 561, 1075,
-  1249, 557, 558, 561, 1314, 562, 1020, 1021, 1022, 178,
-  1068, 1068, 557, 561, 811, 1087, 1075, 89, 702, 698,
-  1048, 218, 694, 560, 560, 560, 700, 1314, 1012, 1314,
-  14, 1068, 1021, 557, 993, 20, 45, 50, 124, 190,
-  231, 241, 306, 726, 735, 738, 124, 190, 241, 752,
-  20, 50, 58, 124, 190, 231, 241, 306, 723, 741,
-  742, 45, 724, 872, 124, 133, 722, 557, 668, 45,
-  726, 738, 45, 738, 755, 756, 749, 756, 231, 129,
-  236, 681, 723, 740, 741, 45, 738, 744, 35, 1332,
-  231, 719, 721, 723, 941, 231, 558, 325, 482, 231,
-  1295, 218, 900, 1317, 1314, 852, 1300, 647, 709, 177,
-  561, 557, 150, 156, 224, 979, 1280, 561, 686, 901,
-  58, 877, 907, 908, 911, 912, 913, 914, 924, 1317,
-  190, 856, 1317, 808, 8, 474, 709, 1049, 1051, 1052,
-  1317, 560, 1030, 1065, 1066, 1067, 1324, 561, 43, 560,
-  561, 1230, 560, 560, 557, 561, 561, 557, 561, 561,
-  127, 561, 557, 561, 561, 561, 557, 1075, 561, 561,
-  561, 561, 1147, 1149, 1073, 1075, 1321, 1322, 561, 1226,
-  561, 557, 561, 561, 561, 1062, 560, 560, 560, 560,
-  131, 1228, 1075, 227, 1230, 560, 35, 223, 1232, 1075,
-  1075, 218, 631, 627, 218, 698, 1308, 934, 557, 557,
-  561, 1317, 89, 1075, 561, 557, 164, 325, 1016, 1023,
-  1024, 1076, 1256, 1065, 1069, 127, 1054, 1054, 1274, 223,
-  1059, 695, 1314, 1314, 1314, 561, 561, 1000, 1013, 1054,
-  561, 1005, 1068, 20, 898, 899, 1320, 724, 891, 892,
-  483, 560, 739, 982, 686, 718, 871, 717, 718, 731,
-  733, 909, 911, 1317, 899, 891, 982, 1324, 1317, 898,
-  1314, 754, 1324, 686, 724, 743, 753, 718, 717, 1317,
-  899, 725, 1317, 717, 872, 715, 20, 20, 1317, 282,
-  750, 1309, 168, 168, 682, 753, 20, 745, 179, 439,
-  492, 1314, 717, 724, 669, 1314, 1336, 543, 1317, 1314,
-  669, 560, 855, 218, 850, 1314, 645, 51, 92, 158,
-  260, 340, 513, 955, 956, 709, 14, 165, 975, 978,
-  224, 72, 1283, 254, 560, 725, 44, 129, 236, 336,
-  878, 881, 882, 889, 557, 561, 1317, 417, 1283, 1300,
-  891, 124, 857, 115, 560, 1339, 1340, 557, 169, 392,
-  1065, 563, 564, 562, 567, 1157, 563, 1151, 1232, 1230,
-  1230, 1075, 1179, 1183, 1075, 1191, 1181, 1075, 1101, 1075,
-  1105, 1171, 1121, 1075, 561, 1141, 1143, 1185, 1111, 15,
-  94, 477, 1074, 561, 1175, 1075, 1193, 1195, 1115, 1072,
-  1073, 223, 1230, 1230, 1230, 125, 171, 1229, 561, 560,
-  1232, 223, 1072, 35, 561, 1243, 1243, 669, 1249, 604,
-  497, 936, 936, 558, 1021, 1027, 1028, 1027, 1008, 557,
-  14, 809, 1317, 809, 478, 557, 340, 998, 35, 1070,
-  1249, 561, 561, 561, 98, 115, 161, 162, 335, 999,
-  1054, 727, 729, 736, 557, 1317, 124, 557, 1309, 231,
-  1333, 1334, 1298, 560, 911, 557, 557, 14, 1298, 982,
-  557, 1317, 557, 557, 216, 14, 216, 1317, 89, 914,
-  1317, 924, 747, 914, 560, 560, 560, 1317, 164, 560,
-  683, 684, 45, 903, 904, 911, 404, 500, 859, 873,
-  874, 1296, 1297, 1303, 669, 853, 92, 158, 340, 147,
-  952, 218, 957, 561, 170, 1300, 1300, 72, 974, 1283,
-  910, 911, 560, 168, 168, 151, 168, 925, 90, 154,
-  210, 879, 880, 890, 908, 684, 915, 898, 858, 871,
-  1050, 1052, 563, 1051, 1065, 474, 561, 1066, 1066, 1067,
-  1067, 1324, 561, 1232, 1232, 561, 561, 561, 561, 561,
-  1139, 1074, 1074, 125, 171, 1095, 561, 557, 1063, 35,
-  1232, 1232, 1232, 227, 227, 1230, 561, 35, 1072, 561,
-  561, 683, 356, 821, 822, 823, 935, 450, 89, 1075,
-  557, 131, 1014, 1024, 1317, 1065, 1065, 216, 999, 1072,
-  1019, 1019, 1019, 1019, 1019, 1000, 994, 560, 911, 909,
-  899, 560, 893, 898, 892, 1317, 557, 561, 910, 734,
-  911, 911, 899, 1298, 1324, 753, 753, 1317, 899, 724,
-  1075, 751, 1317, 914, 746, 1075, 1075, 1075, 675, 560,
-  1072, 1033, 1034, 905, 557, 561, 558, 856, 557, 874,
-  684, 854, 958, 1249, 118, 1317, 455, 975, 557, 561,
-  1249, 725, 725, 725, 91, 149, 90, 1300, 557, 1033,
-  58, 89, 286, 404, 417, 876, 917, 918, 919, 920,
-  921, 922, 923, 928, 929, 930, 931, 14, 868, 557,
-  561, 557, 561, 561, 561, 1173, 1189, 1099, 1103, 1187,
-  1201, 1073, 127, 1071, 1072, 561, 561, 561, 560, 560,
-  1232, 1073, 1113, 1117, 187, 210, 356, 823, 356, 822,
-  1028, 692, 709, 710, 1001, 1060, 999, 910, 730, 737,
-  150, 561, 894, 895, 1280, 896, 1283, 349, 1334, 561,
-  14, 1317, 748, 561, 561, 561, 1317, 1333, 561, 1300,
-  358, 911, 904, 543, 857, 874, 1033, 7, 91, 954,
-  560, 469, 170, 911, 902, 561, 560, 560, 684, 890,
-  1300, 1317, 1075, 1075, 560, 1301, 44, 129, 210, 211,
-  236, 336, 927, 7, 125, 916, 919, 870, 982, 360,
-  869, 1052, 1065, 1302, 1249, 561, 1230, 1230, 561, 561,
-  317, 187, 1015, 557, 1071, 1000, 561, 557, 561, 1283,
-  133, 897, 150, 175, 732, 1317, 14, 560, 483, 560,
-  561, 243, 1249, 906, 858, 1300, 959, 1317, 1320, 455,
-  883, 884, 1317, 883, 971, 560, 168, 211, 879, 168,
-  168, 926, 246, 1317, 557, 38, 44, 180, 1298, 1295,
-  1232, 1232, 227, 1231, 340, 317, 1033, 709, 728, 895,
-  1317, 560, 523, 1317, 1333, 1309, 1333, 860, 1331, 1300,
-  561, 1300, 469, 557, 561, 15, 94, 885, 561, 557,
-  1249, 879, 879, 879, 709, 982, 44, 221, 44, 561,
-  561, 560, 282, 158, 1035, 1036, 1037, 1038, 1039, 1307,
-  1338, 465, 560, 561, 561, 251, 659, 861, 1330, 651,
-  1320, 884, 246, 971, 561, 560, 886, 221, 221, 1230,
-  810, 560, 770, 140, 1041, 1038, 512, 1036, 53, 557,
-  561, 1300, 1307, 14, 1300, 709, 561, 879, 1314, 218,
-  887, 888, 561, 1033, 561, 1279, 1316, 772, 35, 360,
-  1042, 360, 35, 1307, 1300, 561, 982, 653, 886, 561,
-  92, 340, 879, 218, 92, 824, 557, 561, 1033, 1043,
-  1044, 1045, 261, 1046, 1047, 1249, 470, 1040, 1300, 887,
-  37, 209, 253, 282, 209, 253, 282, 92, 340, 358,
-  1279, 557, 1075, 1048, 141, 1249, 4, 211, 4, 211,
-  37, 209, 253, 282, 209, 253, 282, 1249, 1044, 885,
-  360, 1053, 1249, 4, 211, 4, 211, 424, 444, 127,
-  127, 1057, 1058, 1274, 1055, 1056, 1274, 557, 557, 1058,
-  1056
+  1328, 1328, 1328, 1328, 1328, 543, 972, 1110, 1196, 1146,
+  1148, 1198, 560, 560, 1094, 1174, 1200, 1176, 1164, 1192,
+  1194, 1114, 1168, 1317, 119, 210, 572, 766, 982, 1025,
+  1026, 1075, 1089, 1091, 1249, 1250, 1251, 1253, 1254, 1255,
+  624, 1084, 1084, 1317, 1088, 350, 1017, 772, 560, 1260,
+  1339, 394, 568, 569, 29, 30, 563, 564, 101, 196,
+  562, 567, 570, 49, 1295, 1296, 560, 1152, 560, 560,
+  560, 560, 560, 560, 560, 1112, 1116, 1257, 24, 52,
+  150, 165, 177, 210, 248, 258, 284, 285, 302, 303,
+  307, 308, 395, 396, 397, 492, 539, 558, 572, 573,
+  574, 1261, 1263, 1264, 1265, 1266, 1267, 1268, 1272, 392,
+  393, 1277, 392, 1277, 575, 575, 545, 545, 330, 1314,
+  1317, 1314, 1314, 1317, 1314, 147, 866, 1017, 866, 776,
+  91, 345, 945, 628, 630, 632, 634, 636, 638, 299,
+  5, 8, 10, 92, 105, 118, 151, 158, 246, 274,
+  340, 843, 844, 1017, 325, 941, 131, 709, 219, 669,
+  671, 672, 709, 843, 325, 340, 451, 488, 494, 757,
+  804, 817, 819, 854, 942, 959, 26, 601, 603, 367,
+  595, 609, 611, 217, 218, 617, 520, 327, 204, 204,
+  557, 558, 8, 560, 669, 705, 708, 218, 1017, 795,
+  557, 441, 445, 315, 355, 299, 538, 409, 440, 521,
+  514, 514, 463, 177, 358, 504, 127, 799, 409, 440,
+  491, 440, 481, 521, 440, 177, 358, 216, 216, 794,
+  216, 358, 791, 216, 416, 521, 131, 150, 798, 1317,
+  623, 624, 398, 565, 1028, 1031, 1032, 1317, 106, 1028,
+  164, 775, 549, 550, 551, 349, 774, 764, 776, 89,
+  560, 777, 778, 274, 995, 1001, 1006, 1273, 776, 1317,
+  1320, 45, 1029, 1030, 1032, 1317, 45, 315, 560, 692,
+  698, 699, 705, 707, 1273, 841, 835, 840, 834, 838,
+  837, 834, 139, 360, 990, 1009, 218, 480, 489, 514,
+  557, 949, 951, 961, 417, 484, 845, 73, 408, 444,
+  465, 468, 470, 471, 472, 473, 512, 656, 657, 658,
+  965, 966, 967, 968, 969, 970, 712, 712, 501, 681,
+  14, 417, 1297, 480, 674, 588, 1025, 1075, 1247, 462,
+  45, 315, 862, 681, 1317, 1317, 649, 862, 862, 239,
+  133, 709, 180, 318, 690, 1320, 1324, 1324, 1287, 1324,
+  26, 539, 1320, 1295, 180, 318, 561, 1283, 1285, 1302,
+  1317, 131, 560, 698, 814, 815, 816, 1317, 560, 560,
+  1075, 1249, 356, 1236, 1237, 108, 1235, 1239, 560, 1317,
+  1025, 1087, 8, 100, 336, 562, 1225, 1336, 560, 560,
+  560, 560, 560, 560, 180, 318, 560, 560, 1154, 81,
+  82, 83, 84, 85, 142, 143, 144, 145, 191, 193,
+  194, 195, 200, 271, 272, 365, 366, 490, 535, 1243,
+  560, 560, 560, 560, 560, 560, 560, 560, 560, 560,
+  1075, 560, 1075, 1087, 560, 560, 560, 560, 560, 560,
+  560, 560, 560, 560, 560, 560, 180, 318, 560, 560,
+  560, 560, 560, 560, 560, 560, 560, 560, 543, 544,
+  543, 544, 560, 560, 560, 560, 560, 1247, 1336, 560,
+  560, 560, 560, 560, 560, 560, 560, 560, 1075, 1255,
+  1255, 772, 561, 561, 557, 561, 1090, 222, 364, 165,
+  1252, 11, 1075, 775, 564, 1078, 1079, 1080, 1081, 1081,
+  1082, 1082, 1083, 1083, 1083, 1083, 1084, 26, 539, 1320,
+  1025, 560, 1225, 1336, 1225, 1336, 1075, 1075, 1075, 1075,
+  561, 560, 560, 1260, 8, 12, 292, 1262, 210, 211,
+  24, 150, 177, 1265, 1262, 1262, 1262, 560, 558, 1262,
+  558, 1262, 1262, 1076, 1076, 1076, 26, 1076, 1075, 1269,
+  1076, 1278, 562, 146, 214, 474, 576, 1025, 1317, 8,
+  960, 1314, 119, 1317, 681, 704, 705, 330, 946, 176,
+  419, 166, 462, 526, 464, 962, 1320, 238, 560, 557,
+  831, 164, 51, 1321, 14, 709, 14, 325, 675, 557,
+  828, 266, 939, 327, 1320, 131, 599, 176, 419, 597,
+  1320, 526, 962, 226, 618, 229, 166, 462, 932, 933,
+  1320, 539, 620, 1075, 709, 706, 708, 231, 711, 8,
+  41, 669, 686, 796, 409, 440, 409, 440, 1317, 1317,
+  8, 440, 1075, 1249, 71, 1317, 440, 509, 1075, 1249,
+  796, 796, 792, 793, 1317, 1317, 798, 177, 358, 1317,
+  557, 972, 168, 669, 774, 89, 561, 779, 780, 1006,
+  1076, 557, 1007, 988, 996, 1317, 282, 669, 560, 692,
+  698, 708, 65, 155, 174, 206, 257, 282, 557, 693,
+  696, 14, 702, 703, 702, 702, 1314, 704, 1314, 221,
+  244, 1010, 984, 773, 991, 1000, 1002, 1006, 1273, 709,
+  325, 1326, 400, 443, 1317, 417, 1300, 1301, 1320, 846,
+  1300, 543, 1325, 35, 563, 971, 973, 971, 360, 1300,
+  658, 669, 669, 336, 682, 982, 558, 1299, 325, 1300,
+  561, 147, 865, 682, 845, 948, 949, 1317, 865, 865,
+  1317, 1317, 14, 334, 875, 318, 367, 557, 561, 561,
+  561, 557, 561, 318, 367, 557, 561, 1295, 698, 815,
+  698, 131, 557, 358, 806, 392, 1075, 1075, 317, 1075,
+  1235, 1237, 1075, 110, 1075, 561, 561, 561, 1075, 1075,
+  561, 561, 561, 561, 561, 1075, 318, 367, 1075, 561,
+  1279, 1317, 131, 1075, 1249, 1025, 1075, 561, 561, 1075,
+  1075, 1075, 1075, 557, 1075, 150, 1075, 1075, 1075, 561,
+  1075, 561, 1075, 1075, 1075, 1075, 1075, 1075, 318, 367,
+  1075, 1075, 1075, 33, 172, 326, 1233, 1233, 1075, 1075,
+  1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 561, 1247,
+  1225, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 776,
+  1075, 223, 1061, 1250, 1251, 210, 1310, 1254, 669, 561,
+  561, 561, 1075, 1075, 1075, 1075, 561, 557, 557, 561,
+  561, 227, 1075, 1075, 211, 26, 192, 1075, 1270, 1271,
+  1262, 1262, 113, 11, 576, 576, 528, 682, 37, 557,
+  714, 960, 77, 318, 319, 563, 622, 1032, 1307, 1308,
+  1309, 1337, 776, 1306, 176, 525, 776, 93, 216, 1314,
+  844, 698, 1324, 709, 669, 672, 1075, 218, 594, 325,
+  558, 688, 1306, 1320, 596, 217, 218, 963, 1030, 1032,
+  1324, 93, 457, 522, 690, 176, 525, 557, 608, 1295,
+  1295, 560, 557, 561, 560, 46, 46, 360, 557, 687,
+  560, 11, 558, 392, 1317, 1075, 1249, 624, 340, 282,
+  711, 557, 561, 778, 1017, 1061, 1061, 45, 560, 810,
+  811, 812, 1274, 1279, 1317, 1075, 693, 561, 167, 225,
+  697, 697, 696, 697, 810, 698, 167, 128, 148, 343,
+  700, 701, 1317, 842, 836, 839, 1011, 1012, 1317, 1061,
+  1003, 992, 417, 1317, 1301, 1320, 971, 971, 662, 666,
+  667, 151, 1297, 1298, 1320, 1317, 218, 1244, 210, 709,
+  151, 435, 848, 950, 951, 656, 709, 709, 560, 560,
+  301, 686, 45, 900, 367, 1320, 1302, 1324, 367, 1283,
+  345, 692, 814, 1317, 66, 807, 345, 1048, 562, 557,
+  561, 1075, 317, 110, 14, 227, 561, 561, 1135, 561,
+  367, 545, 561, 561, 392, 1075, 561, 557, 561, 557,
+  561, 561, 557, 561, 1075, 561, 1075, 557, 557, 557,
+  1137, 561, 131, 131, 557, 557, 557, 561, 367, 545,
+  561, 557, 557, 1075, 131, 131, 561, 557, 561, 561,
+  557, 561, 345, 1304, 1304, 561, 223, 1227, 1075, 557,
+  557, 561, 561, 557, 557, 557, 561, 561, 287, 1064,
+  536, 1153, 561, 561, 561, 561, 148, 498, 1229, 1075,
+  1075, 227, 536, 560, 557, 557, 447, 448, 430, 431,
+  432, 436, 437, 438, 558, 222, 561, 211, 1030, 1318,
+  1319, 1320, 1076, 151, 59, 705, 592, 1324, 1326, 1327,
+  557, 947, 629, 1320, 776, 776, 637, 776, 709, 561,
+  345, 590, 691, 698, 217, 218, 689, 1030, 1032, 1324,
+  1320, 598, 610, 964, 1030, 1032, 1324, 606, 17, 72,
+  242, 278, 497, 934, 936, 1075, 217, 449, 937, 1030,
+  1032, 1324, 1326, 933, 614, 616, 115, 708, 1317, 687,
+  687, 429, 669, 561, 793, 796, 1317, 177, 358, 810,
+  763, 1317, 560, 769, 780, 8, 100, 336, 1019, 989,
+  997, 813, 1274, 557, 558, 558, 558, 561, 561, 698,
+  167, 806, 698, 151, 168, 924, 924, 924, 557, 560,
+  557, 560, 1315, 985, 560, 1004, 1005, 1061, 1301, 847,
+  5, 42, 105, 153, 250, 716, 871, 557, 5, 10,
+  42, 48, 105, 197, 231, 240, 250, 402, 404, 480,
+  495, 496, 715, 720, 1296, 1297, 1303, 1331, 1335, 1317,
+  1088, 119, 875, 643, 849, 467, 851, 7, 22, 91,
+  953, 1300, 177, 560, 976, 977, 978, 1317, 976, 216,
+  20, 560, 867, 1295, 561, 692, 392, 216, 1249, 151,
+  178, 1070, 1075, 1161, 1075, 43, 205, 207, 1281, 1282,
+  1283, 560, 227, 227, 1107, 545, 1127, 1155, 1317, 561,
+  1129, 1075, 1097, 1075, 1163, 1131, 1075, 1125, 561, 1159,
+  561, 1075, 1075, 1075, 1133, 1075, 1075, 1075, 1075, 1320,
+  1109, 545, 1119, 1075, 1075, 131, 1075, 1075, 1145, 1075,
+  1167, 1123, 1075, 1197, 26, 539, 1320, 561, 561, 1199,
+  35, 505, 1226, 1227, 1075, 1075, 1177, 1165, 1319, 211,
+  1075, 1169, 35, 140, 227, 227, 477, 477, 227, 561,
+  557, 561, 560, 140, 231, 1230, 163, 163, 1075, 1075,
+  188, 1075, 1075, 188, 1075, 1075, 1271, 1317, 622, 1307,
+  776, 633, 635, 639, 776, 698, 557, 602, 688, 612,
+  537, 511, 418, 242, 557, 45, 267, 450, 935, 704,
+  561, 1075, 1249, 557, 558, 561, 1314, 562, 1020, 1021,
+  1022, 178, 1068, 1068, 557, 561, 811, 1087, 1075, 89,
+  702, 698, 1048, 218, 694, 560, 560, 560, 700, 1314,
+  1012, 1314, 14, 1068, 1021, 557, 993, 20, 45, 50,
+  124, 190, 231, 241, 306, 726, 735, 738, 124, 190,
+  241, 752, 20, 50, 58, 124, 190, 231, 241, 306,
+  723, 741, 742, 45, 724, 872, 124, 133, 722, 557,
+  668, 45, 726, 738, 45, 738, 755, 756, 749, 756,
+  231, 129, 236, 681, 723, 740, 741, 45, 738, 744,
+  35, 1332, 231, 719, 721, 723, 941, 231, 558, 325,
+  482, 231, 1295, 218, 900, 1317, 1314, 852, 1300, 647,
+  709, 177, 561, 557, 150, 156, 224, 979, 1280, 561,
+  686, 901, 58, 877, 907, 908, 911, 912, 913, 914,
+  924, 1317, 190, 856, 1317, 808, 8, 474, 709, 1049,
+  1051, 1052, 1317, 560, 1030, 1065, 1066, 1067, 1324, 561,
+  43, 560, 561, 1230, 560, 560, 557, 561, 561, 557,
+  561, 561, 127, 561, 557, 561, 561, 561, 557, 1075,
+  561, 561, 561, 561, 1147, 1149, 1073, 1075, 1321, 1322,
+  561, 1226, 561, 557, 561, 561, 561, 1062, 560, 560,
+  560, 560, 131, 1228, 1075, 227, 1230, 560, 35, 223,
+  1232, 1075, 1075, 218, 631, 627, 218, 698, 1308, 934,
+  557, 557, 561, 1317, 89, 1075, 561, 557, 164, 325,
+  1016, 1023, 1024, 1076, 1256, 1065, 1069, 127, 1054, 1054,
+  1274, 223, 1059, 695, 1314, 1314, 1314, 561, 561, 1000,
+  1013, 1054, 561, 1005, 1068, 20, 898, 899, 1320, 724,
+  891, 892, 483, 560, 739, 982, 686, 718, 871, 717,
+  718, 731, 733, 909, 911, 1317, 899, 891, 982, 1324,
+  1317, 898, 1314, 754, 1324, 686, 724, 743, 753, 718,
+  717, 1317, 899, 725, 1317, 717, 872, 715, 20, 20,
+  1317, 282, 750, 1309, 168, 168, 682, 753, 20, 745,
+  179, 439, 492, 1314, 717, 724, 669, 1314, 1336, 543,
+  1317, 1314, 669, 560, 855, 218, 850, 1314, 645, 51,
+  92, 158, 260, 340, 513, 955, 956, 709, 14, 165,
+  975, 978, 224, 72, 1283, 254, 560, 725, 44, 129,
+  236, 336, 878, 881, 882, 889, 557, 561, 1317, 417,
+  1283, 1300, 891, 124, 857, 115, 560, 1339, 1340, 557,
+  169, 392, 1065, 563, 564, 562, 567, 1157, 563, 1151,
+  1232, 1230, 1230, 1075, 1179, 1183, 1075, 1191, 1181, 1075,
+  1101, 1075, 1105, 1171, 1121, 1075, 561, 1141, 1143, 1185,
+  1111, 15, 94, 477, 1074, 561, 1175, 1075, 1193, 1195,
+  1115, 1072, 1073, 223, 1230, 1230, 1230, 125, 171, 1229,
+  561, 560, 1232, 223, 1072, 35, 561, 1243, 1243, 669,
+  1249, 604, 497, 936, 936, 558, 1021, 1027, 1028, 1027,
+  1008, 557, 14, 809, 1317, 809, 478, 557, 340, 998,
+  35, 1070, 1249, 561, 561, 561, 98, 115, 161, 162,
+  335, 999, 1054, 727, 729, 736, 557, 1317, 124, 557,
+  1309, 231, 1333, 1334, 1298, 560, 911, 557, 557, 14,
+  1298, 982, 557, 1317, 557, 557, 216, 14, 216, 1317,
+  89, 914, 1317, 924, 747, 914, 560, 560, 560, 1317,
+  164, 560, 683, 684, 45, 903, 904, 911, 404, 500,
+  859, 873, 874, 1296, 1297, 1303, 669, 853, 92, 158,
+  340, 147, 952, 218, 957, 561, 170, 1300, 1300, 72,
+  974, 1283, 910, 911, 560, 168, 168, 151, 168, 925,
+  90, 154, 210, 879, 880, 890, 908, 684, 915, 898,
+  858, 871, 1050, 1052, 563, 1051, 1065, 474, 561, 1066,
+  1066, 1067, 1067, 1324, 561, 1232, 1232, 561, 561, 561,
+  561, 561, 1139, 1074, 1074, 125, 171, 1095, 561, 557,
+  1063, 35, 1232, 1232, 1232, 227, 227, 1230, 561, 35,
+  1072, 561, 561, 683, 356, 821, 822, 823, 935, 450,
+  89, 1075, 557, 131, 1014, 1024, 1317, 1065, 1065, 216,
+  999, 1072, 1019, 1019, 1019, 1019, 1019, 1000, 994, 560,
+  911, 909, 899, 560, 893, 898, 892, 1317, 557, 561,
+  910, 734, 911, 911, 899, 1298, 1324, 753, 753, 1317,
+  899, 724, 1075, 751, 1317, 914, 746, 1075, 1075, 1075,
+  675, 560, 1072, 1033, 1034, 905, 557, 561, 558, 856,
+  557, 874, 684, 854, 958, 1249, 118, 1317, 455, 975,
+  557, 561, 1249, 725, 725, 725, 91, 149, 90, 1300,
+  557, 1033, 58, 89, 286, 404, 417, 876, 917, 918,
+  919, 920, 921, 922, 923, 928, 929, 930, 931, 14,
+  868, 557, 561, 557, 561, 561, 561, 1173, 1189, 1099,
+  1103, 1187, 1201, 1073, 127, 1071, 1072, 561, 561, 561,
+  560, 560, 1232, 1073, 1113, 1117, 187, 210, 356, 823,
+  356, 822, 1028, 692, 709, 710, 1001, 1060, 999, 910,
+  730, 737, 150, 561, 894, 895, 1280, 896, 1283, 349,
+  1334, 561, 14, 1317, 748, 561, 561, 561, 1317, 1333,
+  561, 1300, 358, 911, 904, 543, 857, 874, 1033, 7,
+  91, 954, 560, 469, 170, 911, 902, 561, 560, 560,
+  684, 890, 1300, 1317, 1075, 1075, 560, 1301, 44, 129,
+  210, 211, 236, 336, 927, 7, 125, 916, 919, 870,
+  982, 360, 869, 1052, 1065, 1302, 1249, 561, 1230, 1230,
+  561, 561, 317, 187, 1015, 557, 1071, 1000, 561, 557,
+  561, 1283, 133, 897, 150, 175, 732, 1317, 14, 560,
+  483, 560, 561, 243, 1249, 906, 858, 1300, 959, 1317,
+  1320, 455, 883, 884, 1317, 883, 971, 560, 168, 211,
+  879, 168, 168, 926, 246, 1317, 557, 38, 44, 180,
+  1298, 1295, 1232, 1232, 227, 1231, 340, 317, 1033, 709,
+  728, 895, 1317, 560, 523, 1317, 1333, 1309, 1333, 860,
+  1331, 1300, 561, 1300, 469, 557, 561, 15, 94, 885,
+  561, 557, 1249, 879, 879, 879, 709, 982, 44, 221,
+  44, 561, 561, 560, 282, 158, 1035, 1036, 1037, 1038,
+  1039, 1307, 1338, 465, 560, 561, 561, 251, 659, 861,
+  1330, 651, 1320, 884, 246, 971, 561, 560, 886, 221,
+  221, 1230, 810, 560, 770, 140, 1041, 1038, 512, 1036,
+  53, 557, 561, 1300, 1307, 14, 1300, 709, 561, 879,
+  1314, 218, 887, 888, 561, 1033, 561, 1279, 1316, 772,
+  35, 360, 1042, 360, 35, 1307, 1300, 561, 982, 653,
+  886, 561, 92, 340, 879, 218, 92, 824, 557, 561,
+  1033, 1043, 1044, 1045, 261, 1046, 1047, 1249, 470, 1040,
+  1300, 887, 37, 209, 253, 282, 209, 253, 282, 92,
+  340, 358, 1279, 557, 1075, 1048, 141, 1249, 4, 211,
+  4, 211, 37, 209, 253, 282, 209, 253, 282, 1249,
+  1044, 885, 360, 1053, 1249, 4, 211, 4, 211, 424,
+  444, 127, 127, 1057, 1058, 1274, 1055, 1056, 1274, 557,
+  557, 1058, 1056
 };
 
 
@@ -19249,7 +19252,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ACCESS_STATUS;
+	  ((*yyvalp).number) = SHOWSTMT_VACUUM_STATUS;
 	};
       }
       break;
@@ -19258,7 +19261,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_TIMEZONES;
+	  ((*yyvalp).number) = SHOWSTMT_ACCESS_STATUS;
 	};
       }
       break;
@@ -19267,7 +19270,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_FULL_TIMEZONES;
+	  ((*yyvalp).number) = SHOWSTMT_TIMEZONES;
 	};
       }
       break;
@@ -19276,7 +19279,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ACCESS_STATUS;
+	  ((*yyvalp).number) = SHOWSTMT_FULL_TIMEZONES;
 	};
       }
       break;
@@ -19285,7 +19288,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_TIMEZONES;
+	  ((*yyvalp).number) = SHOWSTMT_ACCESS_STATUS;
 	};
       }
       break;
@@ -19294,7 +19297,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_FULL_TIMEZONES;
+	  ((*yyvalp).number) = SHOWSTMT_TIMEZONES;
 	};
       }
       break;
@@ -19303,7 +19306,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_TRAN_TABLES;
+	  ((*yyvalp).number) = SHOWSTMT_FULL_TIMEZONES;
 	};
       }
       break;
@@ -19321,7 +19324,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_THREADS;
+	  ((*yyvalp).number) = SHOWSTMT_TRAN_TABLES;
 	};
       }
       break;
@@ -19330,7 +19333,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_VOLUME_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_THREADS;
 	};
       }
       break;
@@ -19339,7 +19342,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ARCHIVE_LOG_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_VACUUM_STATUS;
 	};
       }
       break;
@@ -19348,7 +19351,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_HEAP_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_VOLUME_HEADER;
 	};
       }
       break;
@@ -19357,7 +19360,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ALL_HEAP_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_ARCHIVE_LOG_HEADER;
 	};
       }
       break;
@@ -19366,7 +19369,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_HEAP_CAPACITY;
+	  ((*yyvalp).number) = SHOWSTMT_HEAP_HEADER;
 	};
       }
       break;
@@ -19375,7 +19378,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ALL_HEAP_CAPACITY;
+	  ((*yyvalp).number) = SHOWSTMT_ALL_HEAP_HEADER;
 	};
       }
       break;
@@ -19384,7 +19387,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ALL_INDEXES_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_HEAP_CAPACITY;
 	};
       }
       break;
@@ -19393,7 +19396,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ALL_INDEXES_CAPACITY;
+	  ((*yyvalp).number) = SHOWSTMT_ALL_HEAP_CAPACITY;
 	};
       }
       break;
@@ -19402,7 +19405,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_ACTIVE_LOG_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_ALL_INDEXES_HEADER;
 	};
       }
       break;
@@ -19411,7 +19414,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_SLOTTED_PAGE_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_ALL_INDEXES_CAPACITY;
 	};
       }
       break;
@@ -19420,7 +19423,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_SLOTTED_PAGE_SLOTS;
+	  ((*yyvalp).number) = SHOWSTMT_ACTIVE_LOG_HEADER;
 	};
       }
       break;
@@ -19429,7 +19432,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_INDEX_HEADER;
+	  ((*yyvalp).number) = SHOWSTMT_SLOTTED_PAGE_HEADER;
 	};
       }
       break;
@@ -19438,7 +19441,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = SHOWSTMT_INDEX_CAPACITY;
+	  ((*yyvalp).number) = SHOWSTMT_SLOTTED_PAGE_SLOTS;
 	};
       }
       break;
@@ -19447,7 +19450,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = KILLSTMT_QUERY;
+	  ((*yyvalp).number) = SHOWSTMT_INDEX_HEADER;
 	};
       }
       break;
@@ -19456,7 +19459,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).number) = KILLSTMT_TRAN;
+	  ((*yyvalp).number) = SHOWSTMT_INDEX_CAPACITY;
 	};
       }
       break;
@@ -19465,7 +19468,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).node) = NULL;
+	  ((*yyvalp).number) = KILLSTMT_QUERY;
 	};
       }
       break;
@@ -19474,13 +19477,31 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-	  ((*yyvalp).node) = NULL;
+	  ((*yyvalp).number) = KILLSTMT_TRAN;
 	};
       }
       break;
 
     case 499:
 
+      {
+	{
+	  ((*yyvalp).node) = NULL;
+	};
+      }
+      break;
+
+    case 500:
+
+      {
+	{
+	  ((*yyvalp).node) = NULL;
+	};
+      }
+      break;
+
+    case 501:
+
       {
 	{
 	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.node);
@@ -19488,7 +19509,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 500:
+    case 502:
 
       {
 	{
@@ -19499,7 +19520,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 501:
+    case 503:
 
       {
 	{
@@ -19513,7 +19534,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 502:
+    case 504:
 
       {
 	{
@@ -19526,7 +19547,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 503:
+    case 505:
 
       {
 	{
@@ -19535,7 +19556,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 504:
+    case 506:
 
       {
 	{
@@ -19547,7 +19568,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 505:
+    case 507:
 
       {
 	{
@@ -19557,7 +19578,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 506:
+    case 508:
 
       {
 	{
@@ -19566,7 +19587,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 507:
+    case 509:
 
       {
 	{
@@ -19575,7 +19596,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 508:
+    case 510:
 
       {
 	{
@@ -19584,7 +19605,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 509:
+    case 511:
 
       {
 	{
@@ -19595,7 +19616,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 510:
+    case 512:
 
       {
 	{
@@ -19606,7 +19627,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 522:
+    case 524:
 
       {
 	PT_NODE *node = parser_new_node (this_parser, PT_UPDATE);
@@ -19615,7 +19636,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 524:
+    case 526:
 
       {
 	PT_NODE *node = parser_pop_hint_node ();
@@ -19625,7 +19646,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 525:
+    case 527:
 
       {
 	{
@@ -19725,7 +19746,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 526:
+    case 528:
 
       {
 	{
@@ -19744,7 +19765,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 527:
+    case 529:
 
       {
 	{
@@ -19757,7 +19778,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 528:
+    case 530:
 
       {
 	parser_save_and_set_ic (1);
@@ -19765,7 +19786,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 529:
+    case 531:
 
       {
 	parser_restore_ic ();
@@ -19773,7 +19794,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 530:
+    case 532:
 
       {
 	{
@@ -19787,7 +19808,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 531:
+    case 533:
 
       {
 	{
@@ -19801,7 +19822,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 532:
+    case 534:
 
       {
 	{
@@ -19812,7 +19833,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 533:
+    case 535:
 
       {
 	{
@@ -19822,7 +19843,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 534:
+    case 536:
 
       {
 	{
@@ -19832,7 +19853,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 535:
+    case 537:
 
       {
 	{
@@ -19844,7 +19865,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 536:
+    case 538:
 
       {
 	{
@@ -19855,7 +19876,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 537:
+    case 539:
 
       {
 	{
@@ -19870,7 +19891,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 538:
+    case 540:
 
       {
 	{
@@ -19892,7 +19913,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 539:
+    case 541:
 
       {
 	{
@@ -20005,7 +20026,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 540:
+    case 542:
 
       {
 	{
@@ -20025,7 +20046,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 541:
+    case 543:
 
       {
 	{
@@ -20037,7 +20058,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 542:
+    case 544:
 
       {
 	{
@@ -20047,7 +20068,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 543:
+    case 545:
 
       {
 	{
@@ -20061,7 +20082,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 544:
+    case 546:
 
       {
 	{
@@ -20075,7 +20096,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 545:
+    case 547:
 
       {
 	{
@@ -20088,7 +20109,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 546:
+    case 548:
 
       {
 	{
@@ -20099,7 +20120,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 547:
+    case 549:
 
       {
 	{
@@ -20117,7 +20138,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 548:
+    case 550:
 
       {
 	{
@@ -20135,7 +20156,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 549:
+    case 551:
 
       {
 	{
@@ -20151,7 +20172,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 550:
+    case 552:
 
       {
 	{
@@ -20167,7 +20188,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 551:
+    case 553:
 
       {				/* $2 */
 	PT_NODE *node = parser_new_node (this_parser, PT_DELETE);
@@ -20176,7 +20197,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 552:
+    case 554:
 
       {
 	{
@@ -20284,7 +20305,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 553:
+    case 555:
 
       {				/* $2 */
 	PT_NODE *merge = parser_new_node (this_parser, PT_MERGE);
@@ -20293,7 +20314,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 554:
+    case 556:
 
       {
 	{
@@ -20314,7 +20335,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 555:
+    case 557:
 
       {
 	{
@@ -20322,7 +20343,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 556:
+    case 558:
 
       {
 	{
@@ -20330,7 +20351,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 557:
+    case 559:
 
       {
 	{
@@ -20338,7 +20359,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 558:
+    case 560:
 
       {
 	{
@@ -20346,7 +20367,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 559:
+    case 561:
 
       {
 	{
@@ -20370,7 +20391,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 560:
+    case 562:
 
       {
 	{
@@ -20390,7 +20411,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 561:
+    case 563:
 
       {
 	{
@@ -20401,7 +20422,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 562:
+    case 564:
 
       {
 	{
@@ -20411,7 +20432,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 563:
+    case 565:
 
       {
 	{
@@ -20431,7 +20452,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 564:
+    case 566:
 
       {
 	{
@@ -20453,7 +20474,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 565:
+    case 567:
 
       {
 	{
@@ -20475,49 +20496,49 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 566:
+    case 568:
 
       {
 	push_msg (MSGCAT_SYNTAX_MISSING_AUTH_COMMAND_LIST);;
       }
       break;
 
-    case 567:
+    case 569:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 568:
+    case 570:
 
       {
 	((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.node);;
       }
       break;
 
-    case 569:
+    case 571:
 
       {
 	push_msg (MSGCAT_SYNTAX_MISSING_AUTH_COMMAND_LIST);;
       }
       break;
 
-    case 570:
+    case 572:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 571:
+    case 573:
 
       {
 	((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.node);;
       }
       break;
 
-    case 572:
+    case 574:
 
       {
 	{
@@ -20539,7 +20560,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 573:
+    case 575:
 
       {
 	{
@@ -20561,7 +20582,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 574:
+    case 576:
 
       {
 	{
@@ -20572,7 +20593,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 575:
+    case 577:
 
       {
 	{
@@ -20583,70 +20604,70 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 576:
+    case 578:
 
       {
 	push_msg (MSGCAT_SYNTAX_MISSING_CLASS_SPEC_LIST);;
       }
       break;
 
-    case 577:
+    case 579:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 578:
+    case 580:
 
       {
 	((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.node);;
       }
       break;
 
-    case 579:
+    case 581:
 
       {
 	push_msg (MSGCAT_SYNTAX_MISSING_IDENTIFIER_LIST);;
       }
       break;
 
-    case 580:
+    case 582:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 581:
+    case 583:
 
       {
 	((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.node);;
       }
       break;
 
-    case 582:
+    case 584:
 
       {
 	push_msg (MSGCAT_SYNTAX_MISSING_IDENTIFIER_LIST);;
       }
       break;
 
-    case 583:
+    case 585:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 584:
+    case 586:
 
       {
 	((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.node);;
       }
       break;
 
-    case 585:
+    case 587:
 
       {
 	{
@@ -20658,7 +20679,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 586:
+    case 588:
 
       {
 	{
@@ -20668,7 +20689,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 587:
+    case 589:
 
       {
 	{
@@ -20681,7 +20702,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 588:
+    case 590:
 
       {
 	{
@@ -20699,7 +20720,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 589:
+    case 591:
 
       {
 	{
@@ -20717,7 +20738,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 590:
+    case 592:
 
       {
 	{
@@ -20735,7 +20756,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 591:
+    case 593:
 
       {
 	{
@@ -20760,7 +20781,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 592:
+    case 594:
 
       {
 	{
@@ -20778,7 +20799,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 593:
+    case 595:
 
       {
 	{
@@ -20796,7 +20817,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 594:
+    case 596:
 
       {
 	{
@@ -20814,7 +20835,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 595:
+    case 597:
 
       {
 	{
@@ -20832,7 +20853,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 596:
+    case 598:
 
       {
 	{
@@ -20850,7 +20871,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 597:
+    case 599:
 
       {
 	{
@@ -20868,7 +20889,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 598:
+    case 600:
 
       {
 	{
@@ -20886,7 +20907,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 599:
+    case 601:
 
       {
 	{
@@ -20904,7 +20925,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 600:
+    case 602:
 
       {
 	{
@@ -20915,21 +20936,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 601:
+    case 603:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_PASSWORD);;
       }
       break;
 
-    case 602:
+    case 604:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 603:
+    case 605:
 
       {
 	{
@@ -20939,7 +20960,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 604:
+    case 606:
 
       {
 	{
@@ -20950,21 +20971,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 605:
+    case 607:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_GROUPS);;
       }
       break;
 
-    case 606:
+    case 608:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 607:
+    case 609:
 
       {
 	{
@@ -20974,7 +20995,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 608:
+    case 610:
 
       {
 	{
@@ -20985,21 +21006,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 609:
+    case 611:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_MEMBERS);;
       }
       break;
 
-    case 610:
+    case 612:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 611:
+    case 613:
 
       {
 	{
@@ -21009,7 +21030,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 612:
+    case 614:
 
       {
 	{
@@ -21030,7 +21051,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 613:
+    case 615:
 
       {
 	{
@@ -21041,7 +21062,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 614:
+    case 616:
 
       {
 	{
@@ -21051,7 +21072,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 615:
+    case 617:
 
       {
 	{
@@ -21062,7 +21083,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 616:
+    case 618:
 
       {
 	{
@@ -21072,7 +21093,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 617:
+    case 619:
 
       {
 	{
@@ -21083,7 +21104,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 618:
+    case 620:
 
       {
 	{
@@ -21093,7 +21114,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 619:
+    case 621:
 
       {
 	{
@@ -21104,7 +21125,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 620:
+    case 622:
 
       {
 	{
@@ -21114,7 +21135,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 621:
+    case 623:
 
       {
 	{
@@ -21125,7 +21146,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 622:
+    case 624:
 
       {
 	{
@@ -21135,7 +21156,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 623:
+    case 625:
 
       {
 	{
@@ -21146,7 +21167,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 624:
+    case 626:
 
       {
 	{
@@ -21156,7 +21177,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 625:
+    case 627:
 
       {
 	{
@@ -21169,7 +21190,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 626:
+    case 628:
 
       {
 	{
@@ -21180,7 +21201,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 627:
+    case 629:
 
       {
 	{
@@ -21191,7 +21212,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 628:
+    case 630:
 
       {
 	{
@@ -21202,7 +21223,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 631:
+    case 633:
 
       {
 	{
@@ -21213,7 +21234,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 632:
+    case 634:
 
       {
 	{
@@ -21224,7 +21245,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 633:
+    case 635:
 
       {
 	{
@@ -21235,7 +21256,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 634:
+    case 636:
 
       {
 	{
@@ -21246,7 +21267,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 635:
+    case 637:
 
       {
 	{
@@ -21257,7 +21278,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 636:
+    case 638:
 
       {
 	{
@@ -21268,7 +21289,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 637:
+    case 639:
 
       {
 	{
@@ -21279,7 +21300,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 638:
+    case 640:
 
       {
 	{
@@ -21289,7 +21310,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 639:
+    case 641:
 
       {
 	{
@@ -21300,7 +21321,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 640:
+    case 642:
 
       {
 	{
@@ -21310,7 +21331,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 641:
+    case 643:
 
       {
 	{
@@ -21321,7 +21342,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 642:
+    case 644:
 
       {
 	{
@@ -21332,7 +21353,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 643:
+    case 645:
 
       {
 	{
@@ -21343,7 +21364,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 644:
+    case 646:
 
       {
 	{
@@ -21354,7 +21375,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 645:
+    case 647:
 
       {
 	{
@@ -21366,7 +21387,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 646:
+    case 648:
 
       {
 	{
@@ -21376,7 +21397,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 647:
+    case 649:
 
       {
 	{
@@ -21388,7 +21409,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 648:
+    case 650:
 
       {
 	{
@@ -21398,7 +21419,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 649:
+    case 651:
 
       {
 	{
@@ -21425,7 +21446,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 650:
+    case 652:
 
       {
 	{
@@ -21450,7 +21471,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 651:
+    case 653:
 
       {
 	{
@@ -21462,7 +21483,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 652:
+    case 654:
 
       {
 	{
@@ -21474,7 +21495,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 653:
+    case 655:
 
       {
 	{
@@ -21484,7 +21505,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 654:
+    case 656:
 
       {
 	{
@@ -21494,7 +21515,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 655:
+    case 657:
 
       {
 	{
@@ -21516,7 +21537,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 656:
+    case 658:
 
       {
 	{
@@ -21528,7 +21549,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 657:
+    case 659:
 
       {
 	{
@@ -21540,7 +21561,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 658:
+    case 660:
 
       {
 	{
@@ -21552,7 +21573,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 659:
+    case 661:
 
       {
 	{
@@ -21563,7 +21584,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 660:
+    case 662:
 
       {
 	{
@@ -21573,33 +21594,12 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 661:
-
-      {
-	{
-
-	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((4) - (4))].yystate.yysemantics.yysval.node);
-	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
-      }
-      break;
-
-    case 662:
-
-      {
-	{
-
-	  ((*yyvalp).node) = NULL;
-
-	DBG_PRINT};
-      }
-      break;
-
     case 663:
 
       {
 	{
 
-	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((2) - (2))].yystate.yysemantics.yysval.node);
+	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((4) - (4))].yystate.yysemantics.yysval.node);
 	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
       break;
@@ -21630,8 +21630,9 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       {
 	{
 
-	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.node);
-	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+	  ((*yyvalp).node) = NULL;
+
+	DBG_PRINT};
       }
       break;
 
@@ -21640,7 +21641,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       {
 	{
 
-	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.node);
+	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((2) - (2))].yystate.yysemantics.yysval.node);
 	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
       break;
@@ -21657,6 +21658,26 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
     case 669:
 
+      {
+	{
+
+	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.node);
+	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+      }
+      break;
+
+    case 670:
+
+      {
+	{
+
+	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.node);
+	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+      }
+      break;
+
+    case 671:
+
       {
 	{
 
@@ -21668,7 +21689,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 670:
+    case 672:
 
       {
 	{
@@ -21679,7 +21700,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 671:
+    case 673:
 
       {
 	{
@@ -21705,7 +21726,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 672:
+    case 674:
 
       {
 	{
@@ -21716,7 +21737,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 673:
+    case 675:
 
       {
 	{
@@ -21737,7 +21758,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 674:
+    case 676:
 
       {
 	{
@@ -21811,7 +21832,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 675:
+    case 677:
 
       {
 	{
@@ -21840,7 +21861,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 676:
+    case 678:
 
       {
 	{
@@ -21852,7 +21873,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 677:
+    case 679:
 
       {
 	{
@@ -21862,7 +21883,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 678:
+    case 680:
 
       {
 	{
@@ -21877,7 +21898,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 679:
+    case 681:
 
       {
 	{
@@ -21888,7 +21909,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 680:
+    case 682:
 
       {
 	{
@@ -21899,7 +21920,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 681:
+    case 683:
 
       {
 	{
@@ -21910,7 +21931,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 682:
+    case 684:
 
       {
 	{
@@ -21921,7 +21942,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 683:
+    case 685:
 
       {
 	{
@@ -21931,7 +21952,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 684:
+    case 686:
 
       {
 	{
@@ -21944,7 +21965,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 685:
+    case 687:
 
       {
 	{
@@ -21960,7 +21981,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 686:
+    case 688:
 
       {
 	{
@@ -21980,7 +22001,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 687:
+    case 689:
 
       {
 	{
@@ -22000,7 +22021,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 688:
+    case 690:
 
       {
 	{
@@ -22020,7 +22041,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 689:
+    case 691:
 
       {
 	{
@@ -22040,7 +22061,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 690:
+    case 692:
 
       {
 	{
@@ -22060,7 +22081,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 691:
+    case 693:
 
       {
 	{
@@ -22080,7 +22101,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 692:
+    case 694:
 
       {
 	{
@@ -22100,7 +22121,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 693:
+    case 695:
 
       {
 	{
@@ -22113,7 +22134,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 694:
+    case 696:
 
       {
 	{
@@ -22126,7 +22147,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 695:
+    case 697:
 
       {
 	{
@@ -22139,7 +22160,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 696:
+    case 698:
 
       {
 	{
@@ -22152,7 +22173,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 697:
+    case 699:
 
       {
 	{
@@ -22165,7 +22186,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 698:
+    case 700:
 
       {
 	{
@@ -22178,7 +22199,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 699:
+    case 701:
 
       {
 	{
@@ -22191,7 +22212,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 700:
+    case 702:
 
       {
 	{
@@ -22210,7 +22231,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 701:
+    case 703:
 
       {
 	{
@@ -22226,7 +22247,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 702:
+    case 704:
 
       {
 	{
@@ -22242,7 +22263,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 703:
+    case 705:
 
       {
 	{
@@ -22258,7 +22279,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 704:
+    case 706:
 
       {
 	{
@@ -22274,7 +22295,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 705:
+    case 707:
 
       {
 	{
@@ -22286,7 +22307,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 706:
+    case 708:
 
       {
 	{
@@ -22296,7 +22317,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 707:
+    case 709:
 
       {
 	{
@@ -22326,7 +22347,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 708:
+    case 710:
 
       {
 	{
@@ -22337,7 +22358,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 709:
+    case 711:
 
       {
 	{
@@ -22347,7 +22368,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 710:
+    case 712:
 
       {
 	{
@@ -22358,7 +22379,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 711:
+    case 713:
 
       {
 	{
@@ -22370,7 +22391,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 712:
+    case 714:
 
       {
 	{
@@ -22380,7 +22401,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 713:
+    case 715:
 
       {
 	{
@@ -22403,7 +22424,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 714:
+    case 716:
 
       {
 	{
@@ -22416,7 +22437,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 715:
+    case 717:
 
       {
 	{
@@ -22427,7 +22448,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 716:
+    case 718:
 
       {
 	{
@@ -22438,7 +22459,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 717:
+    case 719:
 
       {
 	{
@@ -22448,7 +22469,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 718:
+    case 720:
 
       {
 	{
@@ -22460,7 +22481,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 719:
+    case 721:
 
       {
 	{
@@ -22470,7 +22491,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 720:
+    case 722:
 
       {
 	{
@@ -22484,7 +22505,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 721:
+    case 723:
 
       {
 	{
@@ -22495,21 +22516,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 722:
+    case 724:
 
       {
 	parser_attr_type = PT_META_ATTR;;
       }
       break;
 
-    case 723:
+    case 725:
 
       {
 	parser_attr_type = PT_NORMAL;;
       }
       break;
 
-    case 724:
+    case 726:
 
       {
 	{
@@ -22519,7 +22540,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 725:
+    case 727:
 
       {
 	{
@@ -22531,7 +22552,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 726:
+    case 728:
 
       {
 	{
@@ -22541,21 +22562,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 727:
+    case 729:
 
       {
 	parser_attr_type = PT_META_ATTR;;
       }
       break;
 
-    case 728:
+    case 730:
 
       {
 	parser_attr_type = PT_NORMAL;;
       }
       break;
 
-    case 729:
+    case 731:
 
       {
 	{
@@ -22565,7 +22586,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 730:
+    case 732:
 
       {
 	{
@@ -22575,7 +22596,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 731:
+    case 733:
 
       {
 	{
@@ -22587,7 +22608,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 732:
+    case 734:
 
       {
 	{
@@ -22597,7 +22618,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 733:
+    case 735:
 
       {
 	{
@@ -22607,7 +22628,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 734:
+    case 736:
 
       {
 	{
@@ -22629,7 +22650,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 735:
+    case 737:
 
       {
 	{
@@ -22641,7 +22662,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 736:
+    case 738:
 
       {
 	{
@@ -22653,7 +22674,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 737:
+    case 739:
 
       {
 	{
@@ -22665,7 +22686,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 738:
+    case 740:
 
       {
 	{
@@ -22675,7 +22696,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 739:
+    case 741:
 
       {
 	{
@@ -22685,7 +22706,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 740:
+    case 742:
 
       {
 	{
@@ -22695,7 +22716,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 741:
+    case 743:
 
       {
 	{
@@ -22705,7 +22726,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 742:
+    case 744:
 
       {
 	{
@@ -22782,7 +22803,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 743:
+    case 745:
 
       {
 	{
@@ -22840,7 +22861,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 744:
+    case 746:
 
       {
 	{
@@ -22873,7 +22894,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 745:
+    case 747:
 
       {
 	{
@@ -22894,7 +22915,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 746:
+    case 748:
 
       {
 	{
@@ -22905,7 +22926,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 747:
+    case 749:
 
       {
 	{
@@ -22926,7 +22947,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 748:
+    case 750:
 
       {
 	{
@@ -22949,21 +22970,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 749:
+    case 751:
 
       {
 	((*yyvalp).number) = 0;;
       }
       break;
 
-    case 750:
+    case 752:
 
       {
 	((*yyvalp).number) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.number);;
       }
       break;
 
-    case 751:
+    case 753:
 
       {
 	{
@@ -23000,7 +23021,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 752:
+    case 754:
 
       {
 	{
@@ -23009,7 +23030,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 753:
+    case 755:
 
       {
 	{
@@ -23018,7 +23039,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 754:
+    case 756:
 
       {
 	{
@@ -23027,7 +23048,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 755:
+    case 757:
 
       {
 	{
@@ -23036,7 +23057,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 756:
+    case 758:
 
       {
 	{
@@ -23045,7 +23066,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 757:
+    case 759:
 
       {
 	{
@@ -23054,7 +23075,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 758:
+    case 760:
 
       {
 	{
@@ -23063,7 +23084,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 759:
+    case 761:
 
       {
 	{
@@ -23072,7 +23093,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 760:
+    case 762:
 
       {
 	{
@@ -23081,7 +23102,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 761:
+    case 763:
 
       {
 	{
@@ -23133,7 +23154,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 762:
+    case 764:
 
       {
 	{
@@ -23179,7 +23200,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 763:
+    case 765:
 
       {
 	{
@@ -23223,7 +23244,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 764:
+    case 766:
 
       {
 	{
@@ -23275,7 +23296,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 765:
+    case 767:
 
       {
 	{
@@ -23321,7 +23342,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 766:
+    case 768:
 
       {
 	{
@@ -23378,7 +23399,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 776:
+    case 778:
 
       {
 	{
@@ -23424,7 +23445,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 777:
+    case 779:
 
       {
 	{
@@ -23445,7 +23466,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 778:
+    case 780:
 
       {
 	{
@@ -23468,7 +23489,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 779:
+    case 781:
 
       {
 	{
@@ -23563,7 +23584,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 780:
+    case 782:
 
       {
 	{
@@ -23577,7 +23598,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 781:
+    case 783:
 
       {
 	{
@@ -23589,7 +23610,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 782:
+    case 784:
 
       {
 	{
@@ -23599,7 +23620,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 783:
+    case 785:
 
       {
 	{
@@ -23691,7 +23712,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 784:
+    case 786:
 
       {
 	{
@@ -23726,7 +23747,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 785:
+    case 787:
 
       {
 	{
@@ -23744,7 +23765,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 786:
+    case 788:
 
       {
 	{
@@ -23758,7 +23779,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 787:
+    case 789:
 
       {
 	{
@@ -23772,7 +23793,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 788:
+    case 790:
 
       {
 	{
@@ -23785,7 +23806,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 789:
+    case 791:
 
       {
 	{
@@ -23799,7 +23820,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 790:
+    case 792:
 
       {
 	{
@@ -23816,7 +23837,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 791:
+    case 793:
 
       {
 	{
@@ -23837,7 +23858,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 792:
+    case 794:
 
       {
 	{
@@ -23856,7 +23877,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 793:
+    case 795:
 
       {
 	{
@@ -23876,7 +23897,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 794:
+    case 796:
 
       {
 	{
@@ -23895,7 +23916,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 797:
+    case 799:
 
       {
 	{
@@ -23906,7 +23927,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 798:
+    case 800:
 
       {
 	{
@@ -23917,7 +23938,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 799:
+    case 801:
 
       {
 	{
@@ -23935,7 +23956,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 800:
+    case 802:
 
       {
 	{
@@ -23953,7 +23974,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 801:
+    case 803:
 
       {
 	{
@@ -23963,7 +23984,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 802:
+    case 804:
 
       {
 	{
@@ -23973,7 +23994,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 803:
+    case 805:
 
       {
 	{
@@ -23983,7 +24004,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 804:
+    case 806:
 
       {
 	{
@@ -23993,7 +24014,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 805:
+    case 807:
 
       {
 	{
@@ -24010,7 +24031,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 806:
+    case 808:
 
       {
 	{
@@ -24021,7 +24042,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 807:
+    case 809:
 
       {
 	{
@@ -24039,7 +24060,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 808:
+    case 810:
 
       {
 	{
@@ -24050,7 +24071,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 809:
+    case 811:
 
       {
 	{
@@ -24068,7 +24089,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 816:
+    case 818:
 
       {
 	{
@@ -24088,7 +24109,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 817:
+    case 819:
 
       {
 	{
@@ -24108,7 +24129,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 818:
+    case 820:
 
       {
 	{
@@ -24130,7 +24151,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 819:
+    case 821:
 
       {
 	{
@@ -24141,21 +24162,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 820:
+    case 822:
 
       {
 	parser_save_and_set_hvar (0);;
       }
       break;
 
-    case 821:
+    case 823:
 
       {
 	parser_restore_hvar ();;
       }
       break;
 
-    case 822:
+    case 824:
 
       {
 	{
@@ -24165,7 +24186,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 823:
+    case 825:
 
       {
 	{
@@ -24176,7 +24197,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 824:
+    case 826:
 
       {
 	{
@@ -24187,7 +24208,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 825:
+    case 827:
 
       {
 	{
@@ -24198,7 +24219,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 826:
+    case 828:
 
       {
 	{
@@ -24209,7 +24230,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 827:
+    case 829:
 
       {
 	{
@@ -24220,7 +24241,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 828:
+    case 830:
 
       {
 	{
@@ -24230,7 +24251,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 829:
+    case 831:
 
       {
 	{
@@ -24240,7 +24261,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 830:
+    case 832:
 
       {
 	{
@@ -24251,7 +24272,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 831:
+    case 833:
 
       {
 	{
@@ -24261,7 +24282,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 832:
+    case 834:
 
       {
 	{
@@ -24272,7 +24293,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 833:
+    case 835:
 
       {
 	{
@@ -24283,7 +24304,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 834:
+    case 836:
 
       {
 	{
@@ -24294,7 +24315,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 835:
+    case 837:
 
       {
 	{
@@ -24305,7 +24326,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 836:
+    case 838:
 
       {
 	{
@@ -24316,7 +24337,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 837:
+    case 839:
 
       {
 	{
@@ -24327,7 +24348,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 838:
+    case 840:
 
       {
 	{
@@ -24345,7 +24366,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 839:
+    case 841:
 
       {
 	{
@@ -24365,7 +24386,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 840:
+    case 842:
 
       {
 	{
@@ -24376,7 +24397,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 841:
+    case 843:
 
       {
 	{
@@ -24387,7 +24408,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 842:
+    case 844:
 
       {
 	{
@@ -24398,7 +24419,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 843:
+    case 845:
 
       {
 	{
@@ -24409,7 +24430,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 844:
+    case 846:
 
       {
 	{
@@ -24420,7 +24441,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 845:
+    case 847:
 
       {
 	{
@@ -24431,7 +24452,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 846:
+    case 848:
 
       {
 	{
@@ -24442,7 +24463,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 847:
+    case 849:
 
       {
 	{
@@ -24453,7 +24474,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 848:
+    case 850:
 
       {
 	{
@@ -24473,7 +24494,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 849:
+    case 851:
 
       {
 	{
@@ -24491,7 +24512,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 850:
+    case 852:
 
       {
 	{
@@ -24501,7 +24522,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 851:
+    case 853:
 
       {
 	{
@@ -24511,7 +24532,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 852:
+    case 854:
 
       {
 	{
@@ -24528,7 +24549,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 853:
+    case 855:
 
       {
 	{
@@ -24545,7 +24566,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 854:
+    case 856:
 
       {
 	{
@@ -24564,7 +24585,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 855:
+    case 857:
 
       {
 	{
@@ -24583,7 +24604,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 856:
+    case 858:
 
       {
 	{
@@ -24602,7 +24623,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 857:
+    case 859:
 
       {
 	{
@@ -24621,7 +24642,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 858:
+    case 860:
 
       {
 	{
@@ -24640,7 +24661,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 859:
+    case 861:
 
       {
 	{
@@ -24659,7 +24680,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 860:
+    case 862:
 
       {
 	{
@@ -24678,7 +24699,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 861:
+    case 863:
 
       {
 	{
@@ -24696,7 +24717,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 862:
+    case 864:
 
       {
 	{
@@ -24713,7 +24734,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 863:
+    case 865:
 
       {
 	{
@@ -24728,7 +24749,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 864:
+    case 866:
 
       {
 	{
@@ -24743,7 +24764,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 865:
+    case 867:
 
       {
 	{
@@ -24757,7 +24778,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 868:
+    case 870:
 
       {
 	{
@@ -24775,7 +24796,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 869:
+    case 871:
 
       {
 	{
@@ -24793,7 +24814,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 870:
+    case 872:
 
       {
 	{
@@ -24803,7 +24824,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 871:
+    case 873:
 
       {
 	{
@@ -24813,7 +24834,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 872:
+    case 874:
 
       {
 	{
@@ -24823,7 +24844,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 873:
+    case 875:
 
       {
 	{
@@ -24833,7 +24854,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 874:
+    case 876:
 
       {
 	{
@@ -24843,7 +24864,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 875:
+    case 877:
 
       {
 	{
@@ -24853,7 +24874,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 876:
+    case 878:
 
       {
 	{
@@ -24875,7 +24896,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 877:
+    case 879:
 
       {
 	{
@@ -24897,7 +24918,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 878:
+    case 880:
 
       {
 	{
@@ -24922,7 +24943,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 879:
+    case 881:
 
       {
 	{
@@ -24935,7 +24956,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 880:
+    case 882:
 
       {
 	{
@@ -24960,7 +24981,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 881:
+    case 883:
 
       {
 	{
@@ -24973,7 +24994,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 882:
+    case 884:
 
       {
 	{
@@ -24986,7 +25007,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 883:
+    case 885:
 
       {
 	{
@@ -24999,7 +25020,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 884:
+    case 886:
 
       {
 	{
@@ -25013,7 +25034,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 885:
+    case 887:
 
       {
 	{
@@ -25025,7 +25046,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 886:
+    case 888:
 
       {
 	{
@@ -25036,7 +25057,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 887:
+    case 889:
 
       {
 	{
@@ -25049,7 +25070,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 888:
+    case 890:
 
       {
 	{
@@ -25060,7 +25081,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 891:
+    case 893:
 
       {
 	{
@@ -25071,7 +25092,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 892:
+    case 894:
 
       {
 	{
@@ -25084,7 +25105,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 893:
+    case 895:
 
       {
 	{
@@ -25095,7 +25116,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 897:
+    case 899:
 
       {
 	{
@@ -25106,7 +25127,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 898:
+    case 900:
 
       {
 	{
@@ -25116,7 +25137,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 899:
+    case 901:
 
       {
 	{
@@ -25128,7 +25149,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 900:
+    case 902:
 
       {
 	{
@@ -25138,7 +25159,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 901:
+    case 903:
 
       {
 	{
@@ -25165,7 +25186,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 902:
+    case 904:
 
       {
 	{
@@ -25189,7 +25210,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 903:
+    case 905:
 
       {
 	{
@@ -25200,7 +25221,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 904:
+    case 906:
 
       {
 	{
@@ -25211,14 +25232,14 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 905:
+    case 907:
 
       {
 	parser_select_level++;;
       }
       break;
 
-    case 906:
+    case 908:
 
       {
 	{
@@ -25229,7 +25250,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 907:
+    case 909:
 
       {
 	{
@@ -25250,7 +25271,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 908:
+    case 910:
 
       {
 	{
@@ -25262,7 +25283,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 909:
+    case 911:
 
       {
 	{
@@ -25319,7 +25340,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 910:
+    case 912:
 
       {
 	{
@@ -25330,7 +25351,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 911:
+    case 913:
 
       {
 	{
@@ -25351,7 +25372,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 912:
+    case 914:
 
       {
 	{
@@ -25363,7 +25384,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 913:
+    case 915:
 
       {
 	{
@@ -25420,7 +25441,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 914:
+    case 916:
 
       {
 	{
@@ -25431,7 +25452,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 915:
+    case 917:
 
       {
 	{
@@ -25449,7 +25470,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 916:
+    case 918:
 
       {
 	{
@@ -25459,7 +25480,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 917:
+    case 919:
 
       {
 	{
@@ -25505,7 +25526,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 918:
+    case 920:
 
       {
 	{
@@ -25516,7 +25537,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 919:
+    case 921:
 
       {
 	{
@@ -25544,7 +25565,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 920:
+    case 922:
 
       {
 	{
@@ -25554,7 +25575,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 921:
+    case 923:
 
       {
 	{
@@ -25564,7 +25585,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 922:
+    case 924:
 
       {
 	{
@@ -25610,7 +25631,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 923:
+    case 925:
 
       {
 	{
@@ -25621,7 +25642,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 924:
+    case 926:
 
       {
 	{
@@ -25648,7 +25669,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 925:
+    case 927:
 
       {
 	{
@@ -25658,7 +25679,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 926:
+    case 928:
 
       {
 	{
@@ -25676,7 +25697,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 927:
+    case 929:
 
       {
 	{
@@ -25695,7 +25716,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 928:
+    case 930:
 
       {
 	{
@@ -25714,7 +25735,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 929:
+    case 931:
 
       {
 	{
@@ -25733,7 +25754,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 930:
+    case 932:
 
       {
 	{
@@ -25752,7 +25773,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 931:
+    case 933:
 
       {
 	{
@@ -25762,7 +25783,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 932:
+    case 934:
 
       {
 	{
@@ -25772,7 +25793,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 933:
+    case 935:
 
       {
 	{
@@ -25781,7 +25802,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 934:
+    case 936:
 
       {
 	{
@@ -25791,7 +25812,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 935:
+    case 937:
 
       {
 	{
@@ -25801,7 +25822,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 936:
+    case 938:
 
       {
 	{
@@ -25826,7 +25847,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 937:
+    case 939:
 
       {
 	{
@@ -25874,7 +25895,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 938:
+    case 940:
 
       {
 	{
@@ -25887,7 +25908,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 939:
+    case 941:
 
       {
 	{
@@ -25896,7 +25917,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 940:
+    case 942:
 
       {
 	{
@@ -25918,7 +25939,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 941:
+    case 943:
 
       {
 	{
@@ -25944,7 +25965,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 942:
+    case 944:
 
       {
 	{
@@ -25971,7 +25992,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 943:
+    case 945:
 
       {
 	{
@@ -25980,7 +26001,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 944:
+    case 946:
 
       {
 	{
@@ -25991,7 +26012,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 945:
+    case 947:
 
       {
 	{
@@ -26015,7 +26036,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 946:
+    case 948:
 
       {
 	{
@@ -26025,7 +26046,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 947:
+    case 949:
 
       {
 	{
@@ -26035,7 +26056,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 948:
+    case 950:
 
       {
 	{
@@ -26047,7 +26068,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 949:
+    case 951:
 
       {
 	{
@@ -26057,7 +26078,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 950:
+    case 952:
 
       {
 	{
@@ -26083,7 +26104,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 951:
+    case 953:
 
       {
 	{
@@ -26104,7 +26125,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 952:
+    case 954:
 
       {
 	{
@@ -26116,7 +26137,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 953:
+    case 955:
 
       {
 	{
@@ -26157,7 +26178,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 954:
+    case 956:
 
       {
 	{			/* $3 */
@@ -26168,7 +26189,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 955:
+    case 957:
 
       {
 	{
@@ -26294,7 +26315,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 956:
+    case 958:
 
       {
 	{
@@ -26305,7 +26326,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 957:
+    case 959:
 
       {
 	{
@@ -26315,7 +26336,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 958:
+    case 960:
 
       {
 	{
@@ -26325,7 +26346,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 961:
+    case 963:
 
       {
 	{
@@ -26338,7 +26359,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 962:
+    case 964:
 
       {
 	{
@@ -26351,7 +26372,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 963:
+    case 965:
 
       {
 	{
@@ -26364,7 +26385,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 964:
+    case 966:
 
       {
 	{
@@ -26377,7 +26398,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 965:
+    case 967:
 
       {
 	{
@@ -26390,7 +26411,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 966:
+    case 968:
 
       {
 	{
@@ -26403,7 +26424,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 967:
+    case 969:
 
       {
 	{
@@ -26414,7 +26435,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 968:
+    case 970:
 
       {
 	{
@@ -26425,7 +26446,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 969:
+    case 971:
 
       {
 	{
@@ -26436,7 +26457,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 970:
+    case 972:
 
       {
 	{
@@ -26447,7 +26468,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 971:
+    case 973:
 
       {
 	{
@@ -26460,7 +26481,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 972:
+    case 974:
 
       {
 	{
@@ -26476,7 +26497,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 973:
+    case 975:
 
       {
 	{
@@ -26485,7 +26506,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 974:
+    case 976:
 
       {
 	{
@@ -26501,7 +26522,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 975:
+    case 977:
 
       {
 	{
@@ -26518,7 +26539,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 976:
+    case 978:
 
       {
 	{
@@ -26530,7 +26551,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 977:
+    case 979:
 
       {
 	{
@@ -26545,7 +26566,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 978:
+    case 980:
 
       {
 	{
@@ -26591,7 +26612,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 979:
+    case 981:
 
       {
 	{
@@ -26611,7 +26632,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 980:
+    case 982:
 
       {
 	{
@@ -26623,7 +26644,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 981:
+    case 983:
 
       {
 	{
@@ -26642,7 +26663,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 982:
+    case 984:
 
       {
 	{
@@ -26657,7 +26678,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 983:
+    case 985:
 
       {
 	{
@@ -26669,7 +26690,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 984:
+    case 986:
 
       {
 	{
@@ -26679,7 +26700,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 985:
+    case 987:
 
       {
 	{
@@ -26691,7 +26712,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 986:
+    case 988:
 
       {
 	{
@@ -26710,7 +26731,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 987:
+    case 989:
 
       {
 	{
@@ -26729,7 +26750,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 988:
+    case 990:
 
       {
 	{
@@ -26747,7 +26768,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 989:
+    case 991:
 
       {
 	{
@@ -26765,7 +26786,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 990:
+    case 992:
 
       {
 	{
@@ -26783,7 +26804,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 991:
+    case 993:
 
       {
 	{
@@ -26801,7 +26822,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 992:
+    case 994:
 
       {
 	{
@@ -26826,7 +26847,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 993:
+    case 995:
 
       {
 	{
@@ -26856,7 +26877,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 994:
+    case 996:
 
       {
 	{
@@ -26875,7 +26896,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 995:
+    case 997:
 
       {
 	{
@@ -26905,7 +26926,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 996:
+    case 998:
 
       {
 	{
@@ -26917,7 +26938,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 997:
+    case 999:
 
       {
 	{
@@ -26928,7 +26949,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 998:
+    case 1000:
 
       {
 	parser_save_and_set_ic (1);
@@ -26941,7 +26962,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 999:
+    case 1001:
 
       {
 	{
@@ -26955,7 +26976,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1000:
+    case 1002:
 
       {
 	{
@@ -26968,7 +26989,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1001:
+    case 1003:
 
       {
 	{
@@ -26982,7 +27003,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1002:
+    case 1004:
 
       {
 	{
@@ -26996,7 +27017,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1003:
+    case 1005:
 
       {
 	{
@@ -27010,7 +27031,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1004:
+    case 1006:
 
       {
 	parser_save_and_set_pseudoc (0);
@@ -27018,7 +27039,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1005:
+    case 1007:
 
       {
 	{
@@ -27029,7 +27050,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1006:
+    case 1008:
 
       {
 	parser_save_and_set_prc (1);
@@ -27040,7 +27061,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1007:
+    case 1009:
 
       {
 	{
@@ -27054,7 +27075,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1009:
+    case 1011:
 
       {
 	{
@@ -27069,7 +27090,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1010:
+    case 1012:
 
       {
 	{
@@ -27080,7 +27101,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1011:
+    case 1013:
 
       {
 	{
@@ -27090,7 +27111,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1012:
+    case 1014:
 
       {
 	{
@@ -27101,7 +27122,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1013:
+    case 1015:
 
       {
 	{
@@ -27112,7 +27133,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1014:
+    case 1016:
 
       {
 	{
@@ -27124,7 +27145,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1015:
+    case 1017:
 
       {
 	{
@@ -27134,7 +27155,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1016:
+    case 1018:
 
       {
 	parser_groupby_exception = 0;
@@ -27142,7 +27163,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1017:
+    case 1019:
 
       {
 	{
@@ -27189,7 +27210,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1018:
+    case 1020:
 
       {
 	{
@@ -27200,14 +27221,14 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1019:
+    case 1021:
 
       {
 	parser_save_and_set_gc (1);;
       }
       break;
 
-    case 1020:
+    case 1022:
 
       {
 	{
@@ -27218,7 +27239,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1021:
+    case 1023:
 
       {
 	{
@@ -27229,7 +27250,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1022:
+    case 1024:
 
       {
 	{
@@ -27239,7 +27260,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1023:
+    case 1025:
 
       {
 	{
@@ -27259,7 +27280,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1024:
+    case 1026:
 
       {
 	{
@@ -27296,7 +27317,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1025:
+    case 1027:
 
       {
 	{
@@ -27308,7 +27329,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1026:
+    case 1028:
 
       {
 	{
@@ -27318,7 +27339,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1027:
+    case 1029:
 
       {
 	{
@@ -27330,7 +27351,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1028:
+    case 1030:
 
       {
 	{
@@ -27340,7 +27361,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1029:
+    case 1031:
 
       {
 	{
@@ -27370,7 +27391,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1030:
+    case 1032:
 
       {
 	{
@@ -27399,7 +27420,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1031:
+    case 1033:
 
       {
 	{
@@ -27409,7 +27430,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1032:
+    case 1034:
 
       {
 	{
@@ -27422,7 +27443,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1033:
+    case 1035:
 
       {
 	{
@@ -27435,7 +27456,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1034:
+    case 1036:
 
       {
 	{
@@ -27448,7 +27469,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1035:
+    case 1037:
 
       {
 	{
@@ -27463,7 +27484,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1036:
+    case 1038:
 
       {
 	{
@@ -27474,7 +27495,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1037:
+    case 1039:
 
       {
 	{
@@ -27484,7 +27505,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1038:
+    case 1040:
 
       {
 	{
@@ -27494,7 +27515,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1040:
+    case 1042:
 
       {
 	{
@@ -27515,7 +27536,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1041:
+    case 1043:
 
       {
 	{
@@ -27555,7 +27576,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1042:
+    case 1044:
 
       {
 	{
@@ -27567,7 +27588,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1043:
+    case 1045:
 
       {
 	{
@@ -27577,7 +27598,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1044:
+    case 1046:
 
       {
 	{
@@ -27606,7 +27627,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1045:
+    case 1047:
 
       {
 	{
@@ -27618,7 +27639,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1046:
+    case 1048:
 
       {
 	{
@@ -27628,7 +27649,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1047:
+    case 1049:
 
       {
 	{
@@ -27657,21 +27678,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1048:
+    case 1050:
 
       {
 	((*yyvalp).node) = NULL;;
       }
       break;
 
-    case 1049:
+    case 1051:
 
       {
 	parser_save_and_set_oc (1);;
       }
       break;
 
-    case 1050:
+    case 1052:
 
       {
 	{
@@ -27689,14 +27710,14 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1051:
+    case 1053:
 
       {
 	((*yyvalp).node) = NULL;;
       }
       break;
 
-    case 1052:
+    case 1054:
 
       {
 	{
@@ -27725,7 +27746,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1053:
+    case 1055:
 
       {
 	{
@@ -27742,7 +27763,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1054:
+    case 1056:
 
       {
 	{
@@ -27896,7 +27917,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1056:
+    case 1058:
 
       {
 	{
@@ -27913,7 +27934,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1057:
+    case 1059:
 
       {
 	{
@@ -27927,7 +27948,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1058:
+    case 1060:
 
       {
 	{
@@ -27941,7 +27962,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1059:
+    case 1061:
 
       {
 	{
@@ -27950,7 +27971,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1060:
+    case 1062:
 
       {
 	{
@@ -27964,7 +27985,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1061:
+    case 1063:
 
       {
 	{
@@ -27978,7 +27999,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1062:
+    case 1064:
 
       {
 	{
@@ -27987,7 +28008,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1063:
+    case 1065:
 
       {
 	{
@@ -27997,7 +28018,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1064:
+    case 1066:
 
       {
 	{
@@ -28007,7 +28028,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1065:
+    case 1067:
 
       {
 	{
@@ -28023,7 +28044,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1067:
+    case 1069:
 
       {
 	{
@@ -28089,7 +28110,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1068:
+    case 1070:
 
       {
 	{
@@ -28106,7 +28127,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1069:
+    case 1071:
 
       {
 	{
@@ -28128,7 +28149,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1070:
+    case 1072:
 
       {
 	{
@@ -28150,14 +28171,14 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1071:
+    case 1073:
 
       {
 	((*yyvalp).node) = NULL;;
       }
       break;
 
-    case 1072:
+    case 1074:
 
       {
 	{
@@ -28167,14 +28188,14 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1073:
+    case 1075:
 
       {
 	((*yyvalp).node) = NULL;;
       }
       break;
 
-    case 1074:
+    case 1076:
 
       {
 	{
@@ -28195,7 +28216,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1075:
+    case 1077:
 
       {
 	{
@@ -28207,7 +28228,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1076:
+    case 1078:
 
       {
 	{
@@ -28217,7 +28238,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1077:
+    case 1079:
 
       {
 	{
@@ -28237,7 +28258,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1078:
+    case 1080:
 
       {
 	{
@@ -28258,7 +28279,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1079:
+    case 1081:
 
       {
 	{
@@ -28279,7 +28300,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1080:
+    case 1082:
 
       {
 	{
@@ -28290,7 +28311,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1081:
+    case 1083:
 
       {
 	{
@@ -28301,7 +28322,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1082:
+    case 1084:
 
       {
 	{
@@ -28312,7 +28333,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1083:
+    case 1085:
 
       {
 	{
@@ -28322,7 +28343,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1084:
+    case 1086:
 
       {
 	{
@@ -28332,7 +28353,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1085:
+    case 1087:
 
       {
 	{
@@ -28342,7 +28363,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1086:
+    case 1088:
 
       {
 	{
@@ -28352,7 +28373,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1087:
+    case 1089:
 
       {
 	{
@@ -28367,7 +28388,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1088:
+    case 1090:
 
       {
 	{
@@ -28377,7 +28398,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1089:
+    case 1091:
 
       {
 	{
@@ -28392,7 +28413,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1090:
+    case 1092:
 
       {
 	{
@@ -28402,7 +28423,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1091:
+    case 1093:
 
       {
 	{
@@ -28417,7 +28438,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1092:
+    case 1094:
 
       {
 	{
@@ -28427,7 +28448,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1093:
+    case 1095:
 
       {
 	{
@@ -28442,7 +28463,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1094:
+    case 1096:
 
       {
 	{
@@ -28457,7 +28478,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1095:
+    case 1097:
 
       {
 	{
@@ -28467,7 +28488,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1096:
+    case 1098:
 
       {
 	{
@@ -28482,7 +28503,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1097:
+    case 1099:
 
       {
 	{
@@ -28497,7 +28518,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1098:
+    case 1100:
 
       {
 	{
@@ -28507,7 +28528,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1099:
+    case 1101:
 
       {
 	{
@@ -28522,7 +28543,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1100:
+    case 1102:
 
       {
 	{
@@ -28537,7 +28558,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1101:
+    case 1103:
 
       {
 	{
@@ -28552,7 +28573,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1102:
+    case 1104:
 
       {
 	{
@@ -28567,7 +28588,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1103:
+    case 1105:
 
       {
 	{
@@ -28577,7 +28598,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1104:
+    case 1106:
 
       {
 	{
@@ -28592,7 +28613,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1105:
+    case 1107:
 
       {
 	{
@@ -28602,7 +28623,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1106:
+    case 1108:
 
       {
 	{
@@ -28612,7 +28633,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1107:
+    case 1109:
 
       {
 	{
@@ -28625,7 +28646,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1108:
+    case 1110:
 
       {
 	{
@@ -28635,7 +28656,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1109:
+    case 1111:
 
       {
 	{
@@ -28648,7 +28669,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1110:
+    case 1112:
 
       {
 	{
@@ -28662,7 +28683,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1111:
+    case 1113:
 
       {
 	{
@@ -28687,7 +28708,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1112:
+    case 1114:
 
       {
 	{
@@ -28701,7 +28722,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1113:
+    case 1115:
 
       {
 	{
@@ -28727,7 +28748,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1114:
+    case 1116:
 
       {
 	{
@@ -28749,7 +28770,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1115:
+    case 1117:
 
       {
 	{
@@ -28764,7 +28785,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1116:
+    case 1118:
 
       {
 	{
@@ -28774,7 +28795,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1117:
+    case 1119:
 
       {
 	{
@@ -28784,7 +28805,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1118:
+    case 1120:
 
       {
 	{
@@ -28794,7 +28815,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1119:
+    case 1121:
 
       {
 	{
@@ -28804,7 +28825,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1120:
+    case 1122:
 
       {
 	{
@@ -28818,7 +28839,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1121:
+    case 1123:
 
       {
 	{
@@ -28828,7 +28849,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1122:
+    case 1124:
 
       {
 	{
@@ -28881,7 +28902,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1123:
+    case 1125:
 
       {
 	{
@@ -28900,7 +28921,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1124:
+    case 1126:
 
       {
 	{
@@ -28910,7 +28931,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1125:
+    case 1127:
 
       {
 	{
@@ -28920,7 +28941,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1126:
+    case 1128:
 
       {
 	{
@@ -28932,7 +28953,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1127:
+    case 1129:
 
       {
 	{
@@ -28943,7 +28964,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1128:
+    case 1130:
 
       {
 	{
@@ -28953,7 +28974,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1129:
+    case 1131:
 
       {
 	{
@@ -28963,7 +28984,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1130:
+    case 1132:
 
       {
 	{
@@ -28973,7 +28994,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1131:
+    case 1133:
 
       {
 	{
@@ -28983,7 +29004,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1132:
+    case 1134:
 
       {
 	{
@@ -29004,7 +29025,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1133:
+    case 1135:
 
       {
 	{
@@ -29028,7 +29049,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1134:
+    case 1136:
 
       {
 	{
@@ -29050,7 +29071,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1135:
+    case 1137:
 
       {
 	{
@@ -29075,7 +29096,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1136:
+    case 1138:
 
       {
 	{
@@ -29097,7 +29118,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1137:
+    case 1139:
 
       {
 	{
@@ -29122,7 +29143,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1138:
+    case 1140:
 
       {
 	{
@@ -29151,7 +29172,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1139:
+    case 1141:
 
       {
 	{
@@ -29174,7 +29195,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1140:
+    case 1142:
 
       {
 	{
@@ -29205,7 +29226,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1141:
+    case 1143:
 
       {
 	{
@@ -29231,7 +29252,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1142:
+    case 1144:
 
       {
 	{
@@ -29264,7 +29285,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1143:
+    case 1145:
 
       {
 	{
@@ -29312,7 +29333,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1144:
+    case 1146:
 
       {
 	{
@@ -29352,7 +29373,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1145:
+    case 1147:
 
       {
 	{
@@ -29387,7 +29408,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1146:
+    case 1148:
 
       {
 	{
@@ -29417,7 +29438,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1147:
+    case 1149:
 
       {
 	{
@@ -29456,21 +29477,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1148:
+    case 1150:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_GROUP_CONCAT);;
       }
       break;
 
-    case 1149:
+    case 1151:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1150:
+    case 1152:
 
       {
 	{
@@ -29495,7 +29516,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1151:
+    case 1153:
 
       {
 	{
@@ -29527,7 +29548,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1152:
+    case 1154:
 
       {
 	{
@@ -29593,21 +29614,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1153:
+    case 1155:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_INSERT_SUBSTRING);;
       }
       break;
 
-    case 1154:
+    case 1156:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1155:
+    case 1157:
 
       {
 	{
@@ -29626,7 +29647,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1156:
+    case 1158:
 
       {
 	{
@@ -29645,7 +29666,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1157:
+    case 1159:
 
       {
 	{
@@ -29660,21 +29681,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1158:
+    case 1160:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SUBSTRING);;
       }
       break;
 
-    case 1159:
+    case 1161:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1160:
+    case 1162:
 
       {
 	{
@@ -29694,21 +29715,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1161:
+    case 1163:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SUBSTRING);;
       }
       break;
 
-    case 1162:
+    case 1164:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1163:
+    case 1165:
 
       {
 	{
@@ -29726,21 +29747,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1164:
+    case 1166:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SUBSTRING);;
       }
       break;
 
-    case 1165:
+    case 1167:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1166:
+    case 1168:
 
       {
 	{
@@ -29760,21 +29781,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1167:
+    case 1169:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SUBSTRING);;
       }
       break;
 
-    case 1168:
+    case 1170:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1169:
+    case 1171:
 
       {
 	{
@@ -29792,21 +29813,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1170:
+    case 1172:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_DATE);;
       }
       break;
 
-    case 1171:
+    case 1173:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1172:
+    case 1174:
 
       {
 	{
@@ -29821,21 +29842,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1173:
+    case 1175:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TIME);;
       }
       break;
 
-    case 1174:
+    case 1176:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1175:
+    case 1177:
 
       {
 	{
@@ -29850,21 +29871,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1176:
+    case 1178:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_ADDDATE);;
       }
       break;
 
-    case 1177:
+    case 1179:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1178:
+    case 1180:
 
       {
 	{
@@ -29881,21 +29902,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1179:
+    case 1181:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_DATE_ADD);;
       }
       break;
 
-    case 1180:
+    case 1182:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1181:
+    case 1183:
 
       {
 	{
@@ -29922,21 +29943,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1182:
+    case 1184:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SUBDATE);;
       }
       break;
 
-    case 1183:
+    case 1185:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1184:
+    case 1186:
 
       {
 	{
@@ -29953,21 +29974,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1185:
+    case 1187:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_DATE_SUB);;
       }
       break;
 
-    case 1186:
+    case 1188:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1187:
+    case 1189:
 
       {
 	{
@@ -29994,21 +30015,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1188:
+    case 1190:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TIMESTAMP);;
       }
       break;
 
-    case 1189:
+    case 1191:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1190:
+    case 1192:
 
       {
 	{
@@ -30027,21 +30048,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1191:
+    case 1193:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TIMESTAMP);;
       }
       break;
 
-    case 1192:
+    case 1194:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1193:
+    case 1195:
 
       {
 	{
@@ -30053,21 +30074,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1194:
+    case 1196:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_YEAR);;
       }
       break;
 
-    case 1195:
+    case 1197:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1196:
+    case 1198:
 
       {
 	{
@@ -30079,21 +30100,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1197:
+    case 1199:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_MONTH);;
       }
       break;
 
-    case 1198:
+    case 1200:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1199:
+    case 1201:
 
       {
 	{
@@ -30105,21 +30126,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1200:
+    case 1202:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_DAY);;
       }
       break;
 
-    case 1201:
+    case 1203:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1202:
+    case 1204:
 
       {
 	{
@@ -30131,21 +30152,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1203:
+    case 1205:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_HOUR);;
       }
       break;
 
-    case 1204:
+    case 1206:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1205:
+    case 1207:
 
       {
 	{
@@ -30157,21 +30178,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1206:
+    case 1208:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_MINUTE);;
       }
       break;
 
-    case 1207:
+    case 1209:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1208:
+    case 1210:
 
       {
 	{
@@ -30183,21 +30204,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1209:
+    case 1211:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SECOND);;
       }
       break;
 
-    case 1210:
+    case 1212:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1211:
+    case 1213:
 
       {
 	{
@@ -30209,21 +30230,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1212:
+    case 1214:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_DATABASE);;
       }
       break;
 
-    case 1213:
+    case 1215:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1214:
+    case 1216:
 
       {
 	{
@@ -30235,21 +30256,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1215:
+    case 1217:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SCHEMA);;
       }
       break;
 
-    case 1216:
+    case 1218:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1217:
+    case 1219:
 
       {
 	{
@@ -30261,21 +30282,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1218:
+    case 1220:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TRIM);;
       }
       break;
 
-    case 1219:
+    case 1221:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1220:
+    case 1222:
 
       {
 	{
@@ -30294,21 +30315,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1221:
+    case 1223:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TRIM);;
       }
       break;
 
-    case 1222:
+    case 1224:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1223:
+    case 1225:
 
       {
 	{
@@ -30325,21 +30346,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1224:
+    case 1226:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TRIM);;
       }
       break;
 
-    case 1225:
+    case 1227:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1226:
+    case 1228:
 
       {
 	{
@@ -30357,21 +30378,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1227:
+    case 1229:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TRIM);;
       }
       break;
 
-    case 1228:
+    case 1230:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1229:
+    case 1231:
 
       {
 	{
@@ -30387,21 +30408,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1230:
+    case 1232:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CHR);;
       }
       break;
 
-    case 1231:
+    case 1233:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1232:
+    case 1234:
 
       {
 	{
@@ -30418,21 +30439,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1233:
+    case 1235:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CLOB_TO_CHAR);;
       }
       break;
 
-    case 1234:
+    case 1236:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1235:
+    case 1237:
 
       {
 	{
@@ -30449,21 +30470,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1236:
+    case 1238:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CAST);;
       }
       break;
 
-    case 1237:
+    case 1239:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1238:
+    case 1240:
 
       {
 	{
@@ -30505,7 +30526,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1239:
+    case 1241:
 
       {
 	{
@@ -30519,7 +30540,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1240:
+    case 1242:
 
       {
 	{
@@ -30530,7 +30551,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1241:
+    case 1243:
 
       {
 	{
@@ -30541,7 +30562,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1242:
+    case 1244:
 
       {
 	{
@@ -30552,7 +30573,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1243:
+    case 1245:
 
       {
 	{
@@ -30563,7 +30584,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1244:
+    case 1246:
 
       {
 	{
@@ -30574,7 +30595,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1245:
+    case 1247:
 
       {
 	{
@@ -30585,7 +30606,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1246:
+    case 1248:
 
       {
 	{
@@ -30596,7 +30617,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1247:
+    case 1249:
 
       {
 	{
@@ -30607,7 +30628,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1248:
+    case 1250:
 
       {
 	{
@@ -30618,7 +30639,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1249:
+    case 1251:
 
       {
 	{
@@ -30629,7 +30650,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1250:
+    case 1252:
 
       {
 	{
@@ -30644,21 +30665,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1251:
+    case 1253:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SYSTEM_USER);;
       }
       break;
 
-    case 1252:
+    case 1254:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1253:
+    case 1255:
 
       {
 	{
@@ -30670,21 +30691,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1254:
+    case 1256:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_DEFAULT);;
       }
       break;
 
-    case 1255:
+    case 1257:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1256:
+    case 1258:
 
       {
 	{
@@ -30703,7 +30724,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1257:
+    case 1259:
 
       {
 	{
@@ -30719,7 +30740,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1258:
+    case 1260:
 
       {
 	{
@@ -30743,21 +30764,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1259:
+    case 1261:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_ADD_MONTHS);;
       }
       break;
 
-    case 1260:
+    case 1262:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1261:
+    case 1263:
 
       {
 	{
@@ -30772,21 +30793,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1262:
+    case 1264:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_OCTET_LENGTH);;
       }
       break;
 
-    case 1263:
+    case 1265:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1264:
+    case 1266:
 
       {
 	{
@@ -30799,21 +30820,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1265:
+    case 1267:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_BIT_LENGTH);;
       }
       break;
 
-    case 1266:
+    case 1268:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1267:
+    case 1269:
 
       {
 	{
@@ -30826,21 +30847,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1268:
+    case 1270:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_LOWER);;
       }
       break;
 
-    case 1269:
+    case 1271:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1270:
+    case 1272:
 
       {
 	{
@@ -30853,21 +30874,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1271:
+    case 1273:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_LOWER);;
       }
       break;
 
-    case 1272:
+    case 1274:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1273:
+    case 1275:
 
       {
 	{
@@ -30880,21 +30901,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1274:
+    case 1276:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_UPPER);;
       }
       break;
 
-    case 1275:
+    case 1277:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1276:
+    case 1278:
 
       {
 	{
@@ -30907,21 +30928,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1277:
+    case 1279:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_UPPER);;
       }
       break;
 
-    case 1278:
+    case 1280:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1279:
+    case 1281:
 
       {
 	{
@@ -30934,7 +30955,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1280:
+    case 1282:
 
       {
 	{
@@ -30950,14 +30971,14 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1281:
+    case 1283:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1282:
+    case 1284:
 
       {
 	{
@@ -30988,21 +31009,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1283:
+    case 1285:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_IF);;
       }
       break;
 
-    case 1284:
+    case 1286:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1285:
+    case 1287:
 
       {
 	{
@@ -31019,21 +31040,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1286:
+    case 1288:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_IFNULL);;
       }
       break;
 
-    case 1287:
+    case 1289:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1288:
+    case 1290:
 
       {
 	{
@@ -31048,21 +31069,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1289:
+    case 1291:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_ISNULL);;
       }
       break;
 
-    case 1290:
+    case 1292:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1291:
+    case 1293:
 
       {
 	{
@@ -31075,21 +31096,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1292:
+    case 1294:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_LEFT);;
       }
       break;
 
-    case 1293:
+    case 1295:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1294:
+    case 1296:
 
       {
 	{
@@ -31105,21 +31126,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1295:
+    case 1297:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_RIGHT);;
       }
       break;
 
-    case 1296:
+    case 1298:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1297:
+    case 1299:
 
       {
 	{
@@ -31135,21 +31156,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1298:
+    case 1300:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_MODULUS);;
       }
       break;
 
-    case 1299:
+    case 1301:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1300:
+    case 1302:
 
       {
 	{
@@ -31165,21 +31186,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1301:
+    case 1303:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TRUNCATE);;
       }
       break;
 
-    case 1302:
+    case 1304:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1303:
+    case 1305:
 
       {
 	{
@@ -31194,21 +31215,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1304:
+    case 1306:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TRANSLATE);;
       }
       break;
 
-    case 1305:
+    case 1307:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1306:
+    case 1308:
 
       {
 	{
@@ -31225,21 +31246,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1307:
+    case 1309:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_TRANSLATE);;
       }
       break;
 
-    case 1308:
+    case 1310:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1309:
+    case 1311:
 
       {
 	{
@@ -31256,21 +31277,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1310:
+    case 1312:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_REPLACE);;
       }
       break;
 
-    case 1311:
+    case 1313:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1312:
+    case 1314:
 
       {
 	{
@@ -31285,21 +31306,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1313:
+    case 1315:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_STRTODATE);;
       }
       break;
 
-    case 1314:
+    case 1316:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1315:
+    case 1317:
 
       {
 	{
@@ -31314,21 +31335,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1316:
+    case 1318:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_STRTODATE);;
       }
       break;
 
-    case 1317:
+    case 1319:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1318:
+    case 1320:
 
       {
 	{
@@ -31347,21 +31368,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1319:
+    case 1321:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CHARSET);;
       }
       break;
 
-    case 1320:
+    case 1322:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1321:
+    case 1323:
 
       {
 	{
@@ -31375,21 +31396,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1322:
+    case 1324:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_COLLATION);;
       }
       break;
 
-    case 1323:
+    case 1325:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1324:
+    case 1326:
 
       {
 	{
@@ -31403,7 +31424,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1325:
+    case 1327:
 
       {
 	{
@@ -31426,21 +31447,21 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1326:
+    case 1328:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_INDEX_PREFIX);;
       }
       break;
 
-    case 1327:
+    case 1329:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1328:
+    case 1330:
 
       {
 	{
@@ -31457,7 +31478,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1329:
+    case 1331:
 
       {
 	{
@@ -31466,7 +31487,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1330:
+    case 1332:
 
       {
 	{
@@ -31475,119 +31496,119 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1332:
+    case 1334:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CURRENT_DATE);;
       }
       break;
 
-    case 1333:
+    case 1335:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1335:
+    case 1337:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CURRENT_TIME);;
       }
       break;
 
-    case 1336:
+    case 1338:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1338:
+    case 1340:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_DB_TIMEZONE);;
       }
       break;
 
-    case 1339:
+    case 1341:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1341:
+    case 1343:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_SESSION_TIMEZONE);;
       }
       break;
 
-    case 1342:
+    case 1344:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1344:
+    case 1346:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CURRENT_TIMESTAMP);;
       }
       break;
 
-    case 1345:
+    case 1347:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1347:
+    case 1349:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_LOCALTIMESTAMP);;
       }
       break;
 
-    case 1348:
+    case 1350:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1350:
+    case 1352:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_LOCALTIME);;
       }
       break;
 
-    case 1351:
+    case 1353:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1353:
+    case 1355:
 
       {
 	push_msg (MSGCAT_SYNTAX_INVALID_CURRENT_DATETIME);;
       }
       break;
 
-    case 1354:
+    case 1356:
 
       {
 	pop_msg ();;
       }
       break;
 
-    case 1358:
+    case 1360:
 
       {
 	{
@@ -31598,7 +31619,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1359:
+    case 1361:
 
       {
 	{
@@ -31609,7 +31630,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1360:
+    case 1362:
 
       {
 	{
@@ -31620,7 +31641,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1361:
+    case 1363:
 
       {
 	{
@@ -31631,7 +31652,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1362:
+    case 1364:
 
       {
 	{
@@ -31642,7 +31663,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1363:
+    case 1365:
 
       {
 	{
@@ -31653,7 +31674,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1364:
+    case 1366:
 
       {
 	{
@@ -31664,7 +31685,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1365:
+    case 1367:
 
       {
 	{
@@ -31675,7 +31696,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1366:
+    case 1368:
 
       {
 	{
@@ -31686,7 +31707,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1367:
+    case 1369:
 
       {
 	{
@@ -31697,7 +31718,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1368:
+    case 1370:
 
       {
 	{
@@ -31708,7 +31729,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1369:
+    case 1371:
 
       {
 	{
@@ -31719,7 +31740,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1370:
+    case 1372:
 
       {
 	{
@@ -31730,7 +31751,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1371:
+    case 1373:
 
       {
 	{
@@ -31741,7 +31762,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1372:
+    case 1374:
 
       {
 	{
@@ -31752,7 +31773,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1373:
+    case 1375:
 
       {
 	{
@@ -31763,7 +31784,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1374:
+    case 1376:
 
       {
 	{
@@ -31774,7 +31795,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1375:
+    case 1377:
 
       {
 	{
@@ -31785,7 +31806,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1376:
+    case 1378:
 
       {
 	{
@@ -31796,7 +31817,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1377:
+    case 1379:
 
       {
 	{
@@ -31807,7 +31828,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1378:
+    case 1380:
 
       {
 	{
@@ -31818,7 +31839,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1379:
+    case 1381:
 
       {
 	{
@@ -31829,7 +31850,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1380:
+    case 1382:
 
       {
 	{
@@ -31840,7 +31861,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1381:
+    case 1383:
 
       {
 	{
@@ -31851,7 +31872,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1382:
+    case 1384:
 
       {
 	{
@@ -31862,7 +31883,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1383:
+    case 1385:
 
       {
 	{
@@ -31873,7 +31894,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1384:
+    case 1386:
 
       {
 	{
@@ -31884,7 +31905,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1385:
+    case 1387:
 
       {
 	{
@@ -31895,7 +31916,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1386:
+    case 1388:
 
       {
 	{
@@ -31906,7 +31927,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1387:
+    case 1389:
 
       {
 	{
@@ -31917,7 +31938,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1388:
+    case 1390:
 
       {
 	{
@@ -31928,7 +31949,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1389:
+    case 1391:
 
       {
 	{
@@ -31939,7 +31960,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1390:
+    case 1392:
 
       {
 	{
@@ -31950,7 +31971,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1391:
+    case 1393:
 
       {
 	{
@@ -31961,7 +31982,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1392:
+    case 1394:
 
       {
 	{
@@ -31972,7 +31993,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1393:
+    case 1395:
 
       {
 	{
@@ -31983,7 +32004,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1394:
+    case 1396:
 
       {
 	{
@@ -31993,7 +32014,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1395:
+    case 1397:
 
       {
 	{
@@ -32003,7 +32024,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1398:
+    case 1400:
 
       {
 	{
@@ -32014,17 +32035,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1399:
-
-      {
-	{
-
-	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((2) - (2))].yystate.yysemantics.yysval.node);
-	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
-      }
-      break;
-
-    case 1400:
+    case 1401:
 
       {
 	{
@@ -32034,23 +32045,12 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1401:
-
-      {
-	{
-
-	  ((*yyvalp).node) = NULL;
-
-	DBG_PRINT};
-      }
-      break;
-
     case 1402:
 
       {
 	{
 
-	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((3) - (3))].yystate.yysemantics.yysval.node);
+	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((2) - (2))].yystate.yysemantics.yysval.node);
 	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
       break;
@@ -32071,9 +32071,8 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       {
 	{
 
-	  ((*yyvalp).node) = NULL;
-
-	DBG_PRINT};
+	  ((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((3) - (3))].yystate.yysemantics.yysval.node);
+	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
       break;
 
@@ -32082,7 +32081,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       {
 	{
 
-	  ((*yyvalp).node) = PT_FROM_LAST;
+	  ((*yyvalp).node) = NULL;
 
 	DBG_PRINT};
       }
@@ -32104,7 +32103,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       {
 	{
 
-	  ((*yyvalp).node) = NULL;
+	  ((*yyvalp).node) = PT_FROM_LAST;
 
 	DBG_PRINT};
       }
@@ -32115,7 +32114,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       {
 	{
 
-	  ((*yyvalp).node) = PT_IGNORE_NULLS;
+	  ((*yyvalp).node) = NULL;
 
 	DBG_PRINT};
       }
@@ -32134,6 +32133,28 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
     case 1410:
 
+      {
+	{
+
+	  ((*yyvalp).node) = PT_IGNORE_NULLS;
+
+	DBG_PRINT};
+      }
+      break;
+
+    case 1411:
+
+      {
+	{
+
+	  ((*yyvalp).node) = NULL;
+
+	DBG_PRINT};
+      }
+      break;
+
+    case 1412:
+
       {
 	{
 
@@ -32153,7 +32174,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1411:
+    case 1413:
 
       {
 	{
@@ -32165,7 +32186,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1412:
+    case 1414:
 
       {
 	{
@@ -32177,7 +32198,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1413:
+    case 1415:
 
       {
 	{
@@ -32188,7 +32209,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1414:
+    case 1416:
 
       {
 	{
@@ -32208,7 +32229,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1415:
+    case 1417:
 
       {
 	{
@@ -32219,7 +32240,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1416:
+    case 1418:
 
       {
 	{
@@ -32230,7 +32251,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1417:
+    case 1419:
 
       {
 	{
@@ -32241,7 +32262,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1418:
+    case 1420:
 
       {
 	{
@@ -32255,7 +32276,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1419:
+    case 1421:
 
       {
 	{
@@ -32325,7 +32346,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1420:
+    case 1422:
 
       {
 	{
@@ -32386,7 +32407,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1421:
+    case 1423:
 
       {
 	{
@@ -32435,7 +32456,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1422:
+    case 1424:
 
       {
 	{
@@ -32446,7 +32467,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1423:
+    case 1425:
 
       {
 	{
@@ -32456,7 +32477,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1424:
+    case 1426:
 
       {
 	{
@@ -32468,7 +32489,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1425:
+    case 1427:
 
       {
 	{
@@ -32478,7 +32499,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1426:
+    case 1428:
 
       {
 	{
@@ -32510,7 +32531,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1427:
+    case 1429:
 
       {
 	{
@@ -32522,7 +32543,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1428:
+    case 1430:
 
       {
 	{
@@ -32532,7 +32553,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1429:
+    case 1431:
 
       {
 	{
@@ -32560,7 +32581,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1430:
+    case 1432:
 
       {
 	{
@@ -32578,7 +32599,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1435:
+    case 1437:
 
       {
 	{
@@ -32589,7 +32610,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1436:
+    case 1438:
 
       {
 	{
@@ -32600,7 +32621,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1437:
+    case 1439:
 
       {
 	{
@@ -32611,7 +32632,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1438:
+    case 1440:
 
       {
 	{
@@ -32622,7 +32643,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1439:
+    case 1441:
 
       {
 	{
@@ -32633,7 +32654,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1440:
+    case 1442:
 
       {
 	{
@@ -32644,7 +32665,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1441:
+    case 1443:
 
       {
 	{
@@ -32655,7 +32676,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1442:
+    case 1444:
 
       {
 	{
@@ -32666,7 +32687,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1443:
+    case 1445:
 
       {
 	{
@@ -32677,7 +32698,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1444:
+    case 1446:
 
       {
 	{
@@ -32688,7 +32709,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1445:
+    case 1447:
 
       {
 	{
@@ -32699,7 +32720,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1446:
+    case 1448:
 
       {
 	{
@@ -32710,7 +32731,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1447:
+    case 1449:
 
       {
 	{
@@ -32721,7 +32742,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1448:
+    case 1450:
 
       {
 	{
@@ -32732,7 +32753,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1449:
+    case 1451:
 
       {
 	{
@@ -32743,7 +32764,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1450:
+    case 1452:
 
       {
 	{
@@ -32754,7 +32775,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1451:
+    case 1453:
 
       {
 	{
@@ -32765,7 +32786,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1452:
+    case 1454:
 
       {
 	{
@@ -32776,7 +32797,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1453:
+    case 1455:
 
       {
 	{
@@ -32787,7 +32808,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1454:
+    case 1456:
 
       {
 	{
@@ -32798,7 +32819,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1455:
+    case 1457:
 
       {
 	{
@@ -32809,7 +32830,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1456:
+    case 1458:
 
       {
 	{
@@ -32819,7 +32840,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1457:
+    case 1459:
 
       {
 	{
@@ -32853,7 +32874,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1458:
+    case 1460:
 
       {
 	{
@@ -32895,7 +32916,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1459:
+    case 1461:
 
       {
 	{
@@ -32906,7 +32927,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1460:
+    case 1462:
 
       {
 	{
@@ -32916,7 +32937,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1461:
+    case 1463:
 
       {
 	{
@@ -32934,7 +32955,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1462:
+    case 1464:
 
       {
 	{
@@ -32952,7 +32973,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1463:
+    case 1465:
 
       {
 	{
@@ -32970,7 +32991,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1464:
+    case 1466:
 
       {
 	{
@@ -32988,7 +33009,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1465:
+    case 1467:
 
       {
 	{
@@ -33005,7 +33026,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1466:
+    case 1468:
 
       {
 	{
@@ -33018,7 +33039,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1467:
+    case 1469:
 
       {
 	{
@@ -33035,7 +33056,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1468:
+    case 1470:
 
       {
 	{
@@ -33045,7 +33066,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1469:
+    case 1471:
 
       {
 	{
@@ -33063,7 +33084,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1470:
+    case 1472:
 
       {
 	{
@@ -33073,7 +33094,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1471:
+    case 1473:
 
       {
 	{
@@ -33084,7 +33105,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1472:
+    case 1474:
 
       {
 	{
@@ -33095,7 +33116,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1473:
+    case 1475:
 
       {
 	{
@@ -33112,7 +33133,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1474:
+    case 1476:
 
       {
 	{
@@ -33122,7 +33143,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1475:
+    case 1477:
 
       {
 	{
@@ -33136,7 +33157,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1476:
+    case 1478:
 
       {
 	{
@@ -33150,7 +33171,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1477:
+    case 1479:
 
       {
 	{
@@ -33160,7 +33181,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1478:
+    case 1480:
 
       {
 	{
@@ -33173,7 +33194,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1479:
+    case 1481:
 
       {
 	{
@@ -33183,7 +33204,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1480:
+    case 1482:
 
       {
 	{
@@ -33196,7 +33217,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1481:
+    case 1483:
 
       {
 	{
@@ -33281,7 +33302,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1482:
+    case 1484:
 
       {
 	{
@@ -33391,7 +33412,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1483:
+    case 1485:
 
       {
 	{
@@ -33413,7 +33434,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1484:
+    case 1486:
 
       {
 	{
@@ -33439,7 +33460,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1485:
+    case 1487:
 
       {
 	{
@@ -33472,7 +33493,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1486:
+    case 1488:
 
       {
 	{
@@ -33487,7 +33508,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1487:
+    case 1489:
 
       {
 	{
@@ -33504,7 +33525,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1488:
+    case 1490:
 
       {
 	{
@@ -33525,7 +33546,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1489:
+    case 1491:
 
       {
 	{
@@ -33665,7 +33686,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1490:
+    case 1492:
 
       {
 	{
@@ -33680,7 +33701,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1491:
+    case 1493:
 
       {
 	{
@@ -33692,7 +33713,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1492:
+    case 1494:
 
       {
 	{
@@ -33711,7 +33732,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1493:
+    case 1495:
 
       {
 	{
@@ -33722,7 +33743,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1494:
+    case 1496:
 
       {
 	{
@@ -33733,7 +33754,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1495:
+    case 1497:
 
       {
 	{
@@ -33758,7 +33779,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1496:
+    case 1498:
 
       {
 	{
@@ -33783,7 +33804,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1497:
+    case 1499:
 
       {
 	{
@@ -33808,7 +33829,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1498:
+    case 1500:
 
       {
 	{
@@ -33833,7 +33854,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1499:
+    case 1501:
 
       {
 	{
@@ -33858,7 +33879,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1500:
+    case 1502:
 
       {
 	{
@@ -33883,7 +33904,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1501:
+    case 1503:
 
       {
 	{
@@ -33896,7 +33917,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1502:
+    case 1504:
 
       {
 	{
@@ -33909,7 +33930,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1503:
+    case 1505:
 
       {
 	{
@@ -33920,7 +33941,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1504:
+    case 1506:
 
       {
 	{
@@ -33931,7 +33952,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1505:
+    case 1507:
 
       {
 	{
@@ -33942,7 +33963,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1506:
+    case 1508:
 
       {
 	{
@@ -33953,7 +33974,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1507:
+    case 1509:
 
       {
 	{
@@ -33964,7 +33985,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1508:
+    case 1510:
 
       {
 	{
@@ -33975,7 +33996,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1509:
+    case 1511:
 
       {
 	{
@@ -33986,7 +34007,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1510:
+    case 1512:
 
       {
 	{
@@ -33997,7 +34018,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1511:
+    case 1513:
 
       {
 	{
@@ -34008,7 +34029,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1512:
+    case 1514:
 
       {
 	{
@@ -34019,7 +34040,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1513:
+    case 1515:
 
       {
 	{
@@ -34030,7 +34051,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1516:
+    case 1518:
 
       {
 	{
@@ -34041,7 +34062,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1517:
+    case 1519:
 
       {
 	{
@@ -34052,7 +34073,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1518:
+    case 1520:
 
       {
 	{
@@ -34063,7 +34084,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1519:
+    case 1521:
 
       {
 	{
@@ -34074,7 +34095,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1520:
+    case 1522:
 
       {
 	{
@@ -34085,7 +34106,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1521:
+    case 1523:
 
       {
 	{
@@ -34096,7 +34117,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1522:
+    case 1524:
 
       {
 	{
@@ -34138,7 +34159,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1523:
+    case 1525:
 
       {
 	{
@@ -34151,7 +34172,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1524:
+    case 1526:
 
       {
 	{
@@ -34161,7 +34182,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1525:
+    case 1527:
 
       {
 	{
@@ -34176,7 +34197,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1526:
+    case 1528:
 
       {
 	{
@@ -34191,7 +34212,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1527:
+    case 1529:
 
       {
 	{
@@ -34206,7 +34227,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1528:
+    case 1530:
 
       {
 	{
@@ -34221,7 +34242,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1529:
+    case 1531:
 
       {
 	{
@@ -34234,7 +34255,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1530:
+    case 1532:
 
       {
 	{
@@ -34247,7 +34268,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1531:
+    case 1533:
 
       {
 	{
@@ -34260,7 +34281,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1532:
+    case 1534:
 
       {
 	{
@@ -34273,7 +34294,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1533:
+    case 1535:
 
       {
 	{
@@ -34286,7 +34307,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1534:
+    case 1536:
 
       {
 	{
@@ -34297,7 +34318,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1535:
+    case 1537:
 
       {
 	{
@@ -34308,7 +34329,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1536:
+    case 1538:
 
       {
 	{
@@ -34319,7 +34340,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1537:
+    case 1539:
 
       {
 	{
@@ -34330,7 +34351,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1538:
+    case 1540:
 
       {
 	{
@@ -34341,7 +34362,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1539:
+    case 1541:
 
       {
 	{
@@ -34352,7 +34373,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1540:
+    case 1542:
 
       {
 	{
@@ -34371,7 +34392,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1541:
+    case 1543:
 
       {
 	{
@@ -34387,7 +34408,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1542:
+    case 1544:
 
       {
 	{
@@ -34397,7 +34418,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1543:
+    case 1545:
 
       {
 	{
@@ -34413,7 +34434,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1544:
+    case 1546:
 
       {
 	{
@@ -34435,7 +34456,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1545:
+    case 1547:
 
       {
 	{
@@ -34504,7 +34525,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1546:
+    case 1548:
 
       {
 	{
@@ -34523,7 +34544,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1547:
+    case 1549:
 
       {
 	{
@@ -34533,7 +34554,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1548:
+    case 1550:
 
       {
 	{
@@ -34543,7 +34564,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1549:
+    case 1551:
 
       {
 	{
@@ -34557,7 +34578,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1550:
+    case 1552:
 
       {
 	{
@@ -34570,7 +34591,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1553:
+    case 1555:
 
       {
 	{
@@ -34585,7 +34606,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1554:
+    case 1556:
 
       {
 	{
@@ -34595,7 +34616,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1555:
+    case 1557:
 
       {
 	{
@@ -34605,7 +34626,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1556:
+    case 1558:
 
       {
 	{
@@ -34615,7 +34636,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1557:
+    case 1559:
 
       {
 	{
@@ -34634,7 +34655,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1558:
+    case 1560:
 
       {
 	{
@@ -34644,7 +34665,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1559:
+    case 1561:
 
       {
 	{
@@ -34655,7 +34676,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1560:
+    case 1562:
 
       {
 	{
@@ -34666,7 +34687,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1561:
+    case 1563:
 
       {
 	{
@@ -34677,7 +34698,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1562:
+    case 1564:
 
       {
 	{
@@ -34688,7 +34709,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1563:
+    case 1565:
 
       {
 	{
@@ -34699,7 +34720,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1564:
+    case 1566:
 
       {
 	{
@@ -34710,7 +34731,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1565:
+    case 1567:
 
       {
 	{
@@ -34721,7 +34742,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1566:
+    case 1568:
 
       {
 	{
@@ -34731,7 +34752,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1567:
+    case 1569:
 
       {
 	{
@@ -34807,7 +34828,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1568:
+    case 1570:
 
       {
 	{
@@ -34839,7 +34860,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1569:
+    case 1571:
 
       {
 	{
@@ -34858,7 +34879,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1570:
+    case 1572:
 
       {
 	{
@@ -34874,7 +34895,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1571:
+    case 1573:
 
       {
 	{
@@ -34898,7 +34919,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1572:
+    case 1574:
 
       {
 	{
@@ -34913,7 +34934,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1573:
+    case 1575:
 
       {
 	{
@@ -34924,7 +34945,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1574:
+    case 1576:
 
       {
 	{
@@ -34935,7 +34956,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1575:
+    case 1577:
 
       {
 	{
@@ -34946,7 +34967,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1576:
+    case 1578:
 
       {
 	{
@@ -34984,7 +35005,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1577:
+    case 1579:
 
       {
 	{
@@ -35020,7 +35041,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1578:
+    case 1580:
 
       {
 	{
@@ -35034,7 +35055,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1579:
+    case 1581:
 
       {
 	{
@@ -35045,7 +35066,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1580:
+    case 1582:
 
       {
 	{
@@ -35059,7 +35080,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1581:
+    case 1583:
 
       {
 	{
@@ -35073,7 +35094,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1582:
+    case 1584:
 
       {
 	{
@@ -35087,7 +35108,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1583:
+    case 1585:
 
       {
 	{
@@ -35098,7 +35119,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1584:
+    case 1586:
 
       {
 	{
@@ -35109,7 +35130,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1585:
+    case 1587:
 
       {
 	{
@@ -35122,7 +35143,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1586:
+    case 1588:
 
       {
 	{
@@ -35135,7 +35156,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1587:
+    case 1589:
 
       {
 	{
@@ -35148,7 +35169,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1588:
+    case 1590:
 
       {
 	{
@@ -35161,7 +35182,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1589:
+    case 1591:
 
       {
 	{
@@ -35174,7 +35195,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1590:
+    case 1592:
 
       {
 	{
@@ -35187,7 +35208,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1591:
+    case 1593:
 
       {
 	{
@@ -35200,7 +35221,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1592:
+    case 1594:
 
       {
 	{
@@ -35213,7 +35234,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1593:
+    case 1595:
 
       {
 	{
@@ -35226,7 +35247,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1594:
+    case 1596:
 
       {
 	{
@@ -35239,7 +35260,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1595:
+    case 1597:
 
       {
 	{
@@ -35252,7 +35273,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1596:
+    case 1598:
 
       {
 	{
@@ -35265,7 +35286,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1597:
+    case 1599:
 
       {
 	{
@@ -35278,7 +35299,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1598:
+    case 1600:
 
       {
 	{
@@ -35291,7 +35312,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1599:
+    case 1601:
 
       {
 	{
@@ -35304,7 +35325,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1600:
+    case 1602:
 
       {
 	{
@@ -35317,7 +35338,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1601:
+    case 1603:
 
       {
 	{
@@ -35330,7 +35351,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1602:
+    case 1604:
 
       {
 	{
@@ -35343,7 +35364,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1603:
+    case 1605:
 
       {
 	{
@@ -35356,7 +35377,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1604:
+    case 1606:
 
       {
 	{
@@ -35369,7 +35390,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1605:
+    case 1607:
 
       {
 	{
@@ -35434,7 +35455,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1606:
+    case 1608:
 
       {
 	{
@@ -35447,7 +35468,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1607:
+    case 1609:
 
       {
 	{
@@ -35460,7 +35481,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1608:
+    case 1610:
 
       {
 	{
@@ -35485,7 +35506,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1609:
+    case 1611:
 
       {
 	{
@@ -35650,7 +35671,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1610:
+    case 1612:
 
       {
 	{
@@ -35699,7 +35720,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1611:
+    case 1613:
 
       {
 	{
@@ -35746,7 +35767,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1612:
+    case 1614:
 
       {
 	{
@@ -35856,7 +35877,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1613:
+    case 1615:
 
       {
 	{
@@ -35867,7 +35888,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1614:
+    case 1616:
 
       {
 	{
@@ -35878,7 +35899,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1615:
+    case 1617:
 
       {
 	{
@@ -35889,7 +35910,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1616:
+    case 1618:
 
       {
 	{
@@ -35900,7 +35921,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1617:
+    case 1619:
 
       {
 	{
@@ -35911,7 +35932,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1618:
+    case 1620:
 
       {
 	{
@@ -35922,7 +35943,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1619:
+    case 1621:
 
       {
 	{
@@ -35933,7 +35954,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1620:
+    case 1622:
 
       {
 	{
@@ -35944,7 +35965,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1621:
+    case 1623:
 
       {
 	{
@@ -35955,7 +35976,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1622:
+    case 1624:
 
       {
 	{
@@ -35968,7 +35989,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1623:
+    case 1625:
 
       {
 	{
@@ -35982,7 +36003,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1624:
+    case 1626:
 
       {
 	{
@@ -35996,7 +36017,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1627:
+    case 1629:
 
       {
 	{
@@ -36007,7 +36028,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1628:
+    case 1630:
 
       {
 	{
@@ -36018,7 +36039,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1629:
+    case 1631:
 
       {
 	{
@@ -36029,7 +36050,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1630:
+    case 1632:
 
       {
 	{
@@ -36050,7 +36071,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1631:
+    case 1633:
 
       {
 	{
@@ -36075,7 +36096,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1632:
+    case 1634:
 
       {
 	{
@@ -36098,35 +36119,35 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1633:
+    case 1635:
 
       {
 	((*yyvalp).node) = NULL;;
       }
       break;
 
-    case 1634:
+    case 1636:
 
       {
 	((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.node);;
       }
       break;
 
-    case 1637:
+    case 1639:
 
       {
 	((*yyvalp).node) = NULL;;
       }
       break;
 
-    case 1638:
+    case 1640:
 
       {
 	((*yyvalp).node) = (((yyGLRStackItem const *) yyvsp)[YYFILL ((2) - (2))].yystate.yysemantics.yysval.node);;
       }
       break;
 
-    case 1639:
+    case 1641:
 
       {
 	{
@@ -36149,7 +36170,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1640:
+    case 1642:
 
       {
 	{
@@ -36160,7 +36181,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1641:
+    case 1643:
 
       {
 	{
@@ -36171,7 +36192,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1642:
+    case 1644:
 
       {
 	{
@@ -36182,7 +36203,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1643:
+    case 1645:
 
       {
 	{
@@ -36203,7 +36224,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1644:
+    case 1646:
 
       {
 	{
@@ -36228,7 +36249,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1645:
+    case 1647:
 
       {
 	{
@@ -36248,7 +36269,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1646:
+    case 1648:
 
       {
 	{
@@ -36278,7 +36299,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1647:
+    case 1649:
 
       {
 	{
@@ -36322,7 +36343,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1648:
+    case 1650:
 
       {
 	{
@@ -36341,7 +36362,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1649:
+    case 1651:
 
       {
 	{
@@ -36352,7 +36373,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1650:
+    case 1652:
 
       {
 	{
@@ -36363,7 +36384,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1651:
+    case 1653:
 
       {
 	{
@@ -36374,7 +36395,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1652:
+    case 1654:
 
       {
 	{
@@ -36385,7 +36406,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1655:
+    case 1657:
 
       {
 	{
@@ -36395,7 +36416,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1656:
+    case 1658:
 
       {
 	{
@@ -36441,7 +36462,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1657:
+    case 1659:
 
       {
 	{
@@ -36481,7 +36502,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1658:
+    case 1660:
 
       {
 	{
@@ -36504,7 +36525,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1659:
+    case 1661:
 
       {
 	{
@@ -36514,7 +36535,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1660:
+    case 1662:
 
       {
 	{
@@ -36524,7 +36545,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1661:
+    case 1663:
 
       {
 	{
@@ -36534,7 +36555,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1662:
+    case 1664:
 
       {
 	{
@@ -36544,7 +36565,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1663:
+    case 1665:
 
       {
 	{
@@ -36554,7 +36575,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1664:
+    case 1666:
 
       {
 	{
@@ -36568,7 +36589,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1665:
+    case 1667:
 
       {
 	{
@@ -36578,7 +36599,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1666:
+    case 1668:
 
       {
 	{
@@ -36588,7 +36609,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1667:
+    case 1669:
 
       {
 	{
@@ -36601,7 +36622,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1668:
+    case 1670:
 
       {
 	{
@@ -36611,7 +36632,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1669:
+    case 1671:
 
       {
 	{
@@ -36624,7 +36645,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1670:
+    case 1672:
 
       {
 	{
@@ -36634,7 +36655,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1671:
+    case 1673:
 
       {
 	{
@@ -36644,7 +36665,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1672:
+    case 1674:
 
       {
 	{
@@ -36661,7 +36682,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1673:
+    case 1675:
 
       {
 	{
@@ -36678,7 +36699,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1674:
+    case 1676:
 
       {
 	{
@@ -36691,7 +36712,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1675:
+    case 1677:
 
       {
 	{
@@ -36723,7 +36744,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1676:
+    case 1678:
 
       {
 	{
@@ -36742,7 +36763,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1677:
+    case 1679:
 
       {
 	{
@@ -36753,7 +36774,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1678:
+    case 1680:
 
       {
 	{
@@ -36764,7 +36785,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1679:
+    case 1681:
 
       {
 	{
@@ -36775,7 +36796,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1680:
+    case 1682:
 
       {
 	{
@@ -36786,7 +36807,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1681:
+    case 1683:
 
       {
 	{
@@ -36797,7 +36818,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1682:
+    case 1684:
 
       {
 	{
@@ -36808,7 +36829,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1683:
+    case 1685:
 
       {
 	{
@@ -36820,7 +36841,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1684:
+    case 1686:
 
       {
 	{
@@ -36830,7 +36851,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1685:
+    case 1687:
 
       {
 	{
@@ -36839,7 +36860,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1686:
+    case 1688:
 
       {
 	{
@@ -36848,7 +36869,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1687:
+    case 1689:
 
       {
 	{
@@ -36860,7 +36881,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1688:
+    case 1690:
 
       {
 	{
@@ -36870,31 +36891,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1689:
-
-      {
-	{
-
-	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
-
-	  if (p)
-	    {
-	      int size_in;
-	      char *str_name = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
-
-	      size_in = strlen (str_name);
-
-	      PARSER_SAVE_ERR_CONTEXT (p, (*yylocp).buffer_pos)
-		str_name = pt_check_identifier (this_parser, p, str_name, size_in);
-	      p->info.name.original = str_name;
-	    }
-	  ((*yyvalp).node) = p;
-
-	DBG_PRINT};
-      }
-      break;
-
-    case 1690:
+    case 1691:
 
       {
 	{
@@ -36918,7 +36915,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1691:
+    case 1692:
 
       {
 	{
@@ -36942,7 +36939,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1692:
+    case 1693:
 
       {
 	{
@@ -36966,31 +36963,27 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1693:
+    case 1694:
 
       {
 	{
 
 	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
-	  if (p)
-	    p->info.name.original =
-	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
-	  ((*yyvalp).node) = p;
-	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
-      }
-      break;
 
-    case 1694:
+	  if (p)
+	    {
+	      int size_in;
+	      char *str_name = (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
 
-      {
-	{
+	      size_in = strlen (str_name);
 
-	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
-	  if (p)
-	    p->info.name.original =
-	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
+	      PARSER_SAVE_ERR_CONTEXT (p, (*yylocp).buffer_pos)
+		str_name = pt_check_identifier (this_parser, p, str_name, size_in);
+	      p->info.name.original = str_name;
+	    }
 	  ((*yyvalp).node) = p;
-	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+
+	DBG_PRINT};
       }
       break;
 
@@ -37194,6 +37187,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
+
 	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
 	  if (p)
 	    p->info.name.original =
@@ -37207,12 +37201,11 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
+
 	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
-	  if (p != NULL)
-	    {
-	      p->info.name.original =
-		(((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
-	    }
+	  if (p)
+	    p->info.name.original =
+	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
 	  ((*yyvalp).node) = p;
 	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
@@ -37222,7 +37215,6 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-
 	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
 	  if (p)
 	    p->info.name.original =
@@ -37236,11 +37228,12 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
       {
 	{
-
 	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
-	  if (p)
-	    p->info.name.original =
-	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
+	  if (p != NULL)
+	    {
+	      p->info.name.original =
+		(((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
+	    }
 	  ((*yyvalp).node) = p;
 	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
@@ -37620,8 +37613,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 	    p->info.name.original =
 	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
 	  ((*yyvalp).node) = p;
-
-	DBG_PRINT};
+	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
       break;
 
@@ -37649,7 +37641,8 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 	    p->info.name.original =
 	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
 	  ((*yyvalp).node) = p;
-	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+
+	DBG_PRINT};
       }
       break;
 
@@ -37911,11 +37904,9 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 	{
 
 	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
-	  if (p != NULL)
-	    {
-	      p->info.name.original =
-		(((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
-	    }
+	  if (p)
+	    p->info.name.original =
+	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
 	  ((*yyvalp).node) = p;
 	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
@@ -37941,9 +37932,11 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 	{
 
 	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
-	  if (p)
-	    p->info.name.original =
-	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
+	  if (p != NULL)
+	    {
+	      p->info.name.original =
+		(((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
+	    }
 	  ((*yyvalp).node) = p;
 	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
@@ -38337,8 +38330,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 	    p->info.name.original =
 	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
 	  ((*yyvalp).node) = p;
-
-	DBG_PRINT};
+	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
       }
       break;
 
@@ -38366,7 +38358,8 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 	    p->info.name.original =
 	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
 	  ((*yyvalp).node) = p;
-	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+
+	DBG_PRINT};
       }
       break;
 
@@ -38708,6 +38701,34 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
 
     case 1817:
 
+      {
+	{
+
+	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
+	  if (p)
+	    p->info.name.original =
+	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
+	  ((*yyvalp).node) = p;
+	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+      }
+      break;
+
+    case 1818:
+
+      {
+	{
+
+	  PT_NODE *p = parser_new_node (this_parser, PT_NAME);
+	  if (p)
+	    p->info.name.original =
+	      (((yyGLRStackItem const *) yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.cptr);
+	  ((*yyvalp).node) = p;
+	PARSER_SAVE_ERR_CONTEXT (((*yyvalp).node), (*yylocp).buffer_pos) DBG_PRINT};
+      }
+      break;
+
+    case 1819:
+
       {
 	{
 
@@ -38723,7 +38744,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1818:
+    case 1820:
 
       {
 	{
@@ -38740,7 +38761,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1819:
+    case 1821:
 
       {
 	{
@@ -38757,7 +38778,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1820:
+    case 1822:
 
       {
 	{
@@ -38774,7 +38795,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1821:
+    case 1823:
 
       {
 	{
@@ -38791,7 +38812,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1822:
+    case 1824:
 
       {
 	{
@@ -38808,7 +38829,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1823:
+    case 1825:
 
       {
 	{
@@ -38825,7 +38846,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1824:
+    case 1826:
 
       {
 	{
@@ -38842,7 +38863,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1825:
+    case 1827:
 
       {
 	{
@@ -38859,7 +38880,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1826:
+    case 1828:
 
       {
 	{
@@ -38876,7 +38897,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1827:
+    case 1829:
 
       {
 	{
@@ -38887,7 +38908,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1828:
+    case 1830:
 
       {
 	{
@@ -38900,7 +38921,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1829:
+    case 1831:
 
       {
 	{
@@ -38914,7 +38935,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1830:
+    case 1832:
 
       {
 	{
@@ -38924,7 +38945,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1831:
+    case 1833:
 
       {
 	{
@@ -38946,7 +38967,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1832:
+    case 1834:
 
       {
 	{
@@ -38956,7 +38977,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1833:
+    case 1835:
 
       {
 	{
@@ -38995,7 +39016,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1834:
+    case 1836:
 
       {
 	{
@@ -39034,7 +39055,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1835:
+    case 1837:
 
       {
 	{
@@ -39056,7 +39077,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1836:
+    case 1838:
 
       {
 	{
@@ -39078,7 +39099,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1837:
+    case 1839:
 
       {
 	{
@@ -39100,7 +39121,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1838:
+    case 1840:
 
       {
 	{
@@ -39122,7 +39143,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1839:
+    case 1841:
 
       {
 	{
@@ -39144,7 +39165,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1840:
+    case 1842:
 
       {
 	{
@@ -39154,7 +39175,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1841:
+    case 1843:
 
       {
 	{
@@ -39178,7 +39199,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1842:
+    case 1844:
 
       {
 	{
@@ -39202,7 +39223,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1843:
+    case 1845:
 
       {
 	{
@@ -39253,7 +39274,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1844:
+    case 1846:
 
       {
 	{
@@ -39283,7 +39304,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1845:
+    case 1847:
 
       {
 	{
@@ -39353,7 +39374,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1846:
+    case 1848:
 
       {
 	{
@@ -39374,7 +39395,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1847:
+    case 1849:
 
       {
 	{
@@ -39395,7 +39416,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1848:
+    case 1850:
 
       {
 	{
@@ -39416,7 +39437,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1849:
+    case 1851:
 
       {
 	{
@@ -39437,7 +39458,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1850:
+    case 1852:
 
       {
 	{
@@ -39459,7 +39480,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1851:
+    case 1853:
 
       {
 	{
@@ -39481,7 +39502,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1852:
+    case 1854:
 
       {
 	{
@@ -39503,7 +39524,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1853:
+    case 1855:
 
       {
 	{
@@ -39525,7 +39546,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1854:
+    case 1856:
 
       {
 	{
@@ -39547,7 +39568,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1855:
+    case 1857:
 
       {
 	{
@@ -39569,7 +39590,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1856:
+    case 1858:
 
       {
 	{
@@ -39591,7 +39612,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1857:
+    case 1859:
 
       {
 	{
@@ -39613,7 +39634,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1858:
+    case 1860:
 
       {
 	{
@@ -39635,7 +39656,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1859:
+    case 1861:
 
       {
 	{
@@ -39657,7 +39678,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1860:
+    case 1862:
 
       {
 	{
@@ -39679,7 +39700,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1861:
+    case 1863:
 
       {
 	{
@@ -39701,7 +39722,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1862:
+    case 1864:
 
       {
 	{
@@ -39723,7 +39744,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1863:
+    case 1865:
 
       {
 	{
@@ -39745,7 +39766,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1864:
+    case 1866:
 
       {
 	{
@@ -39767,7 +39788,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1865:
+    case 1867:
 
       {
 	{
@@ -39789,7 +39810,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1866:
+    case 1868:
 
       {
 	{
@@ -39811,7 +39832,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1867:
+    case 1869:
 
       {
 	{
@@ -39833,7 +39854,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1868:
+    case 1870:
 
       {
 	{
@@ -39855,7 +39876,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1869:
+    case 1871:
 
       {
 	{
@@ -39877,7 +39898,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1870:
+    case 1872:
 
       {
 	{
@@ -39888,7 +39909,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1871:
+    case 1873:
 
       {
 	{
@@ -39899,7 +39920,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1872:
+    case 1874:
 
       {
 	{
@@ -39912,7 +39933,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1873:
+    case 1875:
 
       {
 	{
@@ -39927,7 +39948,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1874:
+    case 1876:
 
       {
 	{
@@ -39942,7 +39963,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1875:
+    case 1877:
 
       {
 	{
@@ -39957,7 +39978,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1876:
+    case 1878:
 
       {
 	{
@@ -39972,7 +39993,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1877:
+    case 1879:
 
       {
 	{
@@ -39987,7 +40008,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1878:
+    case 1880:
 
       {
 	{
@@ -40002,7 +40023,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1879:
+    case 1881:
 
       {
 	{
@@ -40017,7 +40038,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1880:
+    case 1882:
 
       {
 	{
@@ -40032,7 +40053,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1881:
+    case 1883:
 
       {
 	{
@@ -40047,7 +40068,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1882:
+    case 1884:
 
       {
 	{
@@ -40062,7 +40083,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1883:
+    case 1885:
 
       {
 	{
@@ -40077,7 +40098,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1884:
+    case 1886:
 
       {
 	{
@@ -40092,7 +40113,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1885:
+    case 1887:
 
       {
 	{
@@ -40106,7 +40127,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1886:
+    case 1888:
 
       {
 	{
@@ -40127,7 +40148,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1887:
+    case 1889:
 
       {
 	{
@@ -40148,7 +40169,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1888:
+    case 1890:
 
       {
 	{
@@ -40169,7 +40190,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1891:
+    case 1893:
 
       {
 	{
@@ -40181,7 +40202,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1892:
+    case 1894:
 
       {
 	{
@@ -40191,7 +40212,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1893:
+    case 1895:
 
       {
 	{
@@ -40212,7 +40233,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1894:
+    case 1896:
 
       {
 	{
@@ -40234,7 +40255,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1895:
+    case 1897:
 
       {
 	{
@@ -40256,7 +40277,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1896:
+    case 1898:
 
       {
 	{
@@ -40274,7 +40295,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1897:
+    case 1899:
 
       {
 	{
@@ -40288,7 +40309,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1898:
+    case 1900:
 
       {
 	{
@@ -40308,7 +40329,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1899:
+    case 1901:
 
       {
 	{
@@ -40325,7 +40346,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1900:
+    case 1902:
 
       {
 	{
@@ -40343,7 +40364,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1901:
+    case 1903:
 
       {
 	{
@@ -40361,7 +40382,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1902:
+    case 1904:
 
       {
 	{
@@ -40379,7 +40400,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1905:
+    case 1907:
 
       {
 	{
@@ -40391,7 +40412,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1906:
+    case 1908:
 
       {
 	{
@@ -40403,7 +40424,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1907:
+    case 1909:
 
       {
 	{
@@ -40413,7 +40434,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1908:
+    case 1910:
 
       {
 	{
@@ -40423,7 +40444,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1909:
+    case 1911:
 
       {
 	{
@@ -40435,7 +40456,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1910:
+    case 1912:
 
       {
 	{
@@ -40445,7 +40466,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem * yyvsp,
       }
       break;
 
-    case 1913:
+    case 1915:
 
       {
 	{
@@ -6836,6 +6836,10 @@ show_type
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| VACUUM STATUS
+		{{
+			$$ = SHOWSTMT_VACUUM_STATUS;
+		}}
 	;
 
 show_type_of_like
@@ -6878,6 +6882,10 @@ show_type_of_where
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| VACUUM STATUS
+		{{
+			$$ = SHOWSTMT_VACUUM_STATUS;
+		}}
 	;
 
 show_type_arg1
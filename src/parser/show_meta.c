@@ -87,6 +87,7 @@ static SHOWSTMT_METADATA *metadata_of_timezones (void);
 static SHOWSTMT_METADATA *metadata_of_full_timezones (void);
 static SHOWSTMT_METADATA *metadata_of_tran_tables (void);
 static SHOWSTMT_METADATA *metadata_of_threads (void);
+static SHOWSTMT_METADATA *metadata_of_vacuum_status (void);
 
 static SHOWSTMT_METADATA *
 metadata_of_volume_header (void)
@@ -318,7 +319,10 @@ metadata_of_heap_header (SHOW_ONLY_ALL flag)
     {"Estimates_num_substitutions", "int"},
     {"Estimates_second_best_list", "varchar(256)"},
     {"Estimates_last_vpid", "varchar(64)"},
-    {"Estimates_full_search_vpid", "varchar(64)"}
+    {"Estimates_full_search_vpid", "varchar(64)"},
+    {"Free_space_map_vfid", "varchar(64)"},
+    {"Free_space_map_num_free_pages", "bigint"},
+    {"Free_space_map_free_space", "bigint"}
   };
 
   static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
@@ -532,7 +536,20 @@ metadata_of_job_queues (void)
     {"Jobq_index", "int"},
     {"Num_total_workers", "int"},
     {"Num_busy_workers", "int"},
-    {"Num_connection_workers", "int"}
+    {"Num_connection_workers", "int"},
+    {"Num_free_workers", "int"},
+    {"Num_queued_jobs", "int"},
+    {"Num_enqueued_jobs", "bigint"},
+    {"Num_stolen_jobs", "bigint"},
+    {"Num_request_jobs", "bigint"},
+    {"Num_connection_jobs", "bigint"},
+    {"Num_other_jobs", "bigint"},
+    {"Avg_wait_usec", "bigint"},
+    {"Max_wait_usec", "bigint"},
+    {"Num_wait_under_1ms", "bigint"},
+    {"Num_wait_under_10ms", "bigint"},
+    {"Num_wait_under_100ms", "bigint"},
+    {"Num_wait_over_100ms", "bigint"}
   };
 
   static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
@@ -700,6 +717,39 @@ metadata_of_threads (void)
   return &md;
 }
 
+/* for show vacuum status */
+static SHOWSTMT_METADATA *
+metadata_of_vacuum_status (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Worker_index", "int"},
+    {"State", "varchar(16)"},
+    {"Block_id", "bigint"},
+    {"Heap_pages", "int"},
+    {"Heap_pages_done", "int"},
+    {"Helped_worker_index", "int"},
+    {"Job_elapsed_msecs", "bigint"},
+    {"Blocks_vacuumed", "bigint"},
+    {"Avg_block_msecs", "double"},
+    {"Backlog_blocks", "bigint"},
+    {"Backlog_log_pages", "bigint"},
+    {"Oldest_unvacuumed_mvccid", "bigint"},
+    {"Oldest_unvacuumed_age_secs", "bigint"},
+    {"Keep_from_log_pageid", "bigint"},
+    {"Retained_log_pages", "bigint"}
+  };
+
+  static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
+    {1, ORDER_ASC}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_VACUUM_STATUS, "show vacuum status",
+    cols, DIM (cols), orderby, DIM (orderby), NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
 /*
  * showstmt_get_metadata() -  return show statement column infos
  *   return:-
@@ -940,6 +990,7 @@ showstmt_metadata_init (void)
   show_Metas[SHOWSTMT_FULL_TIMEZONES] = metadata_of_full_timezones ();
   show_Metas[SHOWSTMT_TRAN_TABLES] = metadata_of_tran_tables ();
   show_Metas[SHOWSTMT_THREADS] = metadata_of_threads ();
+  show_Metas[SHOWSTMT_VACUUM_STATUS] = metadata_of_vacuum_status ();
 
   for (i = 0; i < DIM (show_Metas); i++)
     {
@@ -1226,10 +1226,9 @@ qfile_reopen_list_as_append_mode (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_
 
   if (temp_file_p->membuf && list_id_p->last_vpid.volid == NULL_VOLID)
     {
-      /* The last page is in the membuf */
-      assert_release (temp_file_p->membuf_last >= list_id_p->last_vpid.pageid);
-      /* The page of last record in the membuf */
-      last_page_ptr = temp_file_p->membuf[list_id_p->last_vpid.pageid];
+      /* The page of last record is in the membuf or in the memory chunks past it */
+      last_page_ptr = qmgr_get_membuf_page (temp_file_p, list_id_p->last_vpid.pageid);
+      assert_release (last_page_ptr != NULL);
     }
   else
     {
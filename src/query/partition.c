@@ -28,6 +28,13 @@
 #include "object_representation_sr.h"
 #include "object_domain.h"
 #include "fetch.h"
+#include "page_buffer.h"
+#include "system_parameter.h"
+#include "perf_monitor.h"
+#if defined (SERVER_MODE)
+#include "connection_error.h"
+#include "job_queue.h"
+#endif /* SERVER_MODE */
 #include "dbval.h"
 
 typedef enum match_status
@@ -83,6 +90,29 @@ static MHT_TABLE *db_Partition_Ht = NULL;
 
 #define PARTITION_IS_CACHE_INITIALIZED() (db_Partition_Ht != NULL)
 
+/* share of the page buffer that may be filled by the read-ahead of one scan */
+#define PARTITION_PREFETCH_BUFFER_RATIO 8
+
+#if defined (SERVER_MODE)
+/* partition read-ahead context. It is shared between the thread scanning the partitions and the worker threads
+ * reading ahead the heap pages of the partitions that are scanned next. It is allocated from the global heap and is
+ * freed by whoever releases the last reference to it. */
+struct partition_prefetch_context
+{
+  pthread_mutex_t mutex;	/* protects the fields below */
+  pthread_cond_t idle_cond;	/* signaled when active_count drops to 0 */
+  HFID *hfids;			/* heap files of the partitions to read ahead */
+  int count;			/* number of heap files */
+  int next;			/* next heap file to be picked by a worker */
+  int tran_index;		/* transaction of the scanning thread */
+  int max_pages;		/* maximum number of pages to read ahead */
+  int num_pages;		/* number of pages read so far */
+  int ref_count;		/* scanning thread + queued worker jobs */
+  int active_count;		/* worker jobs currently fixing pages */
+  volatile bool stop;		/* set when the scan no longer needs the read-ahead */
+};
+#endif /* SERVER_MODE */
+
 typedef struct partition_cache_entry PARTITION_CACHE_ENTRY;
 struct partition_cache_entry
 {
@@ -108,6 +138,12 @@ static void pruningset_iterator_init (const PRUNING_BITSET *, PRUNING_BITSET_ITE
 static int pruningset_iterator_next (PRUNING_BITSET_ITERATOR *);
 static int pruningset_to_spec_list (PRUNING_CONTEXT * pinfo, const PRUNING_BITSET * pruned);
 
+#if defined (SERVER_MODE)
+static int partition_prefetch_execute (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+static void partition_prefetch_heap (THREAD_ENTRY * thread_p, PARTITION_PREFETCH_CONTEXT * ctx, const HFID * hfid);
+static void partition_prefetch_release (PARTITION_PREFETCH_CONTEXT * ctx);
+#endif /* SERVER_MODE */
+
 /* pruning operations */
 static int partition_free_cache_entry_kv (const void *key, void *data, void *args);
 static int partition_free_cache_entry (PARTITION_CACHE_ENTRY * entry);
@@ -3908,3 +3944,271 @@ cleanup:
 
   return error;
 }
+
+/*
+ * partition_prefetch_start () - start reading ahead the heap pages of the
+ *				 pruned partitions of a sequential scan
+ * return : error code or NO_ERROR
+ * thread_p (in) : thread entry
+ * spec (in)	 : pruned access spec
+ *
+ * Note: The scanning thread visits the partitions one after another. Each
+ *	 partition but the first one is handed to one of at most
+ *	 partition_prefetch_workers worker jobs which fix (and unfix) its heap
+ *	 pages, so that the pages are already in the page buffer when the scan
+ *	 reaches them. The read-ahead is an optimization only: any failure of
+ *	 a worker job just ends it.
+ */
+int
+partition_prefetch_start (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+{
+#if defined (SERVER_MODE)
+  PARTITION_PREFETCH_CONTEXT *ctx = NULL;
+  PARTITION_SPEC_TYPE *part = NULL;
+  CSS_CONN_ENTRY *conn_p = NULL;
+  CSS_JOB_ENTRY *job_entry_p = NULL;
+  int num_workers, count, i;
+  int conn_index;
+  size_t size;
+
+  assert (spec != NULL);
+
+  num_workers = prm_get_integer_value (PRM_ID_PARTITION_PREFETCH_WORKERS);
+  if (num_workers <= 0 || spec->prefetch != NULL || spec->type != TARGET_CLASS
+      || (spec->access != SEQUENTIAL && spec->access != SEQUENTIAL_RECORD_INFO))
+    {
+      return NO_ERROR;
+    }
+
+  /* the scan starts with the first partition itself */
+  for (count = 0, part = spec->parts; part != NULL; part = part->next)
+    {
+      count++;
+    }
+  count--;
+  if (count <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  size = sizeof (PARTITION_PREFETCH_CONTEXT) + count * sizeof (HFID);
+  ctx = (PARTITION_PREFETCH_CONTEXT *) malloc (size);
+  if (ctx == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  pthread_mutex_init (&ctx->mutex, NULL);
+  pthread_cond_init (&ctx->idle_cond, NULL);
+  ctx->hfids = (HFID *) (ctx + 1);
+  for (i = 0, part = spec->parts->next; part != NULL; i++, part = part->next)
+    {
+      HFID_COPY (&ctx->hfids[i], &part->hfid);
+    }
+  ctx->count = count;
+  ctx->next = 0;
+  ctx->tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  ctx->max_pages = prm_get_integer_value (PRM_ID_PB_NBUFFERS) / PARTITION_PREFETCH_BUFFER_RATIO;
+  ctx->num_pages = 0;
+  ctx->ref_count = 1;
+  ctx->active_count = 0;
+  ctx->stop = false;
+
+  spec->prefetch = ctx;
+
+  conn_p = thread_get_current_conn_entry ();
+  conn_index = (conn_p) ? conn_p->idx : 0;
+
+  num_workers = MIN (num_workers, count);
+  for (i = 0; i < num_workers; i++)
+    {
+      /* spread the jobs over the job queues */
+      job_entry_p =
+	css_make_job_entry (conn_p, (CSS_THREAD_FN) partition_prefetch_execute, (CSS_THREAD_ARG) ctx, conn_index + i + 1);
+      if (job_entry_p == NULL)
+	{
+	  /* run with the jobs queued so far */
+	  er_clear ();
+	  break;
+	}
+
+      pthread_mutex_lock (&ctx->mutex);
+      ctx->ref_count++;
+      pthread_mutex_unlock (&ctx->mutex);
+
+      css_add_to_job_queue (job_entry_p);
+    }
+#endif /* SERVER_MODE */
+
+  return NO_ERROR;
+}
+
+/*
+ * partition_prefetch_end () - stop the read-ahead of a partitioned scan
+ * return : void
+ * thread_p (in) : thread entry
+ * spec (in)	 : access spec
+ *
+ * Note: Waits for the worker jobs that are currently reading pages, since
+ *	 the partitions are protected only by the locks of the scanning
+ *	 transaction. Jobs that did not start yet find the context stopped
+ *	 and do nothing.
+ */
+void
+partition_prefetch_end (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+{
+#if defined (SERVER_MODE)
+  PARTITION_PREFETCH_CONTEXT *ctx = NULL;
+
+  if (spec == NULL || spec->prefetch == NULL)
+    {
+      return;
+    }
+
+  ctx = spec->prefetch;
+  spec->prefetch = NULL;
+
+  pthread_mutex_lock (&ctx->mutex);
+  ctx->stop = true;
+  while (ctx->active_count > 0)
+    {
+      pthread_cond_wait (&ctx->idle_cond, &ctx->mutex);
+    }
+  pthread_mutex_unlock (&ctx->mutex);
+
+  perfmon_add_stat (thread_p, PSTAT_QM_NUM_PARTITION_PREFETCH_PAGES, ctx->num_pages);
+
+  partition_prefetch_release (ctx);
+#endif /* SERVER_MODE */
+}
+
+#if defined (SERVER_MODE)
+/*
+ * partition_prefetch_execute () - worker job reading ahead partitions
+ * return : NO_ERROR
+ * thread_p (in) : worker thread entry
+ * arg (in)	 : read-ahead context
+ */
+static int
+partition_prefetch_execute (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  PARTITION_PREFETCH_CONTEXT *ctx = (PARTITION_PREFETCH_CONTEXT *) arg;
+  bool old_check_interrupt;
+  int idx;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  /* act on behalf of the scanning transaction */
+  thread_p->tran_index = ctx->tran_index;
+  pthread_mutex_unlock (&thread_p->tran_index_lock);
+
+  old_check_interrupt = thread_set_check_interrupt (thread_p, false);
+
+  pthread_mutex_lock (&ctx->mutex);
+  if (ctx->stop)
+    {
+      pthread_mutex_unlock (&ctx->mutex);
+      goto end;
+    }
+  ctx->active_count++;
+
+  while (!ctx->stop && ctx->next < ctx->count && ctx->num_pages < ctx->max_pages)
+    {
+      idx = ctx->next++;
+      pthread_mutex_unlock (&ctx->mutex);
+
+      partition_prefetch_heap (thread_p, ctx, &ctx->hfids[idx]);
+
+      pthread_mutex_lock (&ctx->mutex);
+    }
+
+  ctx->active_count--;
+  if (ctx->active_count == 0)
+    {
+      /* wake up partition_prefetch_end */
+      pthread_cond_signal (&ctx->idle_cond);
+    }
+  pthread_mutex_unlock (&ctx->mutex);
+
+end:
+  (void) thread_set_check_interrupt (thread_p, old_check_interrupt);
+
+  partition_prefetch_release (ctx);
+
+  /* errors of the read-ahead are not reported to anyone */
+  er_clear ();
+
+  return NO_ERROR;
+}
+
+/*
+ * partition_prefetch_heap () - fix and unfix the pages of a heap file,
+ *				following the heap page chain
+ * return : void
+ * thread_p (in) : thread entry
+ * ctx (in)	 : read-ahead context
+ * hfid (in)	 : heap file
+ */
+static void
+partition_prefetch_heap (THREAD_ENTRY * thread_p, PARTITION_PREFETCH_CONTEXT * ctx, const HFID * hfid)
+{
+  PAGE_PTR pgptr = NULL;
+  VPID vpid;
+
+  if (HFID_IS_NULL (hfid))
+    {
+      return;
+    }
+
+  vpid.volid = hfid->vfid.volid;
+  vpid.pageid = hfid->hpgid;
+
+  while (!VPID_ISNULL (&vpid) && !ctx->stop && ctx->num_pages < ctx->max_pages)
+    {
+      /* pages may be deallocated by vacuum while we follow the chain */
+      if (pgbuf_fix_if_not_deallocated (thread_p, &vpid, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH, &pgptr) !=
+	  NO_ERROR || pgptr == NULL)
+	{
+	  break;
+	}
+
+      if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP
+	  || heap_vpid_next (thread_p, hfid, pgptr, &vpid) != NO_ERROR)
+	{
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	  break;
+	}
+
+      pgbuf_unfix_and_init (thread_p, pgptr);
+
+      ATOMIC_INC_32 (&ctx->num_pages, 1);
+    }
+}
+
+/*
+ * partition_prefetch_release () - release a reference to the read-ahead
+ *				   context and free it with the last one
+ * return : void
+ * ctx (in) : read-ahead context
+ */
+static void
+partition_prefetch_release (PARTITION_PREFETCH_CONTEXT * ctx)
+{
+  int ref_count;
+
+  pthread_mutex_lock (&ctx->mutex);
+  ref_count = --ctx->ref_count;
+  pthread_mutex_unlock (&ctx->mutex);
+
+  if (ref_count == 0)
+    {
+      pthread_cond_destroy (&ctx->idle_cond);
+      pthread_mutex_destroy (&ctx->mutex);
+      free_and_init (ctx);
+    }
+}
+#endif /* SERVER_MODE */
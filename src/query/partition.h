@@ -119,4 +119,7 @@ extern int partition_is_global_index (THREAD_ENTRY * thread_p, PRUNING_CONTEXT *
 #endif
 
 extern int partition_find_root_class_oid (THREAD_ENTRY * thread_p, const OID * class_oid, OID * super_oid);
+
+extern int partition_prefetch_start (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec);
+extern void partition_prefetch_end (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec);
 #endif /* _PARTITION_H_ */
@@ -120,6 +120,17 @@
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* maximum recursion depth of hash partitioning for spilled hash aggregate
+   evaluation */
+#define HASH_AGGREGATE_SPILL_MAX_DEPTH                  4
+
+/* merge join runtime filter: bits of the bloom filter for each key of the filter side and number of probed bits */
+#define JOIN_FILTER_BITS_PER_KEY                        8
+#define JOIN_FILTER_NUM_HASHES                          3
+
+/* minimum number of instances selected by an index scan for UPDATE/DELETE before they are sorted in OID order */
+#define UPDDEL_MIN_ROWS_FOR_OID_SORT                    100
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -433,6 +444,16 @@ static int qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl,
 				     BUILDLIST_PROC_NODE * proc, QFILE_TUPLE_RECORD * tplrec,
 				     QFILE_TUPLE_DESCRIPTOR * tpldesc, QFILE_LIST_ID * groupby_list,
 				     bool * output_tuple);
+static int qexec_hash_gby_evict_lru (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context,
+				     QFILE_LIST_ID * groupby_list, UINT64 mem_limit);
+static int qexec_hash_gby_spill_index (AGGREGATE_HASH_KEY * key, int depth, int spill_count);
+static QFILE_LIST_ID **qexec_hash_gby_open_spill_lists (THREAD_ENTRY * thread_p,
+							QFILE_TUPLE_VALUE_TYPE_LIST * type_list, QUERY_ID query_id,
+							int spill_count);
+static void qexec_hash_gby_free_spill_lists (THREAD_ENTRY * thread_p, QFILE_LIST_ID ** spill_list_ids,
+					     int spill_count);
+static int qexec_hash_gby_agg_spilled (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, BUILDLIST_PROC_NODE * proc,
+				       QFILE_LIST_ID * spill_list_id, QFILE_LIST_ID * groupby_list, int depth);
 static void qexec_gby_start_group_dim (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes);
 static void qexec_gby_start_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes, int N);
 static void qexec_gby_finalize_group_val_list (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N);
@@ -497,6 +518,12 @@ static QFILE_LIST_ID *qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID *
 					      QFILE_LIST_MERGE_INFO * merge_infop, PRED_EXPR * other_outer_join_pred,
 					      XASL_STATE * xasl_state, int ls_flag);
 static int qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
+static int qexec_build_join_filter (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_NODE * build_xasl,
+				    XASL_NODE * probe_xasl);
+static bool qexec_join_filter_is_eligible_type (DB_TYPE type);
+static unsigned int qexec_join_filter_hash (DB_VALUE ** values, int count);
+static bool qexec_join_filter_check (THREAD_ENTRY * thread_p, JOIN_FILTER * filter, VAL_DESCR * vd);
+static void qexec_free_join_filter (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc);
 static int qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
 			    bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
 			    QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
@@ -589,6 +616,7 @@ static void qexec_reset_pseudocolumns_val_pointers (DB_VALUE * level_valp, DB_VA
 static int qexec_get_index_pseudocolumn_value_from_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QFILE_TUPLE tpl,
 							  DB_VALUE ** index_valp, char **index_value, int *index_len);
 static int qexec_recalc_tuples_parent_pos_in_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p);
+static bool qexec_can_batch_insert (XASL_NODE * xasl, int op_type);
 static int qexec_remove_duplicates_for_replace (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache,
 						HEAP_CACHE_ATTRINFO * attr_info, HEAP_CACHE_ATTRINFO * index_attr_info,
 						const HEAP_IDX_ELEMENTS_INFO * idx_info, int op_type, int pruning_type,
@@ -648,6 +676,7 @@ static int qexec_upddel_setup_current_class (THREAD_ENTRY * thread_p, UPDDEL_CLA
 					     UPDDEL_CLASS_INFO_INTERNAL * class_info, int op_type, OID * current_oid);
 static int qexec_upddel_mvcc_set_filters (THREAD_ENTRY * thread_p, XASL_NODE * aptr_list,
 					  UPDDEL_MVCC_COND_REEVAL * mvcc_reev_class, OID * class_oid);
+static int qexec_upddel_sort_oids (THREAD_ENTRY * thread_p, XASL_NODE * aptr, int num_classes);
 static HEAP_SCANCACHE *qexec_reset_caches (THREAD_ENTRY * thread_p, PRUNING_CONTEXT * pcontext,
 					   UPDDEL_CLASS_INFO_INTERNAL * class_, int op_type);
 static int qexec_init_agg_hierarchy_helpers (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec,
@@ -1103,6 +1132,13 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
   int ret = NO_ERROR;
   bool output_tuple = true, update_agg_domains = false;
 
+  if (xasl->type == BUILDLIST_PROC && xasl->proc.buildlist.join_filter != NULL
+      && !qexec_join_filter_check (thread_p, xasl->proc.buildlist.join_filter, &xasl_state->vd))
+    {
+      /* row cannot match the other side of the merge join */
+      return NO_ERROR;
+    }
+
   if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
       && !XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
     {
@@ -1772,6 +1808,7 @@ qexec_clear_access_spec_list (XASL_NODE * xasl_p, THREAD_ENTRY * thread_p, ACCES
 
       if (p->parts != NULL)
 	{
+	  partition_prefetch_end (thread_p, p);
 	  db_private_free (thread_p, p->parts);
 	  p->parts = NULL;
 	  p->curent = NULL;
@@ -2363,6 +2400,7 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool final)
 	      {
 		qexec_free_agg_hash_context (thread_p, buildlist);
 	      }
+	    qexec_free_join_filter (thread_p, buildlist);
 	    pg_cnt += qexec_clear_pred (xasl, buildlist->a_instnum_pred, final);
 	    if (buildlist->a_instnum_val)
 	      {
@@ -3663,8 +3701,8 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   AGGREGATE_HASH_CONTEXT *context = &proc->agg_hash_context;
   AGGREGATE_HASH_KEY *key = context->temp_key;
   AGGREGATE_HASH_VALUE *value;
-  HENTRY_PTR hentry;
   UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  int spill_count = prm_get_integer_value (PRM_ID_AGG_HASH_SPILL_PARTITIONS);
   int rc = NO_ERROR;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
@@ -3689,7 +3727,46 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 
   /* probe hash table */
   value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
-  if (value == NULL)
+  if (value == NULL && context->spill_list_ids != NULL)
+    {
+      QFILE_LIST_ID *spill_list_id;
+      int tuple_size = tpldesc->tpl_size;
+
+      /* hash table is full; tuple goes to its hash partition and will be aggregated later */
+      spill_list_id = context->spill_list_ids[qexec_hash_gby_spill_index (key, 0, context->spill_count)];
+
+      if (context->spill_tuple.size < tuple_size)
+	{
+	  if (context->spill_tuple.tpl != NULL)
+	    {
+	      db_private_free_and_init (thread_p, context->spill_tuple.tpl);
+	    }
+	  context->spill_tuple.size = 0;
+
+	  context->spill_tuple.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, tuple_size);
+	  if (context->spill_tuple.tpl == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, tuple_size);
+	      return ER_FAILED;
+	    }
+	  context->spill_tuple.size = tuple_size;
+	}
+
+      if (qfile_save_tuple (tpldesc, T_NORMAL, context->spill_tuple.tpl, &tuple_size) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      rc = qfile_add_tuple_to_list (thread_p, spill_list_id, context->spill_tuple.tpl);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      /* no need to output it, it is in a hash partition */
+      *output_tuple = false;
+    }
+  else if (value == NULL)
     {
       AGGREGATE_HASH_KEY *new_key;
       AGGREGATE_HASH_VALUE *new_value;
@@ -3780,6 +3857,81 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
     }
 
   /* keep hash table within memory limit */
+  if (context->hash_size > (int) mem_limit && context->spill_list_ids == NULL && spill_count > 0)
+    {
+      /* from now on, tuples of new groups are partitioned by hash in list files */
+      context->spill_list_ids =
+	qexec_hash_gby_open_spill_lists (thread_p, &groupby_list->type_list, xasl_state->query_id, spill_count);
+      if (context->spill_list_ids == NULL)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
+	}
+      context->spill_count = spill_count;
+
+#if !defined(NDEBUG)
+      er_log_debug (ARG_FILE_LINE, "hash aggregation overflow: spilling to %d partitions", spill_count);
+#endif
+    }
+
+  rc = qexec_hash_gby_evict_lru (thread_p, context, groupby_list, mem_limit);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+
+  /* check very high selectivity case; once spilling has started, the partitions hold the input of new groups and
+   * hash aggregation has to be completed */
+  if (context->spill_list_ids == NULL && context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
+    {
+      float selectivity = (float) context->group_count / context->tuple_count;
+      if (selectivity > HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD)
+	{
+	  /* very high selectivity, abort hash aggregation */
+	  context->state = HS_REJECT_ALL;
+
+	  /* dump hash table to list file, no need to keep it in memory */
+	  qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
+					 context->temp_dbval_array);
+
+#if !defined(NDEBUG)
+	  er_log_debug (ARG_FILE_LINE, "hash aggregation abandoned: very high selectivity");
+#endif
+	}
+    }
+
+  if (thread_is_on_trace (thread_p))
+    {
+      tsc_getticks (&end_tick);
+      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+      TSC_ADD_TIMEVAL (xasl->groupby_stats.groupby_time, tv_diff);
+      xasl->groupby_stats.groupby_hash = context->state;
+    }
+
+  /* all ok */
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_gby_evict_lru () - keep hash table within memory limit
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   context(in): hash context
+ *   groupby_list(in): listfile containing tuples for sort-based aggregation
+ *   mem_limit(in): maximum size of hash table
+ *
+ * NOTE: Least recently used entries are dumped to the partial list and their
+ * first tuples to the groupby list, where sort-based aggregation picks them up.
+ */
+static int
+qexec_hash_gby_evict_lru (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context, QFILE_LIST_ID * groupby_list,
+			  UINT64 mem_limit)
+{
+  AGGREGATE_HASH_KEY *key;
+  AGGREGATE_HASH_VALUE *value;
+  HENTRY_PTR hentry;
+  int rc = NO_ERROR;
+
   while (context->hash_size > (int) mem_limit)
     {
       /* get least recently used entry */
@@ -3820,35 +3972,291 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       mht_rem (context->hash_table, key, qdata_free_agg_hentry, NULL);
     }
 
-  /* check very high selectivity case */
-  if (context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_gby_spill_index () - compute hash partition of aggregate key
+ *   return: partition index
+ *   key(in): aggregate key
+ *   depth(in): recursion depth of hash partitioning
+ *   spill_count(in): number of partitions
+ *
+ * NOTE: Every recursion level uses another hash function, otherwise all tuples
+ * of a partition would fall in the same sub-partition.
+ */
+static int
+qexec_hash_gby_spill_index (AGGREGATE_HASH_KEY * key, int depth, int spill_count)
+{
+  unsigned int hash_val;
+
+  hash_val = qdata_hash_agg_hkey (key, INT_MAX);
+
+  hash_val ^= (unsigned int) (depth + 1) * 0x9e3779b9U;
+  hash_val *= 0x85ebca6bU;
+  hash_val ^= hash_val >> 16;
+
+  return (int) (hash_val % (unsigned int) spill_count);
+}
+
+/*
+ * qexec_hash_gby_open_spill_lists () - create list files for hash partitions
+ *   return: array of list files or NULL on error
+ *   thread_p(in): thread
+ *   type_list(in): type list of spilled tuples
+ *   query_id(in): query id
+ *   spill_count(in): number of partitions
+ */
+static QFILE_LIST_ID **
+qexec_hash_gby_open_spill_lists (THREAD_ENTRY * thread_p, QFILE_TUPLE_VALUE_TYPE_LIST * type_list, QUERY_ID query_id,
+				 int spill_count)
+{
+  QFILE_LIST_ID **spill_list_ids;
+  int i;
+
+  spill_list_ids = (QFILE_LIST_ID **) db_private_alloc (thread_p, sizeof (QFILE_LIST_ID *) * spill_count);
+  if (spill_list_ids == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (QFILE_LIST_ID *) * spill_count);
+      return NULL;
+    }
+
+  for (i = 0; i < spill_count; i++)
     {
-      float selectivity = (float) context->group_count / context->tuple_count;
-      if (selectivity > HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD)
+      spill_list_ids[i] = qfile_open_list (thread_p, type_list, NULL, query_id, 0);
+      if (spill_list_ids[i] == NULL)
 	{
-	  /* very high selectivity, abort hash aggregation */
-	  context->state = HS_REJECT_ALL;
+	  qexec_hash_gby_free_spill_lists (thread_p, spill_list_ids, i);
+	  return NULL;
+	}
+    }
 
-	  /* dump hash table to list file, no need to keep it in memory */
-	  qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
-					 context->temp_dbval_array);
+  return spill_list_ids;
+}
 
-#if !defined(NDEBUG)
-	  er_log_debug (ARG_FILE_LINE, "hash aggregation abandoned: very high selectivity");
-#endif
+/*
+ * qexec_hash_gby_free_spill_lists () - destroy list files of hash partitions
+ *   thread_p(in): thread
+ *   spill_list_ids(in): array of list files
+ *   spill_count(in): number of partitions
+ */
+static void
+qexec_hash_gby_free_spill_lists (THREAD_ENTRY * thread_p, QFILE_LIST_ID ** spill_list_ids, int spill_count)
+{
+  int i;
+
+  for (i = 0; i < spill_count; i++)
+    {
+      if (spill_list_ids[i] != NULL)
+	{
+	  qfile_close_list (thread_p, spill_list_ids[i]);
+	  qfile_destroy_list (thread_p, spill_list_ids[i]);
+	  qfile_free_list_id (spill_list_ids[i]);
 	}
     }
 
-  if (thread_is_on_trace (thread_p))
+  db_private_free (thread_p, spill_list_ids);
+}
+
+/*
+ * qexec_hash_gby_agg_spilled () - aggregate a hash partition of spilled tuples
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   xasl_state(in): XASL state
+ *   proc(in): BUILDLIST proc node
+ *   spill_list_id(in): list file holding the tuples of the partition
+ *   groupby_list(in): listfile containing tuples for sort-based aggregation
+ *   depth(in): recursion depth of hash partitioning
+ *
+ * NOTE: The partition is aggregated in the empty hash table, whose groups are
+ * then saved to the partial list and the groupby list. If the hash table
+ * overflows, tuples of new groups are partitioned again and aggregated
+ * recursively; past HASH_AGGREGATE_SPILL_MAX_DEPTH, least recently used
+ * groups are dumped instead.
+ */
+static int
+qexec_hash_gby_agg_spilled (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, BUILDLIST_PROC_NODE * proc,
+			    QFILE_LIST_ID * spill_list_id, QFILE_LIST_ID * groupby_list, int depth)
+{
+  AGGREGATE_HASH_CONTEXT *context = &proc->agg_hash_context;
+  AGGREGATE_HASH_KEY *key = context->temp_key;
+  AGGREGATE_HASH_VALUE *value;
+  QFILE_LIST_ID **sub_list_ids = NULL;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  SCAN_CODE scan_code;
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  int i, rc = NO_ERROR;
+
+  assert (mht_count (context->hash_table) == 0);
+
+  qfile_close_list (thread_p, spill_list_id);
+  if (spill_list_id->tuple_cnt == 0)
     {
-      tsc_getticks (&end_tick);
-      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-      TSC_ADD_TIMEVAL (xasl->groupby_stats.groupby_time, tv_diff);
-      xasl->groupby_stats.groupby_hash = context->state;
+      return NO_ERROR;
     }
 
-  /* all ok */
-  return NO_ERROR;
+  if (qfile_open_list_scan (spill_list_id, &scan_id) != NO_ERROR)
+    {
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+
+  while ((scan_code = qfile_scan_list_next (thread_p, &scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+    {
+      /* build key */
+      rc = qexec_build_agg_hkey (thread_p, xasl_state, proc->g_hk_sort_regu_list, tuple_record.tpl, key);
+      if (rc != NO_ERROR)
+	{
+	  goto exit;
+	}
+
+      /* probe hash table */
+      value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
+      if (value == NULL && sub_list_ids != NULL)
+	{
+	  /* hash table is full; partition tuple again */
+	  rc = qfile_add_tuple_to_list (thread_p, sub_list_ids[qexec_hash_gby_spill_index (key, depth,
+											   context->spill_count)],
+					tuple_record.tpl);
+	}
+      else if (value == NULL)
+	{
+	  AGGREGATE_HASH_KEY *new_key;
+	  AGGREGATE_HASH_VALUE *new_value;
+
+	  /* create new key and value */
+	  new_key = qdata_copy_agg_hkey (thread_p, key);
+	  if (new_key == NULL)
+	    {
+	      assert (er_errid () != NO_ERROR);
+	      rc = er_errid ();
+	      goto exit;
+	    }
+
+	  new_value = qdata_alloc_agg_hvalue (thread_p, proc->g_func_count);
+	  if (new_value == NULL)
+	    {
+	      qdata_free_agg_hkey (thread_p, new_key);
+
+	      assert (er_errid () != NO_ERROR);
+	      rc = er_errid ();
+	      goto exit;
+	    }
+
+	  if (proc->g_output_first_tuple)
+	    {
+	      /* first tuple is aggregated by the sort-based aggregation */
+	      rc = qfile_add_tuple_to_list (thread_p, groupby_list, tuple_record.tpl);
+	    }
+	  else
+	    {
+	      int tuple_size = QFILE_GET_TUPLE_LENGTH (tuple_record.tpl);
+
+	      /* keep first tuple in hash table */
+	      new_value->first_tuple.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, tuple_size);
+	      if (new_value->first_tuple.tpl == NULL)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, tuple_size);
+		  rc = ER_FAILED;
+		}
+	      else
+		{
+		  memcpy (new_value->first_tuple.tpl, tuple_record.tpl, tuple_size);
+		  new_value->first_tuple.size = tuple_size;
+		}
+	    }
+
+	  if (rc != NO_ERROR)
+	    {
+	      qdata_free_agg_hkey (thread_p, new_key);
+	      qdata_free_agg_hvalue (thread_p, new_value);
+	      goto exit;
+	    }
+
+	  /* add to hash table */
+	  mht_put (context->hash_table, (void *) new_key, (void *) new_value);
+
+	  context->hash_size += qdata_get_agg_hkey_size (new_key);
+	  context->hash_size += qdata_get_agg_hvalue_size (new_value, false);
+	}
+      else
+	{
+	  value->tuple_count++;
+
+	  /* fetch values and eval aggregate functions */
+	  rc = fetch_val_list (thread_p, proc->g_regu_list, &xasl_state->vd, NULL, NULL, tuple_record.tpl, PEEK);
+	  if (rc == NO_ERROR)
+	    {
+	      rc = qdata_evaluate_aggregate_list (thread_p, proc->g_agg_list, &xasl_state->vd, value->accumulators);
+	    }
+
+	  context->hash_size += qdata_get_agg_hvalue_size (value, true);
+	}
+
+      if (rc != NO_ERROR)
+	{
+	  goto exit;
+	}
+
+      /* keep hash table within memory limit */
+      if (context->hash_size > (int) mem_limit && sub_list_ids == NULL && depth < HASH_AGGREGATE_SPILL_MAX_DEPTH)
+	{
+	  sub_list_ids =
+	    qexec_hash_gby_open_spill_lists (thread_p, &spill_list_id->type_list, xasl_state->query_id,
+					     context->spill_count);
+	  if (sub_list_ids == NULL)
+	    {
+	      assert (er_errid () != NO_ERROR);
+	      rc = er_errid ();
+	      goto exit;
+	    }
+	}
+
+      rc = qexec_hash_gby_evict_lru (thread_p, context, groupby_list, mem_limit);
+      if (rc != NO_ERROR)
+	{
+	  goto exit;
+	}
+    }
+
+  if (scan_code != S_END)
+    {
+      assert (er_errid () != NO_ERROR);
+      rc = er_errid ();
+      goto exit;
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+
+  /* partition is aggregated; move its groups to the lists */
+  rc = qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
+				      context->temp_dbval_array);
+  if (rc != NO_ERROR)
+    {
+      goto exit;
+    }
+  context->hash_size = 0;
+
+  /* aggregate groups that did not fit */
+  for (i = 0; sub_list_ids != NULL && i < context->spill_count; i++)
+    {
+      rc = qexec_hash_gby_agg_spilled (thread_p, xasl_state, proc, sub_list_ids[i], groupby_list, depth + 1);
+      if (rc != NO_ERROR)
+	{
+	  goto exit;
+	}
+    }
+
+exit:
+  qfile_close_scan (thread_p, &scan_id);
+
+  if (sub_list_ids != NULL)
+    {
+      qexec_hash_gby_free_spill_lists (thread_p, sub_list_ids, context->spill_count);
+    }
+
+  return rc;
 }
 
 /*
@@ -4431,10 +4839,47 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
     gbstate.output_file = output_list_id;
   }
 
-  /* check for quick finalization scenarios */
-  if (list_id->tuple_cnt == 0)
+  /* aggregate hash partitions of spilled tuples */
+  if (gbstate.hash_eligible && gbstate.agg_hash_context->spill_list_ids != NULL)
     {
-      if (!gbstate.hash_eligible || gbstate.agg_hash_context->tuple_count == 0)
+      AGGREGATE_HASH_CONTEXT *context = gbstate.agg_hash_context;
+      int i;
+
+      /* reopen unsorted list to accept new tuples */
+      if (qfile_reopen_list_as_append_mode (thread_p, list_id) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      /* groups left in hash table are complete; save them before reusing the table */
+      if (qdata_save_agg_htable_to_list (thread_p, context->hash_table, list_id, context->part_list_id,
+					 context->temp_dbval_array) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      context->hash_size = 0;
+
+      for (i = 0; i < context->spill_count; i++)
+	{
+	  if (qexec_hash_gby_agg_spilled (thread_p, xasl_state, buildlist, context->spill_list_ids[i], list_id, 1)
+	      != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+
+      qexec_hash_gby_free_spill_lists (thread_p, context->spill_list_ids, context->spill_count);
+      context->spill_list_ids = NULL;
+      context->spill_count = 0;
+
+      /* close unsorted list */
+      qfile_close_list (thread_p, list_id);
+    }
+
+  /* check for quick finalization scenarios */
+  if (list_id->tuple_cnt == 0)
+    {
+      if (!gbstate.hash_eligible || gbstate.agg_hash_context->tuple_count == 0)
 	{
 	  /* no tuples hash aggregated and empty unsorted list; no reason to continue */
 	  qfile_destroy_list (thread_p, list_id);
@@ -6217,148 +6662,490 @@ exit_on_end:
     }
   if (inner_valp)
     {
-      db_private_free_and_init (thread_p, inner_valp);
+      db_private_free_and_init (thread_p, inner_valp);
+    }
+
+  if (list_idp)
+    {
+      qfile_close_list (thread_p, list_idp);
+    }
+
+  return list_idp;
+
+exit_on_error:
+  if (list_idp)
+    {
+      qfile_close_list (thread_p, list_idp);
+      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
+    }
+
+  list_idp = NULL;
+
+  direction = S_FORWARD;
+  val_cmp = DB_UNK;		/* mark as error */
+  all_lefts = all_rghts = false;
+
+  goto exit_on_end;
+}
+
+/*
+ * qexec_merge_listfiles () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     :
+ *
+ * Note: This function is used for a direct merge of two LIST files
+ * during XASL tree interpretation.
+ *
+ * Note: For a direct list file merge, currently the outer and inner columns
+ * should have the same data type.
+ */
+static int
+qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+{
+  QFILE_LIST_ID *list_id = NULL;
+  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
+  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
+  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
+  XASL_NODE *outer_xasl, *inner_xasl;
+  int ls_flag = 0;
+
+  outer_xasl = xasl->proc.mergelist.outer_xasl;
+  inner_xasl = xasl->proc.mergelist.inner_xasl;
+
+  /* open the empty list file if not already open */
+
+  if (outer_xasl->list_id->type_list.type_cnt == 0)
+    {
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  if (inner_xasl->list_id->type_list.type_cnt == 0)
+    {
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
+  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the 
+   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
+   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the 
+   * last result file. */
+
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+    {
+      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+    }
+
+  if (merge_infop->join_type == JOIN_INNER)
+    {
+      /* call list file merge routine */
+      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else
+    {
+      outer_spec = xasl->proc.mergelist.outer_spec_list;
+      inner_spec = xasl->proc.mergelist.inner_spec_list;
+
+      assert (xasl->scan_op_type == S_SELECT);
+      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
+			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
+			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      /* call outer join merge routine */
+      list_id =
+	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
+				xasl_state, ls_flag);
+
+      qexec_close_scan (thread_p, outer_spec);
+      outer_spec = NULL;
+
+      qexec_close_scan (thread_p, inner_spec);
+      inner_spec = NULL;
+    }
+
+  if (list_id == NULL)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  /* make this the resultant list file */
+  qfile_copy_list_id (xasl->list_id, list_id, true);
+  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (outer_spec)
+    {
+      qexec_close_scan (thread_p, outer_spec);
+    }
+  if (inner_spec)
+    {
+      qexec_close_scan (thread_p, inner_spec);
+    }
+
+  return ER_FAILED;
+}
+
+/*
+ * qexec_build_join_filter () - build the runtime filter of a merge join
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : MERGELIST_PROC XASL node
+ *   build_xasl(in)     : side of the join that was already executed
+ *   probe_xasl(in)     : side of the join that is to be filtered
+ *
+ * Note: A bloom filter is built on the join columns of the list file of build_xasl and attached to probe_xasl. While
+ *       probe_xasl is executed, rows whose join columns are not found in the filter cannot match any row of the
+ *       other side and they are dropped before being copied to its list file and sorted for the merge.
+ *       The filter is used only for column types whose equal values have the same hash and it is never used on
+ *       the side whose rows are preserved by an outer join. It is not used either when the probe side computes its
+ *       list file rows from the whole input (GROUP BY, analytic functions, ORDERBY_NUM, CONNECT BY): its list file
+ *       columns are not the row values checked at qexec_end_one_iteration, or dropping input rows changes the
+ *       values of the rows that are kept.
+ */
+static int
+qexec_build_join_filter (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_NODE * build_xasl, XASL_NODE * probe_xasl)
+{
+  QFILE_LIST_MERGE_INFO *merge_infop = &xasl->proc.mergelist.ls_merge;
+  QFILE_LIST_ID *list_id = build_xasl->list_id;
+  JOIN_FILTER *filter = NULL;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  REGU_VARIABLE_LIST regu_list;
+  DB_VALUE *values = NULL;
+  DB_VALUE **value_ptrs = NULL;
+  int *build_columns, *probe_columns;
+  UINT64 max_bits, bit_count;
+  unsigned int hash, delta;
+  int col_count, i, j, k;
+  SCAN_CODE scan_code;
+  int error = NO_ERROR;
+
+  scan_id.status = S_CLOSED;
+
+  max_bits = prm_get_bigint_value (PRM_ID_MAX_JOIN_FILTER_SIZE) * 8;
+  if (merge_infop->join_type == JOIN_OUTER || probe_xasl->type != BUILDLIST_PROC || list_id->tuple_cnt <= 0
+      || max_bits == 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (probe_xasl->proc.buildlist.groupby_list != NULL || probe_xasl->proc.buildlist.a_eval_list != NULL
+      || probe_xasl->ordbynum_pred != NULL || probe_xasl->orderby_limit != NULL || probe_xasl->connect_by_ptr != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  /* Bits for all keys of the filter side, rounded up to a power of 2. Give up if the filter would not fit. */
+  for (bit_count = 64; bit_count < (UINT64) list_id->tuple_cnt * JOIN_FILTER_BITS_PER_KEY; bit_count <<= 1)
+    {
+      ;
+    }
+  if (bit_count > max_bits || bit_count > UINT_MAX)
+    {
+      return NO_ERROR;
+    }
+
+  if (build_xasl == xasl->proc.mergelist.outer_xasl)
+    {
+      build_columns = merge_infop->ls_outer_column;
+      probe_columns = merge_infop->ls_inner_column;
+    }
+  else
+    {
+      build_columns = merge_infop->ls_inner_column;
+      probe_columns = merge_infop->ls_outer_column;
+    }
+  col_count = merge_infop->ls_column_cnt;
+
+  for (k = 0; k < col_count; k++)
+    {
+      if (!qexec_join_filter_is_eligible_type (TP_DOMAIN_TYPE (list_id->type_list.domp[build_columns[k]])))
+	{
+	  return NO_ERROR;
+	}
+    }
+
+  filter = (JOIN_FILTER *) db_private_alloc (thread_p, sizeof (JOIN_FILTER));
+  if (filter == NULL)
+    {
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto exit_on_error;
+    }
+  memset (filter, 0, sizeof (JOIN_FILTER));
+
+  filter->col_count = col_count;
+  filter->bit_mask = (unsigned int) (bit_count - 1);
+  filter->regu_vars = (REGU_VARIABLE **) db_private_alloc (thread_p, col_count * sizeof (REGU_VARIABLE *));
+  filter->types = (DB_TYPE *) db_private_alloc (thread_p, col_count * sizeof (DB_TYPE));
+  filter->values = (DB_VALUE **) db_private_alloc (thread_p, col_count * sizeof (DB_VALUE *));
+  filter->bits = (unsigned int *) db_private_alloc (thread_p, (size_t) (bit_count / 8));
+  values = (DB_VALUE *) db_private_alloc (thread_p, col_count * sizeof (DB_VALUE));
+  value_ptrs = (DB_VALUE **) db_private_alloc (thread_p, col_count * sizeof (DB_VALUE *));
+  if (filter->regu_vars == NULL || filter->types == NULL || filter->values == NULL || filter->bits == NULL
+      || values == NULL || value_ptrs == NULL)
+    {
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto exit_on_error;
+    }
+  memset (filter->bits, 0, (size_t) (bit_count / 8));
+
+  for (k = 0; k < col_count; k++)
+    {
+      filter->types[k] = TP_DOMAIN_TYPE (list_id->type_list.domp[build_columns[k]]);
+
+      /* list file columns of the probe side are its visible output values */
+      filter->regu_vars[k] = NULL;
+      for (regu_list = probe_xasl->outptr_list->valptrp, j = 0; regu_list != NULL; regu_list = regu_list->next)
+	{
+	  if (REGU_VARIABLE_IS_FLAGED (&regu_list->value, REGU_VARIABLE_HIDDEN_COLUMN))
+	    {
+	      continue;
+	    }
+	  if (j++ == probe_columns[k])
+	    {
+	      filter->regu_vars[k] = &regu_list->value;
+	      break;
+	    }
+	}
+      if (filter->regu_vars[k] == NULL)
+	{
+	  /* not expected; do not filter */
+	  assert (false);
+	  goto exit_on_error;
+	}
+
+      DB_MAKE_NULL (&values[k]);
+      value_ptrs[k] = &values[k];
+    }
+
+  /* add the keys of the filter side */
+  error = qfile_open_list_scan (list_id, &scan_id);
+  if (error != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  while ((scan_code = qfile_scan_list_next (thread_p, &scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+    {
+      for (k = 0; k < col_count; k++)
+	{
+	  error =
+	    qexec_get_tuple_column_value (tuple_record.tpl, build_columns[k], &values[k],
+					  list_id->type_list.domp[build_columns[k]]);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	  if (DB_IS_NULL (&values[k]))
+	    {
+	      /* never joins */
+	      break;
+	    }
+	}
+      if (k < col_count)
+	{
+	  continue;
+	}
+
+      hash = qexec_join_filter_hash (value_ptrs, col_count);
+      delta = (hash >> 17) | (hash << 15) | 1;
+      for (i = 0; i < JOIN_FILTER_NUM_HASHES; i++, hash += delta)
+	{
+	  filter->bits[(hash & filter->bit_mask) >> 5] |= 1U << (hash & 31);
+	}
+    }
+  if (scan_code == S_ERROR)
+    {
+      error = ER_FAILED;
+      goto exit_on_error;
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+  db_private_free (thread_p, values);
+  db_private_free (thread_p, value_ptrs);
+
+  qexec_free_join_filter (thread_p, &probe_xasl->proc.buildlist);
+  probe_xasl->proc.buildlist.join_filter = filter;
+
+  return NO_ERROR;
+
+exit_on_error:
+  qfile_close_scan (thread_p, &scan_id);
+  if (values != NULL)
+    {
+      db_private_free (thread_p, values);
+    }
+  if (value_ptrs != NULL)
+    {
+      db_private_free (thread_p, value_ptrs);
+    }
+  if (filter != NULL)
+    {
+      probe_xasl->proc.buildlist.join_filter = filter;
+      qexec_free_join_filter (thread_p, &probe_xasl->proc.buildlist);
     }
-
-  if (list_idp)
+  if (error == ER_OUT_OF_VIRTUAL_MEMORY)
     {
-      qfile_close_list (thread_p, list_idp);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (bit_count / 8));
     }
 
-  return list_idp;
+  return error;
+}
 
-exit_on_error:
-  if (list_idp)
+/*
+ * qexec_join_filter_is_eligible_type () - can a join column of this type be used in a runtime filter?
+ *   return: true if equal values of the type are guaranteed to have the same hash
+ *   type(in)   : column type
+ */
+static bool
+qexec_join_filter_is_eligible_type (DB_TYPE type)
+{
+  switch (type)
     {
-      qfile_close_list (thread_p, list_idp);
-      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SMALLINT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_OID:
+      return true;
+
+    default:
+      /* strings may compare equal under collations and numbers of different scales or zero signs, while having
+       * different hashes */
+      return false;
     }
+}
 
-  list_idp = NULL;
+/*
+ * qexec_join_filter_hash () - hash the join columns of a row
+ *   return: hash value
+ *   values(in) : join column values
+ *   count(in)  : number of join columns
+ */
+static unsigned int
+qexec_join_filter_hash (DB_VALUE ** values, int count)
+{
+  unsigned int hash = 0;
+  int i;
 
-  direction = S_FORWARD;
-  val_cmp = DB_UNK;		/* mark as error */
-  all_lefts = all_rghts = false;
+  for (i = 0; i < count; i++)
+    {
+      hash = (hash * 31) ^ mht_get_hash_number (INT_MAX, values[i]);
+    }
 
-  goto exit_on_end;
+  return hash;
 }
 
 /*
- * qexec_merge_listfiles () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     :
- *
- * Note: This function is used for a direct merge of two LIST files
- * during XASL tree interpretation.
+ * qexec_join_filter_check () - check the join columns of current row against the runtime filter
+ *   return: false if current row cannot join, true otherwise
+ *   filter(in) : runtime filter
+ *   vd(in)     : value descriptor
  *
- * Note: For a direct list file merge, currently the outer and inner columns
- * should have the same data type.
+ * Note: The row is kept whenever its values cannot be tested.
  */
-static int
-qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+static bool
+qexec_join_filter_check (THREAD_ENTRY * thread_p, JOIN_FILTER * filter, VAL_DESCR * vd)
 {
-  QFILE_LIST_ID *list_id = NULL;
-  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
-  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
-  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
-  XASL_NODE *outer_xasl, *inner_xasl;
-  int ls_flag = 0;
-
-  outer_xasl = xasl->proc.mergelist.outer_xasl;
-  inner_xasl = xasl->proc.mergelist.inner_xasl;
-
-  /* open the empty list file if not already open */
+  DB_VALUE **values = filter->values;
+  unsigned int hash, delta;
+  int i, k;
 
-  if (outer_xasl->list_id->type_list.type_cnt == 0)
+  for (k = 0; k < filter->col_count; k++)
     {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
+      if (fetch_peek_dbval (thread_p, filter->regu_vars[k], vd, NULL, NULL, NULL, &values[k]) != NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  /* error is raised again when the row is output */
+	  er_clear ();
+	  return true;
+	}
+      if (DB_IS_NULL (values[k]))
+	{
+	  /* never joins */
+	  filter->reject_count++;
+	  return false;
+	}
+      if (DB_VALUE_TYPE (values[k]) != filter->types[k])
+	{
+	  /* will be coerced; cannot test */
+	  return true;
 	}
     }
-  if (inner_xasl->list_id->type_list.type_cnt == 0)
+
+  hash = qexec_join_filter_hash (values, filter->col_count);
+  delta = (hash >> 17) | (hash << 15) | 1;
+  for (i = 0; i < JOIN_FILTER_NUM_HASHES; i++, hash += delta)
     {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
+      if ((filter->bits[(hash & filter->bit_mask) >> 5] & (1U << (hash & 31))) == 0)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  filter->reject_count++;
+	  return false;
 	}
     }
 
-  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the 
-   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
-   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the 
-   * last result file. */
+  return true;
+}
 
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+/*
+ * qexec_free_join_filter () - free the merge join runtime filter of a BUILDLIST_PROC
+ *   return:
+ *   proc(in)   : BUILDLIST_PROC node
+ */
+static void
+qexec_free_join_filter (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc)
+{
+  JOIN_FILTER *filter = proc->join_filter;
+
+  if (filter == NULL)
     {
-      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+      return;
     }
 
-  if (merge_infop->join_type == JOIN_INNER)
+  if (filter->reject_count > 0)
     {
-      /* call list file merge routine */
-      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+      perfmon_add_stat (thread_p, PSTAT_QM_NUM_JOIN_FILTER_REJECTS, (UINT64) filter->reject_count);
     }
-  else
-    {
-      outer_spec = xasl->proc.mergelist.outer_spec_list;
-      inner_spec = xasl->proc.mergelist.inner_spec_list;
-
-      assert (xasl->scan_op_type == S_SELECT);
-      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
-			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-
-      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
-			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
 
-      /* call outer join merge routine */
-      list_id =
-	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
-				xasl_state, ls_flag);
-
-      qexec_close_scan (thread_p, outer_spec);
-      outer_spec = NULL;
-
-      qexec_close_scan (thread_p, inner_spec);
-      inner_spec = NULL;
+  if (filter->regu_vars != NULL)
+    {
+      db_private_free (thread_p, filter->regu_vars);
     }
-
-  if (list_id == NULL)
+  if (filter->types != NULL)
     {
-      GOTO_EXIT_ON_ERROR;
+      db_private_free (thread_p, filter->types);
     }
-
-  /* make this the resultant list file */
-  qfile_copy_list_id (xasl->list_id, list_id, true);
-  QFILE_FREE_AND_INIT_LIST_ID (list_id);
-
-  return NO_ERROR;
-
-exit_on_error:
-
-  if (outer_spec)
+  if (filter->values != NULL)
     {
-      qexec_close_scan (thread_p, outer_spec);
+      db_private_free (thread_p, filter->values);
     }
-  if (inner_spec)
+  if (filter->bits != NULL)
     {
-      qexec_close_scan (thread_p, inner_spec);
+      db_private_free (thread_p, filter->bits);
     }
-
-  return ER_FAILED;
+  db_private_free_and_init (thread_p, proc->join_filter);
 }
 
 /*
@@ -6397,6 +7184,11 @@ qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST
 	{
 	  goto exit_on_error;
 	}
+
+      if (curr_spec->parts != NULL && partition_prefetch_start (thread_p, curr_spec) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
     }
 
   if (curr_spec->type == TARGET_CLASS && mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (curr_spec)))
@@ -6618,6 +7410,8 @@ exit_on_error:
 
   if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && curr_spec->parts != NULL)
     {
+      partition_prefetch_end (thread_p, curr_spec);
+
       /* reset pruning info */
       db_private_free (thread_p, curr_spec->parts);
       curr_spec->parts = NULL;
@@ -6655,6 +7449,8 @@ qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
 	    }
 	  if (curr_spec->parts != NULL)
 	    {
+	      partition_prefetch_end (thread_p, curr_spec);
+
 	      /* reset pruning info */
 	      db_private_free (thread_p, curr_spec->parts);
 	      curr_spec->parts = NULL;
@@ -8695,6 +9491,12 @@ qexec_execute_update (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool has_delete
       GOTO_EXIT_ON_ERROR;
     }
 
+  error = qexec_upddel_sort_oids (thread_p, aptr, class_oid_cnt);
+  if (error != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
   if (aptr->list_id->tuple_cnt > 1)
     {
       /* When multiple instances are updated, statement level uniqueness checking should be performed. In this case,
@@ -9636,6 +10438,11 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       GOTO_EXIT_ON_ERROR;
     }
 
+  error = qexec_upddel_sort_oids (thread_p, aptr, class_oid_cnt);
+  if (error != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
   /* Allocate and init structures for statistical information */
   if (aptr->list_id->tuple_cnt > MIN_NUM_ROWS_FOR_MULTI_DELETE)
@@ -10152,6 +10959,40 @@ qexec_free_delete_lob_info_list (THREAD_ENTRY * thread_p, DEL_LOB_INFO ** del_lo
   *del_lob_info_list_ptr = NULL;
 }
 
+/*
+ * qexec_can_batch_insert () - Check whether the rows of an insert can be
+ *       collected and inserted together
+ *   return: true if rows can be inserted in batches
+ *   xasl(in): insert XASL node
+ *   op_type(in): operation type
+ *
+ * Note: Batches are used for multi-row inserts into classes that are not
+ *       partitioned, when every row is simply inserted and its OID is not
+ *       needed right away.
+ */
+static bool
+qexec_can_batch_insert (XASL_NODE * xasl, int op_type)
+{
+  INSERT_PROC_NODE *insert = &xasl->proc.insert;
+
+  if (op_type != MULTI_ROW_INSERT || prm_get_integer_value (PRM_ID_MULTI_INSERT_BATCH_SIZE) <= 1)
+    {
+      return false;
+    }
+
+  if (insert->pruning_type != DB_NOT_PARTITIONED_CLASS || insert->do_replace || insert->odku != NULL)
+    {
+      return false;
+    }
+
+  if (XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS) || XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE))
+    {
+      return false;
+    }
+
+  return true;
+}
+
 
 /*
  * qexec_remove_duplicates_for_replace () - Removes the objects that would
@@ -10808,6 +11649,8 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
   int flag;
   TP_DOMAIN *result_domain;
   bool has_user_format;
+  LOCATOR_INSERT_BATCH insert_batch;
+  volatile bool insert_batch_started = false;
 
   aptr = xasl->aptr_list;
   val_no = insert->num_vals;
@@ -11194,6 +12037,20 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	}
       scan_cache_inited = true;
 
+      if (qexec_can_batch_insert (xasl, scan_cache_op_type))
+	{
+	  /* rows are collected and inserted together in heap and indexes */
+	  error =
+	    locator_start_insert_batch (thread_p, &insert_batch, &insert->class_hfid, &class_oid, scan_cache_op_type,
+					&scan_cache, func_indx_preds,
+					prm_get_integer_value (PRM_ID_MULTI_INSERT_BATCH_SIZE));
+	  if (error != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  insert_batch_started = true;
+	}
+
       assert (xasl->scan_op_type == S_SELECT);
 
       /* force_select_lock = false */
@@ -11314,6 +12171,16 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 		}
 
 	      force_count = 0;
+	      if (insert_batch_started)
+		{
+		  if (locator_add_to_insert_batch (thread_p, &insert_batch, &attr_info, &force_count) != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  xasl->list_id->tuple_cnt += force_count;
+		  continue;
+		}
+
 	      /* when insert in heap, don't care about instance locking */
 	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
 						scan_cache_op_type, &scan_cache, &force_count, false,
@@ -11380,6 +12247,19 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	  GOTO_EXIT_ON_ERROR;
 	}
 
+      if (qexec_can_batch_insert (xasl, scan_cache_op_type))
+	{
+	  /* rows are collected and inserted together in heap and indexes */
+	  error =
+	    locator_start_insert_batch (thread_p, &insert_batch, &insert->class_hfid, &class_oid, scan_cache_op_type,
+					&scan_cache, NULL, prm_get_integer_value (PRM_ID_MULTI_INSERT_BATCH_SIZE));
+	  if (error != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  insert_batch_started = true;
+	}
+
       for (i = 0; i < insert->num_val_lists; i++)
 	{
 	  for (regu_list = insert->valptr_lists[i]->valptrp, vallist = xasl->val_list->valp, k = num_default_expr;
@@ -11481,7 +12361,15 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 		}
 	    }
 
-	  if (force_count == 0)
+	  if (insert_batch_started)
+	    {
+	      if (locator_add_to_insert_batch (thread_p, &insert_batch, &attr_info, &force_count) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      xasl->list_id->tuple_cnt += force_count;
+	    }
+	  else if (force_count == 0)
 	    {
 	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
 						scan_cache_op_type, &scan_cache, &force_count, false,
@@ -11526,6 +12414,20 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	}
     }
 
+  if (insert_batch_started)
+    {
+      /* insert the rows still collected */
+      error = locator_flush_insert_batch (thread_p, &insert_batch, &force_count);
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      xasl->list_id->tuple_cnt += force_count;
+
+      locator_end_insert_batch (thread_p, &insert_batch);
+      insert_batch_started = false;
+    }
+
   /* check uniques */
   /* In this case, consider only single class. Therefore, uniqueness checking is performed based on the local
    * statistical information kept in scan_cache. And then, it is reflected into the transaction's statistical
@@ -11628,6 +12530,10 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 
 exit_on_error:
   (void) session_reset_cur_insert_id (thread_p);
+  if (insert_batch_started)
+    {
+      locator_end_insert_batch (thread_p, &insert_batch);
+    }
   for (k = 0; k < num_default_expr; k++)
     {
       pr_clear_value (insert->vals[k]);
@@ -13800,6 +14706,21 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 		      qexec_failure_line (__LINE__, xasl_state);
 		      GOTO_EXIT_ON_ERROR;
 		    }
+
+		  if (merge_infop && xptr2 == xptr->aptr_list && xptr2->next != NULL
+		      && (xptr2->next->status == XASL_CLEARED || xptr2->next->status == XASL_INITIALIZED))
+		    {
+		      /* filter the other side of the merge join on the join columns of this one */
+		      if (qexec_build_join_filter (thread_p, xptr, xptr2, xptr2->next) != NO_ERROR)
+			{
+			  if (tplrec.tpl)
+			    {
+			      db_private_free_and_init (thread_p, tplrec.tpl);
+			    }
+			  qexec_failure_line (__LINE__, xasl_state);
+			  GOTO_EXIT_ON_ERROR;
+			}
+		    }
 		}
 	      else
 		{		/* already executed. success or failure */
@@ -14360,10 +15281,11 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
       lock_stop_instant_lock_mode (thread_p, tran_index, true);
     }
 
-  /* destroy hash table */
+  /* destroy hash table and join filter */
   if (xasl->type == BUILDLIST_PROC)
     {
       qexec_free_agg_hash_context (thread_p, &xasl->proc.buildlist);
+      qexec_free_join_filter (thread_p, &xasl->proc.buildlist);
     }
 
   /* clear only non-zero correlation-level uncorrelated subquery list files */
@@ -14435,10 +15357,11 @@ exit_on_error:
       qexec_clear_connect_by_lists (thread_p, xasl->connect_by_ptr);
     }
 
-  /* destroy hash table */
+  /* destroy hash table and join filter */
   if (xasl->type == BUILDLIST_PROC)
     {
       qexec_free_agg_hash_context (thread_p, &xasl->proc.buildlist);
+      qexec_free_join_filter (thread_p, &xasl->proc.buildlist);
     }
 
   /* free alloced memory for composite locking */
@@ -23207,6 +24130,63 @@ qexec_upddel_mvcc_set_filters (THREAD_ENTRY * thread_p, XASL_NODE * aptr_list,
   return NO_ERROR;
 }
 
+/*
+ * qexec_upddel_sort_oids () - sort the instances selected for update/delete
+ *			       in OID order
+ * return : error code or NO_ERROR
+ * thread_p (in) :
+ * aptr (in) : XASL that selected the instances
+ * num_classes (in) : number of classes updated/deleted
+ *
+ * Note: an index scan returns the instances in key order, which is random
+ *	 order for the heap. Applying the changes in OID order visits each heap
+ *	 page once and in file order, instead of fixing pages back and forth.
+ *	 Only single class statements without ORDER BY are sorted, since the
+ *	 order of the changes is not observable for them.
+ */
+static int
+qexec_upddel_sort_oids (THREAD_ENTRY * thread_p, XASL_NODE * aptr, int num_classes)
+{
+  QFILE_LIST_ID *list_id = aptr->list_id;
+  SORT_LIST *sort_list;
+  int error = NO_ERROR;
+
+  if (num_classes != 1 || aptr->spec_list == NULL || aptr->spec_list->next != NULL || aptr->scan_ptr != NULL
+      || aptr->spec_list->access != INDEX || aptr->orderby_list != NULL
+      || list_id->tuple_cnt < UPDDEL_MIN_ROWS_FOR_OID_SORT)
+    {
+      /* heap scans already return the instances in OID order */
+      return NO_ERROR;
+    }
+
+  if (list_id->type_list.type_cnt < 1 || TP_DOMAIN_TYPE (list_id->type_list.domp[0]) != DB_TYPE_OID)
+    {
+      assert (false);
+      return NO_ERROR;
+    }
+
+  sort_list = qfile_allocate_sort_list (thread_p, 1);
+  if (sort_list == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  /* first column is the instance OID */
+  sort_list->s_order = S_ASC;
+  sort_list->s_nulls = S_NULLS_FIRST;
+  sort_list->pos_descr.dom = list_id->type_list.domp[0];
+  sort_list->pos_descr.pos_no = 0;
+
+  if (qfile_sort_list (thread_p, list_id, sort_list, Q_ALL, true) == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+    }
+
+  qfile_free_sort_list (thread_p, sort_list);
+
+  return error;
+}
+
 /*
  * qexec_upddel_setup_current_class () - setup current class info in a class
  *					 hierarchy
@@ -24645,6 +25625,10 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context.temp_dbval_array = NULL;
   proc->agg_hash_context.part_list_id = NULL;
   proc->agg_hash_context.sorted_part_list_id = NULL;
+  proc->agg_hash_context.spill_list_ids = NULL;
+  proc->agg_hash_context.spill_count = 0;
+  proc->agg_hash_context.spill_tuple.size = 0;
+  proc->agg_hash_context.spill_tuple.tpl = NULL;
   proc->agg_hash_context.hash_table = NULL;
   proc->agg_hash_context.temp_key = NULL;
   proc->agg_hash_context.temp_part_key = NULL;
@@ -24938,6 +25922,22 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
       proc->agg_hash_context.sorted_part_list_id = NULL;
     }
 
+  /* free hash partitions */
+  if (proc->agg_hash_context.spill_list_ids != NULL)
+    {
+      qexec_hash_gby_free_spill_lists (thread_p, proc->agg_hash_context.spill_list_ids,
+				       proc->agg_hash_context.spill_count);
+      proc->agg_hash_context.spill_list_ids = NULL;
+      proc->agg_hash_context.spill_count = 0;
+    }
+
+  if (proc->agg_hash_context.spill_tuple.tpl != NULL)
+    {
+      db_private_free (thread_p, proc->agg_hash_context.spill_tuple.tpl);
+      proc->agg_hash_context.spill_tuple.tpl = NULL;
+      proc->agg_hash_context.spill_tuple.size = 0;
+    }
+
   /* free temp keys and values */
   if (proc->agg_hash_context.temp_key != NULL)
     {
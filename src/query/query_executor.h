@@ -425,6 +425,8 @@ struct partition_spec_node
   PARTITION_SPEC_TYPE *next;	/* next partition */
 };
 
+typedef struct partition_prefetch_context PARTITION_PREFETCH_CONTEXT;
+
 typedef struct access_spec_node ACCESS_SPEC_TYPE;
 struct access_spec_node
 {
@@ -445,6 +447,7 @@ struct access_spec_node
   ACCESS_SPEC_TYPE *next;	/* next access specification */
   PARTITION_SPEC_TYPE *parts;	/* partitions of the current spec */
   PARTITION_SPEC_TYPE *curent;	/* current partition */
+  PARTITION_PREFETCH_CONTEXT *prefetch;	/* read-ahead of the pruned partitions by worker threads */
   int pruning_type;		/* how pruning should be performed on this access spec performed */
   ACCESS_SPEC_FLAG flags;	/* flags from ACCESS_SPEC_FLAG enum */
   bool pruned;			/* true if partition pruning has been performed */
@@ -503,6 +506,11 @@ struct aggregate_hash_context
   QFILE_LIST_SCAN_ID part_scan_id;	/* scan on partial list */
   DB_VALUE *temp_dbval_array;	/* temporary array of dbvalues, used for saving entries to list files */
 
+  /* spilled input stuff */
+  QFILE_LIST_ID **spill_list_ids;	/* hash partitions of tuples that did not fit in hash table */
+  int spill_count;		/* number of hash partitions */
+  QFILE_TUPLE_RECORD spill_tuple;	/* tuple record used while spilling */
+
   /* partial list file sort stuff */
   QFILE_TUPLE_RECORD input_tuple;	/* tuple record used while sorting */
   SORTKEY_INFO sort_key;	/* sort key for partial list */
@@ -514,6 +522,20 @@ struct aggregate_hash_context
   int sorted_count;
 };
 
+/* runtime filter on the join columns of a merge join; built from the list file of the side that is executed first
+ * and used to drop rows of the other side before they are written to its list file */
+typedef struct join_filter JOIN_FILTER;
+struct join_filter
+{
+  int col_count;		/* number of join columns */
+  REGU_VARIABLE **regu_vars;	/* output regu variables of the join columns of the filtered side */
+  DB_TYPE *types;		/* types of the join columns of the filter side */
+  DB_VALUE **values;		/* join column values of current row of the filtered side */
+  unsigned int *bits;		/* bloom filter bit array */
+  unsigned int bit_mask;	/* number of bits - 1, number of bits being a power of 2 */
+  INT64 reject_count;		/* number of rows dropped by the filter */
+};
+
 typedef struct buildlist_proc_node BUILDLIST_PROC_NODE;
 struct buildlist_proc_node
 {
@@ -553,6 +575,7 @@ struct buildlist_proc_node
 					 * statement */
   AGGREGATE_HASH_CONTEXT agg_hash_context;	/* hash aggregate context, not serialized */
   int g_agg_domains_resolved;	/* domain status (not serialized) */
+  JOIN_FILTER *join_filter;	/* merge join runtime filter (not serialized) */
 };
 
 
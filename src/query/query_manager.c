@@ -78,6 +78,13 @@ extern int method_Num_method_jsp_calls;
 /* We have two valid types of membuf used by temporary file. */
 #define QMGR_IS_VALID_MEMBUF_TYPE(m)    ((m) == TEMP_FILE_MEMBUF_NORMAL || (m) == TEMP_FILE_MEMBUF_KEY_BUFFER)
 
+/* Size bounds of the memory chunks a list file grows by once its membuf is used up. */
+#define QMGR_MEMBUF_CHUNK_MIN_PAGES     8
+#define QMGR_MEMBUF_CHUNK_MAX_PAGES     64
+
+#define QMGR_MEMBUF_CHUNK_PAGE(chunk, i) \
+  ((PAGE_PTR) (chunk) + DB_ALIGN (sizeof (QMGR_MEMBUF_CHUNK), MAX_ALIGNMENT) + (size_t) (i) * DB_PAGESIZE)
+
 typedef enum qmgr_page_type QMGR_PAGE_TYPE;
 enum qmgr_page_type
 {
@@ -105,6 +112,8 @@ struct qmgr_tran_entry
   QMGR_QUERY_ENTRY *free_query_entry_list_p;	/* free query entry list */
 
   OID_BLOCK_LIST *modified_classes_p;	/* array of class OIDs */
+
+  int list_memory_pages;	/* memory pages held by list files past their membuf */
 };
 
 typedef struct qmgr_temp_file_list QMGR_TEMP_FILE_LIST;
@@ -130,10 +139,12 @@ struct qmgr_query_table
 
   /* temp file free list info */
   QMGR_TEMP_FILE_LIST temp_file_list[QMGR_NUM_TEMP_FILE_LISTS];
+
+  int list_memory_pages;	/* memory pages held by list files past their membuf, server-wide */
 };
 
 QMGR_QUERY_TABLE qmgr_Query_table = { NULL, 0, NULL,
-  {{PTHREAD_MUTEX_INITIALIZER, NULL, 0}, {PTHREAD_MUTEX_INITIALIZER, NULL, 0}}
+  {{PTHREAD_MUTEX_INITIALIZER, NULL, 0}, {PTHREAD_MUTEX_INITIALIZER, NULL, 0}}, 0
 };
 
 #if !defined(SERVER_MODE)
@@ -176,6 +187,9 @@ static void qmgr_initialize_temp_file_list (QMGR_TEMP_FILE_LIST * temp_file_list
 static void qmgr_finalize_temp_file_list (QMGR_TEMP_FILE_LIST * temp_file_list_p);
 static QMGR_TEMP_FILE *qmgr_get_temp_file_from_list (QMGR_TEMP_FILE_LIST * temp_file_list_p);
 static void qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p);
+static PAGE_PTR qmgr_get_membuf_chunk_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * temp_file_p);
+static void qmgr_free_membuf_chunks (QMGR_TEMP_FILE * temp_file_p);
+static int qmgr_charge_list_memory (int *used_pages_p, INT64 max_pages, int npages);
 
 static int copy_bind_value_to_tdes (THREAD_ENTRY * thread_p, int num_bind_vals, DB_VALUE * bind_vals);
 
@@ -198,6 +212,20 @@ qmgr_get_page_type (PAGE_PTR page_p, QMGR_TEMP_FILE * temp_file_p)
       return QMGR_MEMBUF_PAGE;
     }
 
+  if (temp_file_p != NULL && temp_file_p->membuf_chunks != NULL)
+    {
+      QMGR_MEMBUF_CHUNK *chunk_p;
+
+      for (chunk_p = temp_file_p->membuf_chunks; chunk_p != NULL; chunk_p = chunk_p->next)
+	{
+	  if (page_p >= QMGR_MEMBUF_CHUNK_PAGE (chunk_p, 0)
+	      && page_p <= QMGR_MEMBUF_CHUNK_PAGE (chunk_p, chunk_p->npages - 1))
+	    {
+	      return QMGR_MEMBUF_PAGE;
+	    }
+	}
+    }
+
   begin_page = (PAGE_PTR) ((PAGE_PTR) temp_file_p->membuf
 			   + DB_ALIGN (sizeof (PAGE_PTR) * temp_file_p->membuf_npages, MAX_ALIGNMENT));
   end_page = begin_page + temp_file_p->membuf_npages * DB_PAGESIZE;
@@ -567,6 +595,7 @@ qmgr_initialize_tran_entry (QMGR_TRAN_ENTRY * tran_entry_p)
   tran_entry_p->query_entry_list_p = NULL;
   tran_entry_p->free_query_entry_list_p = NULL;
   tran_entry_p->modified_classes_p = NULL;
+  tran_entry_p->list_memory_pages = 0;
 }
 
 /*
@@ -1063,6 +1092,7 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
   XASL_NODE *xasl_p;
   void *xasl_buf_info;
   QFILE_LIST_ID *list_id;
+  INT64 arena_num_allocs, arena_alloc_bytes;
 
   assert (query_p != NULL);
   assert (tran_entry_p != NULL);
@@ -1071,6 +1101,9 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
   xasl_buf_info = NULL;
   list_id = NULL;
 
+  /* execution memory is released in one shot when the request ends */
+  db_begin_private_arena (thread_p, (size_t) prm_get_bigint_value (PRM_ID_MAX_QUERY_ARENA_SIZE));
+
   if (xasl_tree != NULL)
     {
       /* check the number of the host variables for this XASL */
@@ -1142,6 +1175,13 @@ end:
       db_private_free_and_init (thread_p, xasl_buf_info);
     }
 
+  db_end_private_arena (thread_p, &arena_num_allocs, &arena_alloc_bytes);
+  if (arena_num_allocs > 0)
+    {
+      perfmon_add_stat (thread_p, PSTAT_QM_NUM_ARENA_ALLOCS, arena_num_allocs);
+      perfmon_add_stat (thread_p, PSTAT_QM_ARENA_ALLOC_BYTES, arena_alloc_bytes);
+    }
+
   return list_id;
 
 exit_on_error:
@@ -1491,6 +1531,9 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 	  /* record list cache entry into the query entry for qfile_end_use_of_list_cache_entry() */
 	  query_p->list_ent = list_cache_entry_p;
 
+	  /* the cached result outlives the transaction; do not keep it charged to the transaction slot */
+	  qmgr_release_tran_list_memory (list_id_p->tfile_vfid);
+
 	  CACHE_TIME_MAKE (server_cache_time_p, &list_cache_entry_p->time_created);
 	}
     }
@@ -2001,6 +2044,7 @@ qmgr_clear_trans_wakeup (THREAD_ENTRY * thread_p, int tran_index, bool is_tran_d
 {
   QMGR_QUERY_ENTRY *query_p;
   QMGR_TRAN_ENTRY *tran_entry_p;
+  QMGR_TEMP_FILE *tfile_vfid_p;
 
   /* for bulletproofing check if tran_index is a valid index, note that normally this should never happen... */
   if (tran_index >= qmgr_Query_table.num_trans
@@ -2068,6 +2112,17 @@ qmgr_clear_trans_wakeup (THREAD_ENTRY * thread_p, int tran_index, bool is_tran_d
 		{
 		  er_log_debug (ARG_FILE_LINE, "query %d is completed!\n", query_p->query_id);
 		}
+	      /* the result outlives the transaction; give the transaction slot its list memory budget back */
+	      tfile_vfid_p = query_p->temp_vfid;
+	      while (tfile_vfid_p != NULL)
+		{
+		  qmgr_release_tran_list_memory (tfile_vfid_p);
+		  tfile_vfid_p = tfile_vfid_p->next;
+		  if (tfile_vfid_p == query_p->temp_vfid)
+		    {
+		      break;
+		    }
+		}
 	      xsession_store_query_entry_info (thread_p, query_p);
 	      /* reset result info */
 	      query_p->list_id = NULL;
@@ -2291,10 +2346,9 @@ qmgr_get_old_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
       /* return memory buffer */
       tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
-      if (vpid_p->pageid >= 0 && vpid_p->pageid <= tfile_vfid_p->membuf_last)
+      page_p = qmgr_get_membuf_page (tfile_vfid_p, vpid_p->pageid);
+      if (page_p != NULL)
 	{
-	  page_p = tfile_vfid_p->membuf[vpid_p->pageid];
-
 	  /* interrupt check */
 #if defined (SERVER_MODE)
 	  if (thread_get_check_interrupt (thread_p) == true
@@ -2430,6 +2484,16 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
       return tfile_vfid_p->membuf[tfile_vfid_p->membuf_last];
     }
 
+  /* keep the list file in private memory while the budget of the transaction allows it */
+  if (tfile_vfid_p->membuf_type == TEMP_FILE_MEMBUF_NORMAL && VFID_ISNULL (&tfile_vfid_p->temp_vfid))
+    {
+      page_p = qmgr_get_membuf_chunk_page (thread_p, vpid_p, tfile_vfid_p);
+      if (page_p != NULL)
+	{
+	  return page_p;
+	}
+    }
+
   /* memory buffer is exhausted; create temp file */
   if (VFID_ISNULL (&tfile_vfid_p->temp_vfid))
     {
@@ -2439,6 +2503,7 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
 	  return NULL;
 	}
       tfile_vfid_p->temp_file_type = FILE_TEMP;
+      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_LIST_SPILLS);
     }
 
   /* try to get pages from an external temp file */
@@ -2569,6 +2634,8 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
   tfile_vfid_p->membuf_type = membuf_type;
 
   tfile_vfid_p->membuf_last = -1;
+  tfile_vfid_p->membuf_chunks = NULL;
+  tfile_vfid_p->membuf_chunk_last = num_buffer_pages - 1;
   page_p = (PAGE_PTR) ((PAGE_PTR) tfile_vfid_p->membuf
 		       + DB_ALIGN (sizeof (PAGE_PTR) * tfile_vfid_p->membuf_npages, MAX_ALIGNMENT));
 
@@ -2581,6 +2648,7 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
 
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+  tfile_vfid_p->tran_index = tran_index;
 
   /* find query entry */
   if (qmgr_Query_table.tran_entries_p != NULL)
@@ -2660,10 +2728,13 @@ qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_ID query_id)
   tfile_vfid_p->membuf = NULL;
   tfile_vfid_p->membuf_npages = 0;
   tfile_vfid_p->membuf_type = TEMP_FILE_MEMBUF_NONE;
+  tfile_vfid_p->membuf_chunks = NULL;
+  tfile_vfid_p->membuf_chunk_last = -1;
 
   /* Find the query entry and chain the created temp file to the entry */
 
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  tfile_vfid_p->tran_index = tran_index;
   tran_entry_p = &(qmgr_Query_table.tran_entries_p[tran_index]);
 
   /* find the query entry */
@@ -3188,6 +3259,7 @@ qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p)
     }
 
   temp_file_p->membuf_last = -1;
+  qmgr_free_membuf_chunks (temp_file_p);
 
   if (QMGR_IS_VALID_MEMBUF_TYPE (temp_file_p->membuf_type))
     {
@@ -3229,6 +3301,209 @@ qmgr_get_temp_file_membuf_pages (QMGR_TEMP_FILE * temp_file_p)
   return temp_file_p->membuf_npages;
 }
 
+/*
+ * qmgr_get_membuf_page () - get a page of the temporary file kept in memory
+ *   return: page pointer or NULL if pageid is not a memory page of the file
+ *   temp_file_p(in): temporary file
+ *   pageid(in): page identifier of a vpid whose volid is NULL_VOLID
+ */
+PAGE_PTR
+qmgr_get_membuf_page (QMGR_TEMP_FILE * temp_file_p, int pageid)
+{
+  QMGR_MEMBUF_CHUNK *chunk_p;
+
+  assert (temp_file_p != NULL);
+
+  if (temp_file_p->membuf != NULL && pageid >= 0 && pageid <= temp_file_p->membuf_last)
+    {
+      return temp_file_p->membuf[pageid];
+    }
+
+  if (pageid > temp_file_p->membuf_chunk_last)
+    {
+      return NULL;
+    }
+
+  for (chunk_p = temp_file_p->membuf_chunks; chunk_p != NULL; chunk_p = chunk_p->next)
+    {
+      if (pageid >= chunk_p->first_pageid)
+	{
+	  return QMGR_MEMBUF_CHUNK_PAGE (chunk_p, pageid - chunk_p->first_pageid);
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * qmgr_get_membuf_chunk_page () - get a new page of the temporary file from private memory
+ *   return: page pointer or NULL if the memory budget of the transaction is exhausted
+ *   vpid_p(out): set to the page identifier
+ *   temp_file_p(in): temporary file
+ *
+ * Note: Once the membuf is used up, the list file grows by chunks of private memory pages instead of fixing temp
+ * volume pages. The chunks are charged to the transaction and to the server. When max_query_list_memory_size or
+ * max_query_list_memory_total_size is reached, the caller spills the rest of the file to a temp volume.
+ */
+static PAGE_PTR
+qmgr_get_membuf_chunk_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * temp_file_p)
+{
+  QMGR_MEMBUF_CHUNK *chunk_p;
+  QMGR_TRAN_ENTRY *tran_entry_p;
+  INT64 max_pages;
+  int npages, tran_pages;
+
+  chunk_p = temp_file_p->membuf_chunks;
+  if (chunk_p == NULL || temp_file_p->membuf_chunk_last >= chunk_p->first_pageid + chunk_p->npages - 1)
+    {
+      /* allocate a new chunk */
+      if (qmgr_Query_table.tran_entries_p == NULL
+	  || temp_file_p->tran_index < 0 || temp_file_p->tran_index >= qmgr_Query_table.num_trans)
+	{
+	  return NULL;
+	}
+      tran_entry_p = &qmgr_Query_table.tran_entries_p[temp_file_p->tran_index];
+
+      npages = (chunk_p == NULL) ? QMGR_MEMBUF_CHUNK_MIN_PAGES : MIN (chunk_p->npages * 2, QMGR_MEMBUF_CHUNK_MAX_PAGES);
+
+      /* charge the server first, then the transaction; either may shrink the chunk to what is left */
+      max_pages = prm_get_bigint_value (PRM_ID_MAX_QUERY_LIST_MEMORY_TOTAL_SIZE) / DB_PAGESIZE;
+      npages = qmgr_charge_list_memory (&qmgr_Query_table.list_memory_pages, max_pages, npages);
+      if (npages <= 0)
+	{
+	  return NULL;
+	}
+
+      max_pages = prm_get_bigint_value (PRM_ID_MAX_QUERY_LIST_MEMORY_SIZE) / DB_PAGESIZE;
+      tran_pages = qmgr_charge_list_memory (&tran_entry_p->list_memory_pages, max_pages, npages);
+      if (tran_pages < npages)
+	{
+	  ATOMIC_INC_32 (&qmgr_Query_table.list_memory_pages, -(npages - tran_pages));
+	  npages = tran_pages;
+	  if (npages <= 0)
+	    {
+	      return NULL;
+	    }
+	}
+
+      chunk_p = (QMGR_MEMBUF_CHUNK *) malloc (DB_ALIGN (sizeof (QMGR_MEMBUF_CHUNK), MAX_ALIGNMENT)
+					      + (size_t) npages * DB_PAGESIZE);
+      if (chunk_p == NULL)
+	{
+	  /* not an error; the list file is spilled to a temp volume */
+	  ATOMIC_INC_32 (&tran_entry_p->list_memory_pages, -npages);
+	  ATOMIC_INC_32 (&qmgr_Query_table.list_memory_pages, -npages);
+	  return NULL;
+	}
+
+      chunk_p->first_pageid = temp_file_p->membuf_chunk_last + 1;
+      chunk_p->npages = npages;
+      chunk_p->next = temp_file_p->membuf_chunks;
+      temp_file_p->membuf_chunks = chunk_p;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_LIST_MEMORY_PAGES);
+
+  vpid_p->volid = NULL_VOLID;
+  vpid_p->pageid = ++(temp_file_p->membuf_chunk_last);
+  return QMGR_MEMBUF_CHUNK_PAGE (chunk_p, vpid_p->pageid - chunk_p->first_pageid);
+}
+
+/*
+ * qmgr_free_membuf_chunks () - free the private memory pages of the temporary file
+ *   return: none
+ *   temp_file_p(in): temporary file
+ */
+static void
+qmgr_free_membuf_chunks (QMGR_TEMP_FILE * temp_file_p)
+{
+  QMGR_MEMBUF_CHUNK *chunk_p;
+  int npages = 0;
+
+  while (temp_file_p->membuf_chunks != NULL)
+    {
+      chunk_p = temp_file_p->membuf_chunks;
+      temp_file_p->membuf_chunks = chunk_p->next;
+      npages += chunk_p->npages;
+      free_and_init (chunk_p);
+    }
+  temp_file_p->membuf_chunk_last = temp_file_p->membuf_npages - 1;
+
+  if (npages > 0)
+    {
+      ATOMIC_INC_32 (&qmgr_Query_table.list_memory_pages, -npages);
+
+      /* the charge of the transaction is already gone if the file was handed over to a holdable cursor */
+      if (temp_file_p->tran_index != NULL_TRAN_INDEX && qmgr_Query_table.tran_entries_p != NULL)
+	{
+	  assert (temp_file_p->tran_index >= 0 && temp_file_p->tran_index < qmgr_Query_table.num_trans);
+	  ATOMIC_INC_32 (&qmgr_Query_table.tran_entries_p[temp_file_p->tran_index].list_memory_pages, -npages);
+	}
+    }
+}
+
+/*
+ * qmgr_charge_list_memory () - charge memory pages of list files against a budget
+ *   return: number of pages charged; less than npages when the budget is almost spent
+ *   used_pages_p(in/out): pages charged so far
+ *   max_pages(in): budget; zero or less means no list file memory is allowed
+ *   npages(in): pages to charge
+ */
+static int
+qmgr_charge_list_memory (int *used_pages_p, INT64 max_pages, int npages)
+{
+  int used_pages, over;
+
+  if (max_pages <= 0)
+    {
+      return 0;
+    }
+
+  used_pages = ATOMIC_INC_32 (used_pages_p, npages);
+  if (used_pages > max_pages)
+    {
+      /* shrink to what is left of the budget */
+      over = (int) MIN (used_pages - max_pages, npages);
+      ATOMIC_INC_32 (used_pages_p, -over);
+      npages -= over;
+    }
+
+  return npages;
+}
+
+/*
+ * qmgr_release_tran_list_memory () - drop the transaction charge of the memory pages of a temporary file
+ *   return: none
+ *   temp_file_p(in): temporary file
+ *
+ * Note: Called when the file outlives the transaction, as holdable cursor results and cached results do. Its memory
+ *       stays charged to the server until the file is freed, but the transaction slot, which a later transaction may
+ *       reuse, gets its budget back.
+ */
+void
+qmgr_release_tran_list_memory (QMGR_TEMP_FILE * temp_file_p)
+{
+  QMGR_MEMBUF_CHUNK *chunk_p;
+  int npages = 0;
+
+  if (temp_file_p == NULL || temp_file_p->tran_index == NULL_TRAN_INDEX)
+    {
+      return;
+    }
+
+  for (chunk_p = temp_file_p->membuf_chunks; chunk_p != NULL; chunk_p = chunk_p->next)
+    {
+      npages += chunk_p->npages;
+    }
+
+  if (npages > 0 && qmgr_Query_table.tran_entries_p != NULL)
+    {
+      assert (temp_file_p->tran_index >= 0 && temp_file_p->tran_index < qmgr_Query_table.num_trans);
+      ATOMIC_INC_32 (&qmgr_Query_table.tran_entries_p[temp_file_p->tran_index].list_memory_pages, -npages);
+    }
+  temp_file_p->tran_index = NULL_TRAN_INDEX;
+}
+
 #if defined (SERVER_MODE)
 /*
  * qmgr_set_query_exec_info_to_tdes () - calculate timeout and set to transaction
@@ -65,6 +65,18 @@ typedef enum
   QMGR_TRAN_TERMINATED		/* Terminated transaction */
 } QMGR_TRAN_STATUS;
 
+/*
+ * Private memory pages handed out after the membuf of a temporary file is
+ * used up. The pages of a chunk are contiguous and follow the header.
+ */
+typedef struct qmgr_membuf_chunk QMGR_MEMBUF_CHUNK;
+struct qmgr_membuf_chunk
+{
+  QMGR_MEMBUF_CHUNK *next;
+  int first_pageid;		/* pageid of the first page of the chunk */
+  int npages;
+};
+
 typedef struct qmgr_temp_file QMGR_TEMP_FILE;
 struct qmgr_temp_file
 {
@@ -76,6 +88,9 @@ struct qmgr_temp_file
   PAGE_PTR *membuf;
   int membuf_npages;
   QMGR_TEMP_FILE_MEMBUF_TYPE membuf_type;
+  QMGR_MEMBUF_CHUNK *membuf_chunks;	/* memory pages past membuf, newest chunk first */
+  int membuf_chunk_last;	/* pageid of the last page given from membuf_chunks */
+  int tran_index;		/* transaction charged for membuf_chunks; NULL_TRAN_INDEX once released */
 };
 
 /*
@@ -160,6 +175,8 @@ extern bool qmgr_is_query_interrupted (THREAD_ENTRY * thread_p, QUERY_ID query_i
 extern void qmgr_set_query_error (THREAD_ENTRY * thread_p, QUERY_ID query_id);
 extern void qmgr_setup_empty_list_file (char *page_buf);
 extern int qmgr_get_temp_file_membuf_pages (QMGR_TEMP_FILE * temp_file_p);
+extern PAGE_PTR qmgr_get_membuf_page (QMGR_TEMP_FILE * temp_file_p, int pageid);
+extern void qmgr_release_tran_list_memory (QMGR_TEMP_FILE * temp_file_p);
 extern int qmgr_get_sql_id (THREAD_ENTRY * thread_p, char **sql_id_buf, char *query, int sql_len);
 extern struct drand48_data *qmgr_get_rand_buf (THREAD_ENTRY * thread_p);
 extern QUERY_ID qmgr_get_current_query_id (THREAD_ENTRY * thread_p);
@@ -2801,6 +2801,7 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 {
   HEAP_SCAN_ID *hsidp;
   DB_TYPE single_node_type = DB_TYPE_NULL;
+  int num_pages;
 
   /* scan type is HEAP SCAN or HEAP SCAN RECORD INFO */
   assert (scan_type == S_HEAP_SCAN || scan_type == S_HEAP_SCAN_RECORD_INFO);
@@ -2842,6 +2843,19 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   hsidp->cache_recordinfo = cache_recordinfo;
   hsidp->recordinfo_regu_list = regu_list_recordinfo;
 
+  /* reading a heap much larger than the page buffer would only push other pages out; select scans of such heaps
+   * recycle a few buffers instead */
+  hsidp->use_ring = false;
+  if (scan_op_type == S_SELECT && !HFID_IS_NULL (hfid))
+    {
+      if (file_get_num_user_pages (thread_p, &hfid->vfid, &num_pages) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return er_errid ();
+	}
+      hsidp->use_ring = pgbuf_should_use_ring (num_pages);
+    }
+
   return NO_ERROR;
 }
 
@@ -4955,6 +4969,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 
     restart_scan_oid:
 
+      if (hsidp->use_ring)
+	{
+	  pgbuf_ring_begin (thread_p);
+	}
+
       /* get next object */
       if (scan_id->grouped)
 	{
@@ -5000,6 +5019,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	}
 
+      if (hsidp->use_ring)
+	{
+	  pgbuf_ring_end (thread_p);
+	}
+
       if (sp_scan != S_SUCCESS)
 	{
 	  /* scan error or end of scan */
@@ -76,6 +76,7 @@ struct heap_scan_id
   bool caches_inited;		/* are the caches initialized?? */
   bool scancache_inited;
   bool scanrange_inited;
+  bool use_ring;		/* read heap pages through a buffer ring (large heap) */
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   REGU_VARIABLE_LIST recordinfo_regu_list;	/* regulator variable list for record info */
 };				/* Regular Heap File Scan Identifier */
@@ -48,6 +48,7 @@
 #include "critical_section.h"
 #include "job_queue.h"
 #include "tz_support.h"
+#include "vacuum.h"
 
 #if defined(SERVER_MODE)
 #include "thread.h"
@@ -218,6 +219,12 @@ showstmt_scan_init (void)
   req->next_func = showstmt_array_next_scan;
   req->end_func = showstmt_array_end_scan;
 
+  req = &show_Requests[SHOWSTMT_VACUUM_STATUS];
+  req->show_type = SHOWSTMT_VACUUM_STATUS;
+  req->start_func = vacuum_status_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
   /* append to init other show statement scan function here */
 
 
@@ -2900,6 +2900,7 @@ stx_build_buildlist_proc (THREAD_ENTRY * thread_p, char *ptr, BUILDLIST_PROC_NOD
 
   ptr = or_unpack_int (ptr, (int *) &stx_build_list_proc->g_hash_eligible);
   memset (&stx_build_list_proc->agg_hash_context, 0, sizeof (AGGREGATE_HASH_CONTEXT));
+  stx_build_list_proc->join_filter = NULL;
 
   ptr = or_unpack_int (ptr, (int *) &stx_build_list_proc->g_output_first_tuple);
   ptr = or_unpack_int (ptr, (int *) &stx_build_list_proc->g_hkey_size);
@@ -4612,6 +4613,7 @@ stx_build_access_spec_type (THREAD_ENTRY * thread_p, char *ptr, ACCESS_SPEC_TYPE
   ptr = or_unpack_int (ptr, &access_spec->pruning_type);
   access_spec->parts = NULL;
   access_spec->curent = NULL;
+  access_spec->prefetch = NULL;
   access_spec->pruned = false;
 
   access_spec->clear_value_at_clone_decache = false;
@@ -4635,6 +4637,7 @@ stx_build_access_spec_type (THREAD_ENTRY * thread_p, char *ptr, ACCESS_SPEC_TYPE
 
   access_spec->parts = NULL;
   access_spec->curent = NULL;
+  access_spec->prefetch = NULL;
   access_spec->pruned = false;
 
   ptr = or_unpack_int (ptr, &val);
@@ -37,6 +37,7 @@
 #include "transaction_cl.h"
 #include "util_func.h"
 #include "log_impl.h"
+#include "show_scan.h"
 
 /* The maximum number of slots in a page if all of them are empty.
  * IO_MAX_PAGE_SIZE is used for page size and any headers are ignored (it
@@ -236,6 +237,7 @@ struct vacuum_data
   LOG_PAGEID keep_from_log_pageid;	/* Smallest LOG_PAGEID that vacuum may still need for its jobs. */
 
   MVCCID oldest_unvacuumed_mvccid;	/* Global oldest MVCCID not vacuumed (yet). */
+  INT64 oldest_unvacuumed_mvccid_msec;	/* Time when oldest_unvacuumed_mvccid was last advanced. */
 
   VACUUM_DATA_PAGE *first_page;	/* Cached first vacuum data page. Usually used to generate new jobs. */
   VACUUM_DATA_PAGE *last_page;	/* Cached last vacuum data page. Usually used to receive new data. */
@@ -266,6 +268,7 @@ static VACUUM_DATA vacuum_Data = {
   VACUUM_NULL_LOG_BLOCKID,	/* last_blockid */
   NULL_PAGEID,			/* keep_from_log_pageid */
   MVCCID_NULL,			/* oldest_unvacuumed_mvccid */
+  0,				/* oldest_unvacuumed_mvccid_msec */
   NULL,				/* first_page */
   NULL,				/* last_page */
   0,				/* page_data_max_count */
@@ -429,6 +432,37 @@ VACUUM_WORKER *vacuum_Worker_sa_mode;
 INT32 vacuum_Assigned_workers_count = 0;
 INT32 vacuum_Running_workers_count = 0;
 
+#if defined (SERVER_MODE)
+/* VACUUM_HEAP_SHARED_JOB -
+ * Heap objects of a large log block that idle workers help to vacuum. The sorted objects are split in chunks of whole
+ * heap pages; the owner and its helpers claim chunks until none is left.
+ */
+typedef struct vacuum_heap_shared_job VACUUM_HEAP_SHARED_JOB;
+struct vacuum_heap_shared_job
+{
+  VACUUM_WORKER *owner;		/* Worker that collected the objects. */
+  VACUUM_HEAP_OBJECT *heap_objects;	/* Sorted heap objects of owner. */
+  int *chunk_starts;		/* Index of first object of each chunk; one more entry for the end of last chunk. */
+  int n_chunks;			/* Number of chunks. */
+  volatile INT32 next_chunk;	/* Next chunk to claim. */
+  int n_helpers;		/* Number of helpers that may still claim chunks. Protected by
+				 * vacuum_Heap_shared_jobs_mutex. */
+  pthread_cond_t helpers_done_cond;	/* Signaled when last helper leaves the job. */
+  MVCCID threshold_mvccid;	/* Threshold MVCCID of owner job. */
+  bool was_interrupted;		/* True if owner job was interrupted before. */
+};
+
+/* Jobs that can be helped. Protected by vacuum_Heap_shared_jobs_mutex. */
+static VACUUM_HEAP_SHARED_JOB *vacuum_Heap_shared_jobs[VACUUM_MAX_WORKER_COUNT];
+static int vacuum_Heap_shared_jobs_count = 0;
+static pthread_mutex_t vacuum_Heap_shared_jobs_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Number of heap pages in a chunk of shared job. */
+#define VACUUM_HEAP_SHARED_CHUNK_NPAGES 16
+/* Blocks with fewer heap pages are vacuumed only by their worker. */
+#define VACUUM_HEAP_SHARED_MIN_NPAGES (4 * VACUUM_HEAP_SHARED_CHUNK_NPAGES)
+#endif /* SERVER_MODE */
+
 /* VACUUM_HEAP_HELPER -
  * Structure used by vacuum heap functions.
  */
@@ -602,6 +636,7 @@ struct vacuum_dropped_files_rcv_data
 static void vacuum_process_vacuum_data (THREAD_ENTRY * thread_p);
 static void vacuum_update_oldest_unvacuumed_mvccid (THREAD_ENTRY * thread_p);
 static void vacuum_update_keep_from_log_pageid (THREAD_ENTRY * thread_p);
+static INT64 vacuum_get_clock_msec (void);
 static int vacuum_compare_blockids (const void *ptr1, const void *ptr2);
 static void vacuum_data_mark_finished (THREAD_ENTRY * thread_p);
 static void vacuum_data_empty_page (THREAD_ENTRY * thread_p, VACUUM_DATA_PAGE * prev_data_page,
@@ -625,6 +660,14 @@ static int vacuum_compare_heap_object (const void *a, const void *b);
 static int vacuum_collect_heap_objects (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, OID * oid, VFID * vfid);
 static void vacuum_cleanup_collected_by_vfid (VACUUM_WORKER * worker, VFID * vfid);
 static int vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted);
+static int vacuum_heap_objects (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, VACUUM_HEAP_OBJECT * heap_objects,
+				int n_heap_objects, MVCCID threshold_mvccid, bool was_interrupted);
+#if defined (SERVER_MODE)
+static bool vacuum_heap_share (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid,
+			       bool was_interrupted);
+static bool vacuum_heap_help (THREAD_ENTRY * thread_p);
+static int vacuum_heap_shared_job_run (THREAD_ENTRY * thread_p, VACUUM_HEAP_SHARED_JOB * job);
+#endif /* SERVER_MODE */
 static int vacuum_heap_prepare_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record_insid_and_prev_version (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
@@ -821,6 +864,13 @@ vacuum_initialize (THREAD_ENTRY * thread_p, int vacuum_log_block_npages, VFID *
   vacuum_Master.postpone_redo_data_ptr = NULL;
   vacuum_Master.postpone_redo_data_buffer = NULL;
   vacuum_Master.postpone_cached_entries_count = 0;
+  vacuum_Master.blockid = VACUUM_NULL_LOG_BLOCKID;
+  vacuum_Master.n_heap_pages = 0;
+  vacuum_Master.n_heap_pages_done = 0;
+  vacuum_Master.helped_worker_index = -1;
+  vacuum_Master.job_start_msec = 0;
+  vacuum_Master.n_blocks_vacuumed = 0;
+  vacuum_Master.total_job_msec = 0;
 
   /* Initialize worker counters */
   vacuum_Assigned_workers_count = 0;
@@ -843,6 +893,13 @@ vacuum_initialize (THREAD_ENTRY * thread_p, int vacuum_log_block_npages, VFID *
       vacuum_Workers[i].postpone_redo_data_ptr = NULL;
       vacuum_Workers[i].postpone_redo_data_buffer = NULL;
       vacuum_Workers[i].postpone_cached_entries_count = 0;
+      vacuum_Workers[i].blockid = VACUUM_NULL_LOG_BLOCKID;
+      vacuum_Workers[i].n_heap_pages = 0;
+      vacuum_Workers[i].n_heap_pages_done = 0;
+      vacuum_Workers[i].helped_worker_index = -1;
+      vacuum_Workers[i].job_start_msec = 0;
+      vacuum_Workers[i].n_blocks_vacuumed = 0;
+      vacuum_Workers[i].total_job_msec = 0;
     }
 
   vacuum_Master.postpone_redo_data_buffer = (char *) malloc (IO_PAGESIZE);
@@ -1034,13 +1091,8 @@ vacuum_finalize (THREAD_ENTRY * thread_p)
 static int
 vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted)
 {
-  VACUUM_HEAP_OBJECT *page_ptr;
   VACUUM_HEAP_OBJECT *obj_ptr;
-  int error_code = NO_ERROR;
-  VFID vfid = VFID_INITIALIZER;
-  HFID hfid = HFID_INITIALIZER;
-  bool reusable = false;
-  int object_count = 0;
+  int n_heap_pages = 0;
 
   if (worker->n_heap_objects == 0)
     {
@@ -1055,8 +1107,55 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
    * each different heap page. */
   qsort (worker->heap_objects, worker->n_heap_objects, sizeof (VACUUM_HEAP_OBJECT), vacuum_compare_heap_object);
 
+  /* Count heap pages to report progress. */
+  for (obj_ptr = worker->heap_objects; obj_ptr < worker->heap_objects + worker->n_heap_objects; obj_ptr++)
+    {
+      if (obj_ptr == worker->heap_objects || obj_ptr->oid.pageid != (obj_ptr - 1)->oid.pageid
+	  || obj_ptr->oid.volid != (obj_ptr - 1)->oid.volid)
+	{
+	  n_heap_pages++;
+	}
+    }
+  worker->n_heap_pages = n_heap_pages;
+  worker->n_heap_pages_done = 0;
+
+#if defined (SERVER_MODE)
+  if (vacuum_heap_share (thread_p, worker, threshold_mvccid, was_interrupted))
+    {
+      /* All pages were vacuumed by this worker and its helpers. */
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE */
+
+  return vacuum_heap_objects (thread_p, worker, worker->heap_objects, worker->n_heap_objects, threshold_mvccid,
+			      was_interrupted);
+}
+
+/*
+ * vacuum_heap_objects () - Vacuum a range of sorted heap objects page by page.
+ *
+ * return		 : Error code.
+ * thread_p (in)	 : Thread entry.
+ * owner (in)		 : Worker that collected the objects. Its progress is updated.
+ * heap_objects (in)	 : Sorted heap objects. First object is the first of its page.
+ * n_heap_objects (in)	 : Number of heap objects. Last object is the last of its page.
+ * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
+ * was_interrutped (in)  : True if same job was executed and interrupted.
+ */
+static int
+vacuum_heap_objects (THREAD_ENTRY * thread_p, VACUUM_WORKER * owner, VACUUM_HEAP_OBJECT * heap_objects,
+		     int n_heap_objects, MVCCID threshold_mvccid, bool was_interrupted)
+{
+  VACUUM_HEAP_OBJECT *page_ptr;
+  VACUUM_HEAP_OBJECT *obj_ptr;
+  int error_code = NO_ERROR;
+  VFID vfid = VFID_INITIALIZER;
+  HFID hfid = HFID_INITIALIZER;
+  bool reusable = false;
+  int object_count = 0;
+
   /* Start parsing array. Vacuum objects page by page. */
-  for (page_ptr = worker->heap_objects; page_ptr < worker->heap_objects + worker->n_heap_objects;)
+  for (page_ptr = heap_objects; page_ptr < heap_objects + n_heap_objects;)
     {
       if (!VFID_EQ (&vfid, &page_ptr->vfid))
 	{
@@ -1068,7 +1167,7 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
       /* Find all objects for this page. */
       object_count = 1;
       for (obj_ptr = page_ptr + 1;
-	   obj_ptr < worker->heap_objects + worker->n_heap_objects && obj_ptr->oid.pageid == page_ptr->oid.pageid
+	   obj_ptr < heap_objects + n_heap_objects && obj_ptr->oid.pageid == page_ptr->oid.pageid
 	   && obj_ptr->oid.volid == page_ptr->oid.volid; obj_ptr++)
 	{
 	  object_count++;
@@ -1086,12 +1185,201 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
 	  error_code = NO_ERROR;
 	  /* Release should not stop. Continue. */
 	}
+      ATOMIC_INC_32 (&owner->n_heap_pages_done, 1);
+
       /* Advance to next page. */
       page_ptr = obj_ptr;
     }
   return NO_ERROR;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * vacuum_heap_share () - Vacuum the heap objects of a large block together with idle vacuum workers.
+ *
+ * return		 : True if objects were vacuumed, false if they were not shared.
+ * thread_p (in)	 : Thread entry.
+ * worker (in)		 : Vacuum worker with sorted heap objects.
+ * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
+ * was_interrutped (in)  : True if same job was executed and interrupted.
+ *
+ * NOTE: A single large transaction may fill whole log blocks with heap objects. Instead of leaving one worker to vacuum
+ *	 them while others are idle, the objects are split in chunks of heap pages, and idle workers are woken to claim
+ *	 chunks too. The block is finished only after all chunks are vacuumed.
+ */
+static bool
+vacuum_heap_share (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted)
+{
+  VACUUM_HEAP_SHARED_JOB job;
+  int n_max_chunks;
+  int n_pages = 0;
+  int i;
+
+  if (worker->n_heap_pages < VACUUM_HEAP_SHARED_MIN_NPAGES || prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT) <= 1)
+    {
+      return false;
+    }
+
+  n_max_chunks = CEIL_PTVDIV (worker->n_heap_pages, VACUUM_HEAP_SHARED_CHUNK_NPAGES);
+  job.chunk_starts = (int *) malloc ((n_max_chunks + 1) * sizeof (int));
+  if (job.chunk_starts == NULL)
+    {
+      /* Vacuum alone. */
+      vacuum_er_log_warning (VACUUM_ER_LOG_HEAP, "%s", "Could not allocate chunks to share heap objects.");
+      return false;
+    }
+
+  /* Split objects in chunks of whole pages. */
+  job.n_chunks = 0;
+  for (i = 0; i < worker->n_heap_objects; i++)
+    {
+      if (i == 0 || worker->heap_objects[i].oid.pageid != worker->heap_objects[i - 1].oid.pageid
+	  || worker->heap_objects[i].oid.volid != worker->heap_objects[i - 1].oid.volid)
+	{
+	  if (n_pages % VACUUM_HEAP_SHARED_CHUNK_NPAGES == 0)
+	    {
+	      job.chunk_starts[job.n_chunks++] = i;
+	    }
+	  n_pages++;
+	}
+    }
+  job.chunk_starts[job.n_chunks] = worker->n_heap_objects;
+  assert (job.n_chunks == n_max_chunks);
+
+  job.owner = worker;
+  job.heap_objects = worker->heap_objects;
+  job.next_chunk = 0;
+  job.n_helpers = 0;
+  pthread_cond_init (&job.helpers_done_cond, NULL);
+  job.threshold_mvccid = threshold_mvccid;
+  job.was_interrupted = was_interrupted;
+
+  pthread_mutex_lock (&vacuum_Heap_shared_jobs_mutex);
+  assert (vacuum_Heap_shared_jobs_count < VACUUM_MAX_WORKER_COUNT);
+  vacuum_Heap_shared_jobs[vacuum_Heap_shared_jobs_count++] = &job;
+  pthread_mutex_unlock (&vacuum_Heap_shared_jobs_mutex);
+
+  vacuum_er_log (VACUUM_ER_LOG_HEAP | VACUUM_ER_LOG_WORKER, "Share %d heap pages of block %lld in %d chunks.",
+		 worker->n_heap_pages, (long long int) worker->blockid, job.n_chunks);
+
+  thread_wakeup_vacuum_worker_threads (MIN (job.n_chunks, prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT)) - 1);
+
+  (void) vacuum_heap_shared_job_run (thread_p, &job);
+
+  /* No chunk is left to claim. Remove the job and wait for helpers still vacuuming their chunks. */
+  pthread_mutex_lock (&vacuum_Heap_shared_jobs_mutex);
+  for (i = 0; i < vacuum_Heap_shared_jobs_count; i++)
+    {
+      if (vacuum_Heap_shared_jobs[i] == &job)
+	{
+	  vacuum_Heap_shared_jobs[i] = vacuum_Heap_shared_jobs[--vacuum_Heap_shared_jobs_count];
+	  break;
+	}
+    }
+  while (job.n_helpers > 0)
+    {
+      pthread_cond_wait (&job.helpers_done_cond, &vacuum_Heap_shared_jobs_mutex);
+    }
+  pthread_mutex_unlock (&vacuum_Heap_shared_jobs_mutex);
+  assert (worker->n_heap_pages_done == worker->n_heap_pages);
+
+  pthread_cond_destroy (&job.helpers_done_cond);
+  free (job.chunk_starts);
+  return true;
+}
+
+/*
+ * vacuum_heap_help () - Help another worker to vacuum its heap objects.
+ *
+ * return	 : True if a job was helped, false if there was nothing to help.
+ * thread_p (in) : Thread entry.
+ */
+static bool
+vacuum_heap_help (THREAD_ENTRY * thread_p)
+{
+  VACUUM_WORKER *worker = VACUUM_GET_VACUUM_WORKER (thread_p);
+  VACUUM_HEAP_SHARED_JOB *job = NULL;
+  int i;
+
+  if (vacuum_Heap_shared_jobs_count == 0)
+    {
+      return false;
+    }
+
+  pthread_mutex_lock (&vacuum_Heap_shared_jobs_mutex);
+  for (i = 0; i < vacuum_Heap_shared_jobs_count; i++)
+    {
+      if (VOLATILE_ACCESS (vacuum_Heap_shared_jobs[i]->next_chunk, INT32) < vacuum_Heap_shared_jobs[i]->n_chunks)
+	{
+	  job = vacuum_Heap_shared_jobs[i];
+	  /* Owner waits for helpers before releasing the job. */
+	  job->n_helpers++;
+	  break;
+	}
+    }
+  pthread_mutex_unlock (&vacuum_Heap_shared_jobs_mutex);
+
+  if (job == NULL)
+    {
+      return false;
+    }
+
+  /* Objects of dropped files were already removed by owner. */
+  worker->drop_files_version = job->owner->drop_files_version;
+  worker->helped_worker_index = (int) (job->owner - vacuum_Workers);
+  worker->state = VACUUM_WORKER_STATE_EXECUTE;
+
+  (void) vacuum_heap_shared_job_run (thread_p, job);
+
+  assert (worker->tdes->topops.last == -1);
+  worker->state = VACUUM_WORKER_STATE_INACTIVE;
+  worker->helped_worker_index = -1;
+
+  /* Job must not be accessed after the mutex is released. */
+  pthread_mutex_lock (&vacuum_Heap_shared_jobs_mutex);
+  if (--job->n_helpers == 0)
+    {
+      pthread_cond_signal (&job->helpers_done_cond);
+    }
+  pthread_mutex_unlock (&vacuum_Heap_shared_jobs_mutex);
+
+  return true;
+}
+
+/*
+ * vacuum_heap_shared_job_run () - Claim and vacuum chunks of shared job until none is left.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ * job (in)	 : Shared job.
+ */
+static int
+vacuum_heap_shared_job_run (THREAD_ENTRY * thread_p, VACUUM_HEAP_SHARED_JOB * job)
+{
+  VACUUM_WORKER *worker = VACUUM_GET_VACUUM_WORKER (thread_p);
+  int chunk;
+  int first, count;
+
+  while ((chunk = ATOMIC_INC_32 (&job->next_chunk, 1) - 1) < job->n_chunks)
+    {
+      first = job->chunk_starts[chunk];
+      count = job->chunk_starts[chunk + 1] - first;
+
+      (void) vacuum_heap_objects (thread_p, job->owner, job->heap_objects + first, count, job->threshold_mvccid,
+				  job->was_interrupted);
+
+      if (worker != job->owner)
+	{
+	  perfmon_add_stat (thread_p, PSTAT_VAC_NUM_HELPED_HEAP_PAGES,
+			    MIN (VACUUM_HEAP_SHARED_CHUNK_NPAGES,
+				 job->owner->n_heap_pages - chunk * VACUUM_HEAP_SHARED_CHUNK_NPAGES));
+	}
+    }
+
+  return NO_ERROR;
+}
+#endif /* SERVER_MODE */
+
 /*
  * vacuum_heap_page () - Vacuum objects in one heap page.
  *
@@ -3057,6 +3345,10 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, BLO
 
   /* Initialize stored heap objects. */
   worker->n_heap_objects = 0;
+  worker->n_heap_pages = 0;
+  worker->n_heap_pages_done = 0;
+  worker->blockid = VACUUM_BLOCKID_WITHOUT_FLAGS (data->blockid);
+  worker->job_start_msec = vacuum_get_clock_msec ();
 
   was_interrupted = VACUUM_BLOCK_IS_INTERRUPTED (data->blockid);
 
@@ -3305,6 +3597,13 @@ end:
 #endif /* SERVER_MODE */
 
   worker->state = VACUUM_WORKER_STATE_INACTIVE;
+  worker->blockid = VACUUM_NULL_LOG_BLOCKID;
+  if (vacuum_complete)
+    {
+      worker->total_job_msec += vacuum_get_clock_msec () - worker->job_start_msec;
+      worker->n_blocks_vacuumed++;
+    }
+  worker->job_start_msec = 0;
   if (!sa_mode_partial_block)
     {
       /* TODO: Check that if start_lsa can be set to a different value when vacuum is not complete, to avoid processing 
@@ -3602,9 +3901,19 @@ vacuum_start_new_job (THREAD_ENTRY * thread_p)
   /* Increment running workers */
   ATOMIC_INC_32 (&vacuum_Running_workers_count, 1);
 
-  /* Loop as long as job queue is not empty */
-  while (!vacuum_Data.shutdown_requested && lf_circular_queue_consume (vacuum_Job_queue, &vacuum_job_entry))
+  /* Loop as long as job queue is not empty or other workers need help */
+  while (!vacuum_Data.shutdown_requested)
     {
+      if (!lf_circular_queue_consume (vacuum_Job_queue, &vacuum_job_entry))
+	{
+	  /* Help other workers vacuum their heap pages. */
+	  if (vacuum_heap_help (thread_p))
+	    {
+	      continue;
+	    }
+	  break;
+	}
+
       /* Execute vacuum job */
       /* entry is only a copy for vacuum data */
       entry = &vacuum_job_entry.vacuum_data_entry;
@@ -5453,6 +5762,101 @@ vacuum_min_log_pageid_to_keep (THREAD_ENTRY * thread_p)
   return vacuum_Data.keep_from_log_pageid;
 }
 
+/*
+ * vacuum_get_backlog_blocks () - Get the number of log blocks not yet vacuumed.
+ *
+ * return : Number of log blocks.
+ *
+ * NOTE: The result is approximate. It counts the blocks from the first block not vacuumed to the last block in vacuum
+ *	 data, and the blocks waiting in vacuum_Block_data_buffer. Blocks already vacuumed in between are also counted.
+ */
+INT64
+vacuum_get_backlog_blocks (void)
+{
+  LOG_PAGEID keep_from_log_pageid = vacuum_Data.keep_from_log_pageid;
+  INT64 n_blocks;
+
+  if (prm_get_bool_value (PRM_ID_DISABLE_VACUUM) || !vacuum_Data.is_loaded || keep_from_log_pageid == NULL_PAGEID)
+    {
+      return 0;
+    }
+
+  n_blocks = vacuum_Data.last_blockid + 1 - vacuum_get_log_blockid (keep_from_log_pageid);
+  if (vacuum_Block_data_buffer != NULL)
+    {
+      n_blocks += lf_circular_queue_approx_size (vacuum_Block_data_buffer);
+    }
+
+  return MAX (n_blocks, 0);
+}
+
+/*
+ * vacuum_get_backlog_log_pages () - Get the number of log pages not yet vacuumed.
+ *
+ * return : Number of log pages.
+ */
+INT64
+vacuum_get_backlog_log_pages (void)
+{
+  return vacuum_get_backlog_blocks () * vacuum_Data.log_block_npages;
+}
+
+/*
+ * vacuum_get_oldest_unvacuumed_age () - Get the number of seconds since vacuum last advanced its oldest unvacuumed
+ *					  MVCCID.
+ *
+ * return : Number of seconds or 0 if there is nothing to vacuum.
+ */
+INT64
+vacuum_get_oldest_unvacuumed_age (void)
+{
+  INT64 update_msec = vacuum_Data.oldest_unvacuumed_mvccid_msec;
+
+  if (update_msec == 0 || vacuum_get_backlog_blocks () == 0)
+    {
+      return 0;
+    }
+
+  return MAX (vacuum_get_clock_msec () - update_msec, 0) / 1000;
+}
+
+/*
+ * vacuum_get_retained_log_pages () - Get the number of log pages that cannot be removed because vacuum may still need
+ *				       them.
+ *
+ * return : Number of log pages.
+ */
+INT64
+vacuum_get_retained_log_pages (void)
+{
+  LOG_PAGEID keep_from_log_pageid = vacuum_min_log_pageid_to_keep (NULL);
+
+  if (keep_from_log_pageid == NULL_PAGEID)
+    {
+      return 0;
+    }
+
+  return MAX (log_Gl.hdr.append_lsa.pageid - keep_from_log_pageid, 0);
+}
+
+/*
+ * vacuum_get_clock_msec () - Get current time in milliseconds.
+ *
+ * return : Current time in milliseconds.
+ */
+static INT64
+vacuum_get_clock_msec (void)
+{
+#if defined (SERVER_MODE)
+  return thread_get_log_clock_msec ();
+#else /* !SERVER_MODE */
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return (tv.tv_sec * 1000LL) + (tv.tv_usec / 1000LL);
+#endif /* !SERVER_MODE */
+}
+
 /*
  * vacuum_rv_redo_start_job () - Redo start vacuum job.
  *
@@ -5524,6 +5928,11 @@ vacuum_update_oldest_unvacuumed_mvccid (THREAD_ENTRY * thread_p)
 
       (void) vacuum_cleanup_dropped_files (thread_p);
     }
+  if (oldest_mvccid != vacuum_Data.oldest_unvacuumed_mvccid || vacuum_Data.oldest_unvacuumed_mvccid_msec == 0)
+    {
+      /* Used to report for how long vacuum did not advance its oldest MVCCID. */
+      vacuum_Data.oldest_unvacuumed_mvccid_msec = vacuum_get_clock_msec ();
+    }
   /* Vacuum data oldest MVCCID cannot go backwards! */
   assert (vacuum_Data.oldest_unvacuumed_mvccid <= oldest_mvccid);
   vacuum_Data.oldest_unvacuumed_mvccid = oldest_mvccid;
@@ -7686,3 +8095,195 @@ vacuum_rv_check_at_undo (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, INT16 slotid,
 
   return NO_ERROR;
 }
+
+/*
+ * vacuum_worker_state_to_string () - Get name of vacuum worker state.
+ *
+ * return     : State name.
+ * state (in) : Vacuum worker state.
+ */
+static const char *
+vacuum_worker_state_to_string (VACUUM_WORKER_STATE state)
+{
+  switch (state)
+    {
+    case VACUUM_WORKER_STATE_INACTIVE:
+      return "INACTIVE";
+    case VACUUM_WORKER_STATE_PROCESS_LOG:
+      return "PROCESS_LOG";
+    case VACUUM_WORKER_STATE_EXECUTE:
+      return "EXECUTE";
+    case VACUUM_WORKER_STATE_TOPOP:
+      return "TOPOP";
+    case VACUUM_WORKER_STATE_RECOVERY:
+      return "RECOVERY";
+    default:
+      assert (false);
+      return "UNKNOWN";
+    }
+}
+
+/*
+ * vacuum_status_start_scan () - Start scan function for 'SHOW VACUUM STATUS'.
+ *
+ * return	   : Error code.
+ * thread_p (in)   : Thread entry.
+ * type (in)	   : Show statement type.
+ * arg_values (in) : Show statement arguments.
+ * arg_cnt (in)	   : Number of arguments.
+ * ptr (out)	   : Array context with one row for vacuum master and one row for each vacuum worker.
+ *
+ * NOTE: Backlog columns are filled only for vacuum master row. Worker index is NULL for vacuum master row.
+ */
+int
+vacuum_status_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  const int num_cols = 15;
+  VACUUM_WORKER *worker;
+  VACUUM_LOG_BLOCKID blockid;
+  INT64 job_start_msec, n_blocks_vacuumed;
+  int n_workers, helped_worker_index;
+  int i, idx;
+  DB_VALUE *vals = NULL;
+
+  *ptr = NULL;
+
+  n_workers = VOLATILE_ACCESS (vacuum_Assigned_workers_count, INT32);
+  ctx = showstmt_alloc_array_context (thread_p, n_workers + 1, num_cols);
+  if (ctx == NULL)
+    {
+      ASSERT_ERROR ();
+      return er_errid ();
+    }
+
+  /* First row is vacuum master. */
+  for (i = -1; i < n_workers; i++)
+    {
+      worker = (i < 0) ? &vacuum_Master : &vacuum_Workers[i];
+
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  ASSERT_ERROR ();
+	  showstmt_free_array_context (thread_p, ctx);
+	  return er_errid ();
+	}
+
+      idx = 0;
+
+      /* Worker_index */
+      if (i >= 0)
+	{
+	  db_make_int (&vals[idx], i);
+	}
+      else
+	{
+	  db_make_null (&vals[idx]);
+	}
+      idx++;
+
+      /* State */
+      db_make_string (&vals[idx], vacuum_worker_state_to_string (worker->state));
+      idx++;
+
+      /* Block_id */
+      blockid = worker->blockid;
+      if (blockid != VACUUM_NULL_LOG_BLOCKID)
+	{
+	  db_make_bigint (&vals[idx], blockid);
+	}
+      else
+	{
+	  db_make_null (&vals[idx]);
+	}
+      idx++;
+
+      /* Heap_pages */
+      db_make_int (&vals[idx], worker->n_heap_pages);
+      idx++;
+
+      /* Heap_pages_done */
+      db_make_int (&vals[idx], worker->n_heap_pages_done);
+      idx++;
+
+      /* Helped_worker_index */
+      helped_worker_index = worker->helped_worker_index;
+      if (helped_worker_index >= 0)
+	{
+	  db_make_int (&vals[idx], helped_worker_index);
+	}
+      else
+	{
+	  db_make_null (&vals[idx]);
+	}
+      idx++;
+
+      /* Job_elapsed_msecs */
+      job_start_msec = worker->job_start_msec;
+      if (job_start_msec != 0)
+	{
+	  db_make_bigint (&vals[idx], MAX (vacuum_get_clock_msec () - job_start_msec, 0));
+	}
+      else
+	{
+	  db_make_null (&vals[idx]);
+	}
+      idx++;
+
+      /* Blocks_vacuumed */
+      n_blocks_vacuumed = worker->n_blocks_vacuumed;
+      db_make_bigint (&vals[idx], n_blocks_vacuumed);
+      idx++;
+
+      /* Avg_block_msecs */
+      if (n_blocks_vacuumed > 0)
+	{
+	  db_make_double (&vals[idx], (double) worker->total_job_msec / n_blocks_vacuumed);
+	}
+      else
+	{
+	  db_make_null (&vals[idx]);
+	}
+      idx++;
+
+      if (i < 0)
+	{
+	  /* Backlog_blocks */
+	  db_make_bigint (&vals[idx], vacuum_get_backlog_blocks ());
+	  idx++;
+
+	  /* Backlog_log_pages */
+	  db_make_bigint (&vals[idx], vacuum_get_backlog_log_pages ());
+	  idx++;
+
+	  /* Oldest_unvacuumed_mvccid */
+	  db_make_bigint (&vals[idx], (DB_BIGINT) vacuum_Data.oldest_unvacuumed_mvccid);
+	  idx++;
+
+	  /* Oldest_unvacuumed_age_secs */
+	  db_make_bigint (&vals[idx], vacuum_get_oldest_unvacuumed_age ());
+	  idx++;
+
+	  /* Keep_from_log_pageid */
+	  db_make_bigint (&vals[idx], vacuum_min_log_pageid_to_keep (thread_p));
+	  idx++;
+
+	  /* Retained_log_pages */
+	  db_make_bigint (&vals[idx], vacuum_get_retained_log_pages ());
+	  idx++;
+	}
+      else
+	{
+	  for (; idx < num_cols; idx++)
+	    {
+	      db_make_null (&vals[idx]);
+	    }
+	}
+
+      assert (idx == num_cols);
+    }
+
+  *ptr = ctx;
+  return NO_ERROR;
+}
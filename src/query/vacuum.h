@@ -149,6 +149,17 @@ struct vacuum_worker
 #if defined (SERVER_MODE)
   char *prefetch_log_buffer;	/* buffer for prefetching log pages */
 #endif				/* SERVER_MODE */
+
+  /* Progress of current job. */
+  VACUUM_LOG_BLOCKID blockid;	/* Log block being vacuumed or VACUUM_NULL_LOG_BLOCKID. */
+  INT32 n_heap_pages;		/* Number of heap pages to vacuum for current block. */
+  volatile INT32 n_heap_pages_done;	/* Number of heap pages vacuumed, including the pages of helpers. */
+  INT32 helped_worker_index;	/* Index of worker whose heap pages are vacuumed by this worker or -1. */
+  INT64 job_start_msec;		/* Time when current job was started or 0 if worker is idle. */
+
+  /* Throughput of worker. */
+  INT64 n_blocks_vacuumed;	/* Number of log blocks completely vacuumed by this worker. */
+  INT64 total_job_msec;		/* Time spent on the log blocks completely vacuumed by this worker. */
 };
 
 #define VACUUM_MAX_WORKER_COUNT	  50
@@ -291,6 +302,10 @@ extern void vacuum_produce_log_block_data (THREAD_ENTRY * thread_p, LOG_LSA * st
 					   MVCCID newest_mvccid);
 extern int vacuum_consume_buffer_log_blocks (THREAD_ENTRY * thread_p);
 extern LOG_PAGEID vacuum_min_log_pageid_to_keep (THREAD_ENTRY * thread_p);
+extern INT64 vacuum_get_backlog_blocks (void);
+extern INT64 vacuum_get_backlog_log_pages (void);
+extern INT64 vacuum_get_oldest_unvacuumed_age (void);
+extern INT64 vacuum_get_retained_log_pages (void);
 extern void vacuum_notify_server_crashed (LOG_LSA * recovery_lsa);
 extern void vacuum_notify_server_shutdown (void);
 extern int vacuum_rv_redo_vacuum_complete (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
@@ -334,6 +349,8 @@ extern DISK_ISVALID vacuum_check_not_vacuumed_recdes (THREAD_ENTRY * thread_p, O
 extern DISK_ISVALID vacuum_check_not_vacuumed_rec_header (THREAD_ENTRY * thread_p, OID * oid, OID * class_oid,
 							  MVCC_REC_HEADER * rec_header, int btree_node_type);
 extern bool vacuum_is_mvccid_vacuumed (MVCCID id);
+extern int vacuum_status_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+				     void **ptr);
 extern int vacuum_rv_check_at_undo (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, INT16 slotid, INT16 rec_type);
 
 #endif /* _VACUUM_H_ */
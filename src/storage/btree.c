@@ -63,6 +63,9 @@
 
 #include "fault_injection.h"
 #include "perf_monitor.h"
+#if defined (SERVER_MODE)
+#include "job_queue.h"
+#endif /* SERVER_MODE */
 
 /* this must be the last header file included!!! */
 #include "dbval.h"
@@ -84,6 +87,9 @@
 #define BTREE_SPLIT_MAX_PIVOT (1.0f - BTREE_SPLIT_MIN_PIVOT)
 
 #define BTREE_SPLIT_DEFAULT_PIVOT 0.5f
+
+/* Number of slots on each side of the leaf split point searched for a shorter separator key. */
+#define BTREE_SPLIT_SEPARATOR_INTERVAL 8
 #define DISK_PAGE_BITS  (DB_PAGESIZE * CHAR_BIT)	/* Num of bits per page */
 #define RESERVED_SIZE_IN_PAGE   sizeof(FILEIO_PAGE_RESERVED)
 
@@ -106,6 +112,9 @@
 #define FORCE_MERGE_WHEN_EMPTY \
   (MAX (DB_PAGESIZE * 0.66, MAX_MERGE_ALIGN_WASTE * 1.3))
 
+/* Maximum number of leaves read ahead at once for a range scan. */
+#define BTREE_PREFETCH_MAX_LEAVES 128
+
 /*
  * Page header information related defines
  */
@@ -419,6 +428,20 @@ struct show_index_scan_ctx
   int show_type;		/* Show type */
 };
 
+#if defined (SERVER_MODE)
+/* BTREE_PREFETCH_JOB -
+ * Leaves read ahead by one worker job on behalf of a range scan. It is allocated from the global heap by the scanning
+ * thread and freed by the worker job. The job keeps no reference to the scan, its transaction or its connection, so
+ * it may safely outlive all of them.
+ */
+typedef struct btree_prefetch_job BTREE_PREFETCH_JOB;
+struct btree_prefetch_job
+{
+  int count;			/* Number of leaves. */
+  VPID *vpids;			/* Leaves to read. */
+};
+#endif /* SERVER_MODE */
+
 /* BTREE_SEARCH_KEY_HELPER -
  * Structure usually used to return the result of search key functions.
  */
@@ -1307,6 +1330,11 @@ static DB_VALUE *btree_find_split_point (THREAD_ENTRY * thread_p, BTID_INT * bti
 					 DB_VALUE * key, BTREE_INSERT_HELPER * helper, bool * clear_midkey);
 static int btree_split_next_pivot (BTREE_NODE_SPLIT_INFO * split_info, float new_value, int max_index);
 static int btree_split_find_pivot (int total, BTREE_NODE_SPLIT_INFO * split_info);
+static int btree_split_separator_size (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int left_slot,
+				       int *sep_size);
+static int btree_split_find_shortest_separator (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr,
+						int *mid_slot, int lo, int hi, int left_size, int left_min_size,
+						int left_max_size);
 static int btree_split_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR Q, PAGE_PTR R,
 			     VPID * P_vpid, VPID * Q_vpid, VPID * R_vpid, INT16 p_slot_id, BTREE_NODE_TYPE node_type,
 			     DB_VALUE * key, BTREE_INSERT_HELPER * helper, VPID * child_vpid);
@@ -1498,6 +1526,8 @@ static int btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID *
 static int btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
 				    PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
 				    bool * stop, bool * restart, void *other_args);
+static int btree_fix_leaf_optimistic (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+				      PAGE_PTR * leaf_page);
 static int btree_advance_and_find_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 				       PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 				       BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
@@ -1535,6 +1565,10 @@ static int btree_range_scan_read_record (THREAD_ENTRY * thread_p, BTREE_SCAN * b
 static int btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_range_scan_descending_fix_prev_leaf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, int *key_count,
 						      BTREE_NODE_HEADER ** node_header_ptr, VPID * next_vpid);
+#if defined (SERVER_MODE)
+static void btree_range_scan_prefetch_leaves (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
+static int btree_prefetch_execute (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+#endif /* SERVER_MODE */
 static int btree_range_scan_start (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_range_scan_resume (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_range_scan_count_oids_leaf_and_one_ovf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
@@ -11962,6 +11996,45 @@ btree_find_split_point (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
   /* Right node will have at least one non-fence record. */
   assert (*mid_slot < stop_at || (*mid_slot == stop_at && node_type == BTREE_LEAF_NODE && !is_key_added_to_left));
 
+  /* Suffix truncation: the separator moved to the parent is the shortest prefix between the last key of left leaf and
+   * the first key of right leaf. Long string and multi-column keys can give much shorter separators a few slots away
+   * from the size based split point, so look around it for the shortest one. The new key must stay on the same side
+   * and must not become a neighbor of the split point. */
+  if (node_type == BTREE_LEAF_NODE && *mid_slot >= start_with && *mid_slot < stop_at
+      && (TP_DOMAIN_TYPE (btid->key_type) == DB_TYPE_MIDXKEY || pr_is_string_type (TP_DOMAIN_TYPE (btid->key_type))))
+    {
+      int lo = MAX (start_with, *mid_slot - BTREE_SPLIT_SEPARATOR_INTERVAL);
+      int hi = MIN (stop_at - 1, *mid_slot + BTREE_SPLIT_SEPARATOR_INTERVAL);
+
+      if (is_key_added_to_left)
+	{
+	  lo = MAX (lo, slot_id);
+	}
+      else
+	{
+	  hi = MIN (hi, found ? slot_id - 1 : slot_id - 2);
+	}
+
+      if (lo < hi && lo <= *mid_slot && *mid_slot <= hi)
+	{
+	  /* Compute left size of current split point. */
+	  for (i = start_with, left_size = 0; i <= *mid_slot; i++)
+	    {
+	      left_size += spage_get_space_for_record (thread_p, page_ptr, i);
+	    }
+	  if (is_key_added_to_left)
+	    {
+	      left_size += new_ent_size;
+	    }
+
+	  if (btree_split_find_shortest_separator (thread_p, btid, page_ptr, mid_slot, lo, hi, left_size, left_min_size,
+						   left_max_size) != NO_ERROR)
+	    {
+	      goto error;
+	    }
+	}
+    }
+
   /* TODO: Optimize memory usage. We don't need to allocated/deallocate all DB_VALUE types and their content in all
    * cases. */
   mid_key = (DB_VALUE *) db_private_alloc (thread_p, sizeof (DB_VALUE));
@@ -12160,6 +12233,170 @@ btree_split_find_pivot (int total, BTREE_NODE_SPLIT_INFO * split_info)
   return split_point;
 }
 
+/*
+ * btree_split_separator_size () - Get the size of the separator key between two adjacent leaf records.
+ *
+ * return      : Error code.
+ * thread_p (in)   : Thread entry.
+ * btid (in)       : B-tree info.
+ * page_ptr (in)   : Leaf page.
+ * left_slot (in)  : Slot of left record. The right record is the next slot.
+ * sep_size (out)  : Disk size of separator key or -1 if separator cannot be truncated.
+ */
+static int
+btree_split_separator_size (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int left_slot,
+			    int *sep_size)
+{
+  RECDES rec;
+  LEAF_REC leaf_pnt;
+  DB_VALUE left_key, right_key, sep_key;
+  bool left_clear_key = false, right_clear_key = false;
+  int offset;
+  int error_code = NO_ERROR;
+
+  *sep_size = -1;
+  db_make_null (&left_key);
+  db_make_null (&right_key);
+  db_make_null (&sep_key);
+
+  if (spage_get_record (thread_p, page_ptr, left_slot, &rec, PEEK) != S_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  if (btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+    {
+      /* Overflow keys are never truncated. */
+      return NO_ERROR;
+    }
+  error_code = btree_read_record (thread_p, btid, page_ptr, &rec, &left_key, &leaf_pnt, BTREE_LEAF_NODE,
+				  &left_clear_key, &offset, PEEK_KEY_VALUE, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  if (spage_get_record (thread_p, page_ptr, left_slot + 1, &rec, PEEK) != S_SUCCESS)
+    {
+      assert_release (false);
+      error_code = ER_FAILED;
+      goto exit;
+    }
+  if (btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+    {
+      goto exit;
+    }
+  error_code = btree_read_record (thread_p, btid, page_ptr, &rec, &right_key, &leaf_pnt, BTREE_LEAF_NODE,
+				  &right_clear_key, &offset, PEEK_KEY_VALUE, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  if (btree_get_disk_size_of_key (&left_key) >= BTREE_MAX_KEYLEN_INPAGE
+      || btree_get_disk_size_of_key (&right_key) >= BTREE_MAX_KEYLEN_INPAGE)
+    {
+      /* Same as btree_find_split_point, the separator would be the right key itself. */
+      goto exit;
+    }
+
+  error_code = btree_get_prefix_separator (&left_key, &right_key, &sep_key, btid->key_type);
+  if (error_code != NO_ERROR)
+    {
+      goto exit;
+    }
+  *sep_size = btree_get_disk_size_of_key (&sep_key);
+  pr_clear_value (&sep_key);
+
+exit:
+  btree_clear_key_value (&left_clear_key, &left_key);
+  btree_clear_key_value (&right_clear_key, &right_key);
+  return error_code;
+}
+
+/*
+ * btree_split_find_shortest_separator () - Move leaf split point inside [lo, hi] interval to the slot that gives the
+ *					    shortest separator key, as long as both leaves keep a valid size.
+ *
+ * return	      : Error code.
+ * thread_p (in)      : Thread entry.
+ * btid (in)	      : B-tree info.
+ * page_ptr (in)      : Leaf page being split.
+ * mid_slot (in/out)  : Last slot of left leaf.
+ * lo (in)	      : Lowest candidate for last slot of left leaf.
+ * hi (in)	      : Highest candidate for last slot of left leaf.
+ * left_size (in)     : Size of left leaf records for current mid_slot.
+ * left_min_size (in) : Minimum size of left leaf records.
+ * left_max_size (in) : Maximum size of left leaf records.
+ */
+static int
+btree_split_find_shortest_separator (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int *mid_slot,
+				     int lo, int hi, int left_size, int left_min_size, int left_max_size)
+{
+  int best_slot = *mid_slot;
+  int best_size;
+  int sep_size;
+  int cand_size;
+  int slot;
+  int error_code;
+
+  error_code = btree_split_separator_size (thread_p, btid, page_ptr, *mid_slot, &best_size);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+  if (best_size < 0)
+    {
+      best_size = INT_MAX;
+    }
+
+  /* Search candidates in order of distance from current split point, so that ties keep the more balanced split. */
+  for (slot = *mid_slot - 1, cand_size = left_size; slot >= lo; slot--)
+    {
+      cand_size -= spage_get_space_for_record (thread_p, page_ptr, slot + 1);
+      if (cand_size < left_min_size)
+	{
+	  break;
+	}
+      error_code = btree_split_separator_size (thread_p, btid, page_ptr, slot, &sep_size);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+      if (sep_size >= 0 && sep_size < best_size)
+	{
+	  best_size = sep_size;
+	  best_slot = slot;
+	}
+    }
+
+  for (slot = *mid_slot + 1, cand_size = left_size; slot <= hi; slot++)
+    {
+      cand_size += spage_get_space_for_record (thread_p, page_ptr, slot);
+      if (cand_size > left_max_size)
+	{
+	  break;
+	}
+      error_code = btree_split_separator_size (thread_p, btid, page_ptr, slot, &sep_size);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+      if (sep_size >= 0
+	  && (sep_size < best_size
+	      || (sep_size == best_size && best_slot < *mid_slot && slot - *mid_slot < *mid_slot - best_slot)))
+	{
+	  best_size = sep_size;
+	  best_slot = slot;
+	}
+    }
+
+  *mid_slot = best_slot;
+  return NO_ERROR;
+}
+
 /*
  * btree_split_next_pivot () -
  *   return:
@@ -22288,6 +22525,29 @@ start_btree_traversal:
       pgbuf_unfix_and_init (thread_p, crt_page);
     }
 
+  if ((root_function == NULL || root_function == btree_get_root_with_key)
+      && advance_function == btree_advance_and_find_key)
+    {
+      /* Read-only traversal. Try to reach the leaf without latching the upper nodes. */
+      error_code = btree_fix_leaf_optimistic (thread_p, btid, btid_int, key, &crt_page);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
+      if (crt_page != NULL)
+	{
+	  is_leaf = true;
+	  error_code = btree_search_leaf_page (thread_p, btid_int, crt_page, key, search_key);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto error;
+	    }
+	  goto leaf_reached;
+	}
+    }
+
   /* Fix b-tree root page. */
   if (root_function == NULL)
     {
@@ -22358,6 +22618,7 @@ start_btree_traversal:
 	}
     }
 
+leaf_reached:
   /* Leaf page is reached. */
 
   assert (is_leaf && !stop && !restart);
@@ -22480,6 +22741,141 @@ btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_i
   return NO_ERROR;
 }
 
+/*
+ * btree_fix_leaf_optimistic () - Fix the leaf node where key belongs without latching the non-leaf nodes on its path.
+ *
+ * return	    : Error code.
+ * thread_p (in)    : Thread entry.
+ * btid (in)	    : B-tree identifier.
+ * btid_int (out)   : B-tree data.
+ * key (in)	    : Search key value.
+ * leaf_page (out)  : Leaf page fixed with read latch or NULL if optimistic descent failed.
+ *
+ * Note: Non-leaf nodes are read from copies made by pgbuf_copy_page_optimistic. Each copy is validated after the next
+ *	 node is read, which makes sure the path did not change in the meantime (changing a child requires write latch
+ *	 on its parent). Only the leaf is fixed and latched. When a node cannot be copied or validation fails, leaf_page
+ *	 is NULL and caller should do the regular descent.
+ */
+static int
+btree_fix_leaf_optimistic (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+			   PAGE_PTR * leaf_page)
+{
+  PGBUF_PAGE_COPY page_copy;
+  PGBUF_PAGE_VERSION parent_version;
+  PAGE_PTR page = NULL;
+  BTREE_ROOT_HEADER *root_header = NULL;
+  BTREE_NODE_HEADER *node_header = NULL;
+  VPID vpid;
+  INT16 slotid;
+  int node_level;
+  int error_code = NO_ERROR;
+
+  assert (btid != NULL);
+  assert (btid_int != NULL);
+  assert (key != NULL);
+  assert (leaf_page != NULL && *leaf_page == NULL);
+
+  vpid.pageid = btid->root_pageid;
+  vpid.volid = btid->vfid.volid;
+
+  page = pgbuf_copy_page_optimistic (thread_p, &vpid, &page_copy);
+  if (page == NULL)
+    {
+      /* Root is not in buffer or it is being modified. */
+      return NO_ERROR;
+    }
+  root_header = btree_get_root_header (thread_p, page);
+  if (root_header == NULL)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  node_level = root_header->node.node_level;
+  if (node_level == 1)
+    {
+      /* Root is leaf. It must be fixed anyway. */
+      return NO_ERROR;
+    }
+
+  btid_int->sys_btid = btid;
+  error_code = btree_glean_root_header_info (thread_p, root_header, btid_int);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (DB_VALUE_TYPE (key) == DB_TYPE_MIDXKEY && key->data.midxkey.domain == NULL)
+    {
+      /* Use domain from b-tree info. */
+      key->data.midxkey.domain = btid_int->key_type;
+    }
+
+  while (true)
+    {
+      assert (node_level > 1);
+
+      error_code = btree_search_nonleaf_page (thread_p, btid_int, page, key, &slotid, &vpid);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      assert (!VPID_ISNULL (&vpid));
+      parent_version = page_copy.version;
+
+      if (node_level == 2)
+	{
+	  /* Child is leaf. */
+	  break;
+	}
+
+      page = pgbuf_copy_page_optimistic (thread_p, &vpid, &page_copy);
+      if (page == NULL || !pgbuf_is_page_version_valid (&parent_version))
+	{
+	  goto retry;
+	}
+      node_header = btree_get_node_header (thread_p, page);
+      if (node_header == NULL || node_header->node_level != node_level - 1)
+	{
+	  /* Cannot happen if parent did not change. */
+	  assert_release (false);
+	  return ER_FAILED;
+	}
+      node_level = node_header->node_level;
+    }
+
+  *leaf_page = pgbuf_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (*leaf_page == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      if (error_code != ER_PB_BAD_PAGEID)
+	{
+	  return error_code;
+	}
+      /* Leaf was deallocated after parent was read. */
+      er_clear ();
+      error_code = NO_ERROR;
+      goto retry;
+    }
+  if (!pgbuf_is_page_version_valid (&parent_version))
+    {
+      /* Leaf may have been split, merged or deallocated after parent was read. */
+      pgbuf_unfix_and_init (thread_p, *leaf_page);
+      goto retry;
+    }
+
+  assert (btree_get_node_header (thread_p, *leaf_page) != NULL
+	  && btree_get_node_header (thread_p, *leaf_page)->node_level == 1);
+  perfmon_inc_stat (thread_p, PSTAT_BT_NUM_OPTIMISTIC_DESCENTS);
+  return NO_ERROR;
+
+retry:
+  /* Caller must do the regular descent. */
+  assert (*leaf_page == NULL);
+  perfmon_inc_stat (thread_p, PSTAT_BT_NUM_OPTIMISTIC_DESCENT_RETRIES);
+  return NO_ERROR;
+}
+
 /*
  * btree_advance_and_find_key () - Fix next node in b-tree following given key.
  *				   If argument is leaf-node, return if key is found and the slot if key instead.
@@ -24346,6 +24742,13 @@ btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN
 	      /* Ascending scan: start from first key in page and then advance to next page. */
 	      bts->slot_id = 1;
 	      next_vpid = node_header->next_vpid;
+#if defined (SERVER_MODE)
+	      if (VPID_ISNULL (&bts->prefetch_vpid) || VPID_EQ (&bts->prefetch_vpid, &bts->C_vpid))
+		{
+		  /* Range spans several leaves and the leaves read ahead so far are consumed. */
+		  btree_range_scan_prefetch_leaves (thread_p, bts);
+		}
+#endif /* SERVER_MODE */
 	    }
 	}
 
@@ -24413,6 +24816,219 @@ btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN
   return ER_FAILED;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * btree_range_scan_prefetch_leaves () - Have worker threads read ahead the next leaves of an ascending range scan.
+ *
+ * return	  : Void.
+ * thread_p (in)  : Thread entry.
+ * bts (in/out)	  : B-tree scan helper.
+ *
+ * NOTE: The leaves are not linked above leaf level, so the leaves following current key are found in its parent node.
+ *	 The parent is reached by looking up current key from root and its child pointers after current key are
+ *	 collected up to the first separator key beyond the upper limit of the range. These sub-ranges of the scan
+ *	 are split between index_scan_prefetch_workers worker jobs, which fix and unfix the leaves while current
+ *	 thread is processing keys, so that the leaves are already in page buffer when the scan reaches them.
+ *
+ *	 Current leaf is kept latched while looking up the parent, therefore all other pages are latched
+ *	 conditionally. Read-ahead is only an optimization and it is silently skipped on any failure.
+ *
+ *	 The jobs are not waited for: they run as the system transaction and only fix and unfix pages, so they do not
+ *	 depend on the scan, which may end before them.
+ */
+static void
+btree_range_scan_prefetch_leaves (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
+{
+  VPID vpids[BTREE_PREFETCH_MAX_LEAVES];
+  VPID vpid, child_vpid;
+  PAGE_PTR page = NULL, child_page = NULL;
+  BTREE_NODE_HEADER *node_header = NULL;
+  NON_LEAF_REC non_leaf_rec;
+  RECDES rec;
+  DB_VALUE sep_key;
+  bool clear_key = false;
+  INT16 slot_id;
+  int key_count, offset, count = 0, c;
+  int num_workers, worker, from, to, i;
+  BTREE_PREFETCH_JOB *job = NULL;
+  CSS_CONN_ENTRY *conn_p = NULL;
+  CSS_JOB_ENTRY *job_entry_p = NULL;
+  int conn_index;
+  size_t size;
+
+  num_workers = prm_get_integer_value (PRM_ID_INDEX_SCAN_PREFETCH_WORKERS);
+  if (num_workers <= 0 || bts->use_desc_index || DB_IS_NULL (&bts->cur_key))
+    {
+      return;
+    }
+
+  /* Do not try again before next leaf. */
+  VPID_COPY (&bts->prefetch_vpid, &bts->C_vpid);
+
+  /* Look up parent of the leaf holding current key. */
+  vpid.volid = bts->btid_int.sys_btid->vfid.volid;
+  vpid.pageid = bts->btid_int.sys_btid->root_pageid;
+  page = pgbuf_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+  while (true)
+    {
+      if (page == NULL)
+	{
+	  return;
+	}
+      node_header = btree_get_node_header (thread_p, page);
+      if (node_header == NULL || node_header->node_level < 2
+	  || btree_search_nonleaf_page (thread_p, &bts->btid_int, page, &bts->cur_key, &slot_id, &child_vpid) != NO_ERROR)
+	{
+	  pgbuf_unfix_and_init (thread_p, page);
+	  return;
+	}
+      if (node_header->node_level == 2)
+	{
+	  /* Found parent. */
+	  break;
+	}
+      child_page = pgbuf_fix (thread_p, &child_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+      pgbuf_unfix (thread_p, page);
+      page = child_page;
+    }
+
+  /* Collect leaves after the one of current key. */
+  key_count = btree_node_number_of_keys (thread_p, page);
+  for (slot_id++; slot_id <= key_count && count < BTREE_PREFETCH_MAX_LEAVES; slot_id++)
+    {
+      if (spage_get_record (thread_p, page, slot_id, &rec, PEEK) != S_SUCCESS)
+	{
+	  break;
+	}
+
+      if (bts->key_range.upper_key != NULL)
+	{
+	  /* Child holds keys starting with separator key. Stop when it is beyond range. */
+	  if (btree_read_record_without_decompression (thread_p, &bts->btid_int, &rec, &sep_key, &non_leaf_rec,
+						       BTREE_NON_LEAF_NODE, &clear_key, &offset,
+						       PEEK_KEY_VALUE) != NO_ERROR)
+	    {
+	      break;
+	    }
+	  c = btree_compare_key (bts->key_range.upper_key, &sep_key, bts->btid_int.key_type, 1, 1, NULL);
+	  btree_clear_key_value (&clear_key, &sep_key);
+	  if (c == DB_UNK || c < 0)
+	    {
+	      break;
+	    }
+	}
+      else
+	{
+	  btree_read_fixed_portion_of_non_leaf_record (&rec, &non_leaf_rec);
+	}
+
+      if (!VPID_EQ (&non_leaf_rec.pnt, &bts->C_vpid))
+	{
+	  VPID_COPY (&vpids[count], &non_leaf_rec.pnt);
+	  count++;
+	}
+    }
+  pgbuf_unfix_and_init (thread_p, page);
+
+  /* Errors of read-ahead are not reported. */
+  er_clear ();
+
+  if (count == 0)
+    {
+      return;
+    }
+  VPID_COPY (&bts->prefetch_vpid, &vpids[count - 1]);
+
+  conn_p = thread_get_current_conn_entry ();
+  conn_index = (conn_p) ? conn_p->idx : 0;
+
+  /* Split leaves in consecutive sub-ranges, one for each worker. */
+  num_workers = MIN (num_workers, count);
+  for (worker = 0; worker < num_workers; worker++)
+    {
+      from = (count * worker) / num_workers;
+      to = (count * (worker + 1)) / num_workers;
+
+      size = sizeof (BTREE_PREFETCH_JOB) + (to - from) * sizeof (VPID);
+      job = (BTREE_PREFETCH_JOB *) malloc (size);
+      if (job == NULL)
+	{
+	  break;
+	}
+      job->count = to - from;
+      job->vpids = (VPID *) (job + 1);
+      for (i = from; i < to; i++)
+	{
+	  VPID_COPY (&job->vpids[i - from], &vpids[i]);
+	}
+
+      /* Spread the jobs over the job queues. The job is not tied to the connection, which may be closed before it
+       * runs. */
+      job_entry_p =
+	css_make_job_entry (NULL, (CSS_THREAD_FN) btree_prefetch_execute, (CSS_THREAD_ARG) job,
+			    conn_index + worker + 1);
+      if (job_entry_p == NULL)
+	{
+	  free_and_init (job);
+	  er_clear ();
+	  break;
+	}
+      css_add_to_job_queue (job_entry_p);
+    }
+}
+
+/*
+ * btree_prefetch_execute () - Worker job reading ahead b-tree leaves.
+ *
+ * return	  : NO_ERROR.
+ * thread_p (in)  : Worker thread entry.
+ * arg (in)	  : Read-ahead job.
+ */
+static int
+btree_prefetch_execute (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  BTREE_PREFETCH_JOB *job = (BTREE_PREFETCH_JOB *) arg;
+  PAGE_PTR page = NULL;
+  bool old_check_interrupt;
+  int num_pages = 0;
+  int i;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  /* The scanning transaction may be over by now; the leaves are only read into page buffer. */
+  thread_p->tran_index = LOG_SYSTEM_TRAN_INDEX;
+  pthread_mutex_unlock (&thread_p->tran_index_lock);
+
+  old_check_interrupt = thread_set_check_interrupt (thread_p, false);
+
+  for (i = 0; i < job->count; i++)
+    {
+      /* Nothing protects the leaves from being merged and deallocated meanwhile. */
+      if (pgbuf_fix_if_not_deallocated (thread_p, &job->vpids[i], PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH, &page)
+	  != NO_ERROR || page == NULL)
+	{
+	  break;
+	}
+      pgbuf_unfix_and_init (thread_p, page);
+      num_pages++;
+    }
+
+  perfmon_add_stat (thread_p, PSTAT_BT_NUM_PREFETCH_LEAVES, num_pages);
+
+  (void) thread_set_check_interrupt (thread_p, old_check_interrupt);
+
+  free_and_init (job);
+
+  /* Errors of read-ahead are not reported. */
+  er_clear ();
+
+  return NO_ERROR;
+}
+#endif /* SERVER_MODE */
+
 /*
  * btree_range_scan_descending_fix_prev_leaf () - Fix previous leaf node without generating cross latches with regular
  * 						  scans and by trying to avoid a key lookup from root.
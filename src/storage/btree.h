@@ -239,6 +239,8 @@ struct btree_scan
   bool is_scan_started;
   bool force_restart_from_root;
 
+  VPID prefetch_vpid;		/* last leaf read ahead by worker threads */
+
   PERF_UTIME_TRACKER time_track;
 
   void *bts_other;
@@ -287,6 +289,7 @@ struct btree_scan
     (bts)->index_scan_idp = NULL;			\
     (bts)->is_scan_started = false;			\
     (bts)->force_restart_from_root = false;		\
+    VPID_SET_NULL (&(bts)->prefetch_vpid);		\
     OID_SET_NULL (&(bts)->match_class_oid);		\
     (bts)->time_track.is_perf_tracking = false;		\
     (bts)->bts_other = NULL;				\
@@ -308,6 +311,7 @@ struct btree_scan
     DB_MAKE_NULL (&(bts)->cur_key);			\
     (bts)->clear_cur_key = false;			\
     (bts)->is_scan_started = false;			\
+    VPID_SET_NULL (&(bts)->prefetch_vpid);		\
   } while (0)
 
 #define BTREE_END_OF_SCAN(bts) \
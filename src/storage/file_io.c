@@ -195,6 +195,20 @@
 /* Get the backup page primary pageid */
 #define FILEIO_GET_BACKUP_PAGE_ID(area)  (((FILEIO_BACKUP_PAGE *)(area))->iopageid)
 
+/* compressed data pages: the page header stays as is and is followed by the length of the compressed user area and by
+ * the compressed user area. only the file system blocks holding them are written; the rest of the page slot keeps
+ * its old content and its disk space. */
+#define FILEIO_PAGE_ZIP_BLOCK_SIZE          4096
+#define FILEIO_PAGE_ZIP_HEADER_SIZE         (sizeof (FILEIO_PAGE_RESERVED) + sizeof (INT32))
+#define FILEIO_PAGE_ZIP_BUFFER_SIZE(psize) \
+  DB_ALIGN (FILEIO_PAGE_ZIP_HEADER_SIZE + (psize) + (psize) / 16 + 64 + 3, MAX_ALIGNMENT)
+/* compression buffer followed by LZO work memory; allocated once per thread */
+#define FILEIO_PAGE_ZIP_AREA_SIZE \
+  (FILEIO_PAGE_ZIP_BUFFER_SIZE (IO_PAGESIZE) + LZO1X_1_MEM_COMPRESS)
+
+/* maximum number of pages written by one vectored write */
+#define FILEIO_MAX_IOV_PAGES                64
+
 /*
  * Verify the integrity of the page just read by checking the redundant
  * copy of the pageid.  Remember that the ->iopageid_copy cannot be accessed
@@ -421,6 +435,10 @@ static pthread_mutex_t fileio_Flushed_page_counter_mutex = PTHREAD_MUTEX_INITIAL
 #endif
 static int fileio_Flushed_page_count = 0;
 
+#if !defined (SERVER_MODE)
+static char *fileio_Page_zip_area = NULL;
+#endif /* !SERVER_MODE */
+
 static TOKEN_BUCKET fc_Token_bucket_s;
 static TOKEN_BUCKET *fc_Token_bucket = NULL;
 static FLUSH_STATS fc_Stats;
@@ -544,6 +562,13 @@ static FILEIO_NODE *fileio_append_queue (FILEIO_QUEUE * qp, FILEIO_NODE * node);
 #endif /* SERVER_MODE */
 
 static void fileio_compensate_flush (THREAD_ENTRY * thread_p, int fd, int npage);
+static bool fileio_is_compressible_page (const FILEIO_PAGE * io_page_p);
+static char *fileio_get_page_zip_area (THREAD_ENTRY * thread_p);
+static int fileio_decompress_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, size_t page_size);
+#if !defined (WINDOWS)
+static int fileio_read_page_blocks (int vol_fd, char *buf_p, PAGEID page_id, off_t offset, size_t size);
+#endif /* !WINDOWS */
+static int fileio_compare_write_requests (const void *p1, const void *p2);
 static int fileio_increase_flushed_page_count (int npages);
 static int fileio_flush_control_get_token (THREAD_ENTRY * thread_p, int ntoken);
 static int fileio_flush_control_get_desired_rate (TOKEN_BUCKET * tb);
@@ -3883,6 +3908,324 @@ fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_
   return io_page_p;
 }
 
+/*
+ * fileio_is_compressible_page () - is page compressed when written to disk?
+ *   return: true if data_page_compression is on and page is a heap, overflow or b-tree page
+ *   io_page_p(in): page
+ */
+static bool
+fileio_is_compressible_page (const FILEIO_PAGE * io_page_p)
+{
+  if (!prm_get_bool_value (PRM_ID_DATA_PAGE_COMPRESSION))
+    {
+      return false;
+    }
+
+  switch (io_page_p->prv.ptype)
+    {
+    case PAGE_HEAP:
+    case PAGE_OVERFLOW:
+    case PAGE_BTREE:
+    case PAGE_HEAP_FREESPACE:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * fileio_get_page_zip_area () - get the area used to compress and decompress data pages
+ *   return: area of FILEIO_PAGE_ZIP_AREA_SIZE bytes, or NULL if it cannot be allocated
+ *
+ * Note: The area is allocated on first use and kept by the thread entry (by the process in stand-alone mode), so
+ *       flushing pages does not allocate memory.
+ */
+static char *
+fileio_get_page_zip_area (THREAD_ENTRY * thread_p)
+{
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (thread_p == NULL)
+    {
+      return NULL;
+    }
+
+  if (thread_p->page_zip_area == NULL)
+    {
+      thread_p->page_zip_area = (char *) malloc (FILEIO_PAGE_ZIP_AREA_SIZE);
+    }
+  return thread_p->page_zip_area;
+#else /* SERVER_MODE */
+  if (fileio_Page_zip_area == NULL)
+    {
+      fileio_Page_zip_area = (char *) malloc (FILEIO_PAGE_ZIP_AREA_SIZE);
+    }
+  return fileio_Page_zip_area;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * fileio_write_data_page () - WRITE A DATA VOLUME PAGE TO DISK, COMPRESSED IF WORTH IT
+ *   return: io_page_p on success, NULL on failure
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(in): In-memory address where the current content of page resides. It is not modified.
+ *   page_id(in): Page identifier
+ *   page_size(in): Page size
+ *
+ * Note: When data_page_compression is on, the user area of heap, overflow and b-tree pages is compressed with
+ *       LZO1X-1. Only the file system blocks holding the compressed image are written, and fileio_read_data_page
+ *       reads back only those blocks. The page keeps its place and its disk space in the volume, so no page map is
+ *       needed and a preallocated volume never runs out of space on a later flush. The page is decompressed before
+ *       it gets into the page buffer. Pages that do not save at least one block are written as usual.
+ */
+void *
+fileio_write_data_page (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * io_page_p, PAGEID page_id,
+			size_t page_size)
+{
+  size_t user_size = page_size - sizeof (FILEIO_PAGE_RESERVED);
+  size_t write_size;
+  char *zip_area;
+  FILEIO_PAGE *zip_page_p;
+  lzo_bytep wrkmem;
+  lzo_uint zip_len;
+  INT32 zip_len_on_disk;
+#if !defined (WINDOWS)
+  off_t offset = FILEIO_GET_FILE_SIZE (page_size, page_id);
+  ssize_t nbytes;
+#endif /* !WINDOWS */
+
+  if (!fileio_is_compressible_page (io_page_p) || page_size > (size_t) IO_PAGESIZE)
+    {
+      return fileio_write (thread_p, vol_fd, io_page_p, page_id, page_size);
+    }
+
+  zip_area = fileio_get_page_zip_area (thread_p);
+  if (zip_area == NULL)
+    {
+      /* compression is an optimization; write the page as it is */
+      return fileio_write (thread_p, vol_fd, io_page_p, page_id, page_size);
+    }
+  zip_page_p = (FILEIO_PAGE *) zip_area;
+  wrkmem = (lzo_bytep) (zip_area + FILEIO_PAGE_ZIP_BUFFER_SIZE (IO_PAGESIZE));
+
+  if (lzo1x_1_compress ((lzo_bytep) io_page_p->page, (lzo_uint) user_size,
+			(lzo_bytep) zip_page_p->page + sizeof (INT32), &zip_len, wrkmem) != LZO_E_OK)
+    {
+      return fileio_write (thread_p, vol_fd, io_page_p, page_id, page_size);
+    }
+
+  write_size = DB_ALIGN (FILEIO_PAGE_ZIP_HEADER_SIZE + zip_len, FILEIO_PAGE_ZIP_BLOCK_SIZE);
+  if (write_size >= page_size)
+    {
+      /* does not save anything */
+      return fileio_write (thread_p, vol_fd, io_page_p, page_id, page_size);
+    }
+
+  zip_page_p->prv = io_page_p->prv;
+  zip_page_p->prv.pflag |= FILEIO_PAGE_FLAG_COMPRESSED;
+  zip_len_on_disk = (INT32) zip_len;
+  memcpy (zip_page_p->page, &zip_len_on_disk, sizeof (INT32));
+  memset (zip_area + FILEIO_PAGE_ZIP_HEADER_SIZE + zip_len, 0, write_size - FILEIO_PAGE_ZIP_HEADER_SIZE - zip_len);
+
+#if !defined (WINDOWS)
+  do
+    {
+      nbytes = pwrite (vol_fd, zip_area, write_size, offset);
+    }
+  while (nbytes < 0 && errno == EINTR);
+
+  if (nbytes != (ssize_t) write_size)
+    {
+      if (nbytes < 0 && errno == ENOSPC)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE_OUT_OF_SPACE, 2, page_id,
+		  fileio_get_volume_label_by_fd (vol_fd, PEEK));
+	}
+      else
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, page_id,
+			       fileio_get_volume_label_by_fd (vol_fd, PEEK));
+	}
+      return NULL;
+    }
+
+  fileio_compensate_flush (thread_p, vol_fd, 1);
+  perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IOWRITES);
+#else /* !WINDOWS */
+  /* write the compressed image padded to page size */
+  memset (zip_area + write_size, 0, page_size - write_size);
+  if (fileio_write (thread_p, vol_fd, zip_area, page_id, page_size) == NULL)
+    {
+      return NULL;
+    }
+#endif /* WINDOWS */
+
+  perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_COMPRESSED_PAGE_WRITES);
+  return io_page_p;
+}
+
+/*
+ * fileio_read_data_page () - READ A DATA VOLUME PAGE FROM DISK
+ *   return: io_page_p on success, NULL on failure
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(out): Address where content of page is stored. Must be of page_size long
+ *   page_id(in): Page identifier
+ *   page_size(in): Page size
+ *
+ * Note: Same as fileio_read, but pages compressed by fileio_write_data_page are decompressed. When
+ *       data_page_compression is on, the first block of the page is read first; the rest of a compressed page is
+ *       read only up to the last block holding its compressed image. Pages left compressed after the parameter is
+ *       turned off are read whole.
+ */
+void *
+fileio_read_data_page (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * io_page_p, PAGEID page_id,
+		       size_t page_size)
+{
+#if !defined (WINDOWS)
+  off_t offset;
+  size_t read_size;
+  INT32 zip_len;
+
+  if (prm_get_bool_value (PRM_ID_DATA_PAGE_COMPRESSION) && page_size > FILEIO_PAGE_ZIP_BLOCK_SIZE
+      && page_size <= (size_t) IO_PAGESIZE)
+    {
+      offset = FILEIO_GET_FILE_SIZE (page_size, page_id);
+      if (fileio_read_page_blocks (vol_fd, (char *) io_page_p, page_id, offset, FILEIO_PAGE_ZIP_BLOCK_SIZE)
+	  != NO_ERROR)
+	{
+	  return NULL;
+	}
+
+      read_size = page_size;
+      if (io_page_p->prv.pflag & FILEIO_PAGE_FLAG_COMPRESSED)
+	{
+	  memcpy (&zip_len, io_page_p->page, sizeof (INT32));
+	  if (zip_len > 0 && FILEIO_PAGE_ZIP_HEADER_SIZE + zip_len <= page_size)
+	    {
+	      read_size = DB_ALIGN (FILEIO_PAGE_ZIP_HEADER_SIZE + zip_len, FILEIO_PAGE_ZIP_BLOCK_SIZE);
+	    }
+	  /* else fileio_decompress_page reports the corrupted page */
+	}
+
+      if (read_size > FILEIO_PAGE_ZIP_BLOCK_SIZE
+	  && fileio_read_page_blocks (vol_fd, (char *) io_page_p + FILEIO_PAGE_ZIP_BLOCK_SIZE, page_id,
+				      offset + FILEIO_PAGE_ZIP_BLOCK_SIZE,
+				      read_size - FILEIO_PAGE_ZIP_BLOCK_SIZE) != NO_ERROR)
+	{
+	  return NULL;
+	}
+
+      perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IOREADS);
+    }
+  else
+#endif /* !WINDOWS */
+    {
+      if (fileio_read (thread_p, vol_fd, io_page_p, page_id, page_size) == NULL)
+	{
+	  return NULL;
+	}
+    }
+
+  if (io_page_p->prv.pflag & FILEIO_PAGE_FLAG_COMPRESSED)
+    {
+      if (fileio_decompress_page (thread_p, io_page_p, page_size) != NO_ERROR)
+	{
+	  return NULL;
+	}
+      perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_COMPRESSED_PAGE_READS);
+    }
+
+  return io_page_p;
+}
+
+/*
+ * fileio_decompress_page () - decompress in place a page written by fileio_write_data_page
+ *   return: error code
+ *   io_page_p(in/out): compressed page read from disk; uncompressed page on success
+ *   page_size(in): Page size
+ */
+static int
+fileio_decompress_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, size_t page_size)
+{
+  size_t user_size = page_size - sizeof (FILEIO_PAGE_RESERVED);
+  INT32 zip_len;
+  lzo_bytep zip_data;
+  lzo_uint unzip_len;
+  int rv;
+
+  memcpy (&zip_len, io_page_p->page, sizeof (INT32));
+  if (zip_len <= 0 || FILEIO_PAGE_ZIP_HEADER_SIZE + zip_len > page_size)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZO_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZO_DECOMPRESS_FAIL;
+    }
+
+  /* the user area is decompressed over the compressed image; keep a copy of it */
+  zip_data = (lzo_bytep) fileio_get_page_zip_area (thread_p);
+  if (zip_data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) FILEIO_PAGE_ZIP_AREA_SIZE);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memcpy (zip_data, io_page_p->page + sizeof (INT32), zip_len);
+
+  /* use safe decompressor; the page may be corrupted */
+  unzip_len = (lzo_uint) user_size;
+  rv = lzo1x_decompress_safe (zip_data, (lzo_uint) zip_len, (lzo_bytep) io_page_p->page, &unzip_len, NULL);
+  if (rv != LZO_E_OK || unzip_len != user_size)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZO_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZO_DECOMPRESS_FAIL;
+    }
+
+  io_page_p->prv.pflag &= ~FILEIO_PAGE_FLAG_COMPRESSED;
+
+  return NO_ERROR;
+}
+
+#if !defined (WINDOWS)
+/*
+ * fileio_read_page_blocks () - read part of a page from disk
+ *   return: error code
+ *   vol_fd(in): Volume descriptor
+ *   buf_p(out): Address where the blocks are stored. Must be of size long
+ *   page_id(in): Page identifier, for error messages
+ *   offset(in): Offset of the first block in the volume
+ *   size(in): Number of bytes to read
+ */
+static int
+fileio_read_page_blocks (int vol_fd, char *buf_p, PAGEID page_id, off_t offset, size_t size)
+{
+  ssize_t nbytes;
+
+  do
+    {
+      nbytes = pread (vol_fd, buf_p, size, offset);
+    }
+  while (nbytes < 0 && errno == EINTR);
+
+  if (nbytes == 0)
+    {
+      /* This is an end of file. We are trying to read beyond the allocated disk space */
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_PB_BAD_PAGEID, 2, page_id,
+	      fileio_get_volume_label_by_fd (vol_fd, PEEK));
+      return ER_PB_BAD_PAGEID;
+    }
+  if (nbytes != (ssize_t) size)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_READ, 2, page_id,
+			   fileio_get_volume_label_by_fd (vol_fd, PEEK));
+      return ER_IO_READ;
+    }
+
+  return NO_ERROR;
+}
+#endif /* !WINDOWS */
+
 /*
  * fileio_read_pages () -
  */
@@ -4204,6 +4547,7 @@ void *
 fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id, DKNPAGES npages,
 	       size_t page_size)
 {
+#if defined (WINDOWS)
   int i;
 
   for (i = 0; i < npages; i++)
@@ -4215,6 +4559,166 @@ fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID
     }
 
   return io_page_array[0];
+#else /* WINDOWS */
+  struct iovec iov[FILEIO_MAX_IOV_PAGES];
+  struct iovec *iov_p;
+  int i, iovcnt, npages_written;
+  off_t offset;
+  ssize_t nbytes;
+
+  /* write up to FILEIO_MAX_IOV_PAGES pages with each system call */
+  for (npages_written = 0; npages_written < npages; npages_written += iovcnt)
+    {
+      iovcnt = MIN (npages - npages_written, FILEIO_MAX_IOV_PAGES);
+      for (i = 0; i < iovcnt; i++)
+	{
+	  iov[i].iov_base = io_page_array[npages_written + i];
+	  iov[i].iov_len = page_size;
+	}
+      iov_p = iov;
+      offset = FILEIO_GET_FILE_SIZE (page_size, start_page_id + npages_written);
+
+      for (i = iovcnt; i > 0;)
+	{
+	  nbytes = pwritev (vol_fd, iov_p, i, offset);
+	  if (nbytes <= 0)
+	    {
+	      if (nbytes < 0 && (errno == EINTR || errno == EAGAIN))
+		{
+		  continue;
+		}
+	      if (nbytes < 0 && errno == ENOSPC)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE_OUT_OF_SPACE, 2, start_page_id + npages_written,
+			  fileio_get_volume_label_by_fd (vol_fd, PEEK));
+		}
+	      else
+		{
+		  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, start_page_id + npages_written,
+				       fileio_get_volume_label_by_fd (vol_fd, PEEK));
+		}
+	      return NULL;
+	    }
+
+	  /* partial write: skip what was written */
+	  offset += nbytes;
+	  while (i > 0 && (size_t) nbytes >= iov_p->iov_len)
+	    {
+	      nbytes -= iov_p->iov_len;
+	      iov_p++;
+	      i--;
+	    }
+	  if (i > 0)
+	    {
+	      iov_p->iov_base = (char *) iov_p->iov_base + nbytes;
+	      iov_p->iov_len -= nbytes;
+	    }
+	}
+
+      fileio_compensate_flush (thread_p, vol_fd, iovcnt);
+      perfmon_add_stat (thread_p, PSTAT_FILE_NUM_IOWRITES, iovcnt);
+      perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_VECTOR_WRITES);
+    }
+
+  return io_page_array[0];
+#endif /* !WINDOWS */
+}
+
+/*
+ * fileio_compare_write_requests () - compare page write requests by volume and page
+ *   return: p1 - p2
+ *   p1(in): write request 1
+ *   p2(in): write request 2
+ */
+static int
+fileio_compare_write_requests (const void *p1, const void *p2)
+{
+  const FILEIO_WRITE_REQUEST *req1 = (const FILEIO_WRITE_REQUEST *) p1;
+  const FILEIO_WRITE_REQUEST *req2 = (const FILEIO_WRITE_REQUEST *) p2;
+
+  if (req1->vol_fd != req2->vol_fd)
+    {
+      return req1->vol_fd < req2->vol_fd ? -1 : 1;
+    }
+  if (req1->page_id != req2->page_id)
+    {
+      return req1->page_id < req2->page_id ? -1 : 1;
+    }
+  return 0;
+}
+
+/*
+ * fileio_write_batch () - WRITE A BATCH OF DATA VOLUME PAGES TO DISK
+ *   return: NO_ERROR or the error of first failed write
+ *   requests(in/out): page writes; they are sorted by volume and page
+ *   num_requests(in): number of page writes
+ *   page_size(in): Page size
+ *   done_func(in): called for each request once its page is written or failed to be written
+ *
+ * Note: Pages following each other in the same volume are written with a single vectored write instead of one
+ *       write for each page. Pages compressed by fileio_write_data_page have variable size and are written alone.
+ */
+int
+fileio_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests, size_t page_size,
+		    FILEIO_WRITE_DONE_FUNC done_func)
+{
+  void *io_page_array[FILEIO_MAX_IOV_PAGES];
+  int start, end, i;
+  int error, first_error = NO_ERROR;
+
+  if (num_requests > 1)
+    {
+      qsort (requests, num_requests, sizeof (FILEIO_WRITE_REQUEST), fileio_compare_write_requests);
+    }
+
+  for (start = 0; start < num_requests; start = end)
+    {
+      end = start + 1;
+      if (!fileio_is_compressible_page (requests[start].io_page))
+	{
+	  while (end < num_requests && end - start < FILEIO_MAX_IOV_PAGES
+		 && requests[end].vol_fd == requests[start].vol_fd
+		 && requests[end].page_id == requests[end - 1].page_id + 1
+		 && !fileio_is_compressible_page (requests[end].io_page))
+	    {
+	      end++;
+	    }
+	}
+
+      if (end - start == 1)
+	{
+	  error = NO_ERROR;
+	  if (fileio_write_data_page (thread_p, requests[start].vol_fd, requests[start].io_page,
+				      requests[start].page_id, page_size) == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error);
+	    }
+	}
+      else
+	{
+	  for (i = start; i < end; i++)
+	    {
+	      io_page_array[i - start] = requests[i].io_page;
+	    }
+	  error = NO_ERROR;
+	  if (fileio_writev (thread_p, requests[start].vol_fd, io_page_array, requests[start].page_id, end - start,
+			     page_size) == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error);
+	    }
+	}
+
+      if (error != NO_ERROR && first_error == NO_ERROR)
+	{
+	  first_error = error;
+	}
+      for (i = start; i < end; i++)
+	{
+	  done_func (thread_p, &requests[i], error);
+	}
+    }
+
+  return first_error;
 }
 
 /*
@@ -11327,7 +11831,7 @@ fileio_initialize_res (THREAD_ENTRY * thread_p, FILEIO_PAGE_RESERVED * prv_p)
   prv_p->volid = -1;
 
   prv_p->ptype = '\0';
-  prv_p->pflag_reserve_1 = '\0';
+  prv_p->pflag = '\0';
   prv_p->p_reserve_2 = 0;
   prv_p->p_reserve_3 = 0;
 }
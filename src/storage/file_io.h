@@ -164,11 +164,14 @@ struct fileio_page_reserved
   INT32 pageid;			/* Page identifier */
   INT16 volid;			/* Volume identifier where the page reside */
   unsigned char ptype;		/* Page type */
-  unsigned char pflag_reserve_1;	/* unused - Reserved field */
+  unsigned char pflag;		/* Page flags (FILEIO_PAGE_FLAG_*) */
   INT64 p_reserve_2;		/* unused - Reserved field */
   INT64 p_reserve_3;		/* unused - Reserved field */
 };
 
+/* Page flags */
+#define FILEIO_PAGE_FLAG_COMPRESSED 0x01	/* page image on disk is compressed; see fileio_write_data_page */
+
 /* The FILEIO_PAGE */
 typedef struct fileio_page FILEIO_PAGE;
 struct fileio_page
@@ -177,6 +180,18 @@ struct fileio_page
   char page[1];			/* The user page area */
 };
 
+/* Page write of a batch; see fileio_write_batch */
+typedef struct fileio_write_request FILEIO_WRITE_REQUEST;
+struct fileio_write_request
+{
+  int vol_fd;			/* volume descriptor */
+  PAGEID page_id;		/* page identifier */
+  FILEIO_PAGE *io_page;		/* content of the page */
+  void *arg;			/* argument for the caller's completion function */
+};
+
+typedef void (*FILEIO_WRITE_DONE_FUNC) (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * request, int error);
+
 
 typedef struct fileio_backup_page FILEIO_BACKUP_PAGE;
 struct fileio_backup_page
@@ -409,12 +424,18 @@ extern void fileio_dismount (THREAD_ENTRY * thread_p, int vdes);
 extern void fileio_dismount_all (THREAD_ENTRY * thread_p);
 extern void *fileio_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_id, size_t page_size);
 extern void *fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_id, size_t page_size);
+extern void *fileio_read_data_page (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * io_page_p, PAGEID page_id,
+				    size_t page_size);
+extern void *fileio_write_data_page (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * io_page_p, PAGEID page_id,
+				     size_t page_size);
 extern void *fileio_read_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID page_id, int num_pages,
 				size_t page_size);
 extern void *fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID page_id, int num_pages,
 				 size_t page_size);
 extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io_pgptr, PAGEID start_pageid,
 			    DKNPAGES npages, size_t page_size);
+extern int fileio_write_batch (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * requests, int num_requests,
+			       size_t page_size, FILEIO_WRITE_DONE_FUNC done_func);
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel);
 extern int fileio_synchronize_all (THREAD_ENTRY * thread_p, bool include_log);
 #if defined (ENABLE_UNUSED_FUNCTION)
@@ -1384,6 +1384,11 @@ file_header_dump_descriptor (THREAD_ENTRY * thread_p, const FILE_HEADER * fhead,
       fprintf (fp, "Overflow for HFID: %10d|%5d|%10d\n", HFID_AS_ARGS (&fhead->descriptor.heap_overflow.hfid));
       break;
 
+    case FILE_HEAP_FREESPACE:
+      fprintf (fp, "Free space map for HFID: %10d|%5d|%10d\n",
+	       HFID_AS_ARGS (&fhead->descriptor.heap_freespace.hfid));
+      break;
+
     case FILE_BTREE:
       {
 	BTID btid;
@@ -3003,6 +3008,8 @@ file_type_to_string (FILE_TYPE fstruct_type)
       return "QUERY_AREA";
     case FILE_TEMP:
       return "TEMPORARILY";
+    case FILE_HEAP_FREESPACE:
+      return "HEAP_FREESPACE";
     case FILE_UNKNOWN_TYPE:
       return "UNKNOWN";
     case FILE_HEAP_REUSE_SLOTS:
@@ -10252,6 +10259,7 @@ file_tracker_get_and_protect (THREAD_ENTRY * thread_p, FILE_TYPE desired_type, F
     case FILE_HEAP_REUSE_SLOTS:
     case FILE_BTREE:
     case FILE_MULTIPAGE_OBJECT_HEAP:
+    case FILE_HEAP_FREESPACE:
     case FILE_BTREE_OVERFLOW_KEY:
       /* we need to protect with lock. fall through */
       break;
@@ -10286,6 +10294,9 @@ file_tracker_get_and_protect (THREAD_ENTRY * thread_p, FILE_TYPE desired_type, F
     case FILE_MULTIPAGE_OBJECT_HEAP:
       *class_oid = fhead->descriptor.heap_overflow.class_oid;
       break;
+    case FILE_HEAP_FREESPACE:
+      *class_oid = fhead->descriptor.heap_freespace.class_oid;
+      break;
     case FILE_BTREE_OVERFLOW_KEY:
       *class_oid = fhead->descriptor.btree_key_overflow.class_oid;
       break;
@@ -50,6 +50,7 @@ typedef enum
   FILE_VACUUM_DATA,
   FILE_QUERY_AREA,
   FILE_TEMP,
+  FILE_HEAP_FREESPACE,
   FILE_UNKNOWN_TYPE,
   FILE_LAST = FILE_UNKNOWN_TYPE
 } FILE_TYPE;
@@ -131,6 +132,7 @@ union file_descriptors
 {
   FILE_HEAP_DES heap;
   FILE_OVF_HEAP_DES heap_overflow;
+  FILE_OVF_HEAP_DES heap_freespace;	/* free space map of heap */
   FILE_BTREE_DES btree;
   FILE_OVF_BTREE_DES btree_key_overflow;	/* TODO: rename FILE_OVF_BTREE_DES */
   FILE_EHASH_DES ehash;
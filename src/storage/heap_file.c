@@ -120,6 +120,22 @@ static int rv;
 /* A good space to accept insertions */
 #define HEAP_DROP_FREE_SPACE (int)(DB_PAGESIZE * 0.3)
 
+/* Free space map. The root page references leaf pages; each leaf keeps one free space category byte for every page of
+ * a range of page identifiers of one volume, and one byte with the highest category of each block of pages. */
+#define HEAP_FSM_NUM_CATEGORIES 256
+#define HEAP_FSM_CATEGORY_UNIT (DB_PAGESIZE / HEAP_FSM_NUM_CATEGORIES)
+#define HEAP_FSM_BLOCK_NPAGES DISK_SECTOR_NPAGES
+#define HEAP_FSM_LEAF_NUM_BLOCKS \
+  ((DB_PAGESIZE - (int) sizeof (HEAP_FSM_LEAF)) / (HEAP_FSM_BLOCK_NPAGES + 1))
+#define HEAP_FSM_LEAF_NPAGES (HEAP_FSM_LEAF_NUM_BLOCKS * HEAP_FSM_BLOCK_NPAGES)
+#define HEAP_FSM_LEAF_BLOCK_MAX(leaf) ((UINT8 *) (leaf) + sizeof (HEAP_FSM_LEAF))
+#define HEAP_FSM_LEAF_CATEGORIES(leaf) (HEAP_FSM_LEAF_BLOCK_MAX (leaf) + HEAP_FSM_LEAF_NUM_BLOCKS)
+#define HEAP_FSM_ROOT_LEAVES(root) ((HEAP_FSM_LEAF_REF *) ((char *) (root) + sizeof (HEAP_FSM_ROOT)))
+#define HEAP_FSM_ROOT_MAX_LEAVES \
+  ((DB_PAGESIZE - (int) sizeof (HEAP_FSM_ROOT)) / (int) sizeof (HEAP_FSM_LEAF_REF))
+/* Small heaps are served well enough by the best space hints of the header */
+#define HEAP_FSM_MIN_HEAP_PAGES DISK_SECTOR_NPAGES
+
 #define HEAP_DEBUG_SCANCACHE_INITPATTERN (12345)
 
 #if defined(CUBRID_DEBUG)
@@ -242,11 +258,14 @@ struct heap_hdr_stats
 				 * these values are only used for hints. These values may not be accurate at any given
 				 * time and the entries may contain duplicated pages. */
 
-  int reserve0_for_future;	/* Nothing reserved for future */
-  int reserve1_for_future;	/* Nothing reserved for future */
+  VFID fsm_vfid;		/* Free space map file identifier (if any). Takes the place of two reserved integers, so
+				 * headers of older heaps have zero here. See HEAP_HDR_HAS_FSM. */
   int reserve2_for_future;	/* Nothing reserved for future */
 };
 
+#define HEAP_HDR_HAS_FSM(heap_hdr) \
+  (!VFID_ISNULL (&(heap_hdr)->fsm_vfid) && (heap_hdr)->fsm_vfid.fileid != 0)
+
 typedef struct heap_stats_entry HEAP_STATS_ENTRY;
 struct heap_stats_entry
 {
@@ -255,6 +274,41 @@ struct heap_stats_entry
   HEAP_STATS_ENTRY *next;
 };
 
+/* Free space map of a heap file. Also used as entry of the in-memory cache of free space maps. */
+typedef struct heap_fsm HEAP_FSM;
+struct heap_fsm
+{
+  HFID hfid;			/* heap file identifier */
+  VFID vfid;			/* free space map file identifier; null if the heap has no map */
+  VPID root_vpid;		/* root page of free space map */
+};
+
+typedef struct heap_fsm_root HEAP_FSM_ROOT;
+struct heap_fsm_root
+{
+  HFID hfid;			/* heap file of this map */
+  INT32 num_leaves;		/* number of leaf references that follow, sorted by volume and first page */
+};
+
+typedef struct heap_fsm_leaf_ref HEAP_FSM_LEAF_REF;
+struct heap_fsm_leaf_ref
+{
+  VPID vpid;			/* leaf page */
+  INT32 first_pageid;		/* first page identifier covered by leaf */
+  INT16 volid;			/* volume of the pages covered by leaf */
+  UINT8 max_category;		/* upper bound of the categories kept in leaf */
+  UINT8 reserved;
+};
+
+typedef struct heap_fsm_leaf HEAP_FSM_LEAF;
+struct heap_fsm_leaf
+{
+  INT32 first_pageid;		/* first page identifier covered by leaf */
+  INT16 volid;			/* volume of the pages covered by leaf */
+  INT16 num_blocks;		/* number of blocks of HEAP_FSM_BLOCK_NPAGES pages */
+  /* followed by num_blocks bytes with the highest category of each block and by one category byte per page */
+};
+
 /* Define heap page flags. */
 #define HEAP_PAGE_FLAG_VACUUM_STATUS_MASK	  0xC0000000
 #define HEAP_PAGE_FLAG_VACUUM_ONCE		  0x80000000
@@ -490,6 +544,7 @@ struct heap_stats_bestspace_cache
   int num_stats_entries;	/* number of cache entries in use */
   MHT_TABLE *hfid_ht;		/* HFID Hash table for best space */
   MHT_TABLE *vpid_ht;		/* VPID Hash table for best space */
+  MHT_TABLE *fsm_ht;		/* HFID Hash table for free space maps */
   int num_alloc;
   int num_free;
   int free_list_count;		/* number of entries in free */
@@ -516,7 +571,7 @@ static HEAP_CHNGUESS heap_Guesschn_area = { NULL, NULL, NULL, false, 0,
 static HEAP_CHNGUESS *heap_Guesschn = NULL;
 
 static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area =
-  { 0, NULL, NULL, 0, 0, 0, NULL, PTHREAD_MUTEX_INITIALIZER };
+  { 0, NULL, NULL, NULL, 0, 0, 0, NULL, PTHREAD_MUTEX_INITIALIZER };
 
 static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;
 
@@ -641,9 +696,35 @@ static HEAP_FINDSPACE heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p
 							 HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * pg_watcher);
 static PAGE_PTR heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space, bool isnew_rec,
 					   int newrec_size, HEAP_SCANCACHE * space_cache, PGBUF_WATCHER * pg_watcher);
+static void heap_stats_add_estimates (THREAD_ENTRY * thread_p, const HFID * hfid, int num_recs, float recs_sumlen);
 static int heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr,
 				      VPID * hdr_vpid, bool scan_all, bool can_cycle);
 
+static int heap_fsm_category (int freespace);
+static int heap_fsm_cache_entry_free (const void *key, void *data, void *args);
+static bool heap_fsm_cache_get (const HFID * hfid, HEAP_FSM * fsm);
+static void heap_fsm_cache_put (const HEAP_FSM * fsm);
+static void heap_fsm_cache_remove (const HFID * hfid);
+static int heap_fsm_init_root (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
+static int heap_fsm_init_leaf (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
+static int heap_fsm_create (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, PAGE_PTR hdr_pgptr,
+			    HEAP_FSM * fsm);
+static bool heap_fsm_get (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, HEAP_FSM * fsm);
+static VFID *heap_fsm_find_vfid (THREAD_ENTRY * thread_p, const HFID * hfid, VFID * fsm_vfid);
+static PAGE_PTR heap_fsm_fix_root (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, PGBUF_LATCH_MODE latch_mode);
+static int heap_fsm_find_leaf_ref (HEAP_FSM_ROOT * root, const VPID * vpid, int *insert_pos);
+static int heap_fsm_add_leaf (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, PAGE_PTR root_page, const VPID * vpid,
+			      int pos);
+static void heap_fsm_leaf_set (PAGE_PTR leaf_page, int index, int category);
+static int heap_fsm_leaf_search (PAGE_PTR leaf_page, int start_index, int min_category, int *leaf_max);
+static void heap_fsm_set_freespace (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, const VPID * vpid, int freespace);
+static bool heap_fsm_search (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, int min_category, VPID * vpid);
+static HEAP_FINDSPACE heap_fsm_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr,
+					       PAGE_PTR hdr_pgptr, int record_length, int needed_space,
+					       PGBUF_WATCHER * pg_watcher);
+static int heap_fsm_get_usage (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, INT64 * num_free_pages,
+			       INT64 * free_space);
+
 static int heap_get_last_page (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr,
 			       HEAP_SCANCACHE * scan_cache, VPID * last_vpid, PGBUF_WATCHER * pg_watcher);
 
@@ -1147,6 +1228,9 @@ heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 
   heap_Bestspace->num_stats_entries -= del_cnt;
 
+  /* forget the free space map too; it is read again from heap header when needed */
+  (void) mht_rem (heap_Bestspace->fsm_ht, hfid, heap_fsm_cache_entry_free, NULL);
+
   assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
   pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
 
@@ -2894,10 +2978,22 @@ void
 heap_stats_update (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, const HFID * hfid, int prev_freespace)
 {
   VPID *vpid;
+  HEAP_FSM fsm;
   int freespace, error;
   bool need_update;
 
   freespace = spage_get_free_space_without_saving (thread_p, pgptr, &need_update);
+  if (heap_fsm_category (prev_freespace) != heap_fsm_category (freespace))
+    {
+      vpid = pgbuf_get_vpid_ptr (pgptr);
+      assert_release (vpid != NULL);
+
+      if (vpid->pageid != hfid->hpgid && heap_fsm_get (thread_p, hfid, NULL, &fsm))
+	{
+	  heap_fsm_set_freespace (thread_p, &fsm, vpid, freespace);
+	}
+    }
+
   if (prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0)
     {
       if (prev_freespace < freespace)
@@ -3531,6 +3627,23 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 
       assert (hdr_page_watcher.page_was_unfixed == false);
 
+      if (try_find == 1)
+	{
+	  /* the free space map of heap knows pages that fell out of best hints */
+	  if (heap_fsm_find_best_page (thread_p, hfid, heap_hdr, hdr_page_watcher.pgptr, needed_space, total_space,
+				       pg_watcher) == HEAP_FINDSPACE_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      assert (pg_watcher->pgptr == NULL);
+	      pgbuf_ordered_unfix (thread_p, &hdr_page_watcher);
+	      return NULL;
+	    }
+	  if (pg_watcher->pgptr != NULL)
+	    {
+	      break;
+	    }
+	}
+
       if (heap_hdr->estimates.num_other_high_best <= 0 || heap_hdr->estimates.num_pages <= 0)
 	{
 	  assert (heap_hdr->estimates.num_pages > 0);
@@ -3614,6 +3727,57 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
   return pg_watcher->pgptr;
 }
 
+/*
+ * heap_stats_add_estimates () - Add inserted records to heap header estimates
+ *   return: void
+ *   hfid(in): Heap file identifier
+ *   num_recs(in): number of new records
+ *   recs_sumlen(in): total length of new records
+ *
+ * Note: Used for records inserted without heap_stats_find_best_page, which
+ *       adds each record it finds space for. Estimates are not logged.
+ */
+static void
+heap_stats_add_estimates (THREAD_ENTRY * thread_p, const HFID * hfid, int num_recs, float recs_sumlen)
+{
+  VPID vpid;
+  LOG_DATA_ADDR addr_hdr;
+  RECDES hdr_recdes;
+  HEAP_HDR_STATS *heap_hdr;
+  PGBUF_WATCHER hdr_page_watcher;
+
+  PGBUF_INIT_WATCHER (&hdr_page_watcher, PGBUF_ORDERED_HEAP_HDR, hfid);
+
+  vpid.volid = hfid->vfid.volid;
+  vpid.pageid = hfid->hpgid;
+
+  if (pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_WRITE, &hdr_page_watcher) != NO_ERROR)
+    {
+      /* estimates only; not a problem */
+      er_clear ();
+      return;
+    }
+
+  (void) pgbuf_check_page_ptype (thread_p, hdr_page_watcher.pgptr, PAGE_HEAP);
+
+  if (spage_get_record (thread_p, hdr_page_watcher.pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &hdr_recdes, PEEK) != S_SUCCESS)
+    {
+      assert (false);
+      pgbuf_ordered_unfix (thread_p, &hdr_page_watcher);
+      return;
+    }
+
+  heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
+  heap_hdr->estimates.num_recs += num_recs;
+  heap_hdr->estimates.recs_sumlen += recs_sumlen;
+
+  addr_hdr.vfid = &hfid->vfid;
+  addr_hdr.offset = HEAP_HEADER_AND_CHAIN_SLOTID;
+  addr_hdr.pgptr = hdr_page_watcher.pgptr;
+  log_skip_logging (thread_p, &addr_hdr);
+  pgbuf_ordered_set_dirty_and_free (thread_p, &hdr_page_watcher);
+}
+
 /*
  * heap_stats_sync_bestspace () - Synchronize the statistics of best space
  *   return: the number of pages found
@@ -3654,6 +3818,8 @@ heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_
   HEAP_BESTSPACE *best_pages_hint_p;
   bool iterate_all = false;
   bool search_all = false;
+  HEAP_FSM fsm;
+  bool has_fsm;
   PGBUF_WATCHER pg_watcher;
   PGBUF_WATCHER old_pg_watcher;
 #if defined (CUBRID_DEBUG)
@@ -3671,6 +3837,9 @@ heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_
 
   min_freespace = heap_stats_get_min_freespace (heap_hdr);
 
+  /* pages visited here are also recorded in the free space map */
+  has_fsm = heap_fsm_get (thread_p, hfid, heap_hdr, &fsm);
+
   best = 0;
   start_pos = -1;
   num_high_best = num_other_best = 0;
@@ -3834,6 +4003,11 @@ heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_
 
 	  free_space = spage_max_space_for_new_record (thread_p, pg_watcher.pgptr);
 
+	  if (has_fsm && !VPID_EQ (&vpid, hdr_vpid))
+	    {
+	      heap_fsm_set_freespace (thread_p, &fsm, &vpid, free_space);
+	    }
+
 	  if (free_space >= min_freespace && free_space > HEAP_DROP_FREE_SPACE)
 	    {
 	      if (prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0)
@@ -3846,105 +4020,1028 @@ heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_
 		  best_pages_hint_p[best].vpid = vpid;
 		  best_pages_hint_p[best].freespace = free_space;
 
-		  best = HEAP_STATS_NEXT_BEST_INDEX (best);
-		  num_high_best++;
-		}
-	      else
-		{
-		  num_other_best++;
-		}
-	    }
+		  best = HEAP_STATS_NEXT_BEST_INDEX (best);
+		  num_high_best++;
+		}
+	      else
+		{
+		  num_other_best++;
+		}
+	    }
+
+	  pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
+	}
+
+      assert (pg_watcher.pgptr == NULL);
+      if (old_pg_watcher.pgptr != NULL)
+	{
+	  pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
+	}
+
+      if (scan_all == false
+	  && (iterate_all == true || num_high_best == HEAP_NUM_BEST_SPACESTATS
+	      || (can_cycle == false && VPID_EQ (&next_vpid, &stopat_vpid))))
+	{
+	  break;
+	}
+
+      VPID_SET_NULL (&next_vpid);
+    }
+
+  er_log_debug (ARG_FILE_LINE,
+		"heap_stats_sync_bestspace: scans from {%d|%d} to {%d|%d}, num_iterations(%d) "
+		"max_iterations(%d) num_high_best(%d)\n", start_vpid.volid, start_vpid.pageid, vpid.volid, vpid.pageid,
+		num_iterations, max_iterations, num_high_best);
+
+  /* If we have scanned all pages, we should update all statistics even if we have not found any hints. This logic is
+   * used to handle "select count(*) from table". */
+  if (scan_all == false && num_high_best == 0 && heap_hdr->estimates.num_second_best == 0)
+    {
+      return 0;
+    }
+
+  if (num_high_best < HEAP_NUM_BEST_SPACESTATS)
+    {
+      for (i = best; i < HEAP_NUM_BEST_SPACESTATS; i++)
+	{
+	  VPID_SET_NULL (&best_pages_hint_p[i].vpid);
+	  best_pages_hint_p[i].freespace = 0;
+	}
+    }
+
+  heap_hdr->estimates.head = best;	/* reinit */
+  heap_hdr->estimates.num_high_best = num_high_best;
+  assert (heap_hdr->estimates.head >= 0 && heap_hdr->estimates.head < HEAP_NUM_BEST_SPACESTATS
+	  && heap_hdr->estimates.num_high_best <= HEAP_NUM_BEST_SPACESTATS);
+
+  if (scan_all == true || heap_hdr->estimates.num_pages <= num_pages)
+    {
+      /* 
+       * We scan the whole heap.
+       * Reset its statistics with new found statistics
+       */
+      heap_hdr->estimates.num_other_high_best = num_other_best;
+      heap_hdr->estimates.num_pages = num_pages;
+      heap_hdr->estimates.num_recs = num_recs;
+      heap_hdr->estimates.recs_sumlen = recs_sumlen;
+    }
+  else
+    {
+      /* 
+       * We did not scan the whole heap.
+       * We reset only some of its statistics since we do not have any idea
+       * which ones are better the ones that are currently recorded or the ones
+       * just found.
+       */
+      heap_hdr->estimates.num_other_high_best -= heap_hdr->estimates.num_high_best;
+
+      if (heap_hdr->estimates.num_other_high_best < num_other_best)
+	{
+	  heap_hdr->estimates.num_other_high_best = num_other_best;
+	}
+
+      if (num_recs > heap_hdr->estimates.num_recs || recs_sumlen > heap_hdr->estimates.recs_sumlen)
+	{
+	  heap_hdr->estimates.num_pages = num_pages;
+	  heap_hdr->estimates.num_recs = num_recs;
+	  heap_hdr->estimates.recs_sumlen = recs_sumlen;
+	}
+    }
+
+#if defined (CUBRID_DEBUG)
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+  elapsed = (float) tv_diff.tv_sec * 1000000;
+  elapsed += (float) tv_diff.tv_usec;
+  elapsed /= 1000000;
+
+  er_log_debug (ARG_FILE_LINE, "heap_stats_sync_bestspace: elapsed time %.6f", elapsed);
+#endif /* CUBRID_DEBUG */
+
+  return num_high_best;
+}
+
+/*
+ * heap_fsm_category () - Get free space map category of given free space
+ *   return: category
+ *   freespace(in): free space of heap page
+ *
+ * Note: Category c means the page has at least c * HEAP_FSM_CATEGORY_UNIT bytes free.
+ */
+static int
+heap_fsm_category (int freespace)
+{
+  if (freespace <= 0)
+    {
+      return 0;
+    }
+
+  return MIN (freespace / HEAP_FSM_CATEGORY_UNIT, HEAP_FSM_NUM_CATEGORIES - 1);
+}
+
+/*
+ * heap_fsm_cache_entry_free () - Free an entry of the free space map cache
+ *   return: NO_ERROR
+ *   key(in): HFID
+ *   data(in): HEAP_FSM entry
+ *   args(in): not used
+ */
+static int
+heap_fsm_cache_entry_free (const void *key, void *data, void *args)
+{
+  free (data);
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_fsm_cache_get () - Get the free space map of heap from cache
+ *   return: true if heap is cached
+ *   hfid(in): heap file identifier
+ *   fsm(out): free space map; its vfid is null if the heap has no map
+ */
+static bool
+heap_fsm_cache_get (const HFID * hfid, HEAP_FSM * fsm)
+{
+  HEAP_FSM *ent;
+  int rc;
+
+  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+
+  ent = (HEAP_FSM *) mht_get (heap_Bestspace->fsm_ht, hfid);
+  if (ent != NULL)
+    {
+      *fsm = *ent;
+    }
+
+  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+
+  return ent != NULL;
+}
+
+/*
+ * heap_fsm_cache_put () - Cache the free space map of heap
+ *   return: void
+ *   fsm(in): free space map; its vfid is null if the heap has no map
+ */
+static void
+heap_fsm_cache_put (const HEAP_FSM * fsm)
+{
+  HEAP_FSM *ent;
+  int rc;
+
+  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+
+  ent = (HEAP_FSM *) mht_get (heap_Bestspace->fsm_ht, &fsm->hfid);
+  if (ent == NULL)
+    {
+      ent = (HEAP_FSM *) malloc (sizeof (HEAP_FSM));
+      if (ent == NULL)
+	{
+	  /* only a cache */
+	  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+	  return;
+	}
+      *ent = *fsm;
+      if (mht_put (heap_Bestspace->fsm_ht, &ent->hfid, ent) == NULL)
+	{
+	  free (ent);
+	}
+    }
+  else
+    {
+      *ent = *fsm;
+    }
+
+  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+}
+
+/*
+ * heap_fsm_cache_remove () - Remove the free space map of heap from cache
+ *   return: void
+ *   hfid(in): heap file identifier
+ */
+static void
+heap_fsm_cache_remove (const HFID * hfid)
+{
+  int rc;
+
+  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+  (void) mht_rem (heap_Bestspace->fsm_ht, hfid, heap_fsm_cache_entry_free, NULL);
+  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+}
+
+/*
+ * heap_fsm_init_root () - Initialize root page of new free space map
+ *   return: NO_ERROR
+ *   page(in): new root page
+ *   args(in): HFID of heap
+ */
+static int
+heap_fsm_init_root (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args)
+{
+  HEAP_FSM_ROOT *root = (HEAP_FSM_ROOT *) page;
+
+  pgbuf_set_page_ptype (thread_p, page, PAGE_HEAP_FREESPACE);
+
+  HFID_COPY (&root->hfid, (HFID *) args);
+  root->num_leaves = 0;
+
+  pgbuf_log_new_page (thread_p, page, sizeof (HEAP_FSM_ROOT), PAGE_HEAP_FREESPACE);
+  return NO_ERROR;
+}
+
+/*
+ * heap_fsm_init_leaf () - Initialize new leaf page of free space map
+ *   return: NO_ERROR
+ *   page(in): new leaf page
+ *   args(in): VPID of the first page covered by leaf
+ *
+ * Note: The whole page is logged; all categories of a new leaf must be zero even after recovery.
+ */
+static int
+heap_fsm_init_leaf (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args)
+{
+  HEAP_FSM_LEAF *leaf = (HEAP_FSM_LEAF *) page;
+  VPID *first_vpid = (VPID *) args;
+
+  pgbuf_set_page_ptype (thread_p, page, PAGE_HEAP_FREESPACE);
+
+  memset (page, 0, DB_PAGESIZE);
+  leaf->first_pageid = first_vpid->pageid;
+  leaf->volid = first_vpid->volid;
+  leaf->num_blocks = HEAP_FSM_LEAF_NUM_BLOCKS;
+
+  pgbuf_log_new_page (thread_p, page, DB_PAGESIZE, PAGE_HEAP_FREESPACE);
+  return NO_ERROR;
+}
+
+/*
+ * heap_fsm_create () - Create the free space map of a heap
+ *   return: error code
+ *   hfid(in): heap file identifier
+ *   heap_hdr(in/out): heap header; its page is latched exclusively by caller
+ *   hdr_pgptr(in): heap header page
+ *   fsm(out): new free space map
+ *
+ * Note: Like the overflow file, the map is created by a system operation and outlives the transaction.
+ */
+static int
+heap_fsm_create (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, PAGE_PTR hdr_pgptr,
+		 HEAP_FSM * fsm)
+{
+  FILE_DESCRIPTORS des;
+  LOG_DATA_ADDR addr_hdr;
+  int error_code = NO_ERROR;
+
+  memset (&des, 0, sizeof (des));
+  HFID_COPY (&des.heap_freespace.hfid, hfid);
+  des.heap_freespace.class_oid = heap_hdr->class_oid;
+
+  HFID_COPY (&fsm->hfid, hfid);
+
+  log_sysop_start (thread_p);
+
+  error_code = file_create_with_npages (thread_p, FILE_HEAP_FREESPACE, 1, &des, &fsm->vfid);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      log_sysop_abort (thread_p);
+      return error_code;
+    }
+
+  error_code =
+    file_alloc_sticky_first_page (thread_p, &fsm->vfid, heap_fsm_init_root, (void *) hfid, &fsm->root_vpid, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      log_sysop_abort (thread_p);
+      return error_code;
+    }
+
+  addr_hdr.vfid = &hfid->vfid;
+  addr_hdr.pgptr = hdr_pgptr;
+  addr_hdr.offset = HEAP_HEADER_AND_CHAIN_SLOTID;
+
+  log_append_undo_data (thread_p, RVHF_STATS, &addr_hdr, sizeof (*heap_hdr), heap_hdr);
+  VFID_COPY (&heap_hdr->fsm_vfid, &fsm->vfid);
+  log_append_redo_data (thread_p, RVHF_STATS, &addr_hdr, sizeof (*heap_hdr), heap_hdr);
+  pgbuf_set_dirty (thread_p, hdr_pgptr, DONT_FREE);
+
+  log_sysop_commit (thread_p);
+
+  heap_fsm_cache_put (fsm);
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_fsm_get () - Get the free space map of a heap
+ *   return: true if heap has a free space map
+ *   hfid(in): heap file identifier
+ *   heap_hdr(in): heap header if it is latched by caller, NULL otherwise
+ *   fsm(out): free space map
+ *
+ * Note: Without heap_hdr the header page is only latched conditionally; callers hold heap pages and the map is a hint.
+ */
+static bool
+heap_fsm_get (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, HEAP_FSM * fsm)
+{
+  VPID hdr_vpid;
+  PAGE_PTR hdr_pgptr;
+  RECDES hdr_recdes;
+  HEAP_HDR_STATS *hdr;
+
+  if (heap_fsm_cache_get (hfid, fsm))
+    {
+      if (heap_hdr == NULL)
+	{
+	  return !VFID_ISNULL (&fsm->vfid);
+	}
+      if (HEAP_HDR_HAS_FSM (heap_hdr) ? VFID_EQ (&fsm->vfid, &heap_hdr->fsm_vfid) : VFID_ISNULL (&fsm->vfid))
+	{
+	  return !VFID_ISNULL (&fsm->vfid);
+	}
+    }
+
+  HFID_COPY (&fsm->hfid, hfid);
+  VFID_SET_NULL (&fsm->vfid);
+  VPID_SET_NULL (&fsm->root_vpid);
+
+  if (heap_hdr != NULL)
+    {
+      if (HEAP_HDR_HAS_FSM (heap_hdr))
+	{
+	  VFID_COPY (&fsm->vfid, &heap_hdr->fsm_vfid);
+	}
+    }
+  else
+    {
+      hdr_vpid.volid = hfid->vfid.volid;
+      hdr_vpid.pageid = hfid->hpgid;
+
+      hdr_pgptr = pgbuf_fix (thread_p, &hdr_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+      if (hdr_pgptr == NULL)
+	{
+	  /* busy; try next time */
+	  er_clear ();
+	  return false;
+	}
+
+      (void) pgbuf_check_page_ptype (thread_p, hdr_pgptr, PAGE_HEAP);
+
+      if (spage_get_record (thread_p, hdr_pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &hdr_recdes, PEEK) != S_SUCCESS)
+	{
+	  assert (false);
+	  pgbuf_unfix_and_init (thread_p, hdr_pgptr);
+	  return false;
+	}
+
+      hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
+      if (HEAP_HDR_HAS_FSM (hdr))
+	{
+	  VFID_COPY (&fsm->vfid, &hdr->fsm_vfid);
+	}
+
+      pgbuf_unfix_and_init (thread_p, hdr_pgptr);
+    }
+
+  if (!VFID_ISNULL (&fsm->vfid) && file_get_sticky_first_page (thread_p, &fsm->vfid, &fsm->root_vpid) != NO_ERROR)
+    {
+      er_clear ();
+      return false;
+    }
+
+  heap_fsm_cache_put (fsm);
+
+  return !VFID_ISNULL (&fsm->vfid);
+}
+
+/*
+ * heap_fsm_find_vfid () - Find the free space map file of a heap
+ *   return: fsm_vfid or NULL
+ *   hfid(in): heap file identifier
+ *   fsm_vfid(out): free space map file identifier
+ */
+static VFID *
+heap_fsm_find_vfid (THREAD_ENTRY * thread_p, const HFID * hfid, VFID * fsm_vfid)
+{
+  VPID vpid;
+  PAGE_PTR hdr_pgptr;
+  RECDES hdr_recdes;
+  HEAP_HDR_STATS *heap_hdr;
+
+  vpid.volid = hfid->vfid.volid;
+  vpid.pageid = hfid->hpgid;
+
+  hdr_pgptr = pgbuf_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (hdr_pgptr == NULL)
+    {
+      return NULL;
+    }
+
+  (void) pgbuf_check_page_ptype (thread_p, hdr_pgptr, PAGE_HEAP);
+
+  if (spage_get_record (thread_p, hdr_pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &hdr_recdes, PEEK) != S_SUCCESS)
+    {
+      pgbuf_unfix_and_init (thread_p, hdr_pgptr);
+      return NULL;
+    }
+
+  heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
+  if (HEAP_HDR_HAS_FSM (heap_hdr))
+    {
+      VFID_COPY (fsm_vfid, &heap_hdr->fsm_vfid);
+    }
+  else
+    {
+      fsm_vfid = NULL;
+    }
+
+  pgbuf_unfix_and_init (thread_p, hdr_pgptr);
+
+  return fsm_vfid;
+}
+
+/*
+ * heap_fsm_fix_root () - Fix root page of free space map
+ *   return: root page or NULL
+ *   fsm(in): free space map
+ *   latch_mode(in): latch mode
+ *
+ * Note: A cached map may belong to a heap that was dropped in the meantime; the root is checked to still be the root
+ *       of this heap map. No error is left set.
+ */
+static PAGE_PTR
+heap_fsm_fix_root (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, PGBUF_LATCH_MODE latch_mode)
+{
+  PAGE_PTR root_page;
+
+  root_page = pgbuf_fix (thread_p, &fsm->root_vpid, OLD_PAGE_MAYBE_DEALLOCATED, latch_mode, PGBUF_UNCONDITIONAL_LATCH);
+  if (root_page == NULL)
+    {
+      er_clear ();
+      heap_fsm_cache_remove (&fsm->hfid);
+      return NULL;
+    }
+
+  if (pgbuf_get_page_ptype (thread_p, root_page) != PAGE_HEAP_FREESPACE
+      || !HFID_EQ (&((HEAP_FSM_ROOT *) root_page)->hfid, &fsm->hfid))
+    {
+      pgbuf_unfix_and_init (thread_p, root_page);
+      heap_fsm_cache_remove (&fsm->hfid);
+      return NULL;
+    }
+
+  return root_page;
+}
+
+/*
+ * heap_fsm_find_leaf_ref () - Binary search the reference of the leaf covering a heap page
+ *   return: index of leaf reference or -1 if there is no leaf for the page
+ *   root(in): root page of free space map
+ *   vpid(in): heap page
+ *   insert_pos(out): where the reference of a new leaf for the page belongs
+ */
+static int
+heap_fsm_find_leaf_ref (HEAP_FSM_ROOT * root, const VPID * vpid, int *insert_pos)
+{
+  HEAP_FSM_LEAF_REF *leaves = HEAP_FSM_ROOT_LEAVES (root);
+  INT32 first_pageid = vpid->pageid - (vpid->pageid % HEAP_FSM_LEAF_NPAGES);
+  int min = 0, max = root->num_leaves - 1, mid;
+
+  while (min <= max)
+    {
+      mid = (min + max) / 2;
+      if (leaves[mid].volid == vpid->volid && leaves[mid].first_pageid == first_pageid)
+	{
+	  return mid;
+	}
+
+      if (leaves[mid].volid < vpid->volid
+	  || (leaves[mid].volid == vpid->volid && leaves[mid].first_pageid < first_pageid))
+	{
+	  min = mid + 1;
+	}
+      else
+	{
+	  max = mid - 1;
+	}
+    }
+
+  if (insert_pos != NULL)
+    {
+      *insert_pos = min;
+    }
+  return -1;
+}
+
+/*
+ * heap_fsm_add_leaf () - Add a leaf covering given heap page to free space map
+ *   return: error code
+ *   fsm(in): free space map
+ *   root_page(in): root page, latched exclusively
+ *   vpid(in): heap page
+ *   pos(in): position of the new leaf reference
+ */
+static int
+heap_fsm_add_leaf (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, PAGE_PTR root_page, const VPID * vpid, int pos)
+{
+  HEAP_FSM_ROOT *root = (HEAP_FSM_ROOT *) root_page;
+  HEAP_FSM_LEAF_REF *leaves = HEAP_FSM_ROOT_LEAVES (root);
+  VPID first_vpid, leaf_vpid;
+  char *undo_data = NULL;
+  int length;
+  int error_code = NO_ERROR;
+
+  if (root->num_leaves >= HEAP_FSM_ROOT_MAX_LEAVES)
+    {
+      /* the pages of this range are not tracked */
+      return ER_FAILED;
+    }
+
+  first_vpid.volid = vpid->volid;
+  first_vpid.pageid = vpid->pageid - (vpid->pageid % HEAP_FSM_LEAF_NPAGES);
+
+  length = sizeof (HEAP_FSM_ROOT) + (root->num_leaves + 1) * sizeof (HEAP_FSM_LEAF_REF);
+  undo_data = (char *) db_private_alloc (thread_p, length);
+  if (undo_data == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  log_sysop_start (thread_p);
+
+  error_code = file_alloc (thread_p, &fsm->vfid, heap_fsm_init_leaf, &first_vpid, &leaf_vpid, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      log_sysop_abort (thread_p);
+      db_private_free (thread_p, undo_data);
+      return error_code;
+    }
+
+  memcpy (undo_data, root_page, length);
+
+  memmove (&leaves[pos + 1], &leaves[pos], (root->num_leaves - pos) * sizeof (HEAP_FSM_LEAF_REF));
+  leaves[pos].vpid = leaf_vpid;
+  leaves[pos].first_pageid = first_vpid.pageid;
+  leaves[pos].volid = first_vpid.volid;
+  leaves[pos].max_category = 0;
+  leaves[pos].reserved = 0;
+  root->num_leaves++;
+
+  log_append_undoredo_data2 (thread_p, RVHF_FREESPACE_MAP, &fsm->vfid, root_page, 0, length, length, undo_data,
+			     root_page);
+  pgbuf_set_dirty (thread_p, root_page, DONT_FREE);
+
+  log_sysop_commit (thread_p);
+
+  db_private_free (thread_p, undo_data);
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_fsm_leaf_set () - Set the category of a page in leaf of free space map
+ *   return: void
+ *   leaf_page(in): leaf page, latched exclusively
+ *   index(in): index of heap page in leaf
+ *   category(in): new category
+ */
+static void
+heap_fsm_leaf_set (PAGE_PTR leaf_page, int index, int category)
+{
+  UINT8 *block_max = HEAP_FSM_LEAF_BLOCK_MAX (leaf_page);
+  UINT8 *categories = HEAP_FSM_LEAF_CATEGORIES (leaf_page);
+  int block = index / HEAP_FSM_BLOCK_NPAGES;
+  int i, max;
+
+  categories[index] = (UINT8) category;
+
+  if (category >= block_max[block])
+    {
+      block_max[block] = (UINT8) category;
+      return;
+    }
+
+  /* the block maximum may have dropped */
+  max = 0;
+  for (i = block * HEAP_FSM_BLOCK_NPAGES; i < (block + 1) * HEAP_FSM_BLOCK_NPAGES; i++)
+    {
+      max = MAX (max, categories[i]);
+    }
+  block_max[block] = (UINT8) max;
+}
+
+/*
+ * heap_fsm_leaf_search () - Search a leaf of free space map for a page with enough space
+ *   return: index of page in leaf or -1
+ *   leaf_page(in): leaf page
+ *   start_index(in): first index to look at
+ *   min_category(in): minimum category
+ *   leaf_max(out): highest category in leaf, if no page is found
+ */
+static int
+heap_fsm_leaf_search (PAGE_PTR leaf_page, int start_index, int min_category, int *leaf_max)
+{
+  HEAP_FSM_LEAF *leaf = (HEAP_FSM_LEAF *) leaf_page;
+  UINT8 *block_max = HEAP_FSM_LEAF_BLOCK_MAX (leaf_page);
+  UINT8 *categories = HEAP_FSM_LEAF_CATEGORIES (leaf_page);
+  int block, i;
+
+  *leaf_max = 0;
+  for (block = 0; block < leaf->num_blocks; block++)
+    {
+      *leaf_max = MAX (*leaf_max, block_max[block]);
+      if (block_max[block] < min_category || (block + 1) * HEAP_FSM_BLOCK_NPAGES <= start_index)
+	{
+	  continue;
+	}
+
+      for (i = MAX (block * HEAP_FSM_BLOCK_NPAGES, start_index); i < (block + 1) * HEAP_FSM_BLOCK_NPAGES; i++)
+	{
+	  if (categories[i] >= min_category)
+	    {
+	      return i;
+	    }
+	}
+    }
+
+  return -1;
+}
+
+/*
+ * heap_fsm_set_freespace () - Record the free space of a heap page in free space map
+ *   return: void
+ *   fsm(in): free space map
+ *   vpid(in): heap page
+ *   freespace(in): free space of heap page
+ *
+ * Note: Categories are hints like the best space estimates of heap header; they are not logged and they are checked
+ *       against the page before it is used. Only the structure of the map (its leaves) is logged.
+ */
+static void
+heap_fsm_set_freespace (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, const VPID * vpid, int freespace)
+{
+  PGBUF_LATCH_MODE root_latch = PGBUF_LATCH_READ;
+  PAGE_PTR root_page = NULL;
+  PAGE_PTR leaf_page = NULL;
+  HEAP_FSM_ROOT *root;
+  HEAP_FSM_LEAF_REF *ref;
+  LOG_DATA_ADDR addr = LOG_DATA_ADDR_INITIALIZER;
+  int category, idx, pos;
+
+  category = heap_fsm_category (freespace);
+
+  addr.vfid = &fsm->vfid;
+
+  while (true)
+    {
+      root_page = heap_fsm_fix_root (thread_p, fsm, root_latch);
+      if (root_page == NULL)
+	{
+	  return;
+	}
+      root = (HEAP_FSM_ROOT *) root_page;
+
+      idx = heap_fsm_find_leaf_ref (root, vpid, &pos);
+      if (idx < 0)
+	{
+	  if (category == 0)
+	    {
+	      /* nothing to remember */
+	      pgbuf_unfix_and_init (thread_p, root_page);
+	      return;
+	    }
+	  if (root_latch == PGBUF_LATCH_READ)
+	    {
+	      pgbuf_unfix_and_init (thread_p, root_page);
+	      root_latch = PGBUF_LATCH_WRITE;
+	      continue;
+	    }
+	  if (heap_fsm_add_leaf (thread_p, fsm, root_page, vpid, pos) != NO_ERROR)
+	    {
+	      er_clear ();
+	      pgbuf_unfix_and_init (thread_p, root_page);
+	      return;
+	    }
+	  idx = pos;
+	}
+
+      ref = &HEAP_FSM_ROOT_LEAVES (root)[idx];
+      if (category > ref->max_category && root_latch == PGBUF_LATCH_READ)
+	{
+	  /* the leaf maximum is raised too */
+	  pgbuf_unfix_and_init (thread_p, root_page);
+	  root_latch = PGBUF_LATCH_WRITE;
+	  continue;
+	}
+      break;
+    }
+
+  leaf_page = pgbuf_fix (thread_p, &ref->vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+  if (leaf_page == NULL)
+    {
+      er_clear ();
+      pgbuf_unfix_and_init (thread_p, root_page);
+      return;
+    }
+  (void) pgbuf_check_page_ptype (thread_p, leaf_page, PAGE_HEAP_FREESPACE);
+
+  heap_fsm_leaf_set (leaf_page, vpid->pageid - ref->first_pageid, category);
+
+  addr.pgptr = leaf_page;
+  log_skip_logging (thread_p, &addr);
+  pgbuf_set_dirty (thread_p, leaf_page, FREE);
+  leaf_page = NULL;
+
+  if (category > ref->max_category)
+    {
+      assert (root_latch == PGBUF_LATCH_WRITE);
+      ref->max_category = (UINT8) category;
+
+      addr.pgptr = root_page;
+      log_skip_logging (thread_p, &addr);
+      pgbuf_set_dirty (thread_p, root_page, FREE);
+      root_page = NULL;
+    }
+  else
+    {
+      pgbuf_unfix_and_init (thread_p, root_page);
+    }
+}
+
+/*
+ * heap_fsm_search () - Search free space map for a heap page with at least given category
+ *   return: true if a page was found
+ *   fsm(in): free space map
+ *   min_category(in): minimum category
+ *   vpid(in/out): in: page found by previous search of the same caller, or null VPID; the search continues after it.
+ *                 out: page found
+ *
+ * Note: Leaves are looked at only if their maximum allows it. Leaf maximums found too high are lowered.
+ */
+static bool
+heap_fsm_search (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, int min_category, VPID * vpid)
+{
+  PAGE_PTR root_page = NULL;
+  PAGE_PTR leaf_page = NULL;
+  HEAP_FSM_ROOT *root;
+  HEAP_FSM_LEAF_REF *leaves;
+  LOG_DATA_ADDR addr = LOG_DATA_ADDR_INITIALIZER;
+  int i, start_leaf = 0, start_index = 0;
+  int found_index = -1, leaf_max;
+  bool is_root_changed = false;
+
+  root_page = heap_fsm_fix_root (thread_p, fsm, PGBUF_LATCH_WRITE);
+  if (root_page == NULL)
+    {
+      return false;
+    }
+  root = (HEAP_FSM_ROOT *) root_page;
+  leaves = HEAP_FSM_ROOT_LEAVES (root);
+
+  if (!VPID_ISNULL (vpid))
+    {
+      start_leaf = heap_fsm_find_leaf_ref (root, vpid, &i);
+      if (start_leaf < 0)
+	{
+	  start_leaf = i;
+	}
+      else
+	{
+	  start_index = vpid->pageid - leaves[start_leaf].first_pageid + 1;
+	}
+    }
+
+  for (i = start_leaf; i < root->num_leaves; i++, start_index = 0)
+    {
+      if (leaves[i].max_category < min_category || start_index >= HEAP_FSM_LEAF_NPAGES)
+	{
+	  continue;
+	}
+
+      leaf_page = pgbuf_fix (thread_p, &leaves[i].vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (leaf_page == NULL)
+	{
+	  er_clear ();
+	  break;
+	}
+      (void) pgbuf_check_page_ptype (thread_p, leaf_page, PAGE_HEAP_FREESPACE);
+
+      found_index = heap_fsm_leaf_search (leaf_page, start_index, min_category, &leaf_max);
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+
+      if (found_index >= 0)
+	{
+	  vpid->volid = leaves[i].volid;
+	  vpid->pageid = leaves[i].first_pageid + found_index;
+	  break;
+	}
+
+      if (start_index == 0 && leaf_max < leaves[i].max_category)
+	{
+	  leaves[i].max_category = (UINT8) leaf_max;
+	  is_root_changed = true;
+	}
+    }
+
+  if (is_root_changed)
+    {
+      addr.vfid = &fsm->vfid;
+      addr.pgptr = root_page;
+      log_skip_logging (thread_p, &addr);
+      pgbuf_set_dirty (thread_p, root_page, FREE);
+    }
+  else
+    {
+      pgbuf_unfix (thread_p, root_page);
+    }
+
+  return found_index >= 0;
+}
+
+/*
+ * heap_fsm_find_best_page () - Find a page with the needed space using the free space map of heap
+ *   return: HEAP_FINDSPACE (found, not found, or error)
+ *   hfid(in): heap file identifier
+ *   heap_hdr(in/out): heap header; its page is latched exclusively by caller
+ *   hdr_pgptr(in): heap header page
+ *   record_length(in): length of record to insert
+ *   needed_space(in): the needed space, including unfill space
+ *   pg_watcher(out): watcher of the page found
+ *
+ * Note: The map is created when the heap grows past HEAP_FSM_MIN_HEAP_PAGES pages. Pages suggested by the map are
+ *       latched conditionally and checked to still belong to the heap; their real free space is written back to the
+ *       map.
+ */
+static HEAP_FINDSPACE
+heap_fsm_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, PAGE_PTR hdr_pgptr,
+			 int record_length, int needed_space, PGBUF_WATCHER * pg_watcher)
+{
+  HEAP_FSM fsm;
+  VPID vpid, hdr_vpid;
+  PAGE_PTR pgptr;
+  RECDES chain_recdes;
+  int min_category, freespace, num_tries;
+  HEAP_FINDSPACE found = HEAP_FINDSPACE_NOTFOUND;
+
+  assert (PGBUF_IS_CLEAN_WATCHER (pg_watcher));
+
+  if (!heap_fsm_get (thread_p, hfid, heap_hdr, &fsm))
+    {
+      if (HEAP_HDR_HAS_FSM (heap_hdr) || heap_hdr->estimates.num_pages < HEAP_FSM_MIN_HEAP_PAGES)
+	{
+	  return HEAP_FINDSPACE_NOTFOUND;
+	}
+      if (heap_fsm_create (thread_p, hfid, heap_hdr, hdr_pgptr, &fsm) != NO_ERROR)
+	{
+	  /* not fatal; pages are allocated as before */
+	  er_clear ();
+	}
+      /* a new map is empty */
+      return HEAP_FINDSPACE_NOTFOUND;
+    }
+
+  min_category = CEIL_PTVDIV (needed_space, HEAP_FSM_CATEGORY_UNIT);
+  if (min_category >= HEAP_FSM_NUM_CATEGORIES)
+    {
+      return HEAP_FINDSPACE_NOTFOUND;
+    }
+
+  hdr_vpid.volid = hfid->vfid.volid;
+  hdr_vpid.pageid = hfid->hpgid;
 
-	  pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
+  VPID_SET_NULL (&vpid);
+  for (num_tries = 0; num_tries < heap_Find_best_page_limit && found == HEAP_FINDSPACE_NOTFOUND; num_tries++)
+    {
+      if (!heap_fsm_search (thread_p, &fsm, min_category, &vpid))
+	{
+	  break;
 	}
 
-      assert (pg_watcher.pgptr == NULL);
-      if (old_pg_watcher.pgptr != NULL)
+      if (VPID_EQ (&vpid, &hdr_vpid))
 	{
-	  pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
+	  /* header page is already latched; it is left to best space hints */
+	  continue;
 	}
 
-      if (scan_all == false
-	  && (iterate_all == true || num_high_best == HEAP_NUM_BEST_SPACESTATS
-	      || (can_cycle == false && VPID_EQ (&next_vpid, &stopat_vpid))))
+      /* do not wait for busy pages */
+      pgptr = pgbuf_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, PGBUF_CONDITIONAL_LATCH);
+      if (pgptr == NULL)
 	{
-	  break;
+	  if (er_errid () == ER_INTERRUPTED)
+	    {
+	      found = HEAP_FINDSPACE_ERROR;
+	      break;
+	    }
+	  if (er_errid () == ER_PB_BAD_PAGEID)
+	    {
+	      /* page was deallocated from heap */
+	      er_clear ();
+	      heap_fsm_set_freespace (thread_p, &fsm, &vpid, 0);
+	    }
+	  continue;
 	}
 
-      VPID_SET_NULL (&next_vpid);
-    }
+      if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP
+	  || spage_get_record (thread_p, pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &chain_recdes, PEEK) != S_SUCCESS
+	  || chain_recdes.length < (int) sizeof (OID) || !OID_EQ ((OID *) chain_recdes.data, &heap_hdr->class_oid))
+	{
+	  /* page was reused by another file */
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	  heap_fsm_set_freespace (thread_p, &fsm, &vpid, 0);
+	  continue;
+	}
 
-  er_log_debug (ARG_FILE_LINE,
-		"heap_stats_sync_bestspace: scans from {%d|%d} to {%d|%d}, num_iterations(%d) "
-		"max_iterations(%d) num_high_best(%d)\n", start_vpid.volid, start_vpid.pageid, vpid.volid, vpid.pageid,
-		num_iterations, max_iterations, num_high_best);
+      freespace = spage_max_space_for_new_record (thread_p, pgptr);
+      if (freespace >= needed_space)
+	{
+	  /* Decrement by only the amount space needed by the caller. */
+	  freespace -= record_length + heap_Slotted_overhead;
+	  found = HEAP_FINDSPACE_FOUND;
+	  perfmon_inc_stat (thread_p, PSTAT_HEAP_NUM_FSM_FOUND_PAGES);
 
-  /* If we have scanned all pages, we should update all statistics even if we have not found any hints. This logic is
-   * used to handle "select count(*) from table". */
-  if (scan_all == false && num_high_best == 0 && heap_hdr->estimates.num_second_best == 0)
-    {
-      return 0;
-    }
+	  if (prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0)
+	    {
+	      /* following inserts find the page in best space cache */
+	      (void) heap_stats_add_bestspace (thread_p, hfid, &vpid, freespace);
+	    }
+	}
 
-  if (num_high_best < HEAP_NUM_BEST_SPACESTATS)
-    {
-      for (i = best; i < HEAP_NUM_BEST_SPACESTATS; i++)
+      heap_fsm_set_freespace (thread_p, &fsm, &vpid, freespace);
+
+      if (found == HEAP_FINDSPACE_FOUND)
 	{
-	  VPID_SET_NULL (&best_pages_hint_p[i].vpid);
-	  best_pages_hint_p[i].freespace = 0;
+	  pgbuf_attach_watcher (thread_p, pgptr, PGBUF_LATCH_WRITE, (HFID *) hfid, pg_watcher);
+	}
+      else
+	{
+	  pgbuf_unfix_and_init (thread_p, pgptr);
 	}
     }
 
-  heap_hdr->estimates.head = best;	/* reinit */
-  heap_hdr->estimates.num_high_best = num_high_best;
-  assert (heap_hdr->estimates.head >= 0 && heap_hdr->estimates.head < HEAP_NUM_BEST_SPACESTATS
-	  && heap_hdr->estimates.num_high_best <= HEAP_NUM_BEST_SPACESTATS);
+  return found;
+}
 
-  if (scan_all == true || heap_hdr->estimates.num_pages <= num_pages)
+/*
+ * heap_fsm_get_usage () - Sum up the free space recorded in free space map
+ *   return: error code
+ *   fsm(in): free space map
+ *   num_free_pages(out): number of pages with at least HEAP_DROP_FREE_SPACE free
+ *   free_space(out): lower bound of free space of all recorded pages
+ */
+static int
+heap_fsm_get_usage (THREAD_ENTRY * thread_p, const HEAP_FSM * fsm, INT64 * num_free_pages, INT64 * free_space)
+{
+  PAGE_PTR root_page = NULL;
+  PAGE_PTR leaf_page = NULL;
+  HEAP_FSM_ROOT *root;
+  HEAP_FSM_LEAF_REF *leaves;
+  UINT8 *categories;
+  int i, j, min_category;
+  int error_code = NO_ERROR;
+
+  *num_free_pages = 0;
+  *free_space = 0;
+
+  root_page = heap_fsm_fix_root (thread_p, fsm, PGBUF_LATCH_READ);
+  if (root_page == NULL)
     {
-      /* 
-       * We scan the whole heap.
-       * Reset its statistics with new found statistics
-       */
-      heap_hdr->estimates.num_other_high_best = num_other_best;
-      heap_hdr->estimates.num_pages = num_pages;
-      heap_hdr->estimates.num_recs = num_recs;
-      heap_hdr->estimates.recs_sumlen = recs_sumlen;
+      return NO_ERROR;
     }
-  else
-    {
-      /* 
-       * We did not scan the whole heap.
-       * We reset only some of its statistics since we do not have any idea
-       * which ones are better the ones that are currently recorded or the ones
-       * just found.
-       */
-      heap_hdr->estimates.num_other_high_best -= heap_hdr->estimates.num_high_best;
+  root = (HEAP_FSM_ROOT *) root_page;
+  leaves = HEAP_FSM_ROOT_LEAVES (root);
 
-      if (heap_hdr->estimates.num_other_high_best < num_other_best)
+  min_category = heap_fsm_category (HEAP_DROP_FREE_SPACE);
+
+  for (i = 0; i < root->num_leaves; i++)
+    {
+      leaf_page = pgbuf_fix (thread_p, &leaves[i].vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (leaf_page == NULL)
 	{
-	  heap_hdr->estimates.num_other_high_best = num_other_best;
+	  ASSERT_ERROR_AND_SET (error_code);
+	  break;
 	}
 
-      if (num_recs > heap_hdr->estimates.num_recs || recs_sumlen > heap_hdr->estimates.recs_sumlen)
+      categories = HEAP_FSM_LEAF_CATEGORIES (leaf_page);
+      for (j = 0; j < HEAP_FSM_LEAF_NPAGES; j++)
 	{
-	  heap_hdr->estimates.num_pages = num_pages;
-	  heap_hdr->estimates.num_recs = num_recs;
-	  heap_hdr->estimates.recs_sumlen = recs_sumlen;
+	  if (categories[j] >= min_category)
+	    {
+	      (*num_free_pages)++;
+	    }
+	  *free_space += categories[j] * HEAP_FSM_CATEGORY_UNIT;
 	}
-    }
 
-#if defined (CUBRID_DEBUG)
-  tsc_getticks (&end_tick);
-  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-  elapsed = (float) tv_diff.tv_sec * 1000000;
-  elapsed += (float) tv_diff.tv_usec;
-  elapsed /= 1000000;
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+    }
 
-  er_log_debug (ARG_FILE_LINE, "heap_stats_sync_bestspace: elapsed time %.6f", elapsed);
-#endif /* CUBRID_DEBUG */
+  pgbuf_unfix_and_init (thread_p, root_page);
 
-  return num_high_best;
+  return error_code;
 }
 
 /*
@@ -5246,6 +6343,7 @@ heap_create_internal (THREAD_ENTRY * thread_p, HFID * hfid, const OID * class_oi
   memset (&heap_hdr, 0, sizeof (heap_hdr));
   heap_hdr.class_oid = *class_oid;
   VFID_SET_NULL (&heap_hdr.ovf_vfid);
+  VFID_SET_NULL (&heap_hdr.fsm_vfid);
   VPID_SET_NULL (&heap_hdr.next_vpid);
 
   heap_hdr.unfill_space = (int) ((float) DB_PAGESIZE * prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
@@ -5603,6 +6701,8 @@ heap_reuse (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid, c
    * and reset unfill space according to new parameters
    */
   VFID_SET_NULL (&heap_hdr->ovf_vfid);
+  VFID_SET_NULL (&heap_hdr->fsm_vfid);
+  heap_fsm_cache_remove (hfid);
   heap_hdr->unfill_space = (int) ((float) DB_PAGESIZE * prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
   heap_hdr->estimates.num_pages = npages;
   heap_hdr->estimates.num_recs = 0;
@@ -5743,6 +6843,10 @@ xheap_destroy (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid
     {
       file_postpone_destroy (thread_p, &vfid);
     }
+  if (heap_fsm_find_vfid (thread_p, hfid, &vfid) != NULL)
+    {
+      file_postpone_destroy (thread_p, &vfid);
+    }
 
   file_postpone_destroy (thread_p, &hfid->vfid);
 
@@ -5786,6 +6890,10 @@ xheap_destroy_newly_created (THREAD_ENTRY * thread_p, const HFID * hfid, const O
     {
       file_postpone_destroy (thread_p, &vfid);
     }
+  if (heap_fsm_find_vfid (thread_p, hfid, &vfid) != NULL)
+    {
+      file_postpone_destroy (thread_p, &vfid);
+    }
 
   log_append_postpone (thread_p, RVHF_MARK_DELETED, &addr, sizeof (hfid->vfid), &hfid->vfid);
 
@@ -14990,6 +16098,14 @@ heap_stats_bestspace_initialize (void)
       goto exit_on_error;
     }
 
+  heap_Bestspace->fsm_ht =
+    mht_create ("Memory hash HFID to {free space map}", HEAP_STATS_ENTRY_MHT_EST_SIZE, heap_hash_hfid,
+		heap_compare_hfid);
+  if (heap_Bestspace->fsm_ht == NULL)
+    {
+      goto exit_on_error;
+    }
+
   heap_Bestspace->num_alloc = 0;
   heap_Bestspace->num_free = 0;
   heap_Bestspace->free_list_count = 0;
@@ -15049,6 +16165,13 @@ heap_stats_bestspace_finalize (void)
       heap_Bestspace->hfid_ht = NULL;
     }
 
+  if (heap_Bestspace->fsm_ht != NULL)
+    {
+      (void) mht_clear (heap_Bestspace->fsm_ht, heap_fsm_cache_entry_free, NULL);
+      mht_destroy (heap_Bestspace->fsm_ht);
+      heap_Bestspace->fsm_ht = NULL;
+    }
+
   pthread_mutex_destroy (&heap_Bestspace->bestspace_mutex);
 
   heap_Bestspace = NULL;
@@ -17724,6 +18847,8 @@ heap_header_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_valu
   HFID *hfid_p;
   char *class_name = NULL;
   int avg_length = 0;
+  HEAP_FSM fsm;
+  INT64 fsm_num_free_pages, fsm_free_space;
   char buf[512] = { 0 };
   char temp[64] = { 0 };
   char *buf_p, *end;
@@ -17917,6 +19042,37 @@ heap_header_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_valu
       goto cleanup;
     }
 
+  /* Free space map */
+  fsm_num_free_pages = 0;
+  fsm_free_space = 0;
+  if (heap_fsm_get (thread_p, hfid_p, heap_hdr, &fsm))
+    {
+      error = heap_fsm_get_usage (thread_p, &fsm, &fsm_num_free_pages, &fsm_free_space);
+      if (error != NO_ERROR)
+	{
+	  goto cleanup;
+	}
+      vfid_to_string (buf, sizeof (buf), &fsm.vfid);
+    }
+  else
+    {
+      VFID null_vfid = { NULL_FILEID, NULL_VOLID };
+
+      vfid_to_string (buf, sizeof (buf), &null_vfid);
+    }
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  db_make_bigint (out_values[idx], fsm_num_free_pages);
+  idx++;
+
+  db_make_bigint (out_values[idx], fsm_free_space);
+  idx++;
+
   assert (idx == out_cnt);
 
 cleanup:
@@ -22600,6 +23756,190 @@ error:
   return rc;
 }
 
+/*
+ * heap_insert_logical_batch () - Insert a batch of objects onto heap
+ *   thread_p(in): thread entry
+ *   hfid_p(in): heap file identifier
+ *   class_oid_p(in): class object identifier
+ *   recdes_array(in): records of objects to insert
+ *   num_recdes(in): number of records
+ *   scan_cache_p(in): scan cache
+ *   oid_array(out): OIDs of inserted objects
+ *   return: error code or NO_ERROR
+ *
+ * Note: Each object is inserted like heap_insert_logical does, but the class
+ *       is locked once and the insert page is kept fixed while the next
+ *       objects fit in it (keeping the heap unfill space). Only the first
+ *       object of each page has to search the best space statistics under
+ *       the heap header page latch.
+ *       Multipage objects release the insert page before being inserted in
+ *       overflow.
+ */
+int
+heap_insert_logical_batch (THREAD_ENTRY * thread_p, HFID * hfid_p, OID * class_oid_p, RECDES * recdes_array,
+			   int num_recdes, HEAP_SCANCACHE * scan_cache_p, OID * oid_array)
+{
+  HEAP_OPERATION_CONTEXT context;
+  PGBUF_WATCHER page_watcher;
+  PERF_UTIME_TRACKER time_track;
+  bool is_mvcc_class, is_mvcc_op;
+  int unfill_space;
+  int num_appended = 0;
+  float appended_sumlen = 0;
+  int i;
+  int rc = NO_ERROR;
+
+  assert (hfid_p != NULL && !HFID_IS_NULL (hfid_p));
+  assert (class_oid_p != NULL && !OID_ISNULL (class_oid_p) && !OID_IS_ROOTOID (class_oid_p));
+  assert (recdes_array != NULL && num_recdes > 0);
+  assert (oid_array != NULL);
+
+  PGBUF_INIT_WATCHER (&page_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid_p);
+
+  /* check scancache */
+  if (heap_scancache_check_with_hfid (thread_p, hfid_p, class_oid_p, &scan_cache_p) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  /* make sure we have IX_LOCK on class see [NOTE-1] of heap_insert_logical */
+  if (lock_object (thread_p, class_oid_p, oid_Root_class_oid, IX_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
+    {
+      return ER_FAILED;
+    }
+
+  is_mvcc_class = !mvcc_is_mvcc_disabled_class (class_oid_p);
+#if defined (SERVER_MODE)
+  is_mvcc_op = is_mvcc_class;
+#else /* SERVER_MODE */
+  is_mvcc_op = false;
+#endif /* SERVER_MODE */
+
+  /* same unfill space heap_stats_find_best_page keeps in pages with objects */
+  unfill_space = (int) ((float) DB_PAGESIZE * prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
+
+  for (i = 0; i < num_recdes; i++)
+    {
+      assert (recdes_array[i].type == REC_HOME);
+
+      heap_create_insert_context (&context, hfid_p, class_oid_p, &recdes_array[i], scan_cache_p);
+      context.time_track = &time_track;
+      HEAP_PERF_START (thread_p, &context);
+
+      if (heap_insert_adjust_recdes_header (thread_p, &context, is_mvcc_class) != NO_ERROR)
+	{
+	  rc = ER_FAILED;
+	  goto exit;
+	}
+
+#if defined(ENABLE_SYSTEMTAP)
+      CUBRID_OBJ_INSERT_START (&context.class_oid);
+#endif /* ENABLE_SYSTEMTAP */
+
+      if (heap_is_big_length (context.recdes_p->length))
+	{
+	  /* overflow pages are fixed while inserting the object; don't hold the insert page */
+	  if (page_watcher.pgptr != NULL)
+	    {
+	      pgbuf_ordered_unfix (thread_p, &page_watcher);
+	    }
+	  if (heap_insert_handle_multipage_record (thread_p, &context) != NO_ERROR)
+	    {
+	      rc = ER_FAILED;
+	      goto exit;
+	    }
+	}
+
+      if (page_watcher.pgptr != NULL
+	  && spage_max_space_for_new_record (thread_p, page_watcher.pgptr) - unfill_space >= context.recdes_p->length)
+	{
+	  /* append to the page of previous object */
+	  rc = heap_get_insert_location_with_lock (thread_p, &context, &page_watcher);
+	  if (rc != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	  num_appended++;
+	  appended_sumlen += (float) context.recdes_p->length;
+	}
+      else
+	{
+	  if (page_watcher.pgptr != NULL)
+	    {
+	      pgbuf_ordered_unfix (thread_p, &page_watcher);
+	    }
+
+	  /* get insert location (includes locking) */
+	  rc = heap_get_insert_location_with_lock (thread_p, &context, NULL);
+	  if (rc != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+
+	  /* keep page for next objects */
+	  pgbuf_replace_watcher (thread_p, context.home_page_watcher_p, &page_watcher);
+	  context.home_page_watcher_p = &page_watcher;
+	}
+
+      HEAP_PERF_TRACK_PREPARE (thread_p, &context);
+
+      if (heap_insert_physical (thread_p, &context) != NO_ERROR)
+	{
+	  rc = ER_FAILED;
+	  goto exit;
+	}
+
+      HEAP_PERF_TRACK_EXECUTE (thread_p, &context);
+
+      heap_log_insert_physical (thread_p, page_watcher.pgptr, &context.hfid.vfid, &context.res_oid, context.recdes_p,
+				is_mvcc_op, false);
+
+      HEAP_PERF_TRACK_LOGGING (thread_p, &context);
+
+      pgbuf_set_dirty (thread_p, page_watcher.pgptr, DONT_FREE);
+
+      /* unfix other pages */
+      heap_unfix_watchers (thread_p, &context);
+
+      COPY_OID (&oid_array[i], &context.res_oid);
+
+      if (context.recdes_p->type == REC_HOME)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_HEAP_HOME_INSERTS);
+	}
+      else
+	{
+	  assert (context.recdes_p->type == REC_BIGONE);
+	  perfmon_inc_stat (thread_p, PSTAT_HEAP_BIG_INSERTS);
+	}
+
+#if defined(ENABLE_SYSTEMTAP)
+      CUBRID_OBJ_INSERT_END (&context.class_oid, 0);
+#endif /* ENABLE_SYSTEMTAP */
+    }
+
+exit:
+  if (rc != NO_ERROR)
+    {
+#if defined(ENABLE_SYSTEMTAP)
+      CUBRID_OBJ_INSERT_END (&context.class_oid, 1);
+#endif /* ENABLE_SYSTEMTAP */
+      heap_unfix_watchers (thread_p, &context);
+    }
+  if (page_watcher.pgptr != NULL)
+    {
+      pgbuf_ordered_unfix (thread_p, &page_watcher);
+    }
+
+  if (num_appended > 0)
+    {
+      /* objects appended without looking for best page were not counted in heap estimates */
+      heap_stats_add_estimates (thread_p, hfid_p, num_appended, appended_sumlen);
+    }
+
+  return rc;
+}
+
 /*
  * heap_delete_logical () - Delete an object from heap file
  *   thread_p(in): thread entry
@@ -643,6 +643,8 @@ extern void heap_create_delete_context (HEAP_OPERATION_CONTEXT * context, HFID *
 extern void heap_create_update_context (HEAP_OPERATION_CONTEXT * context, HFID * hfid_p, OID * oid_p, OID * class_oid_p,
 					RECDES * recdes_p, HEAP_SCANCACHE * scancache_p, UPDATE_INPLACE_STYLE in_place);
 extern int heap_insert_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
+extern int heap_insert_logical_batch (THREAD_ENTRY * thread_p, HFID * hfid_p, OID * class_oid_p, RECDES * recdes_array,
+				      int num_recdes, HEAP_SCANCACHE * scan_cache_p, OID * oid_array);
 extern int heap_delete_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
 extern int heap_update_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
 
@@ -218,6 +218,8 @@ typedef enum
 #define PGBUF_BCB_TO_VACUUM_FLAG            ((int) 0x04000000)
 /* flag for asynchronous flush request */
 #define PGBUF_BCB_ASYNC_FLUSH_REQ           ((int) 0x02000000)
+/* flag for bcb's holding a page of a temporary volume. they are counted in pgbuf_Pool.num_temp_pages. */
+#define PGBUF_BCB_TEMP_PAGE_FLAG            ((int) 0x01000000)
 
 /* add all flags here */
 #define PGBUF_BCB_FLAGS_MASK \
@@ -227,7 +229,8 @@ typedef enum
    | PGBUF_BCB_INVALIDATE_DIRECT_VICTIM_FLAG \
    | PGBUF_BCB_MOVE_TO_LRU_BOTTOM_FLAG \
    | PGBUF_BCB_TO_VACUUM_FLAG \
-   | PGBUF_BCB_ASYNC_FLUSH_REQ)
+   | PGBUF_BCB_ASYNC_FLUSH_REQ \
+   | PGBUF_BCB_TEMP_PAGE_FLAG)
 
 /* add flags that invalidate a victim candidate here */
 /* 1. dirty bcb's cannot be victimized.
@@ -414,6 +417,7 @@ enum
 typedef struct pgbuf_holder PGBUF_HOLDER;
 typedef struct pgbuf_holder_anchor PGBUF_HOLDER_ANCHOR;
 typedef struct pgbuf_holder_set PGBUF_HOLDER_SET;
+typedef struct pgbuf_ring PGBUF_RING;
 
 typedef struct pgbuf_bcb PGBUF_BCB;
 typedef struct pgbuf_iopage_buffer PGBUF_IOPAGE_BUFFER;
@@ -457,8 +461,17 @@ struct pgbuf_holder_stat
   unsigned hold_has_read_latch:1;	/* page has/had read latch */
 };
 
+typedef struct pgbuf_batch_flush_page PGBUF_BATCH_FLUSH_PAGE;
 typedef struct pgbuf_batch_flush_helper PGBUF_BATCH_FLUSH_HELPER;
 
+/* page of a batch flush, between the copy of the page and the end of its write */
+struct pgbuf_batch_flush_page
+{
+  PGBUF_BCB *bufptr;
+  LOG_LSA oldest_unflush_lsa;	/* restored if write fails */
+  bool was_dirty;		/* restored if write fails */
+};
+
 struct pgbuf_batch_flush_helper
 {
   int npages;
@@ -466,6 +479,12 @@ struct pgbuf_batch_flush_helper
   int back_offset;
   PGBUF_BCB *pages_bufptr[2 * PGBUF_MAX_NEIGHBOR_PAGES - 1];
   VPID vpids[2 * PGBUF_MAX_NEIGHBOR_PAGES - 1];
+
+  /* the collected pages are copied and written together */
+  char *iopages_area;		/* copies of pages */
+  PGBUF_BATCH_FLUSH_PAGE flush_pages[2 * PGBUF_MAX_NEIGHBOR_PAGES - 1];
+  FILEIO_WRITE_REQUEST write_requests[2 * PGBUF_MAX_NEIGHBOR_PAGES - 1];
+  int written_pages;		/* pages of batch successfully written */
 };
 
 /* BCB holder entry */
@@ -495,6 +514,19 @@ struct pgbuf_holder_anchor
   PGBUF_HOLDER *thrd_hold_list;	/* used(or hold) BCB holder list */
 };
 
+/* buffer ring of a thread running a large sequential scan. the pages read by the scan are added to the bottom of lru
+ * lists and their bcb's are victimized again by the same scan, instead of flooding the buffer. */
+#define PGBUF_RING_SIZE 32
+
+struct pgbuf_ring
+{
+  int depth;			/* > 0 while the thread reads pages of a large sequential scan */
+  int pos;			/* ring slot victimized next */
+  PGBUF_BCB *bcbs[PGBUF_RING_SIZE];	/* bcb's of pages recently read by the scan */
+};
+
+#define PGBUF_THREAD_RING(thread_p) (&pgbuf_Pool.thrd_rings[THREAD_GET_CURRENT_ENTRY_INDEX (thread_p)])
+
 /* the entry(array structure) of free BCB holder list shared by threads */
 struct pgbuf_holder_set
 {
@@ -533,6 +565,8 @@ struct pgbuf_bcb
 
   volatile LOG_LSA oldest_unflush_lsa;	/* The oldest LSA record of the page that has not been written to disk */
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
+  volatile int version;		/* changed when page is write latched or unlatched and when bcb enters or leaves hash
+				 * chain. odd while bcb is not in hash chain. see pgbuf_copy_page_optimistic. */
 };
 
 /* iopage buffer structure */
@@ -756,6 +790,8 @@ struct pgbuf_buffer_pool
   int num_LRU_list;		/* number of shared LRU lists */
   float ratio_lru1;		/* ratio for lru 1 zone */
   float ratio_lru2;		/* ratio for lru 2 zone */
+  int num_temp_pages;		/* number of bcb's holding pages of temporary volumes */
+  int max_temp_pages;		/* above this number, temporary pages are added to the bottom of lru lists */
   PGBUF_LRU_LIST *buf_LRU_list;	/* LRU lists. When Page quota is enabled, first 'num_LRU_list' store shared pages;
 				 * the next 'num_garbage_LRU_list' lists store shared garbage pages;
 				 * the last 'num_private_LRU_list' are private lists.
@@ -779,6 +815,9 @@ struct pgbuf_buffer_pool
   PGBUF_HOLDER_ANCHOR *thrd_holder_info;
   PGBUF_HOLDER *thrd_reserved_holder;
 
+  /* buffer rings of large sequential scans, one for each thread */
+  PGBUF_RING *thrd_rings;
+
   /* 
    * free BCB holder list shared by all the threads.
    * When a thread needs more free BCB holder entries,
@@ -961,6 +1000,7 @@ static int pgbuf_initialize_page_quota_parameters (void);
 static int pgbuf_initialize_page_quota (void);
 static int pgbuf_initialize_page_monitor (void);
 static int pgbuf_initialize_thrd_holder (void);
+static int pgbuf_initialize_thrd_rings (void);
 STATIC_INLINE PGBUF_HOLDER *pgbuf_allocate_thrd_holder_entry (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE PGBUF_HOLDER *pgbuf_find_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
   __attribute__ ((ALWAYS_INLINE));
@@ -1044,6 +1084,11 @@ STATIC_INLINE void pgbuf_lru_remove_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bc
 static void pgbuf_lru_move_from_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb);
 static void pgbuf_move_bcb_to_bottom_lru (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb);
 
+STATIC_INLINE bool pgbuf_bcb_begin_flush (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, FILEIO_PAGE * iopage,
+					   LOG_LSA * oldest_unflush_lsa) __attribute__ ((ALWAYS_INLINE));
+static int pgbuf_bcb_end_flush (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_page_flush_thread,
+				const LOG_LSA * oldest_unflush_lsa, bool was_dirty, int write_error,
+				bool * is_bcb_locked);
 STATIC_INLINE int pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_page_flush_thread,
 					    bool * is_bcb_locked) __attribute__ ((ALWAYS_INLINE));
 static void pgbuf_wake_flush_waiters (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb);
@@ -1102,6 +1147,10 @@ static bool pgbuf_is_thread_high_priority (THREAD_ENTRY * thread_p);
 #endif /* SERVER_MODE */
 static int pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int *flushed_pages);
 STATIC_INLINE void pgbuf_add_bufptr_to_batch (PGBUF_BCB * bufptr, int idx) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool pgbuf_begin_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * expected_vpid,
+						    FILEIO_PAGE * iopage, PGBUF_BATCH_FLUSH_PAGE * flush_page)
+  __attribute__ ((ALWAYS_INLINE));
+static void pgbuf_end_flush_neighbor (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * request, int error);
 STATIC_INLINE int pgbuf_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * expected_vpid,
 					     bool * flushed) __attribute__ ((ALWAYS_INLINE));
 
@@ -1162,6 +1211,8 @@ STATIC_INLINE void pgbuf_bcb_change_zone (THREAD_ENTRY * thread_p, PGBUF_BCB * b
 STATIC_INLINE PGBUF_ZONE pgbuf_bcb_get_zone (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_bcb_get_lru_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_bcb_get_pool_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_set_latch_mode (PGBUF_BCB * bcb, PGBUF_LATCH_MODE latch_mode)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_dirty (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_mark_is_flushing (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
   __attribute__ ((ALWAYS_INLINE));
@@ -1171,6 +1222,11 @@ STATIC_INLINE bool pgbuf_bcb_is_invalid_direct_victim (const PGBUF_BCB * bcb) __
 STATIC_INLINE bool pgbuf_bcb_is_async_flush_request (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_to_vacuum (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_should_be_moved_to_bottom_lru (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool pgbuf_bcb_is_temp_page_over_quota (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_clear_temp_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool pgbuf_is_thread_in_ring (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_ring_add_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+static PGBUF_BCB *pgbuf_get_victim_from_ring (THREAD_ENTRY * thread_p);
 STATIC_INLINE bool pgbuf_bcb_avoid_victim (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_set_dirty (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_clear_dirty (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
@@ -1320,6 +1376,10 @@ pgbuf_initialize (void)
   assert ((pgbuf_Pool.ratio_lru1 + pgbuf_Pool.ratio_lru2) >= 0.099f
 	  && (pgbuf_Pool.ratio_lru1 + pgbuf_Pool.ratio_lru2) <= 0.951f);
 
+  /* temporary pages above this share of the buffer are victimized first */
+  pgbuf_Pool.num_temp_pages = 0;
+  pgbuf_Pool.max_temp_pages = (int) (pgbuf_Pool.num_buffers * prm_get_float_value (PRM_ID_PB_TEMP_PAGES_RATIO));
+
   /* keep page quota parameter initializer first */
   if (pgbuf_initialize_page_quota_parameters () != NO_ERROR)
     {
@@ -1361,6 +1421,20 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  if (pgbuf_initialize_thrd_rings () != NO_ERROR)
+    {
+      goto error;
+    }
+
+  /* area for copies of pages flushed together with their neighbors */
+  pgbuf_Flush_helper.iopages_area = (char *) malloc ((2 * PGBUF_MAX_NEIGHBOR_PAGES - 1) * IO_PAGESIZE + MAX_ALIGNMENT);
+  if (pgbuf_Flush_helper.iopages_area == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) ((2 * PGBUF_MAX_NEIGHBOR_PAGES - 1) * IO_PAGESIZE + MAX_ALIGNMENT));
+      goto error;
+    }
+
   /* keep page quota initializer first */
   if (pgbuf_initialize_page_quota () != NO_ERROR)
     {
@@ -1560,6 +1634,17 @@ pgbuf_finalize (void)
       free_and_init (pgbuf_Pool.thrd_reserved_holder);
     }
 
+  /* final task for thrd_rings */
+  if (pgbuf_Pool.thrd_rings != NULL)
+    {
+      free_and_init (pgbuf_Pool.thrd_rings);
+    }
+
+  if (pgbuf_Flush_helper.iopages_area != NULL)
+    {
+      free_and_init (pgbuf_Flush_helper.iopages_area);
+    }
+
   /* final task for free holder set */
   pthread_mutex_destroy (&pgbuf_Pool.free_holder_set_mutex);
   while (pgbuf_Pool.free_holder_set != NULL)
@@ -2266,7 +2351,7 @@ pgbuf_promote_read_latch_release (THREAD_ENTRY * thread_p, PAGE_PTR * pgptr_p, P
 	}
 
       /* we're the single holder of the read latch, do an in-place promotion */
-      bufptr->latch_mode = PGBUF_LATCH_WRITE;
+      pgbuf_bcb_set_latch_mode (bufptr, PGBUF_LATCH_WRITE);
       holder->perf_stat.hold_has_write_latch = 1;
       /* NOTE: no need to set the promoted flag as long as we don't wait */
       PGBUF_BCB_UNLOCK (bufptr);
@@ -2379,7 +2464,7 @@ end:
   return rv;
 
 #else /* SERVER_MODE */
-  bufptr->latch_mode = PGBUF_LATCH_WRITE;
+  pgbuf_bcb_set_latch_mode (bufptr, PGBUF_LATCH_WRITE);
   return NO_ERROR;
 #endif
 }
@@ -4752,7 +4837,7 @@ pgbuf_set_bcb_page_vpid (PGBUF_BCB * bufptr)
 	  bufptr->iopage_buffer->iopage.prv.volid = bufptr->vpid.volid;
 
 	  bufptr->iopage_buffer->iopage.prv.ptype = '\0';
-	  bufptr->iopage_buffer->iopage.prv.pflag_reserve_1 = '\0';
+	  bufptr->iopage_buffer->iopage.prv.pflag = '\0';
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_2 = 0;
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_3 = 0;
 	}
@@ -4899,6 +4984,7 @@ pgbuf_initialize_bcb_table (void)
       VPID_SET_NULL (&bufptr->vpid);
       bufptr->fcnt = 0;
       bufptr->latch_mode = PGBUF_LATCH_INVALID;
+      bufptr->version = 1;
 
 #if defined(SERVER_MODE)
       bufptr->next_wait_thrd = NULL;
@@ -4935,7 +5021,7 @@ pgbuf_initialize_bcb_table (void)
 
 #if 1				/* do not delete me */
       ioptr->iopage.prv.ptype = '\0';
-      ioptr->iopage.prv.pflag_reserve_1 = '\0';
+      ioptr->iopage.prv.pflag = '\0';
       ioptr->iopage.prv.p_reserve_2 = 0;
       ioptr->iopage.prv.p_reserve_3 = 0;
 #endif
@@ -5285,6 +5371,27 @@ pgbuf_initialize_thrd_holder (void)
   return NO_ERROR;
 }
 
+/*
+ * pgbuf_initialize_thrd_rings () - initialize the buffer rings of large sequential scans, one for each thread
+ *   return: NO_ERROR, or ER_code
+ */
+static int
+pgbuf_initialize_thrd_rings (void)
+{
+  size_t alloc_size;
+
+  alloc_size = thread_num_total_threads () * sizeof (PGBUF_RING);
+  pgbuf_Pool.thrd_rings = (PGBUF_RING *) malloc (alloc_size);
+  if (pgbuf_Pool.thrd_rings == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (pgbuf_Pool.thrd_rings, 0, alloc_size);
+
+  return NO_ERROR;
+}
+
 /*
  * pgbuf_allocate_thrd_holder_entry () - Allocates one buffer holder entry
  *   			from the free holder list of given thread
@@ -5549,7 +5656,7 @@ pgbuf_latch_idle_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_
 
   buf_is_dirty = pgbuf_bcb_is_dirty (bufptr);
 
-  bufptr->latch_mode = request_mode;
+  pgbuf_bcb_set_latch_mode (bufptr, request_mode);
   bufptr->fcnt = 1;
 
   PGBUF_BCB_UNLOCK (bufptr);
@@ -5813,7 +5920,7 @@ pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LAT
 
       if (bufptr->fcnt == holder->fix_count)
 	{
-	  bufptr->latch_mode = request_mode;	/* PGBUF_LATCH_WRITE */
+	  pgbuf_bcb_set_latch_mode (bufptr, request_mode);	/* PGBUF_LATCH_WRITE */
 	  bufptr->fcnt++;
 	  assert (0 < bufptr->fcnt);
 
@@ -6036,6 +6143,22 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
 	  switch (zone)
 	    {
 	    case PGBUF_VOID_ZONE:
+	      if (pgbuf_bcb_is_temp_page_over_quota (bufptr) && !PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
+		{
+		  /* temporary pages over quota must not push permanent pages out of the lru; they are the first to
+		   * be flushed and victimized. */
+		  pgbuf_move_bcb_to_bottom_lru (thread_p, bufptr);
+		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TEMP_TO_BOTTOM);
+		  break;
+		}
+	      if (pgbuf_is_thread_in_ring (thread_p) && !PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
+		{
+		  /* page read by a large sequential scan. keep it out of the way of other pages and recycle its bcb
+		   * for the next pages of the scan. */
+		  pgbuf_ring_add_bcb (thread_p, bufptr);
+		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_RING_TO_BOTTOM);
+		  break;
+		}
 	      /* bcb was recently allocated. the case may vary from never being used (or almost never), to up to few
 	       * percent (when hit ratio is very low). in any case, this is not needed to be very optimized here,
 	       * so the code was moved outside unlatch... do not inline it */
@@ -6131,6 +6254,18 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
 		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_LRU_THREE_PRV_TO_SHR_MID);
 		  break;
 		}
+	      if (pgbuf_bcb_is_temp_page_over_quota (bufptr))
+		{
+		  /* do not boost temporary pages over quota */
+		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_LRU_THREE_TEMP_KEEP);
+		  break;
+		}
+	      if (pgbuf_is_thread_in_ring (thread_p))
+		{
+		  /* a large sequential scan does not boost the pages it reads */
+		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_LRU_THREE_RING_KEEP);
+		  break;
+		}
 	      /* boost */
 	      pgbuf_lru_boost_bcb (thread_p, bufptr);
 	      pgbuf_bcb_register_hit_for_lru (bufptr);
@@ -6143,7 +6278,7 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
 	    }
 	}
 
-      bufptr->latch_mode = PGBUF_NO_LATCH;
+      pgbuf_bcb_set_latch_mode (bufptr, PGBUF_NO_LATCH);
 #if defined(SERVER_MODE)
       pgbuf_wakeup_reader_writer (thread_p, bufptr);
 #endif /* SERVER_MODE */
@@ -6778,7 +6913,7 @@ pgbuf_wakeup_reader_writer (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 	  if (thrd_entry->request_latch_mode != PGBUF_NO_LATCH)
 	    {
 	      /* grant the request */
-	      bufptr->latch_mode = thrd_entry->request_latch_mode;
+	      pgbuf_bcb_set_latch_mode (bufptr, (PGBUF_LATCH_MODE) thrd_entry->request_latch_mode);
 	      bufptr->fcnt += thrd_entry->request_fix_count;
 
 	      /* do not handle BCB holder entry, at here. refer pgbuf_latch_bcb_upon_fix () */
@@ -7017,6 +7152,8 @@ pgbuf_insert_into_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_
 
   bufptr->hash_next = hash_anchor->hash_next;
   hash_anchor->hash_next = bufptr;
+  /* bcb can be found again; optimistic readers may copy it */
+  ATOMIC_INC_32 (&bufptr->version, 1);
 
   /* 
    * hash_anchor->hash_mutex is not released at this place.
@@ -7074,7 +7211,7 @@ pgbuf_delete_from_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 
       /* Someone tries to fix the current buffer page. So, give up selecting current buffer page as a victim. */
       pthread_mutex_unlock (&hash_anchor->hash_mutex);
-      bufptr->latch_mode = PGBUF_NO_LATCH;
+      pgbuf_bcb_set_latch_mode (bufptr, PGBUF_NO_LATCH);
       PGBUF_BCB_UNLOCK (bufptr);
       return ER_FAILED;
     }
@@ -7119,6 +7256,8 @@ pgbuf_delete_from_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 
       curr_bufptr->hash_next = NULL;
       pthread_mutex_unlock (&hash_anchor->hash_mutex);
+      /* bcb may get a new page; optimistic readers must not copy it until it is back in hash chain */
+      ATOMIC_INC_32 (&bufptr->version, 1);
       VPID_SET_NULL (&(bufptr->vpid));
       pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
 
@@ -7384,6 +7523,17 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
       PERF_UTIME_TRACKER_START (thread_p, &time_tracker_alloc_search_and_wait);
     }
 
+  /* a large sequential scan first recycles the bcb's of its own pages */
+  if (pgbuf_is_thread_in_ring (thread_p))
+    {
+      bufptr = pgbuf_get_victim_from_ring (thread_p);
+      if (bufptr != NULL)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_PB_VICTIM_USE_RING_BCB);
+	  goto end;
+	}
+    }
+
   /* search lru lists */
   bufptr = pgbuf_get_victim (thread_p);
   PERF_UTIME_TRACKER_TIME_AND_RESTART (thread_p, &time_tracker_alloc_search_and_wait, PSTAT_PB_ALLOC_BCB_SEARCH_VICTIM);
@@ -7614,7 +7764,7 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   /* initialize the BCB */
   bufptr->vpid = *vpid;
   assert (!pgbuf_bcb_avoid_victim (bufptr));
-  bufptr->latch_mode = PGBUF_NO_LATCH;
+  pgbuf_bcb_set_latch_mode (bufptr, PGBUF_NO_LATCH);
   pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_ASYNC_FLUSH_REQ);	/* todo: why this?? */
   pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
   LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
@@ -7633,8 +7783,8 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	}
 #endif /* ENABLE_SYSTEMTAP */
 
-      if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
-		       vpid->pageid, IO_PAGESIZE) == NULL)
+      if (fileio_read_data_page (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
+				 vpid->pageid, IO_PAGESIZE) == NULL)
 	{
 	  /* There was an error in reading the page. Clean the buffer... since it may have been corrupted */
 	  ASSERT_ERROR ();
@@ -7728,6 +7878,12 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	}
     }
 
+  if (pgbuf_is_temporary_volume (vpid->volid) == true)
+    {
+      pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_TEMP_PAGE_FLAG, 0);
+      ATOMIC_INC_32 (&pgbuf_Pool.num_temp_pages, 1);
+    }
+
   return bufptr;
 }
 
@@ -7768,6 +7924,7 @@ pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
     {
       return ER_FAILED;
     }
+  pgbuf_bcb_clear_temp_page (thread_p, bufptr);
 
   /* If above function returns success, the caller is still holding bufptr->mutex.
    * Otherwise, the caller does not hold bufptr->mutex.
@@ -7845,7 +8002,7 @@ pgbuf_invalidate_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
     {
       /* todo: what to do? */
       assert (false);
-      bufptr->latch_mode = PGBUF_NO_LATCH;
+      pgbuf_bcb_set_latch_mode (bufptr, PGBUF_NO_LATCH);
       PGBUF_BCB_UNLOCK (bufptr);
     }
 
@@ -8043,8 +8200,9 @@ pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 #endif /* SERVER_MODE */
 
   /* the caller is holding bufptr->mutex */
+  pgbuf_bcb_clear_temp_page (thread_p, bufptr);
   VPID_SET_NULL (&bufptr->vpid);
-  bufptr->latch_mode = PGBUF_LATCH_INVALID;
+  pgbuf_bcb_set_latch_mode (bufptr, PGBUF_LATCH_INVALID);
   assert ((bufptr->flags & PGBUF_BCB_FLAGS_MASK) == 0);
   pgbuf_bcb_change_zone (thread_p, bufptr, 0, PGBUF_INVALID_ZONE);
   pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
@@ -9817,16 +9975,9 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
       return ER_FAILED;
     }
 
-  was_dirty = pgbuf_bcb_mark_is_flushing (thread_p, bufptr);
-
   iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
 
-  memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
-
-  LSA_COPY (&oldest_unflush_lsa, &bufptr->oldest_unflush_lsa);
-  LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
-
-  PGBUF_BCB_UNLOCK (bufptr);
+  was_dirty = pgbuf_bcb_begin_flush (thread_p, bufptr, iopage, &oldest_unflush_lsa);
   *is_bcb_locked = false;
 
   if (!LSA_ISNULL (&oldest_unflush_lsa))
@@ -9854,21 +10005,10 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
 #endif /* ENABLE_SYSTEMTAP */
 
   /* now, flush buffer page */
-  if (fileio_write (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage, bufptr->vpid.pageid,
-		    IO_PAGESIZE) == NULL)
+  if (fileio_write_data_page (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage,
+			      bufptr->vpid.pageid, IO_PAGESIZE) == NULL)
     {
-      PGBUF_BCB_LOCK (bufptr);
-      *is_bcb_locked = true;
-      pgbuf_bcb_mark_was_not_flushed (thread_p, bufptr, was_dirty);
-      LSA_COPY (&bufptr->oldest_unflush_lsa, &oldest_unflush_lsa);
       error = ER_FAILED;
-
-#if defined (SERVER_MODE)
-      if (bufptr->next_wait_thrd != NULL)
-	{
-	  pgbuf_wake_flush_waiters (thread_p, bufptr);
-	}
-#endif
     }
 
 #if defined(ENABLE_SYSTEMTAP)
@@ -9878,8 +10018,70 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
     }
 #endif /* ENABLE_SYSTEMTAP */
 
-  if (error != NO_ERROR)
+  return pgbuf_bcb_end_flush (thread_p, bufptr, is_page_flush_thread, &oldest_unflush_lsa, was_dirty, error,
+			      is_bcb_locked);
+}
+
+/*
+ * pgbuf_bcb_begin_flush () - start flushing a bcb: mark it as flushing, copy its page and unlock it.
+ *
+ * return                   : true if bcb was dirty
+ * thread_p (in)            : thread entry
+ * bufptr (in)              : bcb, locked by caller. it is unlocked on return.
+ * iopage (out)             : copy of page to write
+ * oldest_unflush_lsa (out) : oldest_unflush_lsa of bcb; bcb's is cleared
+ */
+STATIC_INLINE bool
+pgbuf_bcb_begin_flush (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, FILEIO_PAGE * iopage,
+		       LOG_LSA * oldest_unflush_lsa)
+{
+  bool was_dirty;
+
+  PGBUF_BCB_CHECK_OWN (bufptr);
+
+  was_dirty = pgbuf_bcb_mark_is_flushing (thread_p, bufptr);
+
+  memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
+
+  LSA_COPY (oldest_unflush_lsa, &bufptr->oldest_unflush_lsa);
+  LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+
+  PGBUF_BCB_UNLOCK (bufptr);
+
+  return was_dirty;
+}
+
+/*
+ * pgbuf_bcb_end_flush () - end flushing a bcb after its page was written (or failed to be written).
+ *
+ * return                    : error code
+ * thread_p (in)             : thread entry
+ * bufptr (in)               : bcb, not locked
+ * is_page_flush_thread (in) : true if caller is page flush thread. false otherwise.
+ * oldest_unflush_lsa (in)   : oldest_unflush_lsa saved by pgbuf_bcb_begin_flush
+ * was_dirty (in)            : dirty state saved by pgbuf_bcb_begin_flush
+ * write_error (in)          : error of page write
+ * is_bcb_locked (out)       : output whether bcb remains locked or not.
+ */
+static int
+pgbuf_bcb_end_flush (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_page_flush_thread,
+		     const LOG_LSA * oldest_unflush_lsa, bool was_dirty, int write_error, bool * is_bcb_locked)
+{
+  *is_bcb_locked = false;
+
+  if (write_error != NO_ERROR)
     {
+      PGBUF_BCB_LOCK (bufptr);
+      *is_bcb_locked = true;
+      pgbuf_bcb_mark_was_not_flushed (thread_p, bufptr, was_dirty);
+      LSA_COPY (&bufptr->oldest_unflush_lsa, oldest_unflush_lsa);
+
+#if defined (SERVER_MODE)
+      if (bufptr->next_wait_thrd != NULL)
+	{
+	  pgbuf_wake_flush_waiters (thread_p, bufptr);
+	}
+#endif
       return ER_FAILED;
     }
 
@@ -10219,7 +10421,7 @@ pgbuf_check_bcb_page_vpid (PGBUF_BCB * bufptr)
       assert (bufptr->vpid.volid == bufptr->iopage_buffer->iopage.prv.volid);
 
 #if 1				/* TODO - do not delete me */
-      assert (bufptr->iopage_buffer->iopage.prv.pflag_reserve_1 == '\0');
+      assert (bufptr->iopage_buffer->iopage.prv.pflag == '\0');
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_2 == 0);
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_3 == 0);
 #endif
@@ -10255,7 +10457,7 @@ pgbuf_scramble (FILEIO_PAGE * iopage)
   iopage->prv.volid = -1;
 
   iopage->prv.ptype = '\0';
-  iopage->prv.pflag_reserve_1 = '\0';
+  iopage->prv.pflag = '\0';
   iopage->prv.p_reserve_2 = 0;
   iopage->prv.p_reserve_3 = 0;
 }
@@ -10441,8 +10643,8 @@ pgbuf_is_consistent (const PGBUF_BCB * bufptr, int likely_bad_after_fixcnt)
 	}
 
       /* Read the disk page into local page area */
-      if (fileio_read (NULL, fileio_get_volume_descriptor (bufptr->vpid.volid), malloc_io_pgptr, bufptr->vpid.pageid,
-		       IO_PAGESIZE) == NULL)
+      if (fileio_read_data_page (NULL, fileio_get_volume_descriptor (bufptr->vpid.volid), malloc_io_pgptr,
+				 bufptr->vpid.pageid, IO_PAGESIZE) == NULL)
 	{
 	  /* Unable to verify consistency of this page */
 	  consistent = PGBUF_CONTENT_BAD;
@@ -11134,6 +11336,9 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
   int written_pages;
   int abort_reason;
   bool was_page_flushed = false;
+  int num_requests;
+  char *iopages_start;
+  FILEIO_PAGE *iopage;
 #if defined(ENABLE_SYSTEMTAP)
   QUERY_ID query_id = -1;
   bool monitored = false;
@@ -11152,6 +11357,7 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
   helper->npages = 0;
   helper->fwd_offset = 0;
   helper->back_offset = 0;
+  iopages_start = PTR_ALIGN (helper->iopages_area, MAX_ALIGNMENT);
 
   /* add bufptr as middle page */
   pgbuf_add_bufptr_to_batch (bufptr, 0);
@@ -11365,28 +11571,47 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
       return NO_ERROR;
     }
 
-  /* WAL protocol: force log record to disk */
-  logpb_flush_log_for_wal (thread_p, &log_newest_oldest_unflush_lsa);
-
-  written_pages = 0;
+  /* copy all pages that are still safe to flush, then write them together. adjacent pages are coalesced into
+   * vectored writes. */
+  num_requests = 0;
+  LSA_SET_NULL (&log_newest_oldest_unflush_lsa);
   for (pos = PGBUF_NEIGHBOR_POS (-helper->back_offset); pos <= PGBUF_NEIGHBOR_POS (helper->fwd_offset); pos++)
     {
-      bufptr = helper->pages_bufptr[pos];
-
-      error = pgbuf_flush_neighbor_safe (thread_p, bufptr, &helper->vpids[pos], &was_page_flushed);
-      if (error != NO_ERROR)
+      iopage = (FILEIO_PAGE *) (iopages_start + (size_t) num_requests * IO_PAGESIZE);
+      if (!pgbuf_begin_flush_neighbor_safe (thread_p, helper->pages_bufptr[pos], &helper->vpids[pos], iopage,
+					    &helper->flush_pages[num_requests]))
 	{
-	  ASSERT_ERROR ();
-	  if (save_first_error == NO_ERROR)
-	    {
-	      save_first_error = error;
-	    }
 	  continue;
 	}
-      if (was_page_flushed)
+
+      if (!LSA_ISNULL (&helper->flush_pages[num_requests].oldest_unflush_lsa)
+	  && LSA_LT (&log_newest_oldest_unflush_lsa, &iopage->prv.lsa))
 	{
-	  written_pages++;
+	  LSA_COPY (&log_newest_oldest_unflush_lsa, &iopage->prv.lsa);
 	}
+
+      helper->write_requests[num_requests].vol_fd = fileio_get_volume_descriptor (helper->vpids[pos].volid);
+      helper->write_requests[num_requests].page_id = helper->vpids[pos].pageid;
+      helper->write_requests[num_requests].io_page = iopage;
+      helper->write_requests[num_requests].arg = &helper->flush_pages[num_requests];
+      num_requests++;
+    }
+
+  written_pages = 0;
+  if (num_requests > 0)
+    {
+      /* WAL protocol: force log record to disk */
+      if (!LSA_ISNULL (&log_newest_oldest_unflush_lsa))
+	{
+	  logpb_flush_log_for_wal (thread_p, &log_newest_oldest_unflush_lsa);
+	}
+
+      perfmon_add_stat (thread_p, PSTAT_PB_NUM_IOWRITES, num_requests);
+
+      helper->written_pages = 0;
+      save_first_error = fileio_write_batch (thread_p, helper->write_requests, num_requests, IO_PAGESIZE,
+					     pgbuf_end_flush_neighbor);
+      written_pages = helper->written_pages;
     }
 
   er_log_debug (ARG_FILE_LINE,
@@ -11488,6 +11713,78 @@ pgbuf_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * e
   return error;
 }
 
+/*
+ * pgbuf_begin_flush_neighbor_safe () - Start flushing a collected page for neighbor flush if it's safe (same
+ *					conditions as pgbuf_flush_neighbor_safe). The page is copied and its bcb is marked
+ *					as flushing until pgbuf_end_flush_neighbor is called.
+ *
+ * return	      : True if page flush was started.
+ * thread_p (in)      : Thread entry.
+ * bufptr (in)	      : Buffered page collected for neighbor flush.
+ * expected_vpid (in) : Expected VPID for bufptr.
+ * iopage (out)       : Copy of page to write.
+ * flush_page (out)   : Saved bcb state for the end of flush.
+ */
+STATIC_INLINE bool
+pgbuf_begin_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * expected_vpid,
+				 FILEIO_PAGE * iopage, PGBUF_BATCH_FLUSH_PAGE * flush_page)
+{
+  assert (bufptr != NULL);
+  assert (expected_vpid != NULL && !VPID_ISNULL (expected_vpid));
+
+  PGBUF_BCB_LOCK (bufptr);
+  if (!VPID_EQ (&bufptr->vpid, expected_vpid))
+    {
+      PGBUF_BCB_UNLOCK (bufptr);
+      return false;
+    }
+
+  if (pgbuf_bcb_is_flushing (bufptr) || bufptr->latch_mode > PGBUF_LATCH_READ)
+    {
+      PGBUF_BCB_UNLOCK (bufptr);
+      return false;
+    }
+
+  if (pgbuf_check_bcb_page_vpid (bufptr) != true)
+    {
+      assert (false);
+      PGBUF_BCB_UNLOCK (bufptr);
+      return false;
+    }
+
+  /* flush even if it is not dirty. todo: is this necessary? */
+  flush_page->bufptr = bufptr;
+  flush_page->was_dirty = pgbuf_bcb_begin_flush (thread_p, bufptr, iopage, &flush_page->oldest_unflush_lsa);
+
+  return true;
+}
+
+/*
+ * pgbuf_end_flush_neighbor () - Completion of a neighbor page write started by pgbuf_begin_flush_neighbor_safe.
+ *
+ * return	 : void
+ * thread_p (in) : Thread entry.
+ * request (in)  : Write request of page.
+ * error (in)	 : Write error.
+ */
+static void
+pgbuf_end_flush_neighbor (THREAD_ENTRY * thread_p, FILEIO_WRITE_REQUEST * request, int error)
+{
+  PGBUF_BATCH_FLUSH_PAGE *flush_page = (PGBUF_BATCH_FLUSH_PAGE *) request->arg;
+  bool is_bcb_locked = false;
+
+  error = pgbuf_bcb_end_flush (thread_p, flush_page->bufptr, true, &flush_page->oldest_unflush_lsa,
+			       flush_page->was_dirty, error, &is_bcb_locked);
+  if (is_bcb_locked)
+    {
+      PGBUF_BCB_UNLOCK (flush_page->bufptr);
+    }
+  if (error == NO_ERROR)
+    {
+      pgbuf_Flush_helper.written_pages++;
+    }
+}
+
 /*
  * pgbuf_compare_hold_vpid_for_sort () - Compare the vpid for sort
  *   return: p1 - p2
@@ -14656,6 +14953,30 @@ pgbuf_lru_advance_victim_hint (THREAD_ENTRY * thread_p, PGBUF_LRU_LIST * lru_lis
   assert (lru_list->victim_hint == NULL || PGBUF_IS_BCB_IN_LRU_VICTIM_ZONE (lru_list->victim_hint));
 }
 
+/*
+ * pgbuf_bcb_set_latch_mode () - set bcb latch mode. the bcb version is changed when the page is write latched or
+ *				  unlatched, to invalidate the copies of optimistic readers.
+ *
+ * return          : void
+ * bcb (in)        : bcb
+ * latch_mode (in) : new latch mode
+ *
+ * note: caller must hold bcb mutex.
+ */
+STATIC_INLINE void
+pgbuf_bcb_set_latch_mode (PGBUF_BCB * bcb, PGBUF_LATCH_MODE latch_mode)
+{
+  bool was_write_latched = bcb->latch_mode == PGBUF_LATCH_WRITE;
+
+  /* latch mode is set before the version is changed; a reader that sees the new version also sees the write latch */
+  bcb->latch_mode = latch_mode;
+  if (was_write_latched != (latch_mode == PGBUF_LATCH_WRITE))
+    {
+      /* keep parity, it tells whether bcb is in hash chain */
+      ATOMIC_INC_32 (&bcb->version, 2);
+    }
+}
+
 /*
  * pgbuf_bcb_update_flags () - update bcb flags (not zone and not lru index)
  *
@@ -15051,6 +15372,275 @@ pgbuf_bcb_is_async_flush_request (const PGBUF_BCB * bcb)
   return (bcb->flags & PGBUF_BCB_ASYNC_FLUSH_REQ) != 0;
 }
 
+/*
+ * pgbuf_bcb_is_temp_page_over_quota () - does bcb hold a temporary page while temporary pages exceed their share
+ *                                        of the buffer?
+ *
+ * return   : true/false
+ * bcb (in) : bcb
+ */
+STATIC_INLINE bool
+pgbuf_bcb_is_temp_page_over_quota (const PGBUF_BCB * bcb)
+{
+  return (bcb->flags & PGBUF_BCB_TEMP_PAGE_FLAG) != 0 && pgbuf_Pool.num_temp_pages > pgbuf_Pool.max_temp_pages;
+}
+
+/*
+ * pgbuf_bcb_clear_temp_page () - bcb no longer holds a temporary page; remove it from temporary pages count.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * bcb (in)      : bcb
+ */
+STATIC_INLINE void
+pgbuf_bcb_clear_temp_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
+{
+  if ((bcb->flags & PGBUF_BCB_TEMP_PAGE_FLAG) != 0)
+    {
+      pgbuf_bcb_update_flags (thread_p, bcb, 0, PGBUF_BCB_TEMP_PAGE_FLAG);
+      ATOMIC_INC_32 (&pgbuf_Pool.num_temp_pages, -1);
+    }
+}
+
+/*
+ * pgbuf_is_thread_in_ring () - is thread reading pages of a large sequential scan?
+ *
+ * return        : true/false
+ * thread_p (in) : thread entry
+ */
+STATIC_INLINE bool
+pgbuf_is_thread_in_ring (THREAD_ENTRY * thread_p)
+{
+  return PGBUF_THREAD_RING (thread_p)->depth > 0;
+}
+
+/*
+ * pgbuf_ring_add_bcb () - add the bcb of a page read by a large sequential scan to the bottom of lru and to the ring
+ *                         of the thread.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * bcb (in)      : bcb of newly read page. bcb mutex is owned.
+ */
+STATIC_INLINE void
+pgbuf_ring_add_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
+{
+  PGBUF_RING *ring = PGBUF_THREAD_RING (thread_p);
+
+  pgbuf_move_bcb_to_bottom_lru (thread_p, bcb);
+
+  ring->bcbs[ring->pos] = bcb;
+  ring->pos = (ring->pos + 1) % PGBUF_RING_SIZE;
+}
+
+/*
+ * pgbuf_get_victim_from_ring () - get the oldest bcb of thread's ring, if it can still be victimized.
+ *
+ * return        : victim bcb (bcb mutex owned and bcb removed from lru list) or NULL
+ * thread_p (in) : thread entry
+ *
+ * note: since the scan left it, the bcb may have been fixed, boosted or victimized by others. it is reused only while
+ *       it stays unfixed and clean in the victimization zone of its lru list.
+ */
+static PGBUF_BCB *
+pgbuf_get_victim_from_ring (THREAD_ENTRY * thread_p)
+{
+  PGBUF_RING *ring = PGBUF_THREAD_RING (thread_p);
+  PGBUF_BCB *bcb;
+  PGBUF_LRU_LIST *lru_list;
+
+  bcb = ring->bcbs[ring->pos];
+  if (bcb == NULL)
+    {
+      return NULL;
+    }
+  ring->bcbs[ring->pos] = NULL;
+
+  if (!PGBUF_IS_BCB_IN_LRU_VICTIM_ZONE (bcb))
+    {
+      return NULL;
+    }
+
+  lru_list = pgbuf_lru_list_from_bcb (bcb);
+  pthread_mutex_lock (&lru_list->mutex);
+
+  /* we have lru mutex, so we can only lock bcb conditionally */
+  if (PGBUF_BCB_TRYLOCK (bcb) != 0)
+    {
+      pthread_mutex_unlock (&lru_list->mutex);
+      return NULL;
+    }
+
+  /* check again now that bcb is locked */
+  if (!PGBUF_IS_BCB_IN_LRU_VICTIM_ZONE (bcb) || pgbuf_lru_list_from_bcb (bcb) != lru_list
+      || pgbuf_is_bcb_fixed_by_any (bcb, true) || !pgbuf_is_bcb_victimizable (bcb, true))
+    {
+      PGBUF_BCB_UNLOCK (bcb);
+      pthread_mutex_unlock (&lru_list->mutex);
+      return NULL;
+    }
+
+  pgbuf_remove_from_lru_list (thread_p, bcb, lru_list);
+  pgbuf_lru_sanity_check (lru_list);
+  pthread_mutex_unlock (&lru_list->mutex);
+
+  return bcb;
+}
+
+/*
+ * pgbuf_ring_begin () - thread starts reading pages of a large sequential scan. until pgbuf_ring_end, the pages it
+ *                       reads are recycled through a small ring of bcb's instead of taking over the buffer.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ */
+void
+pgbuf_ring_begin (THREAD_ENTRY * thread_p)
+{
+  PGBUF_THREAD_RING (thread_p)->depth++;
+}
+
+/*
+ * pgbuf_ring_end () - thread stops reading pages of a large sequential scan.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ */
+void
+pgbuf_ring_end (THREAD_ENTRY * thread_p)
+{
+  PGBUF_RING *ring = PGBUF_THREAD_RING (thread_p);
+
+  assert (ring->depth > 0);
+  ring->depth--;
+}
+
+/*
+ * pgbuf_should_use_ring () - should a sequential scan of given number of pages use a buffer ring?
+ *
+ * return        : true if the scan would take more than lru_scan_ring_ratio of the buffer
+ * num_pages (in) : number of pages to scan
+ */
+bool
+pgbuf_should_use_ring (int num_pages)
+{
+  float ratio = prm_get_float_value (PRM_ID_PB_SCAN_RING_RATIO);
+
+  return ratio > 0 && num_pages > pgbuf_Pool.num_buffers * ratio;
+}
+
+/*
+ * pgbuf_copy_page_optimistic () - copy a buffered page without fixing or latching it.
+ *
+ * return          : page pointer of the copy or NULL if page could not be copied.
+ * thread_p (in)   : thread entry
+ * vpid (in)       : page identifier
+ * page_copy (out) : page copy and the version of the page when it was copied.
+ *
+ * note: the page is copied only if it is already in buffer and nobody write latches it while it is copied. the bcb
+ *       version is read before and after the copy; any write latch or page replacement in between changes it. no
+ *       error is set if the page cannot be copied; caller should fix the page instead.
+ *
+ *       the copy is consistent only as of the time it was made. callers that use it to reach other pages must check
+ *       with pgbuf_is_page_version_valid that the page did not change meanwhile.
+ *
+ *       the copy can be read as a fixed page, but it must never be unfixed, set dirty or modified.
+ */
+PAGE_PTR
+pgbuf_copy_page_optimistic (THREAD_ENTRY * thread_p, const VPID * vpid, PGBUF_PAGE_COPY * page_copy)
+{
+  PGBUF_BUFFER_HASH *hash_anchor;
+  PGBUF_BCB *bufptr;
+  PGBUF_BCB *copy_bcb;
+  PGBUF_IOPAGE_BUFFER *copy_iopage_buffer;
+  int version;
+
+  assert (vpid != NULL && page_copy != NULL);
+
+  if (DB_ALIGN (sizeof (PGBUF_BCB), MAX_ALIGNMENT) + offsetof (PGBUF_IOPAGE_BUFFER, iopage) + IO_PAGESIZE
+      > sizeof (page_copy->area))
+    {
+      /* cannot happen with supported page sizes. */
+      assert (false);
+      return NULL;
+    }
+  if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_ALL))
+    {
+      /* page pointer validation does not know copies. */
+      return NULL;
+    }
+
+  /* search hash chain without mutexes, like pgbuf_search_hash_chain first phase does. */
+  hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
+  for (bufptr = hash_anchor->hash_next; bufptr != NULL; bufptr = bufptr->hash_next)
+    {
+      if (VPID_EQ (&bufptr->vpid, vpid))
+	{
+	  break;
+	}
+    }
+  if (bufptr == NULL)
+    {
+      return NULL;
+    }
+
+  version = ATOMIC_LOAD_32 (&bufptr->version);
+  MEMORY_BARRIER ();
+  if ((version & 1) != 0 || bufptr->latch_mode == PGBUF_LATCH_WRITE || !VPID_EQ (&bufptr->vpid, vpid))
+    {
+      /* page is being modified or replaced */
+      return NULL;
+    }
+
+  copy_bcb = (PGBUF_BCB *) page_copy->area;
+  copy_iopage_buffer = (PGBUF_IOPAGE_BUFFER *) ((char *) page_copy->area + DB_ALIGN (sizeof (PGBUF_BCB),
+											 MAX_ALIGNMENT));
+  memcpy (&copy_iopage_buffer->iopage, &bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+
+  MEMORY_BARRIER ();
+  if (ATOMIC_LOAD_32 (&bufptr->version) != version || !VPID_EQ (&bufptr->vpid, vpid))
+    {
+      /* page changed while it was copied */
+      return NULL;
+    }
+  if (copy_iopage_buffer->iopage.prv.ptype == PAGE_UNKNOWN || copy_iopage_buffer->iopage.prv.pageid != vpid->pageid
+      || copy_iopage_buffer->iopage.prv.volid != vpid->volid)
+    {
+      /* deallocated page */
+      return NULL;
+    }
+
+  /* private bcb of the copy, enough for read-only page functions. */
+  memset (copy_bcb, 0, sizeof (PGBUF_BCB));
+  copy_bcb->vpid = *vpid;
+  copy_bcb->fcnt = 1;
+  copy_bcb->latch_mode = PGBUF_LATCH_READ;
+  copy_bcb->iopage_buffer = copy_iopage_buffer;
+  copy_iopage_buffer->bcb = copy_bcb;
+
+  page_copy->version.bcb = bufptr;
+  page_copy->version.version = version;
+
+  return (PAGE_PTR) copy_iopage_buffer->iopage.page;
+}
+
+/*
+ * pgbuf_is_page_version_valid () - is the page still unchanged since it was copied by pgbuf_copy_page_optimistic?
+ *
+ * return            : true if page was not write latched or replaced since
+ * page_version (in) : version of the page when it was copied
+ */
+bool
+pgbuf_is_page_version_valid (const PGBUF_PAGE_VERSION * page_version)
+{
+  PGBUF_BCB *bufptr = (PGBUF_BCB *) page_version->bcb;
+
+  assert (bufptr != NULL);
+
+  MEMORY_BARRIER ();
+  return ATOMIC_LOAD_32 (&bufptr->version) == page_version->version;
+}
+
 /*
  * pgbuf_bcb_should_be_moved_to_bottom_lru () - is bcb supposed to be moved to the bottom of lru?
  *
@@ -257,6 +257,24 @@ struct pgbuf_watcher
 #endif
 };
 
+/* version of a buffered page, used to validate a page copy made without latching the page */
+typedef struct pgbuf_page_version PGBUF_PAGE_VERSION;
+struct pgbuf_page_version
+{
+  void *bcb;			/* BCB the page was copied from */
+  int version;			/* BCB version when the page was copied */
+};
+
+/* copy of a buffered page made by pgbuf_copy_page_optimistic. the area keeps a private BCB and the io page, so that
+ * read-only page functions work on the copy as on a fixed page. */
+#define PGBUF_PAGE_COPY_AREA_SIZE (IO_MAX_PAGE_SIZE + 1024)
+typedef struct pgbuf_page_copy PGBUF_PAGE_COPY;
+struct pgbuf_page_copy
+{
+  PGBUF_PAGE_VERSION version;
+  double area[PGBUF_PAGE_COPY_AREA_SIZE / sizeof (double)];
+};
+
 extern HFID *pgbuf_ordered_null_hfid;
 
 extern unsigned int pgbuf_hash_vpid (const void *key_vpid, unsigned int htsize);
@@ -463,4 +481,11 @@ extern bool pgbuf_assign_flushed_pages (THREAD_ENTRY * thread_p);
 
 extern void pgbuf_notify_vacuum_follows (THREAD_ENTRY * thread_p, PAGE_PTR page);
 extern bool pgbuf_is_io_stressful (void);
+
+extern void pgbuf_ring_begin (THREAD_ENTRY * thread_p);
+extern void pgbuf_ring_end (THREAD_ENTRY * thread_p);
+extern bool pgbuf_should_use_ring (int num_pages);
+
+extern PAGE_PTR pgbuf_copy_page_optimistic (THREAD_ENTRY * thread_p, const VPID * vpid, PGBUF_PAGE_COPY * page_copy);
+extern bool pgbuf_is_page_version_valid (const PGBUF_PAGE_VERSION * page_version);
 #endif /* _PAGE_BUFFER_H_ */
@@ -215,7 +215,8 @@ typedef enum
   PAGE_LOG,			/* NONE - log page (unused) */
   PAGE_DROPPED_FILES,		/* Dropped files page.  */
   PAGE_VACUUM_DATA,		/* Vacuum data. */
-  PAGE_LAST = PAGE_VACUUM_DATA
+  PAGE_HEAP_FREESPACE,		/* heap free space map page */
+  PAGE_LAST = PAGE_HEAP_FREESPACE
 } PAGE_TYPE;
 
 /* Index scan OID buffer size as set by system parameter. */
@@ -1162,6 +1162,7 @@ thread_initialize_entry (THREAD_ENTRY * entry_p)
   entry_p->type = TT_WORKER;	/* init */
 
   entry_p->private_heap_id = db_create_private_heap ();
+  entry_p->private_arena = NULL;
 
   if (entry_p->private_heap_id == 0)
     {
@@ -1172,6 +1173,7 @@ thread_initialize_entry (THREAD_ENTRY * entry_p)
   entry_p->log_zip_redo = NULL;
   entry_p->log_data_length = 0;
   entry_p->log_data_ptr = NULL;
+  entry_p->page_zip_area = NULL;
 
   (void) thread_rc_track_initialize (entry_p);
   thread_clear_recursion_depth (entry_p);
@@ -1275,6 +1277,10 @@ thread_finalize_entry (THREAD_ENTRY * entry_p)
       free_and_init (entry_p->log_data_ptr);
       entry_p->log_data_length = 0;
     }
+  if (entry_p->page_zip_area)
+    {
+      free_and_init (entry_p->page_zip_area);
+    }
 
   /* Vacuum worker resources are released by vacuum */
   entry_p->vacuum_worker = NULL;
@@ -2571,6 +2577,8 @@ thread_deadlock_detect_thread (void *arg_p)
   int thrd_index;
   bool state;
   int lockwait_count;
+  struct timeval now, next_check_time;
+  struct timespec wakeup_time;
 
   tsd_ptr = (THREAD_ENTRY *) arg_p;
   /* wait until THREAD_CREATE() finish */
@@ -2586,14 +2594,38 @@ thread_deadlock_detect_thread (void *arg_p)
 
   thread_set_current_tran_index (tsd_ptr, LOG_SYSTEM_TRAN_INDEX);
 
+  gettimeofday (&now, NULL);
+  (void) timeval_add_msec (&next_check_time, &now, 100);
+
   /* during server is active */
   while (!tsd_ptr->shutdown)
     {
-      thread_sleep (100);	/* 100 msec */
-      if (!lock_check_local_deadlock_detection ())
+      /* sleep until the next check (each 100 msec), unless a thread is suspended on a lock meanwhile */
+      rv = pthread_mutex_lock (&thread_Deadlock_detect_thread.lock);
+      if (!lock_has_new_lock_waiters ())
+	{
+	  (void) timeval_to_timespec (&wakeup_time, &next_check_time);
+	  thread_Deadlock_detect_thread.is_running = false;
+	  pthread_cond_timedwait (&thread_Deadlock_detect_thread.cond, &thread_Deadlock_detect_thread.lock,
+				  &wakeup_time);
+	  thread_Deadlock_detect_thread.is_running = true;
+	}
+      pthread_mutex_unlock (&thread_Deadlock_detect_thread.lock);
+
+      if (lock_has_new_lock_waiters ())
+	{
+	  /* search deadlock cycles from the new waiters right away */
+	  er_clear ();
+	  lock_detect_local_deadlock_of_new_waiters (tsd_ptr);
+	}
+
+      gettimeofday (&now, NULL);
+      if (now.tv_sec < next_check_time.tv_sec
+	  || (now.tv_sec == next_check_time.tv_sec && now.tv_usec < next_check_time.tv_usec))
 	{
 	  continue;
 	}
+      (void) timeval_add_msec (&next_check_time, &now, 100);
 
       er_clear ();
 
@@ -2603,18 +2635,22 @@ thread_deadlock_detect_thread (void *arg_p)
 	{
 	  /* none is lock-waiting */
 	  rv = pthread_mutex_lock (&thread_Deadlock_detect_thread.lock);
-	  thread_Deadlock_detect_thread.is_running = false;
-
 	  if (tsd_ptr->shutdown)
 	    {
+	      thread_Deadlock_detect_thread.is_running = false;
 	      pthread_mutex_unlock (&thread_Deadlock_detect_thread.lock);
 	      break;
 	    }
-	  pthread_cond_wait (&thread_Deadlock_detect_thread.cond, &thread_Deadlock_detect_thread.lock);
-
-	  thread_Deadlock_detect_thread.is_running = true;
-
+	  if (!lock_has_new_lock_waiters ())
+	    {
+	      thread_Deadlock_detect_thread.is_running = false;
+	      pthread_cond_wait (&thread_Deadlock_detect_thread.cond, &thread_Deadlock_detect_thread.lock);
+	      thread_Deadlock_detect_thread.is_running = true;
+	    }
 	  pthread_mutex_unlock (&thread_Deadlock_detect_thread.lock);
+
+	  gettimeofday (&now, NULL);
+	  (void) timeval_add_msec (&next_check_time, &now, 100);
 	  continue;
 	}
 
@@ -2635,7 +2671,8 @@ thread_deadlock_detect_thread (void *arg_p)
 	  thread_p = thread_find_next_lockwait_entry (&thrd_index);
 	}
 
-      if (lockwait_count >= 2)
+      /* the full scan is a fallback for cycles the incremental detection could not search */
+      if (lockwait_count >= 2 && lock_check_local_deadlock_detection ())
 	{
 	  (void) lock_detect_local_deadlock (tsd_ptr);
 	}
@@ -292,6 +292,7 @@ struct thread_entry
   pthread_cond_t wakeup_cond;	/* wakeup condition */
 
   HL_HEAPID private_heap_id;	/* id of thread private memory allocator */
+  struct db_private_arena *private_arena;	/* bump allocator used on the private heap while executing queries */
   ADJ_ARRAY *cnv_adj_buffer[3];	/* conversion buffer */
 
   struct css_conn_entry *conn_entry;	/* conn entry ptr */
@@ -329,6 +330,7 @@ struct thread_entry
   void *log_zip_redo;
   char *log_data_ptr;
   int log_data_length;
+  char *page_zip_area;		/* data page compression buffer and LZO work memory */
 
   int net_request_index;	/* request index of net server functions */
 
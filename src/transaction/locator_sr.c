@@ -128,6 +128,14 @@ struct locator_return_nxobj
   int area_offset;		/* Relative offset to recdes->data in the communication area */
 };
 
+/* index key of an object inserted by locator_multi_insert_force */
+typedef struct locator_multi_insert_key LOCATOR_MULTI_INSERT_KEY;
+struct locator_multi_insert_key
+{
+  DB_VALUE key;			/* key value */
+  int rec_index;		/* index of object in inserted objects */
+};
+
 extern INT32 vacuum_Global_oldest_active_blockers_counter;
 
 bool locator_Dont_check_foreign_key = false;
@@ -167,6 +175,9 @@ static int locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * cla
 				 int has_index, int op_type, HEAP_SCANCACHE * scan_cache, int *force_count,
 				 int pruning_type, PRUNING_CONTEXT * pcontext, FUNC_PRED_UNPACK_INFO * func_preds,
 				 UPDATE_INPLACE_STYLE force_in_place);
+static int locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, RECDES * recdes_array,
+				       int num_recdes, int has_index, int op_type, HEAP_SCANCACHE * scan_cache,
+				       FUNC_PRED_UNPACK_INFO * func_preds, OID * oid_array, int *force_count);
 static int locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID * oid, RECDES * ikdrecdes,
 				 RECDES * recdes, int has_index, ATTR_ID * att_id, int n_att_id, int op_type,
 				 HEAP_SCANCACHE * scan_cache, int *force_count, bool not_check_fk,
@@ -204,6 +215,7 @@ static int locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES
 static int locator_check_foreign_key (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID * inst_oid,
 				      RECDES * recdes, RECDES * new_recdes, bool * is_cached, LC_COPYAREA ** copyarea);
 static int locator_check_primary_key_delete (THREAD_ENTRY * thread_p, OR_INDEX * index, DB_VALUE * key);
+static bool locator_is_index_updated (OR_INDEX * index, ATTR_ID * att_id, int n_att_id);
 static int locator_check_primary_key_update (THREAD_ENTRY * thread_p, OR_INDEX * index, DB_VALUE * key);
 #if defined(ENABLE_UNUSED_FUNCTION)
 static TP_DOMAIN *locator_make_midxkey_domain (OR_INDEX * index);
@@ -214,6 +226,11 @@ static DISK_ISVALID locator_check_unique_btree_entries (THREAD_ENTRY * thread_p,
 static int locator_eval_filter_predicate (THREAD_ENTRY * thread_p, BTID * btid, OR_PREDICATE * or_pred, OID * class_oid,
 					  OID ** inst_oids, int num_insts, RECDES ** recs, DB_LOGICAL * results);
 static bool locator_was_index_already_applied (HEAP_CACHE_ATTRINFO * index_attrinfo, BTID * btid, int pos);
+static int locator_compare_multi_insert_keys (const void *key1, const void *key2);
+static int locator_add_index_for_multi_insert (THREAD_ENTRY * thread_p, RECDES * recdes_array, OID * oid_array,
+					       int num_recdes, OID * class_oid, int op_type,
+					       HEAP_SCANCACHE * scan_cache, HFID * hfid,
+					       FUNC_PRED_UNPACK_INFO * func_preds);
 static LC_FIND_CLASSNAME xlocator_reserve_class_name (THREAD_ENTRY * thread_p, const char *classname, OID * class_oid);
 
 static int locator_filter_errid (THREAD_ENTRY * thread_p, int num_ignore_error_count, int *ignore_error_list);
@@ -5187,6 +5204,134 @@ error2:
   return error_code;
 }
 
+/*
+ * locator_multi_insert_force () - Insert the given objects on this heap
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   hfid(in): Heap where the objects are going to be inserted
+ *   class_oid(in): the class OID of the objects
+ *   recdes_array(in): The objects in disk format
+ *   num_recdes(in): Number of objects
+ *   has_index(in): false if we now for sure that there is not any index on the
+ *              instances of the class.
+ *   op_type(in):
+ *   scan_cache(in/out): Scan cache used to estimate the best space pages
+ *              between heap changes.
+ *   func_preds(in): cached function index expressions
+ *   oid_array(out): The new object identifiers
+ *   force_count(out): number of inserted objects
+ *
+ * Note: Same as locator_insert_force for a class that is not partitioned, but
+ *       the objects are inserted together: each heap page is fixed once for
+ *       all objects that fit in it and the keys of each index are inserted
+ *       in key order, so consecutive keys find their leaf already in buffer.
+ */
+static int
+locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, RECDES * recdes_array,
+			    int num_recdes, int has_index, int op_type, HEAP_SCANCACHE * scan_cache,
+			    FUNC_PRED_UNPACK_INFO * func_preds, OID * oid_array, int *force_count)
+{
+  RECDES new_recdes;
+  bool is_cached = false;
+  LC_COPYAREA *cache_attr_copyarea = NULL;
+  int error_code = NO_ERROR;
+  int i;
+
+  assert (class_oid != NULL);
+  assert (!OID_ISNULL (class_oid));
+  assert (!OID_IS_ROOTOID (class_oid));
+  assert (num_recdes > 0);
+
+  *force_count = 0;
+
+  /* adjust recdes type; REC_BIGONE is detected and handled in heap_insert_logical_batch */
+  for (i = 0; i < num_recdes; i++)
+    {
+      recdes_array[i].type = REC_HOME;
+    }
+
+  /* insert objects and lock them */
+  error_code = heap_insert_logical_batch (thread_p, hfid, class_oid, recdes_array, num_recdes, scan_cache, oid_array);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  /* Apply the necessary index insertions */
+  if (has_index)
+    {
+      error_code =
+	locator_add_index_for_multi_insert (thread_p, recdes_array, oid_array, num_recdes, class_oid, op_type,
+					    scan_cache, hfid, func_preds);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+    }
+
+  /* check the foreign key constraints */
+  if (has_index && !locator_Dont_check_foreign_key)
+    {
+      for (i = 0; i < num_recdes; i++)
+	{
+	  error_code =
+	    locator_check_foreign_key (thread_p, hfid, class_oid, &oid_array[i], &recdes_array[i], &new_recdes,
+				       &is_cached, &cache_attr_copyarea);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+
+	  if (is_cached)
+	    {
+	      HEAP_OPERATION_CONTEXT update_context;
+
+	      /* Cache object has been updated, we need update the value again */
+	      heap_create_update_context (&update_context, hfid, &oid_array[i], class_oid, &new_recdes, scan_cache,
+					  UPDATE_INPLACE_CURRENT_MVCCID);
+	      if (heap_update_logical (thread_p, &update_context) != NO_ERROR)
+		{
+		  ASSERT_ERROR_AND_SET (error_code);
+		  goto exit;
+		}
+	      assert (update_context.is_logical_old);
+
+	      is_cached = false;
+	    }
+	  if (cache_attr_copyarea != NULL)
+	    {
+	      locator_free_copy_area (cache_attr_copyarea);
+	      cache_attr_copyarea = NULL;
+	    }
+	}
+    }
+
+  /* remove query result cache entries which are relevant with this class */
+  if (!QFILE_IS_LIST_CACHE_DISABLED)
+    {
+      if (qexec_clear_list_cache_by_class (thread_p, class_oid) != NO_ERROR)
+	{
+	  er_log_debug (ARG_FILE_LINE,
+			"locator_multi_insert_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			class_oid->pageid, class_oid->slotid, class_oid->volid);
+	}
+      qmgr_add_modified_class (thread_p, class_oid);
+    }
+
+  *force_count = num_recdes;
+
+exit:
+  if (cache_attr_copyarea != NULL)
+    {
+      locator_free_copy_area (cache_attr_copyarea);
+    }
+
+  return error_code;
+}
+
 /*
  * locator_move_record () - relocate a record from a partitioned class
  * return : error code or NO_ERROR
@@ -6823,6 +6968,101 @@ locator_repl_get_key_value (DB_VALUE * key_value, LC_COPYAREA * force_area, LC_C
   return (int) (ptr - start_ptr);
 }
 
+/*
+ * locator_count_insert_batch_objs () - Count the objects starting with given one that can be inserted together
+ *
+ * return: number of objects
+ *
+ *   mobjs(in): objects of force area
+ *   obj(in): first object; an LC_FLUSH_INSERT
+ *   obj_index(in): index of first object
+ *
+ * Note: The run ends at the first object that is not a plain insert into the same heap with the same index flag.
+ */
+static int
+locator_count_insert_batch_objs (LC_COPYAREA_MANYOBJS * mobjs, LC_COPYAREA_ONEOBJ * obj, int obj_index)
+{
+  LC_COPYAREA_ONEOBJ *next_obj = obj;
+  int max_objs = prm_get_integer_value (PRM_ID_MULTI_INSERT_BATCH_SIZE);
+  int num_objs = 1;
+
+  assert (obj->operation == LC_FLUSH_INSERT);
+
+  while (obj_index + num_objs < mobjs->num_objs && num_objs < max_objs)
+    {
+      next_obj = LC_NEXT_ONEOBJ_PTR_IN_COPYAREA (next_obj);
+      if (next_obj->operation != LC_FLUSH_INSERT || !OID_EQ (&next_obj->class_oid, &obj->class_oid)
+	  || !HFID_EQ (&next_obj->hfid, &obj->hfid)
+	  || LC_ONEOBJ_GET_INDEX_FLAG (next_obj) != LC_ONEOBJ_GET_INDEX_FLAG (obj))
+	{
+	  break;
+	}
+      num_objs++;
+    }
+
+  return num_objs;
+}
+
+/*
+ * locator_force_insert_batch_objs () - Insert objects of force area together
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   force_area(in): force area
+ *   obj(in/out): first object; OIDs of inserted objects are set in the area
+ *   num_objs(in): number of objects, as counted by locator_count_insert_batch_objs
+ *   force_scancache(in): scan cache
+ *   force_count(out): number of inserted objects
+ */
+static int
+locator_force_insert_batch_objs (THREAD_ENTRY * thread_p, LC_COPYAREA * force_area, LC_COPYAREA_ONEOBJ * obj,
+				 int num_objs, HEAP_SCANCACHE * force_scancache, int *force_count)
+{
+  LC_COPYAREA_ONEOBJ *crt_obj;
+  RECDES *recdes_array;
+  OID *oid_array;
+  int i;
+  int error_code = NO_ERROR;
+
+  recdes_array = (RECDES *) db_private_alloc (thread_p, num_objs * sizeof (RECDES));
+  oid_array = (OID *) db_private_alloc (thread_p, num_objs * sizeof (OID));
+  if (recdes_array == NULL || oid_array == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto end;
+    }
+
+  for (i = 0, crt_obj = obj; i < num_objs; i++, crt_obj = LC_NEXT_ONEOBJ_PTR_IN_COPYAREA (crt_obj))
+    {
+      LC_RECDES_TO_GET_ONEOBJ (force_area, crt_obj, &recdes_array[i]);
+    }
+
+  error_code =
+    locator_multi_insert_force (thread_p, &obj->hfid, &obj->class_oid, recdes_array, num_objs,
+				LC_ONEOBJ_GET_INDEX_FLAG (obj), SINGLE_ROW_INSERT, force_scancache, NULL, oid_array,
+				force_count);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  for (i = 0, crt_obj = obj; i < num_objs; i++, crt_obj = LC_NEXT_ONEOBJ_PTR_IN_COPYAREA (crt_obj))
+    {
+      COPY_OID (&crt_obj->oid, &oid_array[i]);
+    }
+
+end:
+  if (recdes_array != NULL)
+    {
+      db_private_free (thread_p, recdes_array);
+    }
+  if (oid_array != NULL)
+    {
+      db_private_free (thread_p, oid_array);
+    }
+  return error_code;
+}
+
 /*
  * xlocator_force () - Updates objects sent by log applier
  *
@@ -7049,6 +7289,7 @@ xlocator_force (THREAD_ENTRY * thread_p, LC_COPYAREA * force_area, int num_ignor
   int error_code = NO_ERROR;
   int pruning_type = 0;
   int has_index;
+  int num_batch_objs;
 
   /* need to start a topop to ensure the atomic operation. */
   error_code = xtran_server_start_topop (thread_p, &lsa);
@@ -7111,6 +7352,28 @@ xlocator_force (THREAD_ENTRY * thread_p, LC_COPYAREA * force_area, int num_ignor
 	case LC_FLUSH_INSERT:
 	case LC_FLUSH_INSERT_PRUNE:
 	case LC_FLUSH_INSERT_PRUNE_VERIFY:
+	  if (obj->operation == LC_FLUSH_INSERT && !LOG_CHECK_LOG_APPLIER (thread_p) && num_ignore_error == 0)
+	    {
+	      num_batch_objs = locator_count_insert_batch_objs (mobjs, obj, i);
+	      if (num_batch_objs > 1)
+		{
+		  /* insert the run of objects together */
+		  error_code =
+		    locator_force_insert_batch_objs (thread_p, force_area, obj, num_batch_objs, force_scancache,
+						     &force_count);
+		  if (error_code == NO_ERROR)
+		    {
+		      /* monitor */
+		      perfmon_add_stat (thread_p, PSTAT_QM_NUM_INSERTS, num_batch_objs);
+
+		      /* skip the objects of the run */
+		      i += num_batch_objs - 1;
+		      obj -= num_batch_objs - 1;
+		    }
+		  break;
+		}
+	    }
+
 	  pruning_type = locator_area_op_to_pruning_type (obj->operation);
 	  error_code =
 	    locator_insert_force (thread_p, &obj->hfid, &obj->class_oid, &obj->oid, &recdes, has_index,
@@ -7323,6 +7586,192 @@ locator_allocate_copy_area_by_attr_info (THREAD_ENTRY * thread_p, HEAP_CACHE_ATT
   return copyarea;
 }
 
+/*
+ * locator_start_insert_batch () - Start collecting objects of a class to insert them together
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   batch(out): insert batch
+ *   hfid(in): heap of class
+ *   class_oid(in): class of objects; must not be partitioned
+ *   op_type(in):
+ *   scan_cache(in): scan cache used for insert
+ *   func_preds(in): cached function index expressions
+ *   max_recdes(in): maximum number of objects inserted together
+ */
+int
+locator_start_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch, const HFID * hfid,
+			    const OID * class_oid, int op_type, HEAP_SCANCACHE * scan_cache,
+			    FUNC_PRED_UNPACK_INFO * func_preds, int max_recdes)
+{
+  assert (batch != NULL && max_recdes > 0);
+
+  HFID_COPY (&batch->hfid, hfid);
+  COPY_OID (&batch->class_oid, class_oid);
+  batch->op_type = op_type;
+  batch->scan_cache = scan_cache;
+  batch->func_preds = func_preds;
+
+  batch->num_recdes = 0;
+  batch->max_recdes = max_recdes;
+  batch->area_size = DB_PAGESIZE * 4;
+  batch->area_used = 0;
+
+  batch->recdes = (RECDES *) db_private_alloc (thread_p, max_recdes * sizeof (RECDES));
+  batch->oids = (OID *) db_private_alloc (thread_p, max_recdes * sizeof (OID));
+  batch->area = (char *) db_private_alloc (thread_p, batch->area_size);
+  if (batch->recdes == NULL || batch->oids == NULL || batch->area == NULL)
+    {
+      locator_end_insert_batch (thread_p, batch);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * locator_add_to_insert_batch () - Add an object represented by attribute information to insert batch
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   batch(in/out): insert batch
+ *   attr_info(in/out): Attribute information of object
+ *   force_count(out): number of objects inserted to make room for this one
+ */
+int
+locator_add_to_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch, HEAP_CACHE_ATTRINFO * attr_info,
+			     int *force_count)
+{
+  RECDES *recdes;
+  SCAN_CODE scan;
+  char *new_area;
+  int needed_size;
+  int error_code = NO_ERROR;
+
+  *force_count = 0;
+
+  if (batch->num_recdes >= batch->max_recdes)
+    {
+      error_code = locator_flush_insert_batch (thread_p, batch, force_count);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  recdes = &batch->recdes[batch->num_recdes];
+  while (true)
+    {
+      recdes->data = batch->area + batch->area_used;
+      recdes->area_size = batch->area_size - batch->area_used;
+
+      scan = heap_attrinfo_transform_to_disk (thread_p, attr_info, NULL, recdes);
+      if (scan == S_SUCCESS)
+	{
+	  break;
+	}
+      if (scan != S_DOESNT_FIT)
+	{
+	  return ER_FAILED;
+	}
+
+      needed_size = DB_ALIGN (-recdes->length, MAX_ALIGNMENT);
+      if (batch->num_recdes > 0)
+	{
+	  int flushed_count;
+
+	  /* insert collected objects and reuse the whole area */
+	  error_code = locator_flush_insert_batch (thread_p, batch, &flushed_count);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	  *force_count += flushed_count;
+	  recdes = &batch->recdes[0];
+	}
+      else if (batch->area_size < needed_size)
+	{
+	  new_area = (char *) db_private_realloc (thread_p, batch->area, needed_size);
+	  if (new_area == NULL)
+	    {
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  batch->area = new_area;
+	  batch->area_size = needed_size;
+	}
+      else
+	{
+	  /* the transformation may not have given us the correct length, somehow */
+	  new_area = (char *) db_private_realloc (thread_p, batch->area, batch->area_size + DB_PAGESIZE);
+	  if (new_area == NULL)
+	    {
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  batch->area = new_area;
+	  batch->area_size += DB_PAGESIZE;
+	}
+    }
+
+  batch->area_used += DB_ALIGN (recdes->length, MAX_ALIGNMENT);
+  batch->num_recdes++;
+
+  return NO_ERROR;
+}
+
+/*
+ * locator_flush_insert_batch () - Insert collected objects
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   batch(in/out): insert batch
+ *   force_count(out): number of inserted objects
+ */
+int
+locator_flush_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch, int *force_count)
+{
+  int error_code = NO_ERROR;
+
+  *force_count = 0;
+  if (batch->num_recdes == 0)
+    {
+      return NO_ERROR;
+    }
+
+  error_code =
+    locator_multi_insert_force (thread_p, &batch->hfid, &batch->class_oid, batch->recdes, batch->num_recdes, true,
+				batch->op_type, batch->scan_cache, batch->func_preds, batch->oids, force_count);
+
+  batch->num_recdes = 0;
+  batch->area_used = 0;
+
+  return error_code;
+}
+
+/*
+ * locator_end_insert_batch () - Free insert batch. Objects not flushed are discarded.
+ *
+ * return: void
+ *
+ *   batch(in): insert batch
+ */
+void
+locator_end_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch)
+{
+  if (batch->recdes != NULL)
+    {
+      db_private_free_and_init (thread_p, batch->recdes);
+    }
+  if (batch->oids != NULL)
+    {
+      db_private_free_and_init (thread_p, batch->oids);
+    }
+  if (batch->area != NULL)
+    {
+      db_private_free_and_init (thread_p, batch->area);
+    }
+  batch->num_recdes = 0;
+}
+
 /*
  * locator_attribute_info_force () - Force an object represented by attribute
  *                                   information structure
@@ -8048,6 +8497,315 @@ error:
 }
 #endif /* ENABLE_UNUSED_FUNCTION */
 
+/*
+ * locator_compare_multi_insert_keys () - compare keys of a multiple insert to sort them in index order
+ *
+ * return: -1, 0, 1
+ *
+ *   key1(in): LOCATOR_MULTI_INSERT_KEY
+ *   key2(in): LOCATOR_MULTI_INSERT_KEY
+ *
+ * Note: NULL keys go first. Equal keys keep the order of objects.
+ */
+static int
+locator_compare_multi_insert_keys (const void *key1, const void *key2)
+{
+  const LOCATOR_MULTI_INSERT_KEY *k1 = (const LOCATOR_MULTI_INSERT_KEY *) key1;
+  const LOCATOR_MULTI_INSERT_KEY *k2 = (const LOCATOR_MULTI_INSERT_KEY *) key2;
+  int c;
+
+  if (DB_IS_NULL (&k1->key) || DB_IS_NULL (&k2->key))
+    {
+      if (!DB_IS_NULL (&k1->key))
+	{
+	  return 1;
+	}
+      if (!DB_IS_NULL (&k2->key))
+	{
+	  return -1;
+	}
+    }
+  else
+    {
+      c = tp_value_compare (&k1->key, &k2->key, 0, 1);
+      if (c == DB_LT)
+	{
+	  return -1;
+	}
+      else if (c == DB_GT)
+	{
+	  return 1;
+	}
+    }
+
+  return k1->rec_index - k2->rec_index;
+}
+
+/*
+ * locator_add_index_for_multi_insert () - Add index entries of inserted objects
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   recdes_array(in): The objects
+ *   oid_array(in): The object identifiers
+ *   num_recdes(in): Number of objects
+ *   class_oid(in): The class object identifier
+ *   op_type(in):
+ *   scan_cache(in):
+ *   hfid(in):
+ *   func_preds(in): cached function index expressions
+ *
+ * Note: Same as locator_add_or_remove_index for insert of each object, but the
+ *       keys of all objects are generated first and each index gets its keys in
+ *       key order.
+ */
+static int
+locator_add_index_for_multi_insert (THREAD_ENTRY * thread_p, RECDES * recdes_array, OID * oid_array, int num_recdes,
+				    OID * class_oid, int op_type, HEAP_SCANCACHE * scan_cache, HFID * hfid,
+				    FUNC_PRED_UNPACK_INFO * func_preds)
+{
+  int num_found;
+  int i, j, num_btids;
+  HEAP_CACHE_ATTRINFO index_attrinfo;
+  HEAP_IDX_ELEMENTS_INFO idx_info;
+  BTID btid;
+  DB_VALUE *key_dbvalue;
+  DB_VALUE dbvalue;
+  int dummy_unique;
+  BTREE_UNIQUE_STATS *unique_stat_info;
+  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_buf;
+  OR_INDEX *index;
+  int error_code = NO_ERROR;
+  LOCATOR_MULTI_INSERT_KEY *keys = NULL, *index_keys;
+  int *num_keys = NULL;
+  TP_DOMAIN *key_domain = NULL;
+  OID **inst_oids = NULL;
+  RECDES **recs = NULL;
+  DB_LOGICAL *filter_results = NULL;
+  MVCCID mvccid;
+  MVCC_REC_HEADER *p_mvcc_rec_header = NULL;
+  MVCC_REC_HEADER mvcc_rec_header[2];
+
+  assert_release (class_oid != NULL);
+  assert_release (!OID_ISNULL (class_oid));
+
+  DB_MAKE_NULL (&dbvalue);
+
+  aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
+
+  num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &index_attrinfo, &idx_info);
+  num_btids = idx_info.num_btids;
+
+  if (num_found == 0)
+    {
+      return NO_ERROR;
+    }
+  else if (num_found < 0)
+    {
+      return ER_FAILED;
+    }
+
+#if defined(SERVER_MODE)
+  if (!mvcc_is_mvcc_disabled_class (class_oid))
+    {
+      /* Use MVCC if it's not disabled for current class */
+      mvccid = logtb_get_current_mvccid (thread_p);
+      btree_set_mvcc_header_ids_for_update (thread_p, false, true, &mvccid, mvcc_rec_header);
+      p_mvcc_rec_header = mvcc_rec_header;
+    }
+#endif /* SERVER_MODE */
+
+  keys = (LOCATOR_MULTI_INSERT_KEY *) db_private_alloc (thread_p, num_btids * num_recdes * sizeof (*keys));
+  num_keys = (int *) db_private_alloc (thread_p, num_btids * sizeof (int));
+  filter_results = (DB_LOGICAL *) db_private_alloc (thread_p, num_btids * num_recdes * sizeof (DB_LOGICAL));
+  inst_oids = (OID **) db_private_alloc (thread_p, num_recdes * sizeof (OID *));
+  recs = (RECDES **) db_private_alloc (thread_p, num_recdes * sizeof (RECDES *));
+  if (keys == NULL || num_keys == NULL || filter_results == NULL || inst_oids == NULL || recs == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  /* clear the key counts before anything can fail; the cleanup at end walks them */
+  for (i = 0; i < num_btids; i++)
+    {
+      num_keys[i] = 0;
+    }
+
+  for (j = 0; j < num_recdes; j++)
+    {
+      inst_oids[j] = &oid_array[j];
+      recs[j] = &recdes_array[j];
+    }
+
+  /* evaluate filter predicates of all objects */
+  for (i = 0; i < num_btids; i++)
+    {
+      index = &(index_attrinfo.last_classrepr->indexes[i]);
+      if (index->filter_predicate && index->filter_predicate->pred_stream)
+	{
+	  error_code =
+	    locator_eval_filter_predicate (thread_p, &index->btid, index->filter_predicate, class_oid, inst_oids,
+					   num_recdes, recs, &filter_results[i * num_recdes]);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+	}
+      else
+	{
+	  for (j = 0; j < num_recdes; j++)
+	    {
+	      filter_results[i * num_recdes + j] = V_TRUE;
+	    }
+	}
+    }
+
+  /* generate keys of all objects */
+  for (j = 0; j < num_recdes; j++)
+    {
+      if (idx_info.has_single_col)
+	{
+	  error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_array[j], &recdes_array[j], NULL, &index_attrinfo);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+	}
+
+      for (i = 0; i < num_btids; i++)
+	{
+	  if (filter_results[i * num_recdes + j] != V_TRUE)
+	    {
+	      continue;
+	    }
+
+	  index_keys = &keys[i * num_recdes];
+	  key_dbvalue =
+	    heap_attrvalue_get_key (thread_p, i, &index_attrinfo, &recdes_array[j], &btid, &dbvalue, aligned_buf,
+				    (func_preds ? &func_preds[i] : NULL), (num_keys[i] == 0) ? &key_domain : NULL);
+	  if (key_dbvalue == NULL)
+	    {
+	      error_code = ER_FAILED;
+	      goto end;
+	    }
+
+	  index_keys[num_keys[i]].rec_index = j;
+	  error_code = pr_clone_value (key_dbvalue, &index_keys[num_keys[i]].key);
+	  if (key_dbvalue == &dbvalue)
+	    {
+	      pr_clear_value (&dbvalue);
+	    }
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+	  if (DB_VALUE_TYPE (&index_keys[num_keys[i]].key) == DB_TYPE_MIDXKEY)
+	    {
+	      /* compare like in index */
+	      DB_GET_MIDXKEY (&index_keys[num_keys[i]].key)->domain = (num_keys[i] == 0) ? key_domain
+		: DB_GET_MIDXKEY (&index_keys[0].key)->domain;
+	    }
+	  num_keys[i]++;
+	}
+    }
+
+  for (i = 0; i < num_btids; i++)
+    {
+      index = &(index_attrinfo.last_classrepr->indexes[i]);
+      index_keys = &keys[i * num_recdes];
+      BTID_COPY (&btid, &index->btid);
+
+      if (num_keys[i] > 1)
+	{
+	  qsort (index_keys, num_keys[i], sizeof (*index_keys), locator_compare_multi_insert_keys);
+	}
+
+      unique_stat_info = NULL;
+      if (scan_cache != NULL
+	  && (op_type == MULTI_ROW_UPDATE || op_type == MULTI_ROW_INSERT || op_type == MULTI_ROW_DELETE))
+	{
+	  unique_stat_info = &(scan_cache->index_stat_info[i]);
+	}
+
+      for (j = 0; j < num_keys[i]; j++)
+	{
+	  OID *inst_oid = &oid_array[index_keys[j].rec_index];
+
+	  if (i < 1 || !locator_was_index_already_applied (&index_attrinfo, &index->btid, i))
+	    {
+	      if (index->type == BTREE_FOREIGN_KEY)
+		{
+		  if (lock_object (thread_p, inst_oid, class_oid, X_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
+		    {
+		      ASSERT_ERROR_AND_SET (error_code);
+		      goto end;
+		    }
+		}
+
+	      error_code =
+		btree_insert (thread_p, &btid, &index_keys[j].key, class_oid, inst_oid, op_type, unique_stat_info,
+			      &dummy_unique, p_mvcc_rec_header);
+	      if (error_code != NO_ERROR)
+		{
+		  ASSERT_ERROR ();
+		  goto end;
+		}
+	    }
+
+	  /* for replication; see locator_add_or_remove_index_internal */
+	  if (index->type == BTREE_PRIMARY_KEY && !LOG_CHECK_LOG_APPLIER (thread_p)
+	      && log_does_allow_replication () == true)
+	    {
+	      error_code =
+		repl_log_insert (thread_p, class_oid, inst_oid, LOG_REPLICATION_DATA, RVREPL_DATA_INSERT,
+				 &index_keys[j].key, REPL_INFO_TYPE_RBR_NORMAL);
+	      if (error_code != NO_ERROR)
+		{
+		  assert (er_errid () != NO_ERROR);
+		  goto end;
+		}
+	    }
+	}
+    }
+
+end:
+  if (keys != NULL && num_keys != NULL)
+    {
+      for (i = 0; i < num_btids; i++)
+	{
+	  for (j = 0; j < num_keys[i]; j++)
+	    {
+	      pr_clear_value (&keys[i * num_recdes + j].key);
+	    }
+	}
+    }
+  if (keys != NULL)
+    {
+      db_private_free (thread_p, keys);
+    }
+  if (num_keys != NULL)
+    {
+      db_private_free (thread_p, num_keys);
+    }
+  if (filter_results != NULL)
+    {
+      db_private_free (thread_p, filter_results);
+    }
+  if (inst_oids != NULL)
+    {
+      db_private_free (thread_p, inst_oids);
+    }
+  if (recs != NULL)
+    {
+      db_private_free (thread_p, recs);
+    }
+
+  heap_attrinfo_end (thread_p, &index_attrinfo);
+
+  return error_code;
+}
+
 /*
  * locator_eval_filter_predicate () - evaluate index filter predicate
  *
@@ -8134,6 +8892,42 @@ end:
   return error_code;
 }
 
+/*
+ * locator_is_index_updated () - Check whether an update may change the key of an index
+ *
+ * return: true if index key may change
+ *
+ *   index(in): index
+ *   att_id(in): Updated attr id array
+ *   n_att_id(in): Updated attr id array length
+ *
+ * Note: Filter indexes and primary keys referenced by foreign keys are always
+ *       considered changed; the caller must look at their keys.
+ */
+static bool
+locator_is_index_updated (OR_INDEX * index, ATTR_ID * att_id, int n_att_id)
+{
+  int j, k;
+
+  if (index->filter_predicate != NULL || (index->type == BTREE_PRIMARY_KEY && index->fk != NULL))
+    {
+      return true;
+    }
+
+  for (j = 0; j < n_att_id; j++)
+    {
+      for (k = 0; k < index->n_atts; k++)
+	{
+	  if (att_id[j] == (ATTR_ID) (index->atts[k]->id))
+	    {
+	      return true;
+	    }
+	}
+    }
+
+  return false;
+}
+
 /*
  * locator_update_index () - Update index entries
  *
@@ -8150,7 +8944,9 @@ end:
  *   repl_info(in/out): replication info, set need_replication to false when
  *                      no primary is found
  *
- * Note: Update the index entries of the given object.
+ * Note: Update the index entries of the given object. The object keeps its
+ *       OID on update, so when att_id is given, the indexes that have none of
+ *       the updated attributes keep their entries and are not looked at.
  */
 int
 locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old_recdes, ATTR_ID * att_id, int n_att_id,
@@ -8267,6 +9063,36 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
       return NO_ERROR;
     }
 
+  if (att_id != NULL && (repl_info == NULL || repl_info->need_replication == false || LOG_CHECK_LOG_APPLIER (thread_p)
+			 || log_does_allow_replication () == false))
+    {
+      /* no primary key value is needed for replication; if no index has an updated attribute, there is nothing to
+       * do and record values do not need to be read */
+      for (i = 0; i < num_btids; i++)
+	{
+	  if (locator_is_index_updated (&new_attrinfo->last_classrepr->indexes[i], att_id, n_att_id))
+	    {
+	      break;
+	    }
+	}
+      if (i == num_btids)
+	{
+	  perfmon_add_stat (thread_p, PSTAT_BT_NUM_UNTOUCHED_UPDATES, num_btids);
+
+	  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+	  tdes = LOG_FIND_TDES (tran_index);
+	  LSA_SET_NULL (&tdes->repl_insert_lsa);
+	  if (repl_info != NULL)
+	    {
+	      repl_info->need_replication = false;
+	    }
+
+	  heap_attrinfo_end (thread_p, new_attrinfo);
+	  heap_attrinfo_end (thread_p, old_attrinfo);
+	  return NO_ERROR;
+	}
+    }
+
   /* 
    * There are indices and the index attrinfo has been initialized
    * Indices must be updated when the indexed attributes have changed in value
@@ -8316,8 +9142,9 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 	  pk_btid_index = i;
 	}
 
-      /* check for specified update attributes */
-      if ((att_id != NULL) && ((use_mvcc == false) || (index->type == BTREE_PRIMARY_KEY && index->fk != NULL)))
+      /* check for specified update attributes; the object keeps its OID, so the entries of an index that has no
+       * updated attribute stay valid, with or without MVCC */
+      if (att_id != NULL)
 	{
 	  found_btid = false;	/* guess as not found */
 
@@ -8334,8 +9161,9 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 
 	  /* in MVCC, in case of BTREE_PRIMARY_KEY having FK need to update PK index but skip foreign key restrictions
 	   * checking */
-	  if (!found_btid && !index->filter_predicate && (index->type != BTREE_PRIMARY_KEY || index->fk == NULL))
+	  if (!locator_is_index_updated (index, att_id, n_att_id))
 	    {
+	      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_UNTOUCHED_UPDATES);
 	      continue;		/* skip and go ahead */
 	    }
 	}
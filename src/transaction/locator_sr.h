@@ -48,6 +48,26 @@ enum
   LOB_FLAG_INCLUDE_LOB
 };
 
+/* objects of one class collected to be inserted together */
+typedef struct locator_insert_batch LOCATOR_INSERT_BATCH;
+struct locator_insert_batch
+{
+  HFID hfid;			/* heap of class */
+  OID class_oid;		/* class of objects */
+  int op_type;
+  HEAP_SCANCACHE *scan_cache;
+  FUNC_PRED_UNPACK_INFO *func_preds;
+
+  RECDES *recdes;		/* collected objects in disk format */
+  OID *oids;			/* OIDs of inserted objects */
+  int num_recdes;
+  int max_recdes;
+
+  char *area;			/* data of collected objects */
+  int area_size;
+  int area_used;
+};
+
 extern bool locator_Dont_check_foreign_key;
 
 extern int locator_initialize (THREAD_ENTRY * thread_p);
@@ -70,6 +90,13 @@ extern int locator_attribute_info_force (THREAD_ENTRY * thread_p, const HFID * h
 					 FUNC_PRED_UNPACK_INFO * func_preds, MVCC_REEV_DATA * mvcc_reev_data,
 					 UPDATE_INPLACE_STYLE force_update_inplace, RECDES * rec_descriptor,
 					 bool need_locking);
+extern int locator_start_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch, const HFID * hfid,
+				       const OID * class_oid, int op_type, HEAP_SCANCACHE * scan_cache,
+				       FUNC_PRED_UNPACK_INFO * func_preds, int max_recdes);
+extern int locator_add_to_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch,
+					HEAP_CACHE_ATTRINFO * attr_info, int *force_count);
+extern int locator_flush_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch, int *force_count);
+extern void locator_end_insert_batch (THREAD_ENTRY * thread_p, LOCATOR_INSERT_BATCH * batch);
 extern LC_COPYAREA *locator_allocate_copy_area_by_attr_info (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info,
 							     RECDES * old_recdes, RECDES * new_recdes,
 							     const int copyarea_length_hint, int lob_create_flag);
@@ -155,6 +155,23 @@ extern int lock_Comp[11][11];
     } \
    while (0)
 
+/*
+ * Fast path for intention locks on classes.
+ *
+ * IS/IX class locks do not conflict with each other, so they can be granted without the resource mutex: the entry is
+ * kept only in the transaction class hold list and the resource counts it in fastpath_state. Any request that may
+ * conflict (or a non2pl operation) first disables the fast path and transfers the fast entries into the holder list
+ * while holding the resource mutex (see lock_fastpath_transfer).
+ */
+#define LK_FASTPATH_DISABLED ((INT32) 0x40000000)
+#define LK_FASTPATH_NHOLDERS(state) ((state) & ~LK_FASTPATH_DISABLED)
+#define LK_FASTPATH_IS_ELIGIBLE_LOCK(lock) ((lock) == IS_LOCK || (lock) == IX_LOCK)
+#define LK_FASTPATH_IS_CLASS_RESOURCE(res) \
+  ((res)->key.type == LOCK_RESOURCE_CLASS || (res)->key.type == LOCK_RESOURCE_ROOT_CLASS)
+/* modes that are compatible with every fast path holder */
+#define LK_FASTPATH_IS_WEAK_LOCK(lock) \
+  ((lock) == NULL_LOCK || (lock) == SCH_S_LOCK || (lock) == IS_LOCK || (lock) == IX_LOCK)
+
 #endif /* SERVER_MODE */
 
 #define RESOURCE_ALLOC_WAIT_TIME 10	/* 10 msec */
@@ -249,6 +266,7 @@ struct lk_WFG_node
   int ancestor;
   INT64 thrd_wait_stime;
   int tran_edge_seq_num;
+  INT64 searched_wait_stime;	/* lock wait already searched by the incremental deadlock detection */
   bool checked_by_deadlock_detector;
   bool DL_victim;
 };
@@ -358,6 +376,8 @@ struct lk_global_data
   int max_TWFG_edge;
   int TWFG_free_edge_idx;
   int global_edge_seq_num;
+  volatile INT32 num_new_lock_waiters;	/* suspended since the last incremental deadlock detection */
+  bool need_full_deadlock_scan;	/* an incremental search was inconclusive */
 
   /* miscellaneous things */
   short no_victim_case_count;
@@ -371,7 +391,7 @@ LK_GLOBAL_DATA lk_Gl = {
   0, LF_HASH_TABLE_INITIALIZER,
   LF_FREELIST_INITIALIZER, LF_FREELIST_INITIALIZER,
   0, NULL, PTHREAD_MUTEX_INITIALIZER, {0, 0},
-  NULL, NULL, 0, 0, 0, 0, false
+  NULL, NULL, 0, 0, 0, 0, false, 0, false
 #if defined(LK_DUMP)
     , 0
 #endif /* LK_DUMP */
@@ -408,6 +428,12 @@ static const int LK_SLEEP_MAX_COUNT = 3;
 /* TODO : change const */
 #define LK_MAX_VICTIM_COUNT  300
 
+/* bounds of the incremental deadlock search started from each new lock waiter */
+#define LK_DEADLOCK_SEARCH_MAX_DEPTH  10
+#define LK_DEADLOCK_SEARCH_MAX_STEPS  100
+#define LK_DEADLOCK_SEARCH_MAX_FANOUT 32
+#define LK_MAX_DEADLOCK_SUSPECT_RES   256
+
 /* transaction WFG edge related constants */
 static const int LK_MIN_TWFG_EDGE_COUNT = 200;
 /* TODO : change const */
@@ -424,6 +450,23 @@ static const int LK_COMPOSITE_LOCK_OID_INCREMENT = 100;
 static LK_WFG_EDGE TWFG_edge_block[LK_MID_TWFG_EDGE_COUNT];
 static LK_DEADLOCK_VICTIM victims[LK_MAX_VICTIM_COUNT];
 static int victim_count;
+
+/* incremental deadlock search from a new lock waiter */
+typedef struct lk_deadlock_search LK_DEADLOCK_SEARCH;
+struct lk_deadlock_search
+{
+  int origin_tran_index;	/* the new lock waiter */
+  int num_steps;		/* resources examined */
+  int num_visited;
+  int visited_tran_index[LK_DEADLOCK_SEARCH_MAX_STEPS];
+  LK_RES_KEY path[LK_DEADLOCK_SEARCH_MAX_DEPTH];	/* resources waited for along the current path */
+  int path_length;		/* length of the path when a cycle is found */
+  bool is_truncated;		/* a bound was hit, so a cycle cannot be ruled out */
+};
+
+/* resources of the cycles found by the incremental deadlock search */
+static LK_RES_KEY deadlock_suspect_res_keys[LK_MAX_DEADLOCK_SUSPECT_RES];
+static int deadlock_suspect_res_count;
 #else /* !SERVER_MODE */
 static int lk_Standalone_has_xlock = 0;
 #define LK_SET_STANDALONE_XLOCK(lock)					      \
@@ -451,6 +494,8 @@ static int lock_initialize_object_lock_res_list (void);
 static int lock_initialize_object_lock_entry_list (void);
 static int lock_initialize_deadlock_detection (void);
 static int lock_remove_resource (LK_RES * res_ptr);
+static void lock_link_class_hold_entry (LK_TRAN_LOCK * tran_lock, LK_ENTRY * entry_ptr);
+static void lock_unlink_class_hold_entry (LK_TRAN_LOCK * tran_lock, LK_ENTRY * entry_ptr);
 static void lock_insert_into_tran_hold_list (LK_ENTRY * entry_ptr, int owner_tran_index);
 static int lock_delete_from_tran_hold_list (LK_ENTRY * entry_ptr, int owner_tran_index);
 static void lock_insert_into_tran_non2pl_list (LK_ENTRY * non2pl, int owner_tran_index);
@@ -459,6 +504,12 @@ static LK_ENTRY *lock_find_tran_hold_entry (int tran_index, const OID * oid, boo
 static bool lock_is_class_lock_escalated (LOCK class_lock, LOCK lock_escalation);
 static LK_ENTRY *lock_add_non2pl_lock (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index, LOCK lock);
 static void lock_position_holder_entry (LK_RES * res_ptr, LK_ENTRY * entry_ptr);
+static bool lock_fastpath_try_grant (THREAD_ENTRY * thread_p, int tran_index, const OID * oid, LOCK lock,
+				     LK_ENTRY * class_entry, LK_ENTRY ** entry_addr_ptr);
+static bool lock_fastpath_convert (LK_ENTRY * entry_ptr, LOCK new_mode);
+static bool lock_fastpath_release (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr);
+static void lock_fastpath_transfer (THREAD_ENTRY * thread_p, LK_RES * res_ptr);
+static void lock_fastpath_enable_if_possible (LK_RES * res_ptr);
 static void lock_set_error_for_timeout (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr);
 static void lock_set_error_for_aborted (LK_ENTRY * entry_ptr, TRAN_ABORT_REASON abort_reason);
 static LOCK_WAIT_STATE lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs);
@@ -488,6 +539,13 @@ static void lock_remove_non2pl (LK_ENTRY * non2pl, int tran_index);
 static void lock_update_non2pl_list (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index, LOCK lock);
 static int lock_add_WFG_edge (int from_tran_index, int to_tran_index, int holder_flag, INT64 edge_wait_stime);
 static void lock_select_deadlock_victim (THREAD_ENTRY * thread_p, int s, int t);
+static void lock_initialize_WFG (void);
+static void lock_add_WFG_edges_of_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr);
+static void lock_resolve_WFG_cycles (THREAD_ENTRY * thread_p);
+static void lock_add_deadlock_search_next (LK_DEADLOCK_SEARCH * search, int *next_tran_index, int *num_next,
+					   int tran_index);
+static bool lock_search_deadlock_cycle (THREAD_ENTRY * thread_p, LK_DEADLOCK_SEARCH * search, int tran_index,
+					int depth);
 static void lock_dump_deadlock_victims (THREAD_ENTRY * thread_p, FILE * outfile);
 static int lock_compare_lock_info (const void *lockinfo1, const void *lockinfo2);
 static float lock_wait_msecs_to_secs (int msecs);
@@ -703,6 +761,7 @@ lock_init_resource (void *res)
   res_ptr->holder = NULL;
   res_ptr->waiter = NULL;
   res_ptr->non2pl = NULL;
+  res_ptr->fastpath_state = 0;
   res_ptr->hash_next = NULL;
 
   return NO_ERROR;
@@ -837,6 +896,7 @@ lock_initialize_entry (LK_ENTRY * entry_ptr)
   entry_ptr->instant_lock_count = 0;
   entry_ptr->bind_index_in_tran = -1;
   XASL_ID_SET_NULL (&entry_ptr->xasl_id);
+  entry_ptr->is_fastpath = false;
 }
 
 /* initialize lock entry as granted state */
@@ -855,6 +915,7 @@ lock_initialize_entry_as_granted (LK_ENTRY * entry_ptr, int tran_index, LK_RES *
   entry_ptr->class_entry = NULL;
   entry_ptr->ngranules = 0;
   entry_ptr->instant_lock_count = 0;
+  entry_ptr->is_fastpath = false;
 
   lock_event_set_xasl_id_to_entry (tran_index, entry_ptr);
 }
@@ -876,6 +937,7 @@ lock_initialize_entry_as_blocked (LK_ENTRY * entry_ptr, THREAD_ENTRY * thread_p,
   entry_ptr->class_entry = NULL;
   entry_ptr->ngranules = 0;
   entry_ptr->instant_lock_count = 0;
+  entry_ptr->is_fastpath = false;
 
   lock_event_set_xasl_id_to_entry (tran_index, entry_ptr);
 }
@@ -896,6 +958,7 @@ lock_initialize_entry_as_non2pl (LK_ENTRY * entry_ptr, int tran_index, LK_RES *
   entry_ptr->class_entry = NULL;
   entry_ptr->ngranules = 0;
   entry_ptr->instant_lock_count = 0;
+  entry_ptr->is_fastpath = false;
 }
 
 /* initialize lock resource as free state */
@@ -911,6 +974,7 @@ lock_initialize_resource (LK_RES * res_ptr)
   res_ptr->holder = NULL;
   res_ptr->waiter = NULL;
   res_ptr->non2pl = NULL;
+  res_ptr->fastpath_state = 0;
   res_ptr->hash_next = NULL;
 }
 
@@ -1146,6 +1210,7 @@ lock_initialize_deadlock_detection (void)
       lk_Gl.TWFG_node[i].DL_victim = false;
       lk_Gl.TWFG_node[i].checked_by_deadlock_detector = false;
       lk_Gl.TWFG_node[i].thrd_wait_stime = 0;
+      lk_Gl.TWFG_node[i].searched_wait_stime = 0;
     }
 
   /* initialize other related fields */
@@ -1153,6 +1218,8 @@ lock_initialize_deadlock_detection (void)
   lk_Gl.max_TWFG_edge = 0;
   lk_Gl.TWFG_free_edge_idx = -1;
   lk_Gl.global_edge_seq_num = 0;
+  lk_Gl.num_new_lock_waiters = 0;
+  lk_Gl.need_full_deadlock_scan = false;
 
   return NO_ERROR;
 }
@@ -1174,6 +1241,20 @@ lock_remove_resource (LK_RES * res_ptr)
 {
   LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (NULL, THREAD_TS_OBJ_LOCK_RES);
   int success = 0, rc;
+  INT32 state;
+
+  /* a resource still counting fast path holders must stay; disable the fast path so that nobody is counted on a
+   * resource which is being removed */
+  do
+    {
+      state = res_ptr->fastpath_state;
+      if (LK_FASTPATH_NHOLDERS (state) > 0)
+	{
+	  pthread_mutex_unlock (&res_ptr->res_mutex);
+	  return NO_ERROR;
+	}
+    }
+  while (!ATOMIC_CAS_32 (&res_ptr->fastpath_state, state, state | LK_FASTPATH_DISABLED));
 
   rc = lf_hash_delete_already_locked (t_entry, &lk_Gl.obj_hash_table, (void *) &res_ptr->key, res_ptr, &success);
   if (!success)
@@ -1201,6 +1282,59 @@ lock_remove_resource (LK_RES * res_ptr)
  */
 
 #if defined(SERVER_MODE)
+/*
+ * lock_link_class_hold_entry - Link a class lock entry at the head of the transaction class hold list
+ *
+ * return: nothing
+ *
+ *   tran_lock(in): transaction lock table entry; the caller holds its hold_mutex
+ *   entry_ptr(in): class lock entry
+ */
+static void
+lock_link_class_hold_entry (LK_TRAN_LOCK * tran_lock, LK_ENTRY * entry_ptr)
+{
+  if (tran_lock->class_hold_list != NULL)
+    {
+      tran_lock->class_hold_list->tran_prev = entry_ptr;
+    }
+  entry_ptr->tran_next = tran_lock->class_hold_list;
+  tran_lock->class_hold_list = entry_ptr;
+  tran_lock->class_hold_count++;
+}
+
+/*
+ * lock_unlink_class_hold_entry - Unlink a class lock entry from the transaction class hold list
+ *
+ * return: nothing
+ *
+ *   tran_lock(in): transaction lock table entry; the caller holds its hold_mutex
+ *   entry_ptr(in): class lock entry
+ */
+static void
+lock_unlink_class_hold_entry (LK_TRAN_LOCK * tran_lock, LK_ENTRY * entry_ptr)
+{
+  if (tran_lock->class_hold_list == entry_ptr)
+    {
+      tran_lock->class_hold_list = entry_ptr->tran_next;
+      if (entry_ptr->tran_next)
+	{
+	  entry_ptr->tran_next->tran_prev = NULL;
+	}
+    }
+  else
+    {
+      if (entry_ptr->tran_prev)
+	{
+	  entry_ptr->tran_prev->tran_next = entry_ptr->tran_next;
+	}
+      if (entry_ptr->tran_next)
+	{
+	  entry_ptr->tran_next->tran_prev = entry_ptr->tran_prev;
+	}
+    }
+  tran_lock->class_hold_count--;
+}
+
 /*
  * lock_insert_into_tran_hold_list - Insert the given lock entry
  *                      into the transaction lock hold list
@@ -1263,13 +1397,7 @@ lock_insert_into_tran_hold_list (LK_ENTRY * entry_ptr, int owner_tran_index)
 	    }
 	}
 #endif /* CUBRID_DEBUG */
-      if (tran_lock->class_hold_list != NULL)
-	{
-	  tran_lock->class_hold_list->tran_prev = entry_ptr;
-	}
-      entry_ptr->tran_next = tran_lock->class_hold_list;
-      tran_lock->class_hold_list = entry_ptr;
-      tran_lock->class_hold_count++;
+      lock_link_class_hold_entry (tran_lock, entry_ptr);
       break;
 
     case LOCK_RESOURCE_INSTANCE:
@@ -1357,26 +1485,7 @@ lock_delete_from_tran_hold_list (LK_ENTRY * entry_ptr, int owner_tran_index)
       break;
 
     case LOCK_RESOURCE_CLASS:
-      if (tran_lock->class_hold_list == entry_ptr)
-	{
-	  tran_lock->class_hold_list = entry_ptr->tran_next;
-	  if (entry_ptr->tran_next)
-	    {
-	      entry_ptr->tran_next->tran_prev = NULL;
-	    }
-	}
-      else
-	{
-	  if (entry_ptr->tran_prev)
-	    {
-	      entry_ptr->tran_prev->tran_next = entry_ptr->tran_next;
-	    }
-	  if (entry_ptr->tran_next)
-	    {
-	      entry_ptr->tran_next->tran_prev = entry_ptr->tran_prev;
-	    }
-	}
-      tran_lock->class_hold_count--;
+      lock_unlink_class_hold_entry (tran_lock, entry_ptr);
       break;
 
     case LOCK_RESOURCE_INSTANCE:
@@ -1610,6 +1719,9 @@ lock_add_non2pl_lock (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index,
 
   /* The caller is holding a resource mutex */
 
+  /* non2pl entries are checked against every acquisition, which the fast path skips */
+  lock_fastpath_transfer (thread_p, res_ptr);
+
   /* find the non2pl entry of the given transaction */
   non2pl = res_ptr->non2pl;
   while (non2pl != NULL)
@@ -1795,6 +1907,300 @@ lock_position_holder_entry (LK_RES * res_ptr, LK_ENTRY * entry_ptr)
 }
 #endif /* SERVER_MODE */
 
+#if defined(SERVER_MODE)
+/*
+ * lock_fastpath_try_grant - Grant an intention lock on a class without the resource mutex
+ *
+ * return: true if the lock was granted, false if the request must take the regular path
+ *
+ *   tran_index(in): transaction table index
+ *   oid(in): class object identifier
+ *   lock(in): IS_LOCK or IX_LOCK
+ *   class_entry(in): lock entry of the class hierarchy parent (to manage granules)
+ *   entry_addr_ptr(out): the granted lock entry
+ *
+ * Note:The caller has checked that the transaction holds no lock on the class.
+ *     The request is granted only if the class resource already exists and its fast path is enabled. An enabled
+ *     fast path guarantees that no holder or waiter has a mode conflicting with an intention lock.
+ */
+static bool
+lock_fastpath_try_grant (THREAD_ENTRY * thread_p, int tran_index, const OID * oid, LOCK lock, LK_ENTRY * class_entry,
+			 LK_ENTRY ** entry_addr_ptr)
+{
+  LF_TRAN_ENTRY *t_entry_res = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_RES);
+  LF_TRAN_ENTRY *t_entry_ent = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_ENT);
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_RES_KEY search_key;
+  LK_RES *res_ptr = NULL;
+  LK_ENTRY *entry_ptr;
+  INT32 state;
+  int rv;
+
+  assert (LK_FASTPATH_IS_ELIGIBLE_LOCK (lock));
+
+  search_key = lock_create_search_key ((OID *) oid, NULL);
+  rv = lf_hash_find_no_lock (t_entry_res, &lk_Gl.obj_hash_table, (void *) &search_key, (void **) &res_ptr);
+  if (rv != NO_ERROR || res_ptr == NULL)
+    {
+      /* the first lock on the class creates the resource on the regular path */
+      return false;
+    }
+  /* the lock-free transaction is still started, so res_ptr cannot be reclaimed before we are done */
+
+  entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list);
+  if (entry_ptr == NULL)
+    {
+      lf_tran_end_with_mb (t_entry_res);
+      return false;
+    }
+
+  /* count the holder and link the entry under the hold mutex, so lock_fastpath_transfer finds every counted entry */
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  do
+    {
+      state = res_ptr->fastpath_state;
+      if (state & LK_FASTPATH_DISABLED)
+	{
+	  pthread_mutex_unlock (&tran_lock->hold_mutex);
+	  lf_tran_end_with_mb (t_entry_res);
+	  lock_free_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list, entry_ptr);
+	  return false;
+	}
+    }
+  while (!ATOMIC_CAS_32 (&res_ptr->fastpath_state, state, state + 1));
+
+  lock_initialize_entry_as_granted (entry_ptr, tran_index, res_ptr, lock);
+  entry_ptr->is_fastpath = true;
+  entry_ptr->class_entry = class_entry;
+  lock_increment_class_granules (class_entry);
+  if (res_ptr->key.type == LOCK_RESOURCE_ROOT_CLASS)
+    {
+      assert (tran_lock->root_class_hold == NULL);
+      entry_ptr->tran_next = tran_lock->root_class_hold;
+      tran_lock->root_class_hold = entry_ptr;
+    }
+  else
+    {
+      lock_link_class_hold_entry (tran_lock, entry_ptr);
+    }
+
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+  lf_tran_end_with_mb (t_entry_res);
+
+  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_ACQUIRED_ON_OBJECTS);
+  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_FASTPATH_ACQUIRED_ON_OBJECTS);
+#if defined(LK_TRACE_OBJECT)
+  LK_MSG_LOCK_ACQUIRED (entry_ptr);
+#endif /* LK_TRACE_OBJECT */
+
+  *entry_addr_ptr = entry_ptr;
+  return true;
+}
+
+/*
+ * lock_fastpath_convert - Convert a fast path entry to another intention mode
+ *
+ * return: true if converted, false if the entry has been transferred to the holder list meanwhile
+ *
+ *   entry_ptr(in): fast path lock entry of current transaction
+ *   new_mode(in): IS_LOCK or IX_LOCK
+ */
+static bool
+lock_fastpath_convert (LK_ENTRY * entry_ptr, LOCK new_mode)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[entry_ptr->tran_index];
+  bool converted;
+  int rv;
+
+  assert (LK_FASTPATH_IS_ELIGIBLE_LOCK (new_mode));
+
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  converted = entry_ptr->is_fastpath;
+  if (converted)
+    {
+      entry_ptr->granted_mode = new_mode;
+    }
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  return converted;
+}
+
+/*
+ * lock_fastpath_release - Release a fast path entry without the resource mutex
+ *
+ * return: true if released, false if the entry has been transferred to the holder list meanwhile
+ *
+ *   entry_ptr(in): lock entry of current transaction
+ */
+static bool
+lock_fastpath_release (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr)
+{
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_ENT);
+  LF_TRAN_ENTRY *t_entry_res;
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[entry_ptr->tran_index];
+  LK_RES_KEY search_key;
+  LK_RES *res_ptr;
+  bool was_last;
+  int rv;
+
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  if (!entry_ptr->is_fastpath)
+    {
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+      return false;
+    }
+
+#if defined(LK_TRACE_OBJECT)
+  LK_MSG_LOCK_RELEASE (entry_ptr);
+#endif /* LK_TRACE_OBJECT */
+
+  if (entry_ptr->res_head->key.type == LOCK_RESOURCE_ROOT_CLASS)
+    {
+      tran_lock->root_class_hold = NULL;
+    }
+  else
+    {
+      lock_unlink_class_hold_entry (tran_lock, entry_ptr);
+    }
+  entry_ptr->is_fastpath = false;
+  search_key = entry_ptr->res_head->key;
+  /* after this, the resource may be removed; it must not be accessed anymore */
+  was_last = (ATOMIC_INC_32 (&entry_ptr->res_head->fastpath_state, -1) == 0);
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  lock_decrement_class_granules (entry_ptr->class_entry);
+  lock_free_entry (entry_ptr->tran_index, t_entry, &lk_Gl.obj_free_entry_list, entry_ptr);
+
+  if (was_last)
+    {
+      /* the regular holders may all be gone already; the last one out removes the unused resource */
+      t_entry_res = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_RES);
+      if (lf_hash_find (t_entry_res, &lk_Gl.obj_hash_table, (void *) &search_key, (void **) &res_ptr) == NO_ERROR
+	  && res_ptr != NULL)
+	{
+	  if (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL)
+	    {
+	      (void) lock_remove_resource (res_ptr);
+	    }
+	  else
+	    {
+	      pthread_mutex_unlock (&res_ptr->res_mutex);
+	    }
+	}
+    }
+
+  return true;
+}
+
+/*
+ * lock_fastpath_transfer - Disable the fast path of a class resource and move its fast path entries into the holder
+ *                          list
+ *
+ * return: nothing
+ *
+ *   res_ptr(in): lock resource; the caller holds its mutex
+ *
+ * Note:Must be called before any decision that needs the complete holder list of a class resource, e.g. before
+ *     granting or queueing a mode which is not compatible with intention locks. The fast path stays disabled until
+ *     lock_fastpath_enable_if_possible finds the resource weak again.
+ */
+static void
+lock_fastpath_transfer (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
+{
+  LK_TRAN_LOCK *tran_lock;
+  LK_ENTRY *entry_ptr;
+  LOCK mode;
+  INT32 state;
+  int tran_index, transferred = 0;
+  int rv;
+
+  if (!LK_FASTPATH_IS_CLASS_RESOURCE (res_ptr))
+    {
+      return;
+    }
+
+  /* no new fast path holder can be counted after this */
+  state = res_ptr->fastpath_state;
+  while (!(state & LK_FASTPATH_DISABLED) && !ATOMIC_CAS_32 (&res_ptr->fastpath_state, state,
+							      state | LK_FASTPATH_DISABLED))
+    {
+      state = res_ptr->fastpath_state;
+    }
+
+  mode = res_ptr->total_holders_mode;
+  for (tran_index = 0; tran_index < lk_Gl.num_trans && LK_FASTPATH_NHOLDERS (res_ptr->fastpath_state) > 0;
+       tran_index++)
+    {
+      tran_lock = &lk_Gl.tran_lock_table[tran_index];
+      rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+      entry_ptr = (res_ptr->key.type == LOCK_RESOURCE_ROOT_CLASS) ? tran_lock->root_class_hold
+	: tran_lock->class_hold_list;
+      for (; entry_ptr != NULL; entry_ptr = entry_ptr->tran_next)
+	{
+	  if (entry_ptr->res_head == res_ptr && entry_ptr->is_fastpath)
+	    {
+	      entry_ptr->is_fastpath = false;
+	      lock_position_holder_entry (res_ptr, entry_ptr);
+
+	      assert (entry_ptr->granted_mode >= NULL_LOCK && mode >= NULL_LOCK);
+	      mode = lock_Conv[entry_ptr->granted_mode][mode];
+	      assert (mode != NA_LOCK);
+
+	      ATOMIC_INC_32 (&res_ptr->fastpath_state, -1);
+	      transferred++;
+	      /* a transaction holds one entry per class */
+	      break;
+	    }
+	}
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+    }
+  res_ptr->total_holders_mode = mode;
+
+  assert (LK_FASTPATH_NHOLDERS (res_ptr->fastpath_state) == 0);
+
+  if (transferred > 0)
+    {
+      perfmon_add_stat (thread_p, PSTAT_LK_NUM_FASTPATH_TRANSFERRED_ON_OBJECTS, transferred);
+    }
+}
+
+/*
+ * lock_fastpath_enable_if_possible - Enable again the fast path of a class resource
+ *
+ * return: nothing
+ *
+ *   res_ptr(in): lock resource; the caller holds its mutex
+ *
+ * Note:The fast path is enabled only when every holder is compatible with intention locks, nobody waits and there
+ *     is no non2pl entry.
+ */
+static void
+lock_fastpath_enable_if_possible (LK_RES * res_ptr)
+{
+  INT32 state;
+
+  if (!LK_FASTPATH_IS_CLASS_RESOURCE (res_ptr) || !(res_ptr->fastpath_state & LK_FASTPATH_DISABLED))
+    {
+      return;
+    }
+
+  /* blocked holders are positioned first in the holder list */
+  if (res_ptr->waiter != NULL || res_ptr->non2pl != NULL
+      || (res_ptr->holder != NULL && res_ptr->holder->blocked_mode != NULL_LOCK)
+      || !LK_FASTPATH_IS_WEAK_LOCK (res_ptr->total_holders_mode))
+    {
+      return;
+    }
+
+  /* fast path holders may only leave concurrently */
+  do
+    {
+      state = res_ptr->fastpath_state;
+    }
+  while (!ATOMIC_CAS_32 (&res_ptr->fastpath_state, state, state & ~LK_FASTPATH_DISABLED));
+}
+#endif /* SERVER_MODE */
+
 
 /*
  *  Private Functions Group: timeout related functions
@@ -2139,7 +2545,8 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
 
   lk_Gl.TWFG_node[entry_ptr->tran_index].thrd_wait_stime = entry_ptr->thrd_entry->lockwait_stime;
 
-  /* wakeup the dealock detect thread */
+  /* wakeup the dealock detect thread; it searches a cycle from this new waiter right away */
+  ATOMIC_INC_32 (&lk_Gl.num_new_lock_waiters, 1);
   thread_wakeup_deadlock_detect_thread ();
 
   tdes = LOG_FIND_CURRENT_TDES (thread_p);
@@ -3081,6 +3488,11 @@ lock_internal_hold_lock_object_instant (int tran_index, const OID * oid, const O
       return LK_GRANTED;
     }
 
+  if (!LK_FASTPATH_IS_WEAK_LOCK (lock))
+    {
+      lock_fastpath_transfer (NULL, res_ptr);
+    }
+
   /* the lockable object exists in the hash chain */
   /* So, check whether I am a holder of the object. */
   /* find the lock entry of current transaction */
@@ -3306,6 +3718,14 @@ start:
 	  res_ptr = entry_ptr->res_head;
 	  goto lock_tran_lk_entry;
 	}
+
+      /* Intention locks on a class can usually be granted without the resource mutex. */
+      if (LK_FASTPATH_IS_ELIGIBLE_LOCK (lock) && !is_instant_duration
+	  && lock_fastpath_try_grant (thread_p, tran_index, oid, lock, class_entry, entry_addr_ptr))
+	{
+	  ret_val = LK_GRANTED;
+	  goto end;
+	}
     }
 
   /* find or add the lockable object in the lock table */
@@ -3322,6 +3742,19 @@ start:
   /* Find or insert also locks the resource mutex. */
   is_res_mutex_locked = true;
 
+  if (LK_FASTPATH_IS_CLASS_RESOURCE (res_ptr))
+    {
+      if (LK_FASTPATH_IS_WEAK_LOCK (lock))
+	{
+	  lock_fastpath_enable_if_possible (res_ptr);
+	}
+      else
+	{
+	  /* the decision below needs every holder of the class */
+	  lock_fastpath_transfer (thread_p, res_ptr);
+	}
+    }
+
   if (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL)
     {
       /* the lockable object was NOT in the hash chain */
@@ -3634,13 +4067,27 @@ lock_tran_lk_entry:
       goto end;
     }
 
-  if (!is_res_mutex_locked)
+  if (entry_ptr->is_fastpath && LK_FASTPATH_IS_ELIGIBLE_LOCK (new_mode) && !is_instant_duration
+      && lock_fastpath_convert (entry_ptr, new_mode))
     {
-      /* We need to lock resource mutex. */
+      /* IS_LOCK => IX_LOCK is compatible with every holder while the fast path is enabled */
+      assert (!is_res_mutex_locked);
+      entry_ptr->count += 1;
+      goto lock_conversion_treatement;
+    }
+
+  if (!is_res_mutex_locked)
+    {
+      /* We need to lock resource mutex. */
       pthread_mutex_lock (&res_ptr->res_mutex);
       is_res_mutex_locked = true;
     }
 
+  if (LK_FASTPATH_IS_CLASS_RESOURCE (res_ptr) && (entry_ptr->is_fastpath || !LK_FASTPATH_IS_WEAK_LOCK (new_mode)))
+    {
+      lock_fastpath_transfer (thread_p, res_ptr);
+    }
+
   /* check the compatibility with other holders' granted mode */
   group_mode = NULL_LOCK;
   for (i = res_ptr->holder; i != NULL; i = i->next)
@@ -3971,10 +4418,22 @@ lock_internal_perform_unlock_object (THREAD_ENTRY * thread_p, LK_ENTRY * entry_p
 	}
     }
 
+  if (entry_ptr->is_fastpath && (release_flag == true || move_to_non2pl == false)
+      && lock_fastpath_release (thread_p, entry_ptr))
+    {
+      return;
+    }
+
   /* hold resource mutex */
   res_ptr = entry_ptr->res_head;
   rv = pthread_mutex_lock (&res_ptr->res_mutex);
 
+  if (entry_ptr->is_fastpath)
+    {
+      /* the entry is going to be moved to the non2pl list */
+      lock_fastpath_transfer (thread_p, res_ptr);
+    }
+
   /* check if the transaction is in the holder list */
   prev = NULL;
   curr = res_ptr->holder;
@@ -4047,6 +4506,7 @@ lock_internal_perform_unlock_object (THREAD_ENTRY * thread_p, LK_ENTRY * entry_p
 		  res_ptr->key.oid.pageid, res_ptr->key.oid.slotid);
 	}
 
+      lock_fastpath_enable_if_possible (res_ptr);
       pthread_mutex_unlock (&res_ptr->res_mutex);
 
       return;
@@ -4119,6 +4579,7 @@ lock_internal_perform_unlock_object (THREAD_ENTRY * thread_p, LK_ENTRY * entry_p
       lock_grant_blocked_holder (thread_p, res_ptr);
 
       (void) lock_grant_blocked_waiter (thread_p, res_ptr);
+      lock_fastpath_enable_if_possible (res_ptr);
       pthread_mutex_unlock (&res_ptr->res_mutex);
     }
 }
@@ -4227,6 +4688,7 @@ lock_internal_demote_shared_class_lock (THREAD_ENTRY * thread_p, LK_ENTRY * entr
   /* grant the blocked holders and blocked waiters */
   lock_grant_blocked_holder (thread_p, res_ptr);
   (void) lock_grant_blocked_waiter (thread_p, res_ptr);
+  lock_fastpath_enable_if_possible (res_ptr);
 
   pthread_mutex_unlock (&res_ptr->res_mutex);
 
@@ -5170,603 +5632,1157 @@ lock_dump_deadlock_victims (THREAD_ENTRY * thread_p, FILE * outfile)
 
   xlock_dump (thread_p, outfile);
 }
-#endif /* SERVER_MODE */
-
-/*
- *  Private Functions Group: miscellaneous functions
- *
- *   - lk_lockinfo_compare()
- *   - lk_dump_res()
- *   - lk_consistent_res()
- *   - lk_consistent_tran_lock()
- */
 
-#if defined(SERVER_MODE)
 /*
- * lock_compare_lock_info -
- *
- * return:
- *
- *   lockinfo1(in):
- *   lockinfo2(in):
+ * lock_initialize_WFG - Reset the transaction wait-for graph before a deadlock detection run
  *
- * Note:compare two OID of lockable objects.
+ * return: nothing
  */
-static int
-lock_compare_lock_info (const void *lockinfo1, const void *lockinfo2)
+static void
+lock_initialize_WFG (void)
 {
-  const OID *oid1;
-  const OID *oid2;
-
-  oid1 = &(((LK_LOCKINFO *) (lockinfo1))->oid);
-  oid2 = &(((LK_LOCKINFO *) (lockinfo2))->oid);
+  int i;
 
-  return oid_compare (oid1, oid2);
-}
-#endif /* SERVER_MODE */
+  /* initialize transaction WFG node table.. The current transaction might be old deadlock victim. And, the transaction 
+   * may have not been aborted, until now. Even if the transaction(old deadlock victim) has not been aborted, set
+   * checked_by_deadlock_detector of the transaction to true. */
+  for (i = 1; i < lk_Gl.num_trans; i++)
+    {
+      lk_Gl.TWFG_node[i].first_edge = -1;
+      lk_Gl.TWFG_node[i].tran_edge_seq_num = 0;
+      lk_Gl.TWFG_node[i].checked_by_deadlock_detector = true;
+    }
 
-#if defined(SERVER_MODE)
-/*
- * lock_wait_msecs_to_secs -
- *
- * return: seconds
- *
- *   msecs(in): milliseconds
- */
-static float
-lock_wait_msecs_to_secs (int msecs)
-{
-  if (msecs > 0)
+  /* initialize transaction WFG edge table */
+  lk_Gl.TWFG_edge = &TWFG_edge_block[0];
+  lk_Gl.max_TWFG_edge = LK_MIN_TWFG_EDGE_COUNT;	/* initial value */
+  for (i = 0; i < LK_MIN_TWFG_EDGE_COUNT; i++)
     {
-      return (float) msecs / 1000;
+      lk_Gl.TWFG_edge[i].to_tran_index = -1;
+      lk_Gl.TWFG_edge[i].next = (i + 1);
     }
+  lk_Gl.TWFG_edge[lk_Gl.max_TWFG_edge - 1].next = -1;
+  lk_Gl.TWFG_free_edge_idx = 0;
 
-  return (float) msecs;
+  /* initialize global_edge_seq_num */
+  lk_Gl.global_edge_seq_num = 0;
+
+  /* initialize victim count */
+  victim_count = 0;		/* used as index of victims array */
 }
-#endif /* SERVER_MODE */
 
-#if defined(SERVER_MODE)
 /*
- * lock_dump_resource - Dump locks acquired on a resource
- *
- * return:
+ * lock_add_WFG_edges_of_resource - Add the wait-for edges among the holders and waiters of a resource
  *
- *   outfp(in): FILE stream where to dump the lock resource entry.
- *   res_ptr(in): pointer to lock resource entry
+ * return: nothing
  *
- * Note:Dump contents of the lock resource entry pointed by res_ptr.
+ *   res_ptr(in): lock resource; the caller holds its mutex
  */
 static void
-lock_dump_resource (THREAD_ENTRY * thread_p, FILE * outfp, LK_RES * res_ptr)
+lock_add_WFG_edges_of_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
 {
-#define TEMP_BUFFER_SIZE  128
-  LK_ENTRY *entry_ptr;
-  char *classname;		/* Name of the class */
-  int num_holders, num_blocked_holders, num_waiters;
-  char time_val[CTIME_MAX];
-  int time_str_len;
-  OID *oid_rr = NULL;
-  HEAP_SCANCACHE scan_cache;
-  OID real_class_oid;
-
-  memset (time_val, 0, sizeof (time_val));
-
-  /* dump object identifier */
-  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_OID), res_ptr->key.oid.volid,
-	   res_ptr->key.oid.pageid, res_ptr->key.oid.slotid);
+  LK_ENTRY *hi, *hj;
+  int compat1, compat2;
 
-  /* dump object type related information */
-  switch (res_ptr->key.type)
+  /* the caller holds the resource mutex */
+  if (res_ptr->holder == NULL)
     {
-    case LOCK_RESOURCE_ROOT_CLASS:
-      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_ROOT_CLASS_TYPE));
-      break;
-    case LOCK_RESOURCE_CLASS:
-      oid_rr = oid_get_rep_read_tran_oid ();
-      if (oid_rr != NULL && OID_EQ (&res_ptr->key.oid, oid_rr))
+      if (res_ptr->waiter == NULL)
 	{
-	  /* This is the generic object for RR transactions */
-	  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_RR_TYPE));
+	  return;
 	}
-      else if (!OID_ISTEMP (&res_ptr->key.oid))
+      else
 	{
-	  if (OID_IS_VIRTUAL_CLASS_OF_DIR_OID (&res_ptr->key.oid))
-	    {
-	      OID_GET_REAL_CLASS_OF_DIR_OID (&res_ptr->key.oid, &real_class_oid);
-	    }
-	  else
+#if defined(CUBRID_DEBUG)
+	  FILE *lk_fp;
+	  time_t cur_time;
+	  char time_val[CTIME_MAX];
+
+	  lk_fp = fopen ("lock_waiter_only_info.log", "a");
+	  if (lk_fp != NULL)
 	    {
-	      COPY_OID (&real_class_oid, &res_ptr->key.oid);
+	      cur_time = time (NULL);
+	      (void) ctime_r (&cur_time, time_val);
+	      fprintf (lk_fp, "##########################################\n");
+	      fprintf (lk_fp, "# current time: %s\n", time_val);
+	      lock_dump_resource (lk_fp, res_ptr);
+	      fprintf (lk_fp, "##########################################\n");
+	      fclose (lk_fp);
 	    }
-	  /* Don't get class names for temporary class objects. */
-	  if (heap_get_class_name (thread_p, &real_class_oid, &classname) != NO_ERROR || classname == NULL)
-	    {
-	      /* We must stop processing if an interrupt occurs */
-	      if (er_errid () == ER_INTERRUPTED)
-		{
-		  return;
-		}
+#endif /* CUBRID_DEBUG */
+	  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_LOCK_WAITER_ONLY, 1, "lock_waiter_only_info.log");
 
-	      /* Otherwise continue */
-	      er_clear ();
-	    }
-	  else
+	  if (res_ptr->total_holders_mode != NULL_LOCK)
 	    {
-	      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_CLASS_TYPE),
-		       classname);
-	      free_and_init (classname);
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_TOTAL_HOLDERS_MODE, 1, res_ptr->total_holders_mode);
+	      res_ptr->total_holders_mode = NULL_LOCK;
 	    }
+	  (void) lock_grant_blocked_waiter (thread_p, res_ptr);
 	}
-      break;
-    case LOCK_RESOURCE_INSTANCE:
-      if (!OID_ISTEMP (&res_ptr->key.class_oid))
-	{
-	  bool is_virtual_directory_oid;
+    }
 
-	  /* Don't get class names for temporary class objects. */
-	  if (OID_IS_VIRTUAL_CLASS_OF_DIR_OID (&res_ptr->key.class_oid))
-	    {
-	      is_virtual_directory_oid = true;
-	      OID_GET_REAL_CLASS_OF_DIR_OID (&res_ptr->key.class_oid, &real_class_oid);
-	    }
-	  else
-	    {
-	      is_virtual_directory_oid = false;
-	      COPY_OID (&real_class_oid, &res_ptr->key.class_oid);
-	    }
+  /* among holders */
+  for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
+    {
+      if (hi->blocked_mode == NULL_LOCK)
+	{
+	  break;
+	}
+      for (hj = hi->next; hj != NULL; hj = hj->next)
+	{
+	  assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
+	  assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
 
-	  if (heap_get_class_name (thread_p, &real_class_oid, &classname) != NO_ERROR || classname == NULL)
-	    {
-	      /* We must stop processing if an interrupt occurs */
-	      if (er_errid () == ER_INTERRUPTED)
-		{
-		  return;
-		}
+	  compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
+	  compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
+	  assert (compat1 != DB_NA && compat2 != DB_NA);
 
-	      /* Otherwise continue */
-	      er_clear ();
-	    }
-	  else
+	  if (compat1 == false || compat2 == false)
 	    {
-	      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_INSTANCE_TYPE),
-		       res_ptr->key.class_oid.volid, res_ptr->key.class_oid.pageid, res_ptr->key.class_oid.slotid,
-		       classname);
-	      free_and_init (classname);
+	      (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
 	    }
 
-	  /* Dump MVCC info */
-	  if (is_virtual_directory_oid == false && heap_scancache_quick_start (&scan_cache) == NO_ERROR)
-	    {
-	      RECDES recdes;
-
-	      recdes.data = NULL;
+	  compat1 = lock_Comp[hi->blocked_mode][hj->granted_mode];
+	  assert (compat1 != DB_NA);
 
-	      if (heap_get_visible_version (thread_p, &res_ptr->key.oid, &res_ptr->key.class_oid, &recdes, &scan_cache,
-					    PEEK, NULL_CHN) == S_SUCCESS)
-		{
-		  MVCC_REC_HEADER mvcc_rec_header;
-		  if (or_mvcc_get_header (&recdes, &mvcc_rec_header) == NO_ERROR)
-		    {
-		      char str_insid[128], str_delid[128];
-		      if (MVCC_IS_FLAG_SET (&mvcc_rec_header, OR_MVCC_FLAG_VALID_INSID))
-			{
-			  sprintf (str_insid, "%llu", (unsigned long long int) MVCC_GET_INSID (&mvcc_rec_header));
-			}
-		      else
-			{
-			  strcpy (str_insid, "missing");
-			}
-		      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_rec_header))
-			{
-			  sprintf (str_delid, "%llu", (unsigned long long int) MVCC_GET_DELID (&mvcc_rec_header));
-			}
-		      else
-			{
-			  strcpy (str_delid, "missing");
-			}
-		      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_MVCC_INFO),
-			       str_insid, str_delid);
-		    }
-		}
-	      heap_scancache_end (thread_p, &scan_cache);
+	  if (compat1 == false)
+	    {
+	      (void) lock_add_WFG_edge (hi->tran_index, hj->tran_index, true, hi->thrd_entry->lockwait_stime);
 	    }
 	}
-      break;
-    default:
-      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_UNKNOWN_TYPE));
     }
 
-  /* dump total modes of holders and waiters */
-  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_TOTAL_MODE),
-	   LOCK_TO_LOCKMODE_STRING (res_ptr->total_holders_mode),
-	   LOCK_TO_LOCKMODE_STRING (res_ptr->total_waiters_mode));
-
-  num_holders = num_blocked_holders = 0;
-  if (res_ptr->holder != NULL)
+  /* from waiters in the waiter to holders */
+  for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
     {
-      entry_ptr = res_ptr->holder;
-      while (entry_ptr != NULL)
+      for (hj = res_ptr->waiter; hj != NULL; hj = hj->next)
 	{
-	  if (entry_ptr->blocked_mode == NULL_LOCK)
-	    {
-	      num_holders++;
-	    }
-	  else
+	  assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
+	  assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
+
+	  compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
+	  compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
+	  assert (compat1 != DB_NA && compat2 != DB_NA);
+
+	  if (compat1 == false || compat2 == false)
 	    {
-	      num_blocked_holders++;
+	      (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
 	    }
-	  entry_ptr = entry_ptr->next;
 	}
     }
-  num_waiters = 0;
-  if (res_ptr->waiter != NULL)
+
+  /* from waiters in the waiter to other waiters in the waiter */
+  for (hi = res_ptr->waiter; hi != NULL; hi = hi->next)
     {
-      entry_ptr = res_ptr->waiter;
-      while (entry_ptr != NULL)
+      for (hj = hi->next; hj != NULL; hj = hj->next)
 	{
-	  num_waiters++;
-	  entry_ptr = entry_ptr->next;
+	  assert (hj->blocked_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
+
+	  compat1 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
+	  assert (compat1 != DB_NA);
+
+	  if (compat1 == false)
+	    {
+	      (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, false, hj->thrd_entry->lockwait_stime);
+	    }
 	}
     }
+}
 
-  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_LOCK_COUNT), num_holders,
-	   num_blocked_holders, num_waiters);
+/*
+ * lock_resolve_WFG_cycles - Find the cycles of the transaction wait-for graph and wake up their victims
+ *
+ * return: nothing
+ *
+ * Note:The graph has been built by lock_initialize_WFG and lock_add_WFG_edges_of_resource. The victims are selected
+ *     by lock_select_deadlock_victim; they are waken up and aborted (or timed out) by themselves.
+ */
+static void
+lock_resolve_WFG_cycles (THREAD_ENTRY * thread_p)
+{
+  int k, s, t;
+  LK_WFG_NODE *TWFG_node;
+  LK_WFG_EDGE *TWFG_edge;
+  int i;
+  int tran_index;
+  FILE *log_fp;
 
-  /* dump holders */
-  if (num_holders > 0)
+  /* simple notation for using in the following statements */
+  TWFG_node = lk_Gl.TWFG_node;
+  TWFG_edge = lk_Gl.TWFG_edge;
+
+  /* 
+   * deadlock detection and victim selection
+   */
+
+  for (k = 1; k < lk_Gl.num_trans; k++)
     {
-      /* dump non blocked holders */
-      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_NON_BLOCKED_HOLDER_HEAD));
-      entry_ptr = res_ptr->holder;
-      while (entry_ptr != NULL)
+      TWFG_node[k].current = TWFG_node[k].first_edge;
+      TWFG_node[k].ancestor = -1;
+    }
+  for (k = 1; k < lk_Gl.num_trans; k++)
+    {
+      if (TWFG_node[k].current == -1)
 	{
-	  if (entry_ptr->blocked_mode == NULL_LOCK)
+	  continue;
+	}
+      s = k;
+      TWFG_node[s].ancestor = -2;
+      for (; s != -2;)
+	{
+	  if (TWFG_node[s].checked_by_deadlock_detector == false || TWFG_node[s].thrd_wait_stime == 0
+	      || (TWFG_node[s].current != -1
+		  && (TWFG_node[s].thrd_wait_stime > TWFG_edge[TWFG_node[s].current].edge_wait_stime)))
 	    {
-	      if (res_ptr->key.type == LOCK_RESOURCE_INSTANCE)
+	      /* A new transaction started */
+	      TWFG_node[s].first_edge = -1;
+	      TWFG_node[s].current = -1;
+	    }
+
+	  if (TWFG_node[s].current == -1)
+	    {
+	      t = TWFG_node[s].ancestor;
+	      TWFG_node[s].ancestor = -1;
+	      s = t;
+	      if (s != -2 && TWFG_node[s].current != -1)
 		{
-		  fprintf (outfp,
-			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK,
-					   MSGCAT_LK_RES_NON_BLOCKED_HOLDER_ENTRY), "", entry_ptr->tran_index,
-			   LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode), entry_ptr->count);
+		  assert_release (TWFG_node[s].current >= 0 && TWFG_node[s].current < lk_Gl.max_TWFG_edge);
+		  TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
 		}
-	      else
+	      continue;
+	    }
+
+	  assert_release (TWFG_node[s].current >= 0 && TWFG_node[s].current < lk_Gl.max_TWFG_edge);
+
+	  t = TWFG_edge[TWFG_node[s].current].to_tran_index;
+
+	  if (t == -2)
+	    {			/* old WFG edge */
+	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
+	      continue;
+	    }
+
+	  if (TWFG_node[t].current == -1)
+	    {
+	      TWFG_edge[TWFG_node[s].current].to_tran_index = -2;
+	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
+	      continue;
+	    }
+
+	  if (TWFG_node[t].checked_by_deadlock_detector == false || TWFG_node[t].thrd_wait_stime == 0
+	      || TWFG_node[t].thrd_wait_stime > TWFG_edge[TWFG_node[t].current].edge_wait_stime)
+	    {
+	      TWFG_node[t].first_edge = -1;
+	      TWFG_node[t].current = -1;
+	      TWFG_edge[TWFG_node[s].current].to_tran_index = -2;
+	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
+	      continue;
+	    }
+
+	  if (TWFG_edge[TWFG_node[s].current].edge_seq_num < TWFG_node[t].tran_edge_seq_num)
+	    {			/* old WFG edge */
+	      TWFG_edge[TWFG_node[s].current].to_tran_index = -2;
+	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
+	      continue;
+	    }
+
+	  if (TWFG_node[t].ancestor != -1)
+	    {
+	      /* A deadlock cycle is found */
+	      lock_select_deadlock_victim (thread_p, s, t);
+	      if (victim_count >= LK_MAX_VICTIM_COUNT)
 		{
-		  fprintf (outfp,
-			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK,
-					   MSGCAT_LK_RES_NON_BLOCKED_HOLDER_ENTRY_WITH_GRANULE), "",
-			   entry_ptr->tran_index, LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode), entry_ptr->count,
-			   entry_ptr->ngranules);
+		  goto final;
 		}
 	    }
-	  entry_ptr = entry_ptr->next;
+	  else
+	    {
+	      TWFG_node[t].ancestor = s;
+	      TWFG_node[t].candidate = TWFG_edge[TWFG_node[s].current].holder_flag;
+	    }
+	  s = t;
 	}
     }
 
-  if (num_blocked_holders > 0)
+final:
+
+#if defined(ENABLE_SYSTEMTAP)
+  if (victim_count > 0)
     {
-      /* dump blocked holders */
-      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_HOLDER_HEAD));
-      entry_ptr = res_ptr->holder;
-      while (entry_ptr != NULL)
+      CUBRID_TRAN_DEADLOCK ();
+    }
+#endif /* ENABLE_SYSTEMTAP */
+
+#if defined(SERVER_MODE) && defined(DIAG_DEVEL)
+  if (victim_count > 0)
+    {
+      SET_DIAG_VALUE (diag_executediag, DIAG_OBJ_TYPE_LOCK_DEADLOCK, 1, DIAG_VAL_SETTYPE_INC, NULL);
+#if 0				/* ACTIVITY PROFILE */
+      ADD_ACTIVITY_DATA (diag_executediag, DIAG_EVENTCLASS_TYPE_SERVER_LOCK_DEADLOCK, "", "", victim_count);
+#endif
+    }
+#endif /* SERVER_MODE && DIAG_DEVEL */
+
+#if defined (ENABLE_UNUSED_FUNCTION)
+  if (victim_count > 0)
+    {
+      size_t size_loc;
+      char *ptr;
+      FILE *fp = port_open_memstream (&ptr, &size_loc);
+
+      if (fp)
 	{
-	  if (entry_ptr->blocked_mode != NULL_LOCK)
-	    {
-	      time_t stime = (time_t) (entry_ptr->thrd_entry->lockwait_stime / 1000LL);
-	      if (ctime_r (&stime, time_val) == NULL)
-		{
-		  strcpy (time_val, "???");
-		}
+	  lock_dump_deadlock_victims (thread_p, fp);
+	  port_close_memstream (fp, &ptr, &size_loc);
 
-	      time_str_len = strlen (time_val);
-	      if (time_str_len > 0 && time_val[time_str_len - 1] == '\n')
-		{
-		  time_val[time_str_len - 1] = 0;
-		}
-	      if (res_ptr->key.type == LOCK_RESOURCE_INSTANCE)
-		{
-		  fprintf (outfp,
-			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_HOLDER_ENTRY),
-			   "", entry_ptr->tran_index, LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode),
-			   entry_ptr->count, "", LOCK_TO_LOCKMODE_STRING (entry_ptr->blocked_mode), "", time_val, "",
-			   lock_wait_msecs_to_secs (entry_ptr->thrd_entry->lockwait_msecs));
-		}
-	      else
-		{
-		  fprintf (outfp,
-			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK,
-					   MSGCAT_LK_RES_BLOCKED_HOLDER_ENTRY_WITH_GRANULE), "", entry_ptr->tran_index,
-			   LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode), entry_ptr->count, entry_ptr->ngranules,
-			   "", LOCK_TO_LOCKMODE_STRING (entry_ptr->blocked_mode), "", time_val, "",
-			   lock_wait_msecs_to_secs (entry_ptr->thrd_entry->lockwait_msecs));
-		}
+	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LK_DEADLOCK_SPECIFIC_INFO, 1, ptr);
+
+	  if (ptr != NULL)
+	    {
+	      free (ptr);
 	    }
-	  entry_ptr = entry_ptr->next;
 	}
     }
+#endif /* ENABLE_UNUSED_FUNCTION */
 
-  /* dump blocked waiters */
-  if (res_ptr->waiter != NULL)
+  /* dump deadlock cycle to event log file */
+  for (k = 0; k < victim_count; k++)
     {
-      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_WAITER_HEAD));
-      entry_ptr = res_ptr->waiter;
-      while (entry_ptr != NULL)
+      if (victims[k].tran_index_in_cycle == NULL)
 	{
-	  time_t stime = (time_t) (entry_ptr->thrd_entry->lockwait_stime / 1000LL);
-	  (void) ctime_r (&stime, time_val);
+	  continue;
+	}
 
-	  time_str_len = strlen (time_val);
-	  if (time_str_len > 0 && time_val[time_str_len - 1] == '\n')
+      log_fp = event_log_start (thread_p, "DEADLOCK");
+      if (log_fp != NULL)
+	{
+	  for (i = 0; i < victims[k].num_trans_in_cycle; i++)
 	    {
-	      time_val[time_str_len - 1] = 0;
+	      tran_index = victims[k].tran_index_in_cycle[i];
+	      event_log_print_client_info (tran_index, 0);
+	      lock_event_log_tran_locks (thread_p, log_fp, tran_index);
 	    }
-	  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_WAITER_ENTRY),
-		   "", entry_ptr->tran_index, LOCK_TO_LOCKMODE_STRING (entry_ptr->blocked_mode), "", time_val, "",
-		   lock_wait_msecs_to_secs (entry_ptr->thrd_entry->lockwait_msecs));
-	  entry_ptr = entry_ptr->next;
+
+	  event_log_end (thread_p);
 	}
+
+      free_and_init (victims[k].tran_index_in_cycle);
     }
 
-  /* dump non two phase locks */
-  if (res_ptr->non2pl != NULL)
+  /* Now solve the deadlocks (cycles) by executing the cycle resolution function (e.g., aborting victim) */
+  for (k = 0; k < victim_count; k++)
     {
-      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_NON2PL_RELEASED_HEAD));
-      entry_ptr = res_ptr->non2pl;
-      while (entry_ptr != NULL)
+      if (victims[k].can_timeout)
 	{
-	  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_NON2PL_RELEASED_ENTRY),
-		   "", entry_ptr->tran_index,
-		   ((entry_ptr->granted_mode == INCON_NON_TWO_PHASE_LOCK) ? "INCON_NON_TWO_PHASE_LOCK"
-		    : LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode)));
-	  entry_ptr = entry_ptr->next;
+	  (void) lock_wakeup_deadlock_victim_timeout (victims[k].tran_index);
+	}
+      else
+	{
+	  (void) lock_wakeup_deadlock_victim_aborted (victims[k].tran_index);
 	}
     }
-  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_NEWLINE));
 
+  /* deallocate memory space used for deadlock detection */
+  if (lk_Gl.max_TWFG_edge > LK_MID_TWFG_EDGE_COUNT)
+    {
+      free_and_init (lk_Gl.TWFG_edge);
+    }
 }
-#endif /* SERVER_MODE */
 
-#if defined(ENABLE_UNUSED_FUNCTION)
-#if defined(SERVER_MODE)
 /*
- * lock_check_consistent_resource - Check if the lock resource entry is consistent
- *
- * return: true/false
+ * lock_add_deadlock_search_next - Add a transaction to those the incremental deadlock search follows next
  *
- *   res_ptr(in):
+ * return: nothing
  *
- * Note:Verify if a lock entry is consistent. At least one waiter must be
- *     waiting on at least one transaction holding a lock, otherwise,
- *     an inconsistent entry exist. Some waiters may be waiting on waiters.
+ *   search(in/out): incremental deadlock search state
+ *   next_tran_index(in/out): transactions waited for by the current one
+ *   num_next(in/out): number of transactions in next_tran_index
+ *   tran_index(in): transaction waited for
  */
-static bool
-lock_check_consistent_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
+static void
+lock_add_deadlock_search_next (LK_DEADLOCK_SEARCH * search, int *next_tran_index, int *num_next, int tran_index)
 {
-  LOCK total_mode;
-  LK_ENTRY *i, *j;
-  const char *msg_str;
-  int rv;
-
-  /* hold resource mutex */
-  rv = pthread_mutex_lock (&res_ptr->res_mutex);
+  int i;
 
-  /* check total_holders_mode (total mode of lock holders) */
-  total_mode = NULL_LOCK;
-  for (i = res_ptr->holder; i != NULL; i = i->next)
+  for (i = 0; i < *num_next; i++)
     {
-      assert (i->granted_mode >= NULL_LOCK && total_mode >= NULL_LOCK);
-      total_mode = lock_Conv[i->granted_mode][total_mode];
-      assert (total_mode != NA_LOCK);
+      if (next_tran_index[i] == tran_index)
+	{
+	  return;
+	}
+    }
+  if (*num_next >= LK_DEADLOCK_SEARCH_MAX_FANOUT)
+    {
+      search->is_truncated = true;
+      return;
+    }
+  next_tran_index[(*num_next)++] = tran_index;
+}
 
-      assert (i->blocked_mode >= NULL_LOCK && total_mode >= NULL_LOCK);
-      total_mode = lock_Conv[i->blocked_mode][total_mode];
-      assert (total_mode != NA_LOCK);
+/*
+ * lock_search_deadlock_cycle - Search a wait-for cycle back to the origin of the search
+ *
+ * return: true if a cycle was found; its resources are the first path_length ones of search->path
+ *
+ *   search(in/out): incremental deadlock search state
+ *   tran_index(in): transaction on the current path
+ *   depth(in): position of tran_index on the path
+ *
+ * Note:Only one resource mutex is held at a time, so the search cannot deadlock with lock requests. The edges
+ *     followed are a superset of those lock_add_WFG_edges_of_resource adds between waiting transactions, so a found
+ *     cycle is only a suspect until the wait-for graph of its resources confirms it. Transactions are not followed
+ *     twice, and when a bound is hit the search is marked truncated so that a full scan covers it.
+ */
+static bool
+lock_search_deadlock_cycle (THREAD_ENTRY * thread_p, LK_DEADLOCK_SEARCH * search, int tran_index, int depth)
+{
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_RES);
+  LOG_TDES *tdes;
+  LK_RES *wait_res_ptr, *res_ptr = NULL;
+  LK_RES_KEY search_key;
+  LK_ENTRY *wait_entry, *entry_ptr, *waiter_ptr;
+  int next_tran_index[LK_DEADLOCK_SEARCH_MAX_FANOUT];
+  int num_next = 0;
+  bool is_wait_holder = false;
+  bool is_waiting_for_waiters = false;
+  bool is_wait_entry_seen = false;
+  bool is_edge;
+  int i, j;
+
+  tdes = LOG_FIND_TDES (tran_index);
+  if (tdes == NULL)
+    {
+      return false;
     }
-  if (total_mode != res_ptr->total_holders_mode)
+  wait_res_ptr = tdes->waiting_for_res;
+  if (wait_res_ptr == NULL)
     {
-      msg_str = "lk_consistent_res: total mode of holders is inconsistent.";
-      goto inconsistent;
+      /* not waiting; no cycle goes through this transaction */
+      return false;
     }
 
-  /* check total_waiters_mode (total mode of lock waiters) */
-  total_mode = NULL_LOCK;
-  for (i = res_ptr->waiter; i != NULL; i = i->next)
+  /* the resource may be freed meanwhile; look it up again by key and make sure it is still the one waited for */
+  search_key = wait_res_ptr->key;
+  if (lf_hash_find (t_entry, &lk_Gl.obj_hash_table, (void *) &search_key, (void **) &res_ptr) != NO_ERROR
+      || res_ptr == NULL)
     {
-      assert (i->blocked_mode >= NULL_LOCK && total_mode >= NULL_LOCK);
-      total_mode = lock_Conv[i->blocked_mode][total_mode];
-      assert (total_mode != NA_LOCK);
+      return false;
     }
-  if (total_mode != res_ptr->total_waiters_mode)
+  if (res_ptr != wait_res_ptr)
     {
-      msg_str = "lk_consistent_res: total mode of waiters is incons.";
-      goto inconsistent;
+      pthread_mutex_unlock (&res_ptr->res_mutex);
+      return false;
     }
+  search->num_steps++;
 
-  /* check holders : lock information */
-  for (i = res_ptr->holder; i != NULL; i = i->next)
+  /* find the blocked entry of the transaction; blocked holders are at the head of the holder list */
+  wait_entry = NULL;
+  for (entry_ptr = res_ptr->holder; entry_ptr != NULL && entry_ptr->blocked_mode != NULL_LOCK;
+       entry_ptr = entry_ptr->next)
     {
-      /* check res_head */
-      if (i->res_head != res_ptr)
-	{
-	  msg_str = "lk_consistent_res: res_head of a holder is incons.";
-	  goto inconsistent;
-	}
-      /* check tran_index */
-      for (j = res_ptr->holder; j != NULL && j != i; j = j->next)
-	{
-	  if (j->tran_index == i->tran_index)
-	    {
-	      msg_str = "lk_consistent_res: tran_index of a holder is incons. (1)";
-	      goto inconsistent;
-	    }
-	}
-      for (j = res_ptr->waiter; j != NULL; j = j->next)
+      if (entry_ptr->tran_index == tran_index)
 	{
-	  if (j->tran_index == i->tran_index)
-	    {
-	      msg_str = "lk_consistent_res: tran_index of a holder is incons. (2)";
-	      goto inconsistent;
-	    }
+	  wait_entry = entry_ptr;
+	  is_wait_holder = true;
+	  break;
 	}
-      for (j = res_ptr->non2pl; j != NULL; j = j->next)
+    }
+  for (entry_ptr = res_ptr->waiter; wait_entry == NULL && entry_ptr != NULL; entry_ptr = entry_ptr->next)
+    {
+      if (entry_ptr->tran_index == tran_index)
 	{
-	  if (j->tran_index == i->tran_index)
-	    {
-	      msg_str = "lk_consistent_res: tran_index of a holder is incons. (3)";
-	      goto inconsistent;
-	    }
+	  wait_entry = entry_ptr;
 	}
-      /* check thrd_entry */
-      if (i->blocked_mode != NULL_LOCK)
+    }
+  if (wait_entry == NULL)
+    {
+      pthread_mutex_unlock (&res_ptr->res_mutex);
+      return false;
+    }
+
+  /* waiters only wait for this resource, so a cycle leaves it through a holder which is itself waiting somewhere.
+   * Waiting for an earlier waiter means waiting for the holders that waiter waits for. */
+  if (!is_wait_holder)
+    {
+      for (entry_ptr = res_ptr->waiter; entry_ptr != wait_entry; entry_ptr = entry_ptr->next)
 	{
-	  if (i->thrd_entry == NULL)
+	  if (!lock_Comp[wait_entry->blocked_mode][entry_ptr->blocked_mode])
 	    {
-	      msg_str = "lk_consistent_res: thrd_entry of a blocked holder is incons.";
-	      goto inconsistent;
+	      is_waiting_for_waiters = true;
+	      break;
 	    }
 	}
     }
 
-  /* check lock waiters */
-  for (i = res_ptr->waiter; i != NULL; i = i->next)
+  for (entry_ptr = res_ptr->holder; entry_ptr != NULL; entry_ptr = entry_ptr->next)
     {
-      /* check res_head */
-      if (i->res_head != res_ptr)
-	{
-	  msg_str = "lk_consistent_res: res_head of a waiter is incons.";
-	  goto inconsistent;
-	}
-      /* check tran_index */
-      for (j = res_ptr->holder; j != NULL; j = j->next)
+      if (entry_ptr == wait_entry)
 	{
-	  if (j->tran_index == i->tran_index)
-	    {
-	      msg_str = "lk_consistent_res: tran_index of a waiter is incons. (1)";
-	      goto inconsistent;
-	    }
+	  is_wait_entry_seen = true;
+	  continue;
 	}
-      for (j = res_ptr->waiter; j != NULL && j != i; j = j->next)
+      if (entry_ptr->blocked_mode == NULL_LOCK)
 	{
-	  if (j->tran_index == i->tran_index)
+	  tdes = LOG_FIND_TDES (entry_ptr->tran_index);
+	  if (tdes == NULL || tdes->waiting_for_res == NULL)
 	    {
-	      msg_str = "lk_consistent_res: tran_index of a waiter is incons. (2)";
-	      goto inconsistent;
+	      /* not waiting; it cannot be part of a cycle now */
+	      continue;
 	    }
 	}
-      for (j = res_ptr->non2pl; j != NULL; j = j->next)
+
+      /* a waiter, or a blocked holder behind, also waits for the blocked modes of the holders */
+      is_edge = (!lock_Comp[wait_entry->blocked_mode][entry_ptr->granted_mode]
+		 || (!is_wait_entry_seen && !lock_Comp[wait_entry->blocked_mode][entry_ptr->blocked_mode]));
+      for (waiter_ptr = res_ptr->waiter; !is_edge && is_waiting_for_waiters && waiter_ptr != wait_entry;
+	   waiter_ptr = waiter_ptr->next)
 	{
-	  if (j->tran_index == i->tran_index)
-	    {
-	      msg_str = "lk_consistent_res: tran_index of a waiter is incons. (3)";
-	      goto inconsistent;
-	    }
+	  is_edge = (!lock_Comp[waiter_ptr->blocked_mode][entry_ptr->granted_mode]
+		     || !lock_Comp[waiter_ptr->blocked_mode][entry_ptr->blocked_mode]);
 	}
-      /* check lock mode */
-      if (i->blocked_mode == NULL_LOCK)
+      if (is_edge)
 	{
-	  msg_str = "lk_consistent_res: blocked_mode of a waiter is incons.";
-	  goto inconsistent;
+	  lock_add_deadlock_search_next (search, next_tran_index, &num_next, entry_ptr->tran_index);
 	}
-      /* check thrd_entry */
-      if (i->thrd_entry == NULL)
+    }
+  search->path[depth] = res_ptr->key;
+  pthread_mutex_unlock (&res_ptr->res_mutex);
+
+  for (i = 0; i < num_next; i++)
+    {
+      if (next_tran_index[i] == search->origin_tran_index)
 	{
-	  msg_str = "lk_consistent_res: thrd_entry of a waiter is incons.";
-	  goto inconsistent;
+	  search->path_length = depth + 1;
+	  return true;
 	}
     }
 
-  /* check non2pl locks */
-  for (i = res_ptr->non2pl; i != NULL; i = i->next)
+  for (i = 0; i < num_next; i++)
     {
-      /* check tran_index */
-      for (j = res_ptr->holder; j != NULL; j = j->next)
+      for (j = 0; j < search->num_visited; j++)
 	{
-	  if (j->tran_index == i->tran_index)
+	  if (search->visited_tran_index[j] == next_tran_index[i])
 	    {
-	      msg_str = "lk_consistent_res: tran_index of a non2pl is incons. (1)";
-	      goto inconsistent;
+	      break;
 	    }
 	}
-      for (j = res_ptr->waiter; j != NULL; j = j->next)
+      if (j < search->num_visited)
 	{
-	  if (j->tran_index == i->tran_index)
-	    {
-	      msg_str = "lk_consistent_res: tran_index of a non2pl is incons. (2)";
-	      goto inconsistent;
-	    }
+	  /* already followed; a cycle not going through the origin is found from its own members */
+	  continue;
 	}
-      for (j = res_ptr->non2pl; j != NULL && j != i; j = j->next)
+      if (depth + 1 >= LK_DEADLOCK_SEARCH_MAX_DEPTH || search->num_steps >= LK_DEADLOCK_SEARCH_MAX_STEPS
+	  || search->num_visited >= LK_DEADLOCK_SEARCH_MAX_STEPS)
 	{
-	  if (j->tran_index == i->tran_index)
-	    {
-	      msg_str = "lk_consistent_res: tran_index of a non2pl is incons. (3)";
-	      goto inconsistent;
-	    }
+	  search->is_truncated = true;
+	  return false;
+	}
+      search->visited_tran_index[search->num_visited++] = next_tran_index[i];
+      if (lock_search_deadlock_cycle (thread_p, search, next_tran_index[i], depth + 1))
+	{
+	  return true;
 	}
     }
 
-  /* consistent */
-  pthread_mutex_unlock (&res_ptr->res_mutex);
-  return true;
-
-inconsistent:
-  lock_dump_resource (thread_p, stdout, res_ptr);
-  pthread_mutex_unlock (&res_ptr->res_mutex);
-  er_log_debug (ARG_FILE_LINE, msg_str);
   return false;
 }
 #endif /* SERVER_MODE */
 
+/*
+ *  Private Functions Group: miscellaneous functions
+ *
+ *   - lk_lockinfo_compare()
+ *   - lk_dump_res()
+ *   - lk_consistent_res()
+ *   - lk_consistent_tran_lock()
+ */
+
 #if defined(SERVER_MODE)
 /*
- * lock_check_consistent_tran_lock - Check consistency of transaction lock info entry
+ * lock_compare_lock_info -
  *
- * return: true/false
+ * return:
  *
- *   tran_lock(in): ponter to the transaction lock information entry
+ *   lockinfo1(in):
+ *   lockinfo2(in):
  *
- * Note:check if the given transaction lock information enrtry is consistent.
+ * Note:compare two OID of lockable objects.
  */
-static bool
-lock_check_consistent_tran_lock (LK_TRAN_LOCK * tran_lock)
+static int
+lock_compare_lock_info (const void *lockinfo1, const void *lockinfo2)
 {
-  int count;
-  LK_ENTRY *i;
-  int rv;
+  const OID *oid1;
+  const OID *oid2;
 
-  /* hold transaction hold mutex */
-  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  oid1 = &(((LK_LOCKINFO *) (lockinfo1))->oid);
+  oid2 = &(((LK_LOCKINFO *) (lockinfo2))->oid);
 
-  /* check held locks */
-  /* check inst_hold_count and class_hold_count */
-  for (count = 0, i = tran_lock->inst_hold_list; i != NULL; i = i->tran_next)
-    {
-      count++;
-    }
-  if (count != tran_lock->inst_hold_count)
-    {
-      pthread_mutex_unlock (&tran_lock->hold_mutex);
-      er_log_debug (ARG_FILE_LINE, "lk_consistent_tran_lock: inst_hold_count incorrect.");
-      return false;
-    }
-  for (count = 0, i = tran_lock->class_hold_list; i != NULL; i = i->tran_next)
-    {
-      count++;
-    }
-  if (count != tran_lock->class_hold_count)
+  return oid_compare (oid1, oid2);
+}
+#endif /* SERVER_MODE */
+
+#if defined(SERVER_MODE)
+/*
+ * lock_wait_msecs_to_secs -
+ *
+ * return: seconds
+ *
+ *   msecs(in): milliseconds
+ */
+static float
+lock_wait_msecs_to_secs (int msecs)
+{
+  if (msecs > 0)
     {
-      pthread_mutex_unlock (&tran_lock->hold_mutex);
-      er_log_debug (ARG_FILE_LINE, "lk_consistent_tran_lock: class_hold_count incorrect.");
-      return false;
+      return (float) msecs / 1000;
     }
 
-  /* release transaction hold mutex */
-  pthread_mutex_unlock (&tran_lock->hold_mutex);
-
-  /* hold transaction non2pl mutex */
-  rv = pthread_mutex_lock (&tran_lock->non2pl_mutex);
+  return (float) msecs;
+}
+#endif /* SERVER_MODE */
 
-  /* check non2pl locks */
-  /* check num_incons_non2pl */
+#if defined(SERVER_MODE)
+/*
+ * lock_dump_resource - Dump locks acquired on a resource
+ *
+ * return:
+ *
+ *   outfp(in): FILE stream where to dump the lock resource entry.
+ *   res_ptr(in): pointer to lock resource entry
+ *
+ * Note:Dump contents of the lock resource entry pointed by res_ptr.
+ */
+static void
+lock_dump_resource (THREAD_ENTRY * thread_p, FILE * outfp, LK_RES * res_ptr)
+{
+#define TEMP_BUFFER_SIZE  128
+  LK_ENTRY *entry_ptr;
+  char *classname;		/* Name of the class */
+  int num_holders, num_blocked_holders, num_waiters;
+  char time_val[CTIME_MAX];
+  int time_str_len;
+  OID *oid_rr = NULL;
+  HEAP_SCANCACHE scan_cache;
+  OID real_class_oid;
+
+  memset (time_val, 0, sizeof (time_val));
+
+  /* dump object identifier */
+  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_OID), res_ptr->key.oid.volid,
+	   res_ptr->key.oid.pageid, res_ptr->key.oid.slotid);
+
+  /* dump object type related information */
+  switch (res_ptr->key.type)
+    {
+    case LOCK_RESOURCE_ROOT_CLASS:
+      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_ROOT_CLASS_TYPE));
+      break;
+    case LOCK_RESOURCE_CLASS:
+      oid_rr = oid_get_rep_read_tran_oid ();
+      if (oid_rr != NULL && OID_EQ (&res_ptr->key.oid, oid_rr))
+	{
+	  /* This is the generic object for RR transactions */
+	  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_RR_TYPE));
+	}
+      else if (!OID_ISTEMP (&res_ptr->key.oid))
+	{
+	  if (OID_IS_VIRTUAL_CLASS_OF_DIR_OID (&res_ptr->key.oid))
+	    {
+	      OID_GET_REAL_CLASS_OF_DIR_OID (&res_ptr->key.oid, &real_class_oid);
+	    }
+	  else
+	    {
+	      COPY_OID (&real_class_oid, &res_ptr->key.oid);
+	    }
+	  /* Don't get class names for temporary class objects. */
+	  if (heap_get_class_name (thread_p, &real_class_oid, &classname) != NO_ERROR || classname == NULL)
+	    {
+	      /* We must stop processing if an interrupt occurs */
+	      if (er_errid () == ER_INTERRUPTED)
+		{
+		  return;
+		}
+
+	      /* Otherwise continue */
+	      er_clear ();
+	    }
+	  else
+	    {
+	      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_CLASS_TYPE),
+		       classname);
+	      free_and_init (classname);
+	    }
+	}
+      break;
+    case LOCK_RESOURCE_INSTANCE:
+      if (!OID_ISTEMP (&res_ptr->key.class_oid))
+	{
+	  bool is_virtual_directory_oid;
+
+	  /* Don't get class names for temporary class objects. */
+	  if (OID_IS_VIRTUAL_CLASS_OF_DIR_OID (&res_ptr->key.class_oid))
+	    {
+	      is_virtual_directory_oid = true;
+	      OID_GET_REAL_CLASS_OF_DIR_OID (&res_ptr->key.class_oid, &real_class_oid);
+	    }
+	  else
+	    {
+	      is_virtual_directory_oid = false;
+	      COPY_OID (&real_class_oid, &res_ptr->key.class_oid);
+	    }
+
+	  if (heap_get_class_name (thread_p, &real_class_oid, &classname) != NO_ERROR || classname == NULL)
+	    {
+	      /* We must stop processing if an interrupt occurs */
+	      if (er_errid () == ER_INTERRUPTED)
+		{
+		  return;
+		}
+
+	      /* Otherwise continue */
+	      er_clear ();
+	    }
+	  else
+	    {
+	      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_INSTANCE_TYPE),
+		       res_ptr->key.class_oid.volid, res_ptr->key.class_oid.pageid, res_ptr->key.class_oid.slotid,
+		       classname);
+	      free_and_init (classname);
+	    }
+
+	  /* Dump MVCC info */
+	  if (is_virtual_directory_oid == false && heap_scancache_quick_start (&scan_cache) == NO_ERROR)
+	    {
+	      RECDES recdes;
+
+	      recdes.data = NULL;
+
+	      if (heap_get_visible_version (thread_p, &res_ptr->key.oid, &res_ptr->key.class_oid, &recdes, &scan_cache,
+					    PEEK, NULL_CHN) == S_SUCCESS)
+		{
+		  MVCC_REC_HEADER mvcc_rec_header;
+		  if (or_mvcc_get_header (&recdes, &mvcc_rec_header) == NO_ERROR)
+		    {
+		      char str_insid[128], str_delid[128];
+		      if (MVCC_IS_FLAG_SET (&mvcc_rec_header, OR_MVCC_FLAG_VALID_INSID))
+			{
+			  sprintf (str_insid, "%llu", (unsigned long long int) MVCC_GET_INSID (&mvcc_rec_header));
+			}
+		      else
+			{
+			  strcpy (str_insid, "missing");
+			}
+		      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_rec_header))
+			{
+			  sprintf (str_delid, "%llu", (unsigned long long int) MVCC_GET_DELID (&mvcc_rec_header));
+			}
+		      else
+			{
+			  strcpy (str_delid, "missing");
+			}
+		      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_MVCC_INFO),
+			       str_insid, str_delid);
+		    }
+		}
+	      heap_scancache_end (thread_p, &scan_cache);
+	    }
+	}
+      break;
+    default:
+      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_UNKNOWN_TYPE));
+    }
+
+  /* dump total modes of holders and waiters */
+  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_TOTAL_MODE),
+	   LOCK_TO_LOCKMODE_STRING (res_ptr->total_holders_mode),
+	   LOCK_TO_LOCKMODE_STRING (res_ptr->total_waiters_mode));
+
+  num_holders = num_blocked_holders = 0;
+  if (res_ptr->holder != NULL)
+    {
+      entry_ptr = res_ptr->holder;
+      while (entry_ptr != NULL)
+	{
+	  if (entry_ptr->blocked_mode == NULL_LOCK)
+	    {
+	      num_holders++;
+	    }
+	  else
+	    {
+	      num_blocked_holders++;
+	    }
+	  entry_ptr = entry_ptr->next;
+	}
+    }
+  num_waiters = 0;
+  if (res_ptr->waiter != NULL)
+    {
+      entry_ptr = res_ptr->waiter;
+      while (entry_ptr != NULL)
+	{
+	  num_waiters++;
+	  entry_ptr = entry_ptr->next;
+	}
+    }
+
+  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_LOCK_COUNT), num_holders,
+	   num_blocked_holders, num_waiters);
+
+  /* dump holders */
+  if (num_holders > 0)
+    {
+      /* dump non blocked holders */
+      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_NON_BLOCKED_HOLDER_HEAD));
+      entry_ptr = res_ptr->holder;
+      while (entry_ptr != NULL)
+	{
+	  if (entry_ptr->blocked_mode == NULL_LOCK)
+	    {
+	      if (res_ptr->key.type == LOCK_RESOURCE_INSTANCE)
+		{
+		  fprintf (outfp,
+			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK,
+					   MSGCAT_LK_RES_NON_BLOCKED_HOLDER_ENTRY), "", entry_ptr->tran_index,
+			   LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode), entry_ptr->count);
+		}
+	      else
+		{
+		  fprintf (outfp,
+			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK,
+					   MSGCAT_LK_RES_NON_BLOCKED_HOLDER_ENTRY_WITH_GRANULE), "",
+			   entry_ptr->tran_index, LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode), entry_ptr->count,
+			   entry_ptr->ngranules);
+		}
+	    }
+	  entry_ptr = entry_ptr->next;
+	}
+    }
+
+  if (num_blocked_holders > 0)
+    {
+      /* dump blocked holders */
+      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_HOLDER_HEAD));
+      entry_ptr = res_ptr->holder;
+      while (entry_ptr != NULL)
+	{
+	  if (entry_ptr->blocked_mode != NULL_LOCK)
+	    {
+	      time_t stime = (time_t) (entry_ptr->thrd_entry->lockwait_stime / 1000LL);
+	      if (ctime_r (&stime, time_val) == NULL)
+		{
+		  strcpy (time_val, "???");
+		}
+
+	      time_str_len = strlen (time_val);
+	      if (time_str_len > 0 && time_val[time_str_len - 1] == '\n')
+		{
+		  time_val[time_str_len - 1] = 0;
+		}
+	      if (res_ptr->key.type == LOCK_RESOURCE_INSTANCE)
+		{
+		  fprintf (outfp,
+			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_HOLDER_ENTRY),
+			   "", entry_ptr->tran_index, LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode),
+			   entry_ptr->count, "", LOCK_TO_LOCKMODE_STRING (entry_ptr->blocked_mode), "", time_val, "",
+			   lock_wait_msecs_to_secs (entry_ptr->thrd_entry->lockwait_msecs));
+		}
+	      else
+		{
+		  fprintf (outfp,
+			   msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK,
+					   MSGCAT_LK_RES_BLOCKED_HOLDER_ENTRY_WITH_GRANULE), "", entry_ptr->tran_index,
+			   LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode), entry_ptr->count, entry_ptr->ngranules,
+			   "", LOCK_TO_LOCKMODE_STRING (entry_ptr->blocked_mode), "", time_val, "",
+			   lock_wait_msecs_to_secs (entry_ptr->thrd_entry->lockwait_msecs));
+		}
+	    }
+	  entry_ptr = entry_ptr->next;
+	}
+    }
+
+  /* dump blocked waiters */
+  if (res_ptr->waiter != NULL)
+    {
+      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_WAITER_HEAD));
+      entry_ptr = res_ptr->waiter;
+      while (entry_ptr != NULL)
+	{
+	  time_t stime = (time_t) (entry_ptr->thrd_entry->lockwait_stime / 1000LL);
+	  (void) ctime_r (&stime, time_val);
+
+	  time_str_len = strlen (time_val);
+	  if (time_str_len > 0 && time_val[time_str_len - 1] == '\n')
+	    {
+	      time_val[time_str_len - 1] = 0;
+	    }
+	  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_BLOCKED_WAITER_ENTRY),
+		   "", entry_ptr->tran_index, LOCK_TO_LOCKMODE_STRING (entry_ptr->blocked_mode), "", time_val, "",
+		   lock_wait_msecs_to_secs (entry_ptr->thrd_entry->lockwait_msecs));
+	  entry_ptr = entry_ptr->next;
+	}
+    }
+
+  /* dump non two phase locks */
+  if (res_ptr->non2pl != NULL)
+    {
+      fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_NON2PL_RELEASED_HEAD));
+      entry_ptr = res_ptr->non2pl;
+      while (entry_ptr != NULL)
+	{
+	  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_RES_NON2PL_RELEASED_ENTRY),
+		   "", entry_ptr->tran_index,
+		   ((entry_ptr->granted_mode == INCON_NON_TWO_PHASE_LOCK) ? "INCON_NON_TWO_PHASE_LOCK"
+		    : LOCK_TO_LOCKMODE_STRING (entry_ptr->granted_mode)));
+	  entry_ptr = entry_ptr->next;
+	}
+    }
+  fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_NEWLINE));
+
+}
+#endif /* SERVER_MODE */
+
+#if defined(ENABLE_UNUSED_FUNCTION)
+#if defined(SERVER_MODE)
+/*
+ * lock_check_consistent_resource - Check if the lock resource entry is consistent
+ *
+ * return: true/false
+ *
+ *   res_ptr(in):
+ *
+ * Note:Verify if a lock entry is consistent. At least one waiter must be
+ *     waiting on at least one transaction holding a lock, otherwise,
+ *     an inconsistent entry exist. Some waiters may be waiting on waiters.
+ */
+static bool
+lock_check_consistent_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
+{
+  LOCK total_mode;
+  LK_ENTRY *i, *j;
+  const char *msg_str;
+  int rv;
+
+  /* hold resource mutex */
+  rv = pthread_mutex_lock (&res_ptr->res_mutex);
+
+  /* check total_holders_mode (total mode of lock holders) */
+  total_mode = NULL_LOCK;
+  for (i = res_ptr->holder; i != NULL; i = i->next)
+    {
+      assert (i->granted_mode >= NULL_LOCK && total_mode >= NULL_LOCK);
+      total_mode = lock_Conv[i->granted_mode][total_mode];
+      assert (total_mode != NA_LOCK);
+
+      assert (i->blocked_mode >= NULL_LOCK && total_mode >= NULL_LOCK);
+      total_mode = lock_Conv[i->blocked_mode][total_mode];
+      assert (total_mode != NA_LOCK);
+    }
+  if (total_mode != res_ptr->total_holders_mode)
+    {
+      msg_str = "lk_consistent_res: total mode of holders is inconsistent.";
+      goto inconsistent;
+    }
+
+  /* check total_waiters_mode (total mode of lock waiters) */
+  total_mode = NULL_LOCK;
+  for (i = res_ptr->waiter; i != NULL; i = i->next)
+    {
+      assert (i->blocked_mode >= NULL_LOCK && total_mode >= NULL_LOCK);
+      total_mode = lock_Conv[i->blocked_mode][total_mode];
+      assert (total_mode != NA_LOCK);
+    }
+  if (total_mode != res_ptr->total_waiters_mode)
+    {
+      msg_str = "lk_consistent_res: total mode of waiters is incons.";
+      goto inconsistent;
+    }
+
+  /* check holders : lock information */
+  for (i = res_ptr->holder; i != NULL; i = i->next)
+    {
+      /* check res_head */
+      if (i->res_head != res_ptr)
+	{
+	  msg_str = "lk_consistent_res: res_head of a holder is incons.";
+	  goto inconsistent;
+	}
+      /* check tran_index */
+      for (j = res_ptr->holder; j != NULL && j != i; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a holder is incons. (1)";
+	      goto inconsistent;
+	    }
+	}
+      for (j = res_ptr->waiter; j != NULL; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a holder is incons. (2)";
+	      goto inconsistent;
+	    }
+	}
+      for (j = res_ptr->non2pl; j != NULL; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a holder is incons. (3)";
+	      goto inconsistent;
+	    }
+	}
+      /* check thrd_entry */
+      if (i->blocked_mode != NULL_LOCK)
+	{
+	  if (i->thrd_entry == NULL)
+	    {
+	      msg_str = "lk_consistent_res: thrd_entry of a blocked holder is incons.";
+	      goto inconsistent;
+	    }
+	}
+    }
+
+  /* check lock waiters */
+  for (i = res_ptr->waiter; i != NULL; i = i->next)
+    {
+      /* check res_head */
+      if (i->res_head != res_ptr)
+	{
+	  msg_str = "lk_consistent_res: res_head of a waiter is incons.";
+	  goto inconsistent;
+	}
+      /* check tran_index */
+      for (j = res_ptr->holder; j != NULL; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a waiter is incons. (1)";
+	      goto inconsistent;
+	    }
+	}
+      for (j = res_ptr->waiter; j != NULL && j != i; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a waiter is incons. (2)";
+	      goto inconsistent;
+	    }
+	}
+      for (j = res_ptr->non2pl; j != NULL; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a waiter is incons. (3)";
+	      goto inconsistent;
+	    }
+	}
+      /* check lock mode */
+      if (i->blocked_mode == NULL_LOCK)
+	{
+	  msg_str = "lk_consistent_res: blocked_mode of a waiter is incons.";
+	  goto inconsistent;
+	}
+      /* check thrd_entry */
+      if (i->thrd_entry == NULL)
+	{
+	  msg_str = "lk_consistent_res: thrd_entry of a waiter is incons.";
+	  goto inconsistent;
+	}
+    }
+
+  /* check non2pl locks */
+  for (i = res_ptr->non2pl; i != NULL; i = i->next)
+    {
+      /* check tran_index */
+      for (j = res_ptr->holder; j != NULL; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a non2pl is incons. (1)";
+	      goto inconsistent;
+	    }
+	}
+      for (j = res_ptr->waiter; j != NULL; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a non2pl is incons. (2)";
+	      goto inconsistent;
+	    }
+	}
+      for (j = res_ptr->non2pl; j != NULL && j != i; j = j->next)
+	{
+	  if (j->tran_index == i->tran_index)
+	    {
+	      msg_str = "lk_consistent_res: tran_index of a non2pl is incons. (3)";
+	      goto inconsistent;
+	    }
+	}
+    }
+
+  /* consistent */
+  pthread_mutex_unlock (&res_ptr->res_mutex);
+  return true;
+
+inconsistent:
+  lock_dump_resource (thread_p, stdout, res_ptr);
+  pthread_mutex_unlock (&res_ptr->res_mutex);
+  er_log_debug (ARG_FILE_LINE, msg_str);
+  return false;
+}
+#endif /* SERVER_MODE */
+
+#if defined(SERVER_MODE)
+/*
+ * lock_check_consistent_tran_lock - Check consistency of transaction lock info entry
+ *
+ * return: true/false
+ *
+ *   tran_lock(in): ponter to the transaction lock information entry
+ *
+ * Note:check if the given transaction lock information enrtry is consistent.
+ */
+static bool
+lock_check_consistent_tran_lock (LK_TRAN_LOCK * tran_lock)
+{
+  int count;
+  LK_ENTRY *i;
+  int rv;
+
+  /* hold transaction hold mutex */
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+
+  /* check held locks */
+  /* check inst_hold_count and class_hold_count */
+  for (count = 0, i = tran_lock->inst_hold_list; i != NULL; i = i->tran_next)
+    {
+      count++;
+    }
+  if (count != tran_lock->inst_hold_count)
+    {
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+      er_log_debug (ARG_FILE_LINE, "lk_consistent_tran_lock: inst_hold_count incorrect.");
+      return false;
+    }
+  for (count = 0, i = tran_lock->class_hold_list; i != NULL; i = i->tran_next)
+    {
+      count++;
+    }
+  if (count != tran_lock->class_hold_count)
+    {
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+      er_log_debug (ARG_FILE_LINE, "lk_consistent_tran_lock: class_hold_count incorrect.");
+      return false;
+    }
+
+  /* release transaction hold mutex */
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  /* hold transaction non2pl mutex */
+  rv = pthread_mutex_lock (&tran_lock->non2pl_mutex);
+
+  /* check non2pl locks */
+  /* check num_incons_non2pl */
   for (count = 0, i = tran_lock->non2pl_list; i != NULL; i = i->tran_next)
     {
       if (i->granted_mode == INCON_NON_TWO_PHASE_LOCK)
@@ -6584,1493 +7600,1189 @@ lock_classes_lock_hint (THREAD_ENTRY * thread_p, LC_LOCKHINT * lockhint)
 	      prm_get_integer_value (PRM_ID_MNT_WAITING_THREAD));
       er_log_debug (ARG_FILE_LINE, "lock_classes_lock_hint: %6d.%06d\n", elapsed_time.tv_sec, elapsed_time.tv_usec);
     }
-#endif
-
-  return LK_GRANTED;
-
-error:
-  if (cls_lockinfo != &cls_lockinfo_space[0])
-    {
-      db_private_free_and_init (thread_p, cls_lockinfo);
-    }
-  return granted;
-#endif /* !SERVER_MODE */
-}
-
-static void
-lock_unlock_object_lock_internal (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock,
-				  int release_flag, int move_to_non2pl)
-{
-#if !defined (SERVER_MODE)
-  return;
-#else /* !SERVER_MODE */
-  LK_ENTRY *entry_ptr = NULL;
-  int tran_index;
-  bool is_class;
-
-  is_class = (OID_IS_ROOTOID (oid) || OID_IS_ROOTOID (class_oid)) ? true : false;
-
-  /* get transaction table index */
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  entry_ptr = lock_find_tran_hold_entry (tran_index, oid, is_class);
-
-  if (entry_ptr != NULL)
-    {
-      lock_internal_perform_unlock_object (thread_p, entry_ptr, release_flag, move_to_non2pl);
-    }
-#endif
-}
-
-/*
- * lock_unlock_object_donot_move_to_non2pl - Unlock an object lock on the specified object
- *   return:
- *   thread_p(in):
- *   oid(in):  Identifier of instance to unlock from
- *   class_oid(in): Identifier of the class of the instance
- *   lock(in): Lock to release
- *
- */
-void
-lock_unlock_object_donot_move_to_non2pl (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock)
-{
-  lock_unlock_object_lock_internal (thread_p, oid, class_oid, lock, false, false);
-}
-
-/*
- * lock_remove_object_lock - Removes a lock on the specified object
- *   return:
- *   thread_p(in):
- *   oid(in):  Identifier of instance to remove lock from
- *   class_oid(in): Identifier of the class of the instance
- *   lock(in): Lock to remove
- *
- */
-void
-lock_remove_object_lock (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock)
-{
-  lock_unlock_object_lock_internal (thread_p, oid, class_oid, lock, true, false);
-}
-
-/*
- * lock_unlock_object - Unlock an object according to transaction isolation level
- *
- * return: nothing..
- *
- *   oid(in): Identifier of instance to lock
- *   class_oid(in): Identifier of the class of the instance
- *   lock(in): Lock to release
- *   force(in): Unlock the object no matter what it is the isolation level.
- *
- */
-void
-lock_unlock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock, int force)
-{
-#if !defined (SERVER_MODE)
-  return;
-#else /* !SERVER_MODE */
-  int tran_index;		/* transaction table index */
-  TRAN_ISOLATION isolation;	/* transaction isolation level */
-  LK_ENTRY *entry_ptr;
-  bool is_class;
-
-  if (oid == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_object", "NULL OID pointer");
-      return;
-    }
-  if (class_oid == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_object", "NULL ClassOID pointer");
-      return;
-    }
-
-  is_class = (OID_IS_ROOTOID (oid) || OID_IS_ROOTOID (class_oid)) ? true : false;
-
-  /* get transaction table index */
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-
-  if (force == true)
-    {
-#if defined(ENABLE_SYSTEMTAP)
-      CUBRID_LOCK_RELEASE_START (oid, class_oid, lock);
-#endif /* ENABLE_SYSTEMTAP */
-
-      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, is_class);
-
-      if (entry_ptr != NULL)
-	{
-	  lock_internal_perform_unlock_object (thread_p, entry_ptr, false, true);
-	}
-
-#if defined(ENABLE_SYSTEMTAP)
-      CUBRID_LOCK_RELEASE_END (oid, class_oid, lock);
-#endif /* ENABLE_SYSTEMTAP */
-
-      return;
-    }
-
-  /* force != true */
-  if (lock != S_LOCK)
-    {
-      assert (lock != NULL_LOCK);
-      /* These will not be released. */
-      return;
-    }
-
-  isolation = logtb_find_isolation (tran_index);
-  switch (isolation)
-    {
-    case TRAN_SERIALIZABLE:
-    case TRAN_REPEATABLE_READ:
-      return;			/* nothing to do */
-
-    case TRAN_READ_COMMITTED:
-#if defined(ENABLE_SYSTEMTAP)
-      CUBRID_LOCK_RELEASE_START (oid, class_oid, lock);
-#endif /* ENABLE_SYSTEMTAP */
-
-      /* The intentional lock on the higher lock granule must be kept. */
-      lock_unlock_object_by_isolation (thread_p, tran_index, isolation, class_oid, oid);
-
-#if defined(ENABLE_SYSTEMTAP)
-      CUBRID_LOCK_RELEASE_END (oid, class_oid, lock);
-#endif /* ENABLE_SYSTEMTAP */
-      break;
-
-    default:			/* TRAN_UNKNOWN_ISOLATION */
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_UNKNOWN_ISOLATION, 2, isolation, tran_index);
-      break;
-    }
-
-  return;
-#endif /* !SERVER_MODE */
-}
-
-/*
- * lock_unlock_objects_lock_set - Unlock many objects according to isolation level
- *
- * return: nothing..
- *
- *   lockset(in):
- *
- */
-void
-lock_unlock_objects_lock_set (THREAD_ENTRY * thread_p, LC_LOCKSET * lockset)
-{
-#if !defined (SERVER_MODE)
-  return;
-#else /* !SERVER_MODE */
-  int tran_index;		/* transaction table index */
-  TRAN_ISOLATION isolation;	/* transaction isolation level */
-  LOCK reqobj_class_unlock;
-  OID *oid, *class_oid;
-  int i;
-
-  if (lockset == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_objects_lockset",
-	      "NULL lockset pointer");
-      return;
-    }
-
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  isolation = logtb_find_isolation (tran_index);
-
-  if (isolation == TRAN_SERIALIZABLE || isolation == TRAN_REPEATABLE_READ)
-    {
-      return;			/* Nothing to release */
-    }
-  else if (isolation != TRAN_READ_COMMITTED)
-    {
-      assert (0);
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_UNKNOWN_ISOLATION, 2, isolation, tran_index);
-      return;
-    }
-
-  assert (isolation == TRAN_READ_COMMITTED);
-
-  reqobj_class_unlock = lockset->reqobj_class_lock;
-  if (reqobj_class_unlock == X_LOCK)
-    {
-      return;			/* Don't release the lock */
-    }
-
-  for (i = 0; i < lockset->num_reqobjs_processed; i++)
-    {
-      oid = &lockset->objects[i].oid;
-      if (OID_ISNULL (oid) || lockset->objects[i].class_index == -1)
-	{
-	  continue;
-	}
-
-      class_oid = &lockset->classes[lockset->objects[i].class_index].oid;
-      if (OID_ISNULL (class_oid))
-	{
-	  continue;
-	}
+#endif
 
-      /* The intentional lock on the higher lock granule must be kept. */
-      lock_unlock_object_by_isolation (thread_p, tran_index, isolation, class_oid, oid);
+  return LK_GRANTED;
+
+error:
+  if (cls_lockinfo != &cls_lockinfo_space[0])
+    {
+      db_private_free_and_init (thread_p, cls_lockinfo);
     }
+  return granted;
 #endif /* !SERVER_MODE */
 }
 
-/*
- * lock_unlock_classes_lock_hint - Unlock many hinted classes according to
- *                             transaction isolation level
- *
- * return: nothing..
- *
- *   lockhint(in): Description of hinted classses
- *
- */
-void
-lock_unlock_classes_lock_hint (THREAD_ENTRY * thread_p, LC_LOCKHINT * lockhint)
+static void
+lock_unlock_object_lock_internal (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock,
+				  int release_flag, int move_to_non2pl)
 {
 #if !defined (SERVER_MODE)
   return;
 #else /* !SERVER_MODE */
-  int tran_index;		/* transaction table index */
-  TRAN_ISOLATION isolation;	/* transaction isolation level */
-  int i;
-
-  if (lockhint == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_classes_lockhint",
-	      "NULL lockhint pointer");
-      return;
-    }
+  LK_ENTRY *entry_ptr = NULL;
+  int tran_index;
+  bool is_class;
 
-  /* If there is nothing to unlock, returns */
-  if (lockhint->num_classes <= 0)
-    {
-      return;
-    }
+  is_class = (OID_IS_ROOTOID (oid) || OID_IS_ROOTOID (class_oid)) ? true : false;
 
+  /* get transaction table index */
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  isolation = logtb_find_isolation (tran_index);
+  entry_ptr = lock_find_tran_hold_entry (tran_index, oid, is_class);
 
-  switch (isolation)
+  if (entry_ptr != NULL)
     {
-    case TRAN_SERIALIZABLE:
-    case TRAN_REPEATABLE_READ:
-      return;			/* nothing to do */
+      lock_internal_perform_unlock_object (thread_p, entry_ptr, release_flag, move_to_non2pl);
+    }
+#endif
+}
 
-    case TRAN_READ_COMMITTED:
-      for (i = 0; i < lockhint->num_classes; i++)
-	{
-	  if (OID_ISNULL (&lockhint->classes[i].oid) || lockhint->classes[i].lock == NULL_LOCK)
-	    {
-	      continue;
-	    }
-	  lock_unlock_inst_locks_of_class_by_isolation (thread_p, tran_index, isolation, &lockhint->classes[i].oid);
-	}
-      return;
+/*
+ * lock_unlock_object_donot_move_to_non2pl - Unlock an object lock on the specified object
+ *   return:
+ *   thread_p(in):
+ *   oid(in):  Identifier of instance to unlock from
+ *   class_oid(in): Identifier of the class of the instance
+ *   lock(in): Lock to release
+ *
+ */
+void
+lock_unlock_object_donot_move_to_non2pl (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock)
+{
+  lock_unlock_object_lock_internal (thread_p, oid, class_oid, lock, false, false);
+}
 
-    default:			/* TRAN_UNKNOWN_ISOLATION */
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_UNKNOWN_ISOLATION, 2, isolation, tran_index);
-      return;
-    }
-#endif /* !SERVER_MODE */
+/*
+ * lock_remove_object_lock - Removes a lock on the specified object
+ *   return:
+ *   thread_p(in):
+ *   oid(in):  Identifier of instance to remove lock from
+ *   class_oid(in): Identifier of the class of the instance
+ *   lock(in): Lock to remove
+ *
+ */
+void
+lock_remove_object_lock (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock)
+{
+  lock_unlock_object_lock_internal (thread_p, oid, class_oid, lock, true, false);
 }
 
 /*
- * lock_unlock_all - Release all locks of current transaction
+ * lock_unlock_object - Unlock an object according to transaction isolation level
  *
- * return: nothing
+ * return: nothing..
  *
- * Note:Release all locks acquired by the current transaction.
+ *   oid(in): Identifier of instance to lock
+ *   class_oid(in): Identifier of the class of the instance
+ *   lock(in): Lock to release
+ *   force(in): Unlock the object no matter what it is the isolation level.
  *
- *      This function must be called at the end of the transaction.
  */
 void
-lock_unlock_all (THREAD_ENTRY * thread_p)
+lock_unlock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LOCK lock, int force)
 {
 #if !defined (SERVER_MODE)
-  lk_Standalone_has_xlock = false;
-  pgbuf_unfix_all (thread_p);
-
   return;
 #else /* !SERVER_MODE */
-  int tran_index;
-  LK_TRAN_LOCK *tran_lock;
+  int tran_index;		/* transaction table index */
+  TRAN_ISOLATION isolation;	/* transaction isolation level */
   LK_ENTRY *entry_ptr;
+  bool is_class;
 
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  tran_lock = &lk_Gl.tran_lock_table[tran_index];
-
-  /* remove all instance locks */
-  entry_ptr = tran_lock->inst_hold_list;
-  while (entry_ptr != NULL)
+  if (oid == NULL)
     {
-      assert (tran_index == entry_ptr->tran_index);
-
-      lock_internal_perform_unlock_object (thread_p, entry_ptr, true, false);
-      entry_ptr = tran_lock->inst_hold_list;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_object", "NULL OID pointer");
+      return;
     }
-
-  /* remove all class locks */
-  entry_ptr = tran_lock->class_hold_list;
-  while (entry_ptr != NULL)
+  if (class_oid == NULL)
     {
-      assert (tran_index == entry_ptr->tran_index);
-
-      lock_internal_perform_unlock_object (thread_p, entry_ptr, true, false);
-      entry_ptr = tran_lock->class_hold_list;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_object", "NULL ClassOID pointer");
+      return;
     }
 
-  /* remove root class lock */
-  entry_ptr = tran_lock->root_class_hold;
-  if (entry_ptr != NULL)
-    {
-      assert (tran_index == entry_ptr->tran_index);
+  is_class = (OID_IS_ROOTOID (oid) || OID_IS_ROOTOID (class_oid)) ? true : false;
 
-      lock_internal_perform_unlock_object (thread_p, entry_ptr, true, false);
-    }
+  /* get transaction table index */
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
-  /* remove non2pl locks */
-  while (tran_lock->non2pl_list != NULL)
+  if (force == true)
     {
-      /* remove the non2pl entry from transaction non2pl list */
-      entry_ptr = tran_lock->non2pl_list;
-      tran_lock->non2pl_list = entry_ptr->tran_next;
+#if defined(ENABLE_SYSTEMTAP)
+      CUBRID_LOCK_RELEASE_START (oid, class_oid, lock);
+#endif /* ENABLE_SYSTEMTAP */
 
-      assert (tran_index == entry_ptr->tran_index);
+      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, is_class);
 
-      if (entry_ptr->granted_mode == INCON_NON_TWO_PHASE_LOCK)
+      if (entry_ptr != NULL)
 	{
-	  tran_lock->num_incons_non2pl -= 1;
+	  lock_internal_perform_unlock_object (thread_p, entry_ptr, false, true);
 	}
-      /* remove the non2pl entry from resource non2pl list and free it */
-      lock_remove_non2pl (entry_ptr, tran_index);
-    }
-
-  lock_clear_deadlock_victim (tran_index);
-
-  pgbuf_unfix_all (thread_p);
-#endif /* !SERVER_MODE */
-}
 
-static LK_ENTRY *
-lock_find_tran_hold_entry (int tran_index, const OID * oid, bool is_class)
-{
-#if !defined (SERVER_MODE)
-  return NULL;
-#else /* !SERVER_MODE */
-  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (NULL, THREAD_TS_OBJ_LOCK_RES);
-  LK_RES_KEY search_key;
-  LK_RES *res_ptr;
-  LK_ENTRY *entry_ptr;
-  int rv;
+#if defined(ENABLE_SYSTEMTAP)
+      CUBRID_LOCK_RELEASE_END (oid, class_oid, lock);
+#endif /* ENABLE_SYSTEMTAP */
 
-  if (is_class)
-    {
-      return lock_find_class_entry (tran_index, oid);
+      return;
     }
 
-  /* search hash */
-  search_key = lock_create_search_key ((OID *) oid, NULL);
-  if (search_key.type != LOCK_RESOURCE_ROOT_CLASS)
-    {
-      /* override type; we don't insert here, so class_oid is neither passed to us nor needed for the search */
-      search_key.type = (is_class ? LOCK_RESOURCE_CLASS : LOCK_RESOURCE_INSTANCE);
-    }
-  rv = lf_hash_find (t_entry, &lk_Gl.obj_hash_table, (void *) &search_key, (void **) &res_ptr);
-  if (rv != NO_ERROR)
+  /* force != true */
+  if (lock != S_LOCK)
     {
-      return NULL;
+      assert (lock != NULL_LOCK);
+      /* These will not be released. */
+      return;
     }
 
-  if (res_ptr == NULL)
+  isolation = logtb_find_isolation (tran_index);
+  switch (isolation)
     {
-      /* not found */
-      return NULL;
-    }
+    case TRAN_SERIALIZABLE:
+    case TRAN_REPEATABLE_READ:
+      return;			/* nothing to do */
 
-  entry_ptr = res_ptr->holder;
-  for (; entry_ptr != NULL; entry_ptr = entry_ptr->next)
-    {
-      if (entry_ptr->tran_index == tran_index)
-	{
-	  break;
-	}
+    case TRAN_READ_COMMITTED:
+#if defined(ENABLE_SYSTEMTAP)
+      CUBRID_LOCK_RELEASE_START (oid, class_oid, lock);
+#endif /* ENABLE_SYSTEMTAP */
+
+      /* The intentional lock on the higher lock granule must be kept. */
+      lock_unlock_object_by_isolation (thread_p, tran_index, isolation, class_oid, oid);
+
+#if defined(ENABLE_SYSTEMTAP)
+      CUBRID_LOCK_RELEASE_END (oid, class_oid, lock);
+#endif /* ENABLE_SYSTEMTAP */
+      break;
+
+    default:			/* TRAN_UNKNOWN_ISOLATION */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_UNKNOWN_ISOLATION, 2, isolation, tran_index);
+      break;
     }
 
-  pthread_mutex_unlock (&res_ptr->res_mutex);
-  return entry_ptr;
-#endif
+  return;
+#endif /* !SERVER_MODE */
 }
 
 /*
- * lock_get_object_lock - Find the acquired lock mode
- *
- * return:
- *
- *   oid(in): target object ientifier
- *   class_oid(in): class identifier of the target object
- *   tran_index(in): the transaction table index of target transaction.
+ * lock_unlock_objects_lock_set - Unlock many objects according to isolation level
  *
- * Note:Find the acquired lock on the given object by the given transaction.
- *     Currently, the value of the "tran_index" must not be NULL_TRAN_INDEX.
+ * return: nothing..
+ *
+ *   lockset(in):
  *
- *     If this function is changed in order to allow NULL_TRAN_INDEX to be
- *     transferred as the value of the "tran_index", this function will
- *     find the resulting lock acquired by all transactions holding a lock
- *     on the given OID (The most powerful lock, actually a combination of
- *     the locks).
  */
-LOCK
-lock_get_object_lock (const OID * oid, const OID * class_oid, int tran_index)
+void
+lock_unlock_objects_lock_set (THREAD_ENTRY * thread_p, LC_LOCKSET * lockset)
 {
 #if !defined (SERVER_MODE)
-  return X_LOCK;
+  return;
 #else /* !SERVER_MODE */
-  LOCK lock_mode = NULL_LOCK;	/* return value */
-  LK_TRAN_LOCK *tran_lock;
-  LK_ENTRY *entry_ptr;
-  int rv;
+  int tran_index;		/* transaction table index */
+  TRAN_ISOLATION isolation;	/* transaction isolation level */
+  LOCK reqobj_class_unlock;
+  OID *oid, *class_oid;
+  int i;
 
-  if (oid == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_object_lock", "NULL OID pointer");
-      return NULL_LOCK;
-    }
-  if (tran_index == NULL_TRAN_INDEX)
+  if (lockset == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_object_lock", "NULL_TRAN_INDEX");
-      return NULL_LOCK;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_objects_lockset",
+	      "NULL lockset pointer");
+      return;
     }
 
-  /* get a pointer to transaction lock info entry */
-  tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  isolation = logtb_find_isolation (tran_index);
 
-  /* 
-   * case 1: root class lock
-   */
-  /* get the granted lock mode acquired on the root class oid */
-  if (OID_EQ (oid, oid_Root_class_oid))
+  if (isolation == TRAN_SERIALIZABLE || isolation == TRAN_REPEATABLE_READ)
     {
-      rv = pthread_mutex_lock (&tran_lock->hold_mutex);
-      if (tran_lock->root_class_hold != NULL)
-	{
-	  lock_mode = tran_lock->root_class_hold->granted_mode;
-	}
-      pthread_mutex_unlock (&tran_lock->hold_mutex);
-      return lock_mode;		/* might be NULL_LOCK */
+      return;			/* Nothing to release */
     }
-
-  /* 
-   * case 2: general class lock
-   */
-  /* get the granted lock mode acquired on the given class oid */
-  if (class_oid == NULL || OID_EQ (class_oid, oid_Root_class_oid))
+  else if (isolation != TRAN_READ_COMMITTED)
     {
-      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, true);
-      if (entry_ptr != NULL)
-	{
-	  lock_mode = entry_ptr->granted_mode;
-	}
-      return lock_mode;		/* might be NULL_LOCK */
+      assert (0);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_UNKNOWN_ISOLATION, 2, isolation, tran_index);
+      return;
     }
 
-  entry_ptr = lock_find_tran_hold_entry (tran_index, class_oid, true);
-  if (entry_ptr != NULL)
-    {
-      lock_mode = entry_ptr->granted_mode;
-    }
+  assert (isolation == TRAN_READ_COMMITTED);
 
-  /* If the class lock mode is one of S_LOCK, X_LOCK or SCH_M_LOCK, the lock is held on the instance implicitly. In
-   * this case, there is no need to check instance lock. If the class lock mode is SIX_LOCK, S_LOCK is held on the
-   * instance implicitly. In this case, we must check for a possible X_LOCK on the instance. In other cases, we must
-   * check the lock held on the instance. */
-  if (lock_mode == SCH_M_LOCK)
+  reqobj_class_unlock = lockset->reqobj_class_lock;
+  if (reqobj_class_unlock == X_LOCK)
     {
-      return X_LOCK;
+      return;			/* Don't release the lock */
     }
-  else if (lock_mode != S_LOCK && lock_mode != X_LOCK)
+
+  for (i = 0; i < lockset->num_reqobjs_processed; i++)
     {
-      if (lock_mode == SIX_LOCK)
-	{
-	  lock_mode = S_LOCK;
-	}
-      else
+      oid = &lockset->objects[i].oid;
+      if (OID_ISNULL (oid) || lockset->objects[i].class_index == -1)
 	{
-	  lock_mode = NULL_LOCK;
+	  continue;
 	}
 
-      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, false);
-      if (entry_ptr != NULL)
+      class_oid = &lockset->classes[lockset->objects[i].class_index].oid;
+      if (OID_ISNULL (class_oid))
 	{
-	  lock_mode = entry_ptr->granted_mode;
+	  continue;
 	}
-    }
 
-  return lock_mode;		/* might be NULL_LOCK */
+      /* The intentional lock on the higher lock granule must be kept. */
+      lock_unlock_object_by_isolation (thread_p, tran_index, isolation, class_oid, oid);
+    }
 #endif /* !SERVER_MODE */
 }
 
 /*
- * lock_has_lock_on_object -
- *
- * return:
+ * lock_unlock_classes_lock_hint - Unlock many hinted classes according to
+ *                             transaction isolation level
  *
- *   oid(in): target object ientifier
- *   class_oid(in): class identifier of the target object
- *   tran_index(in): the transaction table index of target transaction.
- *   lock(in): the lock mode
+ * return: nothing..
  *
- * Note: Find whether the transaction holds an enough lock on the object
+ *   lockhint(in): Description of hinted classses
  *
  */
-int
-lock_has_lock_on_object (const OID * oid, const OID * class_oid, int tran_index, LOCK lock)
+void
+lock_unlock_classes_lock_hint (THREAD_ENTRY * thread_p, LC_LOCKHINT * lockhint)
 {
 #if !defined (SERVER_MODE)
-  return 1;
+  return;
 #else /* !SERVER_MODE */
-  LOCK granted_lock_mode = NULL_LOCK;
-  LK_TRAN_LOCK *tran_lock;
-  LK_ENTRY *entry_ptr;
-  int rv;
+  int tran_index;		/* transaction table index */
+  TRAN_ISOLATION isolation;	/* transaction isolation level */
+  int i;
 
-  if (oid == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lock_has_lock_on_object", "NULL OID pointer");
-      return ER_LK_BAD_ARGUMENT;
-    }
-  if (tran_index == NULL_TRAN_INDEX)
+  if (lockhint == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lock_has_lock_on_object", "NULL_TRAN_INDEX");
-      return ER_LK_BAD_ARGUMENT;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_unlock_classes_lockhint",
+	      "NULL lockhint pointer");
+      return;
     }
 
-  /* get a pointer to transaction lock info entry */
-  tran_lock = &lk_Gl.tran_lock_table[tran_index];
-
-  /* 
-   * case 1: root class lock
-   */
-  /* get the granted lock mode acquired on the root class oid */
-  if (OID_EQ (oid, oid_Root_class_oid))
+  /* If there is nothing to unlock, returns */
+  if (lockhint->num_classes <= 0)
     {
-      rv = pthread_mutex_lock (&tran_lock->hold_mutex);
-      if (tran_lock->root_class_hold != NULL)
-	{
-	  granted_lock_mode = tran_lock->root_class_hold->granted_mode;
-	}
-      pthread_mutex_unlock (&tran_lock->hold_mutex);
-      return (lock_Conv[lock][granted_lock_mode] == granted_lock_mode);
+      return;
     }
 
-  /* 
-   * case 2: general class lock
-   */
-  /* get the granted lock mode acquired on the given class oid */
-  if (class_oid == NULL || OID_EQ (class_oid, oid_Root_class_oid))
-    {
-      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, true);
-      if (entry_ptr != NULL)
-	{
-	  granted_lock_mode = entry_ptr->granted_mode;
-	}
-      return (lock_Conv[lock][granted_lock_mode] == granted_lock_mode);
-    }
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  isolation = logtb_find_isolation (tran_index);
 
-  entry_ptr = lock_find_tran_hold_entry (tran_index, class_oid, true);
-  if (entry_ptr != NULL)
+  switch (isolation)
     {
-      granted_lock_mode = entry_ptr->granted_mode;
-      if (lock_Conv[lock][granted_lock_mode] == granted_lock_mode)
+    case TRAN_SERIALIZABLE:
+    case TRAN_REPEATABLE_READ:
+      return;			/* nothing to do */
+
+    case TRAN_READ_COMMITTED:
+      for (i = 0; i < lockhint->num_classes; i++)
 	{
-	  return 1;
+	  if (OID_ISNULL (&lockhint->classes[i].oid) || lockhint->classes[i].lock == NULL_LOCK)
+	    {
+	      continue;
+	    }
+	  lock_unlock_inst_locks_of_class_by_isolation (thread_p, tran_index, isolation, &lockhint->classes[i].oid);
 	}
-    }
+      return;
 
-  /* 
-   * case 3: object lock
-   */
-  /* get the granted lock mode acquired on the given instance/pseudo oid */
-  entry_ptr = lock_find_tran_hold_entry (tran_index, oid, false);
-  if (entry_ptr != NULL)
-    {
-      granted_lock_mode = entry_ptr->granted_mode;
-      return 1;
+    default:			/* TRAN_UNKNOWN_ISOLATION */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_UNKNOWN_ISOLATION, 2, isolation, tran_index);
+      return;
     }
-
-  return 0;
 #endif /* !SERVER_MODE */
 }
 
 /*
- * lock_has_xlock - Does transaction have an exclusive lock on any resource ?
+ * lock_unlock_all - Release all locks of current transaction
  *
- * return:
+ * return: nothing
  *
- * Note:Find if the current transaction has any kind of exclusive lock
- *     on any lock resource.
+ * Note:Release all locks acquired by the current transaction.
+ *
+ *      This function must be called at the end of the transaction.
  */
-bool
-lock_has_xlock (THREAD_ENTRY * thread_p)
+void
+lock_unlock_all (THREAD_ENTRY * thread_p)
 {
 #if !defined (SERVER_MODE)
-  return lk_Standalone_has_xlock;
+  lk_Standalone_has_xlock = false;
+  pgbuf_unfix_all (thread_p);
+
+  return;
 #else /* !SERVER_MODE */
   int tran_index;
   LK_TRAN_LOCK *tran_lock;
-  LOCK lock_mode;
   LK_ENTRY *entry_ptr;
-  int rv;
 
-  /* 
-   * Exclusive locks in this context mean IX_LOCK, SIX_LOCK, X_LOCK and
-   * SCH_M_LOCK. NOTE that U_LOCK are excluded from exclusive locks. 
-   * Because U_LOCK is currently for reading the object.
-   */
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
-  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
 
-  /* 1. check root class lock */
-  if (tran_lock->root_class_hold != NULL)
+  /* remove all instance locks */
+  entry_ptr = tran_lock->inst_hold_list;
+  while (entry_ptr != NULL)
+    {
+      assert (tran_index == entry_ptr->tran_index);
+
+      lock_internal_perform_unlock_object (thread_p, entry_ptr, true, false);
+      entry_ptr = tran_lock->inst_hold_list;
+    }
+
+  /* remove all class locks */
+  entry_ptr = tran_lock->class_hold_list;
+  while (entry_ptr != NULL)
+    {
+      assert (tran_index == entry_ptr->tran_index);
+
+      lock_internal_perform_unlock_object (thread_p, entry_ptr, true, false);
+      entry_ptr = tran_lock->class_hold_list;
+    }
+
+  /* remove root class lock */
+  entry_ptr = tran_lock->root_class_hold;
+  if (entry_ptr != NULL)
     {
-      lock_mode = tran_lock->root_class_hold->granted_mode;
-      if (lock_mode == X_LOCK || lock_mode == IX_LOCK || lock_mode == SIX_LOCK || lock_mode == SCH_M_LOCK)
-	{
-	  pthread_mutex_unlock (&tran_lock->hold_mutex);
-	  return true;
-	}
+      assert (tran_index == entry_ptr->tran_index);
+
+      lock_internal_perform_unlock_object (thread_p, entry_ptr, true, false);
     }
 
-  /* 2. check general class locks */
-  entry_ptr = tran_lock->class_hold_list;
-  while (entry_ptr != NULL)
+  /* remove non2pl locks */
+  while (tran_lock->non2pl_list != NULL)
     {
-      lock_mode = entry_ptr->granted_mode;
-      if (lock_mode == X_LOCK || lock_mode == IX_LOCK || lock_mode == SIX_LOCK || lock_mode == SCH_M_LOCK)
+      /* remove the non2pl entry from transaction non2pl list */
+      entry_ptr = tran_lock->non2pl_list;
+      tran_lock->non2pl_list = entry_ptr->tran_next;
+
+      assert (tran_index == entry_ptr->tran_index);
+
+      if (entry_ptr->granted_mode == INCON_NON_TWO_PHASE_LOCK)
 	{
-	  pthread_mutex_unlock (&tran_lock->hold_mutex);
-	  return true;
+	  tran_lock->num_incons_non2pl -= 1;
 	}
-      entry_ptr = entry_ptr->tran_next;
+      /* remove the non2pl entry from resource non2pl list and free it */
+      lock_remove_non2pl (entry_ptr, tran_index);
     }
 
-  /* 3. checking instance locks is not needed. According to MGL ptotocol, an exclusive class lock has been acquired
-   * with intention mode before an exclusive instance is acquired. */
+  lock_clear_deadlock_victim (tran_index);
 
-  pthread_mutex_unlock (&tran_lock->hold_mutex);
-  return false;
+  pgbuf_unfix_all (thread_p);
 #endif /* !SERVER_MODE */
 }
 
-#if defined(ENABLE_UNUSED_FUNCTION)
-/*
- * lock_has_lock_transaction - Does transaction have any lock on any resource ?
- *
- * return:
- *
- *   tran_index(in):
- *
- * Note:Find if given transaction has any kind of lock.
- *     Used by css_check_for_clients_down() to eliminate needless pinging.
- */
-bool
-lock_has_lock_transaction (int tran_index)
+static LK_ENTRY *
+lock_find_tran_hold_entry (int tran_index, const OID * oid, bool is_class)
 {
 #if !defined (SERVER_MODE)
-  return lk_Standalone_has_xlock;
+  return NULL;
 #else /* !SERVER_MODE */
-  LK_TRAN_LOCK *tran_lock;
-  bool lock_hold;
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (NULL, THREAD_TS_OBJ_LOCK_RES);
+  LK_RES_KEY search_key;
+  LK_RES *res_ptr;
+  LK_ENTRY *entry_ptr;
   int rv;
 
-  tran_lock = &lk_Gl.tran_lock_table[tran_index];
-  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
-  if (tran_lock->root_class_hold != NULL || tran_lock->class_hold_list != NULL || tran_lock->inst_hold_list != NULL
-      || tran_lock->non2pl_list != NULL)
+  if (is_class)
     {
-      lock_hold = true;
+      return lock_find_class_entry (tran_index, oid);
     }
-  else
+
+  /* search hash */
+  search_key = lock_create_search_key ((OID *) oid, NULL);
+  if (search_key.type != LOCK_RESOURCE_ROOT_CLASS)
     {
-      lock_hold = false;
+      /* override type; we don't insert here, so class_oid is neither passed to us nor needed for the search */
+      search_key.type = (is_class ? LOCK_RESOURCE_CLASS : LOCK_RESOURCE_INSTANCE);
+    }
+  rv = lf_hash_find (t_entry, &lk_Gl.obj_hash_table, (void *) &search_key, (void **) &res_ptr);
+  if (rv != NO_ERROR)
+    {
+      return NULL;
     }
-  pthread_mutex_unlock (&tran_lock->hold_mutex);
-
-  return lock_hold;
-#endif /* !SERVER_MODE */
-}
-#endif
 
-/*
- * lock_is_waiting_transaction -
- *
- * return:
- *
- *   tran_index(in):
- */
-bool
-lock_is_waiting_transaction (int tran_index)
-{
-#if !defined (SERVER_MODE)
-  return false;
-#else /* !SERVER_MODE */
-  THREAD_ENTRY *thrd_array[10];
-  int thrd_count, i;
-  THREAD_ENTRY *thrd_ptr;
+  if (res_ptr == NULL)
+    {
+      /* not found */
+      return NULL;
+    }
 
-  thrd_count = thread_get_lockwait_entry (tran_index, &thrd_array[0]);
-  for (i = 0; i < thrd_count; i++)
+  entry_ptr = res_ptr->holder;
+  for (; entry_ptr != NULL; entry_ptr = entry_ptr->next)
     {
-      thrd_ptr = thrd_array[i];
-      (void) thread_lock_entry (thrd_ptr);
-      if (LK_IS_LOCKWAIT_THREAD (thrd_ptr))
-	{
-	  (void) thread_unlock_entry (thrd_ptr);
-	  return true;
-	}
-      else
+      if (entry_ptr->tran_index == tran_index)
 	{
-	  if (thrd_ptr->lockwait != NULL || thrd_ptr->lockwait_state == (int) LOCK_SUSPENDED)
-	    {
-	      /* some strange lock wait state.. */
-	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd_ptr->lockwait,
-		      thrd_ptr->lockwait_state, thrd_ptr->index, thrd_ptr->tid, thrd_ptr->tran_index);
-	    }
+	  break;
 	}
-      (void) thread_unlock_entry (thrd_ptr);
     }
 
-  return false;
-#endif /* !SERVER_MODE */
+  pthread_mutex_unlock (&res_ptr->res_mutex);
+  return entry_ptr;
+#endif
 }
 
 /*
- * lock_get_class_lock - Get a pointer to lock heap entry acquired by
- *                        given transaction on given class object
+ * lock_get_object_lock - Find the acquired lock mode
  *
  * return:
  *
- *   class_oid(in): target class object identifier
- *   tran_index(in): target transaction
+ *   oid(in): target object ientifier
+ *   class_oid(in): class identifier of the target object
+ *   tran_index(in): the transaction table index of target transaction.
  *
- * Note:This function finds lock entry acquired by the given transaction
- *     on the given class and then return a pointer to the lock entry.
+ * Note:Find the acquired lock on the given object by the given transaction.
+ *     Currently, the value of the "tran_index" must not be NULL_TRAN_INDEX.
+ *
+ *     If this function is changed in order to allow NULL_TRAN_INDEX to be
+ *     transferred as the value of the "tran_index", this function will
+ *     find the resulting lock acquired by all transactions holding a lock
+ *     on the given OID (The most powerful lock, actually a combination of
+ *     the locks).
  */
-LK_ENTRY *
-lock_get_class_lock (const OID * class_oid, int tran_index)
+LOCK
+lock_get_object_lock (const OID * oid, const OID * class_oid, int tran_index)
 {
 #if !defined (SERVER_MODE)
-  assert (false);
-
-  return NULL;
+  return X_LOCK;
 #else /* !SERVER_MODE */
+  LOCK lock_mode = NULL_LOCK;	/* return value */
   LK_TRAN_LOCK *tran_lock;
   LK_ENTRY *entry_ptr;
   int rv;
 
-  if (class_oid == NULL)
+  if (oid == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_class_lock_ptr",
-	      "NULL ClassOID pointer");
-      return NULL;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_object_lock", "NULL OID pointer");
+      return NULL_LOCK;
     }
-  if (OID_ISNULL (class_oid))
+  if (tran_index == NULL_TRAN_INDEX)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_class_lock_ptr", "NULL_ClassOID");
-      return NULL;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_object_lock", "NULL_TRAN_INDEX");
+      return NULL_LOCK;
     }
 
   /* get a pointer to transaction lock info entry */
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
 
-  /* case 1: root class lock */
-  if (OID_EQ (class_oid, oid_Root_class_oid))
+  /* 
+   * case 1: root class lock
+   */
+  /* get the granted lock mode acquired on the root class oid */
+  if (OID_EQ (oid, oid_Root_class_oid))
     {
       rv = pthread_mutex_lock (&tran_lock->hold_mutex);
-      entry_ptr = tran_lock->root_class_hold;
+      if (tran_lock->root_class_hold != NULL)
+	{
+	  lock_mode = tran_lock->root_class_hold->granted_mode;
+	}
       pthread_mutex_unlock (&tran_lock->hold_mutex);
+      return lock_mode;		/* might be NULL_LOCK */
     }
-  else
+
+  /* 
+   * case 2: general class lock
+   */
+  /* get the granted lock mode acquired on the given class oid */
+  if (class_oid == NULL || OID_EQ (class_oid, oid_Root_class_oid))
     {
-      entry_ptr = lock_find_tran_hold_entry (tran_index, class_oid, true);
+      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, true);
+      if (entry_ptr != NULL)
+	{
+	  lock_mode = entry_ptr->granted_mode;
+	}
+      return lock_mode;		/* might be NULL_LOCK */
     }
 
-  return entry_ptr;
-#endif /* !SERVER_MODE */
-}
-
-/*
- * lock_force_timeout_lock_wait_transactions - All lock-wait transactions
- *                               are forced to timeout
- *
- * return: nothing
- *
- * Note:All lock-waiting transacions are forced to timeout.
- *     For this task, all lock-waiting threads are searched and
- *     then the threads are forced to timeout.
- */
-void
-lock_force_timeout_lock_wait_transactions (unsigned short stop_phase)
-{
-#if !defined (SERVER_MODE)
-  return;
-#else /* !SERVER_MODE */
-  int i;
-  THREAD_ENTRY *thrd;
-  CSS_CONN_ENTRY *conn_p;
-
-  for (i = 1; i < thread_num_total_threads (); i++)
+  entry_ptr = lock_find_tran_hold_entry (tran_index, class_oid, true);
+  if (entry_ptr != NULL)
     {
-      thrd = thread_find_entry_by_index (i);
+      lock_mode = entry_ptr->granted_mode;
+    }
 
-      conn_p = thrd->conn_entry;
-      if ((stop_phase == THREAD_STOP_LOGWR && conn_p == NULL) || (conn_p && conn_p->stop_phase != stop_phase))
+  /* If the class lock mode is one of S_LOCK, X_LOCK or SCH_M_LOCK, the lock is held on the instance implicitly. In
+   * this case, there is no need to check instance lock. If the class lock mode is SIX_LOCK, S_LOCK is held on the
+   * instance implicitly. In this case, we must check for a possible X_LOCK on the instance. In other cases, we must
+   * check the lock held on the instance. */
+  if (lock_mode == SCH_M_LOCK)
+    {
+      return X_LOCK;
+    }
+  else if (lock_mode != S_LOCK && lock_mode != X_LOCK)
+    {
+      if (lock_mode == SIX_LOCK)
 	{
-	  continue;
+	  lock_mode = S_LOCK;
 	}
-
-      (void) thread_lock_entry (thrd);
-      if (LK_IS_LOCKWAIT_THREAD (thrd))
+      else
 	{
-	  /* wake up the thread */
-	  lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_TIMEOUT);
+	  lock_mode = NULL_LOCK;
 	}
-      else
+
+      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, false);
+      if (entry_ptr != NULL)
 	{
-	  if (thrd->lockwait != NULL || thrd->lockwait_state == (int) LOCK_SUSPENDED)
-	    {
-	      /* some strange lock wait state.. */
-	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd->lockwait,
-		      thrd->lockwait_state, thrd->index, thrd->tid, thrd->tran_index);
-	    }
-	  /* release the thread entry mutex */
-	  (void) thread_unlock_entry (thrd);
+	  lock_mode = entry_ptr->granted_mode;
 	}
     }
-  return;
+
+  return lock_mode;		/* might be NULL_LOCK */
 #endif /* !SERVER_MODE */
 }
 
 /*
- * lock_force_timeout_expired_wait_transactions - Transaction is timeout if its waiting time has
- *                           expired or it is interrupted
+ * lock_has_lock_on_object -
  *
- * return: true if the thread was timed out or
- *                       false if the thread was not timed out.
+ * return:
  *
- *   thrd_entry(in): thread entry pointer
+ *   oid(in): target object ientifier
+ *   class_oid(in): class identifier of the target object
+ *   tran_index(in): the transaction table index of target transaction.
+ *   lock(in): the lock mode
+ *
+ * Note: Find whether the transaction holds an enough lock on the object
  *
- * Note:If the given thread is waiting on a lock to be granted, and
- *     either its expiration time has expired or it is interrupted,
- *     the thread is timed-out.
- *     If NULL is given, it applies to all threads.
  */
-bool
-lock_force_timeout_expired_wait_transactions (void *thrd_entry)
+int
+lock_has_lock_on_object (const OID * oid, const OID * class_oid, int tran_index, LOCK lock)
 {
 #if !defined (SERVER_MODE)
-  return true;
+  return 1;
 #else /* !SERVER_MODE */
-  int i;
-  bool ignore;
-  THREAD_ENTRY *thrd;
+  LOCK granted_lock_mode = NULL_LOCK;
+  LK_TRAN_LOCK *tran_lock;
+  LK_ENTRY *entry_ptr;
+  int rv;
 
-  if (thrd_entry != NULL)
+  if (oid == NULL)
     {
-      thrd = (THREAD_ENTRY *) thrd_entry;
-      (void) thread_lock_entry (thrd);
-      if (LK_IS_LOCKWAIT_THREAD (thrd))
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lock_has_lock_on_object", "NULL OID pointer");
+      return ER_LK_BAD_ARGUMENT;
+    }
+  if (tran_index == NULL_TRAN_INDEX)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lock_has_lock_on_object", "NULL_TRAN_INDEX");
+      return ER_LK_BAD_ARGUMENT;
+    }
+
+  /* get a pointer to transaction lock info entry */
+  tran_lock = &lk_Gl.tran_lock_table[tran_index];
+
+  /* 
+   * case 1: root class lock
+   */
+  /* get the granted lock mode acquired on the root class oid */
+  if (OID_EQ (oid, oid_Root_class_oid))
+    {
+      rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+      if (tran_lock->root_class_hold != NULL)
 	{
-	  struct timeval tv;
-	  INT64 etime;
-	  (void) gettimeofday (&tv, NULL);
-	  etime = (tv.tv_sec * 1000000LL + tv.tv_usec) / 1000LL;
-	  if (LK_CAN_TIMEOUT (thrd->lockwait_msecs) && etime - thrd->lockwait_stime > thrd->lockwait_msecs)
-	    {
-	      /* wake up the thread */
-	      lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_TIMEOUT);
-	      return true;
-	    }
-	  else if (logtb_is_interrupted_tran (NULL, true, &ignore, thrd->tran_index))
-	    {
-	      /* wake up the thread */
-	      lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_INTERRUPT);
-	      return true;
-	    }
-	  else
-	    {
-	      /* release the thread entry mutex */
-	      (void) thread_unlock_entry (thrd);
-	      return false;
-	    }
+	  granted_lock_mode = tran_lock->root_class_hold->granted_mode;
 	}
-      else
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+      return (lock_Conv[lock][granted_lock_mode] == granted_lock_mode);
+    }
+
+  /* 
+   * case 2: general class lock
+   */
+  /* get the granted lock mode acquired on the given class oid */
+  if (class_oid == NULL || OID_EQ (class_oid, oid_Root_class_oid))
+    {
+      entry_ptr = lock_find_tran_hold_entry (tran_index, oid, true);
+      if (entry_ptr != NULL)
 	{
-	  if (thrd->lockwait != NULL || thrd->lockwait_state == (int) LOCK_SUSPENDED)
-	    {
-	      /* some strange lock wait state.. */
-	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd->lockwait,
-		      thrd->lockwait_state, thrd->index, thrd->tid, thrd->tran_index);
-	    }
-	  /* release the thread entry mutex */
-	  (void) thread_unlock_entry (thrd);
-	  return false;
+	  granted_lock_mode = entry_ptr->granted_mode;
 	}
+      return (lock_Conv[lock][granted_lock_mode] == granted_lock_mode);
     }
-  else
+
+  entry_ptr = lock_find_tran_hold_entry (tran_index, class_oid, true);
+  if (entry_ptr != NULL)
     {
-      for (i = 1; i < thread_num_total_threads (); i++)
+      granted_lock_mode = entry_ptr->granted_mode;
+      if (lock_Conv[lock][granted_lock_mode] == granted_lock_mode)
 	{
-	  thrd = thread_find_entry_by_index (i);
-	  (void) thread_lock_entry (thrd);
-	  if (LK_IS_LOCKWAIT_THREAD (thrd))
-	    {
-	      struct timeval tv;
-	      INT64 etime;
-	      (void) gettimeofday (&tv, NULL);
-	      etime = (tv.tv_sec * 1000000LL + tv.tv_usec) / 1000LL;
-	      if ((LK_CAN_TIMEOUT (thrd->lockwait_msecs) && etime - thrd->lockwait_stime > thrd->lockwait_msecs)
-		  || logtb_is_interrupted_tran (NULL, true, &ignore, thrd->tran_index))
-		{
-		  /* wake up the thread */
-		  lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_TIMEOUT);
-		}
-	      else
-		{
-		  /* release the thread entry mutex */
-		  (void) thread_unlock_entry (thrd);
-		}
-	    }
-	  else
-	    {
-	      if (thrd->lockwait != NULL || thrd->lockwait_state == (int) LOCK_SUSPENDED)
-		{
-		  /* some strange lock wait state.. */
-		  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd->lockwait,
-			  thrd->lockwait_state, thrd->index, thrd->tid, thrd->tran_index);
-		}
-	      /* release the thread entry mutex */
-	      (void) thread_unlock_entry (thrd);
-	    }
+	  return 1;
 	}
-      return true;
     }
+
+  /* 
+   * case 3: object lock
+   */
+  /* get the granted lock mode acquired on the given instance/pseudo oid */
+  entry_ptr = lock_find_tran_hold_entry (tran_index, oid, false);
+  if (entry_ptr != NULL)
+    {
+      granted_lock_mode = entry_ptr->granted_mode;
+      return 1;
+    }
+
+  return 0;
 #endif /* !SERVER_MODE */
 }
 
 /*
- * lock_notify_isolation_incons - Notify of possible inconsistencies (no
- *                             repeatable reads) due to transaction isolation
- *                             level
- *
- * return: nothing.
+ * lock_has_xlock - Does transaction have an exclusive lock on any resource ?
  *
- *   fun(in): Function to notify
- *   args(in): Extra arguments for function
+ * return:
  *
- * Note:The current transaction is notified of any possible
- *              inconsistencies due to its isolation level. For each possible
- *              inconsistency the given function is called to decache any
- *              copies of the object.
+ * Note:Find if the current transaction has any kind of exclusive lock
+ *     on any lock resource.
  */
-void
-lock_notify_isolation_incons (THREAD_ENTRY * thread_p, bool (*fun) (const OID * class_oid, const OID * oid, void *args),
-			      void *args)
+bool
+lock_has_xlock (THREAD_ENTRY * thread_p)
 {
 #if !defined (SERVER_MODE)
-  return;
+  return lk_Standalone_has_xlock;
 #else /* !SERVER_MODE */
-  TRAN_ISOLATION isolation;
   int tran_index;
   LK_TRAN_LOCK *tran_lock;
-  LK_ENTRY *curr, *prev, *next;
-  LK_ENTRY *incon_non2pl_list_header = NULL;
-  LK_ENTRY *incon_non2pl_list_tail = NULL;
-  bool ret_val;
+  LOCK lock_mode;
+  LK_ENTRY *entry_ptr;
   int rv;
 
+  /* 
+   * Exclusive locks in this context mean IX_LOCK, SIX_LOCK, X_LOCK and
+   * SCH_M_LOCK. NOTE that U_LOCK are excluded from exclusive locks. 
+   * Because U_LOCK is currently for reading the object.
+   */
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  isolation = logtb_find_isolation (tran_index);
-  if (isolation == TRAN_REPEATABLE_READ || isolation == TRAN_SERIALIZABLE)
-    {
-      return;			/* Nothing was released */
-    }
-
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
-  rv = pthread_mutex_lock (&tran_lock->non2pl_mutex);
-
-  prev = NULL;
-  curr = tran_lock->non2pl_list;
-  while (tran_lock->num_incons_non2pl > 0 && curr != NULL)
-    {
-      if (curr->granted_mode != INCON_NON_TWO_PHASE_LOCK)
-	{
-	  prev = curr;
-	  curr = curr->tran_next;
-	  continue;
-	}
-
-      /* curr->granted_mode == INCON_NON_TWO_PHASE_LOCK */
-      assert (curr->res_head->key.type != LOCK_RESOURCE_INSTANCE || !OID_ISNULL (&curr->res_head->key.class_oid));
-
-      ret_val = (*fun) (&curr->res_head->key.class_oid, &curr->res_head->key.oid, args);
-      if (ret_val != true)
-	{
-	  /* the notification area is full */
-	  pthread_mutex_unlock (&(tran_lock->non2pl_mutex));
-
-	  goto end;
-	}
-
-      /* the non-2pl entry should be freed. */
-      /* 1. remove it from transaction non2pl list */
-      next = curr->tran_next;
-      if (prev == NULL)
-	{
-	  tran_lock->non2pl_list = next;
-	}
-      else
-	{
-	  prev->tran_next = next;
-	}
-
-      tran_lock->num_incons_non2pl -= 1;
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
 
-      /* 2. append current entry to incon_non2pl_list */
-      curr->tran_next = NULL;
-      if (incon_non2pl_list_header == NULL)
-	{
-	  incon_non2pl_list_header = curr;
-	  incon_non2pl_list_tail = curr;
-	}
-      else
+  /* 1. check root class lock */
+  if (tran_lock->root_class_hold != NULL)
+    {
+      lock_mode = tran_lock->root_class_hold->granted_mode;
+      if (lock_mode == X_LOCK || lock_mode == IX_LOCK || lock_mode == SIX_LOCK || lock_mode == SCH_M_LOCK)
 	{
-	  incon_non2pl_list_tail->tran_next = curr;
-	  incon_non2pl_list_tail = curr;
+	  pthread_mutex_unlock (&tran_lock->hold_mutex);
+	  return true;
 	}
-
-      curr = next;
     }
 
-  /* release transaction non2pl mutex */
-  pthread_mutex_unlock (&tran_lock->non2pl_mutex);
-
-end:
-
-  curr = incon_non2pl_list_header;
-  while (curr != NULL)
+  /* 2. check general class locks */
+  entry_ptr = tran_lock->class_hold_list;
+  while (entry_ptr != NULL)
     {
-      next = curr->tran_next;
-
-      /* remove it from resource non2pl list and free it */
-      lock_remove_non2pl (curr, tran_index);
-
-      curr = next;
+      lock_mode = entry_ptr->granted_mode;
+      if (lock_mode == X_LOCK || lock_mode == IX_LOCK || lock_mode == SIX_LOCK || lock_mode == SCH_M_LOCK)
+	{
+	  pthread_mutex_unlock (&tran_lock->hold_mutex);
+	  return true;
+	}
+      entry_ptr = entry_ptr->tran_next;
     }
 
-  return;
+  /* 3. checking instance locks is not needed. According to MGL ptotocol, an exclusive class lock has been acquired
+   * with intention mode before an exclusive instance is acquired. */
+
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+  return false;
 #endif /* !SERVER_MODE */
 }
 
+#if defined(ENABLE_UNUSED_FUNCTION)
 /*
- * lock_check_local_deadlock_detection - Check local deadlock detection interval
+ * lock_has_lock_transaction - Does transaction have any lock on any resource ?
  *
  * return:
  *
- * Note:check if the local deadlock detection should be performed.
+ *   tran_index(in):
+ *
+ * Note:Find if given transaction has any kind of lock.
+ *     Used by css_check_for_clients_down() to eliminate needless pinging.
  */
 bool
-lock_check_local_deadlock_detection (void)
+lock_has_lock_transaction (int tran_index)
 {
 #if !defined (SERVER_MODE)
-  return false;
+  return lk_Standalone_has_xlock;
 #else /* !SERVER_MODE */
-  struct timeval now, elapsed;
-  double elapsed_sec;
+  LK_TRAN_LOCK *tran_lock;
+  bool lock_hold;
+  int rv;
 
-  /* check deadlock detection interval */
-  gettimeofday (&now, NULL);
-  DIFF_TIMEVAL (lk_Gl.last_deadlock_run, now, elapsed);
-  /* add 0.01 for the processing time by deadlock detection */
-  elapsed_sec = elapsed.tv_sec + (elapsed.tv_usec / 1000) + 0.01;
-  if (elapsed_sec <= prm_get_float_value (PRM_ID_LK_RUN_DEADLOCK_INTERVAL))
+  tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  if (tran_lock->root_class_hold != NULL || tran_lock->class_hold_list != NULL || tran_lock->inst_hold_list != NULL
+      || tran_lock->non2pl_list != NULL)
     {
-      return false;
+      lock_hold = true;
     }
   else
     {
-      return true;
+      lock_hold = false;
     }
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  return lock_hold;
 #endif /* !SERVER_MODE */
 }
+#endif
 
 /*
- * lock_detect_local_deadlock - Run the local deadlock detection
- *
- * return: nothing
+ * lock_is_waiting_transaction -
  *
- * Note:Run the deadlock detection. For every cycle either timeout or
- *     abort a transaction. The timeout option is always preferred over
- *     the unilaterally abort option. When the unilaterally abort option
- *     is exercised, the youngest transaction in the cycle is selected.
- *     The youngest transaction is hopefully the one that has done less work.
+ * return:
  *
- *     First, allocate heaps for WFG table from local memory.
- *     Check whether deadlock(s) have been occurred or not.
+ *   tran_index(in):
+ */
+bool
+lock_is_waiting_transaction (int tran_index)
+{
+#if !defined (SERVER_MODE)
+  return false;
+#else /* !SERVER_MODE */
+  THREAD_ENTRY *thrd_array[10];
+  int thrd_count, i;
+  THREAD_ENTRY *thrd_ptr;
+
+  thrd_count = thread_get_lockwait_entry (tran_index, &thrd_array[0]);
+  for (i = 0; i < thrd_count; i++)
+    {
+      thrd_ptr = thrd_array[i];
+      (void) thread_lock_entry (thrd_ptr);
+      if (LK_IS_LOCKWAIT_THREAD (thrd_ptr))
+	{
+	  (void) thread_unlock_entry (thrd_ptr);
+	  return true;
+	}
+      else
+	{
+	  if (thrd_ptr->lockwait != NULL || thrd_ptr->lockwait_state == (int) LOCK_SUSPENDED)
+	    {
+	      /* some strange lock wait state.. */
+	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd_ptr->lockwait,
+		      thrd_ptr->lockwait_state, thrd_ptr->index, thrd_ptr->tid, thrd_ptr->tran_index);
+	    }
+	}
+      (void) thread_unlock_entry (thrd_ptr);
+    }
+
+  return false;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * lock_get_class_lock - Get a pointer to lock heap entry acquired by
+ *                        given transaction on given class object
  *
- *     Deadlock detection is peformed via exhaustive loop construction
- *     which indicates the wait-for-relationship.
- *     If deadlock is detected,
- *     the first transaction which enables a cycle
- *     when scanning from the first of object lock table to the last of it.
+ * return:
  *
- *     The deadlock of victims are waken up and aborted by themselves.
+ *   class_oid(in): target class object identifier
+ *   tran_index(in): target transaction
  *
- *     Last, free WFG framework.
+ * Note:This function finds lock entry acquired by the given transaction
+ *     on the given class and then return a pointer to the lock entry.
  */
-void
-lock_detect_local_deadlock (THREAD_ENTRY * thread_p)
+LK_ENTRY *
+lock_get_class_lock (const OID * class_oid, int tran_index)
 {
 #if !defined (SERVER_MODE)
-  return;
-#else /* !SERVER_MODE */
-  LF_HASH_TABLE_ITERATOR iterator;
-  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_RES);
-  int k, s, t;
-  LK_RES *res_ptr;
-  LK_ENTRY *hi, *hj;
-  LK_WFG_NODE *TWFG_node;
-  LK_WFG_EDGE *TWFG_edge;
-  int i, rv;
-  int compat1, compat2;
-  int tran_index;
-  FILE *log_fp;
+  assert (false);
 
-  /* initialize deadlock detection related structures */
+  return NULL;
+#else /* !SERVER_MODE */
+  LK_TRAN_LOCK *tran_lock;
+  LK_ENTRY *entry_ptr;
+  int rv;
 
-  /* initialize transaction WFG node table.. The current transaction might be old deadlock victim. And, the transaction 
-   * may have not been aborted, until now. Even if the transaction(old deadlock victim) has not been aborted, set
-   * checked_by_deadlock_detector of the transaction to true. */
-  for (i = 1; i < lk_Gl.num_trans; i++)
+  if (class_oid == NULL)
     {
-      lk_Gl.TWFG_node[i].first_edge = -1;
-      lk_Gl.TWFG_node[i].tran_edge_seq_num = 0;
-      lk_Gl.TWFG_node[i].checked_by_deadlock_detector = true;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_class_lock_ptr",
+	      "NULL ClassOID pointer");
+      return NULL;
     }
-
-  /* initialize transaction WFG edge table */
-  lk_Gl.TWFG_edge = &TWFG_edge_block[0];
-  lk_Gl.max_TWFG_edge = LK_MIN_TWFG_EDGE_COUNT;	/* initial value */
-  for (i = 0; i < LK_MIN_TWFG_EDGE_COUNT; i++)
+  if (OID_ISNULL (class_oid))
     {
-      lk_Gl.TWFG_edge[i].to_tran_index = -1;
-      lk_Gl.TWFG_edge[i].next = (i + 1);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_BAD_ARGUMENT, 2, "lk_get_class_lock_ptr", "NULL_ClassOID");
+      return NULL;
     }
-  lk_Gl.TWFG_edge[lk_Gl.max_TWFG_edge - 1].next = -1;
-  lk_Gl.TWFG_free_edge_idx = 0;
-
-  /* initialize global_edge_seq_num */
-  lk_Gl.global_edge_seq_num = 0;
-
-  /* initialize victim count */
-  victim_count = 0;		/* used as index of victims array */
-
-  /* hold the deadlock detection mutex */
-  rv = pthread_mutex_lock (&lk_Gl.DL_detection_mutex);
 
-  lf_hash_create_iterator (&iterator, t_entry, &lk_Gl.obj_hash_table);
-  res_ptr = lf_hash_iterate (&iterator);
+  /* get a pointer to transaction lock info entry */
+  tran_lock = &lk_Gl.tran_lock_table[tran_index];
 
-  for (; res_ptr != NULL; res_ptr = lf_hash_iterate (&iterator))
+  /* case 1: root class lock */
+  if (OID_EQ (class_oid, oid_Root_class_oid))
     {
-      /* holding resource mutex */
-      if (res_ptr->holder == NULL)
-	{
-	  if (res_ptr->waiter == NULL)
-	    {
-	      continue;
-	    }
-	  else
-	    {
-#if defined(CUBRID_DEBUG)
-	      FILE *lk_fp;
-	      time_t cur_time;
-	      char time_val[CTIME_MAX];
-
-	      lk_fp = fopen ("lock_waiter_only_info.log", "a");
-	      if (lk_fp != NULL)
-		{
-		  cur_time = time (NULL);
-		  (void) ctime_r (&cur_time, time_val);
-		  fprintf (lk_fp, "##########################################\n");
-		  fprintf (lk_fp, "# current time: %s\n", time_val);
-		  lock_dump_resource (lk_fp, res_ptr);
-		  fprintf (lk_fp, "##########################################\n");
-		  fclose (lk_fp);
-		}
-#endif /* CUBRID_DEBUG */
-	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_LOCK_WAITER_ONLY, 1, "lock_waiter_only_info.log");
-
-	      if (res_ptr->total_holders_mode != NULL_LOCK)
-		{
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_TOTAL_HOLDERS_MODE, 1, res_ptr->total_holders_mode);
-		  res_ptr->total_holders_mode = NULL_LOCK;
-		}
-	      (void) lock_grant_blocked_waiter (thread_p, res_ptr);
-	    }
-	}
-
-      /* among holders */
-      for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
-	{
-	  if (hi->blocked_mode == NULL_LOCK)
-	    {
-	      break;
-	    }
-	  for (hj = hi->next; hj != NULL; hj = hj->next)
-	    {
-	      assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
-	      assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
+      rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+      entry_ptr = tran_lock->root_class_hold;
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+    }
+  else
+    {
+      entry_ptr = lock_find_tran_hold_entry (tran_index, class_oid, true);
+    }
 
-	      compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
-	      compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
-	      assert (compat1 != DB_NA && compat2 != DB_NA);
+  return entry_ptr;
+#endif /* !SERVER_MODE */
+}
 
-	      if (compat1 == false || compat2 == false)
-		{
-		  (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
-		}
+/*
+ * lock_force_timeout_lock_wait_transactions - All lock-wait transactions
+ *                               are forced to timeout
+ *
+ * return: nothing
+ *
+ * Note:All lock-waiting transacions are forced to timeout.
+ *     For this task, all lock-waiting threads are searched and
+ *     then the threads are forced to timeout.
+ */
+void
+lock_force_timeout_lock_wait_transactions (unsigned short stop_phase)
+{
+#if !defined (SERVER_MODE)
+  return;
+#else /* !SERVER_MODE */
+  int i;
+  THREAD_ENTRY *thrd;
+  CSS_CONN_ENTRY *conn_p;
 
-	      compat1 = lock_Comp[hi->blocked_mode][hj->granted_mode];
-	      assert (compat1 != DB_NA);
+  for (i = 1; i < thread_num_total_threads (); i++)
+    {
+      thrd = thread_find_entry_by_index (i);
 
-	      if (compat1 == false)
-		{
-		  (void) lock_add_WFG_edge (hi->tran_index, hj->tran_index, true, hi->thrd_entry->lockwait_stime);
-		}
-	    }
+      conn_p = thrd->conn_entry;
+      if ((stop_phase == THREAD_STOP_LOGWR && conn_p == NULL) || (conn_p && conn_p->stop_phase != stop_phase))
+	{
+	  continue;
 	}
 
-      /* from waiters in the waiter to holders */
-      for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
+      (void) thread_lock_entry (thrd);
+      if (LK_IS_LOCKWAIT_THREAD (thrd))
 	{
-	  for (hj = res_ptr->waiter; hj != NULL; hj = hj->next)
-	    {
-	      assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
-	      assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
-
-	      compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
-	      compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
-	      assert (compat1 != DB_NA && compat2 != DB_NA);
-
-	      if (compat1 == false || compat2 == false)
-		{
-		  (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
-		}
-	    }
+	  /* wake up the thread */
+	  lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_TIMEOUT);
 	}
-
-      /* from waiters in the waiter to other waiters in the waiter */
-      for (hi = res_ptr->waiter; hi != NULL; hi = hi->next)
+      else
 	{
-	  for (hj = hi->next; hj != NULL; hj = hj->next)
+	  if (thrd->lockwait != NULL || thrd->lockwait_state == (int) LOCK_SUSPENDED)
 	    {
-	      assert (hj->blocked_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
-
-	      compat1 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
-	      assert (compat1 != DB_NA);
-
-	      if (compat1 == false)
-		{
-		  (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, false, hj->thrd_entry->lockwait_stime);
-		}
+	      /* some strange lock wait state.. */
+	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd->lockwait,
+		      thrd->lockwait_state, thrd->index, thrd->tid, thrd->tran_index);
 	    }
+	  /* release the thread entry mutex */
+	  (void) thread_unlock_entry (thrd);
 	}
     }
+  return;
+#endif /* !SERVER_MODE */
+}
 
-  /* release DL detection mutex */
-  pthread_mutex_unlock (&lk_Gl.DL_detection_mutex);
-
-  /* simple notation for using in the following statements */
-  TWFG_node = lk_Gl.TWFG_node;
-  TWFG_edge = lk_Gl.TWFG_edge;
-
-  /* 
-   * deadlock detection and victim selection
-   */
+/*
+ * lock_force_timeout_expired_wait_transactions - Transaction is timeout if its waiting time has
+ *                           expired or it is interrupted
+ *
+ * return: true if the thread was timed out or
+ *                       false if the thread was not timed out.
+ *
+ *   thrd_entry(in): thread entry pointer
+ *
+ * Note:If the given thread is waiting on a lock to be granted, and
+ *     either its expiration time has expired or it is interrupted,
+ *     the thread is timed-out.
+ *     If NULL is given, it applies to all threads.
+ */
+bool
+lock_force_timeout_expired_wait_transactions (void *thrd_entry)
+{
+#if !defined (SERVER_MODE)
+  return true;
+#else /* !SERVER_MODE */
+  int i;
+  bool ignore;
+  THREAD_ENTRY *thrd;
 
-  for (k = 1; k < lk_Gl.num_trans; k++)
-    {
-      TWFG_node[k].current = TWFG_node[k].first_edge;
-      TWFG_node[k].ancestor = -1;
-    }
-  for (k = 1; k < lk_Gl.num_trans; k++)
+  if (thrd_entry != NULL)
     {
-      if (TWFG_node[k].current == -1)
-	{
-	  continue;
-	}
-      s = k;
-      TWFG_node[s].ancestor = -2;
-      for (; s != -2;)
+      thrd = (THREAD_ENTRY *) thrd_entry;
+      (void) thread_lock_entry (thrd);
+      if (LK_IS_LOCKWAIT_THREAD (thrd))
 	{
-	  if (TWFG_node[s].checked_by_deadlock_detector == false || TWFG_node[s].thrd_wait_stime == 0
-	      || (TWFG_node[s].current != -1
-		  && (TWFG_node[s].thrd_wait_stime > TWFG_edge[TWFG_node[s].current].edge_wait_stime)))
+	  struct timeval tv;
+	  INT64 etime;
+	  (void) gettimeofday (&tv, NULL);
+	  etime = (tv.tv_sec * 1000000LL + tv.tv_usec) / 1000LL;
+	  if (LK_CAN_TIMEOUT (thrd->lockwait_msecs) && etime - thrd->lockwait_stime > thrd->lockwait_msecs)
 	    {
-	      /* A new transaction started */
-	      TWFG_node[s].first_edge = -1;
-	      TWFG_node[s].current = -1;
+	      /* wake up the thread */
+	      lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_TIMEOUT);
+	      return true;
 	    }
-
-	  if (TWFG_node[s].current == -1)
+	  else if (logtb_is_interrupted_tran (NULL, true, &ignore, thrd->tran_index))
 	    {
-	      t = TWFG_node[s].ancestor;
-	      TWFG_node[s].ancestor = -1;
-	      s = t;
-	      if (s != -2 && TWFG_node[s].current != -1)
-		{
-		  assert_release (TWFG_node[s].current >= 0 && TWFG_node[s].current < lk_Gl.max_TWFG_edge);
-		  TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
-		}
-	      continue;
-	    }
-
-	  assert_release (TWFG_node[s].current >= 0 && TWFG_node[s].current < lk_Gl.max_TWFG_edge);
-
-	  t = TWFG_edge[TWFG_node[s].current].to_tran_index;
-
-	  if (t == -2)
-	    {			/* old WFG edge */
-	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
-	      continue;
+	      /* wake up the thread */
+	      lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_INTERRUPT);
+	      return true;
 	    }
-
-	  if (TWFG_node[t].current == -1)
+	  else
 	    {
-	      TWFG_edge[TWFG_node[s].current].to_tran_index = -2;
-	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
-	      continue;
+	      /* release the thread entry mutex */
+	      (void) thread_unlock_entry (thrd);
+	      return false;
 	    }
-
-	  if (TWFG_node[t].checked_by_deadlock_detector == false || TWFG_node[t].thrd_wait_stime == 0
-	      || TWFG_node[t].thrd_wait_stime > TWFG_edge[TWFG_node[t].current].edge_wait_stime)
+	}
+      else
+	{
+	  if (thrd->lockwait != NULL || thrd->lockwait_state == (int) LOCK_SUSPENDED)
 	    {
-	      TWFG_node[t].first_edge = -1;
-	      TWFG_node[t].current = -1;
-	      TWFG_edge[TWFG_node[s].current].to_tran_index = -2;
-	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
-	      continue;
-	    }
-
-	  if (TWFG_edge[TWFG_node[s].current].edge_seq_num < TWFG_node[t].tran_edge_seq_num)
-	    {			/* old WFG edge */
-	      TWFG_edge[TWFG_node[s].current].to_tran_index = -2;
-	      TWFG_node[s].current = TWFG_edge[TWFG_node[s].current].next;
-	      continue;
+	      /* some strange lock wait state.. */
+	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd->lockwait,
+		      thrd->lockwait_state, thrd->index, thrd->tid, thrd->tran_index);
 	    }
-
-	  if (TWFG_node[t].ancestor != -1)
+	  /* release the thread entry mutex */
+	  (void) thread_unlock_entry (thrd);
+	  return false;
+	}
+    }
+  else
+    {
+      for (i = 1; i < thread_num_total_threads (); i++)
+	{
+	  thrd = thread_find_entry_by_index (i);
+	  (void) thread_lock_entry (thrd);
+	  if (LK_IS_LOCKWAIT_THREAD (thrd))
 	    {
-	      /* A deadlock cycle is found */
-	      lock_select_deadlock_victim (thread_p, s, t);
-	      if (victim_count >= LK_MAX_VICTIM_COUNT)
+	      struct timeval tv;
+	      INT64 etime;
+	      (void) gettimeofday (&tv, NULL);
+	      etime = (tv.tv_sec * 1000000LL + tv.tv_usec) / 1000LL;
+	      if ((LK_CAN_TIMEOUT (thrd->lockwait_msecs) && etime - thrd->lockwait_stime > thrd->lockwait_msecs)
+		  || logtb_is_interrupted_tran (NULL, true, &ignore, thrd->tran_index))
 		{
-		  goto final;
+		  /* wake up the thread */
+		  lock_resume ((LK_ENTRY *) thrd->lockwait, LOCK_RESUMED_TIMEOUT);
+		}
+	      else
+		{
+		  /* release the thread entry mutex */
+		  (void) thread_unlock_entry (thrd);
 		}
 	    }
 	  else
 	    {
-	      TWFG_node[t].ancestor = s;
-	      TWFG_node[t].candidate = TWFG_edge[TWFG_node[s].current].holder_flag;
+	      if (thrd->lockwait != NULL || thrd->lockwait_state == (int) LOCK_SUSPENDED)
+		{
+		  /* some strange lock wait state.. */
+		  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_STRANGE_LOCK_WAIT, 5, thrd->lockwait,
+			  thrd->lockwait_state, thrd->index, thrd->tid, thrd->tran_index);
+		}
+	      /* release the thread entry mutex */
+	      (void) thread_unlock_entry (thrd);
 	    }
-	  s = t;
 	}
+      return true;
     }
+#endif /* !SERVER_MODE */
+}
 
-final:
-
-#if defined(ENABLE_SYSTEMTAP)
-  if (victim_count > 0)
-    {
-      CUBRID_TRAN_DEADLOCK ();
-    }
-#endif /* ENABLE_SYSTEMTAP */
-
-#if defined(SERVER_MODE) && defined(DIAG_DEVEL)
-  if (victim_count > 0)
-    {
-      SET_DIAG_VALUE (diag_executediag, DIAG_OBJ_TYPE_LOCK_DEADLOCK, 1, DIAG_VAL_SETTYPE_INC, NULL);
-#if 0				/* ACTIVITY PROFILE */
-      ADD_ACTIVITY_DATA (diag_executediag, DIAG_EVENTCLASS_TYPE_SERVER_LOCK_DEADLOCK, "", "", victim_count);
-#endif
-    }
-#endif /* SERVER_MODE && DIAG_DEVEL */
-
-#if defined (ENABLE_UNUSED_FUNCTION)
-  if (victim_count > 0)
-    {
-      size_t size_loc;
-      char *ptr;
-      FILE *fp = port_open_memstream (&ptr, &size_loc);
-
-      if (fp)
-	{
-	  lock_dump_deadlock_victims (thread_p, fp);
-	  port_close_memstream (fp, &ptr, &size_loc);
-
-	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LK_DEADLOCK_SPECIFIC_INFO, 1, ptr);
+/*
+ * lock_notify_isolation_incons - Notify of possible inconsistencies (no
+ *                             repeatable reads) due to transaction isolation
+ *                             level
+ *
+ * return: nothing.
+ *
+ *   fun(in): Function to notify
+ *   args(in): Extra arguments for function
+ *
+ * Note:The current transaction is notified of any possible
+ *              inconsistencies due to its isolation level. For each possible
+ *              inconsistency the given function is called to decache any
+ *              copies of the object.
+ */
+void
+lock_notify_isolation_incons (THREAD_ENTRY * thread_p, bool (*fun) (const OID * class_oid, const OID * oid, void *args),
+			      void *args)
+{
+#if !defined (SERVER_MODE)
+  return;
+#else /* !SERVER_MODE */
+  TRAN_ISOLATION isolation;
+  int tran_index;
+  LK_TRAN_LOCK *tran_lock;
+  LK_ENTRY *curr, *prev, *next;
+  LK_ENTRY *incon_non2pl_list_header = NULL;
+  LK_ENTRY *incon_non2pl_list_tail = NULL;
+  bool ret_val;
+  int rv;
 
-	  if (ptr != NULL)
-	    {
-	      free (ptr);
-	    }
-	}
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  isolation = logtb_find_isolation (tran_index);
+  if (isolation == TRAN_REPEATABLE_READ || isolation == TRAN_SERIALIZABLE)
+    {
+      return;			/* Nothing was released */
     }
-#endif /* ENABLE_UNUSED_FUNCTION */
 
-  /* dump deadlock cycle to event log file */
-  for (k = 0; k < victim_count; k++)
+  tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  rv = pthread_mutex_lock (&tran_lock->non2pl_mutex);
+
+  prev = NULL;
+  curr = tran_lock->non2pl_list;
+  while (tran_lock->num_incons_non2pl > 0 && curr != NULL)
     {
-      if (victims[k].tran_index_in_cycle == NULL)
+      if (curr->granted_mode != INCON_NON_TWO_PHASE_LOCK)
 	{
+	  prev = curr;
+	  curr = curr->tran_next;
 	  continue;
 	}
 
-      log_fp = event_log_start (thread_p, "DEADLOCK");
-      if (log_fp != NULL)
+      /* curr->granted_mode == INCON_NON_TWO_PHASE_LOCK */
+      assert (curr->res_head->key.type != LOCK_RESOURCE_INSTANCE || !OID_ISNULL (&curr->res_head->key.class_oid));
+
+      ret_val = (*fun) (&curr->res_head->key.class_oid, &curr->res_head->key.oid, args);
+      if (ret_val != true)
 	{
-	  for (i = 0; i < victims[k].num_trans_in_cycle; i++)
-	    {
-	      tran_index = victims[k].tran_index_in_cycle[i];
-	      event_log_print_client_info (tran_index, 0);
-	      lock_event_log_tran_locks (thread_p, log_fp, tran_index);
-	    }
+	  /* the notification area is full */
+	  pthread_mutex_unlock (&(tran_lock->non2pl_mutex));
 
-	  event_log_end (thread_p);
+	  goto end;
 	}
 
-      free_and_init (victims[k].tran_index_in_cycle);
-    }
+      /* the non-2pl entry should be freed. */
+      /* 1. remove it from transaction non2pl list */
+      next = curr->tran_next;
+      if (prev == NULL)
+	{
+	  tran_lock->non2pl_list = next;
+	}
+      else
+	{
+	  prev->tran_next = next;
+	}
 
-  /* Now solve the deadlocks (cycles) by executing the cycle resolution function (e.g., aborting victim) */
-  for (k = 0; k < victim_count; k++)
-    {
-      if (victims[k].can_timeout)
+      tran_lock->num_incons_non2pl -= 1;
+
+      /* 2. append current entry to incon_non2pl_list */
+      curr->tran_next = NULL;
+      if (incon_non2pl_list_header == NULL)
 	{
-	  (void) lock_wakeup_deadlock_victim_timeout (victims[k].tran_index);
+	  incon_non2pl_list_header = curr;
+	  incon_non2pl_list_tail = curr;
 	}
       else
 	{
-	  (void) lock_wakeup_deadlock_victim_aborted (victims[k].tran_index);
+	  incon_non2pl_list_tail->tran_next = curr;
+	  incon_non2pl_list_tail = curr;
 	}
+
+      curr = next;
     }
 
-  /* deallocate memory space used for deadlock detection */
-  if (lk_Gl.max_TWFG_edge > LK_MID_TWFG_EDGE_COUNT)
+  /* release transaction non2pl mutex */
+  pthread_mutex_unlock (&tran_lock->non2pl_mutex);
+
+end:
+
+  curr = incon_non2pl_list_header;
+  while (curr != NULL)
     {
-      free_and_init (lk_Gl.TWFG_edge);
+      next = curr->tran_next;
+
+      /* remove it from resource non2pl list and free it */
+      lock_remove_non2pl (curr, tran_index);
+
+      curr = next;
+    }
+
+  return;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * lock_check_local_deadlock_detection - Check local deadlock detection interval
+ *
+ * return:
+ *
+ * Note:check if the local (full) deadlock detection should be performed. New waiters are searched incrementally by
+ *     lock_detect_local_deadlock_of_new_waiters, so the full scan only runs periodically, or as soon as an
+ *     incremental search could not complete.
+ */
+bool
+lock_check_local_deadlock_detection (void)
+{
+#if !defined (SERVER_MODE)
+  return false;
+#else /* !SERVER_MODE */
+  struct timeval now, elapsed;
+  double elapsed_sec;
+
+  if (lk_Gl.need_full_deadlock_scan)
+    {
+      return true;
+    }
+
+  /* check deadlock detection interval */
+  gettimeofday (&now, NULL);
+  DIFF_TIMEVAL (lk_Gl.last_deadlock_run, now, elapsed);
+  /* add 0.01 for the processing time by deadlock detection */
+  elapsed_sec = elapsed.tv_sec + (elapsed.tv_usec / 1000000.0) + 0.01;
+  if (elapsed_sec <= prm_get_float_value (PRM_ID_LK_RUN_DEADLOCK_INTERVAL))
+    {
+      return false;
+    }
+  else
+    {
+      return true;
     }
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * lock_detect_local_deadlock - Run the local deadlock detection
+ *
+ * return: nothing
+ *
+ * Note:Run the deadlock detection. For every cycle either timeout or
+ *     abort a transaction. The timeout option is always preferred over
+ *     the unilaterally abort option. When the unilaterally abort option
+ *     is exercised, the youngest transaction in the cycle is selected.
+ *     The youngest transaction is hopefully the one that has done less work.
+ *
+ *     First, allocate heaps for WFG table from local memory.
+ *     Check whether deadlock(s) have been occurred or not.
+ *
+ *     Deadlock detection is peformed via exhaustive loop construction
+ *     which indicates the wait-for-relationship.
+ *     If deadlock is detected,
+ *     the first transaction which enables a cycle
+ *     when scanning from the first of object lock table to the last of it.
+ *
+ *     The deadlock of victims are waken up and aborted by themselves.
+ *
+ *     Last, free WFG framework.
+ */
+void
+lock_detect_local_deadlock (THREAD_ENTRY * thread_p)
+{
+#if !defined (SERVER_MODE)
+  return;
+#else /* !SERVER_MODE */
+  LF_HASH_TABLE_ITERATOR iterator;
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_RES);
+  LK_RES *res_ptr;
+  int rv;
+
+  /* a full scan covers every inconclusive incremental search */
+  lk_Gl.need_full_deadlock_scan = false;
+
+  lock_initialize_WFG ();
+
+  /* hold the deadlock detection mutex */
+  rv = pthread_mutex_lock (&lk_Gl.DL_detection_mutex);
+
+  lf_hash_create_iterator (&iterator, t_entry, &lk_Gl.obj_hash_table);
+  res_ptr = lf_hash_iterate (&iterator);
+
+  for (; res_ptr != NULL; res_ptr = lf_hash_iterate (&iterator))
+    {
+      /* holding resource mutex */
+      lock_add_WFG_edges_of_resource (thread_p, res_ptr);
+    }
+
+  /* release DL detection mutex */
+  pthread_mutex_unlock (&lk_Gl.DL_detection_mutex);
+
+  lock_resolve_WFG_cycles (thread_p);
 
   if (victim_count == 0)
     {
@@ -8117,6 +8829,131 @@ final:
 #endif /* !SERVER_MODE */
 }
 
+/*
+ * lock_has_new_lock_waiters - Check whether some thread was suspended on a lock since the last incremental
+ *                             deadlock detection
+ *
+ * return: true if lock_detect_local_deadlock_of_new_waiters has work to do
+ */
+bool
+lock_has_new_lock_waiters (void)
+{
+#if !defined (SERVER_MODE)
+  return false;
+#else /* !SERVER_MODE */
+  return lk_Gl.num_new_lock_waiters > 0;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * lock_detect_local_deadlock_of_new_waiters - Run the deadlock detection incrementally, from the new lock waiters
+ *
+ * return: nothing
+ *
+ * Note:Instead of building the wait-for graph of the whole lock table, a bounded search follows the wait-for edges
+ *     of each transaction suspended since the last run. Only the resources of the cycles it finds are put in the
+ *     wait-for graph, whose cycles are then resolved like in lock_detect_local_deadlock. A cycle is always closed by
+ *     a suspension, so the search from the last waiter finds it; searches that hit a bound request a full scan.
+ */
+void
+lock_detect_local_deadlock_of_new_waiters (THREAD_ENTRY * thread_p)
+{
+#if !defined (SERVER_MODE)
+  return;
+#else /* !SERVER_MODE */
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_RES);
+  LK_DEADLOCK_SEARCH search;
+  THREAD_ENTRY *thrd;
+  LK_RES *res_ptr;
+  INT64 wait_stime;
+  int thrd_index, tran_index;
+  int i, k, rv;
+
+  (void) ATOMIC_TAS_32 (&lk_Gl.num_new_lock_waiters, 0);
+  deadlock_suspect_res_count = 0;
+
+  for (thrd = thread_find_first_lockwait_entry (&thrd_index); thrd != NULL;
+       thrd = thread_find_next_lockwait_entry (&thrd_index))
+    {
+      (void) thread_lock_entry (thrd);
+      if (!LK_IS_LOCKWAIT_THREAD (thrd))
+	{
+	  (void) thread_unlock_entry (thrd);
+	  continue;
+	}
+      tran_index = thrd->tran_index;
+      wait_stime = thrd->lockwait_stime;
+      (void) thread_unlock_entry (thrd);
+
+      if (lk_Gl.TWFG_node[tran_index].searched_wait_stime == wait_stime)
+	{
+	  /* searched by an earlier run */
+	  continue;
+	}
+      lk_Gl.TWFG_node[tran_index].searched_wait_stime = wait_stime;
+
+      search.origin_tran_index = tran_index;
+      search.num_steps = 0;
+      search.num_visited = 1;
+      search.visited_tran_index[0] = tran_index;
+      search.path_length = 0;
+      search.is_truncated = false;
+
+      if (lock_search_deadlock_cycle (thread_p, &search, tran_index, 0))
+	{
+	  /* remember the resources of the cycle */
+	  for (i = 0; i < search.path_length; i++)
+	    {
+	      for (k = 0; k < deadlock_suspect_res_count; k++)
+		{
+		  if (OID_EQ (&deadlock_suspect_res_keys[k].oid, &search.path[i].oid))
+		    {
+		      break;
+		    }
+		}
+	      if (k < deadlock_suspect_res_count)
+		{
+		  continue;
+		}
+	      if (deadlock_suspect_res_count >= LK_MAX_DEADLOCK_SUSPECT_RES)
+		{
+		  search.is_truncated = true;
+		  break;
+		}
+	      deadlock_suspect_res_keys[deadlock_suspect_res_count++] = search.path[i];
+	    }
+	}
+      if (search.is_truncated)
+	{
+	  lk_Gl.need_full_deadlock_scan = true;
+	}
+    }
+
+  if (deadlock_suspect_res_count == 0)
+    {
+      return;
+    }
+
+  /* build the wait-for graph of the suspected resources only */
+  lock_initialize_WFG ();
+
+  rv = pthread_mutex_lock (&lk_Gl.DL_detection_mutex);
+  for (k = 0; k < deadlock_suspect_res_count; k++)
+    {
+      if (lf_hash_find (t_entry, &lk_Gl.obj_hash_table, (void *) &deadlock_suspect_res_keys[k], (void **) &res_ptr)
+	  != NO_ERROR || res_ptr == NULL)
+	{
+	  continue;
+	}
+      lock_add_WFG_edges_of_resource (thread_p, res_ptr);
+      pthread_mutex_unlock (&res_ptr->res_mutex);
+    }
+  pthread_mutex_unlock (&lk_Gl.DL_detection_mutex);
+
+  lock_resolve_WFG_cycles (thread_p);
+#endif /* !SERVER_MODE */
+}
+
 #if 0				/* NOT_USED */
 /*
  */
@@ -8606,6 +9443,8 @@ xlock_dump (THREAD_ENTRY * thread_p, FILE * outfp)
   res_ptr = lf_hash_iterate (&iterator);
   for (; res_ptr != NULL; res_ptr = lf_hash_iterate (&iterator))
     {
+      /* fast path holders are listed only after being moved to the holder list */
+      lock_fastpath_transfer (thread_p, res_ptr);
       lock_dump_resource (thread_p, outfp, res_ptr);
     }
 
@@ -98,6 +98,7 @@ struct lk_entry
   int instant_lock_count;	/* number of instant lock requests */
   int bind_index_in_tran;
   XASL_ID xasl_id;
+  bool is_fastpath;		/* granted without the resource mutex; not linked in the holder list */
 #else				/* not SERVER_MODE */
   int dummy;
 #endif				/* not SERVER_MODE */
@@ -183,6 +184,7 @@ struct lk_res
   LK_ENTRY *holder;		/* lock holder list */
   LK_ENTRY *waiter;		/* lock waiter list */
   LK_ENTRY *non2pl;		/* non2pl list */
+  volatile INT32 fastpath_state;	/* count of fast path intention holders and disabled flag */
   pthread_mutex_t res_mutex;	/* resource mutex */
   LK_RES *hash_next;		/* for hash chain */
   LK_RES *stack;		/* for freelist */
@@ -224,6 +226,8 @@ extern void lock_notify_isolation_incons (THREAD_ENTRY * thread_p,
 					  bool (*fun) (const OID * class_oid, const OID * oid, void *args), void *args);
 extern bool lock_check_local_deadlock_detection (void);
 extern void lock_detect_local_deadlock (THREAD_ENTRY * thread_p);
+extern bool lock_has_new_lock_waiters (void);
+extern void lock_detect_local_deadlock_of_new_waiters (THREAD_ENTRY * thread_p);
 extern int lock_reacquire_crash_locks (THREAD_ENTRY * thread_p, LK_ACQUIRED_LOCKS * acqlocks, int tran_index);
 extern void lock_unlock_all_shared_get_all_exclusive (THREAD_ENTRY * thread_p, LK_ACQUIRED_LOCKS * acqlocks);
 extern void lock_dump_acquired (FILE * fp, LK_ACQUIRED_LOCKS * acqlocks);
@@ -864,10 +864,13 @@ struct mvcc_trans_status
 
   /* lowest active MVCCID */
   MVCCID lowest_active_mvccid;
+
+  /* highest completed MVCCID - all MVCCIDs following it are active */
+  MVCCID highest_completed_mvccid;
 };
 
 #define MVCC_STATUS_INITIALIZER \
-  { NULL, MVCCID_FIRST, 0, NULL, 0, 0, MVCCID_FIRST }
+  { NULL, MVCCID_FIRST, 0, NULL, 0, 0, MVCCID_FIRST, MVCCID_FIRST - 1 }
 
 typedef struct mvcctable MVCCTABLE;
 struct mvcctable
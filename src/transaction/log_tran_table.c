@@ -160,8 +160,10 @@ static void logtb_finalize_mvcctable (THREAD_ENTRY * thread_p);
 static void logtb_get_lowest_active_mvccid (UINT64 * bit_area, int bit_area_length, MVCCID bit_area_start_mvccid,
 					    MVCCID * long_tran_mvccids, unsigned int long_tran_mvccids_length,
 					    MVCCID * lowest_active_mvccid);
-static void logtb_get_highest_completed_mvccid (UINT64 * bit_area, int bit_area_length, MVCCID bit_area_start_mvccid,
-						MVCCID * highest_completed_mvccid);
+#if defined(HAVE_ATOMIC_BUILTINS)
+static void logtb_copy_trans_status (MVCC_TRANS_STATUS * dest, MVCC_TRANS_STATUS * src, MVCCID bit_area_start_mvccid,
+				     int bit_area_length);
+#endif
 static int logtb_get_mvcc_snapshot_data (THREAD_ENTRY * thread_p);
 
 static void logtb_tran_free_update_stats (LOG_TRAN_UPDATE_STATS * log_upd_stats);
@@ -1134,6 +1136,7 @@ logtb_initialize_mvcctable (void)
   current_trans_status->long_tran_mvccids_length = 0;
   current_trans_status->version = 0;
   current_trans_status->lowest_active_mvccid = MVCCID_FIRST;
+  current_trans_status->highest_completed_mvccid = MVCCID_FIRST - 1;
 
   mvcc_table->transaction_lowest_active_mvccids = (MVCCID *) malloc (size);
   if (mvcc_table->transaction_lowest_active_mvccids == NULL)
@@ -1189,6 +1192,7 @@ logtb_initialize_mvcctable (void)
       trans_status_history->long_tran_mvccids_length = 0;
       trans_status_history->version = 0;
       trans_status_history->lowest_active_mvccid = MVCCID_FIRST;
+      trans_status_history->highest_completed_mvccid = MVCCID_FIRST - 1;
     }
   mvcc_table->trans_status_history_position = 0;
 
@@ -4245,21 +4249,27 @@ start_get_mvcc_table:
        * Is important that between next two code lines to not have delays (to not execute any other code).
        * Otherwise, VACUUM may delay, waiting more in logtb_get_oldest_active_mvccid.
        */
-      lowest_active_mvccid = ATOMIC_INC_64 (&mvcc_table->current_trans_status.lowest_active_mvccid, 0LL);
+      lowest_active_mvccid = ATOMIC_LOAD_64 (&mvcc_table->current_trans_status.lowest_active_mvccid);
       ATOMIC_TAS_64 (p_transaction_lowest_active_mvccid, lowest_active_mvccid);
     }
   else
     {
-      lowest_active_mvccid = ATOMIC_INC_64 (&mvcc_table->current_trans_status.lowest_active_mvccid, 0LL);
+      lowest_active_mvccid = ATOMIC_LOAD_64 (&mvcc_table->current_trans_status.lowest_active_mvccid);
     }
 
-  index = ATOMIC_INC_32 (&mvcc_table->trans_status_history_position, 0);
+  /* 
+   * Snapshot readers only load from the published history entry; they never write to shared cache lines. The
+   * version is read before and after copying the data, with barriers, so that an entry recycled by a committer
+   * in the meantime is detected and the copy is retried.
+   */
+  index = ATOMIC_LOAD_32 (&mvcc_table->trans_status_history_position);
   assert (index < TRANS_STATUS_HISTORY_MAX_SIZE && index >= 0);
   trans_status = &mvcc_table->trans_status_history[index];
-  trans_status_version = ATOMIC_INC_32 (&trans_status->version, 0);
+  trans_status_version = ATOMIC_LOAD_32 (&trans_status->version);
+  MEMORY_BARRIER ();
 
-  bit_area_start_mvccid = ATOMIC_INC_64 (&trans_status->bit_area_start_mvccid, 0LL);
-  bit_area_length = ATOMIC_INC_32 (&trans_status->bit_area_length, 0);
+  bit_area_start_mvccid = ATOMIC_LOAD_64 (&trans_status->bit_area_start_mvccid);
+  bit_area_length = ATOMIC_LOAD_32 (&trans_status->bit_area_length);
 #else
   r = pthread_mutex_lock (&mvcc_table->active_trans_mutex);
   lowest_active_mvccid = mvcc_table->current_trans_status.lowest_active_mvccid;
@@ -4284,6 +4294,9 @@ start_get_mvcc_table:
 	      long_tran_mvccids_length * sizeof (MVCCID));
     }
 
+  /* precomputed by the committer that published this entry, no need to scan the bit area */
+  highest_completed_mvccid = trans_status->highest_completed_mvccid;
+
   /* load statistics temporary disabled need to be enabled when activate count optimization */
 #if 0
   /* load global statistics. This must take place here and no where else. */
@@ -4295,7 +4308,8 @@ start_get_mvcc_table:
 #endif
 
 #if defined(HAVE_ATOMIC_BUILTINS)
-  if (trans_status_version != ATOMIC_INC_32 (&trans_status->version, 0))
+  MEMORY_BARRIER ();
+  if (trans_status_version != ATOMIC_LOAD_32 (&trans_status->version))
     {
       /* The transaction status version overwritten, need to read again */
       goto start_get_mvcc_table;
@@ -4304,8 +4318,6 @@ start_get_mvcc_table:
   pthread_mutex_unlock (&mvcc_table->active_trans_mutex);
 #endif
 
-  logtb_get_highest_completed_mvccid (snapshot->bit_area, bit_area_length, bit_area_start_mvccid,
-				      &highest_completed_mvccid);
   MVCCID_FORWARD (highest_completed_mvccid);
 
   /* update lowest active mvccid computed for the most recent snapshot */
@@ -4894,6 +4906,10 @@ logtb_complete_mvcc (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool committed)
       mask = MVCC_BITAREA_MASK (position);
       p_area = MVCC_GET_BITAREA_ELEMENT_PTR (current_trans_status->bit_area, position);
       (*p_area) |= mask;
+      if (MVCC_ID_PRECEDES (current_trans_status->highest_completed_mvccid, mvccid))
+	{
+	  current_trans_status->highest_completed_mvccid = mvccid;
+	}
 
 #if defined(HAVE_ATOMIC_BUILTINS)
       bit_area_length = ATOMIC_INC_32 (&current_trans_status->bit_area_length, 0);
@@ -5031,24 +5047,8 @@ logtb_complete_mvcc (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool committed)
 #if defined(HAVE_ATOMIC_BUILTINS)
       /* need to copy the current bit area - other threads may read next_trans_status_history, but only the current
        * thread can modify it */
-      if (bit_area_length > 0)
-	{
-	  count = MVCC_BITAREA_BITS_TO_ELEMENTS (bit_area_length);
-	  for (i = 0; i < count; i++)
-	    {
-	      ATOMIC_TAS_64 (next_trans_status_history->bit_area + i, current_trans_status->bit_area[i]);
-	    }
-	}
-
-      ATOMIC_TAS_64 (&next_trans_status_history->bit_area_start_mvccid, bit_area_start_mvccid);
-      ATOMIC_TAS_32 (&next_trans_status_history->bit_area_length, bit_area_length);
-
-      count = current_trans_status->long_tran_mvccids_length;
-      for (i = 0; i < count; i++)
-	{
-	  ATOMIC_TAS_64 (next_trans_status_history->long_tran_mvccids + i, current_trans_status->long_tran_mvccids[i]);
-	}
-      ATOMIC_TAS_32 (&next_trans_status_history->long_tran_mvccids_length, count);
+      logtb_copy_trans_status (next_trans_status_history, current_trans_status, bit_area_start_mvccid,
+			       bit_area_length);
 
       if (committed)
 	{
@@ -5910,6 +5910,10 @@ logtb_complete_sub_mvcc (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
   mask = MVCC_BITAREA_MASK (position);
   p_area = MVCC_GET_BITAREA_ELEMENT_PTR (current_trans_status->bit_area, position);
   (*p_area) |= mask;
+  if (MVCC_ID_PRECEDES (current_trans_status->highest_completed_mvccid, mvcc_sub_id))
+    {
+      current_trans_status->highest_completed_mvccid = mvcc_sub_id;
+    }
 
 #if defined(HAVE_ATOMIC_BUILTINS)
   bit_area_length = ATOMIC_INC_32 (&current_trans_status->bit_area_length, 0);
@@ -6042,25 +6046,7 @@ end_completed:
 #if defined(HAVE_ATOMIC_BUILTINS)
   /* need to copy the current bit area - other threads may read next_trans_status_history, but only the current thread
    * can modify it */
-
-  if (bit_area_length > 0)
-    {
-      count = MVCC_BITAREA_BITS_TO_ELEMENTS (bit_area_length);
-      for (i = 0; i < count; i++)
-	{
-	  ATOMIC_TAS_64 (next_trans_status_history->bit_area + i, current_trans_status->bit_area[i]);
-	}
-    }
-
-  ATOMIC_TAS_64 (&next_trans_status_history->bit_area_start_mvccid, bit_area_start_mvccid);
-  ATOMIC_TAS_32 (&next_trans_status_history->bit_area_length, bit_area_length);
-
-  count = current_trans_status->long_tran_mvccids_length;
-  for (i = 0; i < count; i++)
-    {
-      ATOMIC_TAS_64 (next_trans_status_history->long_tran_mvccids + i, current_trans_status->long_tran_mvccids[i]);
-    }
-  ATOMIC_TAS_32 (&next_trans_status_history->long_tran_mvccids_length, count);
+  logtb_copy_trans_status (next_trans_status_history, current_trans_status, bit_area_start_mvccid, bit_area_length);
 
   /* prevent code rearrangement */
   ATOMIC_TAS_32 (&mvcc_table->trans_status_history_position, next_history_position);
@@ -6137,83 +6123,42 @@ end_completed:
     }
 }
 
+#if defined(HAVE_ATOMIC_BUILTINS)
 /*
- * logtb_get_highest_completed_mvccid - get highest completed MVCCID
+ * logtb_copy_trans_status - copy current transaction status into a transaction status history entry
  *
- * return: error code
- * 
- * bit_area(in): bit area
- * bit_area_length(in): bit area length
+ * return: nothing
+ *
+ * dest(in/out): history entry that will be published next
+ * src(in): current transaction status
  * bit_area_start_mvccid(in): bit area start MVCCID
- * long_tran_mvccids(in): long time MVCCID array
- * long_tran_mvccids_length(in): long time MVCCID array length
- * highest_completed_position(out): highest completed position
- * 
- * Note: This function get the position in bit area of the highest completed
- *     MVCCID. If bit_area_length is 0 or all bits in bit area are 0 
- *     the highest completed MVCCID is set to bit_area_start_mvccid - 1
+ * bit_area_length(in): bit area length
+ *
+ * Note: The caller holds active_trans_mutex and has already changed the version of dest, so concurrent snapshot
+ *     readers of dest will retry. That is why plain copies are enough here. The barrier guarantees that the
+ *     content is visible before the caller publishes the new history position.
  */
-void
-logtb_get_highest_completed_mvccid (UINT64 * bit_area, int bit_area_length, MVCCID bit_area_start_mvccid,
-				    MVCCID * highest_completed_mvccid)
+static void
+logtb_copy_trans_status (MVCC_TRANS_STATUS * dest, MVCC_TRANS_STATUS * src, MVCCID bit_area_start_mvccid,
+			 int bit_area_length)
 {
-  MVCC_INFO *mvccinfo = NULL;
-  MVCCTABLE *mvcc_table = NULL;
-  int try_count = 0;
-  UINT64 *highest_completed_bit_area = NULL;
-  int bit_pos, count_bits;
-  bool need_transaction_lowest_active_mvccid = false;
-  UINT64 bits;
-  int highest_bit_pos, end_position;
-  int position = 0;
-  assert (bit_area != NULL && highest_completed_mvccid != NULL && bit_area_start_mvccid >= MVCCID_FIRST
-	  && bit_area_length >= 0);
-
-  if (bit_area_length == 0)
+  if (bit_area_length > 0)
     {
-      *highest_completed_mvccid = bit_area_start_mvccid - 1;
-
-      return;
+      memcpy (dest->bit_area, src->bit_area, MVCC_BITAREA_BITS_TO_BYTES (bit_area_length));
     }
+  dest->bit_area_start_mvccid = bit_area_start_mvccid;
+  dest->bit_area_length = bit_area_length;
 
-  /* compute highest highest_bit_pos and highest_completed_bit_area */
-  highest_bit_pos = -1;
-  end_position = bit_area_length - 1;
-  highest_completed_bit_area = MVCC_GET_BITAREA_ELEMENT_PTR (bit_area, end_position);
-  while (highest_completed_bit_area >= bit_area)
+  if (src->long_tran_mvccids_length > 0)
     {
-      bits = *highest_completed_bit_area;
-      if (bits != 0)
-	{
-	  /* find most significant bit 1 position */
-	  for (bit_pos = 0, count_bits = MVCC_BITAREA_ELEMENT_BITS / 2; count_bits > 0; count_bits >>= 1)
-	    {
-	      if (bits >= (1ULL << count_bits))
-		{
-		  bit_pos += count_bits;
-		  bits >>= count_bits;
-		}
-	    }
-
-	  assert (bit_pos >= 0 && bit_pos < MVCC_BITAREA_ELEMENT_BITS);
-	  highest_bit_pos = bit_pos;
-	  break;
-	}
-
-      --highest_completed_bit_area;
+      memcpy (dest->long_tran_mvccids, src->long_tran_mvccids, src->long_tran_mvccids_length * sizeof (MVCCID));
     }
+  dest->long_tran_mvccids_length = src->long_tran_mvccids_length;
+  dest->highest_completed_mvccid = src->highest_completed_mvccid;
 
-  /* compute highest_completed */
-  if (highest_bit_pos == -1)
-    {
-      *highest_completed_mvccid = bit_area_start_mvccid - 1;
-    }
-  else
-    {
-      count_bits = MVCC_BITAREA_ELEMENTS_TO_BITS ((int) (highest_completed_bit_area - bit_area));
-      *highest_completed_mvccid = bit_area_start_mvccid + count_bits + highest_bit_pos;
-    }
+  MEMORY_BARRIER ();
 }
+#endif /* HAVE_ATOMIC_BUILTINS */
 
 /*
  * logtb_get_lowest_active_mvccid - get lowest active MVCID
@@ -6806,6 +6751,7 @@ logtb_reset_bit_area_start_mvccid (void)
   assert (trans_status->bit_area_length == 0 && trans_status->bit_area[0] == 0);
   trans_status->bit_area_start_mvccid = log_Gl.hdr.mvcc_next_id;
   trans_status->lowest_active_mvccid = log_Gl.hdr.mvcc_next_id;
+  trans_status->highest_completed_mvccid = log_Gl.hdr.mvcc_next_id - 1;
 
   history_position = (log_Gl.mvcc_table).trans_status_history_position;
   assert ((history_position >= 0) && (history_position < TRANS_STATUS_HISTORY_MAX_SIZE));
@@ -6813,6 +6759,7 @@ logtb_reset_bit_area_start_mvccid (void)
   assert (trans_status->bit_area_length == 0);
   trans_status->bit_area_start_mvccid = log_Gl.hdr.mvcc_next_id;
   trans_status->lowest_active_mvccid = log_Gl.hdr.mvcc_next_id;
+  trans_status->highest_completed_mvccid = log_Gl.hdr.mvcc_next_id - 1;
 }
 
 /*
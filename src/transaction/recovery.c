@@ -802,6 +802,13 @@ struct rvfun RV_fun[] = {
    NULL,
    NULL},
 
+  {RVHF_FREESPACE_MAP,
+   "RVHF_FREESPACE_MAP",
+   log_rv_copy_char,
+   log_rv_copy_char,
+   log_rv_dump_char,
+   log_rv_dump_char},
+
 };
 
 /*
@@ -177,7 +177,9 @@ typedef enum
   RVPGBUF_DEALLOC = 122,
   RVPGBUF_COMPENSATE_DEALLOC = 123,
 
-  RV_LAST_LOGID = RVPGBUF_COMPENSATE_DEALLOC,
+  RVHF_FREESPACE_MAP = 124,
+
+  RV_LAST_LOGID = RVHF_FREESPACE_MAP,
 
   RV_NOT_DEFINED = 999
 } LOG_RCVINDEX;